@@ -0,0 +1 @@
+return {path="../jsu/anim.js",stamp="4070:1171519:65024:1792361468",value={requires={"view.js","class.js"}}}
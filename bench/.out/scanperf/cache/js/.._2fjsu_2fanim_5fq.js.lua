@@ -0,0 +1 @@
+return {path="../jsu/anim_q.js",stamp="2605:1171522:65024:1792361468",value={requires={"expect.js","dom_emu.js","scheduler_emu.js","anim.js"}}}
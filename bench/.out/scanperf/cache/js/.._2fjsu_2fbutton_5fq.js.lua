@@ -0,0 +1 @@
+return {path="../jsu/button_q.js",value={requires={"expect.js","dom_emu.js","button.js"}},stamp="396:1171525:65024:1792361468"}
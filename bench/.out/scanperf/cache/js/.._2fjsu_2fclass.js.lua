@@ -0,0 +1 @@
+return {path="../jsu/class.js",stamp="628:1171526:65024:1792361468",value={requires={}}}
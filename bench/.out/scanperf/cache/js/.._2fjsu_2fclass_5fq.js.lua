@@ -0,0 +1 @@
+return {stamp="1015:1171528:65024:1792361468",path="../jsu/class_q.js",value={requires={"class.js","expect.js"}}}
@@ -0,0 +1 @@
+return {value={requires={}},stamp="1761:1171529:65024:1792361468",path="../jsu/clocker.js"}
@@ -0,0 +1 @@
+return {path="../jsu/dom_emu.js",stamp="10889:1171531:65024:1792361468",value={requires={"class.js","expect.js"}}}
@@ -0,0 +1 @@
+return {value={requires={"expect.js","eventutils.js"}},path="../jsu/eventutils_q.js",stamp="772:1171533:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="../jsu/expect.js",stamp="3163:1171534:65024:1792361468",value={requires={"fs","serialize.js"}}}
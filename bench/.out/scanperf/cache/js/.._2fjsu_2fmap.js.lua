@@ -0,0 +1 @@
+return {value={requires={}},stamp="1685:1171537:65024:1792361468",path="../jsu/map.js"}
@@ -0,0 +1 @@
+return {path="../jsu/memoize.js",stamp="2117:1171538:65024:1792361468",value={requires={}}}
@@ -0,0 +1 @@
+return {value={requires={"memoize.js","memoize2.js","expect.js","clocker.js"}},stamp="1702:1171540:65024:1792361468",path="../jsu/memoize_q.js"}
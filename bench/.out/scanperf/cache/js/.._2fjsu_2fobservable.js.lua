@@ -0,0 +1 @@
+return {path="../jsu/observable.js",stamp="7103:1171541:65024:1792361468",value={requires={"class.js","memoize.js"}}}
@@ -0,0 +1 @@
+return {path="../jsu/observable_q.js",value={requires={"observable.js","expect.js"}},stamp="5027:1171543:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="6371:1171546:65024:1792363182",value={requires={"expect.js","oweb.js","xhttp_emu.js","scheduler_emu.js"}},path="../jsu/oweb_q.js"}
@@ -0,0 +1 @@
+return {path="../jsu/psarray.js",stamp="1384:1171547:65024:1792361468",value={requires={"class.js"}}}
@@ -0,0 +1 @@
+return {path="../jsu/psarray_q.js",stamp="1246:1171549:65024:1792361468",value={requires={"psarray.js","expect.js"}}}
@@ -0,0 +1 @@
+return {path="../jsu/random.js",stamp="562:1171550:65024:1792361468",value={requires={}}}
@@ -0,0 +1 @@
+return {path="../jsu/random_q.js",stamp="159:1171551:65024:1792361468",value={requires={"expect.js","random.js"}}}
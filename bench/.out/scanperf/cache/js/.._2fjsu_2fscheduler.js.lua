@@ -0,0 +1 @@
+return {path="../jsu/scheduler.js",value={requires={}},stamp="964:1171552:65024:1792361468"}
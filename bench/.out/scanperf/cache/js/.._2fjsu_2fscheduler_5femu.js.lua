@@ -0,0 +1 @@
+return {path="../jsu/scheduler_emu.js",stamp="1340:1171553:65024:1792361468",value={requires={}}}
@@ -0,0 +1 @@
+return {path="../jsu/serialize.js",stamp="2990:1171554:65024:1792361468",value={requires={}}}
@@ -0,0 +1 @@
+return {path="../jsu/serialize_q.js",stamp="653:1171555:65024:1792361468",value={requires={"serialize.js"}}}
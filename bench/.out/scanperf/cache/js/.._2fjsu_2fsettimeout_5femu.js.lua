@@ -0,0 +1 @@
+return {path="../jsu/settimeout_emu.js",value={requires={}},stamp="255:1171556:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={requires={"dom_emu.js","view.js","observable.js","splitter.js","expect.js"}},stamp="799:1171560:65024:1792361468",path="../jsu/splitter_q.js"}
@@ -0,0 +1 @@
+return {path="../jsu/view.js",stamp="9944:1171561:65024:1792361468",value={requires={"class.js","observable.js"}}}
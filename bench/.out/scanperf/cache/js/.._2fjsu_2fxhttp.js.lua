@@ -0,0 +1 @@
+return {stamp="2674:1171564:65024:1792363136",value={requires={}},path="../jsu/xhttp.js"}
@@ -0,0 +1 @@
+return {stamp="1795:1171565:65024:1792363143",value={requires={"xhttp.js"}},path="../jsu/xhttp_emu.js"}
@@ -0,0 +1,109 @@
+-- Measure smark_art rendering time for generated diagrams with many boxes.
+--
+-- Usage:  lua artperf.lua [BOXES]
+--
+-- Each diagram is a grid of cells.  Cells contain plain boxes, pairs of
+-- boxes that cross each other, nested boxes, and boxes partially hidden
+-- behind others (whose shapes must be inferred), with connecting lines.
+-- The output of each render is summarized by a checksum so that changes
+-- to the algorithm can be checked for identical results.
+
+local smark_art = require "smark_art"
+local Html2D = require "html2d"
+local serialize = require("serialize").serialize
+
+local clock = os.clock
+
+local numBoxes = tonumber(arg[1]) or 400
+
+
+-- Cell templates, each 8 rows x 16 columns.
+local templates = {
+   {  "                ",
+      " +--------+     ",
+      " |  box   |---->",
+      " |        |     ",
+      " +--------+     ",
+      "      |         ",
+      "      v         ",
+      "                " },
+
+   {  "                ",
+      " +------+       ",
+      " |    +-+-----+ ",
+      " |    | |     | ",
+      " +----+-+     | ",
+      "      |  x    | ",
+      "      +-------+ ",
+      "                " },
+
+   {  "                ",
+      " .-----------.  ",
+      " | +-------+ |  ",
+      " | | in    | |  ",
+      " | +-------+ |--",
+      " |   out     |  ",
+      " '-----------'  ",
+      "                " },
+
+   {  "                ",
+      " +-----+        ",
+      " | A   |--+     ",
+      " +-----+ B|--+  ",
+      "   +------+ C|  ",
+      "      +------+  ",
+      "                ",
+      "----------------" },
+}
+
+local boxesPerTemplate = { 1, 2, 2, 3 }
+
+
+local function genDiagram(n)
+   local cols = math.max(1, math.floor(math.sqrt(n / 2)))
+   local lines = {}
+   local count, cell = 0, 0
+   while count < n do
+      local row = {}
+      for c = 1, cols do
+         local t = (cell + c) % #templates + 1
+         row[c] = t
+         count = count + boxesPerTemplate[t]
+      end
+      cell = cell + 1
+      for y = 1, 8 do
+         local o = {}
+         for c, t in ipairs(row) do
+            o[c] = templates[t][y]
+         end
+         lines[#lines+1] = table.concat(o)
+      end
+   end
+   return table.concat(lines, "\n") .. "\n", count
+end
+
+
+local function checksum(str)
+   local h = 0
+   for ii = 1, #str, 7 do
+      h = (h * 31 + str:byte(ii)) % 4294967291
+   end
+   return ("%08x"):format(h)
+end
+
+
+local function render(text)
+   local gc = Html2D:new()
+   smark_art.render2D({ text = text }, gc)
+   return serialize(gc:genTree(), nil, "s")
+end
+
+
+for _, n in ipairs{ math.floor(numBoxes / 4), math.floor(numBoxes / 2), numBoxes } do
+   local text, boxes = genDiagram(n)
+   local t0 = clock()
+   local out = render(text)
+   local t = clock() - t0
+   print(("%4d boxes, %5d lines: %7.3f s   [%s]"):format(
+         boxes, select(2, text:gsub("\n", "")), t, checksum(out)))
+end
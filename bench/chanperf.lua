@@ -0,0 +1,156 @@
+-- Measure channel throughput and Event wake-up cost.
+--
+-- Usage:  lua chanperf.lua [MESSAGES]
+--
+-- Channel modes pass MESSAGES values from producer threads to consumer
+-- threads:
+--
+--   poll           : ad-hoc handoff: a shared table, polled with yield()
+--                    and emptied in batches of up to 64
+--   pingpong       : request/response over two capacity-1 channels
+--   stream cap=N   : one producer and one consumer
+--   fan-in 8->1    : eight producers, one consumer, capacity 64
+--
+-- Event modes make MESSAGES/20 threads wait on one event and then wake
+-- them one at a time with signal(1):
+--
+--   event          : event.lua
+--   event (array)  : the previous implementation, which shifted the array
+--                    of waiters on each signal
+
+local xpio = require "xpio"
+local thread = require "thread"
+local Channel = require "channel"
+local Event = require "event"
+
+local gettime = xpio.gettime
+
+local numMessages = tonumber(arg[1]) or 200000
+
+
+local function poll()
+   local box = {}
+   local producer = thread.new(function ()
+      for n = 1, numMessages do
+         while #box >= 64 do
+            thread.yield()
+         end
+         box[#box+1] = n
+      end
+   end)
+   local got = 0
+   while got < numMessages do
+      if box[1] then
+         got = got + #box
+         box = {}
+      end
+      thread.yield()
+   end
+   thread.join(producer)
+end
+
+
+local function pingpong()
+   local req, rsp = Channel:new(1), Channel:new(1)
+   thread.new(function ()
+      for v in function () return req:recv() end do
+         rsp:send(v)
+      end
+   end)
+   for n = 1, numMessages do
+      req:send(n)
+      rsp:recv()
+   end
+   req:close()
+end
+
+
+local function stream(capacity, producers)
+   return function ()
+      local ch = Channel:new(capacity)
+      local threads = {}
+      for p = 1, producers do
+         threads[p] = thread.new(function ()
+            for n = 1, numMessages / producers do
+               ch:send(n)
+            end
+         end)
+      end
+      thread.new(function ()
+         for _, t in ipairs(threads) do
+            thread.join(t)
+         end
+         ch:close()
+      end)
+      local got = 0
+      while ch:recv() do
+         got = got + 1
+      end
+      assert(got == numMessages)
+   end
+end
+
+
+-- Event as implemented before (waiters shifted down on each signal).
+--
+local ArrayEvent = {}
+ArrayEvent.__index = ArrayEvent
+
+function ArrayEvent:wait()
+   self[#self+1] = xpio.getCurrentTask()
+   coroutine.yield()
+end
+
+function ArrayEvent:signal(count)
+   local maxElem = #self
+   count = math.min(count, maxElem)
+   for ndx = 1, maxElem do
+      if ndx <= count then
+         self[ndx]:makeReady()
+      end
+      self[ndx] = self[ndx+count]
+   end
+   return count
+end
+
+
+local function wakeOneByOne(newEvent)
+   return function ()
+      local evt = newEvent()
+      local numWaiters = numMessages / 20
+      for _ = 1, numWaiters do
+         thread.new(evt.wait, evt)
+      end
+      thread.yield()
+      for _ = 1, numWaiters do
+         evt:signal(1)
+      end
+   end
+end
+
+
+local modes = {
+   { "poll", numMessages, poll },
+   { "pingpong", numMessages, pingpong },
+   { "stream cap=1", numMessages, stream(1, 1) },
+   { "stream cap=64", numMessages, stream(64, 1) },
+   { "stream cap=1024", numMessages, stream(1024, 1) },
+   { "fan-in 8->1", numMessages, stream(64, 8) },
+   { "event", numMessages / 20,
+     wakeOneByOne(function () return Event:new() end) },
+   { "event (array)", numMessages / 20,
+     wakeOneByOne(function () return setmetatable({}, ArrayEvent) end) },
+}
+
+
+local function main()
+   for _, m in ipairs(modes) do
+      local name, count, fn = table.unpack(m)
+      local t0 = gettime()
+      thread.join(thread.new(fn))
+      local t = gettime() - t0
+      print(("%-16s %7d  %6.3f s  %9.0f /s"):format(name, count, t, count / t))
+   end
+end
+
+thread.dispatch(main)
@@ -0,0 +1,83 @@
+-- Measure CSV decoding throughput: csv.decode vs. csv.rows (streaming, with
+-- and without the native scanner) vs. csv.decodeColumns
+--
+-- Usage:  lua csvperf.lua [ROWS]
+
+local csv = require "csv"
+
+local clock = os.clock
+
+local numRows = tonumber(arg[1]) or 100000
+
+
+local function genText(n)
+   local o = { "#csv id,name,price,qty,note\n" }
+   for ii = 1, n do
+      o[#o+1] = ('%d,item %d,%.2f,%d,"note, with ""quotes"" #%d"\n')
+         :format(ii, ii, ii * 0.25, ii % 97, ii)
+   end
+   return table.concat(o)
+end
+
+
+local function newReader(text, size)
+   local pos = 1
+   return function ()
+      if pos <= #text then
+         local s = text:sub(pos, pos + size - 1)
+         pos = pos + size
+         return s
+      end
+   end
+end
+
+
+local function sumRows(nextRow)
+   local sum = 0
+   for row in nextRow do
+      sum = sum + tonumber(row.qty)
+   end
+   return sum
+end
+
+
+local text = genText(numRows)
+local mb = #text / 1e6
+local types = { id = "number", price = "number", qty = "number" }
+
+print(("Data: %d rows, %.1f MB"):format(numRows, mb))
+if not csv.isNative then
+   print("Native scanner (csv_c) not found; all cases use Lua.")
+end
+
+local cases = {
+   { "decode", function ()
+        local sum = 0
+        for _, row in ipairs(csv.decode(text)) do
+           sum = sum + tonumber(row.qty)
+        end
+        return sum
+     end },
+   { "rows", function () return sumRows(csv.rows(text)) end },
+   { "rows 64K", function () return sumRows(csv.rows(newReader(text, 65536))) end },
+   { "columns", function ()
+        local t = csv.decodeColumns(text, nil, types)
+        local sum, qty = 0, t.columns.qty
+        for ii = 1, t.n do
+           sum = sum + qty[ii]
+        end
+        return sum
+     end },
+}
+
+local expected
+for _, case in ipairs(cases) do
+   local name, fn = case[1], case[2]
+   collectgarbage()
+   local t0 = clock()
+   local sum = fn()
+   local t = clock() - t0
+   expected = expected or sum
+   assert(sum == expected)
+   print(("%-10s  %7.1f MB/s   %9.0f rows/s"):format(name, mb / t, numRows / t))
+end
@@ -0,0 +1,101 @@
+-- Measure request latency under thread.dispatch with and without idle-time
+-- garbage collection.
+--
+-- Usage:  lua gcperf.lua [REQUESTS]
+--
+-- Simulated clients alternate between waiting (so that the dispatcher goes
+-- idle) and handling a request that allocates short-lived garbage, while a
+-- large long-lived heap makes each GC cycle expensive.  Handler times are
+-- reported as percentiles, so GC work done inside handlers shows up in the
+-- tail.  "wake" is the delay between the time a client was due to wake and
+-- the time it ran, which includes idle-time GC slices that overran their
+-- budget.  "slice" is the longest idle-time GC slice.
+
+local thread = require "thread"
+local xpio = require "xpio"
+
+local gettime = xpio.gettime
+
+local numRequests = tonumber(arg[1]) or 4000
+local numClients = 8
+
+
+-- long-lived data
+local heap = {}
+for ii = 1, 300000 do
+   heap[ii] = { ii, "v" .. ii }
+end
+
+
+local function handle(n)
+   local t = {}
+   for ii = 1, 600 do
+      t[ii] = { n, ii, tostring(ii) }
+   end
+   return #t
+end
+
+
+local function percentile(sorted, p)
+   return sorted[math.max(1, math.ceil(#sorted * p))]
+end
+
+
+local function run(name, cfg)
+   local saved = {}
+   for k, v in pairs(cfg) do
+      saved[k], thread.gc[k] = thread.gc[k], v
+   end
+   collectgarbage()
+
+   local times = {}
+   local wakes = {}
+   local stats
+
+   local function client(count)
+      for _ = 1, count do
+         local delay = 0.002 + math.random() * 0.004
+         local due = gettime() + delay
+         thread.sleep(delay)
+         local t0 = gettime()
+         wakes[#wakes+1] = t0 - due
+         handle(count)
+         times[#times+1] = gettime() - t0
+      end
+   end
+
+   local function main()
+      local tasks = {}
+      for ii = 1, numClients do
+         tasks[ii] = thread.new(client, math.floor(numRequests / numClients))
+      end
+      for _, t in ipairs(tasks) do
+         thread.join(t)
+      end
+      stats = thread.gcStats()
+   end
+
+   local t0 = os.clock()
+   thread.dispatch(main)
+   local cpu = os.clock() - t0
+
+   table.sort(times)
+   table.sort(wakes)
+   print(("%-22s p50 %5.2f  p99 %5.2f  max %6.2f   wake p99 %5.2f  max %6.2f   slice max %5.2f ms   cpu %.2f s   idle GC: %d slices, %.0f ms, %d forced")
+         :format(name, percentile(times, 0.5) * 1e3, percentile(times, 0.99) * 1e3,
+                 times[#times] * 1e3, percentile(wakes, 0.99) * 1e3, wakes[#wakes] * 1e3,
+                 stats.max * 1e3, cpu, stats.slices, stats.time * 1e3, stats.forced))
+
+   for k, v in pairs(saved) do
+      thread.gc[k] = v
+   end
+end
+
+
+print(("%d requests, %d clients, %.0f KB heap"):format(
+         numRequests, numClients, collectgarbage("count")))
+
+run("no idle GC", { budget = 0 })
+run("incremental + idle GC", {})
+run("idle-only GC", { mode = "idle" })
+run("generational", { mode = "generational", budget = 0 })
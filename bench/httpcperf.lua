@@ -0,0 +1,98 @@
+-- Measure HTTP client throughput against web.lua over loopback.
+--
+-- Usage:  lua httpcperf.lua [REQUESTS] [ADDR]
+--
+-- web.lua is started as a child process.  The same number of GET requests
+-- are made in each of these modes:
+--
+--   close      : a new connection for each request
+--   pooled     : sequential requests on pooled keep-alive connections
+--   pooled x4  : four threads sharing one client (and its pool)
+--   pipelined  : batches of 16 requests pipelined on one connection
+--
+-- The rate reported is requests completed per second of wall-clock time.
+
+local xpio = require "xpio"
+local thread = require "thread"
+local HTTPC = require "httpc"
+
+local gettime = xpio.gettime
+
+local numRequests = tonumber(arg[1]) or 4000
+local addr = arg[2] or "127.0.0.1:8017"
+local url = "http://" .. addr .. "/hello"
+local batch = 16
+
+
+local function startServer()
+   local r, w = xpio.pipe()
+   local proc = assert(xpio.spawn({arg[-1], "web.lua", addr}, xpio.env,
+                                  {[0] = 0, [1] = w, [2] = 2}))
+   local out = ""
+   repeat
+      local data = r:read(1024)
+      out = out .. (data or "")
+   until not data or out:match("Listening")
+   r:close()
+   assert(out:match("Listening"), "web.lua did not start")
+   return proc
+end
+
+
+local function get(client, n)
+   for _ = 1, n do
+      local rsp = assert(client:request{ url = url })
+      assert(rsp.status == 200)
+   end
+end
+
+
+local modes = {
+   { "close", function ()
+        get(HTTPC:new{ keepAlive = false }, numRequests)
+     end },
+
+   { "pooled", function ()
+        get(HTTPC:new(), numRequests)
+     end },
+
+   { "pooled x4", function ()
+        local client = HTTPC:new()
+        local threads = {}
+        for ii = 1, 4 do
+           threads[ii] = thread.new(get, client, numRequests / 4)
+        end
+        for _, t in ipairs(threads) do
+           thread.join(t)
+        end
+     end },
+
+   { "pipelined", function ()
+        local client = HTTPC:new()
+        local reqs = {}
+        for ii = 1, batch do
+           reqs[ii] = { url = url }
+        end
+        for _ = 1, numRequests / batch do
+           for _, rsp in ipairs(assert(client:pipeline(reqs))) do
+              assert(rsp.status == 200)
+           end
+        end
+     end },
+}
+
+
+local function main()
+   local proc = startServer()
+   for _, m in ipairs(modes) do
+      local t0 = gettime()
+      m[2]()
+      local t = gettime() - t0
+      print(("%-10s %6d requests  %6.3f s  %8.0f requests/s")
+            :format(m[1], numRequests, t, numRequests / t))
+   end
+   proc:kill()
+   proc:wait()
+end
+
+thread.dispatch(main)
@@ -0,0 +1,90 @@
+-- Measure throughput of a three-stage process pipeline.
+--
+-- Usage:  lua pipeperf.lua [MEGABYTES]
+--
+-- The pipeline generates MEGABYTES of data, translates it, and counts it:
+--
+--     head -c N /dev/zero | tr '\0' a | wc -c
+--
+-- Modes:
+--
+--   direct : pipeline() connects the stages to each other
+--   relay  : each stage is a separate child whose output is read by Lua
+--            and written to the next stage (as with chained popen calls)
+
+local xpio = require "xpio"
+local thread = require "thread"
+local pipeline = require "pipeline"
+
+local gettime = xpio.gettime
+
+local megabytes = tonumber(arg[1]) or 64
+
+local stages = {
+   {"head", "-c", tostring(megabytes * 1024 * 1024), "/dev/zero"},
+   {"tr", "\\0", "a"},
+   {"wc", "-c"},
+}
+
+
+local function direct()
+   local p = pipeline(stages, { stdout = "pipe" })
+   local count = tonumber(p.stdout:read("*a"))
+   p:close()
+   return count
+end
+
+
+local function copy(from, to)
+   repeat
+      local data = from:read(65536)
+      if data then
+         to:write(data)
+      end
+   until not data
+   from:close()
+   to:close()
+end
+
+
+local function relay()
+   local procs = {}
+   for ndx, command in ipairs(stages) do
+      procs[ndx] = pipeline({command}, {
+         stdin = ndx > 1 and "pipe" or nil,
+         stdout = "pipe",
+      })
+   end
+   local copiers = {}
+   for ndx = 2, #procs do
+      copiers[#copiers+1] = thread.new(copy, procs[ndx-1].stdout, procs[ndx].stdin)
+   end
+   local count = tonumber(procs[#procs].stdout:read("*a"))
+   for _, t in ipairs(copiers) do
+      thread.join(t)
+   end
+   for _, p in ipairs(procs) do
+      p:close()
+   end
+   return count
+end
+
+
+local modes = {
+   { "direct", direct },
+   { "relay", relay },
+}
+
+
+local function main()
+   for _, m in ipairs(modes) do
+      local name, fn = table.unpack(m)
+      local t0 = gettime()
+      local count = fn()
+      local t = gettime() - t0
+      assert(count == megabytes * 1024 * 1024)
+      print(("%-8s %5d MB  %6.3f s  %8.1f MB/s"):format(name, megabytes, t, megabytes / t))
+   end
+end
+
+thread.dispatch(main)
@@ -0,0 +1,74 @@
+-- Measure throughput of the native and Lua SAX parsers in xml.lua
+--
+-- Usage:  lua saxperf.lua [RECORDS]
+
+local xml = require "xml"
+
+local clock = os.clock
+
+local numRecords = tonumber(arg[1]) or 20000
+
+
+local function genDocument(n)
+   local o = { '<?xml version="1.0"?>\n<feed>\n' }
+   for ii = 1, n do
+      o[#o+1] = ('<entry id="%d" kind="item" updated="2014-06-%02d">' ..
+                 '<title>Entry #%d &amp; friends</title>' ..
+                 '<summary>Lorem ipsum dolor sit amet, consectetur ' ..
+                 'adipiscing elit &lt;%d&gt;.</summary>' ..
+                 '<!-- comment --><data><![CDATA[raw <data> %d]]></data>' ..
+                 '<link href="http://example.com/%d"/></entry>\n')
+         :format(ii, ii % 28 + 1, ii, ii, ii, ii)
+   end
+   o[#o+1] = '</feed>\n'
+   return table.concat(o)
+end
+
+
+local function newReader(text, size)
+   local pos = 1
+   return function ()
+      if pos <= #text then
+         local s = text:sub(pos, pos + size - 1)
+         pos = pos + size
+         return s
+      end
+   end
+end
+
+
+local function run(sax, source)
+   local count = 0
+   local function fnText(str, getText)
+      count = count + #getText()
+   end
+   local function fnStart(name, attrs)
+      count = count + 1
+   end
+   local t0 = clock()
+   assert(sax(source, fnText, fnStart))
+   return clock() - t0, count
+end
+
+
+local text = genDocument(numRecords)
+local mb = #text / 1e6
+
+print(("Document: %d records, %.1f MB"):format(numRecords, mb))
+if not xml.isNative then
+   print("Native tokenizer (xml_c) not found; results compare Lua to Lua.")
+end
+
+local results = {}
+for _, case in ipairs {
+   { "string", function () return text end },
+   { "stream 64K", function () return newReader(text, 65536) end },
+   { "stream 512", function () return newReader(text, 512) end },
+} do
+   local name, getSource = case[1], case[2]
+   local tLua, nLua = run(xml._luaSAX, getSource())
+   local tNative, nNative = run(xml.SAX, getSource())
+   assert(nLua == nNative)
+   print(("%-12s  Lua: %7.1f MB/s   native: %7.1f MB/s   (x%.1f)")
+            :format(name, mb / tLua, mb / tNative, tLua / tNative))
+end
@@ -0,0 +1,71 @@
+-- scanperf: measure dependency scanning with and without a scan cache
+--
+-- Usage:  lua scanperf.lua LUADIR JSDIR
+--
+-- Runs `cfromlua -MF` for each *_q.lua file in LUADIR, and `jsdep -MF`
+-- for each *_q.js file in JSDIR, one process per file as in LuaScan() and
+-- JSScan().  Each set is run without a cache, then with an empty ("cold")
+-- cache, and then with a populated ("warm") cache.
+
+local xpio = require "xpio"
+local xpfs = require "xpfs"
+local lfsu = require "lfsu"
+
+local luaDir = arg[1] or "../luau"
+local jsDir = arg[2] or "../jsu"
+
+local outDir = (os.getenv("OUTDIR") or ".out/") .. "scanperf/"
+local cfromlua = "../build-lua/cfromlua.lua"
+local jsdep = "../build-js/jsdep.lua"
+
+-- The interpreter running this script
+local luaExe = arg[-1]
+
+
+local function findFiles(dir, suffix)
+   local files = {}
+   for _, name in ipairs(xpfs.dir(dir)) do
+      if name:sub(-#suffix) == suffix then
+         files[#files+1] = dir .. "/" .. name
+      end
+   end
+   table.sort(files)
+   return files
+end
+
+
+local function run(name, files, makeCommand, cache)
+   local t0 = xpio.gettime()
+   for _, file in ipairs(files) do
+      local cmd = makeCommand(file, outDir .. "out.d")
+      if cache then
+         cmd = cmd .. " --scan-cache=" .. cache
+      end
+      assert(os.execute(cmd .. " > /dev/null 2>&1"), cmd)
+   end
+   local t = xpio.gettime() - t0
+   print(("%-18s %8.3f s   %7.1f ms/file"):format(name, t, t / #files * 1e3))
+end
+
+
+local function measure(title, files, makeCommand)
+   print(("%s: %d files"):format(title, #files))
+   local cache = outDir .. "cache"
+   lfsu.rm_rf(cache)
+   run("no cache", files, makeCommand)
+   run("cold cache", files, makeCommand, cache)
+   run("warm cache", files, makeCommand, cache)
+end
+
+
+lfsu.mkdir_p(outDir)
+
+measure("cfromlua", findFiles(luaDir, "_q.lua"), function (file, mf)
+   return ("LUA_PATH='%s/?.lua;%s' %s %s %s -MF %s -MT x -w")
+      :format(luaDir, package.path, luaExe, cfromlua, file, mf)
+end)
+
+measure("jsdep", findFiles(jsDir, "_q.js"), function (file, mf)
+   return ("LUA_PATH='../build-js/?.lua;%s' %s %s --path=%s %s -MF %s -MT x")
+      :format(package.path, luaExe, jsdep, jsDir, file, mf)
+end)
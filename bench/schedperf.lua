@@ -0,0 +1,62 @@
+-- Measure how CPU-heavy threads delay a timer-driven thread.
+--
+-- Usage:  lua schedperf.lua [WORKERS] [SECONDS]
+--
+-- WORKERS threads each repeatedly compute for 0.5 ms and then yield.
+-- Meanwhile a "ticker" thread sleeps for 2 ms at a time and records how
+-- late it wakes up.  This is done with the workers in the "interactive"
+-- class (the default) and then in the "batch" class, whose work is limited
+-- by `thread.budget.batch` in each iteration of the dispatch loop.
+
+local xpio = require "xpio"
+local thread = require "thread"
+
+local gettime = xpio.gettime
+
+local numWorkers = tonumber(arg[1]) or 50
+local duration = tonumber(arg[2]) or 1
+
+
+local function run(class)
+   local tEnd = gettime() + duration
+   local slices = 0
+   local late, maxLate, ticks = 0, 0, 0
+
+   local function worker()
+      while gettime() < tEnd do
+         local t = gettime() + 0.0005
+         repeat until gettime() >= t
+         slices = slices + 1
+         thread.yield()
+      end
+   end
+
+   local function ticker()
+      while gettime() < tEnd do
+         local due = gettime() + 0.002
+         thread.sleepUntil(due)
+         local l = gettime() - due
+         late = late + l
+         ticks = ticks + 1
+         if l > maxLate then
+            maxLate = l
+         end
+      end
+   end
+
+   thread.dispatch(function ()
+      thread.setPriority("system")
+      thread.new(ticker)
+      for _ = 1, numWorkers do
+         thread.setPriority(class, thread.new(worker))
+      end
+   end)
+
+   print(("workers %-12s  ticker late: mean %6.2f ms  max %6.2f ms   work: %5d slices")
+         :format(class, late / ticks * 1e3, maxLate * 1e3, slices))
+end
+
+
+print(("%d workers, %g s"):format(numWorkers, duration))
+run("interactive")
+run("batch")
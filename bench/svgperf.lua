@@ -0,0 +1,108 @@
+-- Compare output size and rendering time of Html2D and Svg2D.
+--
+-- Usage:  lua svgperf.lua [REPEAT]
+--
+-- The diagrams rendered are the ASCII art examples in smark/art.txt and
+-- the sequence charts in smark/smark.txt.  Each set is rendered REPEAT
+-- times with each backend.  Sizes are the total of the HTML for all the
+-- diagrams in the set plus the style sheet text the backend adds to the
+-- document (each distinct rule counted once).
+
+local smark_art = require "smark_art"
+local mscgen = require "mscgen"
+local Html2D = require "html2d"
+local Svg2D = require "svg2d"
+
+local clock = os.clock
+
+local numRepeat = tonumber(arg[1]) or 20
+
+local smarkDir = assert(package.searchpath("smark_art", package.path)):match("(.-)[^/]*$")
+
+
+local function readFile(name)
+   local f = assert(io.open(smarkDir .. name, "r"))
+   local data = f:read("*a")
+   f:close()
+   return data
+end
+
+
+-- Return blocks of consecutive lines that begin with ":", as smark does.
+--
+local function artBlocks(txt)
+   local blocks, cur = {}
+   for line in txt:gmatch("([^\n]*)\n") do
+      if line:match("^:") then
+         cur = cur or {}
+         cur[#cur+1] = line:sub(2)
+      elseif cur then
+         blocks[#blocks+1] = table.concat(cur, "\n") .. "\n"
+         cur = nil
+      end
+   end
+   return blocks
+end
+
+
+-- Return the indented text following each ".msc" line.
+--
+local function mscBlocks(txt)
+   local blocks, cur = {}
+   for line in (txt .. "\n"):gmatch("([^\n]*)\n") do
+      if cur and (line:match("^%s") or line == "") then
+         cur[#cur+1] = line
+      elseif cur then
+         blocks[#blocks+1] = table.concat(cur, "\n")
+         cur = nil
+      end
+      if line == ".msc" then
+         cur = {}
+      end
+   end
+   return blocks
+end
+
+
+local sets = {
+   { name = "art.txt",   blocks = artBlocks(readFile("art.txt")),
+     render = function (text, gc) smark_art.render2D({ text = text }, gc) end },
+   { name = "smark.txt", blocks = mscBlocks(readFile("smark.txt")),
+     render = function (text, gc) mscgen.render(mscgen.parse(text, error), gc) end },
+}
+
+
+local function run(set, GC)
+   local htmlSize, rules = 0, {}
+   local t0 = clock()
+   for ii = 1, numRepeat do
+      for _, text in ipairs(set.blocks) do
+         local gc = GC:new()
+         set.render(text, gc)
+         local html, css = gc:genHTML()
+         if ii == 1 then
+            htmlSize = htmlSize + #html
+            for rule in (css or ""):gmatch("[^\n]+") do
+               rules[rule] = true
+            end
+         end
+      end
+   end
+   local t = (clock() - t0) / numRepeat
+
+   local cssSize = 0
+   for rule in pairs(rules) do
+      cssSize = cssSize + #rule + 1
+   end
+   return htmlSize, cssSize, t
+end
+
+
+for _, set in ipairs(sets) do
+   print(("%s: %d diagrams"):format(set.name, #set.blocks))
+   for _, b in ipairs{ {"Html2D", Html2D}, {"Svg2D", Svg2D} } do
+      local html, css, t = run(set, b[2])
+      print(("   %-7s html %7d B   css %5d B   total %7d B   %7.2f ms")
+            :format(b[1], html, css, html + css, t * 1e3))
+   end
+end
@@ -0,0 +1,76 @@
+-- Measure UDP throughput over loopback with per-datagram and batched xpio
+-- calls.
+--
+-- Usage:  lua udpperf.lua [PACKETS] [SIZE]
+--
+-- A sender and a receiver socket are driven from one loop: each round
+-- sends a burst of datagrams and then drains the receiving socket.  The
+-- rate reported is datagrams received per second of wall-clock time.
+
+local xpio = require "xpio"
+
+local gettime = xpio.gettime
+
+local numPackets = tonumber(arg[1]) or 200000
+local packetSize = tonumber(arg[2]) or 64
+local burst = 32
+
+
+local function newPair()
+   local a = assert(xpio.socket("UDP"))
+   local b = assert(xpio.socket("UDP"))
+   assert(b:setsockopt("SO_RCVBUF", 1024 * 1024))
+   assert(a:bind("127.0.0.1:0"))
+   assert(b:bind("127.0.0.1:0"))
+   assert(a:try_connect(b:getsockname()))
+   return a, b
+end
+
+
+local payload = {}
+for ii = 1, burst do
+   payload[ii] = ("%04d"):format(ii) .. ("x"):rep(packetSize - 4)
+end
+
+
+local function single(a, b)
+   local received = 0
+   for ii = 1, burst do
+      a:try_sendto(payload[ii])
+   end
+   while b:try_recvfrom() do
+      received = received + 1
+   end
+   return received
+end
+
+
+local function batched(a, b)
+   local received = 0
+   a:try_sendmany(payload)
+   repeat
+      local datas = b:try_recvmany(burst)
+      received = received + (datas and #datas or 0)
+   until not datas
+   return received
+end
+
+
+local function run(name, fn)
+   local a, b = newPair()
+   local received, rounds = 0, math.ceil(numPackets / burst)
+   local t0 = gettime()
+   for _ = 1, rounds do
+      received = received + fn(a, b)
+   end
+   local t = gettime() - t0
+   print(("%-9s %8d datagrams  %6.3f s  %9.0f datagrams/s  (%d lost)")
+         :format(name, received, t, received / t, rounds * burst - received))
+   a:close()
+   b:close()
+end
+
+
+print(("%d-byte datagrams, bursts of %d"):format(packetSize, burst))
+run("single", single)
+run("batched", batched)
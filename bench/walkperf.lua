@@ -0,0 +1,107 @@
+-- Measure directory traversal: recursion over xpfs.dir/xpfs.stat vs.
+-- xpfs.walk, and xpfs.stat vs. xpfs.statMany.
+--
+-- Usage:  lua walkperf.lua [FILES-PER-DIR]
+--
+-- A synthetic tree of 20 x 20 directories is created in a temporary
+-- directory and removed afterwards.
+
+local xpfs = require "xpfs"
+local lfsu = require "lfsu"
+
+local clock = os.clock
+
+local filesPerDir = tonumber(arg[1]) or 50
+
+
+local function genTree(top)
+   assert(xpfs.mkdir(top))
+   for a = 1, 20 do
+      local da = top .. "/d" .. a
+      assert(xpfs.mkdir(da))
+      for b = 1, 20 do
+         local db = da .. "/d" .. b
+         assert(xpfs.mkdir(db))
+         for c = 1, filesPerDir do
+            local f = assert(io.open(db .. "/f" .. c .. ".txt", "w"))
+            f:close()
+         end
+      end
+   end
+end
+
+
+-- Lua recursion: return number of files and directories
+--
+local function luaWalk(dir, files)
+   for _, name in ipairs(xpfs.dir(dir)) do
+      if name ~= "." and name ~= ".." then
+         local path = dir .. "/" .. name
+         files[#files+1] = path
+         if xpfs.stat(path, "Lk").kind == "d" then
+            luaWalk(path, files)
+         end
+      end
+   end
+   return files
+end
+
+
+local function time(name, fn)
+   collectgarbage()
+   local t0 = clock()
+   local count = fn()
+   local t = clock() - t0
+   print(("%-16s %8.3f s   %9.0f entries/s"):format(name, t, count / t))
+   return count
+end
+
+
+if not xpfs.walk then
+   print("xpfs.walk not available on this platform")
+   return
+end
+
+local top = os.tmpname()
+os.remove(top)
+genTree(top)
+
+local files = luaWalk(top, {})
+print(("Tree: %d entries"):format(#files))
+
+local n = #files
+local function check(count)
+   assert(count == n)
+   return count
+end
+
+time("dir+stat", function () return check(#luaWalk(top, {})) end)
+
+time("walk", function ()
+   local count = 0
+   for _, kind in xpfs.walk(top) do
+      count = count + 1
+   end
+   return check(count)
+end)
+
+time("walk stat='ks'", function ()
+   local count = 0
+   for _, kind, st in xpfs.walk(top, {stat="ks"}) do
+      count = count + 1
+   end
+   return check(count)
+end)
+
+time("stat loop", function ()
+   for ndx = 1, n do
+      xpfs.stat(files[ndx], "ks")
+   end
+   return n
+end)
+
+time("statMany", function ()
+   return check(#xpfs.statMany(files, "ks"))
+end)
+
+assert(lfsu.rm_rf(top))
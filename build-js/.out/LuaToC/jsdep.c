@@ -0,0 +1,2076 @@
+// Generated by cfromlua
+// lib: ../lpeg/.out/exports/lpeg.lib
+// lib: ../luau/.out/exports/xpfs.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "local qtest=require\"qtest\"\n"
+  "local scanjs=require\"scanjs\"\n"
+  "local getopts=require\"getopts\"\n"
+  "local fsu=require\"fsu\"\n"
+  "local scancache=require\"scancache\"\n"
+  "\n"
+  "local isWin=false\n"
+  "local fu=isWin and fsu.win or fsu.nix\n"
+  "\n"
+  "\n"
+  "local jsPath=os.getenv(\"NODE_PATH\")or\"\"\n"
+  "\n"
+  "local usageStr=[[\n"
+  "Usage:  jsdep [OPTIONS] JSFILE\n"
+  "\n"
+  "   Find all JavaScript files required by JSFILE by parsing the sources to\n"
+  "   detect calls to the Node/CommonJS `require` function.  Output all\n"
+  "   file names separated by a space.\n"
+  "\n"
+  "Options:\n"
+  "   -o OUTFILE   : write output to OUTFILE.\n"
+  "   --bundle     : output a bundle JavaScript file (instead of dependencies)\n"
+  "                  including the input file and all its dependencies.\n"
+  "   --html       : output HTML including the bundled JavaScript.\n"
+  "   -MF MKFILE   : write Make dependency rules to MKFILE.  The target for\n"
+  "                  the rules is given by -MT, if present, or -o otherwise.\n"
+  "   -MT TARGET   : specify the target name for rules generated by -MF.\n"
+  "   -MTF         : declare MKFILE itself as a target for non-oo rules.\n"
+  "   -Moo PATTERN : add order-only dependencues (when -MF is given),\n"
+  "                  computed by expanding PATTERN for each dependency.\n"
+  "   --path=PATH  : provide search path for JavaScript files; overrides\n"
+  "                  the NODE_PATH environment variable.\n"
+  "   --scan-cache=DIR : cache the results of scanning sources in DIR.\n"
+  "\n"
+  "Environment variables:\n"
+  "   NODE_PATH: a colon-delimited list of directories to be searched.\n"
+  "\n"
+  "Notes:\n"
+  "   Within PATTERN the following names are expanded:\n"
+  "\n"
+  "     ^F = the dependency\n"
+  "     ^B = the basename (non-suffix portion) of the dependency\n"
+  "     ^S = the suffix of the dependency (e.g. \".js\")\n"
+  "\n"
+  "   When -MOO is specified, after PATTERN is applied, if the resulting name\n"
+  "   matches that of the target, it will be omitted.\n"
+  "]]\n"
+  "\n"
+  "local function fail(...)\n"
+  "print(\"jsdep: error: \"..string.format(...))\n"
+  "os.exit(1)\n"
+  "end\n"
+  "\n"
+  "local function newArray()\n"
+  "return setmetatable({},{__index=table})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function fileExists(name)\n"
+  "local f=io.open(name,\"r\")\n"
+  "if f then\n"
+  "f:close()\n"
+  "return name\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function readFile(name)\n"
+  "local f=io.open(name,\"r\")\n"
+  "if f then\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function findJSModule(mod,fromFile)\n"
+  "mod=fu.cleanpath(mod)\n"
+  "\n"
+  "\n"
+  "\n"
+  "if mod:match(\"^%.\?%.\?/\")or mod:match(\"^%a:/$\")then\n"
+  "local fromDir=fu.splitpath(fromFile)\n"
+  "return fu.resolve(fromDir,mod)\n"
+  "end\n"
+  "\n"
+  "for dir in jsPath:gmatch(\"[^:]+\")do\n"
+  "local file=fu.resolve(dir,mod)\n"
+  "if fileExists(file)then\n"
+  "return file\n"
+  "end\n"
+  "end\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local files=newArray()\n"
+  "local filesIndex={}\n"
+  "local pathToMod={}\n"
+  "local scanCache\n"
+  "\n"
+  "\n"
+  "local function scanFile(file)\n"
+  "if filesIndex[file]then\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "files:insert(file)\n"
+  "filesIndex[file]=#files\n"
+  "\n"
+  "\n"
+  "\n"
+  "local o=scanCache and scanCache:get(file)\n"
+  "if not o then\n"
+  "local src=fsu.nix.read(file)\n"
+  "if not src then\n"
+  "return fail(\"could not read file: %s\",file)\n"
+  "end\n"
+  "o=scanjs.scan(src)\n"
+  "if scanCache then\n"
+  "scanCache:put(file,o)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "for _,mod in pairs(o.requires)do\n"
+  "\n"
+  "if mod:match(\"^%a%w*$\")then\n"
+  "\n"
+  "else\n"
+  "local requiredFile=findJSModule(mod,file)\n"
+  "if not requiredFile then\n"
+  "return fail(\"could not find module '%s'\\n   required from: %s\",mod,file)\n"
+  "end\n"
+  "\n"
+  "local modPre=pathToMod[requiredFile]\n"
+  "if modPre then\n"
+  "\n"
+  "\n"
+  "assert(modPre==mod,\n"
+  "\"Source file referenced via two different module names: \"\n"
+  "..modPre..\" and \"..mod)\n"
+  "else\n"
+  "pathToMod[requiredFile]=mod\n"
+  "end\n"
+  "scanFile(requiredFile)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function makeDeps()\n"
+  "return files:concat(\" \")..\"\\n\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function jsLiteral(str)\n"
+  "return\"'\"..str..\"'\"\n"
+  "end\n"
+  "\n"
+  "local bundleTemplate=[==[\n"
+  "(function (mods) {\n"
+  "   var loaded = [];\n"
+  "   function require(mod) {\n"
+  "      var m = loaded[mod];\n"
+  "      if (!m) {\n"
+  "         loaded[mod] = m = { exports:{} };\n"
+  "         mods[mod](require, m, m.exports);\n"
+  "      }\n"
+  "      return m.exports;\n"
+  "   }\n"
+  "   require({main});\n"
+  "}({\n"
+  "{mods}\n"
+  "}));\n"
+  "]==]\n"
+  "\n"
+  "\n"
+  "local function makeBundle()\n"
+  "local o=newArray()\n"
+  "for _,path in ipairs(files)do\n"
+  "local modName=pathToMod[path]or\"(main)\"\n"
+  "o:insert(jsLiteral(modName)..\": \"..\n"
+  "\"function (require, module, exports) {\\n\"..\n"
+  "readFile(path)..\n"
+  "\"\\n}\")\n"
+  "end\n"
+  "\n"
+  "local values={}\n"
+  "values.main=\"'(main)'\"\n"
+  "values.mods=o:concat(\",\\n\\n\")\n"
+  "\n"
+  "return(bundleTemplate:gsub(\"{(%a+)}\",values))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local htmlTemplate=[[\n"
+  "<!DOCTYPE html>\n"
+  "<html>\n"
+  "  <head>\n"
+  "    <meta charset=\"utf-8\">\n"
+  "    <title>{title}</title>\n"
+  "  </head>\n"
+  "  <body>\n"
+  "    <script charset=\"utf-8\">\n"
+  "{script}\n"
+  "    </script>\n"
+  "  </body>\n"
+  "</html>\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "local function makeHTML(name,properties)\n"
+  "local values={}\n"
+  "values.script=makeBundle():gsub(\"</\",\"<\\\\/\")\n"
+  "values.title=properties.title or name\n"
+  "\n"
+  "return(htmlTemplate:gsub(\"{(%a+)}\",values))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function openFile(filename)\n"
+  "local fo=io.open(filename,\"w\")\n"
+  "if not fo then\n"
+  "return fail(\"could not open output file: %s\",filename)\n"
+  "end\n"
+  "return fo\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function computeOOs(files,pattern,target)\n"
+  "local oos=newArray()\n"
+  "for ndx,file in ipairs(files)do\n"
+  "local suffix=file:match(\"%.[^%./]*$\")or\"\"\n"
+  "local basename=file:match(\"(.*)%.[^%./]*$\")or file\n"
+  "local name=pattern:gsub(\"%^F\",file)\n"
+  ":gsub(\"%^B\",basename)\n"
+  ":gsub(\"%^S\",suffix)\n"
+  "if name~=target then\n"
+  "oos:insert(name)\n"
+  "end\n"
+  "end\n"
+  "return oos\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local options=\"--path= -o= --bundle --html -MF= -MT= -MTF -Moo= --scan-cache=\"\n"
+  "local words,opts=getopts.read(arg,options)\n"
+  "\n"
+  "if opts.path then\n"
+  "jsPath=opts.path\n"
+  "end\n"
+  "\n"
+  "if opts[\"scan-cache\"]then\n"
+  "scanCache=scancache.open(opts[\"scan-cache\"],\"js\")\n"
+  "end\n"
+  "\n"
+  "if not opts.o and not opts.MF then\n"
+  "return fail(\"neither `-o FILE` nor `-MF FILE` specified.\")\n"
+  "end\n"
+  "\n"
+  "if#words~=1 then\n"
+  "return fail(\"invalid arguments\\n\\n%s\",usageStr)\n"
+  "end\n"
+  "local filename=fu.cleanpath(words[1])\n"
+  "\n"
+  "\n"
+  "\n"
+  "local properties=scanFile(filename)\n"
+  "\n"
+  "if opts.o then\n"
+  "local fo=openFile(opts.o)\n"
+  "\n"
+  "local out\n"
+  "if opts.bundle then\n"
+  "out=makeBundle()\n"
+  "elseif opts.html then\n"
+  "out=makeHTML(filename,properties)\n"
+  "else\n"
+  "out=makeDeps()\n"
+  "end\n"
+  "\n"
+  "fo:write(out)\n"
+  "fo:close()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if opts.MF then\n"
+  "local target=opts.MT or opts.o or\n"
+  "fail(\"-MF given, but no -MT or -o to provide target name\")\n"
+  "local fo=openFile(opts.MF)\n"
+  "\n"
+  "local out=\"\"\n"
+  "if opts.MTF then\n"
+  "out=opts.MF..\": \"..files:concat(\" \")..\"\\n\"\n"
+  "end\n"
+  "\n"
+  "out=out..target..\": \"..files:concat(\" \")\n"
+  "\n"
+  "local oos=newArray()\n"
+  "if opts.Moo then\n"
+  "oos=computeOOs(files,opts.Moo,target)\n"
+  "out=out..\" | \"..oos:concat(\" \")\n"
+  "end\n"
+  "out=out..\"\\n\"..files:concat(\":\\n\")..\":\\n\"\n"
+  "out=out..oos:concat(\":\\n\")..\":\\n\"\n"
+  "fo:write(out)\n"
+  "fo:close()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return 0\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local debug=require\"debug\"\n"
+  "\n"
+  "\n"
+  "local qt={}\n"
+  "\n"
+  "\n"
+  "function qt.fail(trace)\n"
+  "print(trace)\n"
+  "os.exit(1)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.error(msg,level)\n"
+  "level=tonumber(level)or 1\n"
+  "msg=msg or\"ERROR\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local qlevel=2\n"
+  "while debug.getinfo(qlevel,\"S\").short_src:match(\"qtest%.lua$\")do\n"
+  "qlevel=qlevel+1\n"
+  "end\n"
+  "\n"
+  "local i=debug.getinfo(qlevel+level-1)or{short_src=\"\?\",currentline=\"\?\"}\n"
+  "local err=\"ERROR: \"..i.short_src..\":\"..i.currentline..\": \"..msg\n"
+  "\n"
+  "if debug.printf then\n"
+  "debug.printf(err)\n"
+  "\n"
+  "end\n"
+  "return qt.fail(debug.traceback(err,qlevel))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.assert(value,msg,level)\n"
+  "if not value then\n"
+  "return qt.error(msg,level)\n"
+  "end\n"
+  "return value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mt_G={}\n"
+  "local allowWrite={\n"
+  "\n"
+  "lpeg=true,\n"
+  "re=true,\n"
+  "}\n"
+  "local allowRead={\n"
+  "loadstring=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "function mt_G:__newindex(key,value)\n"
+  "qt.assert(allowWrite[key],\"Write to undefined global: \"..tostring(key))\n"
+  "return rawset(self,key,value)\n"
+  "end\n"
+  "\n"
+  "function mt_G:__index(key)\n"
+  "qt.assert(allowRead[key],\"Read of undefined global: \"..tostring(key))\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "setmetatable(_G,mt_G)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.G()\n"
+  "setmetatable(_G,nil)\n"
+  "_G.qt=qt\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function identifier(s)\n"
+  "return type(s)==\"string\"and s:match(\"^[%a_][_%w]*$\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function describe(x,visited,indent)\n"
+  "visited=visited or{level=1}\n"
+  "local s\n"
+  "\n"
+  "if type(x)==\"number\"or\n"
+  "type(x)==\"boolean\"or\n"
+  "type(x)==\"nil\"then\n"
+  "s=tostring(x)\n"
+  "elseif type(x)==\"string\"then\n"
+  "s=string.format(\"%q\",x)\n"
+  "s=s:gsub(\"\\\\\\n\",\"\\\\n\")\n"
+  "elseif visited[x]then\n"
+  "s=\"@\"..(visited.level-visited[x]-1)\n"
+  "elseif type(x)==\"table\"then\n"
+  "visited[x]=visited.level\n"
+  "visited.level=visited.level+1\n"
+  "\n"
+  "local t,keys,names={},{},{}\n"
+  "t.insert=table.insert\n"
+  "\n"
+  "for k,v in ipairs(x)do\n"
+  "t:insert(describe(v,visited,indent))\n"
+  "names[k]=\"visited\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for k,v in pairs(x)do\n"
+  "if not names[k]then\n"
+  "table.insert(keys,k)\n"
+  "names[k]=identifier(k)or\"[\"..describe(k,visited)..\"]\"\n"
+  "end\n"
+  "end\n"
+  "table.sort(keys,function(a,b)return names[a]<names[b]end)\n"
+  "for _,k in ipairs(keys)do\n"
+  "t:insert(names[k]..\"=\"..describe(x[k],visited,indent))\n"
+  "end\n"
+  "\n"
+  "if indent and t[1]then\n"
+  "local prefix=indent:rep(visited.level-2)\n"
+  "local subprefix=prefix..indent\n"
+  "s=\"{\\n\"..subprefix..table.concat(t,\",\\n\"..subprefix)..\"\\n\"..prefix..\"}\"\n"
+  "else\n"
+  "s=\"{\"..table.concat(t,\",\")..\"}\"\n"
+  "end\n"
+  "\n"
+  "visited.level=visited.level-1\n"
+  "visited[x]=false\n"
+  "else\n"
+  "s=\"<\"..tostring(x)..\">\"\n"
+  "end\n"
+  "\n"
+  "return s\n"
+  "end\n"
+  "\n"
+  "\n"
+  "qt.describe=describe\n"
+  "\n"
+  "\n"
+  "function qt.dump(name,value)\n"
+  "print(name..\" = \"..describe(value,nil,\"\"))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.format(fmt,...)\n"
+  "local t={...}\n"
+  "local ndx=0\n"
+  "\n"
+  "local function repl(s)\n"
+  "if s~=\"%%\"then\n"
+  "ndx=ndx+1\n"
+  "if s==\"%Q\"then\n"
+  "t[ndx]=describe(t[ndx])\n"
+  "return\"%s\"\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "fmt=fmt:gsub(\"%%.\",repl)\n"
+  "\n"
+  "return string.format(fmt,table.unpack(t))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.printf(...)\n"
+  "io.write(qt.format(...))\n"
+  "end\n"
+  "\n"
+  "function qt.fprintf(f,...)\n"
+  "f:write(qt.format(...))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function showAB(a,b,msg)\n"
+  "if debug.log then\n"
+  "debug.printf(\"%s\",msg)\n"
+  "debug.log(a)\n"
+  "debug.log(b)\n"
+  "end\n"
+  "return string.format(\"%s\\n   A: %s \\n   B: %s\",\n"
+  "msg,\n"
+  "describe(a),\n"
+  "describe(b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function checkArgs(name,cnt,...)\n"
+  "local n=select('#',...)\n"
+  "if cnt~=n then\n"
+  "return qt.error(name..\" saw \"..n..\" arguments; expected \"..cnt)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function qt._eq(a,b,level)\n"
+  "if not rawequal(a,b)and describe(a)~=describe(b)then\n"
+  "return qt.error(showAB(a,b,\"Values not equivalent:\"),level)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.eq(...)\n"
+  "checkArgs('qtest.eq',2,...)\n"
+  "return qt._eq(...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.same(...)\n"
+  "checkArgs('qtest.same',2,...)\n"
+  "local a,b=...\n"
+  "if not rawequal(a,b)then\n"
+  "return qt.error(showAB(a,b,\"Values not identical:\"))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.match(str,pattern,level)\n"
+  "qt.assert(type(str)==\"string\",\"Arg 1 must be string\")\n"
+  "qt.assert(type(pattern)==\"string\",\"Arg 2 must be string\")\n"
+  "qt.assert(level==nil or type(level)==\"number\",\"Arg 3 must be nil or a number\")\n"
+  "\n"
+  "local results=table.pack(str:match(pattern))\n"
+  "if not results[1]then\n"
+  "return qt.error(qt.format(\"\\nExpected: %Q\\n      in: %Q\\n\",pattern,str),level)\n"
+  "end\n"
+  "return table.unpack(results,1,results.n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local tlvl=0\n"
+  "function qt.trace(funcname,func)\n"
+  "local name,argspec,rvspec=funcname:match(\"(.-)%((.-)%) *%-*>\? *(.*)$\")\n"
+  "name=name or funcname\n"
+  "local fn=(type(func)==\"table\"and func[name])or func\n"
+  "\n"
+  "local function describeArgs(spec,...)\n"
+  "spec=spec or\"\"\n"
+  "local str,fmt=\"\"\n"
+  "for ndx=1,select('#',...)do\n"
+  "local value=select(ndx,...)\n"
+  "fmt,spec=spec:match(\"([^,]*)%,\?(.*)\")\n"
+  "if fmt:sub(1,1)==\".\"then\n"
+  "value=type(value)~=\"table\"and\"-undef-\"or value[fmt:sub(2)]\n"
+  "str=str..\",{\"..fmt..\"=\"..qt.describe(value)..\"}\"\n"
+  "else\n"
+  "str=str..\",\"..qt.format((fmt==\"\"and\"%Q\"or fmt),value)\n"
+  "end\n"
+  "end\n"
+  "return str:sub(2),{...}\n"
+  "end\n"
+  "\n"
+  "local function tfn(...)\n"
+  "local i=string.rep(\"   \",tlvl)\n"
+  "\n"
+  "qt.printf(\"%s%s(%s)\\n\",i,name,describeArgs(argspec,...))\n"
+  "tlvl=tlvl+1\n"
+  "local desc,res=describeArgs(rvspec,fn(...))\n"
+  "qt.printf(\"%s--> %s\\n\",i,desc)\n"
+  "tlvl=tlvl-1\n"
+  "return table.unpack(res)\n"
+  "end\n"
+  "\n"
+  "if type(func)==\"table\"then\n"
+  "func[name]=tfn\n"
+  "end\n"
+  "return tfn\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.load(file,locals)\n"
+  "locals=locals or{}\n"
+  "local f=io.open(file,\"r\")\n"
+  "local txt\n"
+  "if f then\n"
+  "local txt=f:read(\"*a\")\n"
+  "\n"
+  "\n"
+  "local posRet\n"
+  "for pos in txt:gmatch(\"[^%w]()return[^%w]\")do\n"
+  "posRet=pos\n"
+  "end\n"
+  "\n"
+  "if posRet then\n"
+  "\n"
+  "local func,err=load(txt:sub(posRet))\n"
+  "if not func then\n"
+  "posRet=nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if posRet then\n"
+  "local t={}\n"
+  "for _,var in ipairs(locals)do\n"
+  "table.insert(t,var..\"=\"..var)\n"
+  "end\n"
+  "local ret=\"return {\"..table.concat(t,\",\")..\"},\"\n"
+  "local a=txt:sub(1,posRet-1)..ret..txt:sub(posRet+7)\n"
+  "local func,err=load(a,\"@\"..file)\n"
+  "if func then\n"
+  "local values,mod=func()\n"
+  "return mod,values\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local succ,err0=load(txt,\"@\"..file)\n"
+  "if not succ then\n"
+  "error(\"\\n\\t\"..err0,0)\n"
+  "end\n"
+  "error(\"qt.load: file does not return a value: \"..file)\n"
+  "end\n"
+  "error(\"qt.load: could not find file \"..tostring(file))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function getlocal(lvl,name)\n"
+  "for n=1,999 do\n"
+  "local varname,value=debug.getlocal(lvl+1,n)\n"
+  "if name==varname then\n"
+  "return n,value\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.logvar(name)\n"
+  "local ndx,value=getlocal(2,name)\n"
+  "if ndx then\n"
+  "return qt.printf(\"%s = %Q\\n\",name,value)\n"
+  "end\n"
+  "qt.printf(\"%s = -undefined-\\n\",name)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.tracevar(name)\n"
+  "local ndx,value=getlocal(2,name:match(\"[^%(]*\"))\n"
+  "if ndx then\n"
+  "return debug.setlocal(2,ndx,qt.trace(name,value))\n"
+  "end\n"
+  "qt.printf(\"%s = -undefined-\\n\",name)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function qt.runTests(name)\n"
+  "local function ifVar(name)\n"
+  "return(os.getenv(name)or\"\"):match(\"[^%s].*\")\n"
+  "end\n"
+  "\n"
+  "name=name or arg[0]:match(\"([^/]*)%.lua$\")\n"
+  "local spec=name and ifVar(name)or ifVar(\"qtest\")or\"\"\n"
+  "\n"
+  "local namedTests,anyNamed,verbose={},false,false\n"
+  "\n"
+  "for w in spec:gmatch(\"[^%s]+\")do\n"
+  "if w==\"-v\"then\n"
+  "verbose=true\n"
+  "elseif w==\"-pass\"then\n"
+  "return 0\n"
+  "else\n"
+  "assert(not w:match(\"^%-\"),\"Bad runTest spec\")\n"
+  "anyNamed=true\n"
+  "namedTests[w]=true\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local incomplete=false\n"
+  "for ndx,name in ipairs(qt.tests)do\n"
+  "if not anyNamed or namedTests[name]then\n"
+  "local fn=qt.tests[-ndx]\n"
+  "if verbose then print(name)end\n"
+  "fn()\n"
+  "else\n"
+  "incomplete=true\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if incomplete then\n"
+  "\n"
+  "print(\"!!! ran only selected tests: \"..spec)\n"
+  "return 99\n"
+  "end\n"
+  "\n"
+  "if name and verbose then\n"
+  "print(name..\" OK\")\n"
+  "end\n"
+  "return 0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "qt.tests={}\n"
+  "\n"
+  "local mt_tests={}\n"
+  "function mt_tests:__newindex(k,v)\n"
+  "local n=#self+1\n"
+  "rawset(self,n,k)\n"
+  "rawset(self,-n,v)\n"
+  "end\n"
+  "setmetatable(qt.tests,mt_tests)\n"
+  "\n"
+  "\n"
+  "return qt\n"
+  "";
+
+static const unsigned char data3[] = 
+  "\n"
+  "\n"
+  "\n"
+  "local lpeg=require\"lpeg\"\n"
+  "local P,R,S=lpeg.P,lpeg.R,lpeg.S\n"
+  "local C,Cs=lpeg.C,lpeg.Cs\n"
+  "\n"
+  "local commentHandler\n"
+  "\n"
+  "local function processComment(text)\n"
+  "if commentHandler then\n"
+  "commentHandler(text)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local any=P(1)\n"
+  "\n"
+  "local nl=P(\"\\r\\n\")+P(\"\\n\")\n"
+  "\n"
+  "local comment=\"/*\"*(any-\"*/\")^0*\"*/\"\n"
+  "+\"//\"*((any-nl)^0/processComment)\n"
+  "\n"
+  "local space=\" \"+nl+comment\n"
+  "\n"
+  "local ws=space^0\n"
+  "\n"
+  "local function T(pat)\n"
+  "return pat*ws\n"
+  "end\n"
+  "\n"
+  "local ident=T(C(R(\"az\",\"AZ\",\"__\",\"$$\")*\n"
+  "R(\"az\",\"AZ\",\"__\",\"$$\",\"09\")^0))\n"
+  "\n"
+  "local literalString=\n"
+  "T(\"'\"*Cs(((any-\"'\")+(P\"\\\\\"/\"\")*any)^0)*\"'\"+\n"
+  "'\"'*Cs(((any-'\"')+(P\"\\\\\"/\"\")*any)^0)*'\"')\n"
+  "\n"
+  "local funCall=ident*T\"(\"*literalString*T\")\"\n"
+  "\n"
+  "local member='.'*ws*ident\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function scan(source)\n"
+  "local o={}\n"
+  "\n"
+  "local requires={}\n"
+  "local function doFunCall(name,stringArg)\n"
+  "if name==\"require\"then\n"
+  "table.insert(requires,stringArg)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "commentHandler=function(text)\n"
+  "local title=text:match(\" *title: +(.*)\")\n"
+  "if title then\n"
+  "o.title=title\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local JS=(funCall/doFunCall+member+ident+space^1+any)^0\n"
+  "JS:match(source)\n"
+  "\n"
+  "commentHandler=nil\n"
+  "\n"
+  "o.requires=requires\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "scan=scan,\n"
+  "\n"
+  "\n"
+  "space=space,\n"
+  "ws=ws,\n"
+  "funCall=funCall\n"
+  "}\n"
+  "";
+
+extern int luaopen_lpeg(lua_State *);
+
+static const unsigned char data4[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseOpts(o)\n"
+  "local opts={}\n"
+  "local f\n"
+  "if type(o)==\"string\"then\n"
+  "f=o:gmatch(\"([^%s]+)%s*\")\n"
+  "else\n"
+  "local n=0\n"
+  "function f()n=n+1;return o[n]end\n"
+  "end\n"
+  "for desc in f do\n"
+  "local names,type=desc:match(\"([^:=]*)(:\?=\?%*\?)\")\n"
+  "assert(names)\n"
+  "local name=names:match(\"-*([^/]*)\")\n"
+  "for opt in names:gmatch(\"([^/]+)/\?\")do\n"
+  "opts[opt]={name=name,type=type}\n"
+  "end\n"
+  "end\n"
+  "return opts\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function read(args,o,errhandler)\n"
+  "local opts=parseOpts(o)\n"
+  "local words,values={},{}\n"
+  "local errfn=(type(errhandler)==\"function\"and errhandler or\n"
+  "function(msg)error((errhandler or\"getopts\")..\": \"..msg)end)\n"
+  "\n"
+  "local argndx=0\n"
+  "local function nextArg()\n"
+  "argndx=argndx+1\n"
+  "return args[argndx]\n"
+  "end\n"
+  "\n"
+  "for a in nextArg do\n"
+  "local opt,optarg=a:match(\"^(%-%-[^=]*)=(.*)\")\n"
+  "if not opt then\n"
+  "opt,optarg=a:match(\"^(%-.*)\"),false\n"
+  "end\n"
+  "if not opt then\n"
+  "table.insert(words,a)\n"
+  "else\n"
+  "local o=opts[opt]\n"
+  "if o then\n"
+  "local v=values[o.name]\n"
+  "if o.type~=\"\"then\n"
+  "\n"
+  "optarg=optarg or nextArg()\n"
+  "if not optarg then\n"
+  "local e={errfn(\"Missing argument to \"..opt,opt)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "if o.type:match(\"%*\")then\n"
+  "v=v or{}\n"
+  "values[o.name]=v\n"
+  "table.insert(v,optarg)\n"
+  "elseif not v then\n"
+  "values[o.name]=optarg\n"
+  "else\n"
+  "local e={errfn(\"Argument repeated: \"..opt,opt)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "else\n"
+  "\n"
+  "values[o.name]=(v or 0)+1\n"
+  "end\n"
+  "elseif opt==\"--\"then\n"
+  "\n"
+  "for a in nextArg do\n"
+  "table.insert(words,a)\n"
+  "end\n"
+  "break\n"
+  "else\n"
+  "local e={errfn(\"Unrecognized option: \"..a,a)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return words,values\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local G={}\n"
+  "G.parseOpts=parseOpts\n"
+  "G.read=read\n"
+  "return G\n"
+  "";
+
+static const unsigned char data5[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function addslash(p)\n"
+  "if p:sub(-1)==\"/\"then\n"
+  "return p\n"
+  "end\n"
+  "return p..\"/\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function splitpath(path)\n"
+  "if path:sub(-1)==\"/\"then\n"
+  "path=path:sub(1,-2)\n"
+  "end\n"
+  "local dir,name=path:match(\"(.*)/(.*)\")\n"
+  "if dir then\n"
+  "return(dir==\"\"and\"/\"or dir),name\n"
+  "elseif path==\"\"then\n"
+  "return\"/\",\".\"\n"
+  "end\n"
+  "return\".\",path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function cleanpath(path)\n"
+  "local init,path=path:match(\"^(/*)(.*)\")\n"
+  "\n"
+  "while path:sub(1,2)==\"./\"do\n"
+  "path=path:sub(3)\n"
+  "end\n"
+  "\n"
+  "local e,post\n"
+  "local n=1\n"
+  "repeat\n"
+  "n,e,post=path:match(\"/()(%.%.\?)(.\?)\",n)\n"
+  "if post~=\"\"and post~=\"/\"then\n"
+  "\n"
+  "elseif e==\".\"then\n"
+  "\n"
+  "path=path:sub(1,n-2)..path:sub(n+1)\n"
+  "n=n-1\n"
+  "else\n"
+  "\n"
+  "local a=n-2\n"
+  "while a>0 and path:sub(a,a)~=\"/\"do\n"
+  "a=a-1\n"
+  "end\n"
+  "local parent=path:sub(a+1,n-2)\n"
+  "if parent~=\"\"and parent~=\"..\"then\n"
+  "path=path:sub(1,a)..path:sub(n+3)\n"
+  "n=a\n"
+  "end\n"
+  "end\n"
+  "until n==nil\n"
+  "\n"
+  "\n"
+  "if path:sub(-1,-1)then\n"
+  "path=path:match(\"(.-)/*$\")\n"
+  "end\n"
+  "\n"
+  "path=init..path\n"
+  "return path~=\"\"and path or\".\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function xrelpathto(src,dst,streq)\n"
+  "local s=addslash(src)\n"
+  "local d=addslash(dst)\n"
+  "\n"
+  "while true do\n"
+  "local a,b=s:match(\"[^/]*/\"),d:match(\"[^/]*/\")\n"
+  "if not a then\n"
+  "break\n"
+  "elseif streq(a,b)then\n"
+  "s=s:sub(#a+1)\n"
+  "d=d:sub(#a+1)\n"
+  "elseif a==\"../\"then\n"
+  "return nil,\"relpathto: destination is above root directory\"\n"
+  "elseif a==\"/\"then\n"
+  "return nil,\"relpathto: no base for destination directory\"\n"
+  "elseif b==\"/\"then\n"
+  "break\n"
+  "else\n"
+  "s=s:sub(#a+1)\n"
+  "d=\"../\"..d\n"
+  "end\n"
+  "end\n"
+  "d=d:sub(1,-2)\n"
+  "return d==\"\"and\".\"or d\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function read(name)\n"
+  "local f,err=io.open(name,\"r\")\n"
+  "if not f then\n"
+  "return f,err\n"
+  "end\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function write(name,data)\n"
+  "local f,err=io.open(name,\"wb\")\n"
+  "if not f then\n"
+  "return f,err\n"
+  "end\n"
+  "f:write(data)\n"
+  "f:close()\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local nix={\n"
+  "read=read,\n"
+  "write=write,\n"
+  "cleanpath=cleanpath,\n"
+  "splitpath=splitpath,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function streq(a,b)\n"
+  "return a==b\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function nix.resolve(dir,path)\n"
+  "if path:sub(1,1)==\"/\"then\n"
+  "\n"
+  "else\n"
+  "path=addslash(dir)..path\n"
+  "end\n"
+  "return cleanpath(path)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function nix.relpathto(src,dst,cwd)\n"
+  "if cwd then\n"
+  "src=nix.resolve(cwd,src)\n"
+  "dst=nix.resolve(cwd,dst)\n"
+  "end\n"
+  "return xrelpathto(src,dst,streq)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function splitdev(path)\n"
+  "local drv,rest=path:match(\"^([a-zA-Z]%:)(.*)\")\n"
+  "return drv,rest or path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joindev(drive,path)\n"
+  "return drive and drive..path or path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function streqi(a,b)\n"
+  "return a==b or a and b and a:upper()==b:upper()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function fixslashes(path)\n"
+  "return path:gsub(\"\\\\\",\"/\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local win={\n"
+  "read=read,\n"
+  "write=write,\n"
+  "}\n"
+  "\n"
+  "function win.cleanpath(path)\n"
+  "local drv,p=splitdev(fixslashes(path))\n"
+  "return joindev(drv,cleanpath(p))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function win.splitpath(path)\n"
+  "local drv,x=splitdev(fixslashes(path))\n"
+  "local xdir,xpath=splitpath(x)\n"
+  "return joindev(drv,xdir),xpath\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function win.resolve(dir,path)\n"
+  "if path:match(\"^[a-zA-Z]:[/\\\\]\")then\n"
+  "\n"
+  "elseif path:match(\"^[/\\\\]\")then\n"
+  "path=joindev(dir:match(\"^([a-zA-Z]:)\"),path)\n"
+  "else\n"
+  "path=addslash(dir)..path\n"
+  "end\n"
+  "return win.cleanpath(path)\n"
+  "end\n"
+  "\n"
+  "function win.relpathto(src,dst,cwd)\n"
+  "if cwd then\n"
+  "src=win.resolve(cwd,src)\n"
+  "dst=win.resolve(cwd,dst)\n"
+  "end\n"
+  "\n"
+  "local sd,sp=splitdev(src)\n"
+  "local dd,dp=splitdev(dst)\n"
+  "if streqi(sd,dd)then\n"
+  "return xrelpathto(sp,dp,streqi)\n"
+  "end\n"
+  "return dst\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "nix=nix,\n"
+  "win=win,\n"
+  "}\n"
+  "";
+
+static const unsigned char data6[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpfs=require\"xpfs\"\n"
+  "local serialize=require\"serialize\"\n"
+  "local lfsu=require\"lfsu\"\n"
+  "\n"
+  "\n"
+  "local RACY_TIME=2\n"
+  "\n"
+  "\n"
+  "local function stamp(path)\n"
+  "local st=xpfs.stat(path,\"sitd\")\n"
+  "if st then\n"
+  "return(\"%d:%d:%d:%.0f\"):format(st.size,st.inode,st.dev,st.time),st.time\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local Cache={}\n"
+  "Cache.__index=Cache\n"
+  "\n"
+  "\n"
+  "local function open(dir,tool)\n"
+  "local me=setmetatable({},Cache)\n"
+  "me.dir=dir..\"/\"..tool\n"
+  "me.stamps={}\n"
+  "me.times={}\n"
+  "me.racyTime=RACY_TIME\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Cache:entryName(path)\n"
+  "local enc=path:gsub(\"[^%w%-%.]\",function(c)\n"
+  "return(\"_%02x\"):format(c:byte())\n"
+  "end)\n"
+  "return self.dir..\"/\"..enc..\".lua\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Cache:get(path)\n"
+  "local st,time=stamp(path)\n"
+  "self.stamps[path],self.times[path]=st,time\n"
+  "if not st then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "local f=loadfile(self:entryName(path),\"t\",{})\n"
+  "local succ,entry=pcall(f or error)\n"
+  "if succ and type(entry)==\"table\"\n"
+  "and entry.path==path\n"
+  "and entry.stamp==st then\n"
+  "return entry.value\n"
+  "end\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Cache:put(path,value)\n"
+  "local st,time=self.stamps[path],self.times[path]\n"
+  "if not st then\n"
+  "st,time=stamp(path)\n"
+  "end\n"
+  "if not st or time>os.time()-self.racyTime then\n"
+  "return nil,\"file not cacheable\"\n"
+  "end\n"
+  "\n"
+  "local succ,err=lfsu.mkdir_p(self.dir)\n"
+  "if not succ then\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local name=self:entryName(path)\n"
+  "local tmpName=(\"%s.%d.tmp\"):format(name,xpfs.getpid())\n"
+  "local entry={path=path,stamp=st,value=value}\n"
+  "succ,err=lfsu.write(tmpName,\"return \"..serialize.serialize(entry)..\"\\n\")\n"
+  "if succ then\n"
+  "succ,err=os.rename(tmpName,name)\n"
+  "end\n"
+  "if not succ then\n"
+  "return nil,err\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "open=open,\n"
+  "}\n"
+  "";
+
+extern int luaopen_xpfs(lua_State *);
+
+static const unsigned char data7[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function ltAny(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local inext=ipairs{}\n"
+  "\n"
+  "local function orderedPairs(t)\n"
+  "local keys={}\n"
+  "local keyIndex=1\n"
+  "local counting=true\n"
+  "\n"
+  "local function _next(seen,s)\n"
+  "local v\n"
+  "\n"
+  "if counting then\n"
+  "\n"
+  "s,v=inext(t,s)\n"
+  "if s~=nil then\n"
+  "seen[s]=true\n"
+  "return s,v\n"
+  "end\n"
+  "counting=false\n"
+  "\n"
+  "\n"
+  "for k,v in pairs(t)do\n"
+  "if not seen[k]then\n"
+  "table.insert(keys,k)\n"
+  "end\n"
+  "end\n"
+  "table.sort(keys,ltAny)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "s=keys[keyIndex]\n"
+  "if s~=nil then\n"
+  "keyIndex=keyIndex+1\n"
+  "v=t[s]\n"
+  "end\n"
+  "return s,v\n"
+  "end\n"
+  "\n"
+  "return _next,{},0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local numtostring={\n"
+  "[tostring(-1/0)]=\"-1/0\",\n"
+  "[tostring(1/0)]=\"1/0\",\n"
+  "[tostring(0/0)]=\"0/0\"\n"
+  "}\n"
+  "\n"
+  "setmetatable(numtostring,{__index=function(t,k)return k end})\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function serialize(x,out,iter)\n"
+  "local visited={}\n"
+  "local iter=iter==\"s\"and orderedPairs or iter or pairs\n"
+  "assert(type(iter)==\"function\")\n"
+  "\n"
+  "local function _serialize(x)\n"
+  "if type(x)==\"string\"then\n"
+  "\n"
+  "out(string.format(\"%q\",x))\n"
+  "\n"
+  "elseif type(x)==\"number\"then\n"
+  "\n"
+  "out(numtostring[tostring(x)])\n"
+  "\n"
+  "elseif type(x)==\"boolean\"or\n"
+  "type(x)==\"nil\"then\n"
+  "\n"
+  "out(tostring(x))\n"
+  "\n"
+  "elseif type(x)==\"table\"then\n"
+  "\n"
+  "if visited[x]then\n"
+  "error(\"serialize: recursive structure\")\n"
+  "end\n"
+  "visited[x]=true\n"
+  "local first,nextIndex=true,1\n"
+  "\n"
+  "out\"{\"\n"
+  "\n"
+  "for k,v in iter(x)do\n"
+  "if first then\n"
+  "first=false\n"
+  "else\n"
+  "out\",\"\n"
+  "end\n"
+  "if k==nextIndex then\n"
+  "nextIndex=nextIndex+1\n"
+  "else\n"
+  "if type(k)==\"string\"and k:match(\"^[%a_][%w_]*$\")then\n"
+  "out(k..\"=\")\n"
+  "else\n"
+  "out\"[\"\n"
+  "_serialize(k)\n"
+  "out\"]=\"\n"
+  "end\n"
+  "end\n"
+  "_serialize(v)\n"
+  "end\n"
+  "\n"
+  "out\"}\"\n"
+  "visited[x]=false\n"
+  "else\n"
+  "error(\"serialize: unsupported type\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local result\n"
+  "if not out then\n"
+  "result={}\n"
+  "out=result\n"
+  "end\n"
+  "\n"
+  "if type(out)==\"table\"then\n"
+  "local t=out\n"
+  "function out(s)\n"
+  "table.insert(t,s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "_serialize(x)\n"
+  "\n"
+  "if result then\n"
+  "return table.concat(result)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return{\n"
+  "orderedPairs=orderedPairs,\n"
+  "serialize=serialize\n"
+  "}\n"
+  "";
+
+static const unsigned char data8[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpfs=require\"xpfs\"\n"
+  "local fsu=require\"fsu\"\n"
+  "\n"
+  "local iswin=xpfs.getcwd():match(\"^[a-zA-Z]%:\\\\\")\n"
+  "local base=iswin and fsu.win or fsu.nix\n"
+  "\n"
+  "local U=setmetatable({},{__index=base})\n"
+  "\n"
+  "U.iswindows=iswin\n"
+  "\n"
+  "\n"
+  "function U.relpathto(src,dst,cwd)\n"
+  "return base.relpathto(src,dst,cwd or xpfs.getcwd())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function U.abspath(path)\n"
+  "return base.resolve(xpfs.getcwd(),path)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function _mkdir_p(dir,split)\n"
+  "local e,m=true\n"
+  "\n"
+  "local st=xpfs.stat(dir,\"k\")\n"
+  "if not st then\n"
+  "local p=split(dir)\n"
+  "if p==dir then\n"
+  "return nil,\"unexpected error: \"..dir..\" does not exist\"\n"
+  "end\n"
+  "e,m=_mkdir_p(p,split)\n"
+  "if e then\n"
+  "e,m=xpfs.mkdir(dir)\n"
+  "end\n"
+  "elseif st.kind~=\"d\"then\n"
+  "e,m=nil,\"could not create directory \"..dir\n"
+  "end\n"
+  "return e,m\n"
+  "end\n"
+  "\n"
+  "function U.mkdir_p(path)\n"
+  "return _mkdir_p(path,base.splitpath)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function removeTree(dir)\n"
+  "local dirs={dir}\n"
+  "local iter,err=xpfs.walk(dir)\n"
+  "if not iter then\n"
+  "return nil,err\n"
+  "end\n"
+  "for path,kind,err in iter do\n"
+  "if kind==\"d\"then\n"
+  "table.insert(dirs,path)\n"
+  "elseif kind then\n"
+  "local s,e=xpfs.remove(path)\n"
+  "if not s then return s,e end\n"
+  "else\n"
+  "return nil,err\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "for ndx=#dirs,1,-1 do\n"
+  "local s,e=xpfs.rmdir(dirs[ndx])\n"
+  "if not s then return s,e end\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function U.rm_rf(name)\n"
+  "local s,e=true\n"
+  "\n"
+  "if xpfs.walk then\n"
+  "local st=xpfs.stat(name,\"k\")\n"
+  "if st and st.kind==\"d\"then\n"
+  "return removeTree(name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local todo={name}\n"
+  "while#todo>0 do\n"
+  "local f=table.remove(todo)\n"
+  "if type(f)==\"table\"then\n"
+  "s,e=xpfs.rmdir(f[1])\n"
+  "if not s then break end\n"
+  "else\n"
+  "local st=xpfs.stat(f,\"k\")\n"
+  "if st and st.kind==\"d\"then\n"
+  "table.insert(todo,{f})\n"
+  "local de=xpfs.dir(f)\n"
+  "for _,g in ipairs(de)do\n"
+  "if g~=\".\"and g~=\"..\"then\n"
+  "table.insert(todo,f..\"/\"..g)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "else\n"
+  "s,e=xpfs.remove(f)\n"
+  "if not s then break end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return s,e\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return U\n"
+  "";
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@jsdep.lua", (const char *) data1, 6165, 0 },
+   { "qtest", "@../luau/.out/exports/qtest.lua", (const char *) data2, 7007, 0 },
+   { "scanjs", "@scanjs.lua", (const char *) data3, 1121, 0 },
+   { "lpeg", 0, (const char *) 0, 0, luaopen_lpeg },
+   { "getopts", "@../luau/.out/exports/getopts.lua", (const char *) data4, 1615, 0 },
+   { "fsu", "@../luau/.out/exports/fsu.lua", (const char *) data5, 3208, 0 },
+   { "scancache", "@../luau/.out/exports/scancache.lua", (const char *) data6, 1567, 0 },
+   { "xpfs", 0, (const char *) 0, 0, luaopen_xpfs },
+   { "serialize", "@../luau/.out/exports/serialize.lua", (const char *) data7, 1867, 0 },
+   { "lfsu", "@../luau/.out/exports/lfsu.lua", (const char *) data8, 1741, 0 }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
@@ -0,0 +1 @@
+return {path="../luau/.out/exports/qtest.lua",stamp="13597:1173432:65024:1792372283",value={"require","debug"}}
@@ -0,0 +1 @@
+return {stamp="6755:1173434:65024:1792372283",path="../luau/.out/exports/redir.lua",value={"require","debug"}}
@@ -0,0 +1 @@
+return {path="jsdep_q.lua",value={"require","qtest","require","testexe","require","c.js"},stamp="2495:1171496:65024:1792363857"}
@@ -0,0 +1 @@
+return {stamp="1645:1171497:65024:1792361468",path="scanjs.lua",value={"require","lpeg"}}
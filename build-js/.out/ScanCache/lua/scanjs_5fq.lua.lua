@@ -0,0 +1 @@
+return {stamp="767:1171498:65024:1792361468",path="scanjs_q.lua",value={"require","scanjs","require","lpeg","require","qtest","require","def","require","ghi"}}
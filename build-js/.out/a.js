@@ -0,0 +1,3 @@
+// title: A
+require("b.js");
+require("c.js");
\ No newline at end of file
@@ -0,0 +1 @@
+require("c.js");
\ No newline at end of file
@@ -26,10 +26,13 @@ _JSEnv.nodePathDirs = .
 JSBundle.inherit = _JSBundle
 _JSBundle.inherit = JSEnv Builder
 _JSBundle.outExt = .js
-_JSBundle.command = {exportPrefix} {jsdepExe} {flags} -o {@} -MF {depsMF} {<}
+_JSBundle.command = {exportPrefix} {jsdepExe} {flags} -o {@} -MF {depsMF} $(addprefix --scan-cache=,{scanCache}) {<}
 _JSBundle.up = {jsdepExe}
 _JSBundle.flags = --bundle
 _JSBundle.depsMF = {outBasis}.d
+# Directory in which to cache scan results (see jsdep --scan-cache), or
+# empty to disable caching.
+_JSBundle.scanCache = $(VOUTDIR)ScanCache
 
 
 # JSToHTML(JSSOURCE): bundle source & its dependencies into an HTML file
@@ -75,8 +78,9 @@ _JSScan.outExt = .d
 # -MTF will emit it as a dependency along with others
 _JSScan.in =
 _JSScan.hidden< = $(call get,out,$(_arg1))
-_JSScan.command = {exportPrefix} {jsdepExe} {hidden<} -MF {@} -Moo {Moo} -MT {MT} -MTF
+_JSScan.command = {exportPrefix} {jsdepExe} {hidden<} -MF {@} -Moo {Moo} -MT {MT} -MTF $(addprefix --scan-cache=,{scanCache})
 _JSBundle.up = {jsdepExe}
 _JSScan.MT = $(call get,out,JSTest($(_argText)))
 _JSScan.Moo = $(call get,out,JSTest(^B_q.js))
+_JSScan.scanCache = $(VOUTDIR)ScanCache
 _JSScan.rule = {inherit}-include {@}$(\n)
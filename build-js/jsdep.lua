@@ -2,6 +2,7 @@ local qtest = require "qtest"
 local scanjs = require "scanjs"
 local getopts = require "getopts"
 local fsu = require "fsu"
+local scancache = require "scancache"
 
 local isWin = false -- todo: require "iswin"
 local fu = isWin and fsu.win or fsu.nix
@@ -29,6 +30,7 @@ Options:
                   computed by expanding PATTERN for each dependency.
    --path=PATH  : provide search path for JavaScript files; overrides
                   the NODE_PATH environment variable.
+   --scan-cache=DIR : cache the results of scanning sources in DIR.
 
 Environment variables:
    NODE_PATH: a colon-delimited list of directories to be searched.
@@ -96,6 +98,7 @@ end
 local files = newArray()
 local filesIndex = {}   --  filepath --> true/nil
 local pathToMod = {}
+local scanCache    -- see --scan-cache
 
 
 local function scanFile(file)
@@ -106,13 +109,20 @@ local function scanFile(file)
    files:insert(file)
    filesIndex[file] = #files
 
-   local src = fsu.nix.read(file)
-   if not src then
-      return fail("could not read file: %s", file)
+   -- Module names are cached, but not the files they resolve to, which
+   -- depend on the search path.
+   local o = scanCache and scanCache:get(file)
+   if not o then
+      local src = fsu.nix.read(file)
+      if not src then
+         return fail("could not read file: %s", file)
+      end
+      o = scanjs.scan(src)
+      if scanCache then
+         scanCache:put(file, o)
+      end
    end
 
-   local o = scanjs.scan(src)
-
    for _, mod in pairs(o.requires) do
 
       if mod:match("^%a%w*$") then
@@ -240,13 +250,17 @@ end
 ----------------------------------------------------------------
 
 
-local options = "--path= -o= --bundle --html -MF= -MT= -MTF -Moo="
+local options = "--path= -o= --bundle --html -MF= -MT= -MTF -Moo= --scan-cache="
 local words, opts = getopts.read(arg, options)
 
 if opts.path then
    jsPath = opts.path
 end
 
+if opts["scan-cache"] then
+   scanCache = scancache.open(opts["scan-cache"], "js")
+end
+
 if not opts.o and not opts.MF then
    return fail("neither `-o FILE` nor `-MF FILE` specified.")
 end
@@ -83,3 +83,16 @@ e:exec("--html"
 out = e.readFile(outfile)
 qt.match(out, "<title>A</title>")
 qt.match(out, "<html>.-<script.->.-b%.js.-</script>")
+
+
+-- "--scan-cache"
+
+local cachedir = outdir .. "jsdep_q.cache"
+for _ = 1, 2 do
+   e:exec("--path=" .. outdir
+             .. " --scan-cache=" .. cachedir
+             .. " -o " .. outfile
+             .. " " .. srcfile)
+   out = e.readFile(outfile)
+   qt.match(out, ".*/a.js .*/b.js .*/c.js")
+end
@@ -0,0 +1,54 @@
+for k, v in pairs{
+requirefile=function()
+local t = {
+["dep/dep.lua"] = [[-- dep.lua
+a = (a or 0) + 1
+return a
+]],
+["dep/data.txt"] = [[This is data.txt
+]]}
+return function (name) return t[name] end
+end,
+dep=function()
+
+a=(a or 0)+1
+return a
+
+end,
+pre=function()
+
+kilroyWasHere="K"
+ 
+end} do package.preload[k] = v end
+
+require "pre"
+----
+
+
+local requirefile=require"requirefile"
+
+local hasPreload=(kilroyWasHere and"P1"or"P0")
+local hasDebug=((require"debug")and"D1"or"D0")
+
+
+local d0=require"dep"
+local d1=require"dep"
+
+
+local m1=requirefile("dep/dep.lua")
+local m2=requirefile("dep/data.txt")
+
+requirefile("dep/data.txt")
+
+if arg=="Test"then
+return
+end
+
+print("<"..(os.getenv("LUA_PATH")or"")..">")
+
+print(hasPreload..","..
+hasDebug..","..
+(arg[1]or"")..","..
+d1..","..
+m1:sub(1,10)..","..
+m2:sub(1,12))
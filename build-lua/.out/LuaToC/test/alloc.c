@@ -0,0 +1,238 @@
+// Generated by cfromlua
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+#include "lalloc.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "local rtrequire=require\n"
+  "local lalloc=rtrequire\"lalloc\"\n"
+  "\n"
+  "local s0=lalloc.stats()\n"
+  "assert(#s0.classes==16)\n"
+  "assert(s0.classes[1].size==16 and s0.classes[16].size==256)\n"
+  "assert(s0.bytes>0 and s0.peak>=s0.bytes and s0.count>0)\n"
+  "\n"
+  "\n"
+  "local t={}\n"
+  "for ii=1,20000 do\n"
+  "t[ii]={ii,tostring(ii)}\n"
+  "end\n"
+  "local big=(\"x\"):rep(100000)\n"
+  "t=nil\n"
+  "collectgarbage()\n"
+  "\n"
+  "local s1=lalloc.stats()\n"
+  "assert(s1.allocs>s0.allocs+40000)\n"
+  "assert(s1.large.allocs>s0.large.allocs)\n"
+  "assert(s1.peak>s1.bytes+20000*32)\n"
+  "assert(s1.reserved>=65536)\n"
+  "\n"
+  "local count=s1.large.count\n"
+  "for _,c in ipairs(s1.classes)do\n"
+  "count=count+c.count\n"
+  "end\n"
+  "assert(count==s1.count)\n"
+  "\n"
+  "\n"
+  "local reserved=s1.reserved\n"
+  "for _=1,10 do\n"
+  "local t={}\n"
+  "for ii=1,20000 do\n"
+  "t[ii]={ii,tostring(ii)}\n"
+  "end\n"
+  "t=nil\n"
+  "collectgarbage()\n"
+  "end\n"
+  "assert(lalloc.stats().reserved<reserved*2)\n"
+  "\n"
+  "lalloc.resetPeak()\n"
+  "local s2=lalloc.stats()\n"
+  "assert(s2.peak<s1.peak)\n"
+  "\n"
+  "print(#big,\"ok\")\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "kilroyWasHere=\"K\"\n"
+  " "
+  "";
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@test/alloc.lua", (const char *) data1, 856, 0 },
+   { "pre", "@test/pre.lua", (const char *) data2, 20, 0 }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "pre");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = lalloc_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
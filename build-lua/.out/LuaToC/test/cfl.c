@@ -0,0 +1,260 @@
+// Generated by cfromlua
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "local requirefile=require\"requirefile\"\n"
+  "\n"
+  "local hasPreload=(kilroyWasHere and\"P1\"or\"P0\")\n"
+  "local hasDebug=((require\"debug\")and\"D1\"or\"D0\")\n"
+  "\n"
+  "\n"
+  "local d0=require\"dep\"\n"
+  "local d1=require\"dep\"\n"
+  "\n"
+  "\n"
+  "local m1=requirefile(\"dep/dep.lua\")\n"
+  "local m2=requirefile(\"dep/data.txt\")\n"
+  "\n"
+  "requirefile(\"dep/data.txt\")\n"
+  "\n"
+  "if arg==\"Test\"then\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "print(\"<\"..(os.getenv(\"LUA_PATH\")or\"\")..\">\")\n"
+  "\n"
+  "print(hasPreload..\",\"..\n"
+  "hasDebug..\",\"..\n"
+  "(arg[1]or\"\")..\",\"..\n"
+  "d1..\",\"..\n"
+  "m1:sub(1,10)..\",\"..\n"
+  "m2:sub(1,12))\n"
+  "";
+
+extern int luaopen_requirefile(lua_State *);
+
+static const unsigned char data2[] = 
+  "\n"
+  "a=(a or 0)+1\n"
+  "return a\n"
+  "";
+
+static const unsigned char data3[] = 
+  "\n"
+  "kilroyWasHere=\"K\"\n"
+  " "
+  "";
+
+static const unsigned char data4[] = 
+  "-- dep.lua\n"
+  "a = (a or 0) + 1\n"
+  "return a\n"
+  "";
+
+static const unsigned char data5[] = 
+  "This is data.txt\n"
+  "";
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@test/cfl.lua", (const char *) data1, 468, 0 },
+   { "requirefile", 0, (const char *) 0, 0, luaopen_requirefile },
+   { "dep", "@test/dep.lua", (const char *) data2, 23, 0 },
+   { "pre", "@test/pre.lua", (const char *) data3, 20, 0 }
+};
+
+
+
+typedef struct {
+   const char * pszPath;      // requirefile path
+   const char * pc;
+   size_t       cb;
+} RequireFiles;
+
+
+static const RequireFiles rfiles[] = { 
+   { "dep/dep.lua", (const char *) data4, 37 },
+   { "dep/data.txt", (const char *) data5, 17 }
+};
+
+
+// path --> contents
+static int requirefile(lua_State *L)
+{
+   const char *path = lua_tostring(L, -1);
+   size_t ndx;
+
+   for (ndx = 0; ndx < ARRAYLENGTH(rfiles); ++ndx) {
+      if (!strcmp(path, rfiles[ndx].pszPath)) {
+         lua_pushlstring(L, rfiles[ndx].pc, rfiles[ndx].cb);
+         return 1;
+      }
+   }
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "pre");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
@@ -11,6 +11,7 @@ _BuildLua.luaExe = $(package.lua)/bin/lua
 _BuildLua.luaLib = $(package.lua)/lib/liblua.lib
 _BuildLua.luaIncludes = $(package.lua)/src
 _BuildLua.cfromlua := $(dir $(lastword $(MAKEFILE_LIST)))cfromlua.lua
+_BuildLua.testpool := $(dir $(lastword $(MAKEFILE_LIST)))testpool.lua
 
 
 # LuaEnv: mixin for defining properties related to the Lua interpreter
@@ -50,7 +51,9 @@ _LuaToC.outExt = .c
 _LuaToC.command = {exportPrefix} {luaExe} {cfromlua} -o {@} {flags} $(addprefix -l ,{preloads}) -MF {depsMF} -MP -Werror $(foreach l,{openLibs},--open=$l) -- {^}
 _LuaToC.up = {cfromlua} {inherit}
 _LuaToC.depsMF = {outBasis}.d {inherit}
-_LuaToC.flags = --minify
+# Set `luaPoolAlloc` to use the pooled allocator (see build-lua.txt)
+luaPoolAlloc ?=
+_LuaToC.flags = --minify $(if $(luaPoolAlloc),--pool-alloc)
 # openLibs = C extensions to be opened prior to the Lua modules being run
 _LuaToC.openLibs =
 
@@ -126,6 +129,41 @@ _LuaExe.depsMF = {outBasis}.d {inherit}
 LuaTest.inherit = _LuaTest
 _LuaTest.inherit = LuaCmd Test
 _LuaTest.deps = LuaScan($(word 1,{inIDs})) {inherit}
+_LuaTest.command = $(if {pooled},{queueCommand},{testCommand})
+_LuaTest.testCommand = {exportPrefix} {exec}$(\n)touch {@}
+# Queuing the test is equivalent to running it (the OK file is written later)
+_LuaTest.vvValue = $(call _vvEnc,{testCommand},$(basename {@}))
+_LuaTest.mkdirs = {inherit} $(if {pooled},{poolDir}/)
+_LuaTest.pooled = $(if $(luaTestPool),{pool})
+_LuaTest.pool = 1
+_LuaTest.poolDir = $(VOUTDIR)LuaTestPool
+_LuaTest.queueCommand = @printf '%s\n' $(call _shellQuote,{queueEntry}) >> {poolDir}/queue$(if {isGoal},$(\n){poolCommand})
+_LuaTest.poolCommand = $(call get,command,LuaTestPool({poolDir}))
+_LuaTest.isGoal = $(filter $(_self),$(MAKECMDGOALS))
+_LuaTest.queueEntry = {@}$(\t){exportPrefix}$(\t){luaExe}$(\t){preloads}$(\t){^} {execArgs}$(\t){after}
+_LuaTest.after = $(call get,out,$(filter LuaTest$[%,{deps}))
+
+
+# Pooled tests: When `luaTestPool` is set to a number N, LuaTest instances
+#    whose {pool} property is non-empty add their tests to a queue instead
+#    of running them.  After a command-line goal has been built, the
+#    queued tests are run by testpool.lua in up to N warm worker processes
+#    (per distinct environment), and OK files are written for those that
+#    pass.  See build-lua.txt.
+#
+#    The pool is run by the recipe of the goal: by a LuaTest instance that
+#    is itself a goal, or else by the Alias (or `_Goal`) rule for the goal.
+#
+luaTestPool ?=
+ifneq "$(luaTestPool)" ""
+  Alias.recipe = {inherit}$(if $(filter-out LuaTest$[%,$(filter $(_argText),$(or $(MAKECMDGOALS),default))),$(\n)$(call get,command,LuaTestPool($(VOUTDIR)LuaTestPool)))
+endif
+
+# LuaTestPool(DIR) : Run tests queued in DIR.
+#
+LuaTestPool.inherit = _LuaTestPool
+_LuaTestPool.inherit = BuildLua Phony
+_LuaTestPool.command = {luaExe} {testpool} -j $(luaTestPool) $(_argText)
 
 
 # LuaScan(TEST): generate *and include* a makefile declaring the implicit
@@ -150,8 +188,11 @@ _LuaScan.outExt = .d
 # this rule, and relying on the generated file to declare that dependency.
 _LuaScan.hidden< = $(call get,out,$(_arg1))
 _LuaScan.in = 
-_LuaScan.command = {exportPrefix} {luaExe} {cfromlua} {hidden<} -MF {@} -Moo {Moo} -MT {MT} -MTF -MP
+_LuaScan.command = {exportPrefix} {luaExe} {cfromlua} {hidden<} -MF {@} -Moo {Moo} -MT {MT} -MTF -MP $(addprefix --scan-cache=,{scanCache})
 _LuaScan.up = {luaExe} {cfromlua}
 _LuaScan.MT = $(call get,out,LuaTest($(_argText)))
 _LuaScan.Moo = $(call get,out,LuaTest(^B_q.lua))
 _LuaScan.rule = {inherit}-include {@}$(\n)
+# Directory in which to cache scan results (see cfromlua --scan-cache), or
+# empty to disable caching.
+_LuaScan.scanCache = $(VOUTDIR)ScanCache
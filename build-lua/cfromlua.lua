@@ -25,12 +25,14 @@ Options:
                   computed by expanding PATTERN for each dependency.
    -MX          : Include binary extensions in the dependency file.
    -m NAME      : Specify the main function name.
+   --pool-alloc : Create the Lua state with lalloc_newstate() (see lalloc.h).
    --           : Stop processing options.
    -v           : Display module and file names as they are visited.
    -h,  --help  : Display this message.
    --readlibs   : Treat FILE as a previously-generated C file and read
                   dependencies from embedded comments.
    --win        : Use "\" when echoing library dependencies.
+   --scan-cache=DIR : Cache the results of scanning sources in DIR.
 
 See cfromlua.txt for more information.
 ]]
@@ -41,6 +43,7 @@ See cfromlua.txt for more information.
 ----------------------------------------------------------------
 local progname = "cfromlua"
 local options = {}
+local scanCache    -- see --scan-cache
 
 
 -- catch unintentional global usage
@@ -380,7 +383,7 @@ local ctemplate = [[
 #include "lua.h"
 #include "lauxlib.h"
 #include "lualib.h"
-
+#{allocinclude}
 #define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
 
 #{defs}
@@ -481,7 +484,7 @@ int #{main} (int argc, char **argv)
    int nErr;
    lua_State *L;
 
-   L = luaL_newstate();
+   L = #{newstate}();
    if (L == NULL) {
       fprintf(stderr, "lua_open failed: not enough memory\n");
       return EXIT_FAILURE;
@@ -631,7 +634,8 @@ local function cfl_requirefile(path)
    local modDir = dir(modFile)
    for pathDir in requirePath:gmatch("([^;]+)") do
       local file = join( join(modDir, pathDir), rel)
-      local data = readFile(file)
+      -- contents are needed only when generating output
+      local data = (options.o and readFile or fileExists)(file)
       if data then
          return data, file
       end
@@ -688,10 +692,12 @@ end
 
 -- Find a module in the search path, if we haven't already.
 --
+-- Returns: filename, isSource
+--
 local function findModule(name, path, cpath)
    local filename = searchLuaPath(path, name)
    if filename then
-      return filename, readFile(filename)
+      return filename, true
    end
 
    filename = searchLuaPath(cpath, name)
@@ -703,7 +709,7 @@ local function findModule(name, path, cpath)
          or fileExists(base..".obj")
 
       if libfile then
-         return libfile, nil
+         return libfile, false
       end
       warn("%s found; %s missing\n", filename, libfile)
    end
@@ -776,9 +782,11 @@ end
 
 local addRequire
 
--- Add a source file to mods[] and follow its dependencies
+-- Scan Lua source, returning an array of the `require` and `requirefile`
+-- calls it contains: { func1, mod1, func2, mod2, ... }.  When the source
+-- text is needed for output, also return the text to be bundled.
 --
-local function addSource(name, filename, data)
+local function scanSource(filename, data)
    data = trimHash(data)
    local mini, comments, err, pos = strip2(data)
    if not mini then
@@ -786,26 +794,61 @@ local function addSource(name, filename, data)
       bailIf(true, "%s:%d: syntax error: unterminated %s", filename, lnum, err)
    end
 
+   local calls = {}
+   local function add(func, mod)
+      if func == "require" or func == "requirefile" then
+         calls[#calls+1] = func
+         calls[#calls+1] = mod
+      end
+   end
+
+   -- required files
+   for func, mod in mini:gmatch("([%w%.:]-requiref?i?l?e?) *%(? *['\"]([^'\"\n]+)['\"]") do
+      add(func, mod)
+   end
+
+   -- files identified in comments
+   for func, mod in comments:gmatch(" +@(requiref?i?l?e?)[ \t]+([^ \t\n\r]+)") do
+      add(func, mod)
+   end
+
+   return calls, options.minify and mini or data
+end
+
+
+-- Add a source file to mods[] and follow its dependencies.  `data` is
+-- the contents of the file, or nil if it has not been read yet.
+--
+-- Scan results are cached when only dependencies are being generated
+-- (without -o), since otherwise the source text must be processed anyway.
+--
+local function addSource(name, filename, data)
+   local useCache = scanCache and not options.o and filename ~= "<stdin>"
+   local calls = useCache and scanCache:get(filename)
+
+   if calls then
+      vprintf("%s: scan cache hit\n", filename)
+   else
+      data = data or readFile(filename)
+      bailIf(not data, "could not open file: %s", filename)
+      calls, data = scanSource(filename, data)
+      if useCache then
+         scanCache:put(filename, calls)
+      end
+   end
+
    addMod {
       name = name,
       filename = filename,
-      data = options.minify and mini or data,
+      data = data,
    }
 
    -- queue bundling of required files
-   for func, mod in mini:gmatch("([%w%.:]-requiref?i?l?e?) *%(? *['\"]([^'\"\n]+)['\"]") do
-      if func == "require" then
-         addRequire(mod, name or filename)
-      elseif func == "requirefile" then
-         addRequireFile(mod)
-      end
-   end
-
-   -- queue bundling of files identified in comments
-   for func, mod in comments:gmatch(" +@(requiref?i?l?e?)[ \t]+([^ \t\n\r]+)") do
+   for ndx = 1, #calls, 2 do
+      local func, mod = calls[ndx], calls[ndx+1]
       if func == "require" then
          addRequire(mod, name or filename)
-      elseif func == "requirefile" then
+      else
          addRequireFile(mod)
       end
    end
@@ -829,10 +872,10 @@ function addRequire(name, from)
       return
    end
 
-   local filename, data = findModule(name, path, cpath)
-   if data then
+   local filename, isSource = findModule(name, path, cpath)
+   if isSource then
       -- found Lua source
-      addSource(name, filename, data)
+      addSource(name, filename)
    elseif filename then
       -- found native extension library
       addLib(name, filename)
@@ -894,6 +937,8 @@ local function writeCSource()
    values.defs = table.concat(o)
 
    values.main = options.m or "main"
+   values.newstate = options["pool-alloc"] and "lalloc_newstate" or "luaL_newstate"
+   values.allocinclude = options["pool-alloc"] and '#include "lalloc.h"\n' or ""
 
    -- generate mods[]
    local o = Outfile:New()
@@ -1063,10 +1108,10 @@ local function scanSources(modnames)
      if name == '-' then
         name = '<stdin>'
         data = io.stdin:read('*a')
+        bailIf(not data, "could not open file: %s", name)
       else
-        data = readFile(name)
+        bailIf(not fileExists(name), "could not open file: %s", name)
       end
-      bailIf(not data, "could not open file: %s", name)
       addSource(nil, name, data)
    end
 
@@ -1091,7 +1136,7 @@ end
 -- Command argument processing
 ----------------------------------------------------------------
 
-local oo = "-o= -h/--help -v -w -Werror -MF= -MP -MT= -MTF -Moo= -MX --path=* -s=* --deps -I=* --minify -m= -l=* -b=* --open=* --readlibs --win --luaout"
+local oo = "-o= -h/--help -v -w -Werror -MF= -MP -MT= -MTF -Moo= -MX --path=* -s=* --deps -I=* --minify -m= -l=* -b=* --open=* --readlibs --win --luaout --scan-cache= --pool-alloc"
 
 local modnames
 modnames, options = getopts(arg, oo)
@@ -1133,6 +1178,17 @@ if options.I then
    end
 end
 
+-- The scan cache depends on modules (including a native extension) that
+-- might not be on the Lua path; without them, sources are always scanned.
+if options["scan-cache"] then
+   local succ, scancache = pcall(require, "scancache")
+   if succ then
+      scanCache = scancache.open(options["scan-cache"], "lua")
+   else
+      vprintf("scan cache not available: %s\n", scancache)
+   end
+end
+
 if options.v then
    for p in path:gmatch("[^;]+") do
       printf2("path: %s\n", p)
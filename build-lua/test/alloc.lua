@@ -0,0 +1,48 @@
+-- alloc.lua: run by an executable built with `cfromlua --pool-alloc`
+
+local rtrequire = require
+local lalloc = rtrequire "lalloc"
+
+local s0 = lalloc.stats()
+assert(#s0.classes == 16)
+assert(s0.classes[1].size == 16 and s0.classes[16].size == 256)
+assert(s0.bytes > 0 and s0.peak >= s0.bytes and s0.count > 0)
+
+-- Churn small strings and tables, then a few large ones.
+local t = {}
+for ii = 1, 20000 do
+   t[ii] = { ii, tostring(ii) }
+end
+local big = ("x"):rep(100000)
+t = nil
+collectgarbage()
+
+local s1 = lalloc.stats()
+assert(s1.allocs > s0.allocs + 40000)
+assert(s1.large.allocs > s0.large.allocs)
+assert(s1.peak > s1.bytes + 20000 * 32)
+assert(s1.reserved >= 65536)
+
+local count = s1.large.count
+for _, c in ipairs(s1.classes) do
+   count = count + c.count
+end
+assert(count == s1.count)
+
+-- Freed blocks are reused.
+local reserved = s1.reserved
+for _ = 1, 10 do
+   local t = {}
+   for ii = 1, 20000 do
+      t[ii] = { ii, tostring(ii) }
+   end
+   t = nil
+   collectgarbage()
+end
+assert(lalloc.stats().reserved < reserved * 2)
+
+lalloc.resetPeak()
+local s2 = lalloc.stats()
+assert(s2.peak < s1.peak)
+
+print(#big, "ok")
@@ -0,0 +1,24 @@
+-- pool.lua: a test run by testpool_q.lua
+--
+-- Each run should see fresh globals and modules, and the module preloaded
+-- via the PRELOADS field.  Changes to nested state (library tables) should
+-- not be seen by later runs.
+
+assert(require("dep") == 1)
+assert(kilroyWasHere == "K")
+assert(string.kilroy == nil and package.preload.kilroy == nil)
+string.kilroy = true
+package.preload.kilroy = print
+
+-- `arg` is set as `lua -l pre test/pool.lua ...` would set it
+assert(arg[0] == "test/pool.lua" and arg[-1] == "pre" and arg[-2] == "-l")
+assert(arg[-3] and not arg[-4])
+
+if ... == "fail" then
+   os.exit(2)
+elseif ... == "slow" then
+   os.execute("sleep 0.3")
+elseif ... == "crash" then
+   -- kill the worker process
+   os.execute("sleep 0.3; kill -9 $PPID")
+end
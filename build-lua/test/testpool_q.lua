@@ -0,0 +1,81 @@
+-- testpool_q.lua: test testpool.lua
+
+local dir = os.tmpname()
+os.remove(dir)
+assert(os.execute("mkdir " .. dir))
+
+-- find the interpreter running this script
+local n = 0
+while arg[n-1] do
+   n = n - 1
+end
+local lua = arg[n]
+
+local function queue(ok, args, after)
+   return table.concat({dir .. "/" .. ok, "", lua, "pre", "test/pool.lua " .. args,
+                        after and dir .. "/" .. after or ""}, "\t") .. "\n"
+end
+
+local f = assert(io.open(dir .. "/queue", "w"))
+f:write(queue("a.ok", ""),
+        queue("b.ok", ""),
+        queue("c.ok", "fail"),
+        queue("d.ok", "", "c.ok"),
+        queue("e.ok", "", "a.ok"),
+        queue("b.ok", ""))
+f:close()
+
+local p = assert(io.popen(lua .. " testpool.lua -j 1 " .. dir))
+local out = p:read("*a")
+assert(not p:close())
+
+local function exists(name)
+   local f = io.open(dir .. "/" .. name)
+   if f then
+      f:close()
+      return true
+   end
+   return false
+end
+
+assert(exists("a.ok") and exists("b.ok") and exists("e.ok"))
+assert(not exists("c.ok") and not exists("d.ok"))
+assert(not exists("queue"))
+assert(out:match("testpool: 5 tests, 1 workers"))
+assert(out:match("FAILED: test/pool.lua"))
+assert(out:match("not run %(skip%)"))
+
+-- With more workers, the idle ones wait for a slow test on which the rest
+-- depend, and are woken when its result is recorded.
+f = assert(io.open(dir .. "/queue", "w"))
+f:write(queue("s.ok", "slow"),
+        queue("f.ok", "", "s.ok"),
+        queue("g.ok", "", "s.ok"),
+        queue("h.ok", "", "f.ok"))
+f:close()
+
+p = assert(io.popen(lua .. " testpool.lua -j 3 " .. dir))
+out = p:read("*a")
+assert(p:close())
+
+assert(exists("s.ok") and exists("f.ok") and exists("g.ok") and exists("h.ok"))
+assert(out:match("testpool: 4 tests, 3 workers"))
+assert(not exists("wake"))
+
+-- When a worker dies while running a test, the test fails, and a worker
+-- waiting for its result is woken.
+f = assert(io.open(dir .. "/queue", "w"))
+f:write(queue("k.ok", "crash"),
+        queue("m.ok", "", "k.ok"))
+f:close()
+
+p = assert(io.popen(lua .. " testpool.lua -j 2 " .. dir .. " 2>/dev/null"))
+out = p:read("*a")
+assert(not p:close())
+
+assert(not exists("k.ok") and not exists("m.ok"))
+assert(out:match("testpool: 2 tests, 2 workers"))
+assert(out:match("FAILED: test/pool.lua"))
+assert(out:match("not run %(skip%)"))
+
+os.execute("rm -rf " .. dir)
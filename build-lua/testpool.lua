@@ -0,0 +1,475 @@
+-- testpool.lua: run Lua tests in a pool of warm worker processes
+--
+-- Usage:  lua testpool.lua [-j N] DIR
+--
+-- When `luaTestPool` is set, LuaTest instances do not run their tests.
+-- Instead each appends a line to DIR/queue describing the test, and this
+-- script runs the queued tests after the goal has been built (see
+-- build-lua.mk).  Each line has these tab-separated fields:
+--
+--    OKFILE  ENV  LUAEXE  PRELOADS  SCRIPT ARGS...  AFTER...
+--
+-- OKFILE is written when the test succeeds.  ENV holds the shell variable
+-- assignments that LuaTest would use when running LUAEXE.  PRELOADS names
+-- modules to load before SCRIPT (as with `lua -l`).  AFTER lists the
+-- OKFILEs of tests that must succeed before this test is run.
+--
+-- Tests that share the same ENV and LUAEXE form a group.  For each group,
+-- up to N (default 4) worker processes are started.  A worker loads the
+-- Lua interpreter and standard libraries once, and then runs tests one
+-- after another.  Each test is run with a fresh global table and a fresh
+-- `package.loaded` (other than the standard libraries), so modules are
+-- loaded anew for each test, as if it were run in its own process.  Tables
+-- reachable from the global table (e.g. `string` or `package.preload`)
+-- are restored as well.  Calls to `os.exit` end the test, not the worker.
+--
+-- Workers claim tests by renaming DIR/t.<n> to DIR/c.<n>, which succeeds
+-- for only one worker, and record the result in DIR/r.<n>.  A worker whose
+-- remaining tests await results from other workers creates DIR/w.<id> and
+-- blocks reading the FIFO DIR/wake.  After recording a result, a worker
+-- writes a byte to the FIFO for each such file it finds.
+--
+-- While running a test, a worker records the test's number in DIR/p.<id>.
+-- If the worker exits before recording a result (e.g. the test crashes the
+-- interpreter), the test is recorded as failed and waiting workers are
+-- woken.  When all workers have finished, the time taken by each test is
+-- listed.  Times are CPU times of the worker (they exclude child
+-- processes).
+--
+
+local progname = arg[0]
+
+local function printf(fmt, ...)
+   io.write(fmt:format(...))
+end
+
+
+local function readFile(name)
+   local f = io.open(name)
+   if f then
+      local data = f:read("*a")
+      f:close()
+      return data
+   end
+end
+
+
+local function writeFile(name, data)
+   local f = assert(io.open(name, "w"))
+   f:write(data)
+   f:close()
+end
+
+
+local function words(str)
+   local o = {}
+   for w in str:gmatch("%S+") do
+      o[#o+1] = w
+   end
+   return o
+end
+
+
+----------------------------------------------------------------
+-- Queue
+----------------------------------------------------------------
+
+local fieldPattern = "^" .. ("([^\t]*)\t"):rep(5) .. "([^\t]*)$"
+
+
+-- Parse queue lines into an array of test descriptions.  When a test
+-- appears more than once (e.g. queued by an interrupted build), the last
+-- description is used in place of the first.
+--
+local function parseQueue(text)
+   local tests, byOK = {}, {}
+   for line in text:gmatch("[^\n]+") do
+      local ok, env, lua, preloads, cmd, after = line:match(fieldPattern)
+      if ok then
+         local t = byOK[ok]
+         if not t then
+            t = {}
+            tests[#tests+1] = t
+            byOK[ok] = t
+         end
+         t.line, t.ok, t.env, t.lua = line, ok, env, lua
+         t.preloads, t.args, t.after = words(preloads), words(cmd), words(after)
+         t.script = table.remove(t.args, 1)
+         t.group = env .. "\t" .. lua
+      end
+   end
+   for n, t in ipairs(tests) do
+      t.n = n
+   end
+   return tests, byOK
+end
+
+
+local function tokenName(dir, n)   return dir .. "/t." .. n  end
+local function claimName(dir, n)   return dir .. "/c." .. n  end
+local function resultName(dir, n)  return dir .. "/r." .. n  end
+local function waiterName(dir, id) return dir .. "/w." .. id  end
+local function activeName(dir, id) return dir .. "/p." .. id  end
+
+
+-- Return status ("ok", "fail", or "skip") and time of completed test `n`.
+--
+local function readResult(dir, n)
+   local data = readFile(resultName(dir, n))
+   if data then
+      local status, time = data:match("(%S+) (%S+)")
+      return status, tonumber(time)
+   end
+end
+
+
+----------------------------------------------------------------
+-- Worker
+----------------------------------------------------------------
+
+-- Snapshot the state that each test begins with.
+
+local stdin, stdout = io.input(), io.output()
+local setmeta = debug.setmetatable
+
+-- Use xpfs (when available) to undo changes to the working directory.
+local xpfs
+do
+   local succ, mod = pcall(require, "xpfs")
+   if succ then
+      xpfs = mod
+      package.loaded.xpfs = nil
+   end
+end
+
+-- Copy the contents and metatable of every table reachable from _G or the
+-- string metatable (library tables, package.loaded, package.preload,
+-- ...), so that changes to nested state are undone as well as changes to
+-- globals.
+--
+local baseTables, baseMetas = {}, {}
+
+local function snapshot(t)
+   if type(t) == "table" and not baseTables[t] then
+      local copy = {}
+      baseTables[t] = copy
+      baseMetas[t] = debug.getmetatable(t) or false
+      for k, v in pairs(t) do
+         copy[k] = v
+      end
+      for k, v in pairs(copy) do
+         snapshot(k)
+         snapshot(v)
+      end
+   end
+end
+
+snapshot(_G)
+snapshot(getmetatable(""))
+
+
+local function resetState(cwd)
+   for t, copy in pairs(baseTables) do
+      setmeta(t, baseMetas[t] or nil)
+      for k in pairs(t) do
+         if copy[k] == nil then
+            t[k] = nil
+         end
+      end
+      for k, v in pairs(copy) do
+         t[k] = v
+      end
+   end
+   io.input(stdin)
+   io.output(stdout)
+   if cwd then
+      xpfs.chdir(cwd)
+   end
+end
+
+
+local exitMarker = {}
+
+
+-- Run test `t` as `lua` would, returning its exit code.
+--
+local function runScript(t)
+   local exitCode
+
+   function os.exit(code)
+      exitCode = (code == nil or code == true) and 0 or code == false and 1 or code
+      error(exitMarker, 0)
+   end
+
+   -- Negative indices hold the interpreter and its options, as they would
+   -- for the command LuaTest runs: `LUAEXE -l NAME... SCRIPT ARGS...`
+   arg = { [0] = t.script, table.unpack(t.args) }
+   local pre = { t.lua }
+   for _, name in ipairs(t.preloads) do
+      pre[#pre+1] = "-l"
+      pre[#pre+1] = name
+   end
+   for ii, v in ipairs(pre) do
+      arg[ii - #pre - 1] = v
+   end
+
+   local function main()
+      for _, name in ipairs(t.preloads) do
+         _G[name] = require(name)
+      end
+      local fn, err = loadfile(t.script)
+      if not fn then
+         error(err, 0)
+      end
+      return fn(table.unpack(t.args))
+   end
+
+   local function handler(e)
+      if e == exitMarker then
+         return e
+      end
+      return debug.traceback(tostring(e), 2)
+   end
+
+   local succ, err = xpcall(main, handler)
+   if succ then
+      return 0
+   elseif err == exitMarker then
+      return tonumber(exitCode) or 1
+   end
+   io.stderr:write(t.lua .. ": " .. err .. "\n")
+   return 1
+end
+
+
+-- Return "ready", "wait", or "skip" for test `t`.
+--
+local function afterState(dir, t, byOK)
+   for _, ok in ipairs(t.after) do
+      local dep = byOK[ok]
+      if dep then
+         local status = readResult(dir, dep.n)
+         if not status then
+            return "wait"
+         elseif status ~= "ok" then
+            return "skip"
+         end
+      end
+   end
+   return "ready"
+end
+
+
+-- Open the FIFO used to wake waiting workers.  Opening a FIFO read/write
+-- does not wait for another process to open it.
+--
+local function openWake(dir)
+   return assert(io.open(dir .. "/wake", "r+"))
+end
+
+
+-- Wake workers (other than `id`) that are waiting for results.
+--
+local function notify(dir, wakeOut, id, numWorkers)
+   for w = 1, numWorkers do
+      if w ~= id and readFile(waiterName(dir, w)) then
+         wakeOut:write("x")
+      end
+   end
+   wakeOut:flush()
+end
+
+
+local function work(dir, group, id, numWorkers)
+   local tests, byOK = parseQueue(readFile(dir .. "/batch") or "")
+   local cwd = xpfs and xpfs.getcwd()
+
+   -- Reads are unbuffered so that each consumes only one byte.
+   local wakeIn, wakeOut = openWake(dir), openWake(dir)
+   wakeIn:setvbuf("no")
+   local registered = false
+
+   while true do
+      local ran, waiting = false, false
+
+      for n, t in ipairs(tests) do
+         if t.group == group and readFile(tokenName(dir, n)) then
+            local state = afterState(dir, t, byOK)
+            if state == "wait" then
+               waiting = true
+            elseif os.rename(tokenName(dir, n), claimName(dir, n)) then
+               local status, time = "skip", 0
+               if state == "ready" then
+                  writeFile(activeName(dir, id), tostring(n))
+                  local t0 = os.clock()
+                  local code = runScript(t)
+                  time = os.clock() - t0
+                  resetState(cwd)
+                  collectgarbage()
+                  io.stdout:flush()
+                  status = (code == 0 and "ok" or "fail")
+                  if code == 0 then
+                     writeFile(t.ok, "")
+                  end
+               end
+               writeFile(resultName(dir, n), status .. " " .. time .. "\n")
+               os.remove(activeName(dir, id))
+               notify(dir, wakeOut, id, numWorkers)
+               ran = true
+               -- rescan from the start, to run tests in queued order
+               break
+            end
+         end
+      end
+
+      if ran or not waiting then
+         if registered then
+            os.remove(waiterName(dir, id))
+            registered = false
+         end
+         if not ran then
+            break
+         end
+      elseif registered then
+         wakeIn:read(1)
+      else
+         -- Register, then scan again before blocking, so a result written
+         -- in the meantime is not missed.
+         writeFile(waiterName(dir, id), "")
+         registered = true
+      end
+   end
+   wakeIn:close()
+   wakeOut:close()
+end
+
+
+-- Clean up after worker `id` has exited.  If it exited while running a
+-- test (e.g. the test crashed the interpreter), record the test as failed
+-- so that workers waiting for its result are not blocked forever.
+--
+local function reap(dir, id, numWorkers)
+   os.remove(waiterName(dir, id))
+   local n = readFile(activeName(dir, id))
+   if n then
+      os.remove(activeName(dir, id))
+      if not readResult(dir, n) then
+         writeFile(resultName(dir, n), "fail 0\n")
+         local wakeOut = openWake(dir)
+         notify(dir, wakeOut, id, numWorkers)
+         wakeOut:close()
+      end
+   end
+end
+
+
+----------------------------------------------------------------
+-- Master
+----------------------------------------------------------------
+
+local function shellQuote(s)
+   return "'" .. s:gsub("'", "'\\''") .. "'"
+end
+
+
+local function runPool(dir, numWorkers)
+   local tests = parseQueue(readFile(dir .. "/queue") or "")
+   os.remove(dir .. "/queue")
+   if not tests[1] then
+      return true
+   end
+
+   os.execute("rm -f " .. shellQuote(dir) .. "/[tcrwp].* " .. shellQuote(dir) .. "/wake" ..
+              " && mkfifo " .. shellQuote(dir) .. "/wake")
+
+   -- Write the tests to be run by the workers, and a token for each.
+   local lines = {}
+   for n, t in ipairs(tests) do
+      lines[n] = t.line .. "\n"
+      writeFile(tokenName(dir, n), "")
+   end
+   writeFile(dir .. "/batch", table.concat(lines))
+
+   -- Start workers.  Their output goes directly to our stdout & stderr.
+   local groups, groupSize = {}, {}
+   for _, t in ipairs(tests) do
+      if not groupSize[t.group] then
+         groups[#groups+1] = t
+         groupSize[t.group] = 0
+      end
+      groupSize[t.group] = groupSize[t.group] + 1
+   end
+
+   local numTotal = 0
+   for _, t in ipairs(groups) do
+      numTotal = numTotal + math.min(numWorkers, groupSize[t.group])
+   end
+
+   local workers = {}
+   for _, t in ipairs(groups) do
+      for ii = 1, math.min(numWorkers, groupSize[t.group]) do
+         local function cmd(mode)
+            return ("%s%s %s %s %s %s %d %d"):format(
+               t.env, t.lua, shellQuote(progname), mode, shellQuote(dir),
+               shellQuote(t.group), #workers + 1, numTotal)
+         end
+         workers[#workers+1] = assert(io.popen(cmd("--worker") .. " ; " ..
+                                               cmd("--reap"), "w"))
+      end
+   end
+   for _, w in ipairs(workers) do
+      w:close()
+   end
+
+   -- Report
+   local total, failed = 0, {}
+   for _, t in ipairs(tests) do
+      t.status, t.time = readResult(dir, t.n)
+      t.status, t.time = t.status or "lost", t.time or 0
+      total = total + t.time
+      if t.status ~= "ok" then
+         failed[#failed+1] = t
+      end
+   end
+   table.sort(tests, function (a, b) return a.time > b.time end)
+
+   printf("testpool: %d tests, %d workers, %.2f s\n", #tests, #workers, total)
+   for _, t in ipairs(tests) do
+      printf("%9.1f ms  %s%s\n", t.time * 1e3, t.script,
+             t.status == "ok" and "" or "  [" .. t.status .. "]")
+   end
+   for _, t in ipairs(failed) do
+      printf("testpool: %s: %s\n", t.status == "fail" and "FAILED" or
+                "not run (" .. t.status .. ")", t.script)
+   end
+
+   os.execute("rm -f " .. shellQuote(dir) .. "/[tcrwp].* " .. shellQuote(dir) .. "/batch " ..
+              shellQuote(dir) .. "/wake")
+   return failed[1] == nil
+end
+
+
+----------------------------------------------------------------
+-- Main
+----------------------------------------------------------------
+
+local numWorkers = 4
+local a = 1
+if arg[a] == "--worker" then
+   work(arg[a+1], arg[a+2], tonumber(arg[a+3]), tonumber(arg[a+4]))
+   return
+elseif arg[a] == "--reap" then
+   reap(arg[a+1], tonumber(arg[a+3]), tonumber(arg[a+4]))
+   return
+end
+if arg[a] == "-j" then
+   numWorkers = tonumber(arg[a+1]) or numWorkers
+   a = a + 2
+end
+if not arg[a] then
+   io.stderr:write("Usage: lua " .. progname .. " [-j N] DIR\n")
+   os.exit(1)
+end
+if not runPool(arg[a], math.max(1, numWorkers)) then
+   os.exit(1)
+end
@@ -0,0 +1,204 @@
+-- mtrace.lua: summarize a Minion build trace
+--
+-- Usage:  lua mtrace.lua TRACEFILE [JSONFILE]
+--
+-- TRACEFILE contains records written by builder recipes when `minionTrace`
+-- is set (see build/tooltree.mk):
+--
+--     B <nanoseconds> <target> <instance>
+--     E <nanoseconds> <target> <prerequisites...>
+--
+-- A summary is written to stdout: overall parallelism, time by class, the
+-- slowest instances, and the critical path.  The critical path is found by
+-- starting at the last recipe to finish and repeatedly stepping to the
+-- traced prerequisite that finished last.
+--
+-- When JSONFILE is given, a Chrome trace (for chrome://tracing or
+-- https://ui.perfetto.dev) is written to it.  Each recipe is placed in the
+-- lowest-numbered "thread" that is free at its start time, so the number of
+-- threads shows the peak number of concurrent recipes.
+
+local traceFile, jsonFile = arg[1], arg[2]
+
+if not traceFile then
+   io.stderr:write("Usage: lua mtrace.lua TRACEFILE [JSONFILE]\n")
+   os.exit(1)
+end
+
+
+----------------------------------------------------------------
+-- Read records
+----------------------------------------------------------------
+
+local jobs = {}       -- array of jobs
+local byTarget = {}   -- target -> job
+
+local function readTrace(name)
+   local f = assert(io.open(name, "r"))
+   for line in f:lines() do
+      local kind, ns, target, rest = line:match("^([BE]) (%d+) (%S+) ?(.*)")
+      if kind then
+         local t = tonumber(ns) / 1e9
+         local job = byTarget[target]
+         if kind == "B" then
+            -- a target may be built more than once (e.g. in different
+            -- package builds); the last build wins
+            job = { target = target, id = rest, start = t }
+            byTarget[target] = job
+            jobs[#jobs+1] = job
+         elseif job then
+            job.stop = t
+            job.prereqs = {}
+            for p in rest:gmatch("%S+") do
+               job.prereqs[#job.prereqs+1] = p
+            end
+         end
+      end
+   end
+   f:close()
+end
+
+readTrace(traceFile)
+
+-- discard recipes that did not complete
+local done = {}
+for _, job in ipairs(jobs) do
+   if job.stop then
+      job.dur = job.stop - job.start
+      job.class = job.id:match("^_?([^%(]+)%(") or job.id
+      done[#done+1] = job
+   else
+      print("incomplete: " .. job.id)
+   end
+end
+jobs = done
+
+if not jobs[1] then
+   print("No completed recipes in " .. traceFile)
+   return
+end
+
+table.sort(jobs, function (a, b) return a.start < b.start end)
+
+
+----------------------------------------------------------------
+-- Assign threads
+----------------------------------------------------------------
+
+local threadFree = {}   -- thread number -> time at which it is free
+
+for _, job in ipairs(jobs) do
+   local tid = 1
+   while threadFree[tid] and threadFree[tid] > job.start do
+      tid = tid + 1
+   end
+   job.tid = tid
+   threadFree[tid] = job.stop
+end
+
+
+----------------------------------------------------------------
+-- Summary
+----------------------------------------------------------------
+
+local t0, tEnd, busy = math.huge, 0, 0
+local last
+for _, job in ipairs(jobs) do
+   t0 = math.min(t0, job.start)
+   if job.stop > tEnd then
+      tEnd, last = job.stop, job
+   end
+   busy = busy + job.dur
+end
+local wall = tEnd - t0
+
+local function ms(t)
+   return ("%9.1f ms"):format(t * 1e3)
+end
+
+print(("Recipes: %d   Wall: %s   Recipe total: %s   Parallelism: %.2f   Peak: %d")
+         :format(#jobs, ms(wall), ms(busy), busy / wall, #threadFree))
+
+
+-- Time by class
+
+local classes, classTime, classCount = {}, {}, {}
+for _, job in ipairs(jobs) do
+   local c = job.class
+   if not classTime[c] then
+      classes[#classes+1] = c
+      classTime[c], classCount[c] = 0, 0
+   end
+   classTime[c] = classTime[c] + job.dur
+   classCount[c] = classCount[c] + 1
+end
+table.sort(classes, function (a, b) return classTime[a] > classTime[b] end)
+
+print("\nBy class:")
+for _, c in ipairs(classes) do
+   print(("  %s  %5d  %s"):format(ms(classTime[c]), classCount[c], c))
+end
+
+
+-- Slowest recipes
+
+local slow = {}
+for ndx, job in ipairs(jobs) do
+   slow[ndx] = job
+end
+table.sort(slow, function (a, b) return a.dur > b.dur end)
+
+print("\nSlowest:")
+for ndx = 1, math.min(#slow, 10) do
+   print(("  %s  %s"):format(ms(slow[ndx].dur), slow[ndx].id))
+end
+
+
+-- Critical path
+
+local path = {}
+local job = last
+while job do
+   path[#path+1] = job
+   local pred
+   for _, p in ipairs(job.prereqs) do
+      local pj = byTarget[p]
+      if pj and pj.stop and pj.stop <= job.start and pj ~= job
+         and (not pred or pj.stop > pred.stop) then
+         pred = pj
+      end
+   end
+   job = pred
+end
+
+print("\nCritical path (start, duration):")
+for ndx = #path, 1, -1 do
+   local j = path[ndx]
+   print(("  %s  %s  %s"):format(ms(j.start - t0), ms(j.dur), j.id))
+end
+
+
+----------------------------------------------------------------
+-- Chrome trace
+----------------------------------------------------------------
+
+local function jsonString(s)
+   return '"' .. s:gsub('[%c"\\]', function (c)
+      return ("\\u%04x"):format(c:byte())
+   end) .. '"'
+end
+
+if jsonFile then
+   local events = {}
+   for _, j in ipairs(jobs) do
+      events[#events+1] =
+         ('{"name":%s,"cat":%s,"ph":"X","pid":1,"tid":%d,"ts":%.0f,"dur":%.0f,"args":{"out":%s}}')
+         :format(jsonString(j.id), jsonString(j.class), j.tid,
+                 (j.start - t0) * 1e6, j.dur * 1e6, jsonString(j.target))
+   end
+   local f = assert(io.open(jsonFile, "w"))
+   f:write('{"displayTimeUnit":"ms","traceEvents":[\n',
+           table.concat(events, ",\n"), "\n]}\n")
+   f:close()
+   print("\nWrote " .. jsonFile)
+end
@@ -0,0 +1,88 @@
+#!/bin/sh
+#
+# ocache.sh: content-addressed cache of Minion build outputs
+#
+# Usage:  ocache.sh LOG OUT DEPSMF COMMAND INPUT...
+#
+#   LOG     = file to which "hit OUT" or "miss OUT" is appended
+#   OUT     = output file built by COMMAND
+#   DEPSMF  = implicit dependency makefile written by COMMAND, or ""
+#   COMMAND = shell command that builds OUT
+#   INPUT   = prerequisites of OUT
+#
+# The cache directory is given by the `minionOutputCache` environment
+# variable.  When it is empty, COMMAND is simply executed.
+#
+# Entries are keyed by a hash of COMMAND, OUT, and the names and contents
+# of the INPUT files.  Each entry also records the hashes of the implicit
+# dependencies listed in DEPSMF (e.g. C headers), which must still match
+# for the entry to be used.  On a hit, OUT and DEPSMF are copied from the
+# entry; on a miss, COMMAND is executed and its results are stored.
+#
+# Usage:  ocache.sh --stats LOG
+#
+#   Summarize hits and misses recorded in LOG.
+
+if [ "$1" = "--stats" ] ; then
+  [ -f "$2" ] || exit 0
+  awk '{ n[$1]++ } END { t = n["hit"] + n["miss"];
+       printf "ocache: %d hits, %d misses (%.0f%%)\n", n["hit"], n["miss"], t ? 100 * n["hit"] / t : 0 }' "$2"
+  exit 0
+fi
+
+log=$1 out=$2 depsMF=$3 cmd=$4
+shift 4
+
+dir=$minionOutputCache
+if [ -z "$dir" ] ; then
+  exec sh -c "$cmd"
+fi
+
+if command -v sha256sum > /dev/null ; then
+  hash() { sha256sum "$@" ; }
+else
+  hash() { shasum -a 256 "$@" ; }
+fi
+
+# Print "HASH  NAME" for each existing file in $@
+hashFiles() {
+  for f in "$@" ; do
+    [ -f "$f" ] && hash "$f"
+  done
+}
+
+# Print the dependencies named in makefile $1 (one per line).
+mfDeps() {
+  sed -e ':a' -e '/\\$/N; s/\\\n//; ta' "$1" | sed -n 's/^[^:]*:\(.*\)/\1/p' |
+    tr ' \t' '\n\n' | grep -v '^$' | sort -u
+}
+
+key=$( { printf '%s\n%s\n' "$cmd" "$out" ; hashFiles "$@" ; } | hash | cut -c1-64 )
+entry=$dir/$(echo "$key" | cut -c1-2)/$key
+
+if [ -f "$entry/deps" ] &&
+   hashFiles $(cut -c67- "$entry/deps") | cmp -s - "$entry/deps" ; then
+  cp "$entry/out" "$out" &&
+    if [ -f "$entry/mf" ] ; then cp "$entry/mf" "$depsMF" ; fi &&
+    touch "$out" &&
+    echo "hit $out" >> "$log" &&
+    exit 0
+fi
+
+sh -c "$cmd" || exit $?
+echo "miss $out" >> "$log"
+
+# Store the result.  Failures here are not build failures.
+[ -f "$out" ] || exit 0
+tmp=$entry.tmp.$$
+mkdir -p "$tmp" 2> /dev/null || exit 0
+cp "$out" "$tmp/out"
+if [ -n "$depsMF" ] && [ -f "$depsMF" ] ; then
+  cp "$depsMF" "$tmp/mf"
+  hashFiles $(mfDeps "$depsMF") > "$tmp/deps"
+else
+  : > "$tmp/deps"
+fi
+rm -rf "$entry"
+mv "$tmp" "$entry" 2> /dev/null || rm -rf "$tmp"
+exit 0
@@ -62,7 +62,7 @@ _vgetError = $(error Undefined property: V($V).$1$(\n)$(call _whereAmI,call _v$;
 #
 
 package.bench.dir = $(_tt)bench/
-package.bench.imports = luau build-lua monoglot lpeg
+package.bench.imports = luau build-lua monoglot lpeg smark
 
 package.build.dir = $(_tt)build/
 
@@ -122,12 +122,64 @@ Alias(all).in = Variants(deep)
 Alias(deep).in = Package($(thisPackage))
 Alias(imports).in = Package@package.$(thisPackage).imports
 
+# trace: Build $(traceGoals) with `minionTrace` enabled, then summarize the
+#   trace and write a Chrome trace file.  See tooltree.txt.
+traceGoals ?= default
+Alias(trace).command = @rm -f $(_traceLog)$(\n)+$(MAKE) --no-print-directory minionTrace=$(_traceLog) $(foreach g,$(traceGoals),$(call _shellQuote,$g)) ; s=$$? ; $(_traceLua) $(_tt)build/mtrace.lua $(_traceLog) $(VOUTDIR)trace.json ; exit $$s
+_traceLog = $(abspath $(VOUTDIR)trace.log)
+_traceLua = $(or $(wildcard $(package.lua.dir)$(package.lua.outdir)/bin/lua),lua)
+
 # return $1 if variable $1 is defined
 _defined = $(if $(filter undefined,$(origin $1)),,$1)
 
 # Use a simpler {outBasis} than default (no .EXT in .out/Class/... directories)
 Builder.outBasis = $(VOUTDIR)$(call _outBasis,$(_class),$(_argText),%,$(call get,out,$(filter $(_arg1),$(word 1,$(call _expand,{in},in)))),$(_arg1))
 
+# When `minionTrace` names a file, builder recipes append start and end
+# records to it (see `make trace`).  The records are written by recipe lines
+# expanded when the recipe runs, so cached rules need not be regenerated
+# when tracing is turned on or off.  Records are:
+#
+#    B <nanoseconds> <target> <instance>
+#    E <nanoseconds> <target> <prerequisites...>
+#
+minionTrace ?=
+minionTraceClock ?= date +%s%N
+
+define Builder.recipe
+$(call _lazy,$$(call _traceRecord,B,$$@ $(call _escape,$(call _shellQuote,$(_self)))))
+$(if {message},@echo $(call _shellQuote,{message}))
+$(if {mkdirs},@mkdir -p {mkdirs})
+$(foreach F,{vvFile},@echo '_vv={vvValue}' > $F)
+$(if $(and $(minionOutputCache),{outputCache}),{cachedCommand},{command})
+$(call _lazy,$$(call _traceRecord,E,$$@ $$^ $$|))
+$(if $(filter _Goal Alias,$(_class)),$(call _lazy,$$(if $$(and $$(minionOutputCache),$$(filter $(call _escape,$(_argText)),$$(or $$(MAKECMDGOALS),default))),@$(_ocache) --stats $(_ocacheLog))))
+endef
+
+# $(call _traceRecord,B|E,WORDS) : recipe line, or nothing when not tracing
+_traceRecord = $(if $(minionTrace),@echo $1 `$(minionTraceClock)` $2 >> $(abspath $(minionTrace)))
+
+
+# Output cache: When `minionOutputCache` names a directory, the outputs of
+# instances whose `outputCache` property is non-empty are stored in that
+# directory, keyed by the command and the contents of its inputs, and are
+# restored from it instead of being rebuilt.  Hits and misses are counted
+# in $(VOUTDIR)ocache.log and reported after each goal.  See ocache.sh.
+#
+minionOutputCache ?=
+export minionOutputCache
+Builder.outputCache =
+Builder.cachedCommand = $(_ocache) $(_ocacheLog) {@} $(call _shellQuote,{depsMF}) $(call _shellQuote,$(call _ocacheJoin,{command})) $(call _lazy,$$^)
+CC.outputCache = 1
+LuaToC.outputCache = 1
+SmarkDoc.outputCache = 1
+
+_ocache = $(_tt)build/ocache.sh
+_ocacheLog = $(VOUTDIR)ocache.log
+
+# Join recipe lines into one shell command, dropping "@" prefixes
+_ocacheJoin = true$(subst $(\n), && ,$(subst $(\n)@,$(\n),$(\n)$1))
+
 
 # Tooltree C compilation defaults
 #
@@ -195,9 +247,12 @@ _Package.deps = $(foreach P,{p-imports},$(_class)($P))
 _Package.mkdirs = $(if {p-outdir},$(dir {@}))
 _Package.command = $(if {p-outdir},{makeCommand})
 _Package.message = $(if {p-outdir},{inherit})
-_Package.makeCommand = @( cd {p-dir} && $(MAKE) V=$V) > {@} 2>&1 || printf '**FAILED: see {@} for log\nOr: cd {p-dir} && make\n'
+_Package.makeCommand = @( cd {p-dir} && $(MAKE) V=$V$(_traceArg)) > {@} 2>&1 || printf '**FAILED: see {@} for log\nOr: cd {p-dir} && make\n'
 _Package.cleanCommand = @$(if {p-outdir},cd {p-dir} && $(MAKE) V=$V clean)
 
+# Pass an absolute path for `minionTrace` (when enabled) to the package build
+_traceArg = $(call _lazy,$$(if $$(minionTrace), minionTrace=$$(abspath $$(minionTrace))))
+
 # Package properties
 _Package.p-dir = $(package.$(_arg1).dir)
 _Package.p-imports = $(package.$(_arg1).imports)
@@ -256,5 +311,24 @@ _importPackages = \
 
 minionStart = 1
 include $(_tt)build/minion.mk
+
+# Workaround for GNU Make 4.3: Minion's _cx memoizes the compiled form of
+# {inherit} in a variable named "&CLASSES.PROP", where CLASSES is the list
+# of classes that remain to be searched.  Make 4.3 expands `$(call NAME)`
+# to nothing when NAME contains spaces, so {inherit} silently yields an
+# empty value (e.g. LuaTest runs without LUA_PATH).  This is a copy of _cx
+# from build/minion.mk (blob 3dbda36a) that differs only in joining CLASSES
+# with "+" (see _cxName).  Remove it when minion.mk is updated.
+_cxName = &$(subst $(\s),+,$1).$2
+_cx = $(if $1,$(if $(value $(_cxName)),$(_cxName),$(call _fset,$(if $4,$(subst $],],~$(_self).$2),$(_cxName)),$(foreach w,$(word 1,$1).$2,$(if $(filter s%,$(flavor $w)),$(subst $$,$$$$,$(value $w)),$(subst },$(if ,,,&$$0$]),$(subst {,$(if ,,$$$[call .,),$(subst {inherit},$(if $(findstring {inherit},$(value $w)),$$(call $(call _cx,$(call _walk,$(if $4,$(_class),$(_pup)),$2),$2,^$1))),$(value $w)))))))),$(_E1))
+
+# Begin counting output cache hits and misses when a build starts (but not
+# when Make restarts after updating included makefiles).
+ifneq "$(minionOutputCache)" ""
+  ifeq "$(MAKE_RESTARTS)" ""
+    $(shell rm -f $(_ocacheLog))
+  endif
+endif
+
 $(_importPackages)
 $(minionEnd)
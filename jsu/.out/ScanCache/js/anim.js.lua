@@ -0,0 +1 @@
+return {value={requires={"view.js","class.js"}},path="anim.js",stamp="4070:1171519:65024:1792361468"}
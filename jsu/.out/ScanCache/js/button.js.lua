@@ -0,0 +1 @@
+return {value={requires={"view.js","scheduler.js","anim.js","eventutils.js"}},path="button.js",stamp="2647:1171523:65024:1792361468"}
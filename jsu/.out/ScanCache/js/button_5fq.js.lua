@@ -0,0 +1 @@
+return {value={requires={"expect.js","dom_emu.js","button.js"}},path="button_q.js",stamp="396:1171525:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={requires={}},path="class.js",stamp="628:1171526:65024:1792361468"}
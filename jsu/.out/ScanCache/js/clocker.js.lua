@@ -0,0 +1 @@
+return {value={requires={}},path="clocker.js",stamp="1761:1171529:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={requires={"class.js","expect.js"}},path="dom_emu.js",stamp="10889:1171531:65024:1792361468"}
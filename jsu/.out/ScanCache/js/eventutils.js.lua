@@ -0,0 +1 @@
+return {path="eventutils.js",value={requires={}},stamp="4260:1171532:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="eventutils_q.js",value={requires={"expect.js","eventutils.js"}},stamp="772:1171533:65024:1792361468"}
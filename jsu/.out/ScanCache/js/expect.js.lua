@@ -0,0 +1 @@
+return {value={requires={"fs","serialize.js"}},path="expect.js",stamp="3163:1171534:65024:1792361468"}
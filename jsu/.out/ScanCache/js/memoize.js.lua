@@ -0,0 +1 @@
+return {value={requires={}},path="memoize.js",stamp="2117:1171538:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={requires={"map.js"}},stamp="1341:1171539:65024:1792361468",path="memoize2.js"}
@@ -0,0 +1 @@
+return {value={requires={"class.js","memoize.js"}},path="observable.js",stamp="7103:1171541:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="5027:1171543:65024:1792361468",value={requires={"observable.js","expect.js"}},path="observable_q.js"}
@@ -0,0 +1 @@
+return {path="psarray.js",value={requires={"class.js"}},stamp="1384:1171547:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="psarray_q.js",value={requires={"psarray.js","expect.js"}},stamp="1246:1171549:65024:1792361468"}
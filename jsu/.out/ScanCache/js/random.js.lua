@@ -0,0 +1 @@
+return {stamp="562:1171550:65024:1792361468",path="random.js",value={requires={}}}
@@ -0,0 +1 @@
+return {stamp="159:1171551:65024:1792361468",path="random_q.js",value={requires={"expect.js","random.js"}}}
@@ -0,0 +1 @@
+return {value={requires={}},path="scheduler.js",stamp="964:1171552:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="1340:1171553:65024:1792361468",path="scheduler_emu.js",value={requires={}}}
@@ -0,0 +1 @@
+return {value={requires={}},path="serialize.js",stamp="2990:1171554:65024:1792361468"}
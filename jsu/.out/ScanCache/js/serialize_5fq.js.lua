@@ -0,0 +1 @@
+return {path="serialize_q.js",value={requires={"serialize.js"}},stamp="653:1171555:65024:1792361468"}
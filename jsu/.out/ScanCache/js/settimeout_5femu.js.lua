@@ -0,0 +1 @@
+return {value={requires={}},path="settimeout_emu.js",stamp="255:1171556:65024:1792361468"}
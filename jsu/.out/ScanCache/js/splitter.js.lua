@@ -0,0 +1 @@
+return {path="splitter.js",value={requires={"view.js","eventutils.js"}},stamp="4316:1171557:65024:1792361468"}
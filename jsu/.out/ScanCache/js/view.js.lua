@@ -0,0 +1 @@
+return {value={requires={"class.js","observable.js"}},path="view.js",stamp="9944:1171561:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={requires={"dom_emu.js","settimeout_emu.js","observable.js","expect.js","view.js","clocker.js"}},path="view_q.js",stamp="4333:1171563:65024:1792361468"}
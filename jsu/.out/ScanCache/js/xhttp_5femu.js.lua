@@ -0,0 +1 @@
+return {stamp="1795:1171565:65024:1792363143",path="xhttp_emu.js",value={requires={"xhttp.js"}}}
@@ -0,0 +1,370 @@
+_cachedIDs = Alias(default) JSScan(anim_q.js) JSScan(button_q.js) JSScan(class_q.js) JSScan(eventutils_q.js) JSScan(memoize_q.js) JSScan(observable_q.js) JSScan(oweb_q.js) JSScan(psarray_q.js) JSScan(random_q.js) JSScan(serialize_q.js) JSScan(splitter_q.js) JSScan(view_q.js) JSTest(anim_q.js) JSTest(button_q.js) JSTest(class_q.js) JSTest(eventutils_q.js) JSTest(memoize_q.js) JSTest(observable_q.js) JSTest(oweb_q.js) JSTest(psarray_q.js) JSTest(random_q.js) JSTest(serialize_q.js) JSTest(splitter_q.js) JSTest(view_q.js)
+
+.PHONY: default
+default : .out/JSTest/anim_q.ok .out/JSTest/button_q.ok .out/JSTest/class_q.ok .out/JSTest/eventutils_q.ok .out/JSTest/memoize_q.ok .out/JSTest/observable_q.ok .out/JSTest/oweb_q.ok .out/JSTest/psarray_q.ok .out/JSTest/random_q.ok .out/JSTest/serialize_q.ok .out/JSTest/splitter_q.ok .out/JSTest/view_q.ok  | 
+	$(call _traceRecord,B,$@ 'Alias$[default$]')
+	@true
+	$(call _traceRecord,E,$@ $^ $|)
+	$(if $(and $(minionOutputCache),$(filter default,$(or $(MAKECMDGOALS),default))),@../build/ocache.sh --stats .out/ocache.log)
+
+
+ 
+.out/JSScan/anim_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[anim_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep anim_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/anim_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/anim_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep anim_q.js -MF .out/JSScan/anim_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/anim_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/anim_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep anim_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/anim_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/anim_q.d: .out/FORCE
+endif
+-include .out/JSScan/anim_q.d
+
+ 
+.out/JSScan/button_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[button_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep button_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/button_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/button_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep button_q.js -MF .out/JSScan/button_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/button_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/button_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep button_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/button_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/button_q.d: .out/FORCE
+endif
+-include .out/JSScan/button_q.d
+
+ 
+.out/JSScan/class_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[class_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep class_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/class_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/class_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep class_q.js -MF .out/JSScan/class_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/class_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/class_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep class_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/class_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/class_q.d: .out/FORCE
+endif
+-include .out/JSScan/class_q.d
+
+ 
+.out/JSScan/eventutils_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[eventutils_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep eventutils_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/eventutils_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/eventutils_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep eventutils_q.js -MF .out/JSScan/eventutils_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/eventutils_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/eventutils_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep eventutils_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/eventutils_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/eventutils_q.d: .out/FORCE
+endif
+-include .out/JSScan/eventutils_q.d
+
+ 
+.out/JSScan/memoize_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[memoize_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep memoize_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/memoize_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/memoize_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep memoize_q.js -MF .out/JSScan/memoize_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/memoize_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/memoize_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep memoize_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/memoize_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/memoize_q.d: .out/FORCE
+endif
+-include .out/JSScan/memoize_q.d
+
+ 
+.out/JSScan/observable_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[observable_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep observable_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/observable_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/observable_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep observable_q.js -MF .out/JSScan/observable_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/observable_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/observable_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep observable_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/observable_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/observable_q.d: .out/FORCE
+endif
+-include .out/JSScan/observable_q.d
+
+ 
+.out/JSScan/oweb_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[oweb_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep oweb_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/oweb_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/oweb_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep oweb_q.js -MF .out/JSScan/oweb_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/oweb_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/oweb_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep oweb_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/oweb_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/oweb_q.d: .out/FORCE
+endif
+-include .out/JSScan/oweb_q.d
+
+ 
+.out/JSScan/psarray_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[psarray_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep psarray_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/psarray_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/psarray_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep psarray_q.js -MF .out/JSScan/psarray_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/psarray_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/psarray_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep psarray_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/psarray_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/psarray_q.d: .out/FORCE
+endif
+-include .out/JSScan/psarray_q.d
+
+ 
+.out/JSScan/random_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[random_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep random_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/random_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/random_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep random_q.js -MF .out/JSScan/random_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/random_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/random_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep random_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/random_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/random_q.d: .out/FORCE
+endif
+-include .out/JSScan/random_q.d
+
+ 
+.out/JSScan/serialize_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[serialize_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep serialize_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/serialize_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/serialize_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep serialize_q.js -MF .out/JSScan/serialize_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/serialize_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/serialize_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep serialize_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/serialize_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/serialize_q.d: .out/FORCE
+endif
+-include .out/JSScan/serialize_q.d
+
+ 
+.out/JSScan/splitter_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[splitter_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep splitter_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/splitter_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/splitter_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep splitter_q.js -MF .out/JSScan/splitter_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/splitter_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/splitter_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep splitter_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/splitter_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/splitter_q.d: .out/FORCE
+endif
+-include .out/JSScan/splitter_q.d
+
+ 
+.out/JSScan/view_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[view_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.`  ../build-js/.out/exports/jsdep view_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/view_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/view_q.js.vv
+	NODE_PATH='.'  ../build-js/.out/exports/jsdep view_q.js -MF .out/JSScan/view_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/view_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/view_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  ../build-js/.out/exports/jsdep view_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/view_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/view_q.d: .out/FORCE
+endif
+-include .out/JSScan/view_q.d
+
+ 
+.out/JSTest/anim_q.ok : anim_q.js .out/JSScan/anim_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[anim_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  anim_q.js!ntouch !@.ok.' > .out/JSTest/anim_q.js.vv
+	NODE_PATH='.'  node  anim_q.js
+	touch .out/JSTest/anim_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/anim_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  anim_q.js!ntouch !@.ok."
+  .out/JSTest/anim_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/button_q.ok : button_q.js .out/JSScan/button_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[button_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  button_q.js!ntouch !@.ok.' > .out/JSTest/button_q.js.vv
+	NODE_PATH='.'  node  button_q.js
+	touch .out/JSTest/button_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/button_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  button_q.js!ntouch !@.ok."
+  .out/JSTest/button_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/class_q.ok : class_q.js .out/JSScan/class_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[class_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  class_q.js!ntouch !@.ok.' > .out/JSTest/class_q.js.vv
+	NODE_PATH='.'  node  class_q.js
+	touch .out/JSTest/class_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/class_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  class_q.js!ntouch !@.ok."
+  .out/JSTest/class_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/eventutils_q.ok : eventutils_q.js .out/JSScan/eventutils_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[eventutils_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  eventutils_q.js!ntouch !@.ok.' > .out/JSTest/eventutils_q.js.vv
+	NODE_PATH='.'  node  eventutils_q.js
+	touch .out/JSTest/eventutils_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/eventutils_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  eventutils_q.js!ntouch !@.ok."
+  .out/JSTest/eventutils_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/memoize_q.ok : memoize_q.js .out/JSScan/memoize_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[memoize_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  memoize_q.js!ntouch !@.ok.' > .out/JSTest/memoize_q.js.vv
+	NODE_PATH='.'  node  memoize_q.js
+	touch .out/JSTest/memoize_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/memoize_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  memoize_q.js!ntouch !@.ok."
+  .out/JSTest/memoize_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/observable_q.ok : observable_q.js .out/JSScan/observable_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[observable_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  observable_q.js!ntouch !@.ok.' > .out/JSTest/observable_q.js.vv
+	NODE_PATH='.'  node  observable_q.js
+	touch .out/JSTest/observable_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/observable_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  observable_q.js!ntouch !@.ok."
+  .out/JSTest/observable_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/oweb_q.ok : oweb_q.js .out/JSScan/oweb_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[oweb_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  oweb_q.js!ntouch !@.ok.' > .out/JSTest/oweb_q.js.vv
+	NODE_PATH='.'  node  oweb_q.js
+	touch .out/JSTest/oweb_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/oweb_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  oweb_q.js!ntouch !@.ok."
+  .out/JSTest/oweb_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/psarray_q.ok : psarray_q.js .out/JSScan/psarray_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[psarray_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  psarray_q.js!ntouch !@.ok.' > .out/JSTest/psarray_q.js.vv
+	NODE_PATH='.'  node  psarray_q.js
+	touch .out/JSTest/psarray_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/psarray_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  psarray_q.js!ntouch !@.ok."
+  .out/JSTest/psarray_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/random_q.ok : random_q.js .out/JSScan/random_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[random_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  random_q.js!ntouch !@.ok.' > .out/JSTest/random_q.js.vv
+	NODE_PATH='.'  node  random_q.js
+	touch .out/JSTest/random_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/random_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  random_q.js!ntouch !@.ok."
+  .out/JSTest/random_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/serialize_q.ok : serialize_q.js .out/JSScan/serialize_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[serialize_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  serialize_q.js!ntouch !@.ok.' > .out/JSTest/serialize_q.js.vv
+	NODE_PATH='.'  node  serialize_q.js
+	touch .out/JSTest/serialize_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/serialize_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  serialize_q.js!ntouch !@.ok."
+  .out/JSTest/serialize_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/splitter_q.ok : splitter_q.js .out/JSScan/splitter_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[splitter_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  splitter_q.js!ntouch !@.ok.' > .out/JSTest/splitter_q.js.vv
+	NODE_PATH='.'  node  splitter_q.js
+	touch .out/JSTest/splitter_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/splitter_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  splitter_q.js!ntouch !@.ok."
+  .out/JSTest/splitter_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/view_q.ok : view_q.js .out/JSScan/view_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[view_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.`  node  view_q.js!ntouch !@.ok.' > .out/JSTest/view_q.js.vv
+	NODE_PATH='.'  node  view_q.js
+	touch .out/JSTest/view_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/view_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.`  node  view_q.js!ntouch !@.ok."
+  .out/JSTest/view_q.ok: .out/FORCE
+endif
+
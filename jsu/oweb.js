@@ -81,7 +81,10 @@ WebOb.onOff = function (isOn) {
 var OWeb = Class.subclass();
 
 
-OWeb.initialize = function (xhttp, scheduler, uri) {
+// options.stream => request streaming responses (falls back to polling
+//    when the server does not support them).  See oweb.txt.
+//
+OWeb.initialize = function (xhttp, scheduler, uri, options) {
     this.xhttp = xhttp;
     this.scheduler = scheduler;
     this.uri = uri;
@@ -89,6 +92,9 @@ OWeb.initialize = function (xhttp, scheduler, uri) {
     this.cancel = null;
     this.sentBody = '';
     this.sentRemoves = [];
+    this.useStream = !!(options && options.stream);
+    this.sentStream = false;   // true => pending request asked for a stream
+    this.streamPos = 0;        // length of stream data already processed
 
     // uid -> WebObs [currently subscribed ones]
     this.obs = Object.create(null);
@@ -163,7 +169,8 @@ OWeb.updateCB = function () {
     var body = JSON.stringify({
         id: this.pollID,
         add: (add.length ? add : undefined),
-        remove: (remove.length ? remove : undefined)
+        remove: (remove.length ? remove : undefined),
+        stream: (this.useStream || undefined)
     });
 
     if (this.cancel) {
@@ -171,6 +178,10 @@ OWeb.updateCB = function () {
             // nothing to change
             return;
         }
+        if (this.sentStream && add.length == 0 && remove.length == 0) {
+            // the stream will deliver changes as they occur
+            return;
+        }
 
         // cancel pending request
         this.cancel();
@@ -179,20 +190,71 @@ OWeb.updateCB = function () {
 
     this.sentBody = body;
     this.sentRemove = remove;
+    this.sentStream = this.useStream;
+    this.streamPos = 0;
 
     if (this.pollID === undefined && add.length == 0) {
         // nothing to wait on, nothing to remove
         return;
     }
 
-    this.cancel = this.xhttp({ method: 'POLL', uri: this.uri, body: body },
-                             OWeb_handleResponse.bind(this));
+    var req = { method: 'POLL', uri: this.uri, body: body };
+    if (this.useStream) {
+        req.onData = OWeb_handleData.bind(this);
+    }
+    this.cancel = this.xhttp(req, OWeb_handleResponse.bind(this));
 };
 
 
-function OWeb_handleResponse(error, data) {
+function isStream(xhr) {
+    var type = xhr && xhr.getResponseHeader('Content-Type');
+    return /^application\/x-oweb-stream/.test(type || '');
+}
+
+
+// Process newly-received frames of a stream response.  Each complete
+// frame is terminated by a newline.
+//
+function OWeb_handleData(text, xhr) {
+    if (! isStream(xhr)) {
+        return;
+    }
+    var end = text.lastIndexOf('\n') + 1;
+    if (end > this.streamPos) {
+        var frames = text.substring(this.streamPos, end).split('\n');
+        this.streamPos = end;
+        frames.forEach(function (frame) {
+            if (frame) {
+                OWeb_handleFrame.call(this, JSON.parse(frame));
+            }
+        }, this);
+    }
+}
+
+
+function OWeb_handleResponse(error, data, xhr) {
     this.cancel = null;
 
+    if (error == 410) {
+        // The server no longer knows our predecessor ID, so start over.
+        this.pollID = undefined;
+        this.values = Object.create(null);
+        this.update();
+        return;
+    }
+
+    if (! error && isStream(xhr)) {
+        // stream ended; start another
+        OWeb_handleData.call(this, data, xhr);
+        this.update();
+        return;
+    }
+
+    if (! error) {
+        // the server does not support streaming
+        this.useStream = false;
+    }
+
     var resp = data && JSON.parse(data);
 
     // parse response and notify corresponding objects
@@ -200,6 +262,15 @@ function OWeb_handleResponse(error, data) {
         // TODO
         return;
     }
+
+    OWeb_handleFrame.call(this, resp);
+    this.update();
+}
+
+
+// Process one response: a POLL response or one frame of a stream.
+//
+function OWeb_handleFrame(resp) {
     var respValues = resp.values || Object.create(null);
 
     // Process response
@@ -209,6 +280,7 @@ function OWeb_handleResponse(error, data) {
     this.sentRemove.forEach(function (name) {
         delete this.values[name];
     }.bind(this));
+    this.sentRemove = [];
 
     for (var name in respValues) {
         this.values[name] = respValues[name];
@@ -220,8 +292,6 @@ function OWeb_handleResponse(error, data) {
             wob.invalidate();
         }
     }
-
-    this.update();
 }
 
 
@@ -173,3 +173,75 @@ eq(v, 'hello');
 
 
 // TODO: Clarify behavior on HTTP errors.
+
+
+//----------------------------------------------------------------
+// Streaming
+
+var streamHeaders = { 'Content-Type': 'application/x-oweb-stream' };
+
+oweb = OWeb.create(xhttp, scheduler, "/observe", {stream: true});
+a = oweb.observe('A');
+b = oweb.observe('B');
+observer.valid = true;
+observer.activate(a);
+scheduler.flush();
+
+// Assertion: stream is requested
+
+eq(pending.length, 1);
+eq(JSON.parse(pending[0].req.body), {add:["A"], stream:true});
+
+// Assertion: each complete frame is processed as it arrives.
+
+var xhrStream = pending[0];
+var text = '{"id":1,"values":{"A":1}}\n{"id":2,"values"';
+xhrStream.progress(text, streamHeaders);
+eq(observer.valid, false);
+eq(a.getValue(), 1);
+eq(oweb.pollID, 1);
+
+text += ':{"A":2}}\n';
+xhrStream.progress(text);
+eq(a.getValue(), 2);
+eq(oweb.pollID, 2);
+
+// Assertion: new frames do not restart the stream.
+
+scheduler.flush();
+eq(pending, [xhrStream]);
+
+// Assertion: subscribing to a new name cancels the stream and starts
+// another, naming the last frame as its predecessor.
+
+observer.activate(b);
+scheduler.flush();
+eq(xhrStream.readyState, 5);
+eq(pending.length, 1);
+eq(JSON.parse(pending[0].req.body), {id:2, add:["B"], stream:true});
+
+// Assertion: when the stream ends, a new one is started.
+
+xhrStream = pending[0];
+xhrStream.respond(200, '{"id":3,"values":{"B":5}}\n', streamHeaders);
+eq(b.getValue(), 5);
+scheduler.flush();
+eq(pending.length, 1);
+eq(JSON.parse(pending[0].req.body), {id:3, stream:true});
+
+// Assertion: 410 => start over, adding all observed names.
+
+pending[0].respond(410, '');
+scheduler.flush();
+eq(pending.length, 1);
+eq(JSON.parse(pending[0].req.body), {add:["A","B"], stream:true});
+
+// Assertion: a server that does not stream gets POLL requests thereafter.
+
+pending[0].respond(200, '{"id":7,"values":{"A":3,"B":4}}',
+                   { 'Content-Type': 'application/json' });
+eq(a.getValue(), 3);
+eq(b.getValue(), 4);
+scheduler.flush();
+eq(pending.length, 1);
+eq(JSON.parse(pending[0].req.body), {id:7});
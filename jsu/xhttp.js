@@ -27,6 +27,9 @@ function makeQuery(query) {
 //       request.method = HTTP method    [default = 'GET']
 //       request.body = body to submit   [default = '']
 //       request.query = name/value pairs to encode as a query string
+//       request.onData = function to be called as the response body
+//          arrives: onData(text, xhr), where `text` is the response
+//          body received so far.  It is not called after cancellation.
 //
 //    cb = completion callback [null => still asynch, but no notification]
 //         cb(error, data, xhr):
@@ -59,6 +62,8 @@ function xhttp(req, cb) {
     xhr.onreadystatechange = function () {
         if (xhr.readyState == 4) {
             respond();
+        } else if (xhr.readyState == 3 && cb && req.onData) {
+            req.onData(xhr.responseText, xhr);
         }
     };
 
@@ -75,7 +80,10 @@ function xhttp(req, cb) {
         respond();
     }
 
-    return xhr.abort.bind(xhr);
+    return function () {
+        cb = null;
+        xhr.abort();
+    };
 }
 
 xhttp.makeQuery = makeQuery;
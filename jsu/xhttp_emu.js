@@ -2,7 +2,9 @@
 
 var makeQuery = require('xhttp.js').makeQuery;
 
-// pending xhttp instances: call x.respond(code, data) to complete them.
+// pending xhttp instances: call x.respond(code, data, headers) to complete
+// them.  Call x.progress(data, headers) to deliver a partial response body
+// (`data` is the entire body received so far).
 var pending = [];
 
 
@@ -31,8 +33,30 @@ function xhttp(req, cb) {
         }
     };
 
-    me.respond = function (code, data) {
+    me.responseHeaders = {};
+    me.getResponseHeader = function (name) {
+        var value = me.responseHeaders[name.toLowerCase()];
+        return value === undefined ? null : value;
+    };
+
+    function setHeaders(headers) {
+        for (var name in headers || {}) {
+            me.responseHeaders[name.toLowerCase()] = headers[name];
+        }
+    }
+
+    me.progress = function (data, headers) {
+        me.readyState = 3;
+        setHeaders(headers);
+        me.responseText = data;
+        if (req.onData) {
+            req.onData(data, me);
+        }
+    };
+
+    me.respond = function (code, data, headers) {
         finish(4);
+        setHeaders(headers);
         var err = (code >= 200 && code < 300) ? false : code;
         me.responseText = data;
         me.cb(err, (err ? null : data), me);
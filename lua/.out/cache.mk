@@ -0,0 +1,777 @@
+_cachedIDs = Alias(default) CC(../opensource/lua-5.2.3/src/lapi.c) CC(../opensource/lua-5.2.3/src/lauxlib.c) CC(../opensource/lua-5.2.3/src/lbaselib.c) CC(../opensource/lua-5.2.3/src/lbitlib.c) CC(../opensource/lua-5.2.3/src/lcode.c) CC(../opensource/lua-5.2.3/src/lcorolib.c) CC(../opensource/lua-5.2.3/src/lctype.c) CC(../opensource/lua-5.2.3/src/ldblib.c) CC(../opensource/lua-5.2.3/src/ldebug.c) CC(../opensource/lua-5.2.3/src/ldo.c) CC(../opensource/lua-5.2.3/src/ldump.c) CC(../opensource/lua-5.2.3/src/lfunc.c) CC(../opensource/lua-5.2.3/src/lgc.c) CC(../opensource/lua-5.2.3/src/linit.c) CC(../opensource/lua-5.2.3/src/liolib.c) CC(../opensource/lua-5.2.3/src/llex.c) CC(../opensource/lua-5.2.3/src/lmathlib.c) CC(../opensource/lua-5.2.3/src/lmem.c) CC(../opensource/lua-5.2.3/src/loadlib.c) CC(../opensource/lua-5.2.3/src/lobject.c) CC(../opensource/lua-5.2.3/src/lopcodes.c) CC(../opensource/lua-5.2.3/src/loslib.c) CC(../opensource/lua-5.2.3/src/lparser.c) CC(../opensource/lua-5.2.3/src/lstate.c) CC(../opensource/lua-5.2.3/src/lstring.c) CC(../opensource/lua-5.2.3/src/lstrlib.c) CC(../opensource/lua-5.2.3/src/ltable.c) CC(../opensource/lua-5.2.3/src/ltablib.c) CC(../opensource/lua-5.2.3/src/ltm.c) CC(../opensource/lua-5.2.3/src/lua.c) CC(../opensource/lua-5.2.3/src/luac.c) CC(../opensource/lua-5.2.3/src/lundump.c) CC(../opensource/lua-5.2.3/src/lvm.c) CC(../opensource/lua-5.2.3/src/lzio.c) CC(lalloc.c) CC(lalloc_q.c) CExe(lalloc_q.c) CExe(luac) CTest(lalloc_q.c) Copy(../opensource/lua-5.2.3/src/lauxlib.h,dir:.out/exports/src/) Copy(../opensource/lua-5.2.3/src/lua.h,dir:.out/exports/src/) Copy(../opensource/lua-5.2.3/src/luaconf.h,dir:.out/exports/src/) Copy(../opensource/lua-5.2.3/src/lualib.h,dir:.out/exports/src/) Copy(CExe(lua),dir:.out/exports/bin/) Copy(CExe(luac),dir:.out/exports/bin/) Copy(Lib(liblua),dir:.out/exports/lib/) Copy(lalloc.h,dir:.out/exports/src/) Lib(liblua) Ship(exports/bin,exports/lib,exports/src)
+
+.PHONY: default
+default : .out/CTest/lalloc_q.ok .out/Ship_@1,exports@Dlib,exports@Dsrc/exports/bin  | 
+	$(call _traceRecord,B,$@ 'Alias$[default$]')
+	@true
+	$(call _traceRecord,E,$@ $^ $|)
+	$(if $(and $(minionOutputCache),$(filter default,$(or $(MAKECMDGOALS),default))),@../build/ocache.sh --stats .out/ocache.log)
+
+
+_Alias(default)_needs = CExe(lua)
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lapi.o : ../opensource/lua-5.2.3/src/lapi.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lapi.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lapi.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lapi.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lapi.o ../opensource/lua-5.2.3/src/lapi.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lapi.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lapi.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lapi.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lapi.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lapi.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lapi.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lauxlib.o : ../opensource/lua-5.2.3/src/lauxlib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lauxlib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lauxlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lauxlib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lauxlib.o ../opensource/lua-5.2.3/src/lauxlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lauxlib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lauxlib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lauxlib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lauxlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lauxlib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lauxlib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lbaselib.o : ../opensource/lua-5.2.3/src/lbaselib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lbaselib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lbaselib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lbaselib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lbaselib.o ../opensource/lua-5.2.3/src/lbaselib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lbaselib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lbaselib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lbaselib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lbaselib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lbaselib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lbaselib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lbitlib.o : ../opensource/lua-5.2.3/src/lbitlib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lbitlib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lbitlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lbitlib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lbitlib.o ../opensource/lua-5.2.3/src/lbitlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lbitlib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lbitlib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lbitlib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lbitlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lbitlib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lbitlib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lcode.o : ../opensource/lua-5.2.3/src/lcode.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lcode.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lcode.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lcode.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lcode.o ../opensource/lua-5.2.3/src/lcode.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lcode.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lcode.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lcode.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lcode.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lcode.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lcode.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lcorolib.o : ../opensource/lua-5.2.3/src/lcorolib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lcorolib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lcorolib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lcorolib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lcorolib.o ../opensource/lua-5.2.3/src/lcorolib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lcorolib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lcorolib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lcorolib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lcorolib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lcorolib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lcorolib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lctype.o : ../opensource/lua-5.2.3/src/lctype.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lctype.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lctype.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lctype.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lctype.o ../opensource/lua-5.2.3/src/lctype.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lctype.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lctype.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lctype.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lctype.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lctype.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lctype.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ldblib.o : ../opensource/lua-5.2.3/src/ldblib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ldblib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldblib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ldblib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ldblib.o ../opensource/lua-5.2.3/src/ldblib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ldblib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ldblib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ldblib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldblib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ldblib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ldblib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ldebug.o : ../opensource/lua-5.2.3/src/ldebug.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ldebug.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldebug.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ldebug.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ldebug.o ../opensource/lua-5.2.3/src/ldebug.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ldebug.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ldebug.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ldebug.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldebug.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ldebug.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ldebug.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ldo.o : ../opensource/lua-5.2.3/src/ldo.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ldo.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldo.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ldo.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ldo.o ../opensource/lua-5.2.3/src/ldo.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ldo.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ldo.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ldo.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldo.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ldo.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ldo.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ldump.o : ../opensource/lua-5.2.3/src/ldump.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ldump.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldump.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ldump.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ldump.o ../opensource/lua-5.2.3/src/ldump.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ldump.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ldump.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ldump.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ldump.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ldump.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ldump.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lfunc.o : ../opensource/lua-5.2.3/src/lfunc.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lfunc.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lfunc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lfunc.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lfunc.o ../opensource/lua-5.2.3/src/lfunc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lfunc.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lfunc.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lfunc.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lfunc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lfunc.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lfunc.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lgc.o : ../opensource/lua-5.2.3/src/lgc.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lgc.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lgc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lgc.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lgc.o ../opensource/lua-5.2.3/src/lgc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lgc.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lgc.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lgc.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lgc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lgc.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lgc.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/linit.o : ../opensource/lua-5.2.3/src/linit.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/linit.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/linit.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/linit.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/linit.o ../opensource/lua-5.2.3/src/linit.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/linit.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/linit.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/linit.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/linit.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/linit.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/linit.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/liolib.o : ../opensource/lua-5.2.3/src/liolib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/liolib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/liolib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/liolib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/liolib.o ../opensource/lua-5.2.3/src/liolib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/liolib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/liolib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/liolib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/liolib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/liolib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/liolib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/llex.o : ../opensource/lua-5.2.3/src/llex.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/llex.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/llex.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/llex.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/llex.o ../opensource/lua-5.2.3/src/llex.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/llex.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/llex.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/llex.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/llex.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/llex.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/llex.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lmathlib.o : ../opensource/lua-5.2.3/src/lmathlib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lmathlib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lmathlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lmathlib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lmathlib.o ../opensource/lua-5.2.3/src/lmathlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lmathlib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lmathlib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lmathlib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lmathlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lmathlib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lmathlib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lmem.o : ../opensource/lua-5.2.3/src/lmem.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lmem.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lmem.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lmem.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lmem.o ../opensource/lua-5.2.3/src/lmem.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lmem.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lmem.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lmem.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lmem.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lmem.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lmem.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/loadlib.o : ../opensource/lua-5.2.3/src/loadlib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/loadlib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/loadlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/loadlib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/loadlib.o ../opensource/lua-5.2.3/src/loadlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/loadlib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/loadlib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/loadlib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/loadlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/loadlib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/loadlib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lobject.o : ../opensource/lua-5.2.3/src/lobject.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lobject.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lobject.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lobject.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lobject.o ../opensource/lua-5.2.3/src/lobject.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lobject.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lobject.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lobject.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lobject.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lobject.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lobject.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lopcodes.o : ../opensource/lua-5.2.3/src/lopcodes.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lopcodes.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lopcodes.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lopcodes.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lopcodes.o ../opensource/lua-5.2.3/src/lopcodes.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lopcodes.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lopcodes.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lopcodes.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lopcodes.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lopcodes.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lopcodes.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/loslib.o : ../opensource/lua-5.2.3/src/loslib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/loslib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/loslib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/loslib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/loslib.o ../opensource/lua-5.2.3/src/loslib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/loslib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/loslib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/loslib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/loslib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/loslib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/loslib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lparser.o : ../opensource/lua-5.2.3/src/lparser.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lparser.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lparser.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lparser.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lparser.o ../opensource/lua-5.2.3/src/lparser.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lparser.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lparser.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lparser.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lparser.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lparser.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lparser.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lstate.o : ../opensource/lua-5.2.3/src/lstate.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lstate.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lstate.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lstate.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lstate.o ../opensource/lua-5.2.3/src/lstate.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lstate.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lstate.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lstate.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lstate.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lstate.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lstate.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lstring.o : ../opensource/lua-5.2.3/src/lstring.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lstring.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lstring.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lstring.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lstring.o ../opensource/lua-5.2.3/src/lstring.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lstring.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lstring.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lstring.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lstring.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lstring.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lstring.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lstrlib.o : ../opensource/lua-5.2.3/src/lstrlib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lstrlib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lstrlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lstrlib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lstrlib.o ../opensource/lua-5.2.3/src/lstrlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lstrlib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lstrlib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lstrlib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lstrlib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lstrlib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lstrlib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ltable.o : ../opensource/lua-5.2.3/src/ltable.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ltable.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ltable.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ltable.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ltable.o ../opensource/lua-5.2.3/src/ltable.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ltable.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ltable.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ltable.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ltable.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ltable.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ltable.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ltablib.o : ../opensource/lua-5.2.3/src/ltablib.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ltablib.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ltablib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ltablib.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ltablib.o ../opensource/lua-5.2.3/src/ltablib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ltablib.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ltablib.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ltablib.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ltablib.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ltablib.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ltablib.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/ltm.o : ../opensource/lua-5.2.3/src/ltm.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/ltm.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/ltm.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/ltm.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/ltm.o ../opensource/lua-5.2.3/src/ltm.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/ltm.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/ltm.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/ltm.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/ltm.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/ltm.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/ltm.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lua.o : ../opensource/lua-5.2.3/src/lua.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lua.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lua.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lua.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lua.o ../opensource/lua-5.2.3/src/lua.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lua.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lua.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lua.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lua.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lua.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lua.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/luac.o : ../opensource/lua-5.2.3/src/luac.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/luac.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/luac.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/luac.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/luac.o ../opensource/lua-5.2.3/src/luac.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/luac.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/luac.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/luac.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/luac.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/luac.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/luac.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lundump.o : ../opensource/lua-5.2.3/src/lundump.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lundump.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lundump.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lundump.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lundump.o ../opensource/lua-5.2.3/src/lundump.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lundump.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lundump.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lundump.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lundump.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lundump.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lundump.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lvm.o : ../opensource/lua-5.2.3/src/lvm.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lvm.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lvm.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lvm.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lvm.o ../opensource/lua-5.2.3/src/lvm.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lvm.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lvm.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lvm.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lvm.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lvm.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lvm.c)_needs = 
+ 
+.out/CC/_../opensource/lua-5.2.3/src/lzio.o : ../opensource/lua-5.2.3/src/lzio.c  | 
+	$(call _traceRecord,B,$@ 'CC$[../opensource/lua-5.2.3/src/lzio.c$]')
+	@mkdir -p .out/CC/_../opensource/lua-5.2.3/src/
+	@echo '_vv=.gcc -c -o !@.o ../opensource/lua-5.2.3/src/lzio.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d.' > .out/CC/_../opensource/lua-5.2.3/src/lzio.c.vv
+	gcc -c -o .out/CC/_../opensource/lua-5.2.3/src/lzio.o ../opensource/lua-5.2.3/src/lzio.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF .out/CC/_../opensource/lua-5.2.3/src/lzio.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/_../opensource/lua-5.2.3/src/lzio.c.d
+_vv =
+-include .out/CC/_../opensource/lua-5.2.3/src/lzio.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o ../opensource/lua-5.2.3/src/lzio.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN   -MMD -MP -MF !@.c.d."
+  .out/CC/_../opensource/lua-5.2.3/src/lzio.o: .out/FORCE
+endif
+
+_CC(../opensource/lua-5.2.3/src/lzio.c)_needs = 
+ 
+.out/CC/lalloc.o : lalloc.c  | 
+	$(call _traceRecord,B,$@ 'CC$[lalloc.c$]')
+	@mkdir -p .out/CC/
+	@echo '_vv=.gcc -c -o !@.o lalloc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN  -I../opensource/lua-5.2.3/src -MMD -MP -MF !@.c.d.' > .out/CC/lalloc.c.vv
+	gcc -c -o .out/CC/lalloc.o lalloc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN  -I../opensource/lua-5.2.3/src -MMD -MP -MF .out/CC/lalloc.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/lalloc.c.d
+_vv =
+-include .out/CC/lalloc.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o lalloc.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN  -I../opensource/lua-5.2.3/src -MMD -MP -MF !@.c.d."
+  .out/CC/lalloc.o: .out/FORCE
+endif
+
+_CC(lalloc.c)_needs = 
+ 
+.out/CC/lalloc_q.o : lalloc_q.c  | 
+	$(call _traceRecord,B,$@ 'CC$[lalloc_q.c$]')
+	@mkdir -p .out/CC/
+	@echo '_vv=.gcc -c -o !@.o lalloc_q.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN  -I../opensource/lua-5.2.3/src -MMD -MP -MF !@.c.d.' > .out/CC/lalloc_q.c.vv
+	gcc -c -o .out/CC/lalloc_q.o lalloc_q.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN  -I../opensource/lua-5.2.3/src -MMD -MP -MF .out/CC/lalloc_q.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/CC/lalloc_q.c.d
+_vv =
+-include .out/CC/lalloc_q.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o lalloc_q.c -O2 -Werror -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -DLUA_USE_POSIX -D_GNU_SOURCE -DLUA_USE_DLOPEN  -I../opensource/lua-5.2.3/src -MMD -MP -MF !@.c.d."
+  .out/CC/lalloc_q.o: .out/FORCE
+endif
+
+_CC(lalloc_q.c)_needs = 
+ 
+.out/CExe/lalloc_q : .out/CC/lalloc_q.o .out/Lib/liblua.lib  | 
+	$(call _traceRecord,B,$@ 'CExe$[lalloc_q.c$]')
+	@mkdir -p .out/CExe/
+	@echo '_vv=.gcc -o !@ .out/CC/lalloc_q.o .out/Lib/liblua.lib -lm -ldl -Wl,--export-dynamic .' > .out/CExe/lalloc_q.c.vv
+	gcc -o .out/CExe/lalloc_q .out/CC/lalloc_q.o .out/Lib/liblua.lib -lm -ldl -Wl,--export-dynamic 
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/CExe/lalloc_q.c.vv
+ifneq "$(_vv)" ".gcc -o !@ .out/CC/lalloc_q.o .out/Lib/liblua.lib -lm -ldl -Wl,--export-dynamic ."
+  .out/CExe/lalloc_q: .out/FORCE
+endif
+
+_CExe(lalloc_q.c)_needs = 
+ 
+.out/CExe/luac : .out/CC/_../opensource/lua-5.2.3/src/luac.o .out/Lib/liblua.lib  | 
+	$(call _traceRecord,B,$@ 'CExe$[luac$]')
+	@mkdir -p .out/CExe/
+	@echo '_vv=.gcc -o !@ .out/CC/_../opensource/lua-5.2.3/src/luac.o .out/Lib/liblua.lib -lm -ldl -Wl,--export-dynamic .' > .out/CExe/luac.vv
+	gcc -o .out/CExe/luac .out/CC/_../opensource/lua-5.2.3/src/luac.o .out/Lib/liblua.lib -lm -ldl -Wl,--export-dynamic 
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/CExe/luac.vv
+ifneq "$(_vv)" ".gcc -o !@ .out/CC/_../opensource/lua-5.2.3/src/luac.o .out/Lib/liblua.lib -lm -ldl -Wl,--export-dynamic ."
+  .out/CExe/luac: .out/FORCE
+endif
+
+_CExe(luac)_needs = 
+ 
+.out/CTest/lalloc_q.ok : .out/CExe/lalloc_q  | 
+	$(call _traceRecord,B,$@ 'CTest$[lalloc_q.c$]')
+	@mkdir -p .out/CTest/
+	@echo '_vv=. .out/CExe/lalloc_q  !ntouch !@.ok.' > .out/CTest/lalloc_q.c.vv
+	 .out/CExe/lalloc_q  
+	touch .out/CTest/lalloc_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/CTest/lalloc_q.c.vv
+ifneq "$(_vv)" ". .out/CExe/lalloc_q  !ntouch !@.ok."
+  .out/CTest/lalloc_q.ok: .out/FORCE
+endif
+
+_CTest(lalloc_q.c)_needs = 
+
+.out/exports/src/lauxlib.h : ../opensource/lua-5.2.3/src/lauxlib.h  | 
+	$(call _traceRecord,B,$@ 'Copy$[../opensource/lua-5.2.3/src/lauxlib.h$;dir:.out/exports/src/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/ .out/exports/src/
+	@echo '_vv=.cp ../opensource/lua-5.2.3/src/lauxlib.h !@.h.' > .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/lauxlib.h.vv
+	cp ../opensource/lua-5.2.3/src/lauxlib.h .out/exports/src/lauxlib.h
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/lauxlib.h.vv
+ifneq "$(_vv)" ".cp ../opensource/lua-5.2.3/src/lauxlib.h !@.h."
+  .out/exports/src/lauxlib.h: .out/FORCE
+endif
+
+_Copy(../opensource/lua-5.2.3/src/lauxlib.h,dir:.out/exports/src/)_needs = 
+ 
+.out/exports/src/lua.h : ../opensource/lua-5.2.3/src/lua.h  | 
+	$(call _traceRecord,B,$@ 'Copy$[../opensource/lua-5.2.3/src/lua.h$;dir:.out/exports/src/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/ .out/exports/src/
+	@echo '_vv=.cp ../opensource/lua-5.2.3/src/lua.h !@.h.' > .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/lua.h.vv
+	cp ../opensource/lua-5.2.3/src/lua.h .out/exports/src/lua.h
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/lua.h.vv
+ifneq "$(_vv)" ".cp ../opensource/lua-5.2.3/src/lua.h !@.h."
+  .out/exports/src/lua.h: .out/FORCE
+endif
+
+_Copy(../opensource/lua-5.2.3/src/lua.h,dir:.out/exports/src/)_needs = 
+ 
+.out/exports/src/luaconf.h : ../opensource/lua-5.2.3/src/luaconf.h  | 
+	$(call _traceRecord,B,$@ 'Copy$[../opensource/lua-5.2.3/src/luaconf.h$;dir:.out/exports/src/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/ .out/exports/src/
+	@echo '_vv=.cp ../opensource/lua-5.2.3/src/luaconf.h !@.h.' > .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/luaconf.h.vv
+	cp ../opensource/lua-5.2.3/src/luaconf.h .out/exports/src/luaconf.h
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/luaconf.h.vv
+ifneq "$(_vv)" ".cp ../opensource/lua-5.2.3/src/luaconf.h !@.h."
+  .out/exports/src/luaconf.h: .out/FORCE
+endif
+
+_Copy(../opensource/lua-5.2.3/src/luaconf.h,dir:.out/exports/src/)_needs = 
+ 
+.out/exports/src/lualib.h : ../opensource/lua-5.2.3/src/lualib.h  | 
+	$(call _traceRecord,B,$@ 'Copy$[../opensource/lua-5.2.3/src/lualib.h$;dir:.out/exports/src/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/ .out/exports/src/
+	@echo '_vv=.cp ../opensource/lua-5.2.3/src/lualib.h !@.h.' > .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/lualib.h.vv
+	cp ../opensource/lua-5.2.3/src/lualib.h .out/exports/src/lualib.h
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/_../opensource/lua-5.2.3/src/lualib.h.vv
+ifneq "$(_vv)" ".cp ../opensource/lua-5.2.3/src/lualib.h !@.h."
+  .out/exports/src/lualib.h: .out/FORCE
+endif
+
+_Copy(../opensource/lua-5.2.3/src/lualib.h,dir:.out/exports/src/)_needs = 
+ 
+.out/exports/bin/lua : .out/CExe/lua  | 
+	$(call _traceRecord,B,$@ 'Copy$[CExe$[lua$]$;dir:.out/exports/bin/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dbin@D_CExe/ .out/exports/bin/
+	@echo '_vv=.cp .out/CExe/lua !@.' > .out/Copy_@1,dir@C.out@Dexports@Dbin@D_CExe/lua.vv
+	cp .out/CExe/lua .out/exports/bin/lua
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dbin@D_CExe/lua.vv
+ifneq "$(_vv)" ".cp .out/CExe/lua !@."
+  .out/exports/bin/lua: .out/FORCE
+endif
+
+_Copy(CExe(lua),dir:.out/exports/bin/)_needs = CExe(lua)
+ 
+.out/exports/bin/luac : .out/CExe/luac  | 
+	$(call _traceRecord,B,$@ 'Copy$[CExe$[luac$]$;dir:.out/exports/bin/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dbin@D_CExe/ .out/exports/bin/
+	@echo '_vv=.cp .out/CExe/luac !@.' > .out/Copy_@1,dir@C.out@Dexports@Dbin@D_CExe/luac.vv
+	cp .out/CExe/luac .out/exports/bin/luac
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dbin@D_CExe/luac.vv
+ifneq "$(_vv)" ".cp .out/CExe/luac !@."
+  .out/exports/bin/luac: .out/FORCE
+endif
+
+_Copy(CExe(luac),dir:.out/exports/bin/)_needs = 
+ 
+.out/exports/lib/liblua.lib : .out/Lib/liblua.lib  | 
+	$(call _traceRecord,B,$@ 'Copy$[Lib$[liblua$]$;dir:.out/exports/lib/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dlib@D_Lib/ .out/exports/lib/
+	@echo '_vv=.cp .out/Lib/liblua.lib !@.lib.' > .out/Copy_@1,dir@C.out@Dexports@Dlib@D_Lib/liblua.lib.vv
+	cp .out/Lib/liblua.lib .out/exports/lib/liblua.lib
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dlib@D_Lib/liblua.lib.vv
+ifneq "$(_vv)" ".cp .out/Lib/liblua.lib !@.lib."
+  .out/exports/lib/liblua.lib: .out/FORCE
+endif
+
+_Copy(Lib(liblua),dir:.out/exports/lib/)_needs = 
+ 
+.out/exports/src/lalloc.h : lalloc.h  | 
+	$(call _traceRecord,B,$@ 'Copy$[lalloc.h$;dir:.out/exports/src/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/ .out/exports/src/
+	@echo '_vv=.cp lalloc.h !@.h.' > .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/lalloc.h.vv
+	cp lalloc.h .out/exports/src/lalloc.h
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@Dsrc@D/lalloc.h.vv
+ifneq "$(_vv)" ".cp lalloc.h !@.h."
+  .out/exports/src/lalloc.h: .out/FORCE
+endif
+
+_Copy(lalloc.h,dir:.out/exports/src/)_needs = 
+ 
+.out/Lib/liblua.lib : .out/CC/_../opensource/lua-5.2.3/src/lapi.o .out/CC/_../opensource/lua-5.2.3/src/lauxlib.o .out/CC/_../opensource/lua-5.2.3/src/lbaselib.o .out/CC/_../opensource/lua-5.2.3/src/lbitlib.o .out/CC/_../opensource/lua-5.2.3/src/lcode.o .out/CC/_../opensource/lua-5.2.3/src/lcorolib.o .out/CC/_../opensource/lua-5.2.3/src/lctype.o .out/CC/_../opensource/lua-5.2.3/src/ldblib.o .out/CC/_../opensource/lua-5.2.3/src/ldebug.o .out/CC/_../opensource/lua-5.2.3/src/ldo.o .out/CC/_../opensource/lua-5.2.3/src/ldump.o .out/CC/_../opensource/lua-5.2.3/src/lfunc.o .out/CC/_../opensource/lua-5.2.3/src/lgc.o .out/CC/_../opensource/lua-5.2.3/src/linit.o .out/CC/_../opensource/lua-5.2.3/src/liolib.o .out/CC/_../opensource/lua-5.2.3/src/llex.o .out/CC/_../opensource/lua-5.2.3/src/lmathlib.o .out/CC/_../opensource/lua-5.2.3/src/lmem.o .out/CC/_../opensource/lua-5.2.3/src/loadlib.o .out/CC/_../opensource/lua-5.2.3/src/lobject.o .out/CC/_../opensource/lua-5.2.3/src/lopcodes.o .out/CC/_../opensource/lua-5.2.3/src/loslib.o .out/CC/_../opensource/lua-5.2.3/src/lparser.o .out/CC/_../opensource/lua-5.2.3/src/lstate.o .out/CC/_../opensource/lua-5.2.3/src/lstring.o .out/CC/_../opensource/lua-5.2.3/src/lstrlib.o .out/CC/_../opensource/lua-5.2.3/src/ltable.o .out/CC/_../opensource/lua-5.2.3/src/ltablib.o .out/CC/_../opensource/lua-5.2.3/src/ltm.o .out/CC/_../opensource/lua-5.2.3/src/lundump.o .out/CC/_../opensource/lua-5.2.3/src/lvm.o .out/CC/_../opensource/lua-5.2.3/src/lzio.o .out/CC/lalloc.o  | 
+	$(call _traceRecord,B,$@ 'Lib$[liblua$]')
+	@mkdir -p .out/Lib/
+	@echo '_vv=.ar -rsc !@.lib .out/CC/_../opensource/lua-5.2.3/src/lapi.o .out/CC/_../opensource/lua-5.2.3/src/lauxlib.o .out/CC/_../opensource/lua-5.2.3/src/lbaselib.o .out/CC/_../opensource/lua-5.2.3/src/lbitlib.o .out/CC/_../opensource/lua-5.2.3/src/lcode.o .out/CC/_../opensource/lua-5.2.3/src/lcorolib.o .out/CC/_../opensource/lua-5.2.3/src/lctype.o .out/CC/_../opensource/lua-5.2.3/src/ldblib.o .out/CC/_../opensource/lua-5.2.3/src/ldebug.o .out/CC/_../opensource/lua-5.2.3/src/ldo.o .out/CC/_../opensource/lua-5.2.3/src/ldump.o .out/CC/_../opensource/lua-5.2.3/src/lfunc.o .out/CC/_../opensource/lua-5.2.3/src/lgc.o .out/CC/_../opensource/lua-5.2.3/src/linit.o .out/CC/_../opensource/lua-5.2.3/src/liolib.o .out/CC/_../opensource/lua-5.2.3/src/llex.o .out/CC/_../opensource/lua-5.2.3/src/lmathlib.o .out/CC/_../opensource/lua-5.2.3/src/lmem.o .out/CC/_../opensource/lua-5.2.3/src/loadlib.o .out/CC/_../opensource/lua-5.2.3/src/lobject.o .out/CC/_../opensource/lua-5.2.3/src/lopcodes.o .out/CC/_../opensource/lua-5.2.3/src/loslib.o .out/CC/_../opensource/lua-5.2.3/src/lparser.o .out/CC/_../opensource/lua-5.2.3/src/lstate.o .out/CC/_../opensource/lua-5.2.3/src/lstring.o .out/CC/_../opensource/lua-5.2.3/src/lstrlib.o .out/CC/_../opensource/lua-5.2.3/src/ltable.o .out/CC/_../opensource/lua-5.2.3/src/ltablib.o .out/CC/_../opensource/lua-5.2.3/src/ltm.o .out/CC/_../opensource/lua-5.2.3/src/lundump.o .out/CC/_../opensource/lua-5.2.3/src/lvm.o .out/CC/_../opensource/lua-5.2.3/src/lzio.o .out/CC/lalloc.o.' > .out/Lib/liblua.vv
+	ar -rsc .out/Lib/liblua.lib .out/CC/_../opensource/lua-5.2.3/src/lapi.o .out/CC/_../opensource/lua-5.2.3/src/lauxlib.o .out/CC/_../opensource/lua-5.2.3/src/lbaselib.o .out/CC/_../opensource/lua-5.2.3/src/lbitlib.o .out/CC/_../opensource/lua-5.2.3/src/lcode.o .out/CC/_../opensource/lua-5.2.3/src/lcorolib.o .out/CC/_../opensource/lua-5.2.3/src/lctype.o .out/CC/_../opensource/lua-5.2.3/src/ldblib.o .out/CC/_../opensource/lua-5.2.3/src/ldebug.o .out/CC/_../opensource/lua-5.2.3/src/ldo.o .out/CC/_../opensource/lua-5.2.3/src/ldump.o .out/CC/_../opensource/lua-5.2.3/src/lfunc.o .out/CC/_../opensource/lua-5.2.3/src/lgc.o .out/CC/_../opensource/lua-5.2.3/src/linit.o .out/CC/_../opensource/lua-5.2.3/src/liolib.o .out/CC/_../opensource/lua-5.2.3/src/llex.o .out/CC/_../opensource/lua-5.2.3/src/lmathlib.o .out/CC/_../opensource/lua-5.2.3/src/lmem.o .out/CC/_../opensource/lua-5.2.3/src/loadlib.o .out/CC/_../opensource/lua-5.2.3/src/lobject.o .out/CC/_../opensource/lua-5.2.3/src/lopcodes.o .out/CC/_../opensource/lua-5.2.3/src/loslib.o .out/CC/_../opensource/lua-5.2.3/src/lparser.o .out/CC/_../opensource/lua-5.2.3/src/lstate.o .out/CC/_../opensource/lua-5.2.3/src/lstring.o .out/CC/_../opensource/lua-5.2.3/src/lstrlib.o .out/CC/_../opensource/lua-5.2.3/src/ltable.o .out/CC/_../opensource/lua-5.2.3/src/ltablib.o .out/CC/_../opensource/lua-5.2.3/src/ltm.o .out/CC/_../opensource/lua-5.2.3/src/lundump.o .out/CC/_../opensource/lua-5.2.3/src/lvm.o .out/CC/_../opensource/lua-5.2.3/src/lzio.o .out/CC/lalloc.o
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Lib/liblua.vv
+ifneq "$(_vv)" ".ar -rsc !@.lib .out/CC/_../opensource/lua-5.2.3/src/lapi.o .out/CC/_../opensource/lua-5.2.3/src/lauxlib.o .out/CC/_../opensource/lua-5.2.3/src/lbaselib.o .out/CC/_../opensource/lua-5.2.3/src/lbitlib.o .out/CC/_../opensource/lua-5.2.3/src/lcode.o .out/CC/_../opensource/lua-5.2.3/src/lcorolib.o .out/CC/_../opensource/lua-5.2.3/src/lctype.o .out/CC/_../opensource/lua-5.2.3/src/ldblib.o .out/CC/_../opensource/lua-5.2.3/src/ldebug.o .out/CC/_../opensource/lua-5.2.3/src/ldo.o .out/CC/_../opensource/lua-5.2.3/src/ldump.o .out/CC/_../opensource/lua-5.2.3/src/lfunc.o .out/CC/_../opensource/lua-5.2.3/src/lgc.o .out/CC/_../opensource/lua-5.2.3/src/linit.o .out/CC/_../opensource/lua-5.2.3/src/liolib.o .out/CC/_../opensource/lua-5.2.3/src/llex.o .out/CC/_../opensource/lua-5.2.3/src/lmathlib.o .out/CC/_../opensource/lua-5.2.3/src/lmem.o .out/CC/_../opensource/lua-5.2.3/src/loadlib.o .out/CC/_../opensource/lua-5.2.3/src/lobject.o .out/CC/_../opensource/lua-5.2.3/src/lopcodes.o .out/CC/_../opensource/lua-5.2.3/src/loslib.o .out/CC/_../opensource/lua-5.2.3/src/lparser.o .out/CC/_../opensource/lua-5.2.3/src/lstate.o .out/CC/_../opensource/lua-5.2.3/src/lstring.o .out/CC/_../opensource/lua-5.2.3/src/lstrlib.o .out/CC/_../opensource/lua-5.2.3/src/ltable.o .out/CC/_../opensource/lua-5.2.3/src/ltablib.o .out/CC/_../opensource/lua-5.2.3/src/ltm.o .out/CC/_../opensource/lua-5.2.3/src/lundump.o .out/CC/_../opensource/lua-5.2.3/src/lvm.o .out/CC/_../opensource/lua-5.2.3/src/lzio.o .out/CC/lalloc.o."
+  .out/Lib/liblua.lib: .out/FORCE
+endif
+
+_Lib(liblua)_needs = 
+ 
+.PHONY: .out/Ship_@1,exports@Dlib,exports@Dsrc/exports/bin
+.out/Ship_@1,exports@Dlib,exports@Dsrc/exports/bin : .out/exports/bin/lua .out/exports/bin/luac .out/exports/lib/liblua.lib .out/exports/src/lua.h .out/exports/src/luaconf.h .out/exports/src/lualib.h .out/exports/src/lauxlib.h .out/exports/src/lalloc.h  | 
+	$(call _traceRecord,B,$@ 'Ship$[exports/bin$;exports/lib$;exports/src$]')
+	@true
+	$(call _traceRecord,E,$@ $^ $|)
+
+
+_Ship(exports/bin,exports/lib,exports/src)_needs = CExe(lua)
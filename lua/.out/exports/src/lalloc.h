@@ -0,0 +1,23 @@
+// lalloc: pooled Lua allocator with allocation statistics
+//
+// lalloc_newstate() creates a Lua state like luaL_newstate(), except that
+// memory is allocated from a pool owned by the state.  Small blocks are
+// kept on per-size-class free lists and carved from larger chunks; larger
+// blocks are obtained from malloc.  The pool is released when the state is
+// closed.
+//
+// In a state created by lalloc_newstate(), `require "lalloc"` returns a
+// table of functions for monitoring allocations.  See lalloc.c.
+
+#ifndef LALLOC_H
+#define LALLOC_H
+
+// lua.h is not included, so this can be included before lua.c (which
+// defines `lua_c` before including lua.h).
+struct lua_State;
+
+struct lua_State *lalloc_newstate(void);
+
+int luaopen_lalloc(struct lua_State *L);
+
+#endif // LALLOC_H
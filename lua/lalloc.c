@@ -0,0 +1,385 @@
+// lalloc: pooled Lua allocator with allocation statistics
+//
+// Each state created by lalloc_newstate() has its own pool, passed to the
+// allocator as its `ud` argument.  A Lua state is used by one OS thread at
+// a time, so the pool needs no locking.
+//
+// Blocks of up to SMALL_MAX bytes are rounded up to a multiple of GRAIN
+// bytes, giving NUM_CLASSES size classes.  Freed small blocks are placed on
+// the free list for their class and reused by later allocations of that
+// class.  New small blocks are carved from CHUNK_SIZE chunks obtained from
+// malloc.  Larger blocks are passed through to realloc/free.
+//
+// Lua tells the allocator the size of the block being freed or resized, so
+// small blocks need no header.  When a large block is shrunk to a small size
+// and no small block can be allocated, the large block becomes a chunk
+// holding just that block (see pool_adopt).
+//
+// The pool's chunks are returned to malloc when the last block is freed,
+// which happens at the end of lua_close().
+//
+// Lua API (in states created by lalloc_newstate):
+//
+//   lalloc = require "lalloc"
+//
+//   lalloc.stats() -> table
+//      bytes    = bytes currently allocated (as requested by Lua)
+//      peak     = maximum value of `bytes` (see resetPeak)
+//      count    = number of blocks currently allocated
+//      allocs   = total number of allocations (including reallocations
+//                 that moved a block to a different size class)
+//      reserved = bytes obtained from malloc for small-block chunks
+//      classes  = array of { size=, count=, allocs= } for each size class
+//      large    = { count=, allocs= } for blocks larger than SMALL_MAX
+//
+//   lalloc.resetPeak()
+//      Set `peak` to the current value of `bytes`.
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lalloc.h"
+
+#define GRAIN        16
+#define SMALL_MAX    256
+#define NUM_CLASSES  (SMALL_MAX / GRAIN)
+#define LARGE        NUM_CLASSES              // class index of large blocks
+#define CHUNK_SIZE   (64 * 1024)
+
+// Chunk headers occupy one GRAIN so that blocks remain GRAIN-aligned.
+#define CHUNK_HEADER GRAIN
+
+#define CLASS_OF(size)  ((size) > SMALL_MAX ? LARGE : (size) <= GRAIN ? 0 : (int) (((size) - 1) / GRAIN))
+#define CLASS_SIZE(c)   (((size_t) (c) + 1) * GRAIN)
+
+
+typedef struct Block {
+   struct Block *next;
+} Block;
+
+
+typedef struct Chunk {
+   struct Chunk *next;
+} Chunk;
+
+
+typedef struct {
+   size_t count;
+   size_t allocs;
+} ClassStats;
+
+
+typedef struct {
+   Block *freeList[NUM_CLASSES];
+   char *bump;                         // unused portion of newest chunk
+   char *bumpEnd;
+   Chunk *chunks;
+
+   size_t count;
+   size_t bytes;
+   size_t peak;
+   size_t reserved;
+   ClassStats cls[NUM_CLASSES + 1];
+} Pool;
+
+
+static void pool_delete(Pool *pool)
+{
+   Chunk *c = pool->chunks;
+   while (c) {
+      Chunk *next = c->next;
+      free(c);
+      c = next;
+   }
+   free(pool);
+}
+
+
+// Allocate a block of class `c`.  Return NULL on failure.
+//
+static void *pool_get(Pool *pool, int c, size_t size)
+{
+   void *p;
+
+   if (c == LARGE) {
+      p = malloc(size);
+   } else if (pool->freeList[c]) {
+      Block *b = pool->freeList[c];
+      pool->freeList[c] = b->next;
+      p = b;
+   } else {
+      size_t cb = CLASS_SIZE(c);
+      if ((size_t) (pool->bumpEnd - pool->bump) < cb) {
+         Chunk *chunk = (Chunk *) malloc(CHUNK_SIZE);
+         if (chunk == NULL) {
+            return NULL;
+         }
+         // The remainder of the previous chunk (less than SMALL_MAX bytes)
+         // is abandoned.
+         chunk->next = pool->chunks;
+         pool->chunks = chunk;
+         pool->reserved += CHUNK_SIZE;
+         pool->bump = (char *) chunk + CHUNK_HEADER;
+         pool->bumpEnd = (char *) chunk + CHUNK_SIZE;
+      }
+      p = pool->bump;
+      pool->bump += cb;
+   }
+
+   if (p) {
+      ++pool->cls[c].count;
+      ++pool->cls[c].allocs;
+      ++pool->count;
+   }
+   return p;
+}
+
+
+static void pool_put(Pool *pool, int c, void *p)
+{
+   if (c == LARGE) {
+      free(p);
+   } else {
+      Block *b = (Block *) p;
+      b->next = pool->freeList[c];
+      pool->freeList[c] = b;
+   }
+   --pool->cls[c].count;
+   --pool->count;
+}
+
+
+// Convert large block `ptr` into a chunk holding one block of the class of
+// `nsize`, when it cannot be moved to a small block.  The block is trimmed
+// to the size of that class (it may grow again within the class), and is
+// recycled through the free list like any other small block.  Returns the
+// block, or NULL if there is no room for the chunk header.
+//
+static void *pool_adopt(Pool *pool, void *ptr, size_t osize, size_t nsize)
+{
+   int c = CLASS_OF(nsize);
+   size_t size = CHUNK_HEADER + CLASS_SIZE(c);
+   Chunk *chunk = (Chunk *) realloc(ptr, size);
+
+   if (chunk == NULL) {
+      if (osize < size) {
+         return NULL;
+      }
+      chunk = (Chunk *) ptr;
+   }
+   memmove((char *) chunk + CHUNK_HEADER, chunk, nsize);
+   chunk->next = pool->chunks;
+   pool->chunks = chunk;
+   pool->reserved += size;
+   --pool->cls[LARGE].count;
+   ++pool->cls[c].count;
+   return (char *) chunk + CHUNK_HEADER;
+}
+
+
+static void pool_setBytes(Pool *pool, size_t osize, size_t nsize)
+{
+   pool->bytes = pool->bytes - osize + nsize;
+   if (pool->bytes > pool->peak) {
+      pool->peak = pool->bytes;
+   }
+}
+
+
+static void *lalloc_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+   Pool *pool = (Pool *) ud;
+   int oc, nc;
+   void *p;
+
+   if (ptr == NULL) {
+      // `osize` encodes the type of object being allocated
+      osize = 0;
+   }
+
+   if (nsize == 0) {
+      if (ptr) {
+         pool_put(pool, CLASS_OF(osize), ptr);
+         pool_setBytes(pool, osize, 0);
+         if (pool->count == 0) {
+            // The state has been closed.
+            pool_delete(pool);
+         }
+      }
+      return NULL;
+   }
+
+   oc = CLASS_OF(osize);
+   nc = CLASS_OF(nsize);
+
+   if (ptr && oc == nc && nc != LARGE) {
+      p = ptr;
+   } else if (ptr && oc == LARGE && nc == LARGE) {
+      p = realloc(ptr, nsize);
+      if (p == NULL) {
+         return NULL;
+      }
+      ++pool->cls[LARGE].allocs;
+   } else {
+      p = pool_get(pool, nc, nsize);
+      if (p == NULL) {
+         if (ptr && nsize < osize) {
+            // Lua assumes that shrinking never fails; keep the old block.
+            if (oc == LARGE) {
+               // It came from malloc, so it must not join a free list.
+               // (pool_adopt fails only when the block must grow a few
+               // bytes; Lua then collects garbage and retries.)
+               ptr = pool_adopt(pool, ptr, osize, nsize);
+               if (ptr == NULL) {
+                  return NULL;
+               }
+            } else {
+               // It will be freed (later) as a member of class `nc`.
+               --pool->cls[oc].count;
+               ++pool->cls[nc].count;
+            }
+            pool_setBytes(pool, osize, nsize);
+            return ptr;
+         }
+         return NULL;
+      }
+      if (ptr) {
+         memcpy(p, ptr, osize < nsize ? osize : nsize);
+         pool_put(pool, oc, ptr);
+      }
+   }
+
+   pool_setBytes(pool, osize, nsize);
+   return p;
+}
+
+
+static int panic(lua_State *L)
+{
+   luai_writestringerror("PANIC: unprotected error in call to Lua API (%s)\n",
+                         lua_tostring(L, -1));
+   return 0;  // return to Lua to abort
+}
+
+
+lua_State *lalloc_newstate(void)
+{
+   lua_State *L;
+   Pool *pool = (Pool *) calloc(1, sizeof(Pool));
+
+   if (pool == NULL) {
+      return NULL;
+   }
+
+   // Hold a reference while creating the state so that the pool is not
+   // deleted if lua_newstate() fails after allocating memory.
+   pool->count = 1;
+   L = lua_newstate(lalloc_alloc, pool);
+   --pool->count;
+   if (L == NULL) {
+      pool_delete(pool);
+      return NULL;
+   }
+   lua_atpanic(L, &panic);
+
+   // Make `require "lalloc"` work in this state.
+   luaL_getsubtable(L, LUA_REGISTRYINDEX, "_PRELOAD");
+   lua_pushcfunction(L, luaopen_lalloc);
+   lua_setfield(L, -2, "lalloc");
+   lua_pop(L, 1);
+   return L;
+}
+
+
+//----------------------------------------------------------------
+// Lua API
+//----------------------------------------------------------------
+
+static Pool *getPool(lua_State *L)
+{
+   void *ud;
+   if (lua_getallocf(L, &ud) != lalloc_alloc) {
+      luaL_error(L, "lalloc: state was not created by lalloc_newstate");
+   }
+   return (Pool *) ud;
+}
+
+
+static void setStats(lua_State *L, const ClassStats *cs)
+{
+   lua_pushnumber(L, (lua_Number) cs->count);
+   lua_setfield(L, -2, "count");
+   lua_pushnumber(L, (lua_Number) cs->allocs);
+   lua_setfield(L, -2, "allocs");
+}
+
+
+static int lalloc_stats(lua_State *L)
+{
+   Pool *pool = getPool(L);
+   ClassStats cls[NUM_CLASSES + 1];
+   size_t bytes = pool->bytes, peak = pool->peak, count = pool->count;
+   size_t allocs = 0;
+   int c;
+
+   // Take a snapshot, since constructing the result allocates memory.
+   memcpy(cls, pool->cls, sizeof cls);
+   for (c = 0; c <= LARGE; ++c) {
+      allocs += cls[c].allocs;
+   }
+
+   lua_createtable(L, 0, 7);
+
+   lua_pushnumber(L, (lua_Number) bytes);
+   lua_setfield(L, -2, "bytes");
+   lua_pushnumber(L, (lua_Number) peak);
+   lua_setfield(L, -2, "peak");
+   lua_pushnumber(L, (lua_Number) count);
+   lua_setfield(L, -2, "count");
+   lua_pushnumber(L, (lua_Number) allocs);
+   lua_setfield(L, -2, "allocs");
+   lua_pushnumber(L, (lua_Number) pool->reserved);
+   lua_setfield(L, -2, "reserved");
+
+   lua_createtable(L, NUM_CLASSES, 0);
+   for (c = 0; c < NUM_CLASSES; ++c) {
+      lua_createtable(L, 0, 3);
+      lua_pushnumber(L, (lua_Number) CLASS_SIZE(c));
+      lua_setfield(L, -2, "size");
+      setStats(L, &cls[c]);
+      lua_rawseti(L, -2, c + 1);
+   }
+   lua_setfield(L, -2, "classes");
+
+   lua_createtable(L, 0, 2);
+   setStats(L, &cls[LARGE]);
+   lua_setfield(L, -2, "large");
+
+   return 1;
+}
+
+
+static int lalloc_resetPeak(lua_State *L)
+{
+   Pool *pool = getPool(L);
+   pool->peak = pool->bytes;
+   return 0;
+}
+
+
+static const luaL_Reg lalloc_regs[] = {
+   {"stats", lalloc_stats},
+   {"resetPeak", lalloc_resetPeak},
+   {0,0}
+};
+
+
+int luaopen_lalloc(lua_State *L)
+{
+   getPool(L);
+   luaL_newlib(L, lalloc_regs);
+   return 1;
+}
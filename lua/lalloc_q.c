@@ -0,0 +1,100 @@
+// lalloc_q.c: test lalloc.c, with simulated malloc failures
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failChunks = 0;       // when true, chunk allocations fail
+
+static void *testMalloc(size_t size)
+{
+   return (failChunks && size == 64 * 1024) ? NULL : malloc(size);
+}
+
+#define malloc testMalloc
+#include "lalloc.c"
+#undef malloc
+
+
+#define assert(c) \
+   if (!(c)) { printf(__FILE__ ":%d: assertion failed!\n", __LINE__); exit(1); }
+
+#define eq_i(a, b)                                               \
+   do {                                                          \
+      long a__ = (long) (a);                                     \
+      long b__ = (long) (b);                                     \
+      if (a__ != b__) {                                          \
+         printf("%s:%d: assertion failed!\nA: %ld\nB: %ld\n",    \
+                __FILE__, __LINE__, a__, b__);                   \
+         exit(1);                                                \
+      }                                                          \
+   } while (0)
+
+
+static void *alloc(Pool *pool, void *ptr, size_t osize, size_t nsize)
+{
+   return lalloc_alloc(pool, ptr, osize, nsize);
+}
+
+
+int main(int argc, char **argv)
+{
+   Pool *pool = (Pool *) calloc(1, sizeof(Pool));
+   char *keep, *big, *p;
+   size_t n0;
+
+   // Hold a reference, as lalloc_newstate() does, so that the pool
+   // survives when all test blocks are freed.
+   pool->count = 1;
+
+   // Size classes are reused through free lists.
+   keep = (char *) alloc(pool, NULL, 0, 20);
+   p = (char *) alloc(pool, NULL, 0, 30);
+   eq_i(2, pool->cls[1].count);
+   alloc(pool, p, 30, 0);
+   eq_i(p, alloc(pool, NULL, 0, 32));
+   alloc(pool, p, 32, 0);
+
+   // Growing within a class keeps the block.
+   eq_i(keep, alloc(pool, keep, 20, 32));
+
+   // >> A large block that cannot be moved when shrunk is adopted.
+
+   big = (char *) alloc(pool, NULL, 0, 1000);
+   memset(big, 'x', 1000);
+   eq_i(1, pool->cls[LARGE].count);
+
+   // use the rest of the current chunk
+   while (pool->bumpEnd - pool->bump >= GRAIN) {
+      alloc(pool, NULL, 0, GRAIN);
+   }
+   failChunks = 1;
+
+   p = (char *) alloc(pool, big, 1000, 200);
+   assert(p != NULL);
+   eq_i(0, pool->cls[LARGE].count);
+   eq_i(1, pool->cls[CLASS_OF(200)].count);
+   eq_i('x', p[0]);
+   eq_i('x', p[199]);
+
+   // It may grow within its class (CLASS_SIZE(12) == 208), in place.
+   eq_i(p, alloc(pool, p, 200, 208));
+   memset(p, 'y', 208);
+
+   // When freed, it is reused as a small block of its class.
+   alloc(pool, p, 208, 0);
+   eq_i(p, alloc(pool, NULL, 0, 208));
+   alloc(pool, p, 208, 0);
+
+   // >> Shrinking a small block keeps it when no block of the new class
+   //    is available.
+
+   p = (char *) alloc(pool, NULL, 0, 100);
+   assert(p == NULL);
+   n0 = pool->cls[0].count;
+   p = (char *) alloc(pool, keep, 32, 16);
+   eq_i(keep, p);
+   eq_i(n0 + 1, pool->cls[0].count);
+
+   return 0;
+}
@@ -0,0 +1 @@
+return {value={"require","lfsu"},stamp="15:1187870:65024:1792375219",path=".out/Exec/ScanCacheHit.out.tmp/a.lua"}
@@ -0,0 +1 @@
+return {value={},stamp="8210:1171580:65024:1792361468",path="fsu.lua"}
@@ -0,0 +1 @@
+return {value={"require","xpfs","require","fsu"},stamp="3368:1171589:65024:1792374831",path="lfsu.lua"}
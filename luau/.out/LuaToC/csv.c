@@ -0,0 +1,787 @@
+// Generated by cfromlua
+// lib: .out/exports/csv_c.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local csv={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readValue(text,pos)\n"
+  "local qstr=\"\"\n"
+  "\n"
+  "if text:find('^\"',pos)then\n"
+  "\n"
+  "local i,c\n"
+  "i=pos+1\n"
+  "repeat\n"
+  "\n"
+  "c,i=text:match('\"(\"\?)()',i)\n"
+  "until c~='\"'\n"
+  "local strEnd=i and i-2 or#text\n"
+  "qstr=text:sub(pos+1,strEnd):gsub('\"\"','\"')\n"
+  "pos=i or#text+1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local v,sep,posx=text:match(\"([^,\\r\\n]*)\\r*([,\\n]\?)()\",pos)\n"
+  "return qstr..v,sep,posx\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readRow(text,pos)\n"
+  "local t={}\n"
+  "local v,sep\n"
+  "\n"
+  "repeat\n"
+  "v,sep,pos=readValue(text,pos)\n"
+  "table.insert(t,v)\n"
+  "until sep~=\",\"\n"
+  "return t,pos\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaReadRow(text,pos,row,eof,numeric)\n"
+  "local count,v,sep=0\n"
+  "repeat\n"
+  "v,sep,pos=readValue(text,pos)\n"
+  "count=count+1\n"
+  "if numeric and numeric[count]then\n"
+  "v=tonumber(v)\n"
+  "end\n"
+  "row[count]=v\n"
+  "until sep~=\",\"\n"
+  "\n"
+  "if sep==\"\"and pos>#text and not eof then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "for ndx=count+1,math.huge do\n"
+  "if row[ndx]==nil then break end\n"
+  "row[ndx]=nil\n"
+  "end\n"
+  "return count,pos\n"
+  "end\n"
+  "\n"
+  "csv._luaReadRow=luaReadRow\n"
+  "\n"
+  "\n"
+  "local succ,csv_c=pcall(require,\"csv_c\")\n"
+  "local readRowInto=succ and csv_c.readRow or luaReadRow\n"
+  "\n"
+  "csv.isNative=succ\n"
+  "\n"
+  "\n"
+  "function csv.decode(text,columns)\n"
+  "local info={}\n"
+  "local tbl={info=info}\n"
+  "local pos=1\n"
+  "\n"
+  "\n"
+  "while true do\n"
+  "local mstr,posx=text:match(\"^#([^\\n]*)\\n\?()\",pos)\n"
+  "if not mstr then break end\n"
+  "pos=posx\n"
+  "local pname,pvalue=mstr:match(\"^(%w+)%s+(.-)\\r*$\")\n"
+  "if pname then\n"
+  "table.insert(info,{name=pname,value=pvalue})\n"
+  "info[pname]=pvalue\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "while pos<=#text do\n"
+  "local values={}\n"
+  "local _\n"
+  "_,pos=readRowInto(text,pos,values,true)\n"
+  "tbl[#tbl+1]=values\n"
+  "end\n"
+  "\n"
+  "csv.useKeyNames(tbl,columns)\n"
+  "\n"
+  "return tbl\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function csv.useKeyNames(tbl,columns)\n"
+  "\n"
+  "\n"
+  "local keys=tbl.info.csv or columns\n"
+  "if keys then\n"
+  "keys=readRow(keys,1)\n"
+  "for _,row in ipairs(tbl)do\n"
+  "for ndx,v in ipairs(row)do\n"
+  "local colname=keys[ndx]\n"
+  "if colname then\n"
+  "row[colname]=v\n"
+  "row[ndx]=nil\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for _,m in ipairs(tbl.info)do\n"
+  "if m.name==\"set\"then\n"
+  "local name,value=m.value:match(\"([^=]*)=(.*)\")\n"
+  "value=readValue(value,1)\n"
+  "if name then\n"
+  "for _,row in ipairs(tbl)do\n"
+  "row[name]=value\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newSource(source)\n"
+  "if type(source)==\"string\"then\n"
+  "return{text=source,pos=1,eof=true}\n"
+  "end\n"
+  "return{text=\"\",pos=1,eof=false,read=source}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readMore(src)\n"
+  "if src.eof then\n"
+  "return false\n"
+  "end\n"
+  "local rest=#src.text-src.pos+1\n"
+  "local chunks={rest>0 and src.text:sub(src.pos)or nil}\n"
+  "local size=0\n"
+  "repeat\n"
+  "local data=src.read()\n"
+  "if data==nil then\n"
+  "src.eof=true\n"
+  "break\n"
+  "end\n"
+  "chunks[#chunks+1]=data\n"
+  "size=size+#data\n"
+  "until size>=rest\n"
+  "src.text=chunks[2]and table.concat(chunks)or chunks[1]or\"\"\n"
+  "src.pos=1\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readInfo(src)\n"
+  "local info={}\n"
+  "while true do\n"
+  "local mstr,posx=src.text:match(\"^#([^\\n]*)\\n()\",src.pos)\n"
+  "if not mstr and src.eof then\n"
+  "mstr,posx=src.text:match(\"^#([^\\n]*)()\",src.pos)\n"
+  "end\n"
+  "if mstr then\n"
+  "src.pos=posx\n"
+  "local pname,pvalue=mstr:match(\"^(%w+)%s+(.-)\\r*$\")\n"
+  "if pname then\n"
+  "table.insert(info,{name=pname,value=pvalue})\n"
+  "info[pname]=pvalue\n"
+  "end\n"
+  "elseif src.eof or not(src.pos>#src.text or\n"
+  "src.text:match(\"^#\",src.pos))then\n"
+  "return info\n"
+  "else\n"
+  "readMore(src)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readNext(src,values,numeric)\n"
+  "while true do\n"
+  "if src.pos<=#src.text then\n"
+  "local count,posx=readRowInto(src.text,src.pos,values,src.eof,numeric)\n"
+  "if count then\n"
+  "src.pos=posx\n"
+  "return count\n"
+  "end\n"
+  "end\n"
+  "if not readMore(src)then\n"
+  "return nil\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getKeys(info,columns)\n"
+  "local keys=info.csv or columns\n"
+  "if keys then\n"
+  "keys=readRow(keys,1)\n"
+  "end\n"
+  "\n"
+  "local sets={}\n"
+  "for _,m in ipairs(info)do\n"
+  "if m.name==\"set\"then\n"
+  "local name,value=m.value:match(\"([^=]*)=(.*)\")\n"
+  "if name then\n"
+  "table.insert(sets,{name,(readValue(value,1))})\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return keys,sets\n"
+  "end\n"
+  "\n"
+  "function csv.rows(source,columns)\n"
+  "local src=newSource(source)\n"
+  "local info=readInfo(src)\n"
+  "local keys,sets=getKeys(info,columns)\n"
+  "local values={}\n"
+  "local row=keys and{}or values\n"
+  "local numKeys=keys and#keys or 0\n"
+  "local prevCount=0\n"
+  "\n"
+  "local function nextRow()\n"
+  "local count=readNext(src,values)\n"
+  "if not count then\n"
+  "return nil\n"
+  "end\n"
+  "if keys then\n"
+  "for ndx=1,numKeys do\n"
+  "row[keys[ndx]]=values[ndx]\n"
+  "end\n"
+  "for ndx=numKeys+1,math.max(count,prevCount)do\n"
+  "row[ndx]=values[ndx]\n"
+  "end\n"
+  "prevCount=count\n"
+  "end\n"
+  "for _,s in ipairs(sets)do\n"
+  "row[s[1]]=s[2]\n"
+  "end\n"
+  "return row\n"
+  "end\n"
+  "\n"
+  "return nextRow,info\n"
+  "end\n"
+  "\n"
+  "function csv.decodeColumns(source,columns,types)\n"
+  "types=types or{}\n"
+  "local src=newSource(source)\n"
+  "local info=readInfo(src)\n"
+  "local keys,sets=getKeys(info,columns)\n"
+  "local byKey={}\n"
+  "local result={info=info,names=keys,n=0,columns=byKey}\n"
+  "local numKeys=keys and#keys or 0\n"
+  "local cols={}\n"
+  "local numeric={}\n"
+  "local values={}\n"
+  "\n"
+  "local function getColumn(ndx)\n"
+  "local key=keys and keys[ndx]or ndx\n"
+  "local col=byKey[key]or{}\n"
+  "byKey[key]=col\n"
+  "cols[ndx]=col\n"
+  "numeric[ndx]=(types[key]==\"number\")\n"
+  "return col\n"
+  "end\n"
+  "\n"
+  "for ndx=1,numKeys do\n"
+  "getColumn(ndx)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for key,kind in pairs(types)do\n"
+  "if type(key)==\"number\"and key>numKeys then\n"
+  "numeric[key]=(kind==\"number\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local n=0\n"
+  "while true do\n"
+  "local count=readNext(src,values,numeric)\n"
+  "if not count then\n"
+  "break\n"
+  "end\n"
+  "n=n+1\n"
+  "for ndx=1,math.max(count,numKeys)do\n"
+  "local col=cols[ndx]or getColumn(ndx)\n"
+  "col[n]=values[ndx]\n"
+  "end\n"
+  "end\n"
+  "result.n=n\n"
+  "\n"
+  "for _,s in ipairs(sets)do\n"
+  "local name,value=s[1],s[2]\n"
+  "if types[name]==\"number\"then\n"
+  "value=tonumber(value)\n"
+  "end\n"
+  "local col={}\n"
+  "for ndx=1,n do\n"
+  "col[ndx]=value\n"
+  "end\n"
+  "byKey[name]=col\n"
+  "end\n"
+  "\n"
+  "return result\n"
+  "end\n"
+  "\n"
+  "function csv.loadFile(file,columns)\n"
+  "local f,err=io.open(file,'rb')\n"
+  "if not f then\n"
+  "return f,err\n"
+  "end\n"
+  "\n"
+  "local text=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return csv.decode(text,columns)\n"
+  "end\n"
+  "\n"
+  "local function quoteValue(v)\n"
+  "v=(v==nil)and\"\"or tostring(v)\n"
+  "if v:match(\"^[#%s]\")or v:match('[,\"\\n\\r]')or v:match(\"%s$\")then\n"
+  "v='\"'..v:gsub('\"','\"\"')..'\"'\n"
+  "end\n"
+  "return v\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getColumns(columns)\n"
+  "local cols={}\n"
+  "\n"
+  "if type(columns)==\"number\"then\n"
+  "for ndx=1,columns do\n"
+  "cols[ndx]=ndx\n"
+  "end\n"
+  "elseif type(columns)==\"string\"then\n"
+  "cols=readRow(columns,1)\n"
+  "cols.csv=true\n"
+  "elseif type(columns)==\"table\"then\n"
+  "cols=columns\n"
+  "else\n"
+  "error(\"csv.encode: Invalid type for 'columns'\")\n"
+  "end\n"
+  "return cols\n"
+  "end\n"
+  "\n"
+  "local function encodeHeader(cols)\n"
+  "local line={}\n"
+  "for ndx,v in ipairs(cols)do\n"
+  "line[ndx]=quoteValue(v)\n"
+  "end\n"
+  "return\"#csv \"..table.concat(line,\",\")\n"
+  "end\n"
+  "\n"
+  "local function encodeRow(row,cols)\n"
+  "local line={}\n"
+  "for ndx,fld in ipairs(cols)do\n"
+  "line[ndx]=quoteValue(row[fld])\n"
+  "end\n"
+  "return table.concat(line,\",\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function csv.encode(tbl,columns)\n"
+  "local out={}\n"
+  "local cols=getColumns(columns)\n"
+  "\n"
+  "if cols.csv then\n"
+  "table.insert(out,encodeHeader(cols))\n"
+  "end\n"
+  "\n"
+  "for _,row in ipairs(tbl)do\n"
+  "table.insert(out,encodeRow(row,cols))\n"
+  "end\n"
+  "table.insert(out,\"\")\n"
+  "\n"
+  "return table.concat(out,\"\\n\")\n"
+  "end\n"
+  "\n"
+  "function csv.newWriter(f,columns)\n"
+  "local cols=getColumns(columns)\n"
+  "local out={}\n"
+  "\n"
+  "if cols.csv then\n"
+  "out[1]=encodeHeader(cols)\n"
+  "end\n"
+  "\n"
+  "return function(row)\n"
+  "if row then\n"
+  "out[#out+1]=encodeRow(row,cols)\n"
+  "end\n"
+  "if not row or#out>=1000 then\n"
+  "out[#out+1]=\"\"\n"
+  "f:write(table.concat(out,\"\\n\"))\n"
+  "out={}\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function csv.writeFile(f,tbl,columns)\n"
+  "f:write(csv.encode(tbl,columns))\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "return csv\n"
+  "";
+
+extern int luaopen_csv_c(lua_State *);
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@csv.lua", (const char *) data1, 6884, 0 },
+   { "csv_c", 0, (const char *) 0, 0, luaopen_csv_c }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
@@ -0,0 +1,1064 @@
+// Generated by cfromlua
+// lib: .out/exports/textcodec_c.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "local E,TYPE=doctree.E,doctree.TYPE\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlSubs={\n"
+  "[\"<\"]=\"&lt;\",\n"
+  "[\">\"]=\"&gt;\",\n"
+  "[\"&\"]=\"&amp;\",\n"
+  "['\"']=\"&quot;\"\n"
+  "}\n"
+  "\n"
+  "local function badUTF8(n)\n"
+  "return 0xFFDD;\n"
+  "end\n"
+  "\n"
+  "local function makeCharRef(ch)\n"
+  "return(\"&#%d;\"):format(utf8utils.decode(ch,badUTF8))\n"
+  "end\n"
+  "\n"
+  "local function luaHtmlEscape(str)\n"
+  "return(str:gsub(\"[<>&]\",htmlSubs):gsub(utf8utils.mbpattern,makeCharRef))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local htmlEscape=succ and textcodec_c.htmlEscape or luaHtmlEscape\n"
+  "\n"
+  "local function htmlEscapeAttr(str)\n"
+  "return(str:gsub('[>&\"]',htmlSubs))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function encodeAttrs(node)\n"
+  "local ta={\"\"}\n"
+  "for k,v in opairs(node or{})do\n"
+  "if v and type(k)==\"string\"and k:sub(1,1)~=\"_\"then\n"
+  "local a=k\n"
+  "if v~=true then\n"
+  "a=k..'=\"'..htmlEscapeAttr(tostring(v))..'\"'\n"
+  "end\n"
+  "insert(ta,a)\n"
+  "end\n"
+  "end\n"
+  "return ta[2]and concat(ta,\" \")or\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsEmpty={\n"
+  "area=true,\n"
+  "base=true,\n"
+  "br=true,\n"
+  "col=true,\n"
+  "hr=true,\n"
+  "img=true,\n"
+  "input=true,\n"
+  "link=true,\n"
+  "meta=true,\n"
+  "param=true,\n"
+  "\n"
+  "command=true,\n"
+  "embed=true,\n"
+  "keygen=true,\n"
+  "source=true,\n"
+  "track=true,\n"
+  "wbr=true,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsBlock={\n"
+  "address=true,\n"
+  "blockquote=true,\n"
+  "\n"
+  "h1=true,\n"
+  "h2=true,\n"
+  "h3=true,\n"
+  "h4=true,\n"
+  "h5=true,\n"
+  "h6=true,\n"
+  "p=true,\n"
+  "\n"
+  "ol=true,\n"
+  "ul=true,\n"
+  "li=true,\n"
+  "hr=true,\n"
+  "html=true,\n"
+  "body=true,\n"
+  "head=true,\n"
+  "meta=true,\n"
+  "style=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local elemIsCDATA={\n"
+  "style=true,\n"
+  "script=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local HTMLGen=Object:new()\n"
+  "\n"
+  "\n"
+  "function HTMLGen:initialize(options)\n"
+  "self.options=options or{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:warn(node,...)\n"
+  "local warn=self.options.warn\n"
+  "if warn then\n"
+  "warn(node,string.format(...))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:append(str)\n"
+  "insert(self.strings,str)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serializeNode(node)\n"
+  "if type(node)==\"string\"then\n"
+  "self:append(htmlEscape(node))\n"
+  "return\n"
+  "elseif type(node)~=\"table\"then\n"
+  "self:warn(\"Unrecognized node type: %s\",type(node))\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local name=node[TYPE]\n"
+  "\n"
+  "if name and name:sub(1,1)==\"_\"then\n"
+  "\n"
+  "\n"
+  "if name==\"_html\"then\n"
+  "for _,chile in ipairs(node)do\n"
+  "self:append(chile)\n"
+  "end\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local o,c=\"\",\"\"\n"
+  "if name then\n"
+  "local nl=(elemIsBlock[name]and not node._whitespace)and\"\\n\"or\"\"\n"
+  "local attrs=encodeAttrs(node)\n"
+  "o=string.format(\"<%s%s>%s\",name,attrs,nl)\n"
+  "if not(elemIsEmpty[name]or node._isEmpty)then\n"
+  "c=string.format(\"%s</%s>\",nl,name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(o)\n"
+  "\n"
+  "if elemIsCDATA[name]then\n"
+  "local text=doctree.treeConcat(node)\n"
+  "if text:match(\"</\")then\n"
+  "self:warn(node,\"Invalid content for CDATA element %s: '</'\",name)\n"
+  "\n"
+  "\n"
+  "text=text:gsub(\"</\",\"<\\\\/\")\n"
+  "end\n"
+  "self:append(text)\n"
+  "else\n"
+  "for _,child in ipairs(node)do\n"
+  "self:serializeNode(child)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(c)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlPreamble=[[\n"
+  "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\" \"http://www.w3.org/TR/html4/loose.dtd\">\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serialize(tree)\n"
+  "assert(self~=HTMLGen)\n"
+  "\n"
+  "self.strings={htmlPreamble}\n"
+  "\n"
+  "self:serializeNode(tree)\n"
+  "self:append(\"\\n\")\n"
+  "return concat(self.strings)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTMLGen:normalize(tree)\n"
+  "local head=E.head{}\n"
+  "local body=E.body{}\n"
+  "local seen={}\n"
+  "local groups={}\n"
+  "\n"
+  "local function appendToHead(child)\n"
+  "if type(child)==\"table\"then\n"
+  "local seenkey=child._once or(child[TYPE]==\"title\"and\"title\")\n"
+  "if seenkey then\n"
+  "if seen[seenkey]then return end\n"
+  "seen[seenkey]=true\n"
+  "end\n"
+  "local group=child._group\n"
+  "if group then\n"
+  "local first=groups[group]\n"
+  "if first then\n"
+  "for _,c in ipairs(child)do\n"
+  "table.insert(first,c)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "first={}\n"
+  "for k,v in pairs(child)do\n"
+  "first[k]=v\n"
+  "end\n"
+  "groups[group]=first\n"
+  "child=first\n"
+  "end\n"
+  "end\n"
+  "table.insert(head,child)\n"
+  "end\n"
+  "\n"
+  "local function visit(node,tbl)\n"
+  "if type(node)~=\"table\"then\n"
+  "table.insert(tbl,node)\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local ty=node[TYPE]\n"
+  "\n"
+  "if ty==\"head\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "appendToHead(child)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local o=tbl\n"
+  "if ty and ty~=\"html\"and ty~=\"body\"then\n"
+  "\n"
+  "o={}\n"
+  "for k,v in pairs(node)do\n"
+  "if type(k)~=\"number\"then\n"
+  "o[k]=v\n"
+  "end\n"
+  "end\n"
+  "table.insert(tbl,o)\n"
+  "end\n"
+  "\n"
+  "for _,child in ipairs(node)do\n"
+  "visit(child,o)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local charset=self.options.charset\n"
+  "if charset~=false then\n"
+  "if type(charset)~=\"string\"then\n"
+  "charset=\"utf-8\"\n"
+  "end\n"
+  "appendToHead(E.meta{[\"http-equiv\"]=\"Content-Type\",\n"
+  "content=\"text/html;charset=\"..charset})\n"
+  "end\n"
+  "\n"
+  "visit(tree,body)\n"
+  "\n"
+  "appendToHead(E.title{})\n"
+  "\n"
+  "return E.html{\n"
+  "head,body\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlgen={}\n"
+  "\n"
+  "function htmlgen.generateDoc(tree,options)\n"
+  "local hg=HTMLGen:new(options)\n"
+  "return hg:serialize(hg:normalize(tree))\n"
+  "end\n"
+  "\n"
+  "function htmlgen.serialize(tree,options)\n"
+  "return HTMLGen:new(options):serialize(tree)\n"
+  "end\n"
+  "\n"
+  "function htmlgen.normalize(tree,options)\n"
+  "return HTMLGen:new(options):normalize(tree)\n"
+  "end\n"
+  "\n"
+  "htmlgen.HTMLGen=HTMLGen\n"
+  "htmlgen._luaHtmlEscape=luaHtmlEscape\n"
+  "htmlgen._htmlEscape=htmlEscape\n"
+  "\n"
+  "return htmlgen\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "\n"
+  "local Object={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Object:adopt(o)\n"
+  "rawset(self,\"__index\",self)\n"
+  "setmetatable(o,self)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:getParent()\n"
+  "local p=getmetatable(self).__index\n"
+  "return type(p)==\"table\"and p or nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:basicNew()\n"
+  "return self:adopt{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:new(...)\n"
+  "local o=self:basicNew()\n"
+  "o:initialize(...)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:initialize()\n"
+  "\n"
+  "end\n"
+  "\n"
+  "return Object\n"
+  "";
+
+static const unsigned char data3[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local char=string.char\n"
+  "local byte=string.byte\n"
+  "local match=string.match\n"
+  "local modf=math.modf\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(n)\n"
+  "if n<=0x7F then\n"
+  "return char(n)\n"
+  "end\n"
+  "if n<=0x7FF then\n"
+  "local a\n"
+  "a,n=modf(n/64)\n"
+  "return char(192+a,128+n*64)\n"
+  "end\n"
+  "if n<=0xFFFF then\n"
+  "local a,b\n"
+  "a,n=modf(n/4096)\n"
+  "b,n=modf(n*64)\n"
+  "return char(224+a,128+b,128+n*64)\n"
+  "end\n"
+  "if n<=0x10FFFF then\n"
+  "local a,b,c\n"
+  "a,n=modf(n/262144)\n"
+  "b,n=modf(n*64)\n"
+  "c,n=modf(n*64)\n"
+  "return char(240+a,128+b,128+c,128+n*64)\n"
+  "end\n"
+  "error(\"utf8: bad argument #1 to 'encode'\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mbpattern=\"[\\128-\\255][\\128-\\191]*\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaDecode(s,ferr)\n"
+  "\n"
+  "local n,min\n"
+  "if match(s,\"^[\\192-\\223][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(byte(s,1)-192)*64+byte(s,2)-128\n"
+  "min=0x80\n"
+  "elseif match(s,\"^[\\224-\\239][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=((byte(s,1)-224)*64+byte(s,2)-128)*64+byte(s,3)-128\n"
+  "min=0x800\n"
+  "elseif match(s,\"^[\\240-\\244][\\128-\\191][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(((byte(s,1)-240)*64+byte(s,2)-128)*64+byte(s,3)-128)*64+byte(s,4)-128\n"
+  "min=0x10000\n"
+  "elseif match(s,\"^[%z\\1-\\127]$\")then\n"
+  "\n"
+  "n=byte(s,1)\n"
+  "min=0\n"
+  "else\n"
+  "n=-1\n"
+  "min=0\n"
+  "end\n"
+  "if n>=min then\n"
+  "return n\n"
+  "end\n"
+  "if(ferr)then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaValidate(str)\n"
+  "for s in str:gmatch(mbpattern)do\n"
+  "luaDecode(s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local decode,validate=luaDecode,luaValidate\n"
+  "\n"
+  "if succ then\n"
+  "local utf8Decode,utf8Check=textcodec_c.utf8Decode,textcodec_c.utf8Check\n"
+  "\n"
+  "function decode(s,ferr)\n"
+  "local n,valid=utf8Decode(s)\n"
+  "if valid then\n"
+  "return n\n"
+  "elseif ferr then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function validate(str)\n"
+  "local a,b=utf8Check(str)\n"
+  "if a then\n"
+  "decode(str:sub(a,b))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gsub=string.gsub\n"
+  "\n"
+  "local function b2c(c)\n"
+  "local n=byte(c)\n"
+  "if n<192 then\n"
+  "return\"\\194\"..c\n"
+  "end\n"
+  "return\"\\195\"..char(n-64)\n"
+  "end\n"
+  "\n"
+  "local function binToChars(str)\n"
+  "return(gsub(str,\"[\\128-\\255]\",b2c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function c2b(s)\n"
+  "return char((byte(s)-194)*64+byte(s,2))\n"
+  "end\n"
+  "\n"
+  "local function charsToBin(str)\n"
+  "return(gsub(str,\"[\\194\\195][\\128-\\255]\",c2b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=encode,\n"
+  "decode=decode,\n"
+  "validate=validate,\n"
+  "mbpattern=mbpattern,\n"
+  "binToChars=binToChars,\n"
+  "charsToBin=charsToBin,\n"
+  "isNative=succ,\n"
+  "\n"
+  "_luaDecode=luaDecode,\n"
+  "_luaValidate=luaValidate,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+static const unsigned char data4[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local memoize=require\"memoize\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local TYPE=\"_type\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local E=memoize.newTable(function(e)return function(t)t._type=e;return t end end)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function treeConcat(tree)\n"
+  "local o={}\n"
+  "\n"
+  "local function fc(node)\n"
+  "if type(node)==\"table\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "fc(child)\n"
+  "end\n"
+  "else\n"
+  "table.insert(o,tostring(node))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "fc(tree)\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function visitElems(node,f,ofType)\n"
+  "if type(node)==\"table\"then\n"
+  "if ofType==node._type or not ofType and type(node._type)==\"string\"then\n"
+  "f(node)\n"
+  "end\n"
+  "for n=1,#node do\n"
+  "visitElems(node[n],f,ofType)\n"
+  "end\n"
+  "end\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "E=E,\n"
+  "TYPE=TYPE,\n"
+  "treeConcat=treeConcat,\n"
+  "visitElems=visitElems\n"
+  "}\n"
+  "";
+
+static const unsigned char data5[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function callTable(t,k)\n"
+  "return t[k]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newTable(f,weak)\n"
+  "local function index(t,k)\n"
+  "local x=f(k)\n"
+  "t[k]=x\n"
+  "return x\n"
+  "end\n"
+  "return setmetatable({},{__mode=weak,__index=index,__call=callTable})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local NIL={}\n"
+  "\n"
+  "local combine=newTable(function(f)\n"
+  "return newTable(function(a)\n"
+  "if a==NIL then a=nil end\n"
+  "return function(...)return f(a,...)end\n"
+  "end)\n"
+  "end)\n"
+  "\n"
+  "local function curry(f,...)\n"
+  "for n=1,select('#',...)do\n"
+  "local v=select(n,...)\n"
+  "f=combine[f][v==nil and NIL or v]\n"
+  "end\n"
+  "return f\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newFunction(f)\n"
+  "local values=newTable(function(f)return table.pack(f())end)\n"
+  "return function(...)\n"
+  "local o=values[curry(f,...)]\n"
+  "return table.unpack(o,1,o.n)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "newTable=newTable,\n"
+  "newFunction=newFunction,\n"
+  "curry=curry\n"
+  "}\n"
+  "";
+
+static const unsigned char data6[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function defaultCmp(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local function opairs(tbl,cmp)\n"
+  "local keys={}\n"
+  "for k in pairs(tbl)do\n"
+  "keys[#keys+1]=k\n"
+  "end\n"
+  "table.sort(keys,cmp or defaultCmp)\n"
+  "\n"
+  "local n=1\n"
+  "\n"
+  "return function()\n"
+  "local k=keys[n]\n"
+  "if k~=nil then\n"
+  "n=n+1\n"
+  "return k,tbl[k]\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return opairs\n"
+  "";
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@htmlgen.lua", (const char *) data1, 4728, 0 },
+   { "object", "@object.lua", (const char *) data2, 398, 0 },
+   { "utf8utils", "@utf8utils.lua", (const char *) data3, 2235, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c },
+   { "doctree", "@doctree.lua", (const char *) data4, 712, 0 },
+   { "memoize", "@memoize.lua", (const char *) data5, 785, 0 },
+   { "opairs", "@opairs.lua", (const char *) data6, 419, 0 }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
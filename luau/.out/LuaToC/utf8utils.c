@@ -0,0 +1,346 @@
+// Generated by cfromlua
+// lib: .out/exports/textcodec_c.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local char=string.char\n"
+  "local byte=string.byte\n"
+  "local match=string.match\n"
+  "local modf=math.modf\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(n)\n"
+  "if n<=0x7F then\n"
+  "return char(n)\n"
+  "end\n"
+  "if n<=0x7FF then\n"
+  "local a\n"
+  "a,n=modf(n/64)\n"
+  "return char(192+a,128+n*64)\n"
+  "end\n"
+  "if n<=0xFFFF then\n"
+  "local a,b\n"
+  "a,n=modf(n/4096)\n"
+  "b,n=modf(n*64)\n"
+  "return char(224+a,128+b,128+n*64)\n"
+  "end\n"
+  "if n<=0x10FFFF then\n"
+  "local a,b,c\n"
+  "a,n=modf(n/262144)\n"
+  "b,n=modf(n*64)\n"
+  "c,n=modf(n*64)\n"
+  "return char(240+a,128+b,128+c,128+n*64)\n"
+  "end\n"
+  "error(\"utf8: bad argument #1 to 'encode'\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mbpattern=\"[\\128-\\255][\\128-\\191]*\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaDecode(s,ferr)\n"
+  "\n"
+  "local n,min\n"
+  "if match(s,\"^[\\192-\\223][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(byte(s,1)-192)*64+byte(s,2)-128\n"
+  "min=0x80\n"
+  "elseif match(s,\"^[\\224-\\239][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=((byte(s,1)-224)*64+byte(s,2)-128)*64+byte(s,3)-128\n"
+  "min=0x800\n"
+  "elseif match(s,\"^[\\240-\\244][\\128-\\191][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(((byte(s,1)-240)*64+byte(s,2)-128)*64+byte(s,3)-128)*64+byte(s,4)-128\n"
+  "min=0x10000\n"
+  "elseif match(s,\"^[%z\\1-\\127]$\")then\n"
+  "\n"
+  "n=byte(s,1)\n"
+  "min=0\n"
+  "else\n"
+  "n=-1\n"
+  "min=0\n"
+  "end\n"
+  "if n>=min then\n"
+  "return n\n"
+  "end\n"
+  "if(ferr)then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaValidate(str)\n"
+  "for s in str:gmatch(mbpattern)do\n"
+  "luaDecode(s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local decode,validate=luaDecode,luaValidate\n"
+  "\n"
+  "if succ then\n"
+  "local utf8Decode,utf8Check=textcodec_c.utf8Decode,textcodec_c.utf8Check\n"
+  "\n"
+  "function decode(s,ferr)\n"
+  "local n,valid=utf8Decode(s)\n"
+  "if valid then\n"
+  "return n\n"
+  "elseif ferr then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function validate(str)\n"
+  "local a,b=utf8Check(str)\n"
+  "if a then\n"
+  "decode(str:sub(a,b))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gsub=string.gsub\n"
+  "\n"
+  "local function b2c(c)\n"
+  "local n=byte(c)\n"
+  "if n<192 then\n"
+  "return\"\\194\"..c\n"
+  "end\n"
+  "return\"\\195\"..char(n-64)\n"
+  "end\n"
+  "\n"
+  "local function binToChars(str)\n"
+  "return(gsub(str,\"[\\128-\\255]\",b2c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function c2b(s)\n"
+  "return char((byte(s)-194)*64+byte(s,2))\n"
+  "end\n"
+  "\n"
+  "local function charsToBin(str)\n"
+  "return(gsub(str,\"[\\194\\195][\\128-\\255]\",c2b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=encode,\n"
+  "decode=decode,\n"
+  "validate=validate,\n"
+  "mbpattern=mbpattern,\n"
+  "binToChars=binToChars,\n"
+  "charsToBin=charsToBin,\n"
+  "isNative=succ,\n"
+  "\n"
+  "_luaDecode=luaDecode,\n"
+  "_luaValidate=luaValidate,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@utf8utils.lua", (const char *) data1, 2235, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
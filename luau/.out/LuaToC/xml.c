@@ -0,0 +1,885 @@
+// Generated by cfromlua
+// lib: .out/exports/textcodec_c.lib
+// lib: .out/exports/xml_c.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "\n"
+  "\n"
+  "local succ,xml_c=pcall(require,\"xml_c\")\n"
+  "if not succ then\n"
+  "xml_c=nil\n"
+  "end\n"
+  "\n"
+  "local insert,remove,concat=table.insert,table.remove,table.concat\n"
+  "\n"
+  "local xml={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local utf8Encode=utf8utils.encode\n"
+  "\n"
+  "local entities={\n"
+  "amp=\"&\",\n"
+  "quot='\"',\n"
+  "apos=\"'\",\n"
+  "lt=\"<\",\n"
+  "gt=\">\",\n"
+  "}\n"
+  "\n"
+  "local function decodeEntity(str)\n"
+  "local res=entities[str]\n"
+  "if res then\n"
+  "return res\n"
+  "end\n"
+  "local n\n"
+  "if str:sub(1,2)==\"#x\"then\n"
+  "n=tonumber(str:sub(3),16)\n"
+  "elseif str:sub(1,1)==\"#\"then\n"
+  "n=tonumber(str:sub(2))\n"
+  "end\n"
+  "if n then\n"
+  "return utf8Encode(n)\n"
+  "end\n"
+  "return str\n"
+  "end\n"
+  "\n"
+  "local function decodeText(txt)\n"
+  "return(txt:gsub(\"&(#\?%w+);\",decodeEntity))\n"
+  "end\n"
+  "\n"
+  "xml._decodeText=decodeText\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "xml.maxBuffer=1e7\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local chars={}\n"
+  "chars.S=\" \\t\\n\\r\"\n"
+  "chars.NameStart=\"A-Za-z:_\\128-\\255\"\n"
+  "chars.Name=chars.NameStart..\"%-%.0-9\"\n"
+  "\n"
+  "local tagPat=('^[^<]*<()([/!%\?]\?)([Name]*)[S]*().->()'):gsub('%a+',chars)\n"
+  "\n"
+  "local attrPat=(\"^[S]*([Name]*)[S]*=[S]*(['\\\"])()\"):gsub('%a+',chars)\n"
+  "\n"
+  "local closePat=(\"^[S]*(/\?)>()\"):gsub('%a+',chars)\n"
+  "\n"
+  "\n"
+  "local function SAX(text,fnText,fnStart,fnEnd,fnComm,fnPI)\n"
+  "local function NoOp()end\n"
+  "fnText=fnText or NoOp\n"
+  "fnStart=fnStart or NoOp\n"
+  "fnEnd=fnEnd or NoOp\n"
+  "fnComm=fnComm or NoOp\n"
+  "fnPI=fnPI or NoOp\n"
+  "local maxBuffer=xml.maxBuffer\n"
+  "local tEmpty={}\n"
+  "local pos=1\n"
+  "\n"
+  "local reader\n"
+  "if type(text)==\"function\"then\n"
+  "reader=text\n"
+  "text=reader()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local posEnd\n"
+  "local function getText()\n"
+  "return decodeText(text:sub(pos,posEnd))\n"
+  "end\n"
+  "local function getCDATA()\n"
+  "return text:sub(pos,posEnd)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function more()\n"
+  "local moreData=reader and reader()\n"
+  "if moreData then\n"
+  "assert(#text<maxBuffer,\"xml: buffering limit reached\")\n"
+  "text=text:sub(pos)..moreData\n"
+  "pos=1\n"
+  "return true\n"
+  "end\n"
+  "reader=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function matchStream(pat)\n"
+  "local a,b,c\n"
+  "repeat\n"
+  "a,b,c=text:match(pat,pos)\n"
+  "until a or not more()\n"
+  "return a,b,c\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readAttrs()\n"
+  "local name,quot,pos2,val,close\n"
+  "local t={}\n"
+  "\n"
+  "while true do\n"
+  "name,quot,pos2=matchStream(attrPat)\n"
+  "if not name then\n"
+  "break\n"
+  "end\n"
+  "pos=pos2\n"
+  "\n"
+  "val,pos2=matchStream(\"(.-)\"..quot..\"()\")\n"
+  "assert(pos2,\"xml: bad attribute value\")\n"
+  "pos=pos2\n"
+  "\n"
+  "t[name]=decodeText(val)\n"
+  "end\n"
+  "\n"
+  "close,pos2=matchStream(closePat)\n"
+  "assert(pos2,\"xml: bad attribute\")\n"
+  "\n"
+  "pos=pos2 or#text+1\n"
+  "return t,(close~=\"\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local pos0,tch,name,pos1,pos2\n"
+  "while true do\n"
+  "\n"
+  "\n"
+  "repeat\n"
+  "pos0,tch,name,pos1,pos2=text:match(tagPat,pos)\n"
+  "if pos0 then break end\n"
+  "pos0=#text+2\n"
+  "until not more()\n"
+  "\n"
+  "posEnd=pos0-2\n"
+  "if posEnd>=pos then\n"
+  "fnText(text,getText)\n"
+  "end\n"
+  "\n"
+  "pos=pos2\n"
+  "if tch==\"\"then\n"
+  "\n"
+  "\n"
+  "\n"
+  "local attrs=tEmpty\n"
+  "local bClose\n"
+  "if pos2>pos1+1 then\n"
+  "\n"
+  "if pos2==pos1+2 and text:sub(pos1,pos1+1)==\"/>\"then\n"
+  "\n"
+  "bClose=true\n"
+  "else\n"
+  "\n"
+  "pos=pos1\n"
+  "attrs,bClose=readAttrs()\n"
+  "end\n"
+  "end\n"
+  "fnStart(name,attrs)\n"
+  "if bClose then\n"
+  "fnEnd(name)\n"
+  "end\n"
+  "\n"
+  "elseif tch==\"/\"then\n"
+  "\n"
+  "\n"
+  "\n"
+  "fnEnd(name)\n"
+  "\n"
+  "elseif tch==\"!\"then\n"
+  "\n"
+  "\n"
+  "\n"
+  "if text:match(\"^!%-%-\",pos0)then\n"
+  "pos=pos0+3\n"
+  "pos2=matchStream(\"%-%->()\")\n"
+  "fnComm(text,pos,pos2 and pos2-4 or#text)\n"
+  "pos=pos2\n"
+  "\n"
+  "elseif text:match(\"^!%[CDATA%[\",pos0)then\n"
+  "pos=pos0+8\n"
+  "pos2=matchStream(\"%]%]>()\")or#text+4\n"
+  "posEnd=pos2-4\n"
+  "fnText(text,getCDATA)\n"
+  "pos=pos2\n"
+  "\n"
+  "else\n"
+  "error(\"xml: unrecognized tag: \"..text:sub(pos0-1,pos0+7))\n"
+  "end\n"
+  "\n"
+  "elseif tch==\"\?\"then\n"
+  "\n"
+  "\n"
+  "pos=pos1\n"
+  "pos2=matchStream(\"%\?>()\")or#text+3\n"
+  "fnPI(name,text,pos,pos2-3)\n"
+  "pos=pos2\n"
+  "\n"
+  "else\n"
+  "break\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml._luaSAX(...)\n"
+  "return pcall(SAX,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "if xml_c then\n"
+  "local nativeSAX=xml_c.SAX\n"
+  "\n"
+  "function xml.SAX(text,fnText,fnStart,fnEnd,fnComm,fnPI)\n"
+  "return pcall(nativeSAX,text,fnText,fnStart,fnEnd,fnComm,fnPI,\n"
+  "xml.maxBuffer)\n"
+  "end\n"
+  "else\n"
+  "xml.SAX=xml._luaSAX\n"
+  "end\n"
+  "\n"
+  "xml.isNative=(xml_c~=nil)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "xml.MatchTextKey=\"<text>\"\n"
+  "xml.DefaultKey=\"<default>\"\n"
+  "xml.ActionKey=\"<action>\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml.CaptureText(pattern)\n"
+  "return{\n"
+  "[xml.MatchTextKey]=pattern or\"^%s*([^%s].-)%s*$\"\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml.CaptureAll(pattern)\n"
+  "local t=xml.CaptureText(pattern)\n"
+  "t[xml.DefaultKey]=t\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml.TextNode(pattern,delim)\n"
+  "local t=xml.CaptureText(pattern)\n"
+  "local function action(parent,key,child)\n"
+  "parent[key]=child[2]and concat(child,delim)or child[1]or\"\"\n"
+  "end\n"
+  "t[xml.ActionKey]=action\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function xml.NewAction(node,action)\n"
+  "local me={}\n"
+  "for k,v in pairs(node)do\n"
+  "me[k]=v\n"
+  "end\n"
+  "\n"
+  "me[xml.ActionKey]=action\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml.ByName(node)\n"
+  "local oldaction=node[xml.ActionKey]or rawset\n"
+  "\n"
+  "local function action(parent,key,child)\n"
+  "return oldaction(parent,child._type,child)\n"
+  "end\n"
+  "return xml.NewAction(node,action)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml.ListByName(node)\n"
+  "local oldaction=node[xml.ActionKey]or rawset\n"
+  "\n"
+  "local function action(parent,key,child)\n"
+  "key=child._type\n"
+  "local list=parent[key]\n"
+  "if type(list)~=\"table\"then\n"
+  "list={}\n"
+  "parent[key]=list\n"
+  "end\n"
+  "return oldaction(list,#list+1,child)\n"
+  "end\n"
+  "return xml.NewAction(node,action)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "xml.STRING=xml.ByName(xml.TextNode())\n"
+  "\n"
+  "\n"
+  "xml.STRING[xml.ActionKey]=function(t,k,v)\n"
+  "t[v._type]=v[2]and concat(v)or v[1]or\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "xml.STRING_LIST=xml.ListByName(xml.TextNode(nil,\"\\n\"))\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "xml.numberNode={\n"
+  "[xml.MatchTextKey]=true,\n"
+  "[xml.ActionKey]=function(t,k,v)t[k]=tonumber(v[1])end\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "xml.NUMBER={\n"
+  "[xml.MatchTextKey]=true,\n"
+  "[xml.ActionKey]=function(t,k,v)t[v._type]=tonumber(v[1])end,\n"
+  "}\n"
+  "\n"
+  "xml.NUMBER_LIST=xml.ListByName(xml.numberNode)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "xml.ERROR={\n"
+  "[xml.ActionKey]=function(t,k,v)error(\"xml: unexpected node: \"..v._type)end\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xml.DOM(text,map)\n"
+  "local matchAnyElem=xml.DefaultKey\n"
+  "local matchText=xml.MatchTextKey\n"
+  "local actionKey=xml.ActionKey\n"
+  "\n"
+  "local root={}\n"
+  "local mapStack={}\n"
+  "local nullMap={}\n"
+  "local node=root\n"
+  "local deep=0\n"
+  "local parent={}\n"
+  "setmetatable(parent,{__mode=\"k\"})\n"
+  "\n"
+  "map=map or xml.CaptureAll()\n"
+  "\n"
+  "local function Start(elem,attrs)\n"
+  "if deep>0 then\n"
+  "deep=deep+1\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "insert(mapStack,map)\n"
+  "map=map[elem]or map[matchAnyElem]\n"
+  "if map then\n"
+  "\n"
+  "local newNode={\n"
+  "_type=elem,\n"
+  "}\n"
+  "parent[newNode]=node\n"
+  "for k,v in pairs(attrs)do\n"
+  "newNode[k]=v\n"
+  "end\n"
+  "node=newNode\n"
+  "else\n"
+  "\n"
+  "deep=1\n"
+  "map=nullMap\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function End(elem)\n"
+  "if deep>0 then\n"
+  "deep=deep-1\n"
+  "if deep==0 then\n"
+  "map=remove(mapStack)\n"
+  "end\n"
+  "else\n"
+  "local child=node\n"
+  "node=parent[node]\n"
+  "local action=map[actionKey]\n"
+  "if action then\n"
+  "action(node,#node+1,child)\n"
+  "else\n"
+  "node[#node+1]=child\n"
+  "end\n"
+  "map=remove(mapStack)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function Text(data,getit)\n"
+  "local pat=map[matchText]\n"
+  "if pat then\n"
+  "local txt=getit()\n"
+  "local cap=pat==true and txt or txt:match(pat)\n"
+  "if cap then\n"
+  "insert(node,cap)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function Comment(txt,a,b)\n"
+  "local action=map[actionKey]or rawset\n"
+  "if action then\n"
+  "action(node,#node+1,{_type=\"_comment\",txt:sub(a,b)})\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function PI(name,txt,a,b)\n"
+  "local action=map[actionKey]or rawset\n"
+  "if action then\n"
+  "action(node,#node+1,{_type=\"_pi_\"..name,txt:sub(a,b)})\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local succ,err=xml.SAX(text,Text,Start,End,Comment,PI)\n"
+  "if not succ then\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "while mapStack[1]do\n"
+  "End()\n"
+  "end\n"
+  "\n"
+  "return root\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return xml\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local char=string.char\n"
+  "local byte=string.byte\n"
+  "local match=string.match\n"
+  "local modf=math.modf\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(n)\n"
+  "if n<=0x7F then\n"
+  "return char(n)\n"
+  "end\n"
+  "if n<=0x7FF then\n"
+  "local a\n"
+  "a,n=modf(n/64)\n"
+  "return char(192+a,128+n*64)\n"
+  "end\n"
+  "if n<=0xFFFF then\n"
+  "local a,b\n"
+  "a,n=modf(n/4096)\n"
+  "b,n=modf(n*64)\n"
+  "return char(224+a,128+b,128+n*64)\n"
+  "end\n"
+  "if n<=0x10FFFF then\n"
+  "local a,b,c\n"
+  "a,n=modf(n/262144)\n"
+  "b,n=modf(n*64)\n"
+  "c,n=modf(n*64)\n"
+  "return char(240+a,128+b,128+c,128+n*64)\n"
+  "end\n"
+  "error(\"utf8: bad argument #1 to 'encode'\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mbpattern=\"[\\128-\\255][\\128-\\191]*\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaDecode(s,ferr)\n"
+  "\n"
+  "local n,min\n"
+  "if match(s,\"^[\\192-\\223][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(byte(s,1)-192)*64+byte(s,2)-128\n"
+  "min=0x80\n"
+  "elseif match(s,\"^[\\224-\\239][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=((byte(s,1)-224)*64+byte(s,2)-128)*64+byte(s,3)-128\n"
+  "min=0x800\n"
+  "elseif match(s,\"^[\\240-\\244][\\128-\\191][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(((byte(s,1)-240)*64+byte(s,2)-128)*64+byte(s,3)-128)*64+byte(s,4)-128\n"
+  "min=0x10000\n"
+  "elseif match(s,\"^[%z\\1-\\127]$\")then\n"
+  "\n"
+  "n=byte(s,1)\n"
+  "min=0\n"
+  "else\n"
+  "n=-1\n"
+  "min=0\n"
+  "end\n"
+  "if n>=min then\n"
+  "return n\n"
+  "end\n"
+  "if(ferr)then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaValidate(str)\n"
+  "for s in str:gmatch(mbpattern)do\n"
+  "luaDecode(s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local decode,validate=luaDecode,luaValidate\n"
+  "\n"
+  "if succ then\n"
+  "local utf8Decode,utf8Check=textcodec_c.utf8Decode,textcodec_c.utf8Check\n"
+  "\n"
+  "function decode(s,ferr)\n"
+  "local n,valid=utf8Decode(s)\n"
+  "if valid then\n"
+  "return n\n"
+  "elseif ferr then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function validate(str)\n"
+  "local a,b=utf8Check(str)\n"
+  "if a then\n"
+  "decode(str:sub(a,b))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gsub=string.gsub\n"
+  "\n"
+  "local function b2c(c)\n"
+  "local n=byte(c)\n"
+  "if n<192 then\n"
+  "return\"\\194\"..c\n"
+  "end\n"
+  "return\"\\195\"..char(n-64)\n"
+  "end\n"
+  "\n"
+  "local function binToChars(str)\n"
+  "return(gsub(str,\"[\\128-\\255]\",b2c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function c2b(s)\n"
+  "return char((byte(s)-194)*64+byte(s,2))\n"
+  "end\n"
+  "\n"
+  "local function charsToBin(str)\n"
+  "return(gsub(str,\"[\\194\\195][\\128-\\255]\",c2b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=encode,\n"
+  "decode=decode,\n"
+  "validate=validate,\n"
+  "mbpattern=mbpattern,\n"
+  "binToChars=binToChars,\n"
+  "charsToBin=charsToBin,\n"
+  "isNative=succ,\n"
+  "\n"
+  "_luaDecode=luaDecode,\n"
+  "_luaValidate=luaValidate,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+extern int luaopen_xml_c(lua_State *);
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@xml.lua", (const char *) data1, 6597, 0 },
+   { "utf8utils", "@utf8utils.lua", (const char *) data2, 2235, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c },
+   { "xml_c", 0, (const char *) 0, 0, luaopen_xml_c }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
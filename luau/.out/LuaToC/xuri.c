@@ -0,0 +1,583 @@
+// Generated by cfromlua
+// lib: .out/exports/textcodec_c.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function hexToByte(s)\n"
+  "return string.char(tonumber(s,16))\n"
+  "end\n"
+  "\n"
+  "local function byteToHex(ch)\n"
+  "return string.format(\"%%%02X\",string.byte(ch))\n"
+  "end\n"
+  "\n"
+  "local function pctDecode(s)\n"
+  "return(s:gsub(\"%%(%x%x)\",hexToByte))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function paramDecode(s)\n"
+  "return pctDecode(s:gsub(\"%+\",\" \"))\n"
+  "end\n"
+  "\n"
+  "local function paramEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~ ])\",byteToHex):gsub(\" \",\"+\"))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local pathDecode=pctDecode\n"
+  "\n"
+  "local function pathEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~/%+])\",byteToHex))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local authorityDecode=pctDecode\n"
+  "\n"
+  "local function authorityEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~:%+])\",byteToHex))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function schemeNorm(s)\n"
+  "if s:match(\"^[%w%+%-%.]+$\")then\n"
+  "return s:lower()\n"
+  "end\n"
+  "error(\"URI handling: Invalid scheme\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseParams(str)\n"
+  "local t={}\n"
+  "if str then\n"
+  "for fld in str:gmatch(\"[^&;]+\")do\n"
+  "local k,v=fld:match(\"([^=]*)=(.*)\")\n"
+  "if k then\n"
+  "t[paramDecode(k)]=paramDecode(v)\n"
+  "elseif fld~=\"\"then\n"
+  "table.insert(t,paramDecode(fld))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local luaImpl={\n"
+  "pctDecode=pctDecode,\n"
+  "paramDecode=paramDecode,\n"
+  "paramEncode=paramEncode,\n"
+  "pathEncode=pathEncode,\n"
+  "authorityEncode=authorityEncode,\n"
+  "parseParams=parseParams,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "if succ then\n"
+  "pctDecode=textcodec_c.pctDecode\n"
+  "paramDecode=textcodec_c.paramDecode\n"
+  "paramEncode=textcodec_c.paramEncode\n"
+  "pathEncode=textcodec_c.pathEncode\n"
+  "authorityEncode=textcodec_c.authorityEncode\n"
+  "parseParams=textcodec_c.parseParams\n"
+  "pathDecode=pctDecode\n"
+  "authorityDecode=pctDecode\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function makeParams(t)\n"
+  "if not t or not next(t)then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "local a={}\n"
+  "for n,v in ipairs(t)do\n"
+  "if type(v)==\"string\"and v~=\"\"then\n"
+  "table.insert(a,paramEncode(v))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local map={}\n"
+  "for k,v in pairs(t)do\n"
+  "if type(k)==\"string\"and type(v)==\"string\"then\n"
+  "table.insert(map,paramEncode(k)..\"=\"..paramEncode(tostring(v)))\n"
+  "end\n"
+  "end\n"
+  "if map[1]then\n"
+  "table.sort(map)\n"
+  "table.insert(a,table.concat(map,\";\"))\n"
+  "end\n"
+  "\n"
+  "return table.concat(a,\";\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriToString(t)\n"
+  "if type(t)==\"string\"then return t end\n"
+  "if type(t)~=\"table\"then error(\"uri handling: Invalid type for URI: \"..type(t))end\n"
+  "\n"
+  "local query=t.params\n"
+  "if type(query)==\"table\"then\n"
+  "query=makeParams(query)\n"
+  "end\n"
+  "local path=t.path or\"\"\n"
+  "\n"
+  "return(t.scheme and schemeNorm(t.scheme)..\":\"or\"\")\n"
+  "..(t.authority and\"//\"..authorityEncode(t.authority)or\"\")\n"
+  "..((t.authority and path:sub(1,1)~=\"/\")and\"/\"or\"\")\n"
+  "..pathEncode(path)\n"
+  "..(t.version and\"@\"..paramEncode(t.version)or\"\")\n"
+  "..(query and\"\?\"..query or\"\")\n"
+  "..(t.fragment and\"#\"..paramEncode(t.fragment)or\"\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriToTable(uri)\n"
+  "if not uri then return{}end\n"
+  "if type(uri)==\"table\"then return uri end\n"
+  "if type(uri)~=\"string\"then error(\"Invalid type for URI: \"..type(uri))end\n"
+  "\n"
+  "local s,h,p,v,q,u,f\n"
+  "\n"
+  "s,u=uri:match(\"^([%w%+%-%.]+)%:(.*)\")\n"
+  "uri=u or uri\n"
+  "h,u=uri:match(\"^//([^/]*)(.*)\")\n"
+  "p,uri=(u or uri):match(\"^([^@%\?#]*)(.*)\")\n"
+  "v,u=uri:match(\"@([^%\?#]*)(.*)\")\n"
+  "uri=u or uri\n"
+  "q,u=uri:match(\"^%\?([^#]*)(.*)\")\n"
+  "uri=u or uri\n"
+  "f=uri:match(\"^#(.*)\")\n"
+  "\n"
+  "return{\n"
+  "scheme=s,\n"
+  "authority=h and authorityDecode(h),\n"
+  "path=pathDecode(p),\n"
+  "version=v and paramDecode(v),\n"
+  "params=q and parseParams(q),\n"
+  "fragment=f and paramDecode(f)\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function dir(str,pos)\n"
+  "while pos>0 and str:sub(pos,pos)~=\"/\"do\n"
+  "pos=pos-1\n"
+  "end\n"
+  "return str:sub(1,pos),pos\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function cleanPath(path)\n"
+  "local n,e,post=1\n"
+  "repeat\n"
+  "n,e,post=path:match(\"/()(%.%.\?)([^/]\?)\",n)\n"
+  "if n and post==\"\"then\n"
+  "if e==\".\"then\n"
+  "path=path:sub(1,n-1)..path:sub(n+2)\n"
+  "else\n"
+  "local pre,a=dir(path,n-2)\n"
+  "local parent=path:sub(a+1,n-2)\n"
+  "if parent~=\"..\"then\n"
+  "if parent==\"\"then pre=pre..\"/\"end\n"
+  "path=pre..path:sub(n+3)\n"
+  "n=a\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "until not n\n"
+  "\n"
+  "return path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function resolve(r,b)\n"
+  "r=uriToTable(r)\n"
+  "b=uriToTable(b)\n"
+  "\n"
+  "local path,pb=r.path or\"\",b.path or\"\"\n"
+  "if r.scheme then\n"
+  "\n"
+  "elseif path==\"\"then\n"
+  "path=pb\n"
+  "elseif path:sub(1,1)~=\"/\"then\n"
+  "path=dir(pb,#pb)..path\n"
+  "end\n"
+  "path=cleanPath(path)\n"
+  "\n"
+  "return{\n"
+  "scheme=r.scheme or b.scheme,\n"
+  "authority=r.authority or(not r.scheme and b.authority or nil),\n"
+  "path=path,\n"
+  "version=r.version or b.version,\n"
+  "params=r.params,\n"
+  "fragment=r.fragment\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parse(uri,base)\n"
+  "if base then\n"
+  "uri=resolve(uri,base)\n"
+  "end\n"
+  "return uriToTable(uri)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gen(uri,base)\n"
+  "if base then\n"
+  "uri=resolve(uri,base)\n"
+  "end\n"
+  "return uriToString(uriToTable(uri))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "parse=parse,\n"
+  "gen=gen,\n"
+  "cleanPath=cleanPath,\n"
+  "byteToHex=byteToHex,\n"
+  "pctDecode=pctDecode,\n"
+  "paramDecode=paramDecode,\n"
+  "isNative=succ,\n"
+  "_lua=luaImpl,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@xuri.lua", (const char *) data1, 4523, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
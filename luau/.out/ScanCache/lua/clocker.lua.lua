@@ -0,0 +1 @@
+return {value={},path="clocker.lua",stamp="2904:1171572:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={"require","csv_c"},path="csv.lua",stamp="17523:1171574:65024:1792374961"}
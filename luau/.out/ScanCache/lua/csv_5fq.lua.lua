@@ -0,0 +1 @@
+return {path="csv_q.lua",value={"require","qtest","require","csv","require","csv_c"},stamp="9486:1172757:65024:1792373680"}
@@ -0,0 +1 @@
+return {stamp="3877:1175523:65024:1792371858",path="deflate_c_q.lua",value={"require","qtest","require","deflate_c"}}
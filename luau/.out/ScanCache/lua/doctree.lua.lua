@@ -0,0 +1 @@
+return {path="doctree.lua",stamp="2797:1171576:65024:1792361468",value={"require","memoize"}}
@@ -0,0 +1 @@
+return {stamp="840:1171577:65024:1792361468",path="doctree_q.lua",value={"require","qtest","require","doctree"}}
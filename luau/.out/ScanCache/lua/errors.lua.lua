@@ -0,0 +1 @@
+return {stamp="2283:1171578:65024:1792361468",path="errors.lua",value={"require","debug"}}
@@ -0,0 +1 @@
+return {stamp="2985:1171579:65024:1792361468",path="errors_q.lua",value={"require","qtest","require","errors"}}
@@ -0,0 +1 @@
+return {path="fsu.lua",value={},stamp="8210:1171580:65024:1792361468"}
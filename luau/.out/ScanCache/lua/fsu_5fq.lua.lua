@@ -0,0 +1 @@
+return {value={"require","qtest","require","fsu"},path="fsu_q.lua",stamp="4597:1171581:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="5855:1171582:65024:1792361468",path="getopts.lua",value={}}
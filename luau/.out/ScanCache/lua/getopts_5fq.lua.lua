@@ -0,0 +1 @@
+return {stamp="1735:1171583:65024:1792361468",path="getopts_q.lua",value={"require","qtest","require","getopts"}}
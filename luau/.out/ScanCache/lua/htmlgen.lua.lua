@@ -0,0 +1 @@
+return {path="htmlgen.lua",value={"require","object","require","utf8utils","require","doctree","require","opairs","require","textcodec_c"},stamp="11797:1171584:65024:1792374996"}
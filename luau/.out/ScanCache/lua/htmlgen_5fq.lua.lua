@@ -0,0 +1 @@
+return {value={"require","qtest","require","doctree","require","htmlgen"},path="htmlgen_q.lua",stamp="2590:1171585:65024:1792375001"}
@@ -0,0 +1 @@
+return {value={"require","utf8utils"},path="json.lua",stamp="6442:1171586:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","json","require","clocker","require","serialize"},path="json_q.lua",stamp="2793:1171588:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="3368:1171589:65024:1792374831",value={"require","xpfs","require","fsu"},path="lfsu.lua"}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","xpfs","require","lfsu"},path="lfsu_q.lua",stamp="1951:1171590:65024:1792374831"}
@@ -0,0 +1 @@
+return {stamp="5299:1171591:65024:1792361468",path="list.lua",value={"require","object","require","serialize"}}
@@ -0,0 +1 @@
+return {value={"require","list"},path="list_q.lua",stamp="8647:1171592:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="memoize.lua",stamp="2577:1171594:65024:1792361468",value={}}
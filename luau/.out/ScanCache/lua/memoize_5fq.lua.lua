@@ -0,0 +1 @@
+return {value={"require","qtest","require","memoize","require","clocker"},path="memoize_q.lua",stamp="3386:1171595:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="2880:1171596:65024:1792361468",path="minify.lua",value={}}
@@ -0,0 +1 @@
+return {stamp="2562:1171597:65024:1792361468",path="minify_q.lua",value={"require","qtest","require","minify"}}
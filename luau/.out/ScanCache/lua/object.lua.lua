@@ -0,0 +1 @@
+return {stamp="676:1171598:65024:1792361468",path="object.lua",value={}}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","object"},stamp="1035:1171600:65024:1792361468",path="object_q.lua"}
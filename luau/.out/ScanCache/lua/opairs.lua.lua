@@ -0,0 +1 @@
+return {path="opairs.lua",stamp="870:1171601:65024:1792361468",value={}}
@@ -0,0 +1 @@
+return {path="opairs_q.lua",value={"require","qtest","require","opairs"},stamp="573:1171602:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="qtest.lua",value={"require","debug"},stamp="13597:1171603:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={"require","qtest"},path="qtest_q.lua",stamp="3089:1171604:65024:1792361468"}
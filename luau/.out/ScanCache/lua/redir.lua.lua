@@ -0,0 +1 @@
+return {path="redir.lua",value={"require","debug"},stamp="6755:1171605:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="2002:1171606:65024:1792361468",path="redir_q.lua",value={"require","redir","require","qtest"}}
@@ -0,0 +1 @@
+return {stamp="506:1171608:65024:1792361468",path="requirefile_q.lua",value={"require","qtest","require","requirefile","requirefile","requirefile/requirefile_q.lua"}}
@@ -0,0 +1 @@
+return {path="scancache.lua",value={"require","xpfs","require","serialize","require","lfsu"},stamp="3593:1172829:65024:1792374747"}
@@ -0,0 +1 @@
+return {stamp="1692:1172866:65024:1792374783",value={"require","qtest","require","scancache","require","lfsu","require","xpfs","require","x","require","yy","require","z"},path="scancache_q.lua"}
@@ -0,0 +1 @@
+return {path="serialize.lua",value={},stamp="4036:1171609:65024:1792361468"}
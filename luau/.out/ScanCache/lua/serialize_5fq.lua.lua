@@ -0,0 +1 @@
+return {value={"require","qtest","require","serialize"},path="serialize_q.lua",stamp="1176:1171610:65024:1792361468"}
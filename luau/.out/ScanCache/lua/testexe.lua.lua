@@ -0,0 +1 @@
+return {path="testexe.lua",value={"require","object","require","redir","require","xpexec"},stamp="9711:1171611:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="testexe_q.lua",value={"require","qtest","require","testexe","require","list"},stamp="2230:1171612:65024:1792361468"}
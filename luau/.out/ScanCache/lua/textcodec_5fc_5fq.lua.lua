@@ -0,0 +1 @@
+return {path="textcodec_c_q.lua",stamp="3002:1175476:65024:1792371858",value={"require","qtest","require","xuri","require","utf8utils","require","htmlgen","require","textcodec_c"}}
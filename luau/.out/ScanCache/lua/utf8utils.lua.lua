@@ -0,0 +1 @@
+return {path="utf8utils.lua",value={"require","textcodec_c"},stamp="4007:1172726:65024:1792374931"}
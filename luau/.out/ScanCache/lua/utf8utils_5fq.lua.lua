@@ -0,0 +1 @@
+return {path="utf8utils_q.lua",value={"require","qtest","require","utf8utils"},stamp="2205:1171616:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="xml.lua",value={"require","utf8utils","require","xml_c"},stamp="13542:1171617:65024:1792374954"}
@@ -0,0 +1 @@
+return {path="xml_q.lua",value={"require","qtest","require","xml"},stamp="9144:1175846:65024:1792375205"}
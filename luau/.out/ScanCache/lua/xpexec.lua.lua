@@ -0,0 +1 @@
+return {path="xpexec.lua",value={},stamp="5282:1171620:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="2473:1171621:65024:1792361468",path="xpexec_q.lua",value={"require","qtest","require","list"}}
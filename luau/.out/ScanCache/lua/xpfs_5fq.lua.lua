@@ -0,0 +1 @@
+return {stamp="5290:1171624:65024:1792374831",path="xpfs_q.lua",value={"require","qtest","require","xpfs"}}
@@ -0,0 +1 @@
+return {path="xuri.lua",value={"require","textcodec_c"},stamp="12476:1171625:65024:1792374891"}
@@ -0,0 +1 @@
+return {path="xuri_q.lua",stamp="7703:1171626:65024:1792361468",value={"require","qtest"}}
@@ -0,0 +1,602 @@
+-- CSV: read/write Comma-Separated Value files
+--
+-- This module defines and supports a file format for tabular data that
+-- allows metadata such as column names to be included, while maximizing
+-- compatibility with existing software packages that claim to support "CSV"
+-- formats.  This format uses only ASCII text characters for delimiters and
+-- escape characters, but it can be used to store binary data.  When table
+-- cell contents are all ASCII, the resulting CSV file will contain only
+-- ASCII characters.
+--
+-- Metadata is contained in lines that begin with a "#" character at the
+-- start of the file.  Afer the first non-metadata line, a line with an
+-- initial "#" will be treated as ordinary data.
+--
+-- The following formats for metadata lines are supported:
+--
+--   #csv a,b,...       Specifies column names.
+--
+--   #set name=value    Gives a name and value to be added to each row as if
+--                      'name' were in '#csv' and 'value' appeared on every line.
+--
+--   # ...text...       Ignored; intended for human-readable comments.  A space
+--                      after the "#" ensures that the line will not conflict
+--                      with future extensions to the syntax.
+--
+-- Column names specified after #csv and the 'value' part of #set are
+-- encoded just as table rows are encoded, except that they may not
+-- contain line breaks.
+--
+-- Table data follows the metadata lines.  Each row is terminated with a
+-- newline (ASCII 10) character, optionally preceded by a carriage return
+-- (ASCII 13) character.  Values within a row are separated by commas.
+--
+-- Values may not contain commas or newlines unless the value is surrounded
+-- by double-quote (ASCII 34) characters.  Inside a quoted value, any
+-- embedded double-quote character is represented by two consecutive
+-- double-quote characters.
+--
+-- API
+--
+-- csv.decode(text, [columns])
+--
+--   Returns a table that contains an array of rows and a member called
+--   'info' that contains any metainformation.
+--
+--   When column names are not known, numeric indices (1-based) are used,
+--   making each row an array.
+--
+--   For each column whose name is known, the name will be used as a key
+--   instead of the numeric index.  Column names can be assigned by a "#csv"
+--   metadata line within the file, or when that is absent, by the value of
+--   the optional 'columns' argument.  The 'columns' argument is a string
+--   containing a comma-delimited list of column names.
+--
+--   Each metadata line matching "#<name> <value>" is stored in the info
+--   table, which contains an array describing the metadata lines, in order,
+--   and also maps each <name> to its <value>:
+--
+--     #info     -> number of metadata lines
+--     info[ndx] ->  {name=<string>, value=<string>}
+--     info.<name>  = last value associated with property named <name>
+--
+--   Examples:
+--
+--       csv.decode("x,y")           ->  {{"x","y"},info={}}
+--       csv.decode("x\ny")          ->  {{"x"},{"y"},info={}}
+--       csv.decode("x,y", "a,b")    ->  {{a="x",b="y"},info={}}
+--       csv.decode("#csv a,b\nx,y") ->  {{a="x",b="y"},info=...}
+--
+--   In the last example, info = { {name="csv",value="a,b"}, csv="a,b"}.
+--
+-- csv.loadFile(fname, [columns])
+--
+--   Read CSV file from file named 'fname' and decode it.  The result is
+--   as described for 'decode'.
+--
+-- csv.rows(source, [columns])
+--
+--   Return an iterator that reads one row at a time, and the 'info' table
+--   (as described for 'decode').  'source' is a string or a 'read' function
+--   that returns successive chunks of text and then nil (e.g. a function
+--   that calls f:read(65536)).
+--
+--   Rows are keyed as described for 'decode'.  The iterator returns the
+--   same table for every row, so callers that retain rows must copy them.
+--
+--   Example:
+--
+--       for row in csv.rows(text, "a,b") do print(row.a, row.b) end
+--
+-- csv.decodeColumns(source, [columns], [types])
+--
+--   Read all rows from 'source' (as in 'rows') and accumulate them in
+--   one array per column.  The result is a table that contains:
+--
+--     n          -> number of rows
+--     info       -> metadata (as described for 'decode')
+--     names      -> array of column names, in order, or nil when no names
+--                   are known
+--     columns    -> table that maps each column key (the key that would be
+--                   used in a row returned by 'decode') to an array of the
+--                   values in that column
+--
+--   'types' maps column keys to "number" or "string" (the default).
+--   Values in "number" columns are converted to numbers; those that are
+--   not valid numbers are stored as nil, so use 'n', not the '#' operator,
+--   to iterate over rows.  Values specified by "#set" are stored in every
+--   row of their column.
+--
+--   Example:
+--
+--       csv.decodeColumns("#csv a,b\nx,1\ny,2", nil, {b="number"})
+--          ->  {n=2, names={"a","b"}, columns={a={"x","y"}, b={1,2}},
+--               info=...}
+--
+-- csv.newWriter(f, columns)
+--
+--   Return a function that writes one row to the opened file 'f' each
+--   time it is called, as encoded by 'encode'.  'columns' is as described
+--   for 'encode'.  Output is buffered; call the function with no argument
+--   to flush it.
+--
+-- csv.encode(tbl, columns)
+--
+--   Construct a CSV file.  The file will have one row per array element in
+--   tbl[].
+--
+--   The 'columns' argument (same format as in csv.decode) specifies
+--   the number of columns and their order, in one of three ways depending
+--   on the type of value passed:
+--
+--     number : the value gives the number of columns, which are indexed with
+--              positive integers.
+--
+--     table : the value is an array of column names to be output.  When
+--             columns.csv is true, the output will include a "#csv"
+--             metadata line describing the column names.
+--
+--     string : the value is a CSV row containing the names of columns to be
+--              output.  The resulting CSV file will contain a "#csv"
+--              metadata line containing these column names.
+--
+--              The value "a,b" is equivalent to  {"a","b",csv=true}.
+--
+--
+--   Values not present in 'tbl' will quietly generate empty strings.
+--
+--   Encode() does not recognize the 'info' field generated by decode().
+--
+--   Examples:
+--
+--       csv.encode({{"x","y"}}, 2)          ->  "x,y\n"
+--       csv.encode({{"x"},{"y"}}, 1)        ->  "x\ny\n"
+--       csv.encode({{a="x",b="y"}}, "a,b")  ->  "#csv a,b\nx,y\n"
+--
+
+local csv = {}
+
+-- readValue(text,pos) -> str, sep, posx
+--   str = decoded value
+--   sep = character(s) terminating the value: COMMA, LF, or empty string
+--   posx = position in text following the separator
+--
+local function readValue(text, pos)
+   local qstr = ""   -- quoted string may be followed by unquoted text
+
+   if text:find('^"', pos) then
+      -- Quoted string
+      local i, c
+      i = pos+1
+      repeat
+         -- find closing quote
+         c, i = text:match('"("?)()', i)
+      until c ~= '"'
+      local strEnd = i and i-2 or #text
+      qstr = text:sub(pos+1, strEnd):gsub('""', '"')
+      pos = i or #text+1
+   end
+
+   -- Unquoted string: look for next COMMA or LF
+   local v, sep, posx = text:match("([^,\r\n]*)\r*([,\n]?)()", pos)
+   return qstr..v, sep, posx
+end
+
+-- readRow(text, pos)  ->  table, posx
+--
+--    readRow() will return an array with at least one member.
+--
+local function readRow(text, pos)
+   local t = {}
+   local v,sep
+
+   repeat
+      v,sep,pos = readValue(text, pos)
+      table.insert(t, v)
+   until sep ~= ","
+   return t, pos
+end
+
+
+-- readRow(text, pos, row, eof, numeric) -> count, posx
+--
+--    Store the values in the row at `pos` in row[1...count], and clear
+--    row[count+1...].
+--
+--    When `eof` is false, more data may follow `text`, so nil is returned
+--    if the row extends to the end of `text`.
+--
+--    `numeric` is nil or a table; when numeric[ndx] is true, values in
+--    column `ndx` are converted to numbers (nil when not a number).
+--
+--    csv_c provides a native implementation of this function.
+--
+local function luaReadRow(text, pos, row, eof, numeric)
+   local count, v, sep = 0
+   repeat
+      v, sep, pos = readValue(text, pos)
+      count = count + 1
+      if numeric and numeric[count] then
+         v = tonumber(v)
+      end
+      row[count] = v
+   until sep ~= ","
+
+   if sep == "" and pos > #text and not eof then
+      return nil
+   end
+
+   for ndx = count + 1, math.huge do
+      if row[ndx] == nil then break end
+      row[ndx] = nil
+   end
+   return count, pos
+end
+
+csv._luaReadRow = luaReadRow  -- for testing
+
+-- @require csv_c   (bundle the native reader, when found)
+local succ, csv_c = pcall(require, "csv_c")
+local readRowInto = succ and csv_c.readRow or luaReadRow
+
+csv.isNative = succ
+
+
+function csv.decode(text, columns)
+   local info = {}
+   local tbl = { info = info }
+   local pos = 1
+
+   -- read metadata
+   while true do
+      local mstr, posx = text:match("^#([^\n]*)\n?()", pos)
+      if not mstr then break end
+      pos = posx
+      local pname,pvalue = mstr:match("^(%w+)%s+(.-)\r*$")
+      if pname then
+         table.insert(info, {name=pname, value=pvalue})
+         info[pname] = pvalue
+      end
+   end
+
+   -- read values
+   while pos <= #text do
+      local values = {}
+      local _
+      _, pos = readRowInto(text, pos, values, true)
+      tbl[#tbl+1] = values
+   end
+
+   csv.useKeyNames(tbl, columns)
+
+   return tbl
+end
+
+-- Convert rows from array form to name->value form
+--
+function csv.useKeyNames(tbl, columns)
+
+   -- "#csv <column names>"
+   local keys = tbl.info.csv or columns
+   if keys then
+      keys = readRow(keys, 1)
+      for _,row in ipairs(tbl) do
+         for ndx,v in ipairs(row) do
+            local colname = keys[ndx]
+            if colname then
+               row[colname] = v
+               row[ndx] = nil
+            end
+         end
+      end
+   end
+
+   -- "#set <name>=<value>"
+   for _,m in ipairs(tbl.info) do
+      if m.name == "set" then
+         local name,value = m.value:match("([^=]*)=(.*)")
+         value = readValue(value, 1)
+         if name then
+            for _,row in ipairs(tbl) do
+               row[name] = value
+            end
+         end
+      end
+   end
+end
+
+-- Source: text read from a string or a 'read' function.  Unconsumed text
+-- is src.text:sub(src.pos).
+--
+local function newSource(source)
+   if type(source) == "string" then
+      return { text = source, pos = 1, eof = true }
+   end
+   return { text = "", pos = 1, eof = false, read = source }
+end
+
+-- Read more data, discarding text that precedes `pos`.  Return false at
+-- end of stream.
+--
+-- Unconsumed text is an incomplete row.  Reading at least as much again
+-- before joining it with new data means a long row is copied a constant
+-- number of times per byte, rather than once per read.
+--
+local function readMore(src)
+   if src.eof then
+      return false
+   end
+   local rest = #src.text - src.pos + 1
+   local chunks = { rest > 0 and src.text:sub(src.pos) or nil }
+   local size = 0
+   repeat
+      local data = src.read()
+      if data == nil then
+         src.eof = true
+         break
+      end
+      chunks[#chunks+1] = data
+      size = size + #data
+   until size >= rest
+   src.text = chunks[2] and table.concat(chunks) or chunks[1] or ""
+   src.pos = 1
+   return true
+end
+
+-- Read metadata lines, returning the info table.
+--
+local function readInfo(src)
+   local info = {}
+   while true do
+      local mstr, posx = src.text:match("^#([^\n]*)\n()", src.pos)
+      if not mstr and src.eof then
+         mstr, posx = src.text:match("^#([^\n]*)()", src.pos)
+      end
+      if mstr then
+         src.pos = posx
+         local pname,pvalue = mstr:match("^(%w+)%s+(.-)\r*$")
+         if pname then
+            table.insert(info, {name=pname, value=pvalue})
+            info[pname] = pvalue
+         end
+      elseif src.eof or not (src.pos > #src.text or
+                             src.text:match("^#", src.pos)) then
+         return info
+      else
+         readMore(src)
+      end
+   end
+end
+
+-- Read the next row into `values`.  Return the number of values, or nil
+-- at end of stream.
+--
+local function readNext(src, values, numeric)
+   while true do
+      if src.pos <= #src.text then
+         local count, posx = readRowInto(src.text, src.pos, values, src.eof, numeric)
+         if count then
+            src.pos = posx
+            return count
+         end
+      end
+      if not readMore(src) then
+         return nil
+      end
+   end
+end
+
+-- Return column names (or nil) and "#set" name/value pairs
+--
+local function getKeys(info, columns)
+   local keys = info.csv or columns
+   if keys then
+      keys = readRow(keys, 1)
+   end
+
+   local sets = {}
+   for _,m in ipairs(info) do
+      if m.name == "set" then
+         local name,value = m.value:match("([^=]*)=(.*)")
+         if name then
+            table.insert(sets, {name, (readValue(value, 1))})
+         end
+      end
+   end
+   return keys, sets
+end
+
+function csv.rows(source, columns)
+   local src = newSource(source)
+   local info = readInfo(src)
+   local keys, sets = getKeys(info, columns)
+   local values = {}
+   local row = keys and {} or values
+   local numKeys = keys and #keys or 0
+   local prevCount = 0
+
+   local function nextRow()
+      local count = readNext(src, values)
+      if not count then
+         return nil
+      end
+      if keys then
+         for ndx = 1, numKeys do
+            row[keys[ndx]] = values[ndx]
+         end
+         for ndx = numKeys + 1, math.max(count, prevCount) do
+            row[ndx] = values[ndx]
+         end
+         prevCount = count
+      end
+      for _, s in ipairs(sets) do
+         row[s[1]] = s[2]
+      end
+      return row
+   end
+
+   return nextRow, info
+end
+
+function csv.decodeColumns(source, columns, types)
+   types = types or {}
+   local src = newSource(source)
+   local info = readInfo(src)
+   local keys, sets = getKeys(info, columns)
+   local byKey = {}       -- byKey[key] = array for the named column
+   local result = { info = info, names = keys, n = 0, columns = byKey }
+   local numKeys = keys and #keys or 0
+   local cols = {}        -- cols[ndx] = array for column #ndx
+   local numeric = {}
+   local values = {}
+
+   local function getColumn(ndx)
+      local key = keys and keys[ndx] or ndx
+      local col = byKey[key] or {}
+      byKey[key] = col
+      cols[ndx] = col
+      numeric[ndx] = (types[key] == "number")
+      return col
+   end
+
+   for ndx = 1, numKeys do
+      getColumn(ndx)
+   end
+   -- Unnamed columns are typed by index; their arrays are created as they
+   -- are found, but conversion must apply from the first row.
+   for key, kind in pairs(types) do
+      if type(key) == "number" and key > numKeys then
+         numeric[key] = (kind == "number")
+      end
+   end
+
+   local n = 0
+   while true do
+      local count = readNext(src, values, numeric)
+      if not count then
+         break
+      end
+      n = n + 1
+      for ndx = 1, math.max(count, numKeys) do
+         local col = cols[ndx] or getColumn(ndx)
+         col[n] = values[ndx]
+      end
+   end
+   result.n = n
+
+   for _, s in ipairs(sets) do
+      local name, value = s[1], s[2]
+      if types[name] == "number" then
+         value = tonumber(value)
+      end
+      local col = {}
+      for ndx = 1, n do
+         col[ndx] = value
+      end
+      byKey[name] = col
+   end
+
+   return result
+end
+
+function csv.loadFile(file, columns)
+   local f, err = io.open(file, 'rb')
+   if not f then
+      return f, err
+   end
+
+   local text = f:read("*a")
+   f:close()
+   return csv.decode(text, columns)
+end
+
+local function quoteValue(v)
+   v = (v==nil) and "" or tostring(v)
+   if v:match("^[#%s]") or v:match('[,"\n\r]') or v:match("%s$") then
+      v = '"' .. v:gsub('"', '""') .. '"'
+   end
+   return v
+end
+
+-- Convert `columns` argument to an array of column keys (and `csv` flag)
+--
+local function getColumns(columns)
+   local cols = {}
+
+   if type(columns) == "number" then
+      for ndx = 1, columns do
+         cols[ndx] = ndx
+      end
+   elseif type(columns) == "string" then
+      cols = readRow(columns, 1)
+      cols.csv = true
+   elseif type(columns) == "table" then
+      cols = columns
+   else
+      error("csv.encode: Invalid type for 'columns'")
+   end
+   return cols
+end
+
+local function encodeHeader(cols)
+   local line = {}
+   for ndx,v in ipairs(cols) do
+      line[ndx] = quoteValue(v)
+   end
+   return "#csv " .. table.concat(line, ",")
+end
+
+local function encodeRow(row, cols)
+   local line = {}
+   for ndx,fld in ipairs(cols) do
+      line[ndx] = quoteValue( row[fld] )
+   end
+   return table.concat(line, ",")
+end
+
+-- Convert table to CSV file; return result as a single string
+--
+function csv.encode(tbl, columns)
+   local out = {}
+   local cols = getColumns(columns)
+
+   if cols.csv then
+      table.insert(out, encodeHeader(cols))
+   end
+
+   for _,row in ipairs(tbl) do
+      table.insert(out, encodeRow(row, cols))
+   end
+   table.insert(out, "")
+
+   return table.concat(out, "\n")
+end
+
+function csv.newWriter(f, columns)
+   local cols = getColumns(columns)
+   local out = {}
+
+   if cols.csv then
+      out[1] = encodeHeader(cols)
+   end
+
+   return function (row)
+      if row then
+         out[#out+1] = encodeRow(row, cols)
+      end
+      if not row or #out >= 1000 then
+         out[#out+1] = ""
+         f:write(table.concat(out, "\n"))
+         out = {}
+      end
+   end
+end
+
+-- Write CSV to opened file 'f'
+--
+function csv.writeFile(f, tbl, columns)
+   f:write(csv.encode(tbl, columns))
+   return true
+end
+
+return csv
@@ -0,0 +1,227 @@
+// csv_c: Native cell scanner for csv.lua
+//
+// `csv_c.readRow(text, pos, row, eof, numeric)` decodes one row of CSV
+// data, as described in csv.lua, storing the values in row[1...N].  See
+// `readRow` in csv.lua for details.
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lualib.h"
+#include "lauxlib.h"
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+// Longest numeric value converted without constructing a Lua string
+#define MAX_NUMBER 64
+
+
+static int isSpace(int ch)
+{
+   return ch == ' ' || (ch >= '\t' && ch <= '\r');
+}
+
+
+// Push the numeric value of `s`, or nil if it is not a number.  This
+// follows the conversion rules of `tonumber(s)` in Lua 5.2.
+//
+static void pushNumber(lua_State *L, const char *s, size_t len)
+{
+   char buf[MAX_NUMBER];
+   char *pend;
+   double n;
+
+   if (len >= MAX_NUMBER) {
+      int isNum;
+      lua_pushlstring(L, s, len);
+      n = lua_tonumberx(L, -1, &isNum);
+      lua_pop(L, 1);
+      if (isNum) {
+         lua_pushnumber(L, n);
+      } else {
+         lua_pushnil(L);
+      }
+      return;
+   }
+
+   memcpy(buf, s, len);
+   buf[len] = '\0';
+   if (strpbrk(buf, "nN") == NULL) {
+      n = strtod(buf, &pend);
+      if (pend != buf) {
+         while (isSpace((unsigned char) *pend)) {
+            ++pend;
+         }
+         if (*pend == '\0') {
+            lua_pushnumber(L, n);
+            return;
+         }
+      }
+   }
+   lua_pushnil(L);
+}
+
+
+//----------------------------------------------------------------
+// readRow(text, pos, row, eof, numeric) -> count, posx
+//
+// text = string holding CSV data
+// pos = index of the start of the row
+// row = table to hold results.  Values are stored in row[1...count], and
+//       row[count+1], row[count+2], ... are cleared.
+// eof = false if more data may follow `text`.  In that case, when a row
+//       extends to the end of `text`, nil is returned.
+// numeric = nil, or a table: numeric[ndx] == true => convert values in
+//       column `ndx` to numbers (nil when not a number)
+//
+// count = number of values in the row
+// posx = index of the start of the next row
+//----------------------------------------------------------------
+
+static int csv_c_readRow(lua_State *L)
+{
+   size_t len;
+   const char *text = luaL_checklstring(L, 1, &len);
+   lua_Integer ipos = luaL_checkinteger(L, 2);
+   int eof = lua_toboolean(L, 4);
+   int hasNumeric = !lua_isnoneornil(L, 5);
+   const char *end = text + len;
+   const char *p;
+   int count = 0;
+   int sep;
+
+   luaL_checktype(L, 3, LUA_TTABLE);
+   if (hasNumeric) {
+      luaL_checktype(L, 5, LUA_TTABLE);
+   }
+   luaL_argcheck(L, ipos >= 1 && (size_t) ipos <= len + 1, 2, "out of range");
+   p = text + ipos - 1;
+
+   do {
+      const char *qstr = NULL;   // start of quoted string
+      const char *qend = NULL;   // end of quoted string
+      int hasPairs = 0;          // true => quoted string contains `""`
+      const char *v;
+      int isNumeric = 0;
+
+      if (p < end && *p == '"') {
+         // Quoted string: find closing quote, skipping `""` pairs
+         qstr = ++p;
+         for (;;) {
+            p = memchr(p, '"', end - p);
+            if (p == NULL) {
+               qend = p = end;
+               break;
+            }
+            if (p + 1 < end && p[1] == '"') {
+               hasPairs = 1;
+               p += 2;
+            } else {
+               qend = p++;
+               break;
+            }
+         }
+      }
+
+      // Unquoted string: look for next COMMA or LF
+      v = p;
+      while (p < end && *p != ',' && *p != '\r' && *p != '\n') {
+         ++p;
+      }
+      ++count;
+
+      if (hasNumeric) {
+         lua_rawgeti(L, 5, count);
+         isNumeric = lua_toboolean(L, -1);
+         lua_pop(L, 1);
+      }
+
+      if (qstr && (hasPairs || p > v)) {
+         luaL_Buffer b;
+         const char *q = qstr;
+
+         luaL_buffinit(L, &b);
+         while (q < qend) {
+            const char *quote = memchr(q, '"', qend - q);
+            if (quote == NULL) {
+               quote = qend;
+            } else {
+               ++quote;  // include one of the two quotes
+            }
+            luaL_addlstring(&b, q, quote - q);
+            q = quote + 1;
+         }
+         luaL_addlstring(&b, v, p - v);
+         luaL_pushresult(&b);
+         if (isNumeric) {
+            size_t vlen;
+            const char *s = lua_tolstring(L, -1, &vlen);
+            pushNumber(L, s, vlen);
+            lua_remove(L, -2);
+         }
+      } else {
+         const char *s = (qstr ? qstr : v);
+         size_t slen = (qstr ? qend - qstr : p - v);
+         if (isNumeric) {
+            pushNumber(L, s, slen);
+         } else {
+            lua_pushlstring(L, s, slen);
+         }
+      }
+      lua_rawseti(L, 3, count);
+
+      while (p < end && *p == '\r') {
+         ++p;
+      }
+      sep = 0;
+      if (p < end && (*p == ',' || *p == '\n')) {
+         sep = *p++;
+      }
+   } while (sep == ',');
+
+   if (sep == 0 && p == end && !eof) {
+      // this row may continue in data that has not yet been read
+      return 0;
+   }
+
+   // clear values left over from a previous row
+   for (ipos = count + 1; ; ++ipos) {
+      lua_rawgeti(L, 3, (int) ipos);
+      if (lua_isnil(L, -1)) {
+         break;
+      }
+      lua_pop(L, 1);
+      lua_pushnil(L);
+      lua_rawseti(L, 3, (int) ipos);
+   }
+
+   lua_pushinteger(L, count);
+   lua_pushinteger(L, (lua_Integer) (p - text) + 1);
+   return 2;
+}
+
+
+static const luaL_Reg csv_c_regs[] = {
+   {"readRow", csv_c_readRow},
+   {0,0}
+};
+
+
+LUAMOD_API int luaopen_csv_c(lua_State *L);
+
+LUAMOD_API int luaopen_csv_c(lua_State *L)
+{
+   const luaL_Reg *preg;
+
+   // create table
+   lua_createtable(L, 0, ARRAY_LENGTH(csv_c_regs));
+
+   // push c functions into the table
+   for (preg = &csv_c_regs[0]; preg->func; ++preg) {
+      lua_pushcfunction(L, preg->func);
+      lua_setfield(L, -2, preg->name);
+   }
+
+   return 1;
+}
@@ -176,4 +176,175 @@ function T.encode()
 
 end
 
+-- Return a 'read' function that returns `text` in chunks of `size` bytes
+--
+local function newReader(text, size)
+   local pos = 1
+   return function ()
+      if pos <= #text then
+         local s = text:sub(pos, pos + size - 1)
+         pos = pos + size
+         return s
+      end
+   end
+end
+
+-- Collect rows (copies) from csv.rows()
+--
+local function readRows(source, columns)
+   local rows = {}
+   local prev
+   local nextRow, info = csv.rows(source, columns)
+   for row in nextRow do
+      if prev then
+         assert(row == prev)   -- table is re-used
+      end
+      prev = row
+      local copy = {}
+      for k, v in pairs(row) do
+         copy[k] = v
+      end
+      rows[#rows+1] = copy
+   end
+   rows.info = info
+   return rows
+end
+
+function T.rows()
+   local str =
+      '# comment\r\n' ..
+      '#csv a,b\n' ..
+      '#set c="x,y"\n' ..
+      '1,2\n' ..
+      '"""3""\r\n","4,"\r\n' ..
+      'x,y,z\n' ..
+      '5\n' ..
+      '"6' -- unterminated
+
+   local expected = csv.decode(str)
+   eq(5, #expected)
+   eq({a="5", b=nil, c="x,y"}, expected[4])
+
+   eq(expected, readRows(str))
+   for size = 1, #str do
+      eq(expected, readRows(newReader(str, size)))
+   end
+
+   -- a cell spanning many reads
+   local big = ("abc,\n"):rep(40000)
+   local str = 'x,"' .. big .. '",y\nz'
+   local expected = csv.decode(str)
+   eq(big, expected[1][2])
+   eq(expected, readRows(newReader(str, 16)))
+
+   -- no column names
+   local str = 'a,b\r\n\n"c\nd"'
+   local expected = csv.decode(str)
+   for size = 1, #str do
+      eq(expected, readRows(newReader(str, size)))
+   end
+   eq(expected, readRows(str))
+
+   -- column names given by caller
+   eq({{x="1",y="2"}, info={}}, readRows("1,2\n", "x,y"))
+
+   -- metadata only
+   for _, str in ipairs{ "", "#csv a", "#csv a\n", "#csv a\n#x" } do
+      for size = 1, 3 do
+         eq(csv.decode(str), readRows(newReader(str, size)))
+      end
+   end
+end
+
+function T.decodeColumns()
+   local str =
+      '#csv name,n\n' ..
+      '#set k=7\n' ..
+      'a,1\n' ..
+      'b,-2.5e1\n' ..
+      'c," 0x10 "\n' ..
+      'd,nan\n' ..
+      'e,3,extra\n'
+
+   local types = {n="number", k="number"}
+   local t = csv.decodeColumns(str, nil, types)
+   eq(5, t.n)
+   eq({"name","n"}, t.names)
+   eq("name,n", t.info.csv)
+   eq({"a","b","c","d","e"}, t.columns.name)
+   eq({1, -25, 16, nil, 3}, t.columns.n)
+   eq({7,7,7,7,7}, t.columns.k)
+   eq({[5]="extra"}, t.columns[3])
+
+   for size = 1, #str, 7 do
+      eq(t, csv.decodeColumns(newReader(str, size), nil, types))
+   end
+
+   -- no names
+   local t = csv.decodeColumns("1,2\n3\n")
+   eq({n=2, info={}, columns={{"1","3"}, {"2"}}}, t)
+
+   -- unnamed columns typed by index are converted from the first row
+   t = csv.decodeColumns("1,2\n3,4\n", nil, {[2]="number"})
+   eq({{"1","3"}, {2,4}}, t.columns)
+   t = csv.decodeColumns("#csv a\nx,1\ny,2\n", nil, {[2]="number"})
+   eq({a={"x","y"}, [2]={1,2}}, t.columns)
+
+   -- doc example
+   local info = csv.decode("#csv a,b").info
+   eq({n=2, names={"a","b"}, columns={a={"x","y"}, b={1,2}}, info=info},
+      csv.decodeColumns("#csv a,b\nx,1\ny,2", nil, {b="number"}))
+end
+
+function T.newWriter()
+   local rows = {
+      { a=1, b='"', c=',' },
+      { a='#4', x=5, c='"' },
+   }
+   for _, columns in ipairs{ "a,b,c", 3, {"a","c"} } do
+      local out = {}
+      local f = { write = function (self, s) out[#out+1] = s end }
+      local write = csv.newWriter(f, columns)
+      for _, row in ipairs(rows) do
+         write(row)
+      end
+      write()
+      eq(csv.encode(rows, columns), table.concat(out))
+   end
+end
+
+-- Compare the native and Lua implementations of readRow
+--
+function T.readRow()
+   local readRow = csv._luaReadRow
+   local native = csv.isNative and require "csv_c"
+   if not native then
+      print("csv_c not found; skipping readRow differential test")
+      return
+   end
+
+   local chars = { "a", "1", " ", ",", '"', "\r", "\n", "e", "." }
+   local numeric = { true, false, true }
+   math.randomseed(1)
+   for _ = 1, 2000 do
+      local t = {}
+      for ii = 1, math.random(0, 12) do
+         t[ii] = chars[math.random(#chars)]
+      end
+      local text = table.concat(t)
+      for pos = 1, #text + 1 do
+         for _, eof in ipairs{ true, false } do
+            local num = math.random(2) == 1 and numeric or nil
+            local ra, rb = {"x","y","z","w"}, {"x","y","z","w"}
+            local ca, pa = readRow(text, pos, ra, eof, num)
+            local cb, pb = native.readRow(text, pos, rb, eof, num)
+            eq({ca, pa}, {cb, pb})
+            if ca then
+               eq(ra, rb)
+            end
+         end
+      end
+   end
+end
+
 return qt.runTests()
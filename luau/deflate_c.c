@@ -0,0 +1,1014 @@
+// deflate_c: DEFLATE compression (RFC 1951), with gzip (RFC 1952) or zlib
+// (RFC 1950) framing
+//
+//   deflate_c.new([format], [level])     -> encoder
+//   encoder:write(data)                  -> output
+//   encoder:flush()                      -> output
+//   encoder:finish()                     -> output
+//   deflate_c.compress(data, [format], [level])  -> output
+//
+// `format` is "gzip" (the default), "zlib", or "raw".  `level` ranges from
+// 1 (fastest) to 9 (smallest); the default is 6.
+//
+// Each method returns the compressed data that is ready to be sent, which
+// may be empty.  `flush` pads the output to a byte boundary so that it
+// decodes to all the data written so far (zlib's Z_SYNC_FLUSH).  `finish`
+// ends the stream and appends the trailer.
+//
+// The encoder follows the design of zlib's: LZ77 matching with hash chains
+// over a 32KB window and lazy evaluation of matches, and a dynamic or fixed
+// Huffman code for each block, whichever is smaller.  It has no external
+// dependencies, so it can be linked into LuaExe executables.
+
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lualib.h"
+#include "lauxlib.h"
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+#define ENCODER_MT "deflate_c.Encoder"
+
+#define WSIZE         32768u       // LZ77 window size
+#define WMASK         (WSIZE - 1)
+#define HASH_BITS     15
+#define HASH_SIZE     (1u << HASH_BITS)
+#define HASH_MASK     (HASH_SIZE - 1)
+#define MIN_MATCH     3
+#define MAX_MATCH     258
+#define MIN_LOOKAHEAD (MAX_MATCH + MIN_MATCH + 1)
+#define MAX_DIST      (WSIZE - MIN_LOOKAHEAD)
+#define TOO_FAR       4096         // minimum-length matches farther than
+                                   // this are not worth it
+
+#define SYM_MAX       16384        // symbols per block
+#define L_CODES       286          // literal/length codes
+#define D_CODES       30           // distance codes
+#define BL_CODES      19           // code length codes
+#define MAX_BITS      15
+#define MAX_BL_BITS   7
+#define END_BLOCK     256
+
+enum { FMT_GZIP, FMT_ZLIB, FMT_RAW };
+
+
+//----------------------------------------------------------------
+// Static tables
+//----------------------------------------------------------------
+
+static const unsigned char extraLBits[29] = {
+   0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0
+};
+
+static const unsigned char extraDBits[D_CODES] = {
+   0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13
+};
+
+static const unsigned char extraBLBits[BL_CODES] = {
+   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,7
+};
+
+// order in which code length code lengths are sent
+static const unsigned char blOrder[BL_CODES] = {
+   16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15
+};
+
+static const struct {
+   unsigned short good;    // reduce search when we have a match this long
+   unsigned short lazy;    // do not look for a better match beyond this
+   unsigned short nice;    // stop searching at a match this long
+   unsigned short chain;   // maximum hash chain length to search
+} levels[10] = {
+   {0, 0, 0, 0},
+   {4, 4, 8, 4},
+   {4, 5, 16, 8},
+   {4, 6, 32, 32},
+   {4, 4, 16, 16},
+   {8, 16, 32, 32},
+   {8, 16, 128, 128},
+   {8, 32, 128, 256},
+   {32, 128, 258, 1024},
+   {32, 258, 258, 4096},
+};
+
+// Computed by initTables()
+static int tablesReady;
+static unsigned char lengthCode[256];     // (length - MIN_MATCH) -> code
+static unsigned short baseLength[29];
+static unsigned char distCode[512];       // see DIST_CODE()
+static unsigned short baseDist[D_CODES];
+static uint32_t crcTable[256];
+static unsigned char fixedLLen[288];
+static unsigned short fixedLCode[288];
+static unsigned char fixedDLen[D_CODES];
+static unsigned short fixedDCode[D_CODES];
+
+
+// Distance code for `dist` (distance - 1)
+#define DIST_CODE(dist) \
+   ((dist) < 256 ? distCode[dist] : distCode[256 + ((dist) >> 7)])
+
+
+static unsigned reverseBits(unsigned code, int len)
+{
+   unsigned r = 0;
+   for ( ; len > 0; --len) {
+      r = (r << 1) | (code & 1);
+      code >>= 1;
+   }
+   return r;
+}
+
+
+// Assign canonical Huffman codes (bit-reversed, as they are sent LSB
+// first) given code lengths.
+//
+static void genCodes(const unsigned char *lens, int n, unsigned short *codes)
+{
+   unsigned count[MAX_BITS + 1];
+   unsigned next[MAX_BITS + 1];
+   unsigned code = 0;
+   int i;
+
+   memset(count, 0, sizeof count);
+   for (i = 0; i < n; ++i) {
+      ++count[lens[i]];
+   }
+   count[0] = 0;
+   for (i = 1; i <= MAX_BITS; ++i) {
+      code = (code + count[i - 1]) << 1;
+      next[i] = code;
+   }
+   for (i = 0; i < n; ++i) {
+      if (lens[i]) {
+         codes[i] = (unsigned short) reverseBits(next[lens[i]]++, lens[i]);
+      }
+   }
+}
+
+
+static void initTables(void)
+{
+   unsigned code, n, length, dist;
+
+   length = 0;
+   for (code = 0; code < 28; ++code) {
+      baseLength[code] = (unsigned short) length;
+      for (n = 0; n < (1u << extraLBits[code]); ++n) {
+         lengthCode[length++] = (unsigned char) code;
+      }
+   }
+   // length 258 has its own code
+   lengthCode[255] = 28;
+   baseLength[28] = 255;
+
+   dist = 0;
+   for (code = 0; code < 16; ++code) {
+      baseDist[code] = (unsigned short) dist;
+      for (n = 0; n < (1u << extraDBits[code]); ++n) {
+         distCode[dist++] = (unsigned char) code;
+      }
+   }
+   dist >>= 7;
+   for ( ; code < D_CODES; ++code) {
+      baseDist[code] = (unsigned short) (dist << 7);
+      for (n = 0; n < (1u << (extraDBits[code] - 7)); ++n) {
+         distCode[256 + dist++] = (unsigned char) code;
+      }
+   }
+
+   for (n = 0; n < 256; ++n) {
+      uint32_t c = n;
+      int k;
+      for (k = 0; k < 8; ++k) {
+         c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      crcTable[n] = c;
+   }
+
+   for (n = 0; n < 288; ++n) {
+      fixedLLen[n] = (n < 144 ? 8 : n < 256 ? 9 : n < 280 ? 7 : 8);
+   }
+   genCodes(fixedLLen, 288, fixedLCode);
+   memset(fixedDLen, 5, sizeof fixedDLen);
+   genCodes(fixedDLen, D_CODES, fixedDCode);
+
+   tablesReady = 1;
+}
+
+
+//----------------------------------------------------------------
+// Encoder state
+//----------------------------------------------------------------
+
+typedef struct {
+   int format;
+   int started;               // header has been written
+   int finished;
+
+   // matching parameters (from `levels`)
+   unsigned goodMatch, maxLazy, niceMatch, maxChain;
+
+   // LZ77 state
+   unsigned char window[2 * WSIZE];
+   unsigned short head[HASH_SIZE];   // hash -> most recent position (0 = none)
+   unsigned short prev[WSIZE];       // position -> previous with same hash
+   unsigned strstart;                // current position in window
+   unsigned lookahead;               // bytes available at strstart
+   unsigned matchStart;
+   unsigned matchLength;
+   unsigned prevLength;
+   unsigned prevMatch;
+   int matchAvailable;               // a literal at strstart-1 is pending
+
+   // symbols of the current block
+   unsigned symCount;
+   unsigned char symLC[SYM_MAX];     // literal, or match length - MIN_MATCH
+   unsigned short symDist[SYM_MAX];  // match distance, or 0 for a literal
+   unsigned lFreq[L_CODES];
+   unsigned dFreq[D_CODES];
+
+   // output
+   luaL_Buffer *out;
+   uint32_t bitBuf;
+   int bitCount;
+
+   // checksums
+   uint32_t crc;
+   uint32_t adlerA, adlerB;
+   uint32_t size;
+} Encoder;
+
+
+static void putBits(Encoder *z, unsigned value, int len)
+{
+   z->bitBuf |= (uint32_t) value << z->bitCount;
+   z->bitCount += len;
+   while (z->bitCount >= 8) {
+      luaL_addchar(z->out, (char) (z->bitBuf & 0xFF));
+      z->bitBuf >>= 8;
+      z->bitCount -= 8;
+   }
+}
+
+
+static void alignBits(Encoder *z)
+{
+   if (z->bitCount > 0) {
+      putBits(z, 0, 8 - z->bitCount);
+   }
+}
+
+
+static void putByte(Encoder *z, unsigned b)
+{
+   luaL_addchar(z->out, (char) (b & 0xFF));
+}
+
+
+static void putBE32(Encoder *z, uint32_t n)
+{
+   putByte(z, n >> 24);
+   putByte(z, n >> 16);
+   putByte(z, n >> 8);
+   putByte(z, n);
+}
+
+
+static void putLE32(Encoder *z, uint32_t n)
+{
+   putByte(z, n);
+   putByte(z, n >> 8);
+   putByte(z, n >> 16);
+   putByte(z, n >> 24);
+}
+
+
+static void updateChecks(Encoder *z, const unsigned char *p, size_t len)
+{
+   z->size += (uint32_t) len;
+
+   if (z->format == FMT_GZIP) {
+      uint32_t c = ~z->crc;
+      size_t n;
+      for (n = 0; n < len; ++n) {
+         c = crcTable[(c ^ p[n]) & 0xFF] ^ (c >> 8);
+      }
+      z->crc = ~c;
+   } else if (z->format == FMT_ZLIB) {
+      uint32_t a = z->adlerA, b = z->adlerB;
+      while (len > 0) {
+         // 5552 is the most bytes that can be summed without overflow
+         size_t n = len < 5552 ? len : 5552;
+         len -= n;
+         while (n-- > 0) {
+            a += *p++;
+            b += a;
+         }
+         a %= 65521;
+         b %= 65521;
+      }
+      z->adlerA = a;
+      z->adlerB = b;
+   }
+}
+
+
+static void writeHeader(Encoder *z)
+{
+   static const char gzipHeader[10] = {
+      0x1f, (char) 0x8b, 8, 0, 0, 0, 0, 0, 0, (char) 0xff
+   };
+
+   if (z->format == FMT_GZIP) {
+      luaL_addlstring(z->out, gzipHeader, sizeof gzipHeader);
+   } else if (z->format == FMT_ZLIB) {
+      putByte(z, 0x78);
+      putByte(z, 0x9c);
+   }
+   z->started = 1;
+}
+
+
+static void writeTrailer(Encoder *z)
+{
+   if (z->format == FMT_GZIP) {
+      putLE32(z, z->crc);
+      putLE32(z, z->size);
+   } else if (z->format == FMT_ZLIB) {
+      putBE32(z, (z->adlerB << 16) | z->adlerA);
+   }
+}
+
+
+//----------------------------------------------------------------
+// Huffman codes and blocks
+//----------------------------------------------------------------
+
+
+// Compute lengths of a Huffman code for symbol frequencies `freq`, with
+// no length exceeding `maxBits`.  Symbols with zero frequency get length
+// zero.  At least two symbols must have non-zero frequency.
+//
+// When the optimal code is too deep, the frequencies are flattened and
+// the code rebuilt.
+//
+static void buildLengths(const unsigned *freqIn, int n, int maxBits,
+                         unsigned char *lens)
+{
+   unsigned freq[L_CODES];
+   unsigned nodeFreq[2 * L_CODES];
+   int parent[2 * L_CODES];
+   int depth[2 * L_CODES];
+   int sym[L_CODES];
+   int m, i, j, k, maxDepth;
+
+   memcpy(freq, freqIn, n * sizeof freq[0]);
+
+   for (;;) {
+      // leaves, sorted by frequency (insertion sort; n is small)
+      m = 0;
+      for (i = 0; i < n; ++i) {
+         if (freq[i]) {
+            for (j = m; j > 0 && freq[sym[j - 1]] > freq[i]; --j) {
+               sym[j] = sym[j - 1];
+            }
+            sym[j] = i;
+            ++m;
+         }
+      }
+      for (i = 0; i < m; ++i) {
+         nodeFreq[i] = freq[sym[i]];
+      }
+
+      // Combine the two least frequent nodes until one remains.  Leaves
+      // are nodes 0...m-1; internal nodes are created in order of
+      // increasing frequency, so two queues suffice.
+      i = 0;      // next leaf
+      j = m;      // next internal node
+      for (k = m; k < 2 * m - 1; ++k) {
+         int pick, two;
+         nodeFreq[k] = 0;
+         for (two = 0; two < 2; ++two) {
+            if (j >= k || (i < m && nodeFreq[i] <= nodeFreq[j])) {
+               pick = i++;
+            } else {
+               pick = j++;
+            }
+            nodeFreq[k] += nodeFreq[pick];
+            parent[pick] = k;
+         }
+      }
+
+      // parents have higher numbers than their children
+      maxDepth = 0;
+      depth[2 * m - 2] = 0;
+      for (k = 2 * m - 3; k >= 0; --k) {
+         depth[k] = depth[parent[k]] + 1;
+         if (depth[k] > maxDepth) {
+            maxDepth = depth[k];
+         }
+      }
+
+      if (maxDepth <= maxBits) {
+         break;
+      }
+      for (i = 0; i < n; ++i) {
+         if (freq[i]) {
+            freq[i] = (freq[i] >> 1) | 1;
+         }
+      }
+   }
+
+   memset(lens, 0, n);
+   for (i = 0; i < m; ++i) {
+      lens[sym[i]] = (unsigned char) depth[i];
+   }
+}
+
+
+// Ensure that at least two symbols have non-zero frequency, so that
+// buildLengths() yields a complete code.
+//
+static void ensureTwo(unsigned *freq, int n)
+{
+   int i, used = 0;
+   for (i = 0; i < n; ++i) {
+      used += (freq[i] != 0);
+   }
+   for (i = 0; used < 2; ++i) {
+      if (!freq[i]) {
+         freq[i] = 1;
+         ++used;
+      }
+   }
+}
+
+
+// Run-length encode the code lengths `lens[0...n-1]` with code length codes
+// 0-18 [RFC 1951 3.2.7].  Each entry of `out` is a symbol plus (extra bits
+// << 5).  Returns the number of entries.
+//
+static int encodeLengths(const unsigned char *lens, int n, unsigned *out)
+{
+   int i = 0, count = 0;
+
+   while (i < n) {
+      int cur = lens[i], run = 1;
+      while (i + run < n && lens[i + run] == cur) {
+         ++run;
+      }
+      i += run;
+      if (cur == 0) {
+         while (run >= 11) {
+            int r = run < 138 ? run : 138;
+            out[count++] = 18 | ((unsigned) (r - 11) << 5);
+            run -= r;
+         }
+         if (run >= 3) {
+            out[count++] = 17 | ((unsigned) (run - 3) << 5);
+            run = 0;
+         }
+      } else {
+         out[count++] = (unsigned) cur;
+         --run;
+         while (run >= 3) {
+            int r = run < 6 ? run : 6;
+            out[count++] = 16 | ((unsigned) (r - 3) << 5);
+            run -= r;
+         }
+      }
+      while (run-- > 0) {
+         out[count++] = (unsigned) cur;
+      }
+   }
+   return count;
+}
+
+
+// Size, in bits, of the symbols of the current block using the given
+// code lengths (not including extra bits, which do not depend on the code)
+//
+static unsigned long blockBits(Encoder *z, const unsigned char *lLen,
+                               const unsigned char *dLen)
+{
+   unsigned long bits = 0;
+   int i;
+   for (i = 0; i < L_CODES; ++i) {
+      bits += (unsigned long) z->lFreq[i] * lLen[i];
+   }
+   for (i = 0; i < D_CODES; ++i) {
+      bits += (unsigned long) z->dFreq[i] * dLen[i];
+   }
+   return bits;
+}
+
+
+static void sendSymbols(Encoder *z,
+                        const unsigned char *lLen, const unsigned short *lCode,
+                        const unsigned char *dLen, const unsigned short *dCode)
+{
+   unsigned n;
+
+   for (n = 0; n < z->symCount; ++n) {
+      unsigned lc = z->symLC[n];
+      unsigned dist = z->symDist[n];
+      if (dist == 0) {
+         putBits(z, lCode[lc], lLen[lc]);
+      } else {
+         unsigned code = lengthCode[lc];
+         putBits(z, lCode[code + 257], lLen[code + 257]);
+         if (extraLBits[code]) {
+            putBits(z, lc - baseLength[code], extraLBits[code]);
+         }
+         --dist;
+         code = DIST_CODE(dist);
+         putBits(z, dCode[code], dLen[code]);
+         if (extraDBits[code]) {
+            putBits(z, dist - baseDist[code], extraDBits[code]);
+         }
+      }
+   }
+   putBits(z, lCode[END_BLOCK], lLen[END_BLOCK]);
+}
+
+
+// Write the symbols collected so far as a block.
+//
+static void writeBlock(Encoder *z, int isLast)
+{
+   unsigned char lLen[L_CODES], dLen[D_CODES], blLen[BL_CODES];
+   unsigned short lCode[L_CODES], dCode[D_CODES], blCode[BL_CODES];
+   unsigned char lens[L_CODES + D_CODES];
+   unsigned rle[L_CODES + D_CODES];
+   unsigned blFreq[BL_CODES];
+   unsigned long dynBits, fixedBits;
+   int hlit, hdist, hclen, nrle, i;
+
+   z->lFreq[END_BLOCK] = 1;
+   ensureTwo(z->lFreq, L_CODES);
+   ensureTwo(z->dFreq, D_CODES);
+   buildLengths(z->lFreq, L_CODES, MAX_BITS, lLen);
+   buildLengths(z->dFreq, D_CODES, MAX_BITS, dLen);
+
+   for (hlit = L_CODES; hlit > 257 && lLen[hlit - 1] == 0; --hlit) {}
+   for (hdist = D_CODES; hdist > 1 && dLen[hdist - 1] == 0; --hdist) {}
+   memcpy(lens, lLen, hlit);
+   memcpy(lens + hlit, dLen, hdist);
+   nrle = encodeLengths(lens, hlit + hdist, rle);
+
+   memset(blFreq, 0, sizeof blFreq);
+   for (i = 0; i < nrle; ++i) {
+      ++blFreq[rle[i] & 31];
+   }
+   ensureTwo(blFreq, BL_CODES);
+   buildLengths(blFreq, BL_CODES, MAX_BL_BITS, blLen);
+   for (hclen = BL_CODES; hclen > 4 && blLen[blOrder[hclen - 1]] == 0; --hclen) {}
+
+   dynBits = 14 + 3 * (unsigned long) hclen + blockBits(z, lLen, dLen);
+   for (i = 0; i < nrle; ++i) {
+      unsigned s = rle[i] & 31;
+      dynBits += blLen[s] + extraBLBits[s];
+   }
+   fixedBits = blockBits(z, fixedLLen, fixedDLen);
+
+   putBits(z, isLast ? 1 : 0, 1);
+   if (fixedBits <= dynBits) {
+      putBits(z, 1, 2);
+      sendSymbols(z, fixedLLen, fixedLCode, fixedDLen, fixedDCode);
+   } else {
+      putBits(z, 2, 2);
+      genCodes(lLen, L_CODES, lCode);
+      genCodes(dLen, D_CODES, dCode);
+      genCodes(blLen, BL_CODES, blCode);
+      putBits(z, (unsigned) (hlit - 257), 5);
+      putBits(z, (unsigned) (hdist - 1), 5);
+      putBits(z, (unsigned) (hclen - 4), 4);
+      for (i = 0; i < hclen; ++i) {
+         putBits(z, blLen[blOrder[i]], 3);
+      }
+      for (i = 0; i < nrle; ++i) {
+         unsigned s = rle[i] & 31;
+         putBits(z, blCode[s], blLen[s]);
+         if (extraBLBits[s]) {
+            putBits(z, rle[i] >> 5, extraBLBits[s]);
+         }
+      }
+      sendSymbols(z, lLen, lCode, dLen, dCode);
+   }
+
+   z->symCount = 0;
+   memset(z->lFreq, 0, sizeof z->lFreq);
+   memset(z->dFreq, 0, sizeof z->dFreq);
+}
+
+
+static void tallyLiteral(Encoder *z, unsigned c)
+{
+   z->symLC[z->symCount] = (unsigned char) c;
+   z->symDist[z->symCount] = 0;
+   ++z->symCount;
+   ++z->lFreq[c];
+}
+
+
+static void tallyMatch(Encoder *z, unsigned dist, unsigned len)
+{
+   unsigned lc = len - MIN_MATCH;
+   z->symLC[z->symCount] = (unsigned char) lc;
+   z->symDist[z->symCount] = (unsigned short) dist;
+   ++z->symCount;
+   ++z->lFreq[lengthCode[lc] + 257];
+   ++z->dFreq[DIST_CODE(dist - 1)];
+}
+
+
+//----------------------------------------------------------------
+// LZ77
+//----------------------------------------------------------------
+
+
+// Insert the string at `pos` into the hash table.  Returns the previous
+// position with the same hash (0 if none).
+//
+static unsigned insertString(Encoder *z, unsigned pos)
+{
+   const unsigned char *p = z->window + pos;
+   unsigned h = (((unsigned) p[0] << 10) ^ ((unsigned) p[1] << 5) ^ p[2])
+      & HASH_MASK;
+   unsigned match = z->head[h];
+   z->prev[pos & WMASK] = (unsigned short) match;
+   z->head[h] = (unsigned short) pos;
+   return match;
+}
+
+
+// Find the longest match for the string at strstart, following the hash
+// chain from `curMatch`.  Sets matchStart when a match longer than
+// prevLength is found.  Returns the length of the best match.
+//
+static unsigned longestMatch(Encoder *z, unsigned curMatch)
+{
+   const unsigned char *scan = z->window + z->strstart;
+   unsigned chain = z->maxChain;
+   unsigned bestLen = z->prevLength;
+   unsigned nice = z->niceMatch;
+   unsigned limit = z->strstart > MAX_DIST ? z->strstart - MAX_DIST : 0;
+   unsigned maxLen = z->lookahead < MAX_MATCH ? z->lookahead : MAX_MATCH;
+
+   if (bestLen >= maxLen) {
+      return bestLen;
+   }
+   if (z->prevLength >= z->goodMatch) {
+      chain >>= 2;
+   }
+   if (nice > maxLen) {
+      nice = maxLen;
+   }
+
+   do {
+      const unsigned char *match = z->window + curMatch;
+      unsigned len;
+
+      if (match[bestLen] != scan[bestLen] ||
+          match[0] != scan[0] ||
+          match[1] != scan[1]) {
+         continue;
+      }
+      for (len = 2; len < maxLen && match[len] == scan[len]; ++len) {}
+
+      if (len > bestLen) {
+         z->matchStart = curMatch;
+         bestLen = len;
+         if (len >= nice) {
+            break;
+         }
+      }
+   } while ((curMatch = z->prev[curMatch & WMASK]) > limit && --chain != 0);
+
+   return bestLen;
+}
+
+
+// Shift the upper half of the window down to make room for more input.
+//
+static void slideWindow(Encoder *z)
+{
+   unsigned n;
+
+   memcpy(z->window, z->window + WSIZE, WSIZE);
+   z->matchStart -= WSIZE;
+   z->strstart -= WSIZE;
+
+   for (n = 0; n < HASH_SIZE; ++n) {
+      unsigned m = z->head[n];
+      z->head[n] = (unsigned short) (m >= WSIZE ? m - WSIZE : 0);
+   }
+   for (n = 0; n < WSIZE; ++n) {
+      unsigned m = z->prev[n];
+      z->prev[n] = (unsigned short) (m >= WSIZE ? m - WSIZE : 0);
+   }
+}
+
+
+// Copy input into the window.  Returns the number of bytes consumed.
+//
+static size_t fillWindow(Encoder *z, const unsigned char *data, size_t len)
+{
+   size_t room;
+
+   if (z->strstart >= WSIZE + MAX_DIST) {
+      slideWindow(z);
+   }
+   room = 2 * WSIZE - z->strstart - z->lookahead;
+   if (len > room) {
+      len = room;
+   }
+   memcpy(z->window + z->strstart + z->lookahead, data, len);
+   z->lookahead += (unsigned) len;
+   updateChecks(z, data, len);
+   return len;
+}
+
+
+// Convert the data in the window to symbols, writing blocks as the symbol
+// buffer fills.  Unless `flush` is set, stop while MIN_LOOKAHEAD bytes
+// remain, since more input might extend a match.
+//
+static void deflateWindow(Encoder *z, int flush)
+{
+   for (;;) {
+      unsigned hashHead = 0;
+
+      if (z->lookahead < MIN_LOOKAHEAD && (!flush || z->lookahead == 0)) {
+         break;
+      }
+
+      if (z->lookahead >= MIN_MATCH) {
+         hashHead = insertString(z, z->strstart);
+      }
+
+      z->prevLength = z->matchLength;
+      z->prevMatch = z->matchStart;
+      z->matchLength = MIN_MATCH - 1;
+
+      if (hashHead != 0 && z->prevLength < z->maxLazy &&
+          z->strstart - hashHead <= MAX_DIST) {
+         z->matchLength = longestMatch(z, hashHead);
+         if (z->matchLength == MIN_MATCH &&
+             z->strstart - z->matchStart > TOO_FAR) {
+            z->matchLength = MIN_MATCH - 1;
+         }
+      }
+
+      if (z->prevLength >= MIN_MATCH && z->matchLength <= z->prevLength) {
+         // emit the previous match; skip over the rest of it
+         unsigned maxInsert = z->strstart + z->lookahead - MIN_MATCH;
+         tallyMatch(z, z->strstart - 1 - z->prevMatch, z->prevLength);
+         z->lookahead -= z->prevLength - 1;
+         z->prevLength -= 2;
+         do {
+            if (++z->strstart <= maxInsert) {
+               (void) insertString(z, z->strstart);
+            }
+         } while (--z->prevLength != 0);
+         z->matchAvailable = 0;
+         z->matchLength = MIN_MATCH - 1;
+         ++z->strstart;
+      } else if (z->matchAvailable) {
+         // the previous position is a literal
+         tallyLiteral(z, z->window[z->strstart - 1]);
+         ++z->strstart;
+         --z->lookahead;
+      } else {
+         // defer the decision until the next position has been examined
+         z->matchAvailable = 1;
+         ++z->strstart;
+         --z->lookahead;
+      }
+
+      if (z->symCount == SYM_MAX) {
+         writeBlock(z, 0);
+      }
+   }
+
+   if (flush && z->matchAvailable) {
+      tallyLiteral(z, z->window[z->strstart - 1]);
+      z->matchAvailable = 0;
+      z->matchLength = MIN_MATCH - 1;
+   }
+}
+
+
+static void encoderInit(Encoder *z, int format, int level)
+{
+   if (!tablesReady) {
+      initTables();
+   }
+   memset(z, 0, sizeof *z);
+   z->format = format;
+   z->goodMatch = levels[level].good;
+   z->maxLazy = levels[level].lazy;
+   z->niceMatch = levels[level].nice;
+   z->maxChain = levels[level].chain;
+   z->matchLength = MIN_MATCH - 1;
+   z->prevLength = MIN_MATCH - 1;
+   z->adlerA = 1;
+}
+
+
+// Compress `len` bytes of `data`.  Output is added to z->out.
+//
+static void encoderWrite(Encoder *z, const char *data, size_t len)
+{
+   const unsigned char *p = (const unsigned char *) data;
+
+   if (!z->started) {
+      writeHeader(z);
+   }
+   while (len > 0) {
+      size_t n = fillWindow(z, p, len);
+      p += n;
+      len -= n;
+      deflateWindow(z, 0);
+   }
+}
+
+
+static void encoderFlush(Encoder *z)
+{
+   deflateWindow(z, 1);
+   if (z->symCount > 0) {
+      writeBlock(z, 0);
+   }
+   // empty stored block
+   putBits(z, 0, 3);
+   alignBits(z);
+   putByte(z, 0);
+   putByte(z, 0);
+   putByte(z, 0xff);
+   putByte(z, 0xff);
+}
+
+
+static void encoderFinish(Encoder *z)
+{
+   if (!z->started) {
+      writeHeader(z);
+   }
+   deflateWindow(z, 1);
+   writeBlock(z, 1);
+   alignBits(z);
+   writeTrailer(z);
+   z->finished = 1;
+}
+
+
+//----------------------------------------------------------------
+// Lua interface
+//----------------------------------------------------------------
+
+static const char *const formatNames[] = { "gzip", "zlib", "raw", NULL };
+
+
+// Create an encoder from arguments at `ndx` (format) and `ndx+1` (level)
+// and leave it on the stack.
+//
+static Encoder *newEncoder(lua_State *L, int ndx)
+{
+   int format = luaL_checkoption(L, ndx, "gzip", formatNames);
+   lua_Integer level = luaL_optinteger(L, ndx + 1, 6);
+   Encoder *z;
+
+   luaL_argcheck(L, level >= 1 && level <= 9, ndx + 1, "level must be 1...9");
+   z = (Encoder *) lua_newuserdata(L, sizeof(Encoder));
+   encoderInit(z, format, (int) level);
+   return z;
+}
+
+
+static Encoder *checkEncoder(lua_State *L)
+{
+   Encoder *z = (Encoder *) luaL_checkudata(L, 1, ENCODER_MT);
+   if (z->finished) {
+      luaL_error(L, "deflate_c: write after finish");
+   }
+   return z;
+}
+
+
+static int deflate_new(lua_State *L)
+{
+   (void) newEncoder(L, 1);
+   luaL_setmetatable(L, ENCODER_MT);
+   return 1;
+}
+
+
+static int encoder_write(lua_State *L)
+{
+   Encoder *z = checkEncoder(L);
+   size_t len;
+   const char *data = luaL_checklstring(L, 2, &len);
+   luaL_Buffer b;
+
+   luaL_buffinit(L, &b);
+   z->out = &b;
+   encoderWrite(z, data, len);
+   z->out = NULL;
+   luaL_pushresult(&b);
+   return 1;
+}
+
+
+static int encoder_flush(lua_State *L)
+{
+   Encoder *z = checkEncoder(L);
+   luaL_Buffer b;
+
+   luaL_buffinit(L, &b);
+   z->out = &b;
+   if (!z->started) {
+      writeHeader(z);
+   }
+   encoderFlush(z);
+   z->out = NULL;
+   luaL_pushresult(&b);
+   return 1;
+}
+
+
+static int encoder_finish(lua_State *L)
+{
+   Encoder *z = checkEncoder(L);
+   luaL_Buffer b;
+
+   luaL_buffinit(L, &b);
+   z->out = &b;
+   encoderFinish(z);
+   z->out = NULL;
+   luaL_pushresult(&b);
+   return 1;
+}
+
+
+static int deflate_compress(lua_State *L)
+{
+   size_t len;
+   const char *data = luaL_checklstring(L, 1, &len);
+   Encoder *z = newEncoder(L, 2);
+   luaL_Buffer b;
+
+   luaL_buffinit(L, &b);
+   z->out = &b;
+   encoderWrite(z, data, len);
+   encoderFinish(z);
+   luaL_pushresult(&b);
+   return 1;
+}
+
+
+static const luaL_Reg encoder_methods[] = {
+   {"write", encoder_write},
+   {"flush", encoder_flush},
+   {"finish", encoder_finish},
+   {0,0}
+};
+
+
+static const luaL_Reg deflate_c_regs[] = {
+   {"new", deflate_new},
+   {"compress", deflate_compress},
+   {0,0}
+};
+
+
+LUAMOD_API int luaopen_deflate_c(lua_State *L);
+
+LUAMOD_API int luaopen_deflate_c(lua_State *L)
+{
+   const luaL_Reg *preg;
+
+   // metatable for encoders: __index = methods
+   luaL_newmetatable(L, ENCODER_MT);
+   lua_createtable(L, 0, ARRAY_LENGTH(encoder_methods));
+   for (preg = &encoder_methods[0]; preg->func; ++preg) {
+      lua_pushcfunction(L, preg->func);
+      lua_setfield(L, -2, preg->name);
+   }
+   lua_setfield(L, -2, "__index");
+   lua_pop(L, 1);
+
+   // create table
+   lua_createtable(L, 0, ARRAY_LENGTH(deflate_c_regs));
+
+   // push c functions into the table
+   for (preg = &deflate_c_regs[0]; preg->func; ++preg) {
+      lua_pushcfunction(L, preg->func);
+      lua_setfield(L, -2, preg->name);
+   }
+
+   return 1;
+}
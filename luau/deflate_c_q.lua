@@ -0,0 +1,158 @@
+-- Test deflate_c by decompressing its output with `gzip -d`
+
+local qt = require "qtest"
+local deflate_c = require "deflate_c"
+
+local eq = qt.eq
+
+local tmpFile = (os.getenv("OUTDIR") or "./") .. "deflate_c_q.tmp"
+
+
+local function writeFile(name, data)
+   local f = assert(io.open(name, "wb"))
+   f:write(data)
+   f:close()
+end
+
+
+-- Decompress gzip data.  Truncated streams yield the data decoded so far.
+--
+local function gunzip(data)
+   writeFile(tmpFile, data)
+   local p = assert(io.popen("gzip -dc < " .. tmpFile .. " 2>/dev/null", "r"))
+   local out = p:read("*a")
+   p:close()
+   return out
+end
+
+
+-- Deterministic pseudo-random data
+--
+local function randomBytes(len, alphabet, seed)
+   local x = seed or 1
+   local t = {}
+   for n = 1, len do
+      x = (x * 1103515245 + 12345) % 2147483648
+      local r = math.floor(x / 65536)
+      if alphabet then
+         t[n] = alphabet:sub(r % #alphabet + 1, r % #alphabet + 1)
+      else
+         t[n] = string.char(r % 256)
+      end
+   end
+   return table.concat(t)
+end
+
+
+local text = {}
+for n = 1, 3000 do
+   text[n] = ('{"id":%d,"name":"item %d","tags":["a","b%d"],"ok":%s}')
+      :format(n, n * 7 % 1000, n % 13, n % 3 == 0 and "true" or "false")
+end
+text = "[" .. table.concat(text, ",\n") .. "]"
+
+local samples = {
+   "",
+   "a",
+   "abcabcabcabcabcabc",
+   ("x"):rep(100000),                -- maximum-length matches
+   randomBytes(256, "ab"),
+   randomBytes(100000),              -- incompressible
+   randomBytes(150000, "the quick brown fox; "),
+   text,                             -- larger than the window
+}
+do
+   local all = {}
+   for b = 0, 255 do
+      all[#all+1] = string.char(b)
+   end
+   samples[#samples+1] = table.concat(all):rep(3)
+end
+
+
+-- >> compress() output decodes to the input, at each level
+
+for _, s in ipairs(samples) do
+   eq(s, gunzip(deflate_c.compress(s)))
+end
+for level = 1, 9 do
+   eq(text, gunzip(deflate_c.compress(text, "gzip", level)))
+end
+
+-- >> text compresses well; higher levels are no worse
+
+local z1 = #deflate_c.compress(text, "gzip", 1)
+local z6 = #deflate_c.compress(text)
+local z9 = #deflate_c.compress(text, "gzip", 9)
+qt.assert(z6 * 8 < #text)
+qt.assert(z6 <= z1)
+qt.assert(z9 <= z6)
+
+-- >> incompressible data does not grow much
+
+local r = randomBytes(100000)
+qt.assert(#deflate_c.compress(r) < #r * 1.01)
+
+
+-- >> incremental encoding: write in pieces; flush makes all data written
+--    so far decodable
+
+local z = deflate_c.new()
+local out = {}
+local pos = 1
+local step = 1
+while pos <= #text do
+   out[#out+1] = z:write(text:sub(pos, pos + step - 1))
+   pos = pos + step
+   step = step * 3 % 70001 + 1
+   if step % 4 == 0 then
+      out[#out+1] = z:flush()
+      eq(text:sub(1, pos - 1), gunzip(table.concat(out)))
+   end
+end
+out[#out+1] = z:finish()
+eq(text, gunzip(table.concat(out)))
+
+-- flushed output ends on a byte boundary with an empty stored block
+z = deflate_c.new("raw")
+eq("", z:write("hello"))
+eq("\0\0\255\255", z:flush():sub(-4))
+
+-- >> finished encoders reject further use
+
+z:finish()
+qt.assert(not pcall(z.write, z, "x"))
+qt.assert(not pcall(z.finish, z))
+
+
+-- >> zlib and raw formats carry the same deflate data
+
+local function adler32(s)
+   local a, b = 1, 0
+   for n = 1, #s do
+      a = (a + s:byte(n)) % 65521
+      b = (b + a) % 65521
+   end
+   return b * 65536 + a
+end
+
+local function be32(n)
+   return string.char(math.floor(n / 16777216) % 256, math.floor(n / 65536) % 256,
+                      math.floor(n / 256) % 256, n % 256)
+end
+
+local s = samples[7]
+local gz = deflate_c.compress(s, "gzip")
+local raw = deflate_c.compress(s, "raw")
+local zl = deflate_c.compress(s, "zlib")
+eq(raw, gz:sub(11, -9))
+eq("\120\156" .. raw .. be32(adler32(s)), zl)
+
+
+-- >> argument errors
+
+qt.assert(not pcall(deflate_c.new, "br"))
+qt.assert(not pcall(deflate_c.new, "gzip", 0))
+qt.assert(not pcall(deflate_c.compress, "x", "gzip", 10))
+
+os.remove(tmpFile)
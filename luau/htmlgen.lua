@@ -23,6 +23,11 @@
 --     one (the first) will be included for each distinct value of `_once`.
 --     Nodes of type "title" implicitly have a `_once` value of "title".
 --
+--     *Grouped nodes*: When head nodes have a `_group` property, the
+--     contents of each are appended to the first one with the same value
+--     of `_group`, so that together they form one element.  Nodes omitted
+--     due to `_once` are not included.
+--
 --     `options` is a table (defaulting to an empty table). If
 --     `options.charset` contains anything other than `false`, a `meta`
 --     element describing the charset will be added to the resulting data
@@ -107,10 +112,14 @@ local function makeCharRef(ch)
    return ("&#%d;"):format(utf8utils.decode(ch, badUTF8))
 end
 
-local function htmlEscape(str)
+local function luaHtmlEscape(str)
    return (str:gsub("[<>&]", htmlSubs):gsub(utf8utils.mbpattern, makeCharRef))
 end
 
+-- @require textcodec_c   (bundle the native escaper, when found)
+local succ, textcodec_c = pcall(require, "textcodec_c")
+local htmlEscape = succ and textcodec_c.htmlEscape or luaHtmlEscape
+
 local function htmlEscapeAttr(str)
    return (str:gsub('[>&"]', htmlSubs))
 end
@@ -311,6 +320,7 @@ function HTMLGen:normalize(tree)
    local head = E.head{}
    local body = E.body{}
    local seen = {}
+   local groups = {}
 
    local function appendToHead(child)
       if type(child) == "table" then
@@ -319,6 +329,23 @@ function HTMLGen:normalize(tree)
             if seen[seenkey] then return end
             seen[seenkey] = true
          end
+         local group = child._group
+         if group then
+            local first = groups[group]
+            if first then
+               for _, c in ipairs(child) do
+                  table.insert(first, c)
+               end
+               return
+            end
+            -- copy the first node, since the others are appended to it
+            first = {}
+            for k, v in pairs(child) do
+               first[k] = v
+            end
+            groups[group] = first
+            child = first
+         end
       end
       table.insert(head, child)
    end
@@ -394,5 +421,7 @@ function htmlgen.normalize(tree, options)
 end
 
 htmlgen.HTMLGen = HTMLGen -- for testing
+htmlgen._luaHtmlEscape = luaHtmlEscape -- for testing
+htmlgen._htmlEscape = htmlEscape -- for testing
 
 return htmlgen
@@ -79,3 +79,17 @@ qt.eq( htmlgen.normalize( E.html{ E.head{ E.title{"A"}}, E.body{"hi"} },
                           {charset=false} ),
        E.html{ E.head{ E.title{"A"}}, E.body{"hi"} })
 
+
+
+-- `_once` and `_group`: grouped nodes are merged into the first, without
+-- modifying the input tree
+
+local s1 = E.style{ _group="g", _once="a", "A" }
+local doc = E.div{ E.head{ s1, E.style{ _group="g", _once="b", "B" } },
+                   E.head{ E.style{ _group="g", _once="a", "A" },
+                           E.style{ _group="g", "C" }, E.style{"D"} } }
+qt.eq( htmlgen.normalize(doc, {charset=false}),
+       E.html{ E.head{ E.style{ _group="g", _once="a", "A", "B", "C" },
+                       E.style{"D"}, E.title{} },
+               E.body{ E.div{} } } )
+qt.eq( E.style{ _group="g", _once="a", "A" }, s1 )
@@ -75,9 +75,44 @@ function U.mkdir_p(path)
 end
 
 
+-- Remove a directory and its contents using xpfs.walk.  Directories are
+-- returned before their contents, so remove them in reverse order.
+--
+local function removeTree(dir)
+   local dirs = { dir }
+   local iter, err = xpfs.walk(dir)
+   if not iter then
+      return nil, err
+   end
+   for path, kind, err in iter do
+      if kind == "d" then
+         table.insert(dirs, path)
+      elseif kind then
+         local s, e = xpfs.remove(path)
+         if not s then return s, e end
+      else
+         return nil, err
+      end
+   end
+
+   for ndx = #dirs, 1, -1 do
+      local s, e = xpfs.rmdir(dirs[ndx])
+      if not s then return s, e end
+   end
+   return true
+end
+
+
 function U.rm_rf(name)
    local s,e = true
 
+   if xpfs.walk then
+      local st = xpfs.stat(name, "k")
+      if st and st.kind == "d" then
+         return removeTree(name)
+      end
+   end
+
    local todo = { name }
    while #todo > 0 do
       local f = table.remove(todo)
@@ -52,6 +52,16 @@ function T.rm_rf()
    assert( lfsu.rm_rf( tmpdir ) )
 
    qt.eq(nil, (xpfs.stat(tmpdir)) )
+
+   -- errors from xpfs.walk are returned
+   xpfs.mkdir( tmpdir )
+   local walk = xpfs.walk
+   xpfs.walk = function () return nil, "walk failed" end
+   local s, e = lfsu.rm_rf( tmpdir )
+   xpfs.walk = walk
+   qt.eq(nil, s)
+   qt.eq("walk failed", e)
+   assert( lfsu.rm_rf( tmpdir ) )
 end
 
 
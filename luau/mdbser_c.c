@@ -0,0 +1,355 @@
+// mdbser_c: Native codec for mdbser.lua
+//
+// `mdbser_c.encode(...)` and `mdbser_c.decode(str, [pos])` produce and
+// consume the same format as the Lua implementations in mdbser.lua.  See
+// mdbser.lua for details.
+//
+// Each table is encoded as a word that is "demoted" (escaped) so that it
+// contains no spaces, and its contents are demoted once more for each
+// enclosing table.  Rather than constructing and demoting each
+// intermediate string, the encoder applies the demotions for the nesting
+// level as it writes each byte.
+
+
+#include <string.h>
+
+#include "lualib.h"
+#include "lauxlib.h"
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+// Escape byte, as written by `demote`
+#define ESC 128
+
+// Maximum nesting of tables
+#define MAX_DEPTH 200
+
+
+//----------------------------------------------------------------
+// Output buffer
+//
+// The buffer memory is a userdata at stack index `ndx`, so it is
+// collected if an error is raised.  (luaL_Buffer cannot be used while
+// other values are pushed and popped, as when traversing tables.)
+//----------------------------------------------------------------
+
+typedef struct {
+   lua_State *L;
+   int ndx;
+   char *data;
+   size_t len;
+   size_t size;
+} Buf;
+
+
+static void bufInit(Buf *b, lua_State *L)
+{
+   b->L = L;
+   b->size = 256;
+   b->len = 0;
+   b->data = lua_newuserdata(L, b->size);
+   b->ndx = lua_gettop(L);
+}
+
+
+static void bufGrow(Buf *b, size_t more)
+{
+   size_t size = b->size * 2;
+   char *data;
+
+   while (size < b->len + more) {
+      size *= 2;
+   }
+   data = lua_newuserdata(b->L, size);
+   memcpy(data, b->data, b->len);
+   lua_replace(b->L, b->ndx);
+   b->data = data;
+   b->size = size;
+}
+
+
+static void bufAdd(Buf *b, int c)
+{
+   if (b->len >= b->size) {
+      bufGrow(b, 1);
+   }
+   b->data[b->len++] = (char) c;
+}
+
+
+// Add byte `c`, demoted `depth` times.
+//
+static void bufAddDemoted(Buf *b, int c, int depth)
+{
+   while (depth > 0) {
+      --depth;
+      if (c == ' ' || c == '\r' || c == '\n' || c == ESC || c == 191) {
+         // escape, then shift ESC
+         bufAddDemoted(b, ESC + 1, depth);
+         c += 64;
+      } else if (c >= 128 && c <= 190) {
+         c += 1;
+      }
+   }
+   bufAdd(b, c);
+}
+
+
+static void bufAddString(Buf *b, const char *s, size_t len, int depth)
+{
+   size_t ii;
+
+   if (depth == 0) {
+      if (b->len + len > b->size) {
+         bufGrow(b, len);
+      }
+      memcpy(b->data + b->len, s, len);
+      b->len += len;
+   } else {
+      for (ii = 0; ii < len; ++ii) {
+         bufAddDemoted(b, (unsigned char) s[ii], depth);
+      }
+   }
+}
+
+
+//----------------------------------------------------------------
+// Encode
+//----------------------------------------------------------------
+
+
+// Encode the value at `ndx` as a word, demoted `depth` times.
+//
+static void encodeValue(Buf *b, int ndx, int depth)
+{
+   lua_State *L = b->L;
+   const char *s;
+   size_t len;
+
+   switch (lua_type(L, ndx)) {
+   case LUA_TSTRING:
+      s = lua_tolstring(L, ndx, &len);
+      bufAddDemoted(b, 's', depth);
+      bufAddString(b, s, len, depth + 1);
+      break;
+
+   case LUA_TBOOLEAN:
+      bufAddDemoted(b, lua_toboolean(L, ndx) ? 't' : 'f', depth);
+      break;
+
+   case LUA_TNUMBER:
+      // same formatting as `tostring`
+      lua_pushvalue(L, ndx);
+      s = lua_tolstring(L, -1, &len);
+      bufAddDemoted(b, 'n', depth);
+      bufAddString(b, s, len, depth);
+      lua_pop(L, 1);
+      break;
+
+   case LUA_TTABLE:
+      if (depth >= MAX_DEPTH) {
+         luaL_error(L, "mdbser: tables nested too deeply");
+      }
+      luaL_checkstack(L, 3, "mdbser");
+      ndx = lua_absindex(L, ndx);
+      bufAddDemoted(b, 'm', depth + 1);
+      lua_pushnil(L);
+      while (lua_next(L, ndx)) {
+         bufAddDemoted(b, ' ', depth + 1);
+         encodeValue(b, -2, depth + 1);
+         bufAddDemoted(b, ' ', depth + 1);
+         encodeValue(b, -1, depth + 1);
+         lua_pop(L, 1);
+      }
+      break;
+
+   default:
+      bufAddDemoted(b, 'x', depth);
+      break;
+   }
+}
+
+
+// encode(...) -> string
+//
+static int mdbser_c_encode(lua_State *L)
+{
+   int top = lua_gettop(L);
+   int n;
+   Buf b;
+
+   bufInit(&b, L);
+   for (n = 1; n <= top; ++n) {
+      if (n > 1) {
+         bufAdd(&b, ' ');
+      }
+      encodeValue(&b, n, 0);
+   }
+   lua_pushlstring(L, b.data, b.len);
+   return 1;
+}
+
+
+//----------------------------------------------------------------
+// Decode
+//----------------------------------------------------------------
+
+
+// Undo one level of demotion; push the result.
+//
+static void pushPromoted(lua_State *L, const char *s, size_t len)
+{
+   luaL_Buffer b;
+   char *out = luaL_buffinitsize(L, &b, len);
+   size_t ii, o = 0;
+
+   for (ii = 0; ii < len; ++ii) {
+      int c = (unsigned char) s[ii];
+      if (c >= 129 && c <= 191) {
+         c -= 1;
+      }
+      if (c == ESC && ii + 1 < len) {
+         c = (unsigned char) s[++ii];
+         if (c >= 129 && c <= 191) {
+            c -= 1;
+         }
+         c = (c - 64) & 255;
+      }
+      out[o++] = (char) c;
+   }
+   luaL_pushresultsize(&b, o);
+}
+
+
+static int isWord(const char *s, size_t len, const char *word)
+{
+   return len == strlen(word) && memcmp(s, word, len) == 0;
+}
+
+
+// Push the value described by a word.
+//
+static void decodeValue(lua_State *L, const char *s, size_t len, int depth)
+{
+   int isNum;
+   lua_Number n;
+
+   if (len == 0) {
+      lua_pushnil(L);
+      return;
+   }
+
+   switch (s[0]) {
+   case 's':
+      pushPromoted(L, s+1, len-1);
+      return;
+
+   case 'n':
+      lua_pushlstring(L, s+1, len-1);
+      n = lua_tonumberx(L, -1, &isNum);
+      lua_pop(L, 1);
+      if (isNum) {
+         lua_pushnumber(L, n);
+      } else {
+         lua_pushnil(L);
+      }
+      return;
+
+   case 'm':
+      if (depth >= MAX_DEPTH) {
+         luaL_error(L, "mdbser: tables nested too deeply");
+      }
+      luaL_checkstack(L, 4, "mdbser");
+      pushPromoted(L, s, len);
+      s = lua_tolstring(L, -1, &len);
+      lua_newtable(L);
+      {
+         // equivalent to gmatch(" ([^ ]*) ([^ ]*)")
+         const char *p = s, *pend = s + len;
+         while ( (p = memchr(p, ' ', pend - p)) != NULL ) {
+            const char *k = p + 1, *kend, *v, *vend;
+
+            kend = memchr(k, ' ', pend - k);
+            if (!kend) {
+               break;
+            }
+            v = kend + 1;
+            vend = memchr(v, ' ', pend - v);
+            if (!vend) {
+               vend = pend;
+            }
+            decodeValue(L, k, kend - k, depth + 1);
+            decodeValue(L, v, vend - v, depth + 1);
+            lua_rawset(L, -3);
+            p = vend;
+         }
+      }
+      lua_remove(L, -2);
+      return;
+   }
+
+   if (isWord(s, len, "t")) {
+      lua_pushboolean(L, 1);
+   } else if (isWord(s, len, "f")) {
+      lua_pushboolean(L, 0);
+   } else {
+      lua_pushnil(L);
+   }
+}
+
+
+// decode(str, [pos]) -> values...
+//
+static int mdbser_c_decode(lua_State *L)
+{
+   size_t len;
+   const char *s = luaL_checklstring(L, 1, &len);
+   lua_Integer pos = luaL_optinteger(L, 2, 1);
+   const char *p, *pend = s + len;
+   int count = 0;
+
+   p = s + (pos > 1 ? ((size_t) pos - 1 < len ? (size_t) pos - 1 : len) : 0);
+   while (1) {
+      const char *word;
+      while (p < pend && *p == ' ') {
+         ++p;
+      }
+      if (p == pend) {
+         break;
+      }
+      word = p;
+      while (p < pend && *p != ' ') {
+         ++p;
+      }
+      luaL_checkstack(L, 1, "mdbser: too many values");
+      decodeValue(L, word, p - word, 0);
+      ++count;
+   }
+   return count;
+}
+
+
+static const luaL_Reg mdbser_c_regs[] = {
+   {"encode", mdbser_c_encode},
+   {"decode", mdbser_c_decode},
+   {0,0}
+};
+
+
+LUAMOD_API int luaopen_mdbser_c(lua_State *L);
+
+LUAMOD_API int luaopen_mdbser_c(lua_State *L)
+{
+   const luaL_Reg *preg;
+
+   // create table
+   lua_createtable(L, 0, ARRAY_LENGTH(mdbser_c_regs));
+
+   // push c functions into the table
+   for (preg = &mdbser_c_regs[0]; preg->func; ++preg) {
+      lua_pushcfunction(L, preg->func);
+      lua_setfield(L, -2, preg->name);
+   }
+
+   return 1;
+}
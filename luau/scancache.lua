@@ -0,0 +1,125 @@
+-- scancache: persistent cache of results of scanning source files
+--
+-- Build tools use this to avoid re-scanning sources that have not changed
+-- since a previous build.  cfromlua caches the modules required by each Lua
+-- source, and jsdep caches the results of `scanjs.scan` for each JavaScript
+-- source.
+--
+-- Each entry records the result of scanning one file, along with the
+-- file's size, inode number, and modification and status-change times.  An
+-- entry is used only if all of these still match.  Since times have a
+-- resolution of one second, results are not stored for files that were
+-- modified within the last two seconds; otherwise a change made in the same
+-- second as the scan could go unnoticed.
+--
+-- Entries are stored in separate files, so concurrent builds sharing a
+-- cache do not need to coordinate: <dir>/<tool>/<encoded path>.lua
+--
+-- API:
+--
+--   scancache.open(dir, tool) -> cache
+--
+--      `tool` distinguishes the results of different kinds of scans.
+--
+--   cache:get(path) -> value | nil
+--
+--      Return the value stored for `path`, or nil if there is no entry or
+--      if the file has changed since it was stored.
+--
+--   cache:put(path, value) -> true | nil, err
+--
+--      Store a value for `path`.  `value` may contain strings, numbers,
+--      booleans, and tables.  This should be called after `get` (which
+--      records the state of the file *before* it is scanned).
+--
+
+local xpfs = require "xpfs"
+local serialize = require "serialize"
+local lfsu = require "lfsu"
+
+-- Files modified more recently than this (in seconds) are not stored.
+local RACY_TIME = 2
+
+
+local function stamp(path)
+   local st = xpfs.stat(path, "sitd")
+   if st then
+      return ("%d:%d:%d:%.0f"):format(st.size, st.inode, st.dev, st.time), st.time
+   end
+end
+
+
+local Cache = {}
+Cache.__index = Cache
+
+
+local function open(dir, tool)
+   local me = setmetatable({}, Cache)
+   me.dir = dir .. "/" .. tool
+   me.stamps = {}    -- path -> stamp, as of `get`
+   me.times = {}     -- path -> time, as of `get`
+   me.racyTime = RACY_TIME
+   return me
+end
+
+
+function Cache:entryName(path)
+   local enc = path:gsub("[^%w%-%.]", function (c)
+      return ("_%02x"):format(c:byte())
+   end)
+   return self.dir .. "/" .. enc .. ".lua"
+end
+
+
+function Cache:get(path)
+   local st, time = stamp(path)
+   self.stamps[path], self.times[path] = st, time
+   if not st then
+      return nil
+   end
+
+   local f = loadfile(self:entryName(path), "t", {})
+   local succ, entry = pcall(f or error)
+   if succ and type(entry) == "table"
+      and entry.path == path
+      and entry.stamp == st then
+      return entry.value
+   end
+   return nil
+end
+
+
+function Cache:put(path, value)
+   local st, time = self.stamps[path], self.times[path]
+   if not st then
+      st, time = stamp(path)
+   end
+   if not st or time > os.time() - self.racyTime then
+      return nil, "file not cacheable"
+   end
+
+   local succ, err = lfsu.mkdir_p(self.dir)
+   if not succ then
+      return nil, err
+   end
+
+   -- write to a temporary file and rename, so readers never see a
+   -- partially written entry; the temporary name is unique to this process,
+   -- since other builds may be storing the same entry
+   local name = self:entryName(path)
+   local tmpName = ("%s.%d.tmp"):format(name, xpfs.getpid())
+   local entry = { path = path, stamp = st, value = value }
+   succ, err = lfsu.write(tmpName, "return " .. serialize.serialize(entry) .. "\n")
+   if succ then
+      succ, err = os.rename(tmpName, name)
+   end
+   if not succ then
+      return nil, err
+   end
+   return true
+end
+
+
+return {
+   open = open,
+}
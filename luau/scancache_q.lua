@@ -0,0 +1,67 @@
+local qt = require "qtest"
+local scancache = require "scancache"
+local lfsu = require "lfsu"
+local xpfs = require "xpfs"
+
+local eq = qt.eq
+
+local tmpDir = assert(os.getenv("OUTDIR")) .. "scancache_q.tmp"
+lfsu.rm_rf(tmpDir)
+assert(lfsu.mkdir_p(tmpDir))
+
+local src = tmpDir .. "/a b.lua"
+assert(lfsu.write(src, "require 'x'"))
+
+local cache = scancache.open(tmpDir .. "/cache", "test")
+
+-- miss, then a recently-modified file is not stored
+
+eq(nil, cache:get(src))
+eq(nil, (cache:put(src, {"x"})))
+eq(nil, cache:get(src))
+
+-- hit
+
+cache.racyTime = -10
+eq(nil, cache:get(src))
+eq(true, cache:put(src, {"x", n=1}))
+eq({"x", n=1}, cache:get(src))
+
+-- the temporary file written by `put` (which is unique to this process)
+-- has been renamed to the entry
+
+local names = {}
+for _, name in ipairs(xpfs.dir(tmpDir .. "/cache/test")) do
+   if not name:match("^%.%.?$") then
+      names[#names+1] = name
+   end
+end
+eq(1, #names)
+eq(cache:entryName(src), tmpDir .. "/cache/test/" .. names[1])
+
+-- other tools and other caches have separate entries
+
+eq(nil, scancache.open(tmpDir .. "/cache", "other"):get(src))
+eq({"x", n=1}, scancache.open(tmpDir .. "/cache", "test"):get(src))
+
+-- a change to the file invalidates the entry (this change happens within
+-- the same second, so it must change the size)
+
+assert(lfsu.write(src, "require 'yy'"))
+eq(nil, cache:get(src))
+
+-- replacing the file invalidates the entry (new inode)
+
+eq(true, cache:put(src, {"y"}))
+eq({"y"}, cache:get(src))
+assert(lfsu.write(src .. ".new", "require 'z'"))
+assert(xpfs.rename(src .. ".new", src))
+eq(nil, cache:get(src))
+
+-- missing file
+
+xpfs.remove(src)
+eq(nil, cache:get(src))
+eq(nil, (cache:put(src, {})))
+
+lfsu.rm_rf(tmpDir)
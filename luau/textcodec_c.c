@@ -0,0 +1,392 @@
+// textcodec_c: Native string codecs for xuri.lua, utf8utils.lua, and
+// htmlgen.lua
+//
+// Each function produces the same results as the Lua implementation it
+// replaces:
+//
+//   pctDecode(s)         xuri: decode "%XX" sequences
+//   paramDecode(s)       xuri: decode "+" and "%XX" sequences
+//   paramEncode(s)       xuri: encode a query name or value
+//   pathEncode(s)        xuri: encode a path
+//   authorityEncode(s)   xuri: encode an authority
+//   parseParams(s)       xuri: convert a query string to a table
+//   utf8Decode(s)        utf8utils.decode: return `n, isValid`
+//   utf8Check(s)         utf8utils.validate: return the start and end of the
+//                        first invalid sequence, or nothing
+//   htmlEscape(s)        htmlgen: escape "<", ">", "&" and non-ASCII
+//                        characters
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lualib.h"
+#include "lauxlib.h"
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+// Substituted for invalid UTF-8 sequences by htmlEscape (as in htmlgen.lua)
+#define BAD_UTF8 0xFFDD
+
+
+//----------------------------------------------------------------
+// Percent-encoding
+//----------------------------------------------------------------
+
+static int hexValue(int ch)
+{
+   if (ch >= '0' && ch <= '9') {
+      return ch - '0';
+   } else if (ch >= 'a' && ch <= 'f') {
+      return ch - 'a' + 10;
+   } else if (ch >= 'A' && ch <= 'F') {
+      return ch - 'A' + 10;
+   }
+   return -1;
+}
+
+
+// Decode `len` bytes at `s` into `out`, returning the length of the
+// result, which is never longer than the input.  When `plus` is true, "+"
+// is decoded as a space.
+//
+static size_t pctDecodeTo(char *out, const char *s, size_t len, int plus)
+{
+   const char *end = s + len;
+   char *o = out;
+
+   while (s < end) {
+      int ch = (unsigned char) *s++;
+      if (ch == '%' && end - s >= 2) {
+         int hi = hexValue((unsigned char) s[0]);
+         int lo = hexValue((unsigned char) s[1]);
+         if (hi >= 0 && lo >= 0) {
+            ch = hi * 16 + lo;
+            s += 2;
+         }
+      } else if (ch == '+' && plus) {
+         ch = ' ';
+      }
+      *o++ = (char) ch;
+   }
+   return (size_t) (o - out);
+}
+
+
+static int pctDecodeImpl(lua_State *L, int plus)
+{
+   size_t len;
+   const char *s = luaL_checklstring(L, 1, &len);
+   luaL_Buffer b;
+   char *out = luaL_buffinitsize(L, &b, len);
+
+   luaL_pushresultsize(&b, pctDecodeTo(out, s, len, plus));
+   return 1;
+}
+
+
+static int textcodec_pctDecode(lua_State *L)
+{
+   return pctDecodeImpl(L, 0);
+}
+
+
+static int textcodec_paramDecode(lua_State *L)
+{
+   return pctDecodeImpl(L, 1);
+}
+
+
+// Characters that are not percent-encoded, in addition to alphanumerics.
+// In params, " " is encoded as "+".
+#define PARAM_SAFE     "!()*-._~ "
+#define PATH_SAFE      "!()*-._~/+"
+#define AUTHORITY_SAFE "!()*-._~:+"
+
+
+static int pctEncodeImpl(lua_State *L, const char *safe)
+{
+   static const char hex[] = "0123456789ABCDEF";
+   size_t len, ii;
+   const char *s = luaL_checklstring(L, 1, &len);
+   char isSafe[256];
+   luaL_Buffer b;
+
+   memset(isSafe, 0, sizeof isSafe);
+   for (ii = 0; ii < 256; ++ii) {
+      if ((ii >= '0' && ii <= '9') || (ii >= 'a' && ii <= 'z') || (ii >= 'A' && ii <= 'Z')) {
+         isSafe[ii] = 1;
+      }
+   }
+   for ( ; *safe; ++safe) {
+      isSafe[(unsigned char) *safe] = 1;
+   }
+
+   luaL_buffinit(L, &b);
+   for (ii = 0; ii < len; ++ii) {
+      int ch = (unsigned char) s[ii];
+      if (!isSafe[ch]) {
+         char *p = luaL_prepbuffsize(&b, 3);
+         p[0] = '%';
+         p[1] = hex[ch >> 4];
+         p[2] = hex[ch & 15];
+         luaL_addsize(&b, 3);
+      } else {
+         luaL_addchar(&b, ch == ' ' ? '+' : ch);
+      }
+   }
+   luaL_pushresult(&b);
+   return 1;
+}
+
+
+static int textcodec_paramEncode(lua_State *L)
+{
+   return pctEncodeImpl(L, PARAM_SAFE);
+}
+
+
+static int textcodec_pathEncode(lua_State *L)
+{
+   return pctEncodeImpl(L, PATH_SAFE);
+}
+
+
+static int textcodec_authorityEncode(lua_State *L)
+{
+   return pctEncodeImpl(L, AUTHORITY_SAFE);
+}
+
+
+// parseParams(str) -> table
+//
+// Fields are delimited by "&" or ";".  A field containing "=" assigns
+// t[name] = value; other (non-empty) fields are appended to t.  Names and
+// values are decoded as with paramDecode.
+//
+static int textcodec_parseParams(lua_State *L)
+{
+   size_t len;
+   const char *s, *end;
+   char *scratch;
+   int count = 0;
+
+   if (!lua_toboolean(L, 1)) {
+      lua_newtable(L);
+      return 1;
+   }
+   s = luaL_checklstring(L, 1, &len);
+   end = s + len;
+   lua_newtable(L);
+
+   // Decoded names and values are assembled here
+   scratch = lua_newuserdata(L, len + 1);
+   lua_insert(L, -2);
+
+   while (s < end) {
+      const char *fld = s;
+      const char *eq = NULL;
+
+      while (s < end && *s != '&' && *s != ';') {
+         if (*s == '=' && eq == NULL) {
+            eq = s;
+         }
+         ++s;
+      }
+      if (eq) {
+         lua_pushlstring(L, scratch, pctDecodeTo(scratch, fld, (size_t) (eq - fld), 1));
+         ++eq;
+         lua_pushlstring(L, scratch, pctDecodeTo(scratch, eq, (size_t) (s - eq), 1));
+         lua_rawset(L, -3);
+      } else if (s > fld) {
+         lua_pushlstring(L, scratch, pctDecodeTo(scratch, fld, (size_t) (s - fld), 1));
+         lua_rawseti(L, -2, ++count);
+      }
+      if (s < end) {
+         ++s;
+      }
+   }
+   return 1;
+}
+
+
+//----------------------------------------------------------------
+// UTF-8
+//----------------------------------------------------------------
+
+static int isCont(int ch)
+{
+   return ch >= 128 && ch <= 191;
+}
+
+
+// Decode a sequence, as does `decode` in utf8utils.lua.  Return 1 if it is
+// valid, storing the value in `*pn`.  When the sequence is not valid,
+// return 0 and store in `*pn` the value that utf8utils.lua passes to `ferr`.
+//
+static int utf8DecodeSeq(const unsigned char *s, size_t len, long *pn)
+{
+   long n = -1, min = 0;
+   int b0 = len ? s[0] : 0;
+
+   if (len == 2 && b0 >= 192 && b0 <= 223 && isCont(s[1])) {
+      n = (b0 - 192) * 64L + s[1] - 128;
+      min = 0x80;
+   } else if (len == 3 && b0 >= 224 && b0 <= 239 && isCont(s[1]) && isCont(s[2])) {
+      n = ((b0 - 224) * 64L + s[1] - 128) * 64 + s[2] - 128;
+      min = 0x800;
+   } else if (len == 4 && b0 >= 240 && b0 <= 244 &&
+              isCont(s[1]) && isCont(s[2]) && isCont(s[3])) {
+      n = (((b0 - 240) * 64L + s[1] - 128) * 64 + s[2] - 128) * 64 + s[3] - 128;
+      min = 0x10000;
+   } else if (len == 1 && b0 <= 127) {
+      n = b0;
+   }
+   *pn = n;
+   return n >= min;
+}
+
+
+// Return the length of the multi-byte sequence beginning at s[0], as
+// matched by `utf8utils.mbpattern` (a non-ASCII byte followed by any
+// number of continuation bytes).
+//
+static size_t mbLength(const unsigned char *s, const unsigned char *end)
+{
+   const unsigned char *p = s + 1;
+   while (p < end && isCont(*p)) {
+      ++p;
+   }
+   return (size_t) (p - s);
+}
+
+
+static int textcodec_utf8Decode(lua_State *L)
+{
+   size_t len;
+   const char *s = luaL_checklstring(L, 1, &len);
+   long n;
+   int valid = utf8DecodeSeq((const unsigned char *) s, len, &n);
+
+   lua_pushnumber(L, (lua_Number) n);
+   lua_pushboolean(L, valid);
+   return 2;
+}
+
+
+static int textcodec_utf8Check(lua_State *L)
+{
+   size_t len;
+   const unsigned char *s = (const unsigned char *) luaL_checklstring(L, 1, &len);
+   const unsigned char *end = s + len;
+   const unsigned char *p = s;
+
+   while (p < end) {
+      if (*p < 128) {
+         ++p;
+      } else {
+         size_t mbLen = mbLength(p, end);
+         long n;
+         if (!utf8DecodeSeq(p, mbLen, &n)) {
+            lua_pushinteger(L, (lua_Integer) (p - s) + 1);
+            lua_pushinteger(L, (lua_Integer) (p - s + mbLen));
+            return 2;
+         }
+         p += mbLen;
+      }
+   }
+   return 0;
+}
+
+
+//----------------------------------------------------------------
+// HTML
+//----------------------------------------------------------------
+
+static int textcodec_htmlEscape(lua_State *L)
+{
+   size_t len;
+   const unsigned char *s = (const unsigned char *) luaL_checklstring(L, 1, &len);
+   const unsigned char *end = s + len;
+   const unsigned char *p;
+   luaL_Buffer b;
+
+   // Return the string itself when nothing needs escaping.
+   for (p = s; p < end; ++p) {
+      if (*p == '<' || *p == '>' || *p == '&' || *p >= 128) {
+         break;
+      }
+   }
+   if (p == end) {
+      lua_settop(L, 1);
+      return 1;
+   }
+
+   luaL_buffinit(L, &b);
+   luaL_addlstring(&b, (const char *) s, (size_t) (p - s));
+
+   while (p < end) {
+      int ch = *p;
+      if (ch == '<') {
+         luaL_addstring(&b, "&lt;");
+         ++p;
+      } else if (ch == '>') {
+         luaL_addstring(&b, "&gt;");
+         ++p;
+      } else if (ch == '&') {
+         luaL_addstring(&b, "&amp;");
+         ++p;
+      } else if (ch >= 128) {
+         size_t mbLen = mbLength(p, end);
+         long n;
+         char *o = luaL_prepbuffsize(&b, 16);
+         if (!utf8DecodeSeq(p, mbLen, &n)) {
+            n = BAD_UTF8;
+         }
+         luaL_addsize(&b, (size_t) sprintf(o, "&#%ld;", n));
+         p += mbLen;
+      } else {
+         const unsigned char *q = p + 1;
+         while (q < end && *q != '<' && *q != '>' && *q != '&' && *q < 128) {
+            ++q;
+         }
+         luaL_addlstring(&b, (const char *) p, (size_t) (q - p));
+         p = q;
+      }
+   }
+   luaL_pushresult(&b);
+   return 1;
+}
+
+
+static const luaL_Reg textcodec_c_regs[] = {
+   {"pctDecode", textcodec_pctDecode},
+   {"paramDecode", textcodec_paramDecode},
+   {"paramEncode", textcodec_paramEncode},
+   {"pathEncode", textcodec_pathEncode},
+   {"authorityEncode", textcodec_authorityEncode},
+   {"parseParams", textcodec_parseParams},
+   {"utf8Decode", textcodec_utf8Decode},
+   {"utf8Check", textcodec_utf8Check},
+   {"htmlEscape", textcodec_htmlEscape},
+   {0,0}
+};
+
+
+LUAMOD_API int luaopen_textcodec_c(lua_State *L);
+
+LUAMOD_API int luaopen_textcodec_c(lua_State *L)
+{
+   const luaL_Reg *preg;
+
+   // create table
+   lua_createtable(L, 0, ARRAY_LENGTH(textcodec_c_regs));
+
+   // push c functions into the table
+   for (preg = &textcodec_c_regs[0]; preg->func; ++preg) {
+      lua_pushcfunction(L, preg->func);
+      lua_setfield(L, -2, preg->name);
+   }
+
+   return 1;
+}
@@ -0,0 +1,102 @@
+-- Compare the native codecs (textcodec_c.c) with the Lua implementations
+-- in xuri.lua, utf8utils.lua, and htmlgen.lua.
+
+local qt = require "qtest"
+local xuri = require "xuri"
+local utf8utils = require "utf8utils"
+local htmlgen = require "htmlgen"
+local textcodec_c = require "textcodec_c"
+
+local eq = qt.eq
+
+eq(true, xuri.isNative)
+eq(true, utf8utils.isNative)
+eq(textcodec_c.pctDecode, xuri.pctDecode)
+eq(textcodec_c.htmlEscape, htmlgen._htmlEscape)
+
+
+-- Strings to feed to each codec: edge cases, all bytes, and random
+-- strings drawn from an alphabet rich in special characters.
+
+local samples = {
+   "", "a", "%", "%4", "%41", "%%41", "%4g", "%zz", "%+1", "+", "a+b%2B",
+   "%e9%E9", "a b", "'", "=", "=x", "x=", "a=b=c", "&", ";;", "a&&b;c",
+   "a=1;b=2&c", "%3D=%26", "<a href=\"x\">&amp;</a>",
+   "\127", "\128", "\191", "\192", "\255",
+   "\194\169", "\192\128", "\193\191", "\224\128\128", "\224\160\128",
+   "\237\160\128", "\239\191\191", "\240\144\128\128", "\244\143\191\191",
+   "\244\144\128\128", "\245\128\128\128", "\248\136\128\128\128",
+   "\194", "\226\130", "x\226\130\172y", "\128\128", "a\194\169\194",
+}
+
+do
+   local all = {}
+   for b = 0, 255 do
+      all[#all+1] = string.char(b)
+   end
+   all = table.concat(all)
+   table.insert(samples, all)
+   table.insert(samples, all:reverse())
+end
+
+do
+   local alphabet = {
+      "a", "Z", "0", " ", "+", "%", "=", "&", ";", "<", ">", "\"", "/", ":",
+      "~", "'", "2", "f", "\0", "\127", "\128", "\191", "\194", "\226",
+      "\240", "\255", "\169", "\130", "\172"
+   }
+   math.randomseed(38)
+   for _ = 1, 2000 do
+      local t = {}
+      for ii = 1, math.random(0, 12) do
+         t[ii] = alphabet[math.random(#alphabet)]
+      end
+      table.insert(samples, table.concat(t))
+   end
+end
+
+
+-- Return a function's results, or the error it raised, as a table.
+--
+local function try(f, ...)
+   local r = table.pack(pcall(f, ...))
+   if not r[1] then
+      return { err = tostring(r[2]):match("utf8utils: .*") or r[2] }
+   end
+   return r
+end
+
+
+local lua = xuri._lua
+local luaDecode, luaValidate = utf8utils._luaDecode, utf8utils._luaValidate
+
+local function badUTF8(n, s)
+   return "bad", n, s
+end
+
+
+for _, s in ipairs(samples) do
+   -- xuri
+   for _, name in ipairs{"pctDecode", "paramDecode", "paramEncode",
+                         "pathEncode", "authorityEncode", "parseParams"} do
+      eq(lua[name](s), textcodec_c[name](s))
+   end
+
+   -- utf8utils
+   eq(try(luaDecode, s), try(utf8utils.decode, s))
+   eq(try(luaDecode, s, badUTF8), try(utf8utils.decode, s, badUTF8))
+   eq(try(luaValidate, s), try(utf8utils.validate, s))
+
+   -- htmlgen
+   eq(htmlgen._luaHtmlEscape(s), textcodec_c.htmlEscape(s))
+end
+
+
+-- parseParams(nil) and round trips through the public API
+
+eq({}, textcodec_c.parseParams(nil))
+eq({}, lua.parseParams(nil))
+eq({ a="b", c="1", "x" }, textcodec_c.parseParams("a=b;c=1;x"))
+
+local uri = "http://h:8/a%20b/c+d?x=1+2&y=%3D;z#f%23"
+eq(xuri.gen(xuri.parse(uri)), "http://h:8/a%20b/c+d?z;x=1+2;y=%3D#f%23")
@@ -46,7 +46,7 @@ local mbpattern = "[\128-\255][\128-\191]*"
 -- Convert utf-8-encoded character to numeric value
 ----------------------------------------------------------------
 
-local function decode(s, ferr)
+local function luaDecode(s, ferr)
    -- assuming a >= 192, b in [128, 191]
    local n, min
    if match(s, "^[\192-\223][\128-\191]$") then
@@ -61,7 +61,7 @@ local function decode(s, ferr)
       -- four-byte sequence
       n = (((byte(s,1)-240)*64 + byte(s,2)-128)*64 + byte(s,3)-128)*64 + byte(s,4)-128
       min = 0x10000
-   elseif match(s, "^[%z-\127]$") then
+   elseif match(s, "^[%z\1-\127]$") then
       -- single-byte sequence
       n = byte(s,1)
       min = 0
@@ -84,9 +84,38 @@ end
 -- Throw an error if 'str' is not valid utf-8 as per RFC 3629
 ----------------------------------------------------------------
 
-local function validate(str)
+local function luaValidate(str)
    for s in str:gmatch(mbpattern) do
-      decode(s)
+      luaDecode(s)
+   end
+end
+
+
+-- Use the native codec when it is available; otherwise (e.g. in an
+-- interpreter without the extension) fall back to the Lua implementation.
+-- @require textcodec_c   (bundle the native codec)
+local succ, textcodec_c = pcall(require, "textcodec_c")
+local decode, validate = luaDecode, luaValidate
+
+if succ then
+   local utf8Decode, utf8Check = textcodec_c.utf8Decode, textcodec_c.utf8Check
+
+   function decode(s, ferr)
+      local n, valid = utf8Decode(s)
+      if valid then
+         return n
+      elseif ferr then
+         return ferr(n, s)
+      else
+         error("utf8utils: invalid byte sequence")
+      end
+   end
+
+   function validate(str)
+      local a, b = utf8Check(str)
+      if a then
+         decode(str:sub(a, b))
+      end
    end
 end
 
@@ -124,5 +153,9 @@ return {
    validate = validate,
    mbpattern = mbpattern,
    binToChars = binToChars,
-   charsToBin = charsToBin
+   charsToBin = charsToBin,
+   isNative = succ,
+   -- for testing
+   _luaDecode = luaDecode,
+   _luaValidate = luaValidate,
 }
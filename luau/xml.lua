@@ -3,6 +3,12 @@
 
 local utf8utils = require "utf8utils"
 
+-- @require xml_c   (bundle the native SAX parser, when found)
+local succ, xml_c = pcall(require, "xml_c")
+if not succ then
+   xml_c = nil
+end
+
 local insert, remove, concat = table.insert, table.remove, table.concat
 
 local xml = {}
@@ -254,11 +260,27 @@ local function SAX(text, fnText, fnStart, fnEnd, fnComm, fnPI)
 end
 
 
-function xml.SAX(...)
+-- Lua implementation of SAX (for testing and benchmarking)
+--
+function xml._luaSAX(...)
    return pcall(SAX, ...)
 end
 
 
+if xml_c then
+   local nativeSAX = xml_c.SAX
+
+   function xml.SAX(text, fnText, fnStart, fnEnd, fnComm, fnPI)
+      return pcall(nativeSAX, text, fnText, fnStart, fnEnd, fnComm, fnPI,
+                   xml.maxBuffer)
+   end
+else
+   xml.SAX = xml._luaSAX
+end
+
+xml.isNative = (xml_c ~= nil)
+
+
 
 
 -- These special keys are named with "<...>" to avoid colliding with actual
@@ -0,0 +1,780 @@
+// xml_c: Native SAX tokenizer for xml.lua
+//
+// See xml.txt.
+//
+// `xml_c.SAX(text|reader, fnText, fnStart, fnEnd, fnComm, fnPI, maxBuffer)`
+// follows the callback contract of the Lua implementation in xml.lua,
+// which uses this module when it is available.  Errors are thrown; xml.lua
+// converts them to `nil, <error>` results.
+//
+// Streaming input is accumulated in a growable buffer.  Data that has been
+// consumed is discarded only when the buffer fills up, so the unconsumed
+// tail is not recopied on each read.
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lualib.h"
+#include "lauxlib.h"
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+// Initial size of the stream buffer
+#define INITIAL_SIZE 4096
+
+// Stack layout in xml_c_SAX
+
+#define ARG_SOURCE    1
+#define ARG_TEXT      2
+#define ARG_START     3
+#define ARG_END       4
+#define ARG_COMM      5
+#define ARG_PI        6
+#define ARG_MAXBUFFER 7
+#define NDX_STREAM    8
+#define NDX_GETTEXT   9
+#define NDX_GETCDATA  10
+#define NDX_EMPTY     11
+
+// results of scanning functions
+#define NO_MATCH   0
+#define MATCH      1
+#define NEED_MORE  2
+
+
+//----------------------------------------------------------------
+// Character classes
+//----------------------------------------------------------------
+
+// S = " \t\n\r"
+static int isSpace(int ch)
+{
+   return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+
+// Name = "A-Za-z:_\128-\255-.0-9"
+static int isName(int ch)
+{
+   return ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+           (ch >= '0' && ch <= '9') || ch >= 128 ||
+           ch == ':' || ch == '_' || ch == '-' || ch == '.');
+}
+
+
+static int isAlnum(int ch)
+{
+   return ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+           (ch >= '0' && ch <= '9'));
+}
+
+
+static int hexValue(int ch)
+{
+   return (ch >= '0' && ch <= '9' ? ch - '0' :
+           ch >= 'a' && ch <= 'f' ? ch - 'a' + 10 :
+           ch >= 'A' && ch <= 'F' ? ch - 'A' + 10 :
+           -1);
+}
+
+
+//----------------------------------------------------------------
+// Entity decoding
+//----------------------------------------------------------------
+
+// Parse hex digits as `tonumber(s, 16)` does.  Return -1 if `s` is empty
+// or contains an invalid digit.  Values too large to encode are returned as
+// 0x110000.
+//
+static long parseHex(const char *s, size_t len)
+{
+   long n = 0;
+   size_t ii;
+
+   if (len == 0) {
+      return -1;
+   }
+   for (ii = 0; ii < len; ++ii) {
+      int d = hexValue((unsigned char) s[ii]);
+      if (d < 0) {
+         return -1;
+      }
+      n = n * 16 + d;
+      if (n > 0x10FFFF) {
+         n = 0x110000;
+      }
+   }
+   return n;
+}
+
+
+// Add utf-8 encoding of `n` to `b`.
+//
+static void addUTF8(lua_State *L, luaL_Buffer *b, long n)
+{
+   char s[4];
+   size_t len;
+
+   if (n <= 0x7F) {
+      s[0] = (char) n;
+      len = 1;
+   } else if (n <= 0x7FF) {
+      s[0] = (char) (0xC0 | (n >> 6));
+      s[1] = (char) (0x80 | (n & 0x3F));
+      len = 2;
+   } else if (n <= 0xFFFF) {
+      s[0] = (char) (0xE0 | (n >> 12));
+      s[1] = (char) (0x80 | ((n >> 6) & 0x3F));
+      s[2] = (char) (0x80 | (n & 0x3F));
+      len = 3;
+   } else if (n <= 0x10FFFF) {
+      s[0] = (char) (0xF0 | (n >> 18));
+      s[1] = (char) (0x80 | ((n >> 12) & 0x3F));
+      s[2] = (char) (0x80 | ((n >> 6) & 0x3F));
+      s[3] = (char) (0x80 | (n & 0x3F));
+      len = 4;
+   } else {
+      luaL_error(L, "utf8: bad argument #1 to 'encode'");
+      return;
+   }
+   luaL_addlstring(b, s, len);
+}
+
+
+static const struct {
+   const char *name;
+   const char *value;
+} entities[] = {
+   { "amp", "&" },
+   { "quot", "\"" },
+   { "apos", "'" },
+   { "lt", "<" },
+   { "gt", ">" },
+};
+
+
+// Add the replacement for entity `s` (the text between "&" and ";").  As
+// in xml.lua, unrecognized entities are replaced with their names.
+//
+static void addEntity(lua_State *L, luaL_Buffer *b, const char *s, size_t len)
+{
+   size_t ii;
+   long n = -1;
+
+   for (ii = 0; ii < ARRAY_LENGTH(entities); ++ii) {
+      if (strlen(entities[ii].name) == len && !memcmp(entities[ii].name, s, len)) {
+         luaL_addstring(b, entities[ii].value);
+         return;
+      }
+   }
+
+   if (len >= 2 && s[0] == '#' && s[1] == 'x') {
+      n = parseHex(s+2, len-2);
+   } else if (s[0] == '#') {
+      // xml.lua uses `tonumber`, which also accepts forms like "0x41" and
+      // "1e3".  The stack use is balanced, as `b` requires.
+      int isNum;
+      lua_Number d;
+      lua_pushlstring(L, s+1, len-1);
+      d = lua_tonumberx(L, -1, &isNum);
+      lua_pop(L, 1);
+      if (isNum) {
+         n = (d > 0x10FFFF ? 0x110000 : (long) d);
+      }
+   }
+
+   if (n >= 0) {
+      addUTF8(L, b, n);
+   } else {
+      luaL_addlstring(b, s, len);
+   }
+}
+
+
+// Push `s` with entity and character references replaced.  This is
+// equivalent to `s:gsub("&(#?%w+);", decodeEntity)`.
+//
+static void pushDecoded(lua_State *L, const char *s, size_t len)
+{
+   const char *end = s + len;
+   const char *amp = memchr(s, '&', len);
+   luaL_Buffer b;
+
+   if (amp == NULL) {
+      lua_pushlstring(L, s, len);
+      return;
+   }
+
+   luaL_buffinit(L, &b);
+   do {
+      const char *a = amp + 1;
+      const char *z;
+
+      luaL_addlstring(&b, s, amp - s);
+      if (a < end && *a == '#') {
+         ++a;
+      }
+      for (z = a; z < end && isAlnum((unsigned char) *z); ++z)
+         ;
+      if (z > a && z < end && *z == ';') {
+         addEntity(L, &b, amp+1, z - (amp+1));
+         s = z + 1;
+      } else {
+         luaL_addchar(&b, '&');
+         s = amp + 1;
+      }
+   } while ( (amp = memchr(s, '&', end - s)) != NULL);
+
+   luaL_addlstring(&b, s, end - s);
+   luaL_pushresult(&b);
+}
+
+
+// getText() for character data: upvalue 1 holds the undecoded string.
+//
+static int getText(lua_State *L)
+{
+   size_t len;
+   const char *s = lua_tolstring(L, lua_upvalueindex(1), &len);
+
+   if (s == NULL || memchr(s, '&', len) == NULL) {
+      lua_pushvalue(L, lua_upvalueindex(1));
+   } else {
+      pushDecoded(L, s, len);
+   }
+   return 1;
+}
+
+
+// getText() for CDATA sections
+//
+static int getCDATA(lua_State *L)
+{
+   lua_pushvalue(L, lua_upvalueindex(1));
+   return 1;
+}
+
+
+//----------------------------------------------------------------
+// Stream
+//----------------------------------------------------------------
+
+typedef struct {
+   const char *buf;   // start of data (`mem`, or a string on the Lua stack)
+   char *mem;         // allocated buffer (or NULL)
+   size_t pos;        // start of unconsumed data
+   size_t len;        // end of data
+   size_t cap;        // size of `mem`
+   size_t maxBuffer;
+   int eof;
+} Stream;
+
+
+static int stream_gc(lua_State *L)
+{
+   Stream *st = (Stream *) lua_touserdata(L, 1);
+   free(st->mem);
+   st->mem = NULL;
+   return 0;
+}
+
+
+// Read more data from the reader.  Consumed data (preceding `pos`) may be
+// discarded, so callers must use offsets relative to `pos`.  Returns 0 at
+// end of stream.
+//
+static int more(lua_State *L, Stream *st)
+{
+   const char *data;
+   size_t size;
+
+   if (st->eof) {
+      return 0;
+   }
+
+   if (st->len - st->pos >= st->maxBuffer) {
+      luaL_error(L, "xml: buffering limit reached");
+   }
+
+   lua_pushvalue(L, ARG_SOURCE);
+   lua_call(L, 0, 1);
+   data = lua_tolstring(L, -1, &size);
+   if (data == NULL) {
+      lua_pop(L, 1);
+      st->eof = 1;
+      return 0;
+   }
+
+   if (st->len + size > st->cap) {
+      size_t keep = st->len - st->pos;
+
+      if (st->mem) {
+         memmove(st->mem, st->mem + st->pos, keep);
+      }
+      st->pos = 0;
+      st->len = keep;
+
+      if (keep + size > st->cap / 2) {
+         size_t cap = st->cap * 2;
+         char *mem;
+
+         if (cap < (keep + size) * 2) {
+            cap = (keep + size) * 2;
+         }
+         if (cap < INITIAL_SIZE) {
+            cap = INITIAL_SIZE;
+         }
+         mem = (char *) realloc(st->mem, cap);
+         if (mem == NULL) {
+            luaL_error(L, "xml: out of memory");
+         }
+         st->mem = mem;
+         st->cap = cap;
+      }
+      st->buf = st->mem;
+   }
+
+   if (size > 0) {
+      memcpy(st->mem + st->len, data, size);
+      st->len += size;
+   }
+   lua_pop(L, 1);
+   return 1;
+}
+
+
+// Find `pat` in the unconsumed data, starting at offset `from` (relative to
+// `pos`), reading more data as necessary.  On success, store the offset of
+// the match in `*pFound` and return 1.  Return 0 at end of stream.
+//
+static int findSeq(lua_State *L, Stream *st, size_t from, const char *pat, size_t *pFound)
+{
+   size_t patLen = strlen(pat);
+
+   for (;;) {
+      const char *p = st->buf + st->pos;
+      size_t avail = st->len - st->pos;
+      const char *q = p + from;
+
+      while (q + patLen <= p + avail) {
+         q = memchr(q, pat[0], p + avail - q);
+         if (q == NULL || q + patLen > p + avail) {
+            break;
+         }
+         if (!memcmp(q, pat, patLen)) {
+            *pFound = q - p;
+            return 1;
+         }
+         ++q;
+      }
+
+      if (avail + 1 > from + patLen) {
+         from = avail + 1 - patLen;
+      }
+      if (!more(L, st)) {
+         return 0;
+      }
+   }
+}
+
+
+//----------------------------------------------------------------
+// Tags
+//----------------------------------------------------------------
+
+// Result of scanning "<" (tch) (name) S* (pos1) .- ">"
+//
+typedef struct {
+   int tch;         // '/', '!', '?', or 0
+   size_t name;     // offset of name
+   size_t nameLen;
+   size_t pos1;     // offset following name and spaces
+   size_t gt;       // offset of first ">" at or following pos1
+} Tag;
+
+
+// Scan a tag starting at offset `lt` in `p`.  Offsets are relative to `p`.
+//
+static int scanTag(const char *p, size_t lt, size_t avail, Tag *tag)
+{
+   size_t n = lt + 1;
+   const char *gt;
+
+   if (n >= avail) {
+      return NEED_MORE;
+   }
+   tag->tch = 0;
+   if (p[n] == '/' || p[n] == '!' || p[n] == '?') {
+      tag->tch = p[n++];
+   }
+   tag->name = n;
+   while (n < avail && isName((unsigned char) p[n])) {
+      ++n;
+   }
+   tag->nameLen = n - tag->name;
+   while (n < avail && isSpace((unsigned char) p[n])) {
+      ++n;
+   }
+   if (n >= avail) {
+      return NEED_MORE;
+   }
+   tag->pos1 = n;
+   gt = memchr(p + n, '>', avail - n);
+   if (gt == NULL) {
+      return NEED_MORE;
+   }
+   tag->gt = gt - p;
+   return MATCH;
+}
+
+
+// Scan: S* (Name*) S* "=" S* (quote)
+//
+static int scanAttr(const char *p, size_t avail, size_t *pName, size_t *pNameLen, size_t *pValue)
+{
+   size_t n = 0;
+
+   while (n < avail && isSpace((unsigned char) p[n])) {
+      ++n;
+   }
+   *pName = n;
+   while (n < avail && isName((unsigned char) p[n])) {
+      ++n;
+   }
+   *pNameLen = n - *pName;
+   while (n < avail && isSpace((unsigned char) p[n])) {
+      ++n;
+   }
+   if (n >= avail) {
+      return NEED_MORE;
+   }
+   if (p[n++] != '=') {
+      return NO_MATCH;
+   }
+   while (n < avail && isSpace((unsigned char) p[n])) {
+      ++n;
+   }
+   if (n >= avail) {
+      return NEED_MORE;
+   }
+   if (p[n] != '"' && p[n] != '\'') {
+      return NO_MATCH;
+   }
+   *pValue = n + 1;
+   return MATCH;
+}
+
+
+// Scan: S* ("/"?) ">"
+//
+static int scanClose(const char *p, size_t avail, int *pbClose, size_t *pEnd)
+{
+   size_t n = 0;
+
+   while (n < avail && isSpace((unsigned char) p[n])) {
+      ++n;
+   }
+   *pbClose = 0;
+   if (n < avail && p[n] == '/') {
+      *pbClose = 1;
+      ++n;
+   }
+   if (n >= avail) {
+      return NEED_MORE;
+   }
+   if (p[n] != '>') {
+      return NO_MATCH;
+   }
+   *pEnd = n + 1;
+   return MATCH;
+}
+
+
+// Parse attributes at `pos` and advance `pos` past the end of the start
+// tag.  Push a table of attributes and return 1 if this is an empty
+// element tag.
+//
+static int readAttrs(lua_State *L, Stream *st)
+{
+   size_t name, nameLen, value, end;
+   int r, bClose;
+
+   lua_newtable(L);
+
+   for (;;) {
+      r = scanAttr(st->buf + st->pos, st->len - st->pos, &name, &nameLen, &value);
+      if (r == NEED_MORE) {
+         if (more(L, st)) {
+            continue;
+         }
+         r = NO_MATCH;
+      }
+      if (r == NO_MATCH) {
+         break;
+      }
+
+      if (!findSeq(L, st, value,
+                   (st->buf[st->pos + value - 1] == '"' ? "\"" : "'"), &end)) {
+         luaL_error(L, "xml: bad attribute value");
+      }
+      lua_pushlstring(L, st->buf + st->pos + name, nameLen);
+      pushDecoded(L, st->buf + st->pos + value, end - value);
+      lua_rawset(L, -3);
+      st->pos += end + 1;
+   }
+
+   for (;;) {
+      r = scanClose(st->buf + st->pos, st->len - st->pos, &bClose, &end);
+      if (r == MATCH) {
+         break;
+      }
+      if (r == NO_MATCH || !more(L, st)) {
+         luaL_error(L, "xml: bad attribute");
+      }
+   }
+   st->pos += end;
+   return bClose;
+}
+
+
+//----------------------------------------------------------------
+// SAX
+//----------------------------------------------------------------
+
+// Call fnText for character data (`isCDATA` == 0) or a CDATA section.
+//
+static void emitText(lua_State *L, const char *s, size_t len, int isCDATA)
+{
+   int ndxGet = (isCDATA ? NDX_GETCDATA : NDX_GETTEXT);
+
+   if (lua_toboolean(L, ARG_TEXT)) {
+      lua_pushvalue(L, ARG_TEXT);
+      lua_pushlstring(L, s, len);
+      lua_pushvalue(L, -1);
+      lua_setupvalue(L, ndxGet, 1);
+      lua_pushvalue(L, ndxGet);
+      lua_call(L, 2, 0);
+   }
+}
+
+
+// Call fnComm(str, 1, #str) or fnPI(name, str, 1, #str).  For PI, the name
+// is at the top of the stack.
+//
+static void emitSection(lua_State *L, int ndxFn, const char *s, size_t len)
+{
+   int nargs = (ndxFn == ARG_PI ? 4 : 3);
+
+   if (lua_toboolean(L, ndxFn)) {
+      lua_pushvalue(L, ndxFn);
+      if (ndxFn == ARG_PI) {
+         lua_pushvalue(L, -2);
+      }
+      lua_pushlstring(L, s, len);
+      lua_pushinteger(L, 1);
+      lua_pushinteger(L, (lua_Integer) len);
+      lua_call(L, nargs, 0);
+   }
+}
+
+
+// Handle a comment, CDATA section, or PI that begins at `pos` and ends
+// with `term`.  Unterminated sections extend to the end of the stream.
+//
+static void readSection(lua_State *L, Stream *st, int ndxFn, const char *term)
+{
+   size_t end;
+   size_t next;
+
+   if (findSeq(L, st, 0, term, &end)) {
+      next = end + strlen(term);
+   } else {
+      end = next = st->len - st->pos;
+   }
+
+   if (ndxFn == ARG_TEXT) {
+      emitText(L, st->buf + st->pos, end, 1);
+   } else {
+      emitSection(L, ndxFn, st->buf + st->pos, end);
+   }
+   st->pos += next;
+}
+
+
+static int xml_c_SAX(lua_State *L)
+{
+   Stream *st;
+   size_t scan = 0;  // offset (from `pos`) at which to resume search for "<"
+   lua_Number maxBuffer = luaL_optnumber(L, ARG_MAXBUFFER, 1e7);
+
+   lua_settop(L, ARG_MAXBUFFER);
+   luaL_checkstack(L, 20, "xml: stack overflow");
+
+   st = (Stream *) lua_newuserdata(L, sizeof(Stream));
+   memset(st, 0, sizeof *st);
+   lua_pushvalue(L, lua_upvalueindex(1));
+   lua_setmetatable(L, NDX_STREAM);
+
+   st->maxBuffer = (size_t) maxBuffer;
+   if (lua_type(L, ARG_SOURCE) == LUA_TSTRING) {
+      st->buf = lua_tolstring(L, ARG_SOURCE, &st->len);
+      st->eof = 1;
+   } else {
+      luaL_checktype(L, ARG_SOURCE, LUA_TFUNCTION);
+      st->buf = "";
+      (void) more(L, st);
+   }
+
+   lua_pushnil(L);
+   lua_pushcclosure(L, getText, 1);    // NDX_GETTEXT
+   lua_pushnil(L);
+   lua_pushcclosure(L, getCDATA, 1);   // NDX_GETCDATA
+   lua_newtable(L);                    // NDX_EMPTY
+
+   for (;;) {
+      const char *p = st->buf + st->pos;
+      size_t avail = st->len - st->pos;
+      const char *plt = memchr(p + scan, '<', avail - scan);
+      Tag tag;
+      int r = NO_MATCH;
+
+      if (plt) {
+         r = scanTag(p, plt - p, avail, &tag);
+         scan = plt - p;
+      } else {
+         scan = avail;
+      }
+
+      if (r != MATCH) {
+         if (more(L, st)) {
+            continue;
+         }
+         // end of stream: everything remaining is text
+         if (avail > 0) {
+            emitText(L, p, avail, 0);
+         }
+         break;
+      }
+
+      if (scan > 0) {
+         emitText(L, p, scan, 0);
+      }
+      st->pos += scan;
+      scan = 0;
+      // offsets in `tag` are now relative to `pos`
+      tag.name -= (plt - p);
+      tag.pos1 -= (plt - p);
+      tag.gt -= (plt - p);
+
+      if (tag.tch == 0 || tag.tch == '/' || tag.tch == '?') {
+         lua_pushlstring(L, st->buf + st->pos + tag.name, tag.nameLen);
+      }
+
+      if (tag.tch == 0) {
+
+         // STag or EmptyElemTag
+
+         int bClose = 0;
+         if (tag.gt == tag.pos1) {
+            lua_pushvalue(L, NDX_EMPTY);
+            st->pos += tag.gt + 1;
+         } else if (tag.gt == tag.pos1 + 1 && st->buf[st->pos + tag.pos1] == '/') {
+            lua_pushvalue(L, NDX_EMPTY);
+            st->pos += tag.gt + 1;
+            bClose = 1;
+         } else {
+            st->pos += tag.pos1;
+            bClose = readAttrs(L, st);
+         }
+         // stack: name attrs
+         if (lua_toboolean(L, ARG_START)) {
+            lua_pushvalue(L, ARG_START);
+            lua_pushvalue(L, -3);
+            lua_pushvalue(L, -3);
+            lua_call(L, 2, 0);
+         }
+         lua_pop(L, 1);
+         if (bClose && lua_toboolean(L, ARG_END)) {
+            lua_pushvalue(L, ARG_END);
+            lua_pushvalue(L, -2);
+            lua_call(L, 1, 0);
+         }
+         lua_pop(L, 1);
+
+      } else if (tag.tch == '/') {
+
+         // ETag
+
+         st->pos += tag.gt + 1;
+         if (lua_toboolean(L, ARG_END)) {
+            lua_pushvalue(L, ARG_END);
+            lua_pushvalue(L, -2);
+            lua_call(L, 1, 0);
+         }
+         lua_pop(L, 1);
+
+      } else if (tag.tch == '!') {
+
+         // Comment or CDATA
+
+         const char *s = st->buf + st->pos;
+         size_t len = st->len - st->pos;
+
+         if (len >= 4 && !memcmp(s, "<!--", 4)) {
+            st->pos += 4;
+            readSection(L, st, ARG_COMM, "-->");
+         } else if (len >= 9 && !memcmp(s, "<![CDATA[", 9)) {
+            st->pos += 9;
+            readSection(L, st, ARG_TEXT, "]]>");
+         } else {
+            lua_pushliteral(L, "xml: unrecognized tag: ");
+            lua_pushlstring(L, s, (len < 9 ? len : 9));
+            lua_concat(L, 2);
+            lua_error(L);
+         }
+
+      } else {
+
+         // PI
+
+         st->pos += tag.pos1;
+         readSection(L, st, ARG_PI, "?>");
+         lua_pop(L, 1);
+      }
+   }
+
+   return 0;
+}
+
+
+static const luaL_Reg xml_c_regs[] = {
+   {"SAX", xml_c_SAX},
+   {0,0}
+};
+
+
+LUAMOD_API int luaopen_xml_c(lua_State *L);
+
+LUAMOD_API int luaopen_xml_c(lua_State *L)
+{
+   const luaL_Reg *preg;
+
+   // create table
+   lua_createtable(L, 0, ARRAY_LENGTH(xml_c_regs));
+
+   // metatable for Stream objects (bound as an upvalue)
+   lua_createtable(L, 0, 1);
+   lua_pushcfunction(L, stream_gc);
+   lua_setfield(L, -2, "__gc");
+
+   // push c functions into the table
+   for (preg = &xml_c_regs[0]; preg->func; ++preg) {
+      lua_pushvalue(L, -1);
+      lua_pushcclosure(L, preg->func, 1);
+      lua_setfield(L, -3, preg->name);
+   }
+   lua_pop(L, 1);
+
+   return 1;
+}
@@ -49,9 +49,10 @@ function xlAttrs(t)
 end
 
 
--- Parse XML, generating simple text representation
+-- Parse XML, generating simple text representation.  `sax` defaults to
+-- xml.SAX.
 --
-local function xlSAX(text)
+local function xlSAX(text, sax)
    local str = ""
    local function Text (data, getit)
       str = str .. "(" .. getit() .. ")"
@@ -69,7 +70,7 @@ local function xlSAX(text)
       str = str .. "{?" .. name .. " " .. data:sub(a,b) .. "}"
    end
 
-   local succ, err = xml.SAX(text, Text, Open, Close, Comment, PI)
+   local succ, err = (sax or xml.SAX)(text, Text, Open, Close, Comment, PI)
    if not succ then
       print("error: " .. err)
       print("   in: " .. text)
@@ -78,47 +79,133 @@ local function xlSAX(text)
 end
 
 
-function qt.tests.SAX()
+local function testSAX(sax)
    local x
 
-   x = xlSAX('data')
+   x = xlSAX('data', sax)
    eq("(data)", x)
 
-   x = xlSAX('<a></a>')
+   x = xlSAX('<a></a>', sax)
    eq("{a:}a", x)
 
-   x = xlSAX('<A/><_AZaz09:/>')
+   x = xlSAX('<A/><_AZaz09:/>', sax)
    eq("{A:}A{_AZaz09::}_AZaz09:", x)
 
-   x = xlSAX('<a>data</a>')
+   x = xlSAX('<a>data</a>', sax)
    eq("{a:(data)}a", x)
 
-   x = xlSAX('pre<a>a1<b>btext</b> a3 <c>cdata</c></a>post')
+   x = xlSAX('pre<a>a1<b>btext</b> a3 <c>cdata</c></a>post', sax)
    eq("(pre){a:(a1){b:(btext)}b( a3 ){c:(cdata)}c}a(post)", x)
 
-   x = xlSAX('<a n1="v1"  n2 =" v2" n3= \'v3\'>a cdata</a>')
+   x = xlSAX('<a n1="v1"  n2 =" v2" n3= \'v3\'>a cdata</a>', sax)
    eq("{a;n1=(v1);n2=( v2);n3=(v3):(a cdata)}a", x)
 
-   x = xlSAX('<a b=\'y>x\' c= "j>i" d="\'"> v>u  </a>')
+   x = xlSAX('<a b=\'y>x\' c= "j>i" d="\'"> v>u  </a>', sax)
    eq("{a;b=(y>x);c=(j>i);d=('):( v>u  )}a", x)
 
-   x = xlSAX('pre<![CDATA[ is <cdata> &amp; foo]]>post')
+   x = xlSAX('pre<![CDATA[ is <cdata> &amp; foo]]>post', sax)
    eq("(pre)( is <cdata> &amp; foo)(post)", x)
 
-   x = xlSAX('<!-- a > b < c -->')
+   x = xlSAX('<!-- a > b < c -->', sax)
    eq('< a > b < c >', x)
 
-   x = xlSAX('<!-- c1 x="y"--><a>j<!--c2--></a>')
+   x = xlSAX('<!-- c1 x="y"--><a>j<!--c2--></a>', sax)
    eq('< c1 x="y">{a:(j)<c2>}a', x)
 
-   x = xlSAX('<?xml version="1.0"?><a></a>')
+   x = xlSAX('<?xml version="1.0"?><a></a>', sax)
    eq('{?xml version="1.0"}{a:}a', x)
 
-   x = xlSAX('<a />')
+   x = xlSAX('<a />', sax)
    eq('{a:}a', x)
 end
 
 
+function qt.tests.SAX()
+   testSAX(xml._luaSAX)
+   testSAX(xml.SAX)
+end
+
+
+function qt.tests.native()
+   -- Compare native and Lua implementations.  When the native library is
+   -- not available these are the same function.
+
+   local function both(text)
+      eq(xlSAX(text, xml._luaSAX), xlSAX(text, xml.SAX))
+   end
+
+   both('<a x="&lt;&#65;&#x42;&#0x43;&bogus;&;&#;&#xZ;">&amp&amp;&#9731;</a>')
+   both('<a b = "1" c=\'2\' />text<b/>')
+   both('<>< >')
+   both('</a b>')
+   both('x<![CDATA[unterminated')
+   both('<?pi unterminated>')
+   both('<!-- -- --><![CDATA[]]><?x?>')
+   both('a < b')
+   both('\195\169<\195\169 \195\169="\195\169"/>')
+
+   local function err(text)
+      return select(2, xml.SAX(text))
+   end
+   qt.match(err('<a b=c></a>'), "xml: bad attribute")
+   qt.match(err('<a b="c></a>'), "xml: bad attribute value")
+   qt.match(err('<!x>'), "xml: unrecognized tag: <!x>")
+
+   -- maxBuffer applies to streams
+   local saveMax = xml.maxBuffer
+   xml.maxBuffer = 100
+   local n = 0
+   local function read()
+      n = n + 1
+      return n < 100 and "0123456789" or nil
+   end
+   qt.match(err(read), "xml: buffering limit reached")
+   xml.maxBuffer = saveMax
+end
+
+
+function qt.tests.nativeEntities()
+   -- Character references are read as `tonumber` reads them.
+   eq("{a;b=(dA):(\207\168)}a", xlSAX('<a b="&#1e2;&#0x41;">&#1E3;</a>'))
+   eq("{a;b=(dA):(\207\168)}a",
+      xlSAX('<a b="&#1e2;&#0x41;">&#1E3;</a>', xml._luaSAX))
+
+   -- Compare native and Lua implementations on random references, in
+   -- text and in attribute values.  Values too large to encode are errors.
+   local function parse(sax, text)
+      local out = {}
+      local function Text(_, getText)
+         out[#out+1] = getText()
+      end
+      local function Open(_, attrs)
+         out[#out+1] = attrs.b
+      end
+      local succ, err = sax(text, Text, Open, nil, nil, nil)
+      if not succ then
+         qt.match(err, "utf8: bad argument")
+         return false
+      end
+      return table.concat(out, "|")
+   end
+
+   local alphabet = {
+      "0", "1", "7", "9", "a", "e", "E", "f", "F", "n", "p", "P", "x", "X",
+      "z", "#", "#", "#", "#0x", "&", ";"
+   }
+   math.randomseed(26)
+   for _ = 1, 2000 do
+      local t = {}
+      for ii = 1, math.random(1, 10) do
+         t[ii] = alphabet[math.random(#alphabet)]
+      end
+      local ref = "&" .. table.concat(t) .. ";"
+      for _, text in ipairs{ ref, '<a b="' .. ref .. '"/>' } do
+         eq(parse(xml._luaSAX, text), parse(xml.SAX, text))
+      end
+   end
+end
+
+
 function qt.tests.DOM()
    local x
 
@@ -196,7 +283,7 @@ function qt.tests.DOM()
 end
 
 
-function qt.tests.stream()
+local function testStream(sax)
    local function newRdr(txt, incr)
       local pos = 1
       local function read()
@@ -215,21 +302,27 @@ function qt.tests.stream()
 
    local str = 'p<a x="" y = "Y>W">a1<b>bt</b> a3 <c/><d >D</d></a>post'
    for _, n in ipairs{ 55, 52, 51, 50, 4, 3, 2, 1} do
-      local x = xlSAX( newRdr(str, n) )
+      local x = xlSAX( newRdr(str, n), sax )
       eq("(p){a;x=();y=(Y>W):(a1){b:(bt)}b( a3 ){c:}c{d:(D)}d}a(post)@n="..n,
          x.. "@n=" .. n)
 
-      x = xlSAX( newRdr('<!-- C > B < D -->', n) )
+      x = xlSAX( newRdr('<!-- C > B < D -->', n), sax )
       eq("< C > B < D >@n=" .. n,
          x .. "@n=" .. n)
 
-      x = xlSAX( newRdr('<?foo C > B < D ?>', n) )
+      x = xlSAX( newRdr('<?foo C > B < D ?>', n), sax )
       eq("{?foo C > B < D }@n=" .. n,
          x .. "@n=" .. n)
    end
 end
 
 
+function qt.tests.stream()
+   testStream(xml._luaSAX)
+   testStream(xml.SAX)
+end
+
+
 if arg[1] == "-dump" then
    local fname = arg[2]
 
@@ -11,7 +11,10 @@
 // On Windows, support long paths using utf-8
 
 
-#define _POSIX_C_SOURCE 200112L
+#define _POSIX_C_SOURCE 200809L
+
+// DT_* (dirent.d_type) constants
+#define _DEFAULT_SOURCE
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -37,6 +40,8 @@
 
 #  include <direct.h>
 #  include <errno.h>
+#  include <process.h>
+#  define getpid _getpid
 #  define chdir _chdir
 #  define mkdir(p,m) _mkdir(p)
 #  define rmdir _rmdir
@@ -48,6 +53,8 @@
 #  include <unistd.h>
 #  include <sys/errno.h>
 #  include <dirent.h>
+#  include <fcntl.h>
+#  include <limits.h>
 
 #endif
 
@@ -139,12 +146,135 @@ static int xpfs_chmod(lua_State *L)
 #define MAX(a,b)  ( (a) > (b) ? (a) : (b) )
 
 
+// Fields selected by a `mask` string
+
+#define SF_PERM    0x001
+#define SF_KIND    0x002
+#define SF_SIZE    0x004
+#define SF_TIME    0x008
+#define SF_MTIME   0x010
+#define SF_ATIME   0x020
+#define SF_CTIME   0x040
+#define SF_INODE   0x080
+#define SF_DEV     0x100
+#define SF_UID     0x200
+#define SF_GID     0x400
+#define SF_ALL     0x7FF
+
+
+static unsigned parseMask(const char *mask)
+{
+   static const char letters[] = "pkstmacidug";
+   unsigned fields = 0;
+   const char *pch;
+
+   for ( ; *mask; ++mask) {
+      if (*mask == '*') {
+         fields |= SF_ALL;
+      } else if ( (pch = strchr(letters, *mask)) != NULL) {
+         fields |= 1u << (pch - letters);
+      }
+   }
+   return fields;
+}
+
+
+static int countBits(unsigned n)
+{
+   int count;
+   for (count = 0; n; n &= n - 1) {
+      ++count;
+   }
+   return count;
+}
+
+
+static const char *kindOf(mode_t mode)
+{
+   return (S_ISREG(mode) ? "f" :
+           S_ISDIR(mode) ? "d" :
+           S_ISLNK(mode) ? "l" :
+           S_ISBLK(mode) ? "b" :
+           S_ISCHR(mode) ? "c" :
+           S_ISSOCK(mode) ? "s" :
+           S_ISFIFO(mode) ? "p" :
+           "o");
+}
+
+
 // Construct xpfs.stat() result on Lua stack.
 //
+static void pushStat(lua_State *L, const struct stat *info, unsigned fields)
+{
+
+   lua_createtable(L, 0, countBits(fields));
+
+   if (fields & SF_PERM) {
+      char perm[11];
+      unsigned m = (unsigned) info->st_mode;
+      int group;
+
+      for (group = 2; group >= 0; --group, m >>=3) {
+         perm[group*3 + 0] = ((m&4) ? 'r' : '-');
+         perm[group*3 + 1] = ((m&2) ? 'w' : '-');
+         perm[group*3 + 2] = ((m&1) ? 'x' : '-');
+      }
+      perm[9] = '\0';
+      lua_pushstring(L, perm);
+      lua_setfield(L, -2, "perm");
+   }
+
+   if (fields & SF_KIND) {
+      lua_pushstring(L, kindOf(info->st_mode));
+      lua_setfield(L, -2, "kind");
+   }
+
+   if (fields & SF_SIZE) {
+      lua_pushnumber(L, (lua_Number) info->st_size);
+      lua_setfield(L, -2, "size");
+   }
+
+   if (fields & SF_TIME) {
+      lua_pushnumber(L, MAX( DTIME(*info, m), DTIME(*info, c)) );
+      lua_setfield(L, -2, "time");
+   }
+
+   if (fields & SF_MTIME) {
+      STORETIME(*info, m, "mtime");
+   }
+
+   if (fields & SF_ATIME) {
+      STORETIME(*info, a, "atime");
+   }
+
+   if (fields & SF_CTIME) {
+      STORETIME(*info, c, "ctime");
+   }
+
+   if (fields & SF_INODE) {
+      lua_pushnumber(L, (lua_Number) info->st_ino);
+      lua_setfield(L, -2, "inode");
+   }
+
+   if (fields & SF_DEV) {
+      lua_pushnumber(L, (lua_Number) info->st_dev);
+      lua_setfield(L, -2, "dev");
+   }
+
+   if (fields & SF_UID) {
+      lua_pushnumber(L, (lua_Number) info->st_uid);
+      lua_setfield(L, -2, "uid");
+   }
+
+   if (fields & SF_GID) {
+      lua_pushnumber(L, (lua_Number) info->st_gid);
+      lua_setfield(L, -2, "gid");
+   }
+}
+
+
 static int do_stat(lua_State *L, const char *filename, const char *mask)
 {
-   const char *pch;
-   int ch;
    int nerr;
    struct stat info;
 
@@ -159,90 +289,60 @@ static int do_stat(lua_State *L, const char *filename, const char *mask)
       return 2;
    }
 
-   lua_createtable(L, 0, strlen(mask));
-
-   for (pch = mask; (ch = *pch++) != '\0'; ) {
-
-      if (ch == '*' || ch == 'p') {
-         char perm[11];
-         unsigned m = (unsigned) info.st_mode;
-         int group;
+   pushStat(L, &info, parseMask(mask));
+   return 1;
+}
 
-         for (group = 2; group >= 0; --group, m >>=3) {
-            perm[group*3 + 0] = ((m&4) ? 'r' : '-');
-            perm[group*3 + 1] = ((m&2) ? 'w' : '-');
-            perm[group*3 + 2] = ((m&1) ? 'x' : '-');
-         }
-         perm[9] = '\0';
-         lua_pushstring(L, perm);
-         lua_setfield(L, -2, "perm");
-      }
 
-      if (ch == '*' || ch == 'k') {
-         const char *kind = (S_ISREG(info.st_mode) ? "f" :
-                             S_ISDIR(info.st_mode) ? "d" :
-                             S_ISLNK(info.st_mode) ? "l" :
-                             S_ISBLK(info.st_mode) ? "b" :
-                             S_ISCHR(info.st_mode) ? "c" :
-                             S_ISSOCK(info.st_mode) ? "s" :
-                             S_ISFIFO(info.st_mode) ? "p" :
-                             "o");
-         lua_pushstring(L, kind);
-         lua_setfield(L, -2, "kind");
-      }
+static int xpfs_stat(lua_State *L)
+{
+   return do_stat(L, luaL_checkstring(L, 1), luaL_optstring(L, 2, "*"));
+}
 
-      if (ch == '*' || ch == 's') {
-         lua_pushnumber(L, (lua_Number) info.st_size);
-         lua_setfield(L, -2, "size");
-      }
 
-      if (ch == '*' || ch == 't') {
-         lua_pushnumber(L, MAX( DTIME(info, m), DTIME(info, c)) );
-         lua_setfield(L, -2, "time");
-      }
+//----------------------------------------------------------------
+// statMany(names, mask)
+//----------------------------------------------------------------
 
-      if (ch == '*' || ch == 'm') {
-         STORETIME(info, m, "mtime");
-      }
+static int xpfs_statMany(lua_State *L)
+{
+   const char *mask = luaL_optstring(L, 2, "*");
+   unsigned fields = parseMask(mask);
+   int count;
+   int ndx;
 
-      if (ch == '*' || ch == 'a') {
-         STORETIME(info, a, "atime");
-      }
+   luaL_checktype(L, 1, LUA_TTABLE);
+   count = (int) lua_rawlen(L, 1);
 
-      if (ch == '*' || ch == 'c') {
-         STORETIME(info, c, "ctime");
-      }
+   lua_createtable(L, count, 0);
+   for (ndx = 1; ndx <= count; ++ndx) {
+      const char *filename;
+      struct stat info;
+      int nerr;
 
-      if (ch == '*' || ch == 'i') {
-         lua_pushnumber(L, (lua_Number) info.st_ino);
-         lua_setfield(L, -2, "inode");
+      lua_rawgeti(L, 1, ndx);
+      filename = lua_tostring(L, -1);
+      if (filename == NULL) {
+         return luaL_error(L, "xpfs.statMany: names[%d] is not a string", ndx);
       }
-
-      if (ch == '*' || ch == 'd') {
-         lua_pushnumber(L, (lua_Number) info.st_dev);
-         lua_setfield(L, -2, "dev");
-      }
-
-      if (ch == '*' || ch == 'u') {
-         lua_pushnumber(L, (lua_Number) info.st_uid);
-         lua_setfield(L, -2, "uid");
+      if (*mask == 'L') {
+         nerr = lstat(filename, &info);
+      } else {
+         nerr = stat(filename, &info);
       }
+      lua_pop(L, 1);
 
-      if (ch == '*' || ch == 'g') {
-         lua_pushnumber(L, (lua_Number) info.st_gid);
-         lua_setfield(L, -2, "gid");
+      if (nerr != 0) {
+         lua_pushboolean(L, 0);
+      } else {
+         pushStat(L, &info, fields);
       }
+      lua_rawseti(L, -2, ndx);
    }
    return 1;
 }
 
 
-static int xpfs_stat(lua_State *L)
-{
-   return do_stat(L, luaL_checkstring(L, 1), luaL_optstring(L, 2, "*"));
-}
-
-
 //----------------------------------------------------------------
 // remove(filename)
 //
@@ -360,6 +460,17 @@ static int xpfs_getcwd(lua_State *L)
 }
 
 
+//----------------------------------------------------------------
+// getpid()
+//----------------------------------------------------------------
+
+static int xpfs_getpid(lua_State *L)
+{
+   lua_pushinteger(L, (lua_Integer) getpid());
+   return 1;
+}
+
+
 //----------------------------------------------------------------
 // rename(from, to)
 //----------------------------------------------------------------
@@ -482,16 +593,296 @@ static int xpfs_dir(lua_State *L)
 #endif
 
 
+//----------------------------------------------------------------
+// walk(root, options)
+//----------------------------------------------------------------
+
+#ifndef _WIN32
+
+#define WALK_MT "xpfs.Walk"
+
+typedef struct {
+   DIR *dir;
+   size_t prefixLen;       // length of "<path>/" in Walk.path
+} WalkDir;
+
+typedef struct {
+   WalkDir *stack;         // directories being read (open descriptors)
+   int depth;              // number of entries in stack
+   int stackSize;
+   int maxDepth;           // do not descend deeper than this
+   unsigned fields;        // stat fields to return (0 => no stat table)
+   char *path;             // current path
+   size_t pathSize;
+} Walk;
+
+
+static void walk_close(Walk *w)
+{
+   while (w->depth > 0) {
+      closedir(w->stack[--w->depth].dir);
+   }
+   free(w->stack);
+   free(w->path);
+   w->stack = NULL;
+   w->path = NULL;
+}
+
+
+static int walk_gc(lua_State *L)
+{
+   walk_close((Walk *) luaL_checkudata(L, 1, WALK_MT));
+   return 0;
+}
+
+
+// Ensure w->path can hold `size` bytes.  Return 0 on failure.
+//
+static int walk_reserve(Walk *w, size_t size)
+{
+   if (size > w->pathSize) {
+      size_t newSize = MAX(size, w->pathSize * 2);
+      char *p = realloc(w->path, newSize);
+      if (p == NULL) {
+         return 0;
+      }
+      w->path = p;
+      w->pathSize = newSize;
+   }
+   return 1;
+}
+
+
+// Push an open directory whose name (plus "/") occupies w->path[0...len-1].
+// Return 0 on failure.
+//
+static int walk_push(Walk *w, DIR *dir, size_t len)
+{
+   if (w->depth >= w->stackSize) {
+      int newSize = MAX(16, w->stackSize * 2);
+      WalkDir *p = realloc(w->stack, sizeof(WalkDir) * (size_t) newSize);
+      if (p == NULL) {
+         return 0;
+      }
+      w->stack = p;
+      w->stackSize = newSize;
+   }
+   w->stack[w->depth].dir = dir;
+   w->stack[w->depth].prefixLen = len;
+   ++w->depth;
+   return 1;
+}
+
+
+// Get kind of directory entry without calling stat, when possible.
+//
+static const char *direntKind(const struct dirent *pde)
+{
+#ifdef DT_UNKNOWN
+   switch (pde->d_type) {
+   case DT_REG:  return "f";
+   case DT_DIR:  return "d";
+   case DT_LNK:  return "l";
+   case DT_BLK:  return "b";
+   case DT_CHR:  return "c";
+   case DT_SOCK: return "s";
+   case DT_FIFO: return "p";
+   default:      break;
+   }
+#else
+   (void) pde;
+#endif
+   return NULL;
+}
+
+
+// Iterator: return path, kind, [stat] for the next entry.
+//
+// upvalue 1 = Walk userdata
+// upvalue 2 = prune function (or nil)
+//
+static int walk_next(lua_State *L)
+{
+   Walk *w = (Walk *) luaL_checkudata(L, lua_upvalueindex(1), WALK_MT);
+   int hasPrune = !lua_isnil(L, lua_upvalueindex(2));
+
+   while (w->depth > 0) {
+      WalkDir *top = &w->stack[w->depth - 1];
+      struct dirent *pde = readdir(top->dir);
+      const char *name;
+      const char *kind;
+      const char *err = NULL;
+      struct stat info;
+      size_t nameLen, len;
+      int dfd;
+
+      if (pde == NULL) {
+         closedir(top->dir);
+         --w->depth;
+         continue;
+      }
+
+      name = pde->d_name;
+      if (name[0] == '.' && (name[1] == '\0' ||
+                             (name[1] == '.' && name[2] == '\0'))) {
+         continue;
+      }
+
+      // path = <prefix> <name>
+      nameLen = strlen(name);
+      len = top->prefixLen + nameLen;
+      if (!walk_reserve(w, len + 2)) {
+         return luaL_error(L, "xpfs.walk: out of memory");
+      }
+      memcpy(w->path + top->prefixLen, name, nameLen + 1);
+
+      dfd = dirfd(top->dir);
+      kind = direntKind(pde);
+      if (kind == NULL || w->fields) {
+         if (fstatat(dfd, name, &info, AT_SYMLINK_NOFOLLOW) != 0) {
+            lua_pushlstring(L, w->path, len);
+            lua_pushnil(L);
+            lua_pushstring(L, strerror(errno));
+            return 3;
+         }
+         kind = kindOf(info.st_mode);
+      }
+
+      lua_pushlstring(L, w->path, len);
+
+      if (kind[0] == 'd' && w->depth < w->maxDepth) {
+         int descend = 1;
+
+         if (hasPrune) {
+            lua_pushvalue(L, lua_upvalueindex(2));
+            lua_pushvalue(L, -2);
+            lua_pushstring(L, kind);
+            lua_call(L, 2, 1);
+            descend = !lua_toboolean(L, -1);
+            lua_pop(L, 1);
+         }
+
+         if (descend) {
+            int fd = openat(dfd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+            DIR *dir = (fd < 0 ? NULL : fdopendir(fd));
+            if (dir == NULL) {
+               err = strerror(errno);
+               if (fd >= 0) {
+                  close(fd);
+               }
+            } else {
+               w->path[len] = '/';
+               if (!walk_push(w, dir, len + 1)) {
+                  closedir(dir);
+                  return luaL_error(L, "xpfs.walk: out of memory");
+               }
+            }
+         }
+      }
+
+      if (err) {
+         lua_pushnil(L);
+         lua_pushstring(L, err);
+         return 3;
+      }
+
+      lua_pushstring(L, kind);
+      if (w->fields) {
+         pushStat(L, &info, w->fields);
+         return 3;
+      }
+      return 2;
+   }
+
+   walk_close(w);
+   return 0;
+}
+
+
+static int xpfs_walk(lua_State *L)
+{
+   size_t rootLen;
+   const char *root = luaL_checklstring(L, 1, &rootLen);
+   Walk *w;
+   DIR *dir;
+
+   lua_settop(L, 2);
+   if (!lua_isnil(L, 2)) {
+      luaL_checktype(L, 2, LUA_TTABLE);
+   }
+
+   w = (Walk *) lua_newuserdata(L, sizeof(Walk));
+   memset(w, 0, sizeof(Walk));
+   w->maxDepth = INT_MAX;
+   luaL_setmetatable(L, WALK_MT);
+
+   if (lua_istable(L, 2)) {
+      lua_getfield(L, 2, "stat");
+      if (!lua_isnil(L, -1)) {
+         w->fields = parseMask(luaL_checkstring(L, -1));
+      }
+      lua_getfield(L, 2, "depth");
+      if (!lua_isnil(L, -1)) {
+         w->maxDepth = (int) luaL_checkinteger(L, -1);
+      }
+      lua_getfield(L, 2, "prune");
+      if (!lua_isnil(L, -1)) {
+         luaL_checktype(L, -1, LUA_TFUNCTION);
+      }
+   } else {
+      lua_pushnil(L);
+   }
+   // stack: root, options, walk, ..., prune
+
+   dir = opendir(root);
+   if (dir == NULL) {
+      lua_pushnil(L);
+      lua_pushstring(L, strerror(errno));
+      return 2;
+   }
+
+   // prefix = root + "/" (unless root already ends in "/")
+   if (!walk_reserve(w, rootLen + 256)) {
+      closedir(dir);
+      return luaL_error(L, "xpfs.walk: out of memory");
+   }
+   memcpy(w->path, root, rootLen);
+   if (rootLen == 0 || root[rootLen - 1] != '/') {
+      w->path[rootLen++] = '/';
+   }
+   if (w->maxDepth > 0) {
+      if (!walk_push(w, dir, rootLen)) {
+         closedir(dir);
+         return luaL_error(L, "xpfs.walk: out of memory");
+      }
+   } else {
+      closedir(dir);
+   }
+
+   lua_pushvalue(L, 3);
+   lua_pushvalue(L, -2);
+   lua_pushcclosure(L, walk_next, 2);
+   return 1;
+}
+
+#endif  /* not WIN32 */
+
+
 static const luaL_Reg xpfs_regs[] = {
    {"chmod", xpfs_chmod},
    {"stat", xpfs_stat},
+   {"statMany", xpfs_statMany},
    {"remove", xpfs_remove},
    {"mkdir", xpfs_mkdir},
    {"chdir", xpfs_chdir},
    {"rmdir", xpfs_rmdir},
    {"getcwd", xpfs_getcwd},
+   {"getpid", xpfs_getpid},
    {"rename", xpfs_rename},
    {"dir", xpfs_dir},
+#ifndef _WIN32
+   {"walk", xpfs_walk},
+#endif
    {0,0}
 };
 
@@ -502,6 +893,13 @@ LUAMOD_API int luaopen_xpfs(lua_State *L)
 {
    const luaL_Reg *preg;
 
+#ifndef _WIN32
+   luaL_newmetatable(L, WALK_MT);
+   lua_pushcfunction(L, walk_gc);
+   lua_setfield(L, -2, "__gc");
+   lua_pop(L, 1);
+#endif
+
    // create table
    lua_createtable(L, 0, ARRAY_LENGTH(xpfs_regs));
 
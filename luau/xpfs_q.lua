@@ -105,6 +105,15 @@ qt.eq( {kind="d"}, (xpfs.stat(newdir, "k")) )
 local cwd = xpfs.getcwd()
 qt.eq("string", type(cwd))
 
+----------------
+-- getpid
+----------------
+
+-- the parent of a shell started by popen is this process
+local p = io.popen("echo $PPID")
+qt.eq(tonumber(p:read("*a")), xpfs.getpid())
+p:close()
+
 ----------------
 -- chdir
 ----------------
@@ -160,3 +169,87 @@ qt.eq(true, rmap[".."])
 qt.eq(true, rmap["."])
 qt.eq(true, rmap["xpfs_q.lua"])
 
+
+
+----------------
+-- statMany
+----------------
+
+local r = xpfs.statMany({statFile, "DOESNOTEXIST", "."}, "ks")
+qt.eq(3, #r)
+qt.eq(xpfs.stat(statFile, "ks"), r[1])
+qt.eq(false, r[2])
+qt.eq("d", r[3].kind)
+
+qt.eq({rAll}, xpfs.statMany({statFile}))
+
+
+----------------
+-- walk
+----------------
+
+if xpfs.walk then
+   -- construct tree:  top/{f1, a/{f2, b/{f3}}, skip/{f4}}
+   local top = tmpdir .. "/walk"
+   local files = { "f1", "a/f2", "a/b/f3", "skip/f4" }
+   for _, d in ipairs{ "", "/a", "/a/b", "/skip" } do
+      xpfs.mkdir(top .. d)
+   end
+   for _, name in ipairs(files) do
+      local f = io.open(top .. "/" .. name, "w")
+      f:write(name)
+      f:close()
+   end
+
+   local function walk(root, opts)
+      local t = {}
+      for path, kind, st in assert(xpfs.walk(root, opts)) do
+         t[path:sub(#top + 2)] = st or kind
+      end
+      return t
+   end
+
+   qt.eq({ f1="f", a="d", ["a/f2"]="f", ["a/b"]="d", ["a/b/f3"]="f",
+           skip="d", ["skip/f4"]="f" },
+         walk(top))
+
+   -- trailing slash
+   qt.eq(walk(top), walk(top .. "/"))
+
+   -- depth
+   qt.eq({ f1="f", a="d", skip="d" }, walk(top, {depth=1}))
+
+   -- prune
+   local pruned = {}
+   local t = walk(top, {prune = function (path, kind)
+                                   qt.eq("d", kind)
+                                   pruned[#pruned+1] = path
+                                   return path:match("skip$")
+                                end})
+   qt.eq(nil, t["skip/f4"])
+   qt.eq("d", t.skip)
+   qt.eq("f", t["a/b/f3"])
+   qt.eq(3, #pruned)
+
+   -- stat
+   local t = walk(top, {stat="ks"})
+   qt.eq({kind="f", size=6}, t["a/b/f3"])
+   qt.eq("d", t.a.kind)
+
+   -- errors
+   local w, err = xpfs.walk(top .. "/DOESNOTEXIST")
+   qt.eq(nil, w)
+   qt.match(err, "No such")
+
+   -- directory contents change during traversal
+   for path, kind in xpfs.walk(top) do
+      if kind == "f" then
+         xpfs.remove(path)
+      end
+   end
+   qt.eq({ a="d", ["a/b"]="d", skip="d" }, walk(top))
+
+   for _, d in ipairs{ "/a/b", "/a", "/skip", "" } do
+      xpfs.rmdir(top .. d)
+   end
+end
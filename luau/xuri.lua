@@ -167,6 +167,30 @@ local function parseParams(str)
 end
 
 
+-- The Lua implementations above are retained for testing.
+local luaImpl = {
+   pctDecode = pctDecode,
+   paramDecode = paramDecode,
+   paramEncode = paramEncode,
+   pathEncode = pathEncode,
+   authorityEncode = authorityEncode,
+   parseParams = parseParams,
+}
+
+-- @require textcodec_c   (bundle the native codecs, when found)
+local succ, textcodec_c = pcall(require, "textcodec_c")
+if succ then
+   pctDecode = textcodec_c.pctDecode
+   paramDecode = textcodec_c.paramDecode
+   paramEncode = textcodec_c.paramEncode
+   pathEncode = textcodec_c.pathEncode
+   authorityEncode = textcodec_c.authorityEncode
+   parseParams = textcodec_c.parseParams
+   pathDecode = pctDecode
+   authorityDecode = pctDecode
+end
+
+
 -- Construct URI query string from table.  This is the inverse of
 -- parseParams.  In the generated string, fields are ordered
 -- deterministically, so equivalent tables will generate identical results.
@@ -368,5 +392,7 @@ return {
    cleanPath = cleanPath,
    byteToHex = byteToHex,
    pctDecode = pctDecode,
-   paramDecode = paramDecode
+   paramDecode = paramDecode,
+   isNative = succ,
+   _lua = luaImpl,  -- for testing
 }
@@ -0,0 +1,1391 @@
+for k, v in pairs{
+agentlib=function()
+
+
+local mdbFD=tonumber(os.getenv("mdbFD"))
+
+
+
+
+
+
+
+
+
+
+
+
+local collectgarbage,error,ipairs,load,next,pairs,pcall,print,rawget,
+rawset,select,setmetatable,tonumber,tostring,type,xpcall,_G=
+collectgarbage,error,ipairs,load,next,pairs,pcall,print,rawget,
+rawset,select,setmetatable,tonumber,tostring,type,xpcall,_G
+
+local getmetatable=getmetatable
+
+local function clone(t)
+local new={}
+for k,v in pairs(t)do
+new[k]=v
+end
+return new
+end
+
+local coroutine,debug,io,math,os,string,table=
+clone(coroutine),clone(debug),clone(io),clone(math),clone(os),
+clone(string),clone(table)
+
+
+local insert,pack,unpack,getinfo=
+table.insert,table.pack,table.unpack,debug.getinfo
+
+local gsub,format,match=string.gsub,string.format,string.match
+
+
+
+
+
+
+local oldLoaded=clone(_G.package.loaded)
+
+
+
+
+local function reset()
+
+for k in pairs(package.loaded)do
+_G.package.loaded[k]=oldLoaded[k]
+end
+end
+
+
+local xpio=require"xpio_c"
+local Object=require"object"
+local mdbser=require"mdbser"
+local ValueMap=require"valuemap"
+local farf=require"farf"
+
+
+
+
+
+
+local function xformat(formatFuncs,fmt,...)
+local o={}
+local pos=1
+local argn=1
+
+while pos<=#fmt do
+local esc="%s"
+local value,p1=match(fmt,"^([^%%]+)()",pos)
+
+if not value then
+esc,p1=match(fmt,"^(%%[^%a%%]*.?)()",pos)
+if esc=="%%"then
+value="%"
+esc="%s"
+else
+value=select(argn,...)
+argn=argn+1
+end
+end
+
+local fn=formatFuncs[esc:sub(-1)]or formatFuncs.default
+o[#o+1]=fn(esc,value)
+pos=p1
+end
+
+return o
+end
+
+
+
+
+
+
+local function fatal(str,level)
+io.stderr:write("ERROR: "..debug.traceback(str,(level or 1)+1))
+io.flush(io.stderr)
+os.exit(1)
+end
+
+local function assert(...)
+local succ,err=...
+if not succ then
+fatal(err,2)
+end
+return...
+end
+
+
+
+local function gerr(t,k)
+fatal("access to global: "..k,2)
+end
+local _ENV=setmetatable({},{__index=gerr,__newindex=gerr})
+
+
+
+
+
+
+local gettime=xpio.gettime
+
+local weakKeyMT={__mode='k'}
+local function newWeakKeys()
+return setmetatable({},weakKeyMT)
+end
+
+
+
+
+
+
+
+local MAXBATCH=65536
+
+local sock,send,recv,peek,batch
+do
+sock=assert(xpio.fdopen(mdbFD))
+local recvBuf=""
+local recvPos=1
+local sendQ,sendSize={},0
+local batching=false
+
+sock:setsockopt("O_NONBLOCK",true)
+
+local function blockOn(method,...)
+sock:setsockopt("O_NONBLOCK",false)
+local a,b=sock[method](sock,...)
+sock:setsockopt("O_NONBLOCK",true)
+return a,b
+end
+
+local function append(data)
+recvBuf=string.sub(recvBuf,recvPos)..data
+recvPos=1
+end
+
+local function flush()
+if sendQ[1]then
+sendQ[#sendQ+1]=""
+blockOn("try_write",table.concat(sendQ,"\n"))
+sendQ,sendSize={},0
+end
+end
+
+function peek()
+local data,err=sock:try_read(4096)
+if data then
+append(data)
+return true
+end
+end
+
+
+function recv(blocking)
+flush()
+while true do
+local a,b=string.find(recvBuf,"\n",recvPos,true)
+if a then
+local line=string.sub(recvBuf,recvPos,a-1)
+recvPos=b+1
+farf("p","C: %s",line)
+return match(line,"^([^ ]*) ?(.*)")
+end
+
+if peek()then
+
+elseif blocking then
+local data,er=blockOn("try_read",4096)
+if not data then
+io.stderr:write("mdb: control port closed; exiting\n")
+os.exit(1)
+end
+append(data)
+else
+return
+end
+end
+end
+
+function send(mtyp,...)
+local msg=mtyp.." "..mdbser.encode(...)
+farf("p","S: %s",msg)
+sendQ[#sendQ+1]=msg
+sendSize=sendSize+#msg
+if not batching or sendSize>=MAXBATCH then
+flush()
+end
+end
+
+
+function batch(fn,...)
+batching=true
+fn(...)
+batching=false
+flush()
+end
+
+end
+
+
+
+
+
+
+local MAXSTRINGLEN=1000
+
+local valueMap=ValueMap:new(100)
+
+local function describeValue(v)
+local tv=type(v)
+if tv=="string"then
+local s=v:sub(1,MAXSTRINGLEN)
+s=gsub(format("%q",s),"\n","n")
+if#v>MAXSTRINGLEN then
+s=s.."... "..valueMap:toID(v)
+end
+return s
+elseif tv=="boolean"or
+tv=="nil"or
+tv=="number"then
+return tostring(v)
+else
+return tv.." "..valueMap:toID(v)
+end
+end
+
+
+local valueFormatFuncs={
+default=function(_,v)return gsub(v,"!","!0")end,
+Q=function(_,v)return"!2"..gsub(describeValue(v),"!","!0").."!1"end
+}
+
+local function valueFormat(fmt,...)
+return table.concat(xformat(valueFormatFuncs,fmt,...))
+end
+
+
+local function valueFromDesc(desc)
+return valueMap:fromID(match(tostring(desc),'(%d+)'))
+end
+
+
+
+
+
+
+
+
+
+
+
+
+local prevDepth=0
+local function getDepth(level)
+local d=prevDepth
+local minTop,maxTop
+repeat
+if getinfo(d,'l')then
+minTop=d
+d=d+1
+else
+d=d-1
+maxTop=d
+end
+until minTop==maxTop
+prevDepth=minTop
+return minTop-level
+end
+
+
+
+
+
+
+local LocalVar=Object:new()
+
+function LocalVar:initialize(depth,index,name)
+self.depth=depth
+self.index=index
+self.name=name
+end
+
+function LocalVar:get()
+local level=getDepth(self.depth)
+local name,value=debug.getlocal(level,self.index)
+return value
+end
+
+
+function LocalVar:set(v)
+local level=getDepth(self.depth)
+return debug.setlocal(level,self.index,v)
+end
+
+
+
+
+
+
+local Upvalue=Object:new()
+
+function Upvalue:initialize(func,index,name)
+self.func=func
+self.index=index
+self.name=name
+end
+
+
+function Upvalue:get()
+local name,value=debug.getupvalue(self.func,self.index)
+return value
+end
+
+
+function Upvalue:set(v)
+return debug.setupvalue(self.func,self.index,v)
+end
+
+
+
+
+
+
+
+
+
+local function scanVars(depth)
+local level=getDepth(depth)
+local vars={}
+
+if depth<0 then
+return
+end
+
+for n=1,math.huge do
+local name,value=debug.getlocal(level,n)
+if not name then break end
+if not match(name,"%(")then
+insert(vars,LocalVar:new(depth,n,name))
+end
+end
+
+local func=getinfo(level,"f").func
+for n=1,math.huge do
+local name,value=debug.getupvalue(func,n)
+if not name then break end
+insert(vars,Upvalue:new(func,n,name))
+end
+
+return vars
+end
+
+
+
+
+local function getVarValues(depth)
+local vars=scanVars(depth)
+if not vars then
+return
+end
+
+local t={}
+for _,var in ipairs(vars)do
+t[#t+1]={name=var.name,value=describeValue(var:get())}
+end
+return t
+end
+
+
+
+
+local function getVarMap(depth)
+local vars=scanVars(depth)
+if not vars then
+return
+end
+
+local byName={}
+
+for n=#vars,1,-1 do
+local v=vars[n]
+byName[v.name]=v
+end
+return byName
+end
+
+
+
+
+
+
+
+local hookMode="run"
+
+
+local hookBreak=true
+
+
+local hookRunLimit=0
+
+
+local hookBP={}
+
+
+local hookDepth
+
+
+local subs={}
+
+local didEval
+
+
+local peekInterval=0.05
+local peekNext=0
+
+
+
+
+
+
+local hookInvisible=newWeakKeys()
+
+local function makeInvisible(...)
+for _,fn in ipairs{...}do
+hookInvisible[fn]=true
+end
+end
+
+
+
+
+
+local aliases={}
+
+local function alias(func,name)
+aliases[func]=name
+end
+
+
+local function getStack()
+local level=getDepth(hookDepth)
+local stack={}
+local frame
+for n=level,2000 do
+local i=getinfo(n,"nlSf")
+if not i then break end
+if aliases[i.func]then
+frame={
+name=aliases[i.func],
+what="D"
+}
+else
+frame={
+line=i.currentline,
+name=i.name,
+file=match(i.source,"^@(.*)"),
+what=i.what
+}
+end
+insert(stack,frame)
+end
+return stack
+end
+
+
+local function getVars(level)
+level=tonumber(level)or 1
+return getVarValues(hookDepth-level+1)
+end
+
+
+
+
+local function cmpPairs(a,b)
+local x,y=a[1],b[1]
+if match(x,'^[%d%-]')and match(y,'^[%d%-]')then
+return tonumber(x)<tonumber(y)
+else
+return x<y
+end
+end
+
+
+local function getPairs(desc)
+local tbl=valueFromDesc(desc)
+if type(tbl)=="table"then
+local p={}
+for k,v in pairs(tbl)do
+insert(p,{describeValue(k),describeValue(v)})
+end
+table.sort(p,cmpPairs)
+return p
+else
+return{error="stale"}
+end
+end
+
+
+local updateFuncs={
+stack=getStack,
+pairs=getPairs,
+vars=getVars
+}
+
+
+function updateFuncs.unknown()
+return{error="unk"}
+end
+
+
+
+
+local sentValues={}
+local sentMode=nil
+
+local function updateValues()
+if hookMode=="pause"then
+local didRun=hookMode=="pause"and sentMode~="pause"
+
+local invalid={
+stack=didRun,
+pairs=didRun or didEval,
+vars=didRun or didEval
+}
+didEval=false
+
+for name in pairs(subs)do
+local funcName,arg=match(name,"([^/]*)/?(.*)")
+if invalid[funcName]or not sentValues[name]then
+local func=updateFuncs[funcName]or updateFuncs.unknown
+local value=func(arg)
+sentValues[name]=true
+send("set",name,value)
+end
+end
+end
+
+if sentMode~=hookMode then
+send(hookMode)
+sentMode=hookMode
+end
+end
+
+
+local commands={}
+
+
+function commands.bp(bp)
+local lineMap={}
+
+for file,lines in pairs(bp)do
+
+local source=gsub(file,"^[^=]","@%1")
+
+for _,line in ipairs(lines)do
+local sourceMap=lineMap[line]
+if not sourceMap then
+sourceMap={}
+lineMap[line]=sourceMap
+end
+
+sourceMap[source]=true
+end
+end
+
+hookBP=lineMap
+end
+
+
+
+
+local mtEvalEnv={}
+
+function mtEvalEnv.__index(env,name)
+local varsByName=rawget(env,1)
+local var=varsByName[name]
+if var then
+return var:get()
+end
+local globals=varsByName._ENV and varsByName._ENV:get()or _G
+return rawget(globals,name)
+end
+
+function mtEvalEnv.__newindex(env,name,value)
+local varsByName=rawget(env,1)
+local var=varsByName[name]
+if var then
+return var:set(value)
+end
+local globals=varsByName._ENV and varsByName._ENV:get()or _G
+return rawset(globals,name,value)
+end
+
+
+
+
+
+
+
+
+
+
+function commands.eval(cmd)
+local varMap=getVarMap(hookDepth)
+
+
+local env=setmetatable({varMap},mtEvalEnv)
+
+local r
+
+send("log","C"..cmd)
+
+
+local r={load("return "..cmd,"=console",nil,env)}
+
+if not r[1]then
+
+local errFirst=tostring(r[2])
+r={load(cmd,"=console",nil,env)}
+
+
+if not r[1]and(match(errFirst,"<eof>$")
+or not match(tostring(r[2]),"<eof>$"))then
+r[2]=errFirst
+end
+end
+
+if r[1]then
+didEval=true
+r=pack(pcall(r[1]))
+end
+
+
+
+
+if r[1]then
+for n=2,r.n do
+send("log","R"..describeValue(r[n]))
+end
+else
+send("log","E"..tostring(r[2]))
+end
+end
+
+
+function commands.sub(name)
+subs[name]=true
+end
+
+
+function commands.unsub(name)
+subs[name]=nil
+sentValues[name]=nil
+end
+
+
+function commands.pause()
+hookMode="pause"
+end
+
+
+
+function commands.run(limit)
+if hookMode~="pause"then
+
+
+send("log","Wrun() message dropped.")
+end
+
+hookMode="run"
+hookRunLimit=limit or""
+end
+
+
+
+
+
+local function hookIdle()
+updateValues()
+
+while true do
+local id,body=recv(hookMode=="pause")
+if not id then
+return
+end
+
+local fn=commands[id]
+if fn then
+fn(mdbser.decode(body))
+else
+send("log","Emdb: unknown command: "..tostring(fn))
+end
+updateValues()
+send("ack")
+end
+end
+
+local threadToEnter=newWeakKeys()
+
+
+local nextID=1
+
+local function installHook(thread)
+local isMain
+if not thread then
+isMain=true
+thread=coroutine.running()
+end
+
+local threadID=nextID
+nextID=nextID+1
+
+
+local depth=0
+
+
+local breakDepth=0
+
+
+local threadAbove=nil
+
+
+
+
+
+local function enter()
+threadAbove=coroutine.running()
+end
+
+makeInvisible(enter)
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+local function hook(reason,lnum)
+
+
+if reason=="line"then
+if hookBreak then
+
+if hookBreak==true then
+for d=1,depth do
+local func=getinfo(1+d,"f").func
+if func and hookInvisible[func]then
+return
+end
+end
+end
+elseif depth>breakDepth then
+if not(hookBP[lnum]and hookBP[lnum][getinfo(2,"S").source])then
+if gettime()<peekNext then
+return
+end
+peekNext=gettime()+peekInterval
+if not peek()then return end
+goto notPaused
+end
+end
+hookMode="pause"
+::notPaused::
+else
+
+if reason=="call"then
+depth=depth+1
+elseif reason=="return"then
+
+depth=getDepth(2)-1
+if depth<=0 and not threadAbove then
+send("exit")
+debug.sethook()
+end
+end
+return
+end
+
+
+if depth~=getDepth(2)then
+print("DEPTH",depth,getDepth(2),reason,lnum)
+end
+assert(depth==getDepth(2))
+hookDepth=depth-(tonumber(hookBreak)or 0)
+
+hookRunLimit=nil
+
+xpcall(batch,function(msg)
+print(debug.traceback(msg.." [MDB internal]"))
+os.exit(1)
+end,hookIdle)
+
+if hookRunLimit then
+
+hookBreak=hookRunLimit=="in"
+breakDepth=0
+if hookRunLimit=="over"then
+breakDepth=hookDepth
+elseif hookRunLimit=="out"then
+breakDepth=hookDepth-1
+end
+end
+end
+
+if isMain then
+
+local function mainInitHook(reason)
+farf("h","mainInitHook %s @ %s",reason,getDepth(2))
+
+
+depth=getDepth(2)-(reason=="call"and 0 or 1)
+debug.sethook(hook,"clr")
+end
+
+
+debug.sethook(mainInitHook,"c")
+else
+threadToEnter[thread]=enter
+debug.sethook(thread,hook,"clr")
+end
+end
+
+
+
+
+
+
+
+
+
+
+local function agentMain(fn,...)
+return agentMain(coroutine.yield(fn(...)))
+end
+
+local agentCoro=coroutine.create(agentMain)
+
+local function agentCall(...)
+return assert(coroutine.resume(agentCoro,...))
+end
+
+
+
+
+local function debugLog(...)
+for n=1,select('#',...)do
+agentCall(send,"log","V"..describeValue(select(n,...)))
+end
+end
+
+
+local function debugPrintf(...)
+return agentCall(send,"log","P"..valueFormat(...))
+end
+
+
+local function debugPause(level)
+hookBreak=tonumber(level)or 1
+end
+
+
+makeInvisible(debugPrintf,
+debugLog,
+debugPause,
+agentCall,
+assert)
+
+
+_G.debug.pause=debugPause
+_G.debug.log=debugLog
+_G.debug.printf=debugPrintf
+
+
+
+
+local function debugExit(code)
+debugPause(2)
+return os.exit(code)
+end
+
+_G.os.exit=debugExit
+
+alias(debugExit,"EXITED")
+
+
+
+
+
+
+
+local function mainHandler(err)
+debugPause()
+return debug.traceback(err)
+end
+
+alias(mainHandler,"UNCAUGHT ERROR")
+
+
+
+
+local function pcallHandler(err)
+debugPause()
+return err
+end
+
+alias(pcallHandler,"CAUGHT ERROR")
+
+
+local function h_xpcall(func,msgh,...)
+local function xpcallHandler(err)
+debugPause()
+return msgh(err)
+end
+
+return xpcall(func,xpcallHandler,...)
+end
+
+
+local function h_pcall(func,...)
+return xpcall(func,pcallHandler,...)
+end
+
+
+_G.xpcall=h_xpcall
+_G.pcall=h_pcall
+
+
+
+
+
+local function rethrow(succ,...)
+if succ then return...end
+return error(...,0)
+end
+
+
+local function ico_create(f)
+local function catchError(...)
+return rethrow(xpcall(f,pcallHandler,...))
+end
+local thread=coroutine.create(catchError)
+installHook(thread)
+return thread
+end
+
+
+local function ico_resume(thread,...)
+threadToEnter[thread]()
+return coroutine.resume(thread,...)
+end
+
+
+
+
+
+local function ico_wrap(f)
+local thread=ico_create(f)
+return function(...)
+return rethrow(ico_resume(thread,...))
+end
+end
+
+
+makeInvisible(ico_wrap,ico_resume,ico_create)
+
+_G.coroutine.create=ico_create
+_G.coroutine.wrap=ico_wrap
+_G.coroutine.resume=ico_resume
+
+
+
+
+local function hookXPIO()
+
+
+local xpio=_G.require"xpio_c"
+
+local mtQ=getmetatable(xpio.tqueue())
+local _wait=mtQ.wait
+
+function mtQ:wait(t)
+if not t and self:isEmpty()then
+return nil
+end
+local tStop=xpio.gettime()+(t or math.huge)
+local results={}
+local dbtask={_queue=self}
+
+repeat
+sock:when_read(dbtask)
+local timeout=tStop-xpio.gettime()
+
+local a=_wait(self,timeout)
+
+if dbtask._dequeue then
+dbtask:_dequeue()
+end
+for n,task in ipairs(a)do
+if task~=dbtask then
+results[#results+1]=task
+end
+end
+until#results>0 or timeout<0
+
+return results
+end
+
+alias(mtQ.wait,"WAITING")
+end
+
+
+
+
+
+
+
+local function start()
+reset()
+hookXPIO()
+return installHook()
+end
+
+
+return{
+start=start,
+mainHandler=mainHandler,
+
+
+xformat=xformat,
+pcallHandler=pcallHandler
+}
+
+end,
+object=function()
+
+
+local Object={}
+
+
+
+
+function Object:adopt(o)
+rawset(self,"__index",self)
+setmetatable(o,self)
+return o
+end
+
+function Object:getParent()
+local p=getmetatable(self).__index
+return type(p)=="table"and p or nil
+end
+
+
+function Object:basicNew()
+return self:adopt{}
+end
+
+
+function Object:new(...)
+local o=self:basicNew()
+o:initialize(...)
+return o
+end
+
+function Object:initialize()
+
+end
+
+return Object
+
+end,
+mdbser=function()
+
+
+
+
+
+
+
+
+
+
+
+local rtrequire=require
+local succ,mdbser_c=pcall(rtrequire,"mdbser_c")
+if not succ then
+mdbser_c=nil
+end
+
+local byte,char=string.byte,string.char
+local insert,concat=table.insert,table.concat
+
+local ESC=char(128)
+
+
+local function escape(c)
+return ESC..char(64+byte(c))
+end
+
+local function unescape(cc)
+return char(byte(cc,2)-64)
+end
+
+local function shift(c)
+return char(byte(c)+1)
+end
+
+local function unshift(c)
+return char(byte(c)-1)
+end
+
+
+
+
+local function demote(str)
+return(str:gsub('[ \r\n\128\191]',escape):gsub('[\128-\190]',shift))
+end
+
+
+
+
+local function promote(str)
+return(str:gsub('[\129-\191]',unshift):gsub('\128.',unescape))
+end
+
+
+
+
+local function encodeValue(value)
+local typ=type(value)
+
+if typ=="string"then
+return's'..demote(value)
+elseif typ=="boolean"then
+return value and't'or'f'
+elseif typ=="number"then
+return'n'..tostring(value)
+elseif typ=="table"then
+local o={'m'}
+for k,v in pairs(value)do
+insert(o,encodeValue(k))
+insert(o,encodeValue(v))
+end
+return demote(concat(o,' '))
+else
+return'x'
+end
+end
+
+
+
+
+local function decodeValue(str)
+local ty=str:sub(1,1)
+
+if ty=='s'then
+return promote(str:sub(2))
+elseif ty=='n'then
+return tonumber(str:sub(2))
+elseif str=='t'then
+return true
+elseif str=='f'then
+return false
+elseif ty=='m'then
+local t={}
+for ekey,eval in promote(str):gmatch(" ([^ ]*) ([^ ]*)")do
+t[decodeValue(ekey)]=decodeValue(eval)
+end
+return t
+end
+
+return nil
+end
+
+
+
+
+local function encode(...)
+local o={}
+for n=1,select('#',...)do
+o[#o+1]=encodeValue(select(n,...))
+end
+return table.concat(o," ")
+end
+
+
+
+
+local function decode(str,pos)
+local word,pnext=str:match('([^ ]+)()',pos or 1)
+if word then
+return decodeValue(word),decode(str,pnext)
+end
+end
+
+
+return{
+encode=mdbser_c and mdbser_c.encode or encode,
+decode=mdbser_c and mdbser_c.decode or decode,
+isNative=mdbser_c and true or false,
+
+_luaEncode=encode,
+_luaDecode=decode,
+}
+
+end,
+valuemap=function()
+
+
+
+
+
+
+
+
+
+local Object=require"object"
+
+local ValueMap=Object:new()
+
+
+function ValueMap:initialize(retainCount)
+self.prevID=0
+self.map=setmetatable({},{__mode="v"})
+self.xmap=setmetatable({},{__mode="k"})
+
+if retainCount then
+self.retainCount=retainCount
+self.retained={}
+end
+end
+
+
+function ValueMap:toID(value)
+local n=self.xmap[value]
+if n then
+return tostring(n)
+end
+
+if value==nil then
+return"0"
+end
+
+
+n=self.prevID+1
+self.prevID=n
+
+
+self.map[n]=value
+self.xmap[value]=n
+
+
+if self.retainCount then
+self.retained[n]=value
+local oldID=n-self.retainCount
+local old=self.retained[oldID]
+self.retained[oldID]=nil
+if type(old)=="string"then
+self.xmap[old]=nil
+self.map[oldID]=nil
+end
+end
+
+return tostring(n)
+end
+
+
+function ValueMap:fromID(id)
+local n=tonumber(id)
+return n and self.map[n]
+end
+
+
+return ValueMap
+
+end,
+farf=function()
+
+local dbgFlags=os.getenv("FARF")or""
+
+local function farf(pattern,fmt,...)
+if dbgFlags:match(pattern)then
+if fmt then
+io.stderr:write(string.format(fmt.."\n",...))
+end
+return true
+end
+end
+
+local function nada()
+end
+
+return dbgFlags==""and nada or farf
+
+end} do package.preload[k] = v end
+
+----
+
+
+
+
+
+
+
+
+
+
+local isDebugging=tonumber(os.getenv("mdbFD"))
+
+if arg then
+
+local main
+local err="no source file provided"
+
+if arg[1]then
+main,err=loadfile(arg[1])
+end
+if err then
+print("mdbagent: "..err)
+return 1
+end
+
+
+for ndx=0,#arg do
+arg[ndx]=arg[ndx+1]
+end
+
+if not isDebugging then
+return main(...)
+end
+
+
+local exit,xpcall=os.exit,xpcall
+
+local agent=require"agentlib"
+agent.start()
+
+local ok,err=xpcall(main,agent.mainHandler,...)
+if not ok then
+io.stderr:write("lua: "..tostring(err).."\n")
+exit(1)
+end
+return ok
+
+else
+
+
+if isDebugging then
+require("agentlib").start()
+end
+end
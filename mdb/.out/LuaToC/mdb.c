@@ -0,0 +1,8939 @@
+// Generated by cfromlua
+// lib: ../monoglot/.out/exports/xpio_c.lib
+// lib: ../luau/.out/exports/xpfs.lib
+// lib: ../luau/.out/exports/textcodec_c.lib
+// lib: ../luau/.out/exports/deflate_c.lib
+// lib: ../lpeg/.out/exports/lpeg.lib
+// lib: ../luau/.out/exports/mdbser_c.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "local HTTPD=require\"httpd\"\n"
+  "local Dino=require\"dino\"\n"
+  "local thread=require\"thread\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local trapFilter=require\"trapfilter\"\n"
+  "local logFilter=require\"logfilter\"\n"
+  "local Target=require\"target\"\n"
+  "local getopts=require\"getopts\"\n"
+  "local json=require\"json\"\n"
+  "local O=require\"observable\"\n"
+  "local requirefile=require\"requirefile\"\n"
+  "local memoize=require\"memoize\"\n"
+  "local farf=require\"farf\"\n"
+  "local owebserve=require\"owebserve\"\n"
+  "local logsocket=require\"logsocket\"\n"
+  "local After=require\"after\"\n"
+  "\n"
+  "local E=doctree.E\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local BUSY_LAG=0.5\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readFile(name)\n"
+  "local f=io.open(name,\"r\")\n"
+  "if f then\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local extToType={\n"
+  "css=\"text/css\",\n"
+  "html=\"text/html\",\n"
+  "js=\"application/javascript\",\n"
+  "lua=\"text/lua\"\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function fileResponse(name,data)\n"
+  "if not data then\n"
+  "return 404,{contentType=\"text/plain\"},\"File not found: \"..name\n"
+  "end\n"
+  "\n"
+  "local hdrs={}\n"
+  "\n"
+  "if name:match(\"%.gz$\")then\n"
+  "name=name:sub(1,#name-3)\n"
+  "hdrs.contentEncoding=\"gzip\"\n"
+  "end\n"
+  "\n"
+  "local ext=name:match(\"[^.]*$\")\n"
+  "hdrs.contentType=extToType[ext]or\"application/octet-stream\"\n"
+  "return 200,hdrs,data\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function readAll(s)\n"
+  "local o={}\n"
+  "while true do\n"
+  "local data=s:read(15000)\n"
+  "if not data then break end\n"
+  "o[#o+1]=data\n"
+  "end\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local target\n"
+  "local oBreak=O.Slot:new({})\n"
+  "\n"
+  "local function createObservable(name)\n"
+  "local function jsonize(value)\n"
+  "if type(value)=='table'then\n"
+  "value=json.makeArray(value)\n"
+  "end\n"
+  "return value\n"
+  "end\n"
+  "return O.Func:new(jsonize,target:observe(name))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local observables=memoize.newTable(createObservable)\n"
+  "observables.breakpoints=oBreak\n"
+  "\n"
+  "\n"
+  "local function createTarget(command)\n"
+  "target=Target:new(command,oBreak)\n"
+  "observables.console=target.log\n"
+  "\n"
+  "\n"
+  "local debounceBusy=After:new(target.busy,BUSY_LAG)\n"
+  "\n"
+  "local function calcMode(status,isBusy)\n"
+  "return(isBusy and status~=\"exit\")and\"busy\"or status\n"
+  "end\n"
+  "\n"
+  "observables.mode=O.Func:new(calcMode,target.status,debounceBusy)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local dino=Dino:new()\n"
+  "local GET,PUT,POLL,POST=\n"
+  "dino.method.GET,dino.method.PUT,dino.method.POLL,dino.method.POST\n"
+  "\n"
+  "\n"
+  "POLL['/observe']=owebserve.serve(observables)\n"
+  "\n"
+  "\n"
+  "GET['/']=function()\n"
+  "return fileResponse(\"mdbapp.html.gz\",requirefile(\"mdb/mdbapp.html.gz\"))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "PUT['/breakpoints']=function(req)\n"
+  "local body=readAll(req.body)\n"
+  "oBreak:set(json.decode(body))\n"
+  "return 204\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET[\"/source\"]=function(req)\n"
+  "if not(req.params and req.params.name)then\n"
+  "return 404\n"
+  "end\n"
+  "local file=req.params.name:gsub(\"%%2[eE]\",\"%.\")\n"
+  "return fileResponse(file,readFile(file))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET['/run/{inOutOver}']=function(req,m)\n"
+  "target:run(m.inOutOver)\n"
+  "return 204\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET['/pause']=function()\n"
+  "target:pause()\n"
+  "return 204\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET[\"/restart\"]=function()\n"
+  "target:restart()\n"
+  "return 204\n"
+  "end\n"
+  "\n"
+  "\n"
+  "POST['/console']=function(req)\n"
+  "local data=readAll(req.body)\n"
+  "target:eval(data)\n"
+  "return 204\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET['^/serve/(.+)']=function(req,name)\n"
+  "return fileResponse(name,readFile(name))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "dino.when[true]=function(request)\n"
+  "return 404,{\n"
+  "E.head{\n"
+  "E.title{\"Resource not found\"},\n"
+  "},\n"
+  "E.h1{\"Resource not found\"},\n"
+  "E.pre{request.path}\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function openBrowser(url)\n"
+  "local f=io.popen(\"which xdg-open open\",\"r\")\n"
+  "local o=f:read(\"*a\")or\"\"\n"
+  "f:close()\n"
+  "local cmd=o:match(\"[^\\n]+\")or\"start\"\n"
+  "os.execute(cmd..\" \"..url)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function main()\n"
+  "local words,opts=getopts.read(arg,\"--ui --port= --uri=\")\n"
+  "\n"
+  "\n"
+  "\n"
+  "if not words[1]then\n"
+  "io.write(\"mdb: no debug command given\\n\")\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "createTarget(words)\n"
+  "io.write(\"mdb: command = \"..table.concat(words,\" \")..\"\\n\")\n"
+  "\n"
+  "\n"
+  "\n"
+  "local port=opts.port or os.getenv(\"port\")or\":9779\"\n"
+  "if not port:find(\":\")then\n"
+  "port=\":\"..port\n"
+  "end\n"
+  "port=port:gsub(\"^:\",\"127.0.0.1:\")\n"
+  "local server=HTTPD:new(port)\n"
+  "if farf(\"s\")then\n"
+  "server.sock=logsocket.wrap(server.sock,print)\n"
+  "end\n"
+  "local handler=farf(\"w\")and logFilter.wrap(dino)or dino\n"
+  "server:start(handler)\n"
+  "io.write(\"mdb: listening on \"..port..\" ...\\n\")\n"
+  "\n"
+  "\n"
+  "\n"
+  "if opts.ui then\n"
+  "openBrowser(\"http://\"..port..\"/\"..(opts.uri or\"\"))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "thread.dispatch(main)\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local xpio=require\"xpio\"\n"
+  "local xuri=require\"xuri\"\n"
+  "local thread=require\"thread\"\n"
+  "local SubStream=require\"substream\"\n"
+  "local ChunkedStream=require\"chunkedstream\"\n"
+  "local deflate_c=require\"deflate_c\"\n"
+  "local lpeg=require\"lpeg\"\n"
+  "\n"
+  "local pairs,ipairs,rawset,tonumber,tostring,assert,type=\n"
+  "pairs,ipairs,rawset,tonumber,tostring,assert,type\n"
+  "\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "\n"
+  "local bLog=os.getenv(\"httpd_log\")==\"1\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriSplit(uri)\n"
+  "local prefix\n"
+  "if not uri then\n"
+  "return\n"
+  "elseif not uri:match(\"^/\")then\n"
+  "prefix,uri=uri:match(\"([^/:]+://[^/]*)(/\?.*)\")\n"
+  "if uri==\"\"then\n"
+  "uri=\"/\"\n"
+  "elseif not uri then\n"
+  "return\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return prefix,uri:match(\"([^%\?]*)(.*)\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local charEscape={}\n"
+  "charEscape[\"\\n\"]=\"\\\\n\\n\"\n"
+  "charEscape[\"\\r\"]=\"\\\\r\"\n"
+  "charEscape[\"\\\\\"]=\"\\\\\\\\\"\n"
+  "setmetatable(charEscape,{__index=function(t,ch)return(\"\\\\%03d\"):format(ch:byte())end})\n"
+  "\n"
+  "\n"
+  "local function log(who,data)\n"
+  "if bLog then\n"
+  "local enc=data:gsub(\"[%z\\1-\\31\\128-\\255\\\\]\",charEscape)\n"
+  "print(who..\": \"..enc:gsub(\"\\n(.)\",\"\\n : %1\"))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function flatten(v)\n"
+  "if v==nil then\n"
+  "return\"\"\n"
+  "end\n"
+  "local t={}\n"
+  "local n=0\n"
+  "local err\n"
+  "\n"
+  "local function f(v)\n"
+  "if type(v)==\"string\"then\n"
+  "n=n+1\n"
+  "t[n]=v\n"
+  "elseif type(v)==\"table\"then\n"
+  "for _,e in ipairs(v)do\n"
+  "f(e)\n"
+  "end\n"
+  "else\n"
+  "err=\"Invalid value in response.body: type = \"..type(v)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "f(v)\n"
+  "return concat(t),err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function clone(old)\n"
+  "local new={}\n"
+  "for k,v in pairs(old)do\n"
+  "new[k]=v\n"
+  "end\n"
+  "return new\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function acceptQ(accept,coding)\n"
+  "local q,qStar\n"
+  "for item in accept:gmatch(\"[^,]+\")do\n"
+  "local name,params=item:match(\"^%s*([^;%s]+)%s*(.*)\")\n"
+  "if name then\n"
+  "local qv=tonumber(params:match(\"[qQ]%s*=%s*([%d.]+)\")or 1)or 0\n"
+  "name=name:lower()\n"
+  "if name==coding then\n"
+  "q=qv\n"
+  "elseif name==\"*\"then\n"
+  "qStar=qv\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return q or qStar or 0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local patToken=\"[^\\0-\\32\\127()<>@,;:\\\\\\\"/[%]%\?={}]+\"\n"
+  "\n"
+  "\n"
+  "local function parseList(str)\n"
+  "local t={}\n"
+  "for tok in(str or\"\"):gmatch(patToken)do\n"
+  "t[#t+1]=tok\n"
+  "t[tok]=#t\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function chunkEncode(str)\n"
+  "return string.format(\"%X\",#str)..\"\\r\\n\"..str..\"\\r\\n\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local parseTE\n"
+  "do\n"
+  "local P,R,S,C,Cs,Ct=lpeg.P,lpeg.R,lpeg.S,lpeg.C,lpeg.Cs,lpeg.Ct\n"
+  "\n"
+  "local lws=R'\\1\\32'^0\n"
+  "local function T(pat)\n"
+  "return pat*lws\n"
+  "end\n"
+  "\n"
+  "local function makeTE(name,tbl)\n"
+  "tbl.name=name\n"
+  "return tbl\n"
+  "end\n"
+  "\n"
+  "local TOK=C((R'!~'-S',;=\"')^1)*lws\n"
+  "local QSTR=P'\"'*Cs(((1-S'\"\\\\')+(P'\\\\'/''*1))^0)*P'\"'*lws\n"
+  "local PARAM=TOK*T'='*(TOK+QSTR)/function(a,b)return a..\"=\"..b end\n"
+  "local TE=TOK*Ct((T';'*PARAM)^0)/makeTE\n"
+  "local TC=lws*Ct(TE*(T','*TE)^0+P(true))\n"
+  "\n"
+  "function parseTE(str)\n"
+  "return TC:match(str)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local cacheLimit=10000\n"
+  "local keyLimit=40\n"
+  "\n"
+  "local function cacheTable(f)\n"
+  "local room=cacheLimit\n"
+  "local function index(t,k)\n"
+  "local v=f(k)\n"
+  "\n"
+  "if#k<=keyLimit then\n"
+  "room=room-#k\n"
+  "if room<0 then\n"
+  "\n"
+  "for k,v in pairs(t)do\n"
+  "rawset(t,k,nil)\n"
+  "end\n"
+  "room=cacheLimit-#k\n"
+  "end\n"
+  "rawset(t,k,v)\n"
+  "end\n"
+  "return v\n"
+  "end\n"
+  "return setmetatable({},{__index=index,__call=index})\n"
+  "end\n"
+  "\n"
+  "local function headerInFunc(k)\n"
+  "return(k:lower():gsub(\"%-([a-z])\",string.upper))\n"
+  "end\n"
+  "\n"
+  "local function headerOutFunc(k)\n"
+  "return(k:gsub(\"[A-Z]\",\"-%1\"):gsub(\"^[a-z]\",string.upper))\n"
+  "end\n"
+  "\n"
+  "local headerIn=cacheTable(headerInFunc)\n"
+  "local headerOut=cacheTable(headerOutFunc)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local patVersion=\"HTTP/(%d+)%.(%d+)\"\n"
+  "\n"
+  "\n"
+  "local patRequest=\"^(\"..patToken..\") ([^ ]+) \"..patVersion..\" *\\r\?\\n\"\n"
+  "\n"
+  "\n"
+  "local PH=Object:new()\n"
+  "\n"
+  "local pstSTART=1\n"
+  "local pstHDRS=2\n"
+  "local pstDONE=3\n"
+  "\n"
+  "\n"
+  "function PH:initialize()\n"
+  "self:restart()\n"
+  "end\n"
+  "\n"
+  "function PH:restart()\n"
+  "self.state=pstSTART\n"
+  "self.data=\"\"\n"
+  "self.version=-1\n"
+  "self.headers={}\n"
+  "self.lastHeader=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function PH:isDone()\n"
+  "return self.state==pstDONE\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PH:parseStart(data,pos)\n"
+  "\n"
+  "local m,u,a,b=data:match(patRequest,pos)\n"
+  "\n"
+  "if not m then\n"
+  "\n"
+  "m,u=data:match(\"^([^ \\t]+) +(/[^ \\t\\r\\n]*)\\r\?\\n\",pos)\n"
+  "if m then\n"
+  "self.method=m\n"
+  "self.uri=u\n"
+  "else\n"
+  "self.error=\"bad\"\n"
+  "end\n"
+  "return pstDONE\n"
+  "elseif a~=\"1\"then\n"
+  "self.error=\"unsupported\"\n"
+  "return pstDONE\n"
+  "end\n"
+  "\n"
+  "self.method=m\n"
+  "self.uri=u\n"
+  "self.version=tonumber(b)\n"
+  "return pstHDRS\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function PH:takeData(newData)\n"
+  "local st=self.state\n"
+  "local data=self.data..newData\n"
+  "local nextLine=1\n"
+  "local hdrs=self.headers\n"
+  "\n"
+  "while st~=pstDONE do\n"
+  "local lineEnd=data:find(\"\\n\",nextLine)\n"
+  "if not lineEnd then break end\n"
+  "\n"
+  "local thisLine=nextLine\n"
+  "nextLine=lineEnd+1\n"
+  "\n"
+  "if st==pstSTART then\n"
+  "st=self:parseStart(data,thisLine)\n"
+  "\n"
+  "elseif st==pstHDRS then\n"
+  "\n"
+  "\n"
+  "local name,value=data:match(\"^([^\\0-\\32:]+)[ \\t]*:[ \\t]*([^\\r\\n]*)\\r\?\\n\",thisLine)\n"
+  "if name then\n"
+  "\n"
+  "name=headerIn[name]\n"
+  "if hdrs[name]then\n"
+  "value=hdrs[name]..\"; \"..value\n"
+  "end\n"
+  "hdrs[name]=value\n"
+  "self.lastHeader=name\n"
+  "elseif data:match(\"^\\r\?\\n\",thisLine)then\n"
+  "\n"
+  "st=pstDONE\n"
+  "break\n"
+  "else\n"
+  "\n"
+  "local cont=data:match(\"^[ \\t]*([^\\r\\n]*)\",thisLine)\n"
+  "if cont and self.lastHeader then\n"
+  "hdrs[self.lastHeader]=hdrs[self.lastHeader]..\" \"..cont\n"
+  "else\n"
+  "self.error=\"bad\"\n"
+  "st=pstDONE\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self.data=data:sub(nextLine)\n"
+  "self.state=st\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local httpStatusCodes={\n"
+  "[100]=\"Continue\",\n"
+  "[101]=\"Switching Protocols\",\n"
+  "[200]=\"OK\",\n"
+  "[201]=\"Created\",\n"
+  "[202]=\"Accepted\",\n"
+  "[203]=\"Non-Authoritative Information\",\n"
+  "[204]=\"No Content\",\n"
+  "[205]=\"Reset Content\",\n"
+  "[206]=\"Partial Content\",\n"
+  "[300]=\"Multiple Choices\",\n"
+  "[301]=\"Moved Permanently\",\n"
+  "[302]=\"Found\",\n"
+  "[303]=\"See Other\",\n"
+  "[304]=\"Not Modified\",\n"
+  "[305]=\"Use Proxy\",\n"
+  "[306]=\"(Unused)\",\n"
+  "[307]=\"Temporary Redirect\",\n"
+  "[400]=\"Bad Request\",\n"
+  "[401]=\"Unauthorized\",\n"
+  "[402]=\"Payment Required\",\n"
+  "[403]=\"Forbidden\",\n"
+  "[404]=\"Not Found\",\n"
+  "[405]=\"Method Not Allowed\",\n"
+  "[406]=\"Not Acceptable\",\n"
+  "[407]=\"Proxy Authentication Required\",\n"
+  "[408]=\"Request Timeout\",\n"
+  "[409]=\"Conflict\",\n"
+  "[410]=\"Gone\",\n"
+  "[411]=\"Length Required\",\n"
+  "[412]=\"Precondition Failed\",\n"
+  "[413]=\"Request Entity Too Large\",\n"
+  "[414]=\"Request-URI Too Long\",\n"
+  "[415]=\"Unsupported Media Type\",\n"
+  "[416]=\"Requested Range Not Satisfiable\",\n"
+  "[417]=\"Expectation Failed\",\n"
+  "[500]=\"Internal Server Error\",\n"
+  "[501]=\"Not Implemented\",\n"
+  "[502]=\"Bad Gateway\",\n"
+  "[503]=\"Service Unavailable\",\n"
+  "[504]=\"Gateway Timeout\",\n"
+  "[505]=\"HTTP Version Not Supported\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local BUFSIZE=1024\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function timeAfter(timeout)\n"
+  "return timeout and xpio.gettime()+timeout or nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function closingResponse(code,extraHeaders)\n"
+  "return\"HTTP/1.1 \"..code..\" \"..httpStatusCodes[code]..\"\\r\\n\"..\n"
+  "(extraHeaders or\"\")..\n"
+  "\"Connection: Close\\r\\nContent-Length: 0\\r\\n\\r\\n\"\n"
+  "end\n"
+  "\n"
+  "local WDConn=Object:new()\n"
+  "\n"
+  "local cstINIT=1\n"
+  "local cstREQUEST=2\n"
+  "local cstHANDLER=3\n"
+  "local cstDISCARD=4\n"
+  "local cstRESPOND=5\n"
+  "\n"
+  "\n"
+  "function WDConn:initialize(socket,handler,httpd)\n"
+  "self.socket=socket\n"
+  "self.handler=handler\n"
+  "self.data=\"\"\n"
+  "self.ph=PH:new()\n"
+  "self.httpd=httpd\n"
+  "self.thread=thread.new(self.run,self)\n"
+  "\n"
+  "thread.setPriority(\"interactive\",self.thread)\n"
+  "self.server=httpd.name\n"
+  "self.context={\n"
+  "client=socket:getpeername()\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function WDConn:shutDown(timeout)\n"
+  "\n"
+  "self:dtor()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function WDConn:dtor()\n"
+  "if not self.inDtor then\n"
+  "self.inDtor=true\n"
+  "if self.thread then\n"
+  "\n"
+  "thread.kill(self.thread)\n"
+  "end\n"
+  "if self.isActive then\n"
+  "self.isActive=false\n"
+  "self.httpd.active=self.httpd.active-1\n"
+  "end\n"
+  "self.socket:close()\n"
+  "self.httpd:removeConn(self)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:readUntil(amt,deadline)\n"
+  "local sock=self.socket\n"
+  "repeat\n"
+  "local data,err=sock:try_read(amt)\n"
+  "if data then\n"
+  "return data\n"
+  "elseif err~=\"retry\"then\n"
+  "return nil,err\n"
+  "end\n"
+  "until not thread.waitUntil(deadline,sock.when_read,sock)\n"
+  "\n"
+  "local stats=self.httpd.stats\n"
+  "stats.timedOut=stats.timedOut+1\n"
+  "return nil,\"timeout\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function WDConn:warn(...)\n"
+  "print(\"httpd.lua warning: \"..string.format(...))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:read(amt)\n"
+  "if self.expectContinue then\n"
+  "local err=self:sendContinue()\n"
+  "if err then\n"
+  "return nil,err\n"
+  "end\n"
+  "end\n"
+  "return self:readUntil(amt,timeAfter(self.httpd.bodyTimeout))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:sendContinue()\n"
+  "self.expectContinue=false\n"
+  "log(\"S\",\"HTTP/1.1 100 Continue\\r\\n\\r\\n\")\n"
+  "local _,err=self.socket:write(\"HTTP/1.1 100 Continue\\r\\n\\r\\n\")\n"
+  "return err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:handle()\n"
+  "local prefix,path,query=uriSplit(self.ph.uri)\n"
+  "if not path or self.ph.error then\n"
+  "self.connClose=true\n"
+  "return 505,{},\"\"\n"
+  "end\n"
+  "\n"
+  "local headers=self.ph.headers\n"
+  "local len=tonumber(headers.contentLength)\n"
+  "\n"
+  "local connHdr=parseList((headers.connection or\"\"):lower())\n"
+  "self.connClose=connHdr.close\n"
+  "or self.ph.version<1 and not connHdr.keepAlive\n"
+  "\n"
+  "\n"
+  "local chunked\n"
+  "local teUsed=headers.transferEncoding\n"
+  "if teUsed then\n"
+  "local tencs=parseTE(teUsed)\n"
+  "local name=tencs[1]and tencs[1].name:lower()\n"
+  "if name==\"chunked\"and not tencs[2]then\n"
+  "chunked=true\n"
+  "elseif name and name~=\"identity\"then\n"
+  "\n"
+  "\n"
+  "self.connClose=true\n"
+  "return 501,{},\"\"\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local extra=self.ph.data\n"
+  "self.ph.data=\"\"\n"
+  "\n"
+  "\n"
+  "local expect=headers.expect\n"
+  "if expect and self.ph.version>=1 then\n"
+  "if expect:lower()~=\"100-continue\"then\n"
+  "\n"
+  "self.connClose=true\n"
+  "return 417,{},\"\"\n"
+  "end\n"
+  "\n"
+  "self.expectContinue=extra==\"\"and(chunked or(len or 0)>0)\n"
+  "end\n"
+  "\n"
+  "if chunked then\n"
+  "self.subStream=ChunkedStream:new(self,extra)\n"
+  "else\n"
+  "self.subStream=SubStream:new(self,extra,len or 0)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local httpd=self.httpd\n"
+  "if httpd.maxActive and httpd.active>=httpd.maxActive then\n"
+  "httpd.stats.shed=httpd.stats.shed+1\n"
+  "return 503,{retryAfter=\"1\"},\"\"\n"
+  "end\n"
+  "httpd.active=httpd.active+1\n"
+  "self.isActive=true\n"
+  "\n"
+  "local request={\n"
+  "method=self.ph.method,\n"
+  "server=self.server,\n"
+  "root=\"\",\n"
+  "path=path,\n"
+  "query=query,\n"
+  "headers=headers,\n"
+  "body=self.subStream,\n"
+  "context=self.context\n"
+  "}\n"
+  "\n"
+  "\n"
+  "return self.handler(request)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function varyEncoding(headers)\n"
+  "local vary=headers.vary\n"
+  "if not vary then\n"
+  "headers.vary=\"Accept-Encoding\"\n"
+  "elseif not vary:lower():match(\"accept%-encoding\")then\n"
+  "headers.vary=vary..\", Accept-Encoding\"\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:compressBody(headers,bodyBytes,bodyFunc)\n"
+  "local httpd=self.httpd\n"
+  "local mediaType=(headers.contentType or\"\"):match(\"^[^;%s]*\"):lower()\n"
+  "local compressible\n"
+  "for _,pat in ipairs(httpd.compressTypes)do\n"
+  "if mediaType:match(pat)then\n"
+  "compressible=true\n"
+  "break\n"
+  "end\n"
+  "end\n"
+  "if not compressible or headers.contentEncoding then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "varyEncoding(headers)\n"
+  "\n"
+  "if bodyBytes and#bodyBytes<httpd.compressMinSize then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "\n"
+  "local accept=self.ph.headers.acceptEncoding or\"\"\n"
+  "local coding=acceptQ(accept,\"gzip\")>0 and\"gzip\"\n"
+  "or acceptQ(accept,\"deflate\")>0 and\"deflate\"\n"
+  "if not coding then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "local format=coding==\"gzip\"and\"gzip\"or\"zlib\"\n"
+  "local level=httpd.compressLevel\n"
+  "\n"
+  "if bodyBytes then\n"
+  "local data=deflate_c.compress(bodyBytes,format,level)\n"
+  "if#data>=#bodyBytes then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "bodyBytes=data\n"
+  "else\n"
+  "\n"
+  "local fn=bodyFunc\n"
+  "bodyFunc=function(emit)\n"
+  "local z=deflate_c.new(format,level)\n"
+  "local err\n"
+  "fn(function(data)\n"
+  "if err then\n"
+  "return nil,err\n"
+  "end\n"
+  "data=flatten(data)\n"
+  "if data==\"\"then\n"
+  "return true\n"
+  "end\n"
+  "local ok,e=emit(z:write(data)..z:flush())\n"
+  "err=not ok and(e or\"write failed\")\n"
+  "return ok,e\n"
+  "end)\n"
+  "\n"
+  "if not err then\n"
+  "emit(z:finish())\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "headers.contentEncoding=coding\n"
+  "headers.contentLength=nil\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:respond(code,headers,body)\n"
+  "local status\n"
+  "local bodyBytes\n"
+  "local bodyFunc\n"
+  "local chunked\n"
+  "\n"
+  "\n"
+  "\n"
+  "status=httpStatusCodes[code]\n"
+  "if not status then\n"
+  "code=500\n"
+  "status=httpStatusCodes[code]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local isHead=self.ph.method==\"HEAD\"\n"
+  "if code==204\n"
+  "or code==304\n"
+  "or code<=199\n"
+  "then\n"
+  "\n"
+  "elseif type(body)==\"function\"then\n"
+  "if isHead then\n"
+  "\n"
+  "elseif self.ph.version<1 then\n"
+  "self.connClose=true\n"
+  "elseif not self.connClose then\n"
+  "chunked=true\n"
+  "end\n"
+  "bodyFunc=body\n"
+  "else\n"
+  "local err\n"
+  "bodyBytes,err=flatten(body)\n"
+  "if err then\n"
+  "self:warn(err)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if type(headers)~=\"table\"then\n"
+  "self:warn(\"headers is not a table\")\n"
+  "headers={}\n"
+  "else\n"
+  "headers=clone(headers)\n"
+  "end\n"
+  "\n"
+  "if self.httpd.compress and(bodyBytes or bodyFunc)then\n"
+  "bodyBytes,bodyFunc=self:compressBody(headers,bodyBytes,bodyFunc)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if isHead then\n"
+  "bodyBytes,bodyFunc=nil,nil\n"
+  "end\n"
+  "\n"
+  "if self.connClose then\n"
+  "headers.connection=\"Close\"\n"
+  "elseif chunked then\n"
+  "headers.transferEncoding=\"chunked\"\n"
+  "headers.contentLength=nil\n"
+  "end\n"
+  "\n"
+  "if bodyBytes and not headers.contentLength then\n"
+  "headers.contentLength=tostring(#bodyBytes)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local responseLines={\n"
+  "\"HTTP/1.1 \"..code..\" \"..status\n"
+  "}\n"
+  "for k,v in pairs(headers)do\n"
+  "insert(responseLines,headerOut[k]..\": \"..v)\n"
+  "end\n"
+  "insert(responseLines,\"\")\n"
+  "insert(responseLines,bodyBytes or\"\")\n"
+  "\n"
+  "local response=concat(responseLines,\"\\r\\n\")\n"
+  "\n"
+  "log(\"S\",response)\n"
+  "local _,responseError=self.socket:write(response)\n"
+  "\n"
+  "if bodyFunc then\n"
+  "\n"
+  "local function emit(data)\n"
+  "if responseError then\n"
+  "return nil,responseError\n"
+  "end\n"
+  "data=flatten(data)\n"
+  "if data==\"\"then\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "if chunked then\n"
+  "data=chunkEncode(data)\n"
+  "end\n"
+  "log(\"S\",data)\n"
+  "local _,err=self.socket:write(data)\n"
+  "if err then\n"
+  "responseError=err\n"
+  "return nil,responseError\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "bodyFunc(emit)\n"
+  "if chunked and not responseError then\n"
+  "\n"
+  "log(\"S\",\"0\\r\\n\")\n"
+  "self.socket:write(\"0\\r\\n\\r\\n\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return responseError\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:run()\n"
+  "thread.atExit(self.dtor,self)\n"
+  "\n"
+  "local httpd=self.httpd\n"
+  "local headStarted=false\n"
+  "\n"
+  "while true do\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local deadline=timeAfter(headStarted and httpd.headerTimeout\n"
+  "or httpd.idleTimeout)\n"
+  "\n"
+  "while not self.ph:isDone()do\n"
+  "local data,err=self:readUntil(BUFSIZE,deadline)\n"
+  "if data then\n"
+  "log(\"C\",data)\n"
+  "if not headStarted then\n"
+  "headStarted=true\n"
+  "deadline=timeAfter(httpd.headerTimeout)\n"
+  "end\n"
+  "self.ph:takeData(data)\n"
+  "elseif err==\"timeout\"then\n"
+  "log(\"C\",\"<timeout>\")\n"
+  "if headStarted then\n"
+  "self.socket:try_write(closingResponse(408))\n"
+  "end\n"
+  "return\n"
+  "elseif err then\n"
+  "\n"
+  "log(\"C\",\"<error: \"..tostring(err)..\">\")\n"
+  "return\n"
+  "elseif self.ph.data~=\"\"then\n"
+  "\n"
+  "log(\"C\",\"<close after partial request>\")\n"
+  "return\n"
+  "else\n"
+  "\n"
+  "\n"
+  "\n"
+  "log(\"C\",\"<close>\")\n"
+  "return\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local code,headers,body=self:handle()\n"
+  "local err\n"
+  "\n"
+  "if self.expectContinue then\n"
+  "if type(body)==\"function\"then\n"
+  "\n"
+  "err=self:sendContinue()\n"
+  "else\n"
+  "\n"
+  "\n"
+  "self.expectContinue=false\n"
+  "self.connClose=true\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "err=err or self:respond(code,headers,body)\n"
+  "\n"
+  "if self.isActive then\n"
+  "self.isActive=false\n"
+  "httpd.active=httpd.active-1\n"
+  "end\n"
+  "\n"
+  "if err then\n"
+  "log(\"S\",\"<error: \"..tostring(err)..\">\")\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "if self.connClose then\n"
+  "\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local leftovers\n"
+  "\n"
+  "\n"
+  "if self.subStream then\n"
+  "local err=self.subStream:drain()\n"
+  "if err then\n"
+  "\n"
+  "log(\"C\",\"<error: \"..tostring(err)..\">\")\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "leftovers=self.subStream:leftovers()\n"
+  "self.subStream=nil\n"
+  "else\n"
+  "leftovers=self.ph.data\n"
+  "end\n"
+  "\n"
+  "headStarted=leftovers~=\"\"\n"
+  "self.ph:restart()\n"
+  "self.ph:takeData(leftovers)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local HTTPD=Object:new()\n"
+  "\n"
+  "\n"
+  "HTTPD.maxConns=1000\n"
+  "HTTPD.maxActive=false\n"
+  "HTTPD.idleTimeout=60\n"
+  "HTTPD.headerTimeout=20\n"
+  "HTTPD.bodyTimeout=60\n"
+  "HTTPD.compress=false\n"
+  "HTTPD.compressLevel=6\n"
+  "HTTPD.compressMinSize=1024\n"
+  "HTTPD.compressTypes={\n"
+  "\"^text/\",\n"
+  "\"^application/json$\",\n"
+  "\"^application/javascript$\",\n"
+  "\"^application/x%-oweb%-stream$\",\n"
+  "\"[/+]xml$\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "function HTTPD:initialize(addr,options)\n"
+  "for k,v in pairs(options or{})do\n"
+  "self[k]=v\n"
+  "end\n"
+  "self.addr=addr\n"
+  "self.name=\"http://\"..addr:gsub(\"^:\",\"127.0.0.1:\")\n"
+  "self.conns={}\n"
+  "self.numConns=0\n"
+  "self.active=0\n"
+  "self.stats={\n"
+  "accepted=0,\n"
+  "rejected=0,\n"
+  "shed=0,\n"
+  "timedOut=0,\n"
+  "}\n"
+  "self.sock=xpio.socket(\"TCP\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:serve()\n"
+  "local stats=self.stats\n"
+  "while true do\n"
+  "local s,err=self.sock:accept()\n"
+  "if s and self.numConns>=self.maxConns then\n"
+  "\n"
+  "stats.rejected=stats.rejected+1\n"
+  "s:try_write(closingResponse(503,\"Retry-After: 1\\r\\n\"))\n"
+  "s:close()\n"
+  "elseif s then\n"
+  "stats.accepted=stats.accepted+1\n"
+  "\n"
+  "\n"
+  "s:setsockopt(\"TCP_NODELAY\",true)\n"
+  "local conn=WDConn:new(s,self.handler,self)\n"
+  "self.conns[conn]=true\n"
+  "self.numConns=self.numConns+1\n"
+  "elseif err~=\"retry\"then\n"
+  "error(err)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:start(handler)\n"
+  "self.handler=handler\n"
+  "assert(self.sock:setsockopt(\"SO_REUSEADDR\",true))\n"
+  "assert(self.sock:bind(self.addr))\n"
+  "assert(self.sock:listen())\n"
+  "\n"
+  "self.thread=thread.new(self.serve,self)\n"
+  "\n"
+  "thread.setPriority(\"system\",self.thread)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:removeConn(conn)\n"
+  "if self.conns[conn]then\n"
+  "self.conns[conn]=nil\n"
+  "self.numConns=self.numConns-1\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:getAddr()\n"
+  "return self.sock:getsockname()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTTPD:shutDown(timeout)\n"
+  "thread.kill(self.thread)\n"
+  "for conn in pairs(self.conns)do\n"
+  "conn:shutDown(timeout)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:stop()\n"
+  "self:shutDown(0)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "HTTPD.mimeTypes={\n"
+  "css=\"text/css\",\n"
+  "gif=\"image/gif\",\n"
+  "htm=\"text/html\",\n"
+  "html=\"text/html\",\n"
+  "ico=\"image/x-icon\",\n"
+  "jpeg=\"image/jpeg\",\n"
+  "jpg=\"image/jpeg\",\n"
+  "js=\"application/javascript\",\n"
+  "json=\"application/json\",\n"
+  "lua=\"text/plain\",\n"
+  "png=\"image/png\",\n"
+  "svg=\"image/svg+xml\",\n"
+  "txt=\"text/plain\",\n"
+  "xml=\"application/xml\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function readFile(name)\n"
+  "local f=io.open(name,\"rb\")\n"
+  "if f then\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function fileExists(name)\n"
+  "local f=io.open(name,\"rb\")\n"
+  "if f then\n"
+  "f:close()\n"
+  "return true\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTTPD.fileResponse(request,filename,headers)\n"
+  "headers=clone(headers or{})\n"
+  "if not headers.contentType then\n"
+  "local ext=filename:match(\"%.([^./]*)$\")\n"
+  "headers.contentType=HTTPD.mimeTypes[ext and ext:lower()]\n"
+  "or\"application/octet-stream\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local accept=request.headers.acceptEncoding\n"
+  "local gzipOK=accept and acceptQ(accept,\"gzip\")>0\n"
+  "\n"
+  "local data=gzipOK and readFile(filename..\".gz\")\n"
+  "if data then\n"
+  "headers.contentEncoding=\"gzip\"\n"
+  "varyEncoding(headers)\n"
+  "return 200,headers,data\n"
+  "end\n"
+  "\n"
+  "data=readFile(filename)\n"
+  "local refused=not gzipOK and fileExists(filename..\".gz\")\n"
+  "if data then\n"
+  "if refused then\n"
+  "varyEncoding(headers)\n"
+  "end\n"
+  "return 200,headers,data\n"
+  "elseif refused then\n"
+  "return 406,{contentType=\"text/plain\",vary=\"Accept-Encoding\"},\n"
+  "\"Not acceptable: gzip encoding required\"\n"
+  "end\n"
+  "return 404,{contentType=\"text/plain\"},\"Not found\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "HTTPD.headerIn=headerIn\n"
+  "HTTPD.headerOut=headerOut\n"
+  "\n"
+  "\n"
+  "\n"
+  "HTTPD.PH=PH\n"
+  "HTTPD.PH.pstHDRS=pstHDRS\n"
+  "HTTPD.PH.pstDONE=pstDONE\n"
+  "HTTPD.parseTE=parseTE\n"
+  "HTTPD.parseList=parseList\n"
+  "HTTPD.chunkEncode=chunkEncode\n"
+  "HTTPD.httpStatusCodes=httpStatusCodes\n"
+  "HTTPD.acceptQ=acceptQ\n"
+  "HTTPD.WDConn=WDConn\n"
+  "\n"
+  "\n"
+  "return HTTPD\n"
+  "";
+
+static const unsigned char data3[] = 
+  "\n"
+  "\n"
+  "local Object={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Object:adopt(o)\n"
+  "rawset(self,\"__index\",self)\n"
+  "setmetatable(o,self)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:getParent()\n"
+  "local p=getmetatable(self).__index\n"
+  "return type(p)==\"table\"and p or nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:basicNew()\n"
+  "return self:adopt{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:new(...)\n"
+  "local o=self:basicNew()\n"
+  "o:initialize(...)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:initialize()\n"
+  "\n"
+  "end\n"
+  "\n"
+  "return Object\n"
+  "";
+
+static const unsigned char data4[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpio=require\"xpio_c\"\n"
+  "local xpfs=require\"xpfs\"\n"
+  "\n"
+  "local yield=coroutine.yield\n"
+  "\n"
+  "local currentTask\n"
+  "\n"
+  "local dirSep=package.config:sub(1,1)\n"
+  "local pathSep=dirSep==\"/\"and\":\"or\";\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Socket=xpio._XPSocket\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:write(data)\n"
+  "local amt=0\n"
+  "while data~=\"\"do\n"
+  "local num,err=self:try_write(data)\n"
+  "if num then\n"
+  "amt=amt+num\n"
+  "data=data:sub(num+1)\n"
+  "elseif err~=\"retry\"then\n"
+  "return nil,err\n"
+  "else\n"
+  "yield(self:when_write(currentTask))\n"
+  "end\n"
+  "end\n"
+  "return amt\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:read(amt)\n"
+  "repeat\n"
+  "local a,b=self:try_read(amt)\n"
+  "if a then\n"
+  "return a\n"
+  "elseif b~=\"retry\"then\n"
+  "return nil,b\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:recvfrom(size)\n"
+  "repeat\n"
+  "local data,addr=self:try_recvfrom(size)\n"
+  "if data then\n"
+  "return data,addr\n"
+  "elseif addr~=\"retry\"then\n"
+  "return nil,addr\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:sendto(data,addr)\n"
+  "repeat\n"
+  "local num,err=self:try_sendto(data,addr)\n"
+  "if num or err~=\"retry\"then\n"
+  "return num,err\n"
+  "end\n"
+  "yield(self:when_write(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:recvmany(count,size)\n"
+  "repeat\n"
+  "local datas,addrs=self:try_recvmany(count,size)\n"
+  "if datas then\n"
+  "return datas,addrs\n"
+  "elseif addrs~=\"retry\"then\n"
+  "return nil,addrs\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:sendmany(datas,addrs)\n"
+  "local sent=0\n"
+  "while sent<#datas do\n"
+  "local num,err=self:try_sendmany(datas,addrs,sent+1)\n"
+  "if num then\n"
+  "sent=sent+num\n"
+  "elseif err~=\"retry\"then\n"
+  "return nil,err\n"
+  "else\n"
+  "yield(self:when_write(currentTask))\n"
+  "end\n"
+  "end\n"
+  "return sent\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:connect(...)\n"
+  "repeat\n"
+  "local succ,err=self:try_connect(...)\n"
+  "if succ or err~=\"retry\"then\n"
+  "return succ,err\n"
+  "end\n"
+  "yield(self:when_write(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:accept()\n"
+  "repeat\n"
+  "local s,err=self:try_accept()\n"
+  "if s then\n"
+  "return s\n"
+  "end\n"
+  "if err~=\"retry\"then\n"
+  "return nil,err\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Process=xpio._XPProc\n"
+  "\n"
+  "\n"
+  "function Process:wait()\n"
+  "repeat\n"
+  "local a,b=self:try_wait()\n"
+  "if a==nil and b==\"retry\"then\n"
+  "yield(self:when_wait(currentTask))\n"
+  "else\n"
+  "return a,b\n"
+  "end\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xpio.setCurrentTask(task)\n"
+  "currentTask=task\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function xpio.getCurrentTask(task)\n"
+  "return currentTask\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function fdjuggle(_fdmap,nextfd)\n"
+  "local o={}\n"
+  "\n"
+  "local function dup2(from,to)\n"
+  "o[#o+1]={to,from}\n"
+  "end\n"
+  "\n"
+  "local function close(fd)\n"
+  "o[#o+1]={fd}\n"
+  "end\n"
+  "\n"
+  "local to={}\n"
+  "local from={}\n"
+  "for dest,src in pairs(_fdmap)do\n"
+  "src=tonumber(src)or src:fileno()\n"
+  "to[dest]=src\n"
+  "from[src]=true\n"
+  "end\n"
+  "\n"
+  "local newnames={}\n"
+  "local tmpfd\n"
+  "\n"
+  "local function dupChain(a,b)\n"
+  "if not b then\n"
+  "close(a)\n"
+  "elseif newnames[b]then\n"
+  "\n"
+  "dup2(newnames[b],a)\n"
+  "else\n"
+  "\n"
+  "dup2(b,a)\n"
+  "newnames[b]=a\n"
+  "return dupChain(b,to[b])\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for a in nextfd do\n"
+  "if not to[a]and not from[a]then\n"
+  "close(a)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for a,b in pairs(to)do\n"
+  "if not from[a]then\n"
+  "dupChain(a,b)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for a,b in pairs(to)do\n"
+  "if a==b then\n"
+  "dup2(a,b)\n"
+  "elseif from[a]and not newnames[a]then\n"
+  "if not tmpfd then\n"
+  "tmpfd=0\n"
+  "while to[tmpfd]do\n"
+  "tmpfd=tmpfd+1\n"
+  "end\n"
+  "end\n"
+  "dupChain(tmpfd,a)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if tmpfd then\n"
+  "close(tmpfd)\n"
+  "end\n"
+  "\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function searchPath(file)\n"
+  "local path=os.getenv(\"PATH\")or\"\"\n"
+  "for dir in(path..pathSep):gmatch(\"(.-):\")do\n"
+  "if dir==\"\"then\n"
+  "dir=\".\"\n"
+  "end\n"
+  "local path=dir..dirSep..file\n"
+  "\n"
+  "\n"
+  "\n"
+  "local stat=xpfs.stat(path,\"pk\")\n"
+  "if stat and stat.kind==\"f\"and stat.perm:match(\"x\")then\n"
+  "return path\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function xpio.spawn(args,env,files,attrs)\n"
+  "local file=assert(attrs and attrs.exe or args[1],\"spawn: file not provided\")\n"
+  "\n"
+  "if not file:match(dirSep)then\n"
+  "file=assert(searchPath(file),\"file not found in PATH: \"..file)\n"
+  "end\n"
+  "\n"
+  "local fdActions=fdjuggle(files,xpio._nextfd)\n"
+  "\n"
+  "local envStrings={}\n"
+  "\n"
+  "for k,v in pairs(env)do\n"
+  "envStrings[#envStrings+1]=k..\"=\"..v\n"
+  "end\n"
+  "\n"
+  "local proc=xpio._spawn(file,args,envStrings,fdActions)\n"
+  "\n"
+  "\n"
+  "for _,socket in pairs(files)do\n"
+  "if type(socket)==\"userdata\"then\n"
+  "socket:close()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return proc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "xpio._fdjuggle=fdjuggle\n"
+  "xpio._searchPath=searchPath\n"
+  "\n"
+  "return xpio\n"
+  "";
+
+extern int luaopen_xpio_c(lua_State *);
+
+extern int luaopen_xpfs(lua_State *);
+
+static const unsigned char data5[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function hexToByte(s)\n"
+  "return string.char(tonumber(s,16))\n"
+  "end\n"
+  "\n"
+  "local function byteToHex(ch)\n"
+  "return string.format(\"%%%02X\",string.byte(ch))\n"
+  "end\n"
+  "\n"
+  "local function pctDecode(s)\n"
+  "return(s:gsub(\"%%(%x%x)\",hexToByte))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function paramDecode(s)\n"
+  "return pctDecode(s:gsub(\"%+\",\" \"))\n"
+  "end\n"
+  "\n"
+  "local function paramEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~ ])\",byteToHex):gsub(\" \",\"+\"))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local pathDecode=pctDecode\n"
+  "\n"
+  "local function pathEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~/%+])\",byteToHex))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local authorityDecode=pctDecode\n"
+  "\n"
+  "local function authorityEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~:%+])\",byteToHex))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function schemeNorm(s)\n"
+  "if s:match(\"^[%w%+%-%.]+$\")then\n"
+  "return s:lower()\n"
+  "end\n"
+  "error(\"URI handling: Invalid scheme\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseParams(str)\n"
+  "local t={}\n"
+  "if str then\n"
+  "for fld in str:gmatch(\"[^&;]+\")do\n"
+  "local k,v=fld:match(\"([^=]*)=(.*)\")\n"
+  "if k then\n"
+  "t[paramDecode(k)]=paramDecode(v)\n"
+  "elseif fld~=\"\"then\n"
+  "table.insert(t,paramDecode(fld))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local luaImpl={\n"
+  "pctDecode=pctDecode,\n"
+  "paramDecode=paramDecode,\n"
+  "paramEncode=paramEncode,\n"
+  "pathEncode=pathEncode,\n"
+  "authorityEncode=authorityEncode,\n"
+  "parseParams=parseParams,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "if succ then\n"
+  "pctDecode=textcodec_c.pctDecode\n"
+  "paramDecode=textcodec_c.paramDecode\n"
+  "paramEncode=textcodec_c.paramEncode\n"
+  "pathEncode=textcodec_c.pathEncode\n"
+  "authorityEncode=textcodec_c.authorityEncode\n"
+  "parseParams=textcodec_c.parseParams\n"
+  "pathDecode=pctDecode\n"
+  "authorityDecode=pctDecode\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function makeParams(t)\n"
+  "if not t or not next(t)then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "local a={}\n"
+  "for n,v in ipairs(t)do\n"
+  "if type(v)==\"string\"and v~=\"\"then\n"
+  "table.insert(a,paramEncode(v))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local map={}\n"
+  "for k,v in pairs(t)do\n"
+  "if type(k)==\"string\"and type(v)==\"string\"then\n"
+  "table.insert(map,paramEncode(k)..\"=\"..paramEncode(tostring(v)))\n"
+  "end\n"
+  "end\n"
+  "if map[1]then\n"
+  "table.sort(map)\n"
+  "table.insert(a,table.concat(map,\";\"))\n"
+  "end\n"
+  "\n"
+  "return table.concat(a,\";\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriToString(t)\n"
+  "if type(t)==\"string\"then return t end\n"
+  "if type(t)~=\"table\"then error(\"uri handling: Invalid type for URI: \"..type(t))end\n"
+  "\n"
+  "local query=t.params\n"
+  "if type(query)==\"table\"then\n"
+  "query=makeParams(query)\n"
+  "end\n"
+  "local path=t.path or\"\"\n"
+  "\n"
+  "return(t.scheme and schemeNorm(t.scheme)..\":\"or\"\")\n"
+  "..(t.authority and\"//\"..authorityEncode(t.authority)or\"\")\n"
+  "..((t.authority and path:sub(1,1)~=\"/\")and\"/\"or\"\")\n"
+  "..pathEncode(path)\n"
+  "..(t.version and\"@\"..paramEncode(t.version)or\"\")\n"
+  "..(query and\"\?\"..query or\"\")\n"
+  "..(t.fragment and\"#\"..paramEncode(t.fragment)or\"\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriToTable(uri)\n"
+  "if not uri then return{}end\n"
+  "if type(uri)==\"table\"then return uri end\n"
+  "if type(uri)~=\"string\"then error(\"Invalid type for URI: \"..type(uri))end\n"
+  "\n"
+  "local s,h,p,v,q,u,f\n"
+  "\n"
+  "s,u=uri:match(\"^([%w%+%-%.]+)%:(.*)\")\n"
+  "uri=u or uri\n"
+  "h,u=uri:match(\"^//([^/]*)(.*)\")\n"
+  "p,uri=(u or uri):match(\"^([^@%\?#]*)(.*)\")\n"
+  "v,u=uri:match(\"@([^%\?#]*)(.*)\")\n"
+  "uri=u or uri\n"
+  "q,u=uri:match(\"^%\?([^#]*)(.*)\")\n"
+  "uri=u or uri\n"
+  "f=uri:match(\"^#(.*)\")\n"
+  "\n"
+  "return{\n"
+  "scheme=s,\n"
+  "authority=h and authorityDecode(h),\n"
+  "path=pathDecode(p),\n"
+  "version=v and paramDecode(v),\n"
+  "params=q and parseParams(q),\n"
+  "fragment=f and paramDecode(f)\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function dir(str,pos)\n"
+  "while pos>0 and str:sub(pos,pos)~=\"/\"do\n"
+  "pos=pos-1\n"
+  "end\n"
+  "return str:sub(1,pos),pos\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function cleanPath(path)\n"
+  "local n,e,post=1\n"
+  "repeat\n"
+  "n,e,post=path:match(\"/()(%.%.\?)([^/]\?)\",n)\n"
+  "if n and post==\"\"then\n"
+  "if e==\".\"then\n"
+  "path=path:sub(1,n-1)..path:sub(n+2)\n"
+  "else\n"
+  "local pre,a=dir(path,n-2)\n"
+  "local parent=path:sub(a+1,n-2)\n"
+  "if parent~=\"..\"then\n"
+  "if parent==\"\"then pre=pre..\"/\"end\n"
+  "path=pre..path:sub(n+3)\n"
+  "n=a\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "until not n\n"
+  "\n"
+  "return path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function resolve(r,b)\n"
+  "r=uriToTable(r)\n"
+  "b=uriToTable(b)\n"
+  "\n"
+  "local path,pb=r.path or\"\",b.path or\"\"\n"
+  "if r.scheme then\n"
+  "\n"
+  "elseif path==\"\"then\n"
+  "path=pb\n"
+  "elseif path:sub(1,1)~=\"/\"then\n"
+  "path=dir(pb,#pb)..path\n"
+  "end\n"
+  "path=cleanPath(path)\n"
+  "\n"
+  "return{\n"
+  "scheme=r.scheme or b.scheme,\n"
+  "authority=r.authority or(not r.scheme and b.authority or nil),\n"
+  "path=path,\n"
+  "version=r.version or b.version,\n"
+  "params=r.params,\n"
+  "fragment=r.fragment\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parse(uri,base)\n"
+  "if base then\n"
+  "uri=resolve(uri,base)\n"
+  "end\n"
+  "return uriToTable(uri)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gen(uri,base)\n"
+  "if base then\n"
+  "uri=resolve(uri,base)\n"
+  "end\n"
+  "return uriToString(uriToTable(uri))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "parse=parse,\n"
+  "gen=gen,\n"
+  "cleanPath=cleanPath,\n"
+  "byteToHex=byteToHex,\n"
+  "pctDecode=pctDecode,\n"
+  "paramDecode=paramDecode,\n"
+  "isNative=succ,\n"
+  "_lua=luaImpl,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+static const unsigned char data6[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpio=require\"xpio\"\n"
+  "local Heap=require\"heap\"\n"
+  "local Queue=require\"queue\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function undoPack(t)\n"
+  "return table.unpack(t,1,t.n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local thread={}\n"
+  "\n"
+  "\n"
+  "local currentTask\n"
+  "\n"
+  "\n"
+  "\n"
+  "local classNames={\"system\",\"interactive\",\"batch\"}\n"
+  "local classIndex={system=1,interactive=2,batch=3}\n"
+  "local defaultClass=classIndex.interactive\n"
+  "\n"
+  "\n"
+  "thread.budget={\n"
+  "interactive=0.05,\n"
+  "batch=0.01,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function taskAtExit(me,fn,...)\n"
+  "local id=table.pack(fn,...)\n"
+  "table.insert(me.atExits,id)\n"
+  "return id\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function taskCancelAtExit(me,id)\n"
+  "for n=#me.atExits,1,-1 do\n"
+  "if id==me.atExits[n]then\n"
+  "table.remove(me.atExits,n)\n"
+  "return true\n"
+  "end\n"
+  "end\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function taskRunAtExits(me)\n"
+  "while true do\n"
+  "local oe=table.remove(me.atExits)\n"
+  "if not oe then return end\n"
+  "oe[1](table.unpack(oe,2,oe.n))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function taskDelete(me)\n"
+  "if me._dequeue then\n"
+  "me:_dequeue()\n"
+  "end\n"
+  "taskRunAtExits(me)\n"
+  "me.dispatch.all[me]=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "thread.Task={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function taskNew(dispatch,fn,...)\n"
+  "local fargs=table.pack(...)\n"
+  "local me=setmetatable({},thread.Task)\n"
+  "\n"
+  "local function preamble()\n"
+  "me.results=table.pack(xpcall(fn,debug.traceback,undoPack(fargs)))\n"
+  "me.failed=not table.remove(me.results,1)\n"
+  "me.results.n=me.results.n-1\n"
+  "if me.failed then\n"
+  "dispatch.all[me]=nil\n"
+  "end\n"
+  "taskDelete(me)\n"
+  "end\n"
+  "\n"
+  "me.coroutine=coroutine.create(preamble)\n"
+  "me.dispatch=dispatch\n"
+  "me.atExits={}\n"
+  "me._queue=dispatch._queue\n"
+  "me.makeReady=dispatch.makeReady\n"
+  "\n"
+  "\n"
+  "me.priority=currentTask and currentTask.priority or defaultClass\n"
+  "\n"
+  "\n"
+  "me.runs=0\n"
+  "me.runTime=0\n"
+  "me.maxRun=0\n"
+  "\n"
+  "me:makeReady()\n"
+  "dispatch.all[me]=true\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.new(fn,...)\n"
+  "return taskNew(currentTask.dispatch,fn,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.yield()\n"
+  "currentTask:makeReady()\n"
+  "coroutine.yield()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joinWake(task)\n"
+  "task._dequeue=nil\n"
+  "task._dequeueTask=nil\n"
+  "task._dequeueID=nil\n"
+  "task:makeReady()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joinDequeue(task)\n"
+  "taskCancelAtExit(task._dequeueTask,task._dequeueID)\n"
+  "task._dequeue=nil\n"
+  "task._dequeueTask=nil\n"
+  "task._dequeueID=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.join(task)\n"
+  "if not task.results then\n"
+  "local id=taskAtExit(task,joinWake,currentTask)\n"
+  "currentTask._dequeue=joinDequeue\n"
+  "currentTask._dequeueTask=task\n"
+  "currentTask._dequeueID=id\n"
+  "coroutine.yield()\n"
+  "end\n"
+  "if task.failed then\n"
+  "error(task.results[1],0)\n"
+  "else\n"
+  "return undoPack(task.results)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.atExit(fn,...)\n"
+  "return taskAtExit(currentTask,fn,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.cancelAtExit(id)\n"
+  "return taskCancelAtExit(currentTask,id)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.kill(task)\n"
+  "if not task.results then\n"
+  "task.results=table.pack(nil,\"killed\")\n"
+  "taskDelete(task)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.setPriority(class,task)\n"
+  "local c=classIndex[class]\n"
+  "if not c then\n"
+  "error(\"thread.setPriority: invalid class: \"..tostring(class),2)\n"
+  "end\n"
+  "task=task or currentTask\n"
+  "task.priority=c\n"
+  "if task._dequeue and task._dequeue==task.dispatch.dqQueue then\n"
+  "\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.getPriority(task)\n"
+  "return classNames[(task or currentTask).priority]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.taskStats(task)\n"
+  "task=task or currentTask\n"
+  "return{\n"
+  "priority=classNames[task.priority],\n"
+  "runs=task.runs,\n"
+  "time=task.runTime,\n"
+  "max=task.maxRun,\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function thread.tasks()\n"
+  "local tasks={}\n"
+  "for task in pairs(currentTask.dispatch.all)do\n"
+  "tasks[#tasks+1]=task\n"
+  "end\n"
+  "return tasks\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "thread.gc={\n"
+  "mode=\"incremental\",\n"
+  "budget=0.002,\n"
+  "stepSize=8,\n"
+  "threshold=1.5,\n"
+  "limit=4,\n"
+  "clock=xpio.gettime,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local dispatchDepth=0\n"
+  "local gcMode\n"
+  "\n"
+  "\n"
+  "local function gcEnter()\n"
+  "dispatchDepth=dispatchDepth+1\n"
+  "if dispatchDepth==1 then\n"
+  "gcMode=thread.gc.mode\n"
+  "if gcMode==\"generational\"then\n"
+  "collectgarbage(\"generational\")\n"
+  "elseif gcMode==\"idle\"then\n"
+  "collectgarbage(\"stop\")\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function gcLeave()\n"
+  "dispatchDepth=dispatchDepth-1\n"
+  "if dispatchDepth==0 then\n"
+  "if gcMode==\"generational\"then\n"
+  "collectgarbage(\"incremental\")\n"
+  "elseif gcMode==\"idle\"then\n"
+  "collectgarbage(\"restart\")\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gcSlice(stats,budget,tStart)\n"
+  "local cfg=thread.gc\n"
+  "local tEnd=tStart+budget\n"
+  "local t\n"
+  "repeat\n"
+  "stats.steps=stats.steps+1\n"
+  "if collectgarbage(\"step\",cfg.stepSize)then\n"
+  "stats.cycles=stats.cycles+1\n"
+  "stats.active=false\n"
+  "stats.base=collectgarbage(\"count\")\n"
+  "t=cfg.clock()\n"
+  "break\n"
+  "end\n"
+  "t=cfg.clock()\n"
+  "until t>=tEnd\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local _=string.rep(\" \",4096)\n"
+  "\n"
+  "local elapsed=t-tStart\n"
+  "stats.slices=stats.slices+1\n"
+  "stats.time=stats.time+elapsed\n"
+  "if elapsed>stats.max then\n"
+  "stats.max=elapsed\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gcIdle(stats,timeout)\n"
+  "local cfg=thread.gc\n"
+  "local budget=math.min(cfg.budget,timeout or math.huge)\n"
+  "if budget<=0 then\n"
+  "return\n"
+  "end\n"
+  "if not stats.active then\n"
+  "\n"
+  "\n"
+  "local kb=collectgarbage(\"count\")\n"
+  "if kb<stats.base*cfg.threshold then\n"
+  "stats.base=math.min(stats.base,kb)\n"
+  "return\n"
+  "end\n"
+  "stats.active=true\n"
+  "end\n"
+  "gcSlice(stats,budget,cfg.clock())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gcCheckLimit(stats)\n"
+  "local cfg=thread.gc\n"
+  "if gcMode==\"idle\"and collectgarbage(\"count\")>stats.base*cfg.limit then\n"
+  "stats.forced=stats.forced+1\n"
+  "stats.active=true\n"
+  "gcSlice(stats,cfg.budget,cfg.clock())\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newDispatch()\n"
+  "local me={}\n"
+  "local ready={}\n"
+  "local sleepers=Heap:new()\n"
+  "local tq=xpio.tqueue()\n"
+  "\n"
+  "for c=1,#classNames do\n"
+  "ready[c]=Queue:new()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local iteration=0\n"
+  "\n"
+  "me.all={}\n"
+  "\n"
+  "me._queue=tq\n"
+  "\n"
+  "\n"
+  "me.gcStats={\n"
+  "slices=0,steps=0,forced=0,cycles=0,time=0,max=0,\n"
+  "active=false,base=collectgarbage(\"count\")\n"
+  "}\n"
+  "\n"
+  "local function dqQueue(task)\n"
+  "task._dequeuedata:remove(task)\n"
+  "task._dequeuedata=nil\n"
+  "task._dequeue=nil\n"
+  "end\n"
+  "\n"
+  "me.dqQueue=dqQueue\n"
+  "\n"
+  "function me.makeReady(task)\n"
+  "assert(not task._dequeue)\n"
+  "local q=ready[task.priority]\n"
+  "task._dequeue=dqQueue\n"
+  "task._dequeuedata=q\n"
+  "task._readyIteration=iteration\n"
+  "q:put(task)\n"
+  "end\n"
+  "\n"
+  "local function anyReady()\n"
+  "for c=1,#ready do\n"
+  "if ready[c]:first()then\n"
+  "return true\n"
+  "end\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "local function dqSleeper(task)\n"
+  "sleepers:remove(task)\n"
+  "task._dequeue=nil\n"
+  "end\n"
+  "\n"
+  "function me.wakeAt(task,timeDue)\n"
+  "assert(not task._dequeue)\n"
+  "task._dequeue=dqSleeper\n"
+  "task.timeDue=timeDue\n"
+  "sleepers:put(task,timeDue)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function me:dtor()\n"
+  "for c=1,#ready do\n"
+  "while true do\n"
+  "local t=ready[c]:first()\n"
+  "if not t then break end\n"
+  "taskDelete(t)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function runQueue(q,budget,tStart)\n"
+  "local t0=tStart\n"
+  "local count=0\n"
+  "while true do\n"
+  "local task=q:first()\n"
+  "if not task or task._readyIteration>=iteration\n"
+  "or budget and count>0 and t0-tStart>=budget\n"
+  "then\n"
+  "return t0\n"
+  "end\n"
+  "count=count+1\n"
+  "\n"
+  "\n"
+  "q:get()\n"
+  "task._dequeuedata=nil\n"
+  "task._dequeue=nil\n"
+  "\n"
+  "currentTask=task\n"
+  "xpio.setCurrentTask(task)\n"
+  "\n"
+  "local succ,err=coroutine.resume(task.coroutine)\n"
+  "\n"
+  "local t1=xpio.gettime()\n"
+  "local elapsed=t1-t0\n"
+  "task.runs=task.runs+1\n"
+  "task.runTime=task.runTime+elapsed\n"
+  "if elapsed>task.maxRun then\n"
+  "task.maxRun=elapsed\n"
+  "end\n"
+  "t0=t1\n"
+  "\n"
+  "if not succ then\n"
+  "gcLeave()\n"
+  "me:dtor()\n"
+  "local msg=(\"*** Uncaught error in thread:\\n\\t\"..tostring(err)):gsub(\"\\n(.)\",\"\\n | %1\")\n"
+  "error(msg,0)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function me:dispatch()\n"
+  "local thisTask=currentTask\n"
+  "local gcStats=me.gcStats\n"
+  "local budget=thread.budget\n"
+  "\n"
+  "gcEnter()\n"
+  "\n"
+  "while true do\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "iteration=iteration+1\n"
+  "local t=xpio.gettime()\n"
+  "for c=1,#ready do\n"
+  "local q=ready[c]\n"
+  "if q:first()then\n"
+  "\n"
+  "t=runQueue(q,budget[classNames[c]],t)\n"
+  "end\n"
+  "end\n"
+  "currentTask=nil\n"
+  "xpio.setCurrentTask(nil)\n"
+  "\n"
+  "gcCheckLimit(gcStats)\n"
+  "\n"
+  "local s=sleepers:first()\n"
+  "local timeout=anyReady()and 0 or s and s.timeDue-xpio.gettime()\n"
+  "if timeout~=0 and(s or not tq:isEmpty())then\n"
+  "\n"
+  "gcIdle(gcStats,timeout)\n"
+  "timeout=s and math.max(0,s.timeDue-xpio.gettime())\n"
+  "end\n"
+  "local tasks=tq:wait(timeout)\n"
+  "\n"
+  "\n"
+  "\n"
+  "if tasks then\n"
+  "for _,task in ipairs(tasks)do\n"
+  "task:makeReady()\n"
+  "end\n"
+  "elseif not anyReady()then\n"
+  "\n"
+  "break\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local tNow=xpio.gettime()\n"
+  "while true do\n"
+  "local task=sleepers:first()\n"
+  "if not task or task.timeDue>tNow then\n"
+  "break\n"
+  "end\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "gcLeave()\n"
+  "currentTask=thisTask\n"
+  "xpio.setCurrentTask(currentTask)\n"
+  "end\n"
+  "\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.dispatch(func,...)\n"
+  "local me=newDispatch()\n"
+  "local t=taskNew(me,func,...)\n"
+  "me:dispatch()\n"
+  "me:dtor()\n"
+  "if t.failed then\n"
+  "error(t.results[1],0)\n"
+  "end\n"
+  "\n"
+  "for task in pairs(me.all)do\n"
+  "print(\"*** Dangling thread:\")\n"
+  "print(debug.traceback(task.coroutine))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.gcStats()\n"
+  "local stats=currentTask.dispatch.gcStats\n"
+  "return{\n"
+  "slices=stats.slices,\n"
+  "steps=stats.steps,\n"
+  "forced=stats.forced,\n"
+  "cycles=stats.cycles,\n"
+  "time=stats.time,\n"
+  "max=stats.max,\n"
+  "mean=stats.slices>0 and stats.time/stats.slices or 0,\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.sleepUntil(t)\n"
+  "currentTask.dispatch.wakeAt(currentTask,t)\n"
+  "coroutine.yield()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.sleep(delay)\n"
+  "thread.sleepUntil(delay+xpio.gettime())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Timer={}\n"
+  "Timer.__index=Timer\n"
+  "\n"
+  "function Timer:makeReady()\n"
+  "local task=self.task\n"
+  "if task._dequeue==self.dequeue then\n"
+  "self.expired=true\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function thread.waitUntil(timeDue,when,obj)\n"
+  "local task=currentTask\n"
+  "when(obj,task)\n"
+  "if not timeDue then\n"
+  "coroutine.yield()\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "local ioDequeue=task._dequeue\n"
+  "local timer=setmetatable({task=task},Timer)\n"
+  "\n"
+  "\n"
+  "function timer.dequeue(t)\n"
+  "ioDequeue(t)\n"
+  "if timer._dequeue then\n"
+  "timer:_dequeue()\n"
+  "end\n"
+  "end\n"
+  "task._dequeue=timer.dequeue\n"
+  "\n"
+  "task.dispatch.wakeAt(timer,timeDue)\n"
+  "coroutine.yield()\n"
+  "if timer._dequeue then\n"
+  "timer:_dequeue()\n"
+  "end\n"
+  "return not timer.expired\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Waiter={}\n"
+  "Waiter.__index=Waiter\n"
+  "\n"
+  "function Waiter:makeReady()\n"
+  "local task=self.task\n"
+  "if task._dequeue==self.dequeue then\n"
+  "self.result.index=self.index\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function thread.waitAny(timeDue,whens)\n"
+  "local task=currentTask\n"
+  "local waiters={}\n"
+  "local result={}\n"
+  "\n"
+  "local function dequeue(t)\n"
+  "t._dequeue=nil\n"
+  "for _,w in ipairs(waiters)do\n"
+  "if w._dequeue then\n"
+  "w:_dequeue()\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function newWaiter(index)\n"
+  "local w=setmetatable({task=task,result=result,index=index,\n"
+  "dequeue=dequeue,_queue=task._queue},\n"
+  "Waiter)\n"
+  "waiters[#waiters+1]=w\n"
+  "return w\n"
+  "end\n"
+  "\n"
+  "for ndx,pair in ipairs(whens)do\n"
+  "pair[1](pair[2],newWaiter(ndx))\n"
+  "end\n"
+  "if timeDue then\n"
+  "task.dispatch.wakeAt(newWaiter(nil),timeDue)\n"
+  "end\n"
+  "\n"
+  "task._dequeue=dequeue\n"
+  "coroutine.yield()\n"
+  "return result.index\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return thread\n"
+  "";
+
+static const unsigned char data7[] = 
+  "local Object=require\"object\"\n"
+  "\n"
+  "local Heap=Object:new()\n"
+  "\n"
+  "\n"
+  "function Heap:initialize()\n"
+  "end\n"
+  "\n"
+  "function Heap:put(obj,value)\n"
+  "table.insert(self,{obj=obj,value=value})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Heap:minPos()\n"
+  "if#self>0 then\n"
+  "local minpos=1\n"
+  "local minvalue=self[minpos].value\n"
+  "for n=2,#self do\n"
+  "if self[n].value<minvalue then\n"
+  "minpos=n\n"
+  "minvalue=self[minpos].value\n"
+  "end\n"
+  "end\n"
+  "return minpos\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Heap:first()\n"
+  "local n=self:minPos()\n"
+  "if n then\n"
+  "return self[n].obj\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Heap:get()\n"
+  "local n=self:minPos()\n"
+  "if n then\n"
+  "local obj=self[n].obj\n"
+  "table.remove(self,n)\n"
+  "return obj\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Heap:remove(obj)\n"
+  "for n=1,#self do\n"
+  "if rawequal(self[n].obj,obj)then\n"
+  "table.remove(self,n)\n"
+  "return obj\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Heap\n"
+  "";
+
+static const unsigned char data8[] = 
+  "local Object=require\"object\"\n"
+  "\n"
+  "local Queue=Object:new()\n"
+  "\n"
+  "\n"
+  "function Queue:initialize()\n"
+  "\n"
+  "self.a=1\n"
+  "self.b=1\n"
+  "self.q={}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Queue:put(value)\n"
+  "local b,q=self.b,self.q\n"
+  "\n"
+  "q[b]=value\n"
+  "self.b=b+1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Queue:get()\n"
+  "local a,b,q=self.a,self.b,self.q\n"
+  "\n"
+  "if a<b then\n"
+  "local value=q[a]\n"
+  "q[a]=nil\n"
+  "self.a=a+1\n"
+  "return value\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:first()\n"
+  "return self.q[self.a]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:prepend(value)\n"
+  "local a,q=self.a,self.q\n"
+  "\n"
+  "a=a-1\n"
+  "q[a]=value\n"
+  "self.a=a\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:remove(value)\n"
+  "local a,b,q=self.a,self.b,self.q\n"
+  "\n"
+  "\n"
+  "if a<b and q[a]==value then\n"
+  "q[a]=nil\n"
+  "self.a=a+1\n"
+  "return value\n"
+  "end\n"
+  "\n"
+  "for n=a,b-1 do\n"
+  "if value==q[n]then\n"
+  "for i=n,b-2 do\n"
+  "q[i]=q[i+1]\n"
+  "end\n"
+  "q[b-1]=nil\n"
+  "self.b=b-1\n"
+  "return value\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:length()\n"
+  "return self.b-self.a\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Queue\n"
+  "";
+
+static const unsigned char data9[] = 
+  "local Object=require\"object\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local SubStream=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:initialize(parent,readAhead,limit)\n"
+  "self.readAhead=readAhead or\"\"\n"
+  "self.parent=parent\n"
+  "self.limit=limit\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function SubStream:read(amt)\n"
+  "if amt<=0 then\n"
+  "assert(amt==0)\n"
+  "\n"
+  "return\"\"\n"
+  "elseif amt>self.limit then\n"
+  "amt=self.limit\n"
+  "if amt==0 then\n"
+  "\n"
+  "return nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local data,err\n"
+  "local ra=self.readAhead\n"
+  "if ra~=\"\"then\n"
+  "self.readAhead=ra:sub(amt+1)\n"
+  "data=ra:sub(1,amt)\n"
+  "else\n"
+  "data,err=self.parent:read(amt)\n"
+  "end\n"
+  "\n"
+  "if data then\n"
+  "self.limit=self.limit-#data\n"
+  "return data\n"
+  "end\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:drain()\n"
+  "repeat\n"
+  "local data,err=self:read(4096)\n"
+  "if data==nil then\n"
+  "return err\n"
+  "end\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:leftovers()\n"
+  "return self.readAhead:sub(self.limit+1)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function SubStream:readable(task)\n"
+  "if self.readAhead~=\"\"or self.limit==0 then\n"
+  "return task:ready()\n"
+  "end\n"
+  "return self.parent:readable(task)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:close(task)\n"
+  "self.limit=0\n"
+  "self.parent=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return SubStream\n"
+  "";
+
+static const unsigned char data10[] = 
+  "local Object=require\"object\"\n"
+  "local BufIO=require\"bufio\"\n"
+  "local SubStream=require\"substream\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ChunkedStream=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "ChunkedStream.LINEMAX=4096\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:initialize(parent,readAhead)\n"
+  "self.bio=BufIO:new(parent)\n"
+  "self.bio.buf=readAhead or\"\"\n"
+  "self.bio.LINEMAX=self.LINEMAX\n"
+  "self.left=0\n"
+  "self.started=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function nextChunk(self)\n"
+  "local bio=self.bio\n"
+  "local line,err\n"
+  "if self.started then\n"
+  "\n"
+  "line,err=bio:read(\"*l\")\n"
+  "if line~=\"\"then\n"
+  "return nil,err or\"bad chunk\"\n"
+  "end\n"
+  "end\n"
+  "self.started=true\n"
+  "\n"
+  "line,err=bio:read(\"*l\")\n"
+  "local size=line and line:match(\"^%x+\")\n"
+  "if not size then\n"
+  "return nil,err or\"bad chunk\"\n"
+  "end\n"
+  "self.left=tonumber(size,16)\n"
+  "if self.left>0 then\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "repeat\n"
+  "line,err=bio:read(\"*l\")\n"
+  "if not line then\n"
+  "return nil,err or\"bad chunk\"\n"
+  "end\n"
+  "until line==\"\"\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:read(amt)\n"
+  "if self.done then\n"
+  "return nil\n"
+  "elseif amt<=0 then\n"
+  "return\"\"\n"
+  "end\n"
+  "\n"
+  "if self.left==0 then\n"
+  "local last,err=nextChunk(self)\n"
+  "if last==nil then\n"
+  "self.done=true\n"
+  "return nil,err\n"
+  "elseif last then\n"
+  "self.done=true\n"
+  "return nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local data,err=self.bio:read(amt<self.left and amt or self.left)\n"
+  "if not data then\n"
+  "self.done=true\n"
+  "return nil,err or\"truncated\"\n"
+  "end\n"
+  "self.left=self.left-#data\n"
+  "return data\n"
+  "end\n"
+  "\n"
+  "\n"
+  "ChunkedStream.drain=SubStream.drain\n"
+  "\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:leftovers()\n"
+  "return self.bio.buf\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:close()\n"
+  "self.done=true\n"
+  "self.bio.f=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return ChunkedStream\n"
+  "";
+
+static const unsigned char data11[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "\n"
+  "local concat,insert=table.concat,table.insert\n"
+  "\n"
+  "local BufIO=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "BufIO.BUFSIZE=16384\n"
+  "\n"
+  "\n"
+  "BufIO.LINEMAX=math.huge\n"
+  "\n"
+  "\n"
+  "BufIO.ALLMAX=10*1000*1000\n"
+  "\n"
+  "\n"
+  "function BufIO:initialize(f)\n"
+  "self.f=f\n"
+  "self.buf=\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readN(self,amount)\n"
+  "if amount<=0 then\n"
+  "return\"\"\n"
+  "end\n"
+  "\n"
+  "local bytes=self.buf\n"
+  "local err\n"
+  "\n"
+  "while bytes==\"\"do\n"
+  "bytes,err=self.f:read(self.BUFSIZE)\n"
+  "if not bytes then\n"
+  "return nil,err\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self.buf=bytes:sub(amount+1)\n"
+  "return bytes:sub(1,amount)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readAll(self,amount)\n"
+  "local size=0\n"
+  "local all={}\n"
+  "\n"
+  "while amount>size do\n"
+  "local data,err=readN(self,amount-size)\n"
+  "if not data then\n"
+  "if size==0 then\n"
+  "return nil,err\n"
+  "end\n"
+  "break\n"
+  "end\n"
+  "insert(all,data)\n"
+  "size=size+#data\n"
+  "end\n"
+  "\n"
+  "return concat(all)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function readLine(self,retainEnd)\n"
+  "local buf=self.buf\n"
+  "\n"
+  "while true do\n"
+  "local a,b=buf:find(\"\\r\?\\n\")\n"
+  "if a then\n"
+  "self.buf=buf:sub(b+1)\n"
+  "return buf:sub(1,retainEnd and b or a-1)\n"
+  "end\n"
+  "\n"
+  "local more=self.LINEMAX-#buf\n"
+  "if more<=0 then\n"
+  "return nil,\"maximum line length exceeded\"\n"
+  "elseif more>self.BUFSIZE then\n"
+  "more=self.BUFSIZE\n"
+  "end\n"
+  "\n"
+  "local data,err=self.f:read(more)\n"
+  "if not data then\n"
+  "self.buf=buf\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "buf=buf..data\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function BufIO:read(fmt,amount)\n"
+  "if type(fmt)==\"number\"then\n"
+  "return readN(self,fmt)\n"
+  "elseif fmt==\"=\"then\n"
+  "return readAll(self,amount)\n"
+  "elseif fmt==\"*a\"then\n"
+  "local rv,err=readAll(self,self.ALLMAX)\n"
+  "if err then\n"
+  "return nil,err\n"
+  "end\n"
+  "return rv or\"\"\n"
+  "elseif fmt==\"*l\"or fmt==\"*L\"or fmt==nil then\n"
+  "return readLine(self,fmt==\"*L\")\n"
+  "end\n"
+  "\n"
+  "error(\"bad argument to BufIO:read (invalid format)\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function BufIO:write(...)\n"
+  "return self.f:write(...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function BufIO:close()\n"
+  "self.f:close()\n"
+  "end\n"
+  "\n"
+  "return BufIO\n"
+  "";
+
+extern int luaopen_deflate_c(lua_State *);
+
+extern int luaopen_lpeg(lua_State *);
+
+static const unsigned char data12[] = 
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local memoize=require\"memoize\"\n"
+  "local htmlgen=require\"htmlgen\"\n"
+  "local lpeg=require\"lpeg\"\n"
+  "local xuri=require\"xuri\"\n"
+  "\n"
+  "\n"
+  "local function merge(t1,t2)\n"
+  "local t={}\n"
+  "for k,v in pairs(t1)do\n"
+  "t[k]=v\n"
+  "end\n"
+  "for k,v in pairs(t2)do\n"
+  "t[k]=v\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local globToLPEG\n"
+  "do\n"
+  "local P,R,S=lpeg.P,lpeg.R,lpeg.S\n"
+  "local C,Cc,Ct,Cg,Cf=lpeg.C,lpeg.Cc,lpeg.Ct,lpeg.Cg,lpeg.Cf\n"
+  "\n"
+  "local END=P(-1)\n"
+  "local elem=(P(1)-\"/\")^0\n"
+  "\n"
+  "local function captureName(name)\n"
+  "return Cg(elem,name)\n"
+  "end\n"
+  "\n"
+  "local mpName=P\"{\"*(R(\"az\",\"AZ\",\"09\",\"__\")^1/captureName)*\"}\"\n"
+  "local mpSplat=P\"*\"/function()return Cg(elem)end\n"
+  "local mpRaw=P(1)*(P(1)-S\"{*\")^0/P\n"
+  "local mpPath=(mpName+mpSplat+mpRaw)^0\n"
+  "local mpGlob=Cf(mpPath*Cc(END),function(a,b)return a*b end)/Ct\n"
+  "\n"
+  "function globToLPEG(pat)\n"
+  "return mpGlob:match(pat)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function normalize(status,headers,body)\n"
+  "if not status then\n"
+  "print(\"dino.lua warning: no response values returned\")\n"
+  "status=500\n"
+  "end\n"
+  "\n"
+  "if type(status)~=\"number\"then\n"
+  "status,headers,body=200,status,headers\n"
+  "end\n"
+  "\n"
+  "if not body then\n"
+  "headers,body={},headers\n"
+  "end\n"
+  "\n"
+  "if not headers.contentType then\n"
+  "headers=merge(headers,{contentType=\"text/html\"})\n"
+  "end\n"
+  "\n"
+  "if type(body)==\"table\"then\n"
+  "assert(headers.contentType==\"text/html\")\n"
+  "body=htmlgen.generateDoc(body)\n"
+  "end\n"
+  "\n"
+  "return status,headers,body\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ROUTES=\" routes \"\n"
+  "local METHOD=\" method \"\n"
+  "\n"
+  "local function addRoute(self,pattern,fn)\n"
+  "assert(type(pattern)==\"string\",\"dino: route pattern expected string\")\n"
+  "assert(type(fn)==\"function\",\"dino: route handler expected function\")\n"
+  "\n"
+  "local routes=self[ROUTES]\n"
+  "local method=self[METHOD]\n"
+  "local lpat\n"
+  "\n"
+  "if pattern:sub(1,1)~=\"^\"then\n"
+  "lpat=globToLPEG(pattern)\n"
+  "end\n"
+  "\n"
+  "routes[#routes+1]={\n"
+  "method=method,\n"
+  "pattern=pattern,\n"
+  "lpat=lpat,\n"
+  "fn=fn\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "local mtMethod={\n"
+  "__newindex=addRoute,\n"
+  "__call=addRoute\n"
+  "}\n"
+  "\n"
+  "local function newMethod(routes,method)\n"
+  "local me={\n"
+  "[ROUTES]=routes,\n"
+  "[METHOD]=method\n"
+  "}\n"
+  "return setmetatable(me,mtMethod)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function addCond(self,fnTest,fnDo)\n"
+  "if type(fnTest)==\"boolean\"then\n"
+  "local b=fnTest\n"
+  "fnTest=function()return b end\n"
+  "end\n"
+  "\n"
+  "assert(type(fnTest)==\"function\",\"dino: when test expected function\")\n"
+  "assert(type(fnDo)==\"function\",\"dino: when handler expected function\")\n"
+  "\n"
+  "local routes=self[ROUTES]\n"
+  "routes[#routes+1]={\n"
+  "condTest=fnTest,\n"
+  "condDo=fnDo\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "local mtCond={\n"
+  "__newindex=addCond,\n"
+  "__call=addCond\n"
+  "}\n"
+  "\n"
+  "local function newCond(routes)\n"
+  "local me={\n"
+  "[ROUTES]=routes\n"
+  "}\n"
+  "return setmetatable(me,mtCond)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Dino=Object:new()\n"
+  "\n"
+  "function Dino:initialize()\n"
+  "self.routes={}\n"
+  "\n"
+  "local function newm(method)\n"
+  "return newMethod(self.routes,method)\n"
+  "end\n"
+  "self.method=memoize.newTable(newm)\n"
+  "\n"
+  "self.when=newCond(self.routes)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Dino:handle(req)\n"
+  "if req.query then\n"
+  "local turi=xuri.parse(req.query)\n"
+  "req.params=turi.params\n"
+  "end\n"
+  "\n"
+  "local method,path=req.method,req.path\n"
+  "\n"
+  "assert(type(method)==\"string\")\n"
+  "assert(type(path)==\"string\")\n"
+  "\n"
+  "for _,r in ipairs(self.routes)do\n"
+  "if r.condTest then\n"
+  "\n"
+  "if r.condTest(req)then\n"
+  "return r.condDo(req)\n"
+  "end\n"
+  "elseif r.method==method then\n"
+  "\n"
+  "local args\n"
+  "if r.lpat then\n"
+  "local values=r.lpat:match(path)\n"
+  "if values then\n"
+  "args={values,table.unpack(values)}\n"
+  "end\n"
+  "else\n"
+  "local values={string.match(path,r.pattern)}\n"
+  "if values[1]then\n"
+  "args=values\n"
+  "end\n"
+  "end\n"
+  "if args then\n"
+  "return r.fn(req,table.unpack(args))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Dino:__call(req)\n"
+  "return normalize(self:handle(req))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "Dino.globToLPEG=globToLPEG\n"
+  "\n"
+  "\n"
+  "return Dino\n"
+  "";
+
+static const unsigned char data13[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function callTable(t,k)\n"
+  "return t[k]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newTable(f,weak)\n"
+  "local function index(t,k)\n"
+  "local x=f(k)\n"
+  "t[k]=x\n"
+  "return x\n"
+  "end\n"
+  "return setmetatable({},{__mode=weak,__index=index,__call=callTable})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local NIL={}\n"
+  "\n"
+  "local combine=newTable(function(f)\n"
+  "return newTable(function(a)\n"
+  "if a==NIL then a=nil end\n"
+  "return function(...)return f(a,...)end\n"
+  "end)\n"
+  "end)\n"
+  "\n"
+  "local function curry(f,...)\n"
+  "for n=1,select('#',...)do\n"
+  "local v=select(n,...)\n"
+  "f=combine[f][v==nil and NIL or v]\n"
+  "end\n"
+  "return f\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newFunction(f)\n"
+  "local values=newTable(function(f)return table.pack(f())end)\n"
+  "return function(...)\n"
+  "local o=values[curry(f,...)]\n"
+  "return table.unpack(o,1,o.n)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "newTable=newTable,\n"
+  "newFunction=newFunction,\n"
+  "curry=curry\n"
+  "}\n"
+  "";
+
+static const unsigned char data14[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "local E,TYPE=doctree.E,doctree.TYPE\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlSubs={\n"
+  "[\"<\"]=\"&lt;\",\n"
+  "[\">\"]=\"&gt;\",\n"
+  "[\"&\"]=\"&amp;\",\n"
+  "['\"']=\"&quot;\"\n"
+  "}\n"
+  "\n"
+  "local function badUTF8(n)\n"
+  "return 0xFFDD;\n"
+  "end\n"
+  "\n"
+  "local function makeCharRef(ch)\n"
+  "return(\"&#%d;\"):format(utf8utils.decode(ch,badUTF8))\n"
+  "end\n"
+  "\n"
+  "local function luaHtmlEscape(str)\n"
+  "return(str:gsub(\"[<>&]\",htmlSubs):gsub(utf8utils.mbpattern,makeCharRef))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local htmlEscape=succ and textcodec_c.htmlEscape or luaHtmlEscape\n"
+  "\n"
+  "local function htmlEscapeAttr(str)\n"
+  "return(str:gsub('[>&\"]',htmlSubs))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function encodeAttrs(node)\n"
+  "local ta={\"\"}\n"
+  "for k,v in opairs(node or{})do\n"
+  "if v and type(k)==\"string\"and k:sub(1,1)~=\"_\"then\n"
+  "local a=k\n"
+  "if v~=true then\n"
+  "a=k..'=\"'..htmlEscapeAttr(tostring(v))..'\"'\n"
+  "end\n"
+  "insert(ta,a)\n"
+  "end\n"
+  "end\n"
+  "return ta[2]and concat(ta,\" \")or\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsEmpty={\n"
+  "area=true,\n"
+  "base=true,\n"
+  "br=true,\n"
+  "col=true,\n"
+  "hr=true,\n"
+  "img=true,\n"
+  "input=true,\n"
+  "link=true,\n"
+  "meta=true,\n"
+  "param=true,\n"
+  "\n"
+  "command=true,\n"
+  "embed=true,\n"
+  "keygen=true,\n"
+  "source=true,\n"
+  "track=true,\n"
+  "wbr=true,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsBlock={\n"
+  "address=true,\n"
+  "blockquote=true,\n"
+  "\n"
+  "h1=true,\n"
+  "h2=true,\n"
+  "h3=true,\n"
+  "h4=true,\n"
+  "h5=true,\n"
+  "h6=true,\n"
+  "p=true,\n"
+  "\n"
+  "ol=true,\n"
+  "ul=true,\n"
+  "li=true,\n"
+  "hr=true,\n"
+  "html=true,\n"
+  "body=true,\n"
+  "head=true,\n"
+  "meta=true,\n"
+  "style=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local elemIsCDATA={\n"
+  "style=true,\n"
+  "script=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local HTMLGen=Object:new()\n"
+  "\n"
+  "\n"
+  "function HTMLGen:initialize(options)\n"
+  "self.options=options or{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:warn(node,...)\n"
+  "local warn=self.options.warn\n"
+  "if warn then\n"
+  "warn(node,string.format(...))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:append(str)\n"
+  "insert(self.strings,str)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serializeNode(node)\n"
+  "if type(node)==\"string\"then\n"
+  "self:append(htmlEscape(node))\n"
+  "return\n"
+  "elseif type(node)~=\"table\"then\n"
+  "self:warn(\"Unrecognized node type: %s\",type(node))\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local name=node[TYPE]\n"
+  "\n"
+  "if name and name:sub(1,1)==\"_\"then\n"
+  "\n"
+  "\n"
+  "if name==\"_html\"then\n"
+  "for _,chile in ipairs(node)do\n"
+  "self:append(chile)\n"
+  "end\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local o,c=\"\",\"\"\n"
+  "if name then\n"
+  "local nl=(elemIsBlock[name]and not node._whitespace)and\"\\n\"or\"\"\n"
+  "local attrs=encodeAttrs(node)\n"
+  "o=string.format(\"<%s%s>%s\",name,attrs,nl)\n"
+  "if not(elemIsEmpty[name]or node._isEmpty)then\n"
+  "c=string.format(\"%s</%s>\",nl,name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(o)\n"
+  "\n"
+  "if elemIsCDATA[name]then\n"
+  "local text=doctree.treeConcat(node)\n"
+  "if text:match(\"</\")then\n"
+  "self:warn(node,\"Invalid content for CDATA element %s: '</'\",name)\n"
+  "\n"
+  "\n"
+  "text=text:gsub(\"</\",\"<\\\\/\")\n"
+  "end\n"
+  "self:append(text)\n"
+  "else\n"
+  "for _,child in ipairs(node)do\n"
+  "self:serializeNode(child)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(c)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlPreamble=[[\n"
+  "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\" \"http://www.w3.org/TR/html4/loose.dtd\">\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serialize(tree)\n"
+  "assert(self~=HTMLGen)\n"
+  "\n"
+  "self.strings={htmlPreamble}\n"
+  "\n"
+  "self:serializeNode(tree)\n"
+  "self:append(\"\\n\")\n"
+  "return concat(self.strings)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTMLGen:normalize(tree)\n"
+  "local head=E.head{}\n"
+  "local body=E.body{}\n"
+  "local seen={}\n"
+  "local groups={}\n"
+  "\n"
+  "local function appendToHead(child)\n"
+  "if type(child)==\"table\"then\n"
+  "local seenkey=child._once or(child[TYPE]==\"title\"and\"title\")\n"
+  "if seenkey then\n"
+  "if seen[seenkey]then return end\n"
+  "seen[seenkey]=true\n"
+  "end\n"
+  "local group=child._group\n"
+  "if group then\n"
+  "local first=groups[group]\n"
+  "if first then\n"
+  "for _,c in ipairs(child)do\n"
+  "table.insert(first,c)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "first={}\n"
+  "for k,v in pairs(child)do\n"
+  "first[k]=v\n"
+  "end\n"
+  "groups[group]=first\n"
+  "child=first\n"
+  "end\n"
+  "end\n"
+  "table.insert(head,child)\n"
+  "end\n"
+  "\n"
+  "local function visit(node,tbl)\n"
+  "if type(node)~=\"table\"then\n"
+  "table.insert(tbl,node)\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local ty=node[TYPE]\n"
+  "\n"
+  "if ty==\"head\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "appendToHead(child)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local o=tbl\n"
+  "if ty and ty~=\"html\"and ty~=\"body\"then\n"
+  "\n"
+  "o={}\n"
+  "for k,v in pairs(node)do\n"
+  "if type(k)~=\"number\"then\n"
+  "o[k]=v\n"
+  "end\n"
+  "end\n"
+  "table.insert(tbl,o)\n"
+  "end\n"
+  "\n"
+  "for _,child in ipairs(node)do\n"
+  "visit(child,o)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local charset=self.options.charset\n"
+  "if charset~=false then\n"
+  "if type(charset)~=\"string\"then\n"
+  "charset=\"utf-8\"\n"
+  "end\n"
+  "appendToHead(E.meta{[\"http-equiv\"]=\"Content-Type\",\n"
+  "content=\"text/html;charset=\"..charset})\n"
+  "end\n"
+  "\n"
+  "visit(tree,body)\n"
+  "\n"
+  "appendToHead(E.title{})\n"
+  "\n"
+  "return E.html{\n"
+  "head,body\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlgen={}\n"
+  "\n"
+  "function htmlgen.generateDoc(tree,options)\n"
+  "local hg=HTMLGen:new(options)\n"
+  "return hg:serialize(hg:normalize(tree))\n"
+  "end\n"
+  "\n"
+  "function htmlgen.serialize(tree,options)\n"
+  "return HTMLGen:new(options):serialize(tree)\n"
+  "end\n"
+  "\n"
+  "function htmlgen.normalize(tree,options)\n"
+  "return HTMLGen:new(options):normalize(tree)\n"
+  "end\n"
+  "\n"
+  "htmlgen.HTMLGen=HTMLGen\n"
+  "htmlgen._luaHtmlEscape=luaHtmlEscape\n"
+  "htmlgen._htmlEscape=htmlEscape\n"
+  "\n"
+  "return htmlgen\n"
+  "";
+
+static const unsigned char data15[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local char=string.char\n"
+  "local byte=string.byte\n"
+  "local match=string.match\n"
+  "local modf=math.modf\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(n)\n"
+  "if n<=0x7F then\n"
+  "return char(n)\n"
+  "end\n"
+  "if n<=0x7FF then\n"
+  "local a\n"
+  "a,n=modf(n/64)\n"
+  "return char(192+a,128+n*64)\n"
+  "end\n"
+  "if n<=0xFFFF then\n"
+  "local a,b\n"
+  "a,n=modf(n/4096)\n"
+  "b,n=modf(n*64)\n"
+  "return char(224+a,128+b,128+n*64)\n"
+  "end\n"
+  "if n<=0x10FFFF then\n"
+  "local a,b,c\n"
+  "a,n=modf(n/262144)\n"
+  "b,n=modf(n*64)\n"
+  "c,n=modf(n*64)\n"
+  "return char(240+a,128+b,128+c,128+n*64)\n"
+  "end\n"
+  "error(\"utf8: bad argument #1 to 'encode'\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mbpattern=\"[\\128-\\255][\\128-\\191]*\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaDecode(s,ferr)\n"
+  "\n"
+  "local n,min\n"
+  "if match(s,\"^[\\192-\\223][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(byte(s,1)-192)*64+byte(s,2)-128\n"
+  "min=0x80\n"
+  "elseif match(s,\"^[\\224-\\239][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=((byte(s,1)-224)*64+byte(s,2)-128)*64+byte(s,3)-128\n"
+  "min=0x800\n"
+  "elseif match(s,\"^[\\240-\\244][\\128-\\191][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(((byte(s,1)-240)*64+byte(s,2)-128)*64+byte(s,3)-128)*64+byte(s,4)-128\n"
+  "min=0x10000\n"
+  "elseif match(s,\"^[%z\\1-\\127]$\")then\n"
+  "\n"
+  "n=byte(s,1)\n"
+  "min=0\n"
+  "else\n"
+  "n=-1\n"
+  "min=0\n"
+  "end\n"
+  "if n>=min then\n"
+  "return n\n"
+  "end\n"
+  "if(ferr)then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaValidate(str)\n"
+  "for s in str:gmatch(mbpattern)do\n"
+  "luaDecode(s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local decode,validate=luaDecode,luaValidate\n"
+  "\n"
+  "if succ then\n"
+  "local utf8Decode,utf8Check=textcodec_c.utf8Decode,textcodec_c.utf8Check\n"
+  "\n"
+  "function decode(s,ferr)\n"
+  "local n,valid=utf8Decode(s)\n"
+  "if valid then\n"
+  "return n\n"
+  "elseif ferr then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function validate(str)\n"
+  "local a,b=utf8Check(str)\n"
+  "if a then\n"
+  "decode(str:sub(a,b))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gsub=string.gsub\n"
+  "\n"
+  "local function b2c(c)\n"
+  "local n=byte(c)\n"
+  "if n<192 then\n"
+  "return\"\\194\"..c\n"
+  "end\n"
+  "return\"\\195\"..char(n-64)\n"
+  "end\n"
+  "\n"
+  "local function binToChars(str)\n"
+  "return(gsub(str,\"[\\128-\\255]\",b2c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function c2b(s)\n"
+  "return char((byte(s)-194)*64+byte(s,2))\n"
+  "end\n"
+  "\n"
+  "local function charsToBin(str)\n"
+  "return(gsub(str,\"[\\194\\195][\\128-\\255]\",c2b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=encode,\n"
+  "decode=decode,\n"
+  "validate=validate,\n"
+  "mbpattern=mbpattern,\n"
+  "binToChars=binToChars,\n"
+  "charsToBin=charsToBin,\n"
+  "isNative=succ,\n"
+  "\n"
+  "_luaDecode=luaDecode,\n"
+  "_luaValidate=luaValidate,\n"
+  "}\n"
+  "";
+
+static const unsigned char data16[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local memoize=require\"memoize\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local TYPE=\"_type\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local E=memoize.newTable(function(e)return function(t)t._type=e;return t end end)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function treeConcat(tree)\n"
+  "local o={}\n"
+  "\n"
+  "local function fc(node)\n"
+  "if type(node)==\"table\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "fc(child)\n"
+  "end\n"
+  "else\n"
+  "table.insert(o,tostring(node))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "fc(tree)\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function visitElems(node,f,ofType)\n"
+  "if type(node)==\"table\"then\n"
+  "if ofType==node._type or not ofType and type(node._type)==\"string\"then\n"
+  "f(node)\n"
+  "end\n"
+  "for n=1,#node do\n"
+  "visitElems(node[n],f,ofType)\n"
+  "end\n"
+  "end\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "E=E,\n"
+  "TYPE=TYPE,\n"
+  "treeConcat=treeConcat,\n"
+  "visitElems=visitElems\n"
+  "}\n"
+  "";
+
+static const unsigned char data17[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function defaultCmp(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local function opairs(tbl,cmp)\n"
+  "local keys={}\n"
+  "for k in pairs(tbl)do\n"
+  "keys[#keys+1]=k\n"
+  "end\n"
+  "table.sort(keys,cmp or defaultCmp)\n"
+  "\n"
+  "local n=1\n"
+  "\n"
+  "return function()\n"
+  "local k=keys[n]\n"
+  "if k~=nil then\n"
+  "n=n+1\n"
+  "return k,tbl[k]\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return opairs\n"
+  "";
+
+static const unsigned char data18[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local doctree=require\"doctree\"\n"
+  "local HTMLGen=require\"htmlgen\"\n"
+  "\n"
+  "local E=doctree.E\n"
+  "\n"
+  "local css=[[\n"
+  "body { font: 12pt \"Helvetica\", \"Arial\", sans-serif; }\n"
+  ".pre { white-space: pre; font: 11pt \"Lucida Console\", \"Courier\", monospace; }\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "local function wrap(handler)\n"
+  "local function wrapper(request)\n"
+  "local succ,a,b,c=xpcall(handler,debug.traceback,request)\n"
+  "if succ then\n"
+  "return a,b,c\n"
+  "end\n"
+  "\n"
+  "local body=HTMLGen.generateDoc{\n"
+  "E.head{\n"
+  "E.title{\"Error in Handler\"},\n"
+  "E.style{css}\n"
+  "},\n"
+  "E.body{\n"
+  "E.h2{\"Error in Handler\"},\n"
+  "E.div{\n"
+  "class=\"pre\",\n"
+  "a\n"
+  "}\n"
+  "}\n"
+  "}\n"
+  "io.write(a)\n"
+  "\n"
+  "return 501,{contentType=\"text/html\"},body\n"
+  "end\n"
+  "\n"
+  "return wrapper\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "wrap=wrap\n"
+  "}\n"
+  "";
+
+static const unsigned char data19[] = 
+  "\n"
+  "\n"
+  "local function wrap(handler)\n"
+  "\n"
+  "local function wrapper(request)\n"
+  "print(request.method..\" \"..request.path)\n"
+  "local r=table.pack(handler(request))\n"
+  "print(request.method..\" \"..request.path..\" -> \"..\n"
+  "tostring(r[1])..\" \"..\n"
+  "(type(r[3])==\"string\"and#r[3]or\"\?\"))\n"
+  "return table.unpack(r)\n"
+  "end\n"
+  "return wrapper\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "wrap=wrap\n"
+  "}"
+  "";
+
+static const unsigned char data20[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local thread=require\"thread\"\n"
+  "local xpio=require\"xpio\"\n"
+  "local Event=require\"event\"\n"
+  "local mdbser=require\"mdbser\"\n"
+  "\n"
+  "local futex=require\"futex\"\n"
+  "local O=require\"observable\"\n"
+  "\n"
+  "local Target=Object:new()\n"
+  "\n"
+  "\n"
+  "local READSIZE=65536\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Target:initialize(command,oBreak)\n"
+  "self.command=command\n"
+  "self.oBreak=oBreak\n"
+  "self.log=O.Log:new()\n"
+  "self.status=O.Slot:new()\n"
+  "self.busy=O.Slot:new()\n"
+  "self.ovalues=setmetatable({},{__mode=\"v\"})\n"
+  "\n"
+  "oBreak:subscribe(self)\n"
+  "\n"
+  "self:start()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:start()\n"
+  "\n"
+  "local ctl,ctlChild=xpio.socketpair()\n"
+  "\n"
+  "local fds={[0]=0,1,2,ctlChild}\n"
+  "local env=xpio.env\n"
+  "env.mdbFD=\"3\"\n"
+  "\n"
+  "self.proc=xpio.spawn(self.command,env,fds,{})\n"
+  "self.ctl=ctl\n"
+  "self.reader=thread.new(self.readLoop,self,self.ctl)\n"
+  "self.log:append(\"SStarting target process\")\n"
+  "\n"
+  "\n"
+  "\n"
+  "self.status:set(\"start\")\n"
+  "self.pending=0\n"
+  "self.busy:set(false)\n"
+  "self:send(\"bp\",self.oBreak:get())\n"
+  "for _,tv in pairs(self.ovalues)do\n"
+  "if tv:isSubscribed()then\n"
+  "tv:onOff(true)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:shutdown()\n"
+  "local proc,ctl,reader=self.proc,self.ctl,self.reader\n"
+  "if not proc then\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "self.proc,self.ctl,self.reader=nil,nil,nil\n"
+  "\n"
+  "proc:kill()\n"
+  "proc:wait()\n"
+  "\n"
+  "ctl:close()\n"
+  "\n"
+  "if reader~=xpio.getCurrentTask()then\n"
+  "thread.join(reader)\n"
+  "end\n"
+  "\n"
+  "self.status:set(\"exit\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Target:readLoop(ctl)\n"
+  "local partial={}\n"
+  "while true do\n"
+  "local data=ctl:read(READSIZE)\n"
+  "if not data then\n"
+  "if partial[1]then\n"
+  "print(\"Target:readLoop: incomplete message at end of stream '\"\n"
+  "..table.concat(partial):sub(1,40)..\"'\")\n"
+  "end\n"
+  "self:handleMessage(\"exit\")\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local pos=1\n"
+  "while true do\n"
+  "local nl=data:find(\"\\n\",pos,true)\n"
+  "if not nl then\n"
+  "break\n"
+  "end\n"
+  "local msg=data:sub(pos,nl-1)\n"
+  "if partial[1]then\n"
+  "partial[#partial+1]=msg\n"
+  "msg=table.concat(partial)\n"
+  "partial={}\n"
+  "end\n"
+  "if self:handleMessage(msg)then\n"
+  "return\n"
+  "end\n"
+  "pos=nl+1\n"
+  "end\n"
+  "if pos<=#data then\n"
+  "partial[#partial+1]=data:sub(pos)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Target:handleMessage(msg)\n"
+  "local id,body=msg:match(\"^([^ ]*) \?(.*)\")\n"
+  "if id==\"ack\"then\n"
+  "self.pending=self.pending-1\n"
+  "if self.pending==0 then\n"
+  "self.busy:set(false)\n"
+  "end\n"
+  "elseif id==\"exit\"then\n"
+  "self:shutdown()\n"
+  "return true\n"
+  "elseif id==\"log\"then\n"
+  "self.log:append(mdbser.decode(body))\n"
+  "elseif(id==\"pause\"or\n"
+  "id==\"run\")then\n"
+  "self.status:set(id)\n"
+  "elseif id==\"set\"then\n"
+  "local name,value=mdbser.decode(body)\n"
+  "local ob=self.ovalues[name]\n"
+  "if ob then\n"
+  "ob:set(value)\n"
+  "end\n"
+  "else\n"
+  "print(\"Target:readLoop: unrecognized message '\"..id..\"'\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Target:send(id,...)\n"
+  "self.pending=self.pending+1\n"
+  "if self.pending==1 then\n"
+  "self.busy:set(xpio.gettime())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "if self.ctl then\n"
+  "local lock=futex.lock(self.ctl)\n"
+  "self.ctl:write(id..\" \"..mdbser.encode(...)..\"\\n\")\n"
+  "futex.unlock(self.ctl)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Target:invalidate(ob)\n"
+  "self:send(\"bp\",ob:get())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local TargetValue=O.Slot:basicNew()\n"
+  "\n"
+  "\n"
+  "function TargetValue:initialize(target,name)\n"
+  "O.Slot.initialize(self)\n"
+  "self.name=name\n"
+  "self.target=target\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function TargetValue:onOff(isOn)\n"
+  "if isOn then\n"
+  "self.target:send(\"sub\",self.name)\n"
+  "else\n"
+  "self.target:send(\"unsub\",self.name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Target:run(limit)\n"
+  "self:send(\"run\",limit)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:pause()\n"
+  "self:send(\"pause\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:observe(name)\n"
+  "local tv=self.ovalues[name]\n"
+  "if not tv then\n"
+  "tv=TargetValue:new(self,name)\n"
+  "self.ovalues[name]=tv\n"
+  "end\n"
+  "return tv\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:eval(command)\n"
+  "self:send(\"eval\",command)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:restart()\n"
+  "self:shutdown()\n"
+  "self:start()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Target:close()\n"
+  "self:shutdown()\n"
+  "self.oBreak:unsubscribe(self)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Target\n"
+  "";
+
+static const unsigned char data21[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local xpio=require\"xpio\"\n"
+  "\n"
+  "local yield=coroutine.yield\n"
+  "\n"
+  "local Event=Object:new()\n"
+  "\n"
+  "\n"
+  "function Event:initialize()\n"
+  "self.a=1\n"
+  "self.b=1\n"
+  "self.waiting=0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function reset(evt)\n"
+  "for n=evt.a,evt.b-1 do\n"
+  "evt[n]=nil\n"
+  "end\n"
+  "evt.a=1\n"
+  "evt.b=1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function dqEvent(task)\n"
+  "local evt,ndx=task._dequeuedata,task._eventIndex\n"
+  "task._dequeue=nil\n"
+  "task._dequeuedata=nil\n"
+  "task._eventIndex=nil\n"
+  "\n"
+  "evt[ndx]=false\n"
+  "evt.waiting=evt.waiting-1\n"
+  "\n"
+  "if evt.waiting==0 then\n"
+  "reset(evt)\n"
+  "elseif ndx==evt.b-1 then\n"
+  "evt[ndx]=nil\n"
+  "evt.b=ndx\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Event:when(task)\n"
+  "assert(not task._dequeue)\n"
+  "local b=self.b\n"
+  "self[b]=task\n"
+  "self.b=b+1\n"
+  "self.waiting=self.waiting+1\n"
+  "task._dequeue=dqEvent\n"
+  "task._dequeuedata=self\n"
+  "task._eventIndex=b\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Event:wait()\n"
+  "local task=xpio.getCurrentTask()\n"
+  "self:when(task)\n"
+  "yield()\n"
+  "return task.value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Event:signal(count,value)\n"
+  "if self.waiting==0 then\n"
+  "return 0\n"
+  "end\n"
+  "count=count or self.waiting\n"
+  "local n=0\n"
+  "\n"
+  "while n<count and self.waiting>0 do\n"
+  "local a=self.a\n"
+  "local task=self[a]\n"
+  "self[a]=nil\n"
+  "self.a=a+1\n"
+  "if task then\n"
+  "n=n+1\n"
+  "self.waiting=self.waiting-1\n"
+  "task._dequeue=nil\n"
+  "task._dequeuedata=nil\n"
+  "task._eventIndex=nil\n"
+  "task.value=value\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "if self.waiting==0 then\n"
+  "reset(self)\n"
+  "end\n"
+  "return n\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Event\n"
+  "";
+
+static const unsigned char data22[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local rtrequire=require\n"
+  "local succ,mdbser_c=pcall(rtrequire,\"mdbser_c\")\n"
+  "if not succ then\n"
+  "mdbser_c=nil\n"
+  "end\n"
+  "\n"
+  "local byte,char=string.byte,string.char\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "\n"
+  "local ESC=char(128)\n"
+  "\n"
+  "\n"
+  "local function escape(c)\n"
+  "return ESC..char(64+byte(c))\n"
+  "end\n"
+  "\n"
+  "local function unescape(cc)\n"
+  "return char(byte(cc,2)-64)\n"
+  "end\n"
+  "\n"
+  "local function shift(c)\n"
+  "return char(byte(c)+1)\n"
+  "end\n"
+  "\n"
+  "local function unshift(c)\n"
+  "return char(byte(c)-1)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function demote(str)\n"
+  "return(str:gsub('[ \\r\\n\\128\\191]',escape):gsub('[\\128-\\190]',shift))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function promote(str)\n"
+  "return(str:gsub('[\\129-\\191]',unshift):gsub('\\128.',unescape))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encodeValue(value)\n"
+  "local typ=type(value)\n"
+  "\n"
+  "if typ==\"string\"then\n"
+  "return's'..demote(value)\n"
+  "elseif typ==\"boolean\"then\n"
+  "return value and't'or'f'\n"
+  "elseif typ==\"number\"then\n"
+  "return'n'..tostring(value)\n"
+  "elseif typ==\"table\"then\n"
+  "local o={'m'}\n"
+  "for k,v in pairs(value)do\n"
+  "insert(o,encodeValue(k))\n"
+  "insert(o,encodeValue(v))\n"
+  "end\n"
+  "return demote(concat(o,' '))\n"
+  "else\n"
+  "return'x'\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function decodeValue(str)\n"
+  "local ty=str:sub(1,1)\n"
+  "\n"
+  "if ty=='s'then\n"
+  "return promote(str:sub(2))\n"
+  "elseif ty=='n'then\n"
+  "return tonumber(str:sub(2))\n"
+  "elseif str=='t'then\n"
+  "return true\n"
+  "elseif str=='f'then\n"
+  "return false\n"
+  "elseif ty=='m'then\n"
+  "local t={}\n"
+  "for ekey,eval in promote(str):gmatch(\" ([^ ]*) ([^ ]*)\")do\n"
+  "t[decodeValue(ekey)]=decodeValue(eval)\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(...)\n"
+  "local o={}\n"
+  "for n=1,select('#',...)do\n"
+  "o[#o+1]=encodeValue(select(n,...))\n"
+  "end\n"
+  "return table.concat(o,\" \")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function decode(str,pos)\n"
+  "local word,pnext=str:match('([^ ]+)()',pos or 1)\n"
+  "if word then\n"
+  "return decodeValue(word),decode(str,pnext)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=mdbser_c and mdbser_c.encode or encode,\n"
+  "decode=mdbser_c and mdbser_c.decode or decode,\n"
+  "isNative=mdbser_c and true or false,\n"
+  "\n"
+  "_luaEncode=encode,\n"
+  "_luaDecode=decode,\n"
+  "}\n"
+  "";
+
+static const unsigned char data23[] = 
+  "\n"
+  "\n"
+  "\n"
+  "local Event=require\"event\"\n"
+  "\n"
+  "\n"
+  "local locks={}\n"
+  "\n"
+  "\n"
+  "local function lock(value)\n"
+  "local held=locks[value]\n"
+  "if not held then\n"
+  "locks[value]=true\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "if held==true then\n"
+  "held=Event:new()\n"
+  "locks[value]=held\n"
+  "end\n"
+  "\n"
+  "held:wait()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function unlock(value)\n"
+  "local held=locks[value]\n"
+  "if held==true or held:signal(1)==0 then\n"
+  "locks[value]=nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "lock=lock,\n"
+  "unlock=unlock\n"
+  "}\n"
+  "";
+
+static const unsigned char data24[] = 
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Observable=Object:new()\n"
+  "\n"
+  "\n"
+  "function Observable:initialize()\n"
+  "self.subscribers={}\n"
+  "self.valid=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Observable:invalidate()\n"
+  "if self.valid then\n"
+  "for sub in pairs(self.subscribers)do\n"
+  "sub:invalidate(self)\n"
+  "end\n"
+  "self.valid=false\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Observable:subscribe(sub)\n"
+  "local subs=self.subscribers\n"
+  "local wasEmpty=not next(subs)\n"
+  "subs[sub]=(subs[sub]or 0)+1\n"
+  "\n"
+  "if wasEmpty then\n"
+  "self:onOff(true)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Observable:unsubscribe(sub)\n"
+  "local subs=self.subscribers\n"
+  "local count=subs[sub]or 0\n"
+  "subs[sub]=count>1 and count-1 or nil\n"
+  "\n"
+  "if not next(subs)then\n"
+  "self:onOff(false)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Observable:isSubscribed()\n"
+  "return next(self.subscribers)~=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Observable:onOff()\n"
+  "\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Observable:hasInstance(obj)\n"
+  "while type(obj)==\"table\"do\n"
+  "if obj==self then\n"
+  "return true\n"
+  "end\n"
+  "obj=getmetatable(obj)\n"
+  "obj=obj and obj.__index\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Slot=Observable:new()\n"
+  "\n"
+  "\n"
+  "function Slot:initialize(value)\n"
+  "Observable.initialize(self)\n"
+  "self.value=value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Slot:set(v)\n"
+  "if v~=self.value then\n"
+  "self.value=v\n"
+  "self:invalidate()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Slot:get(v)\n"
+  "if self.valid~=true then\n"
+  "if self.valid==nil then\n"
+  "error(\"Slot:get() called during invalidation\")\n"
+  "end\n"
+  "self.valid=true\n"
+  "end\n"
+  "return self.value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Func=Observable:new()\n"
+  "\n"
+  "\n"
+  "function Func:initialize(fn,...)\n"
+  "Observable.initialize(self)\n"
+  "self.fn=fn\n"
+  "self.inputs=table.pack(...)\n"
+  "self.obInputs={}\n"
+  "\n"
+  "for argn,o in ipairs(self.inputs)do\n"
+  "if Observable:hasInstance(o)then\n"
+  "self.obInputs[argn]=o\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Func:get()\n"
+  "if not self.valid then\n"
+  "local inputs=self.inputs\n"
+  "for argn,o in pairs(self.obInputs)do\n"
+  "inputs[argn]=o:get()\n"
+  "end\n"
+  "self.valid=true\n"
+  "self.value=self.fn(table.unpack(inputs,1,#inputs))\n"
+  "end\n"
+  "return self.value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Func:onOff(isOn)\n"
+  "for _,o in pairs(self.obInputs)do\n"
+  "if isOn then\n"
+  "o:subscribe(self)\n"
+  "else\n"
+  "o:unsubscribe(self)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "self.valid=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Log=Slot:basicNew()\n"
+  "\n"
+  "\n"
+  "function Log:initialize()\n"
+  "Slot.initialize(self)\n"
+  "self:clear()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Log:append(item)\n"
+  "local v=self.value\n"
+  "local a,len=v.a,v.len+1\n"
+  "a[len]=item\n"
+  "self:set{a=a,len=len}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Log:clear()\n"
+  "self:set{a={},len=0}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "Slot=Slot,\n"
+  "Func=Func,\n"
+  "Log=Log,\n"
+  "Observable=Observable\n"
+  "}\n"
+  "";
+
+extern int luaopen_mdbser_c(lua_State *);
+
+static const unsigned char data25[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseOpts(o)\n"
+  "local opts={}\n"
+  "local f\n"
+  "if type(o)==\"string\"then\n"
+  "f=o:gmatch(\"([^%s]+)%s*\")\n"
+  "else\n"
+  "local n=0\n"
+  "function f()n=n+1;return o[n]end\n"
+  "end\n"
+  "for desc in f do\n"
+  "local names,type=desc:match(\"([^:=]*)(:\?=\?%*\?)\")\n"
+  "assert(names)\n"
+  "local name=names:match(\"-*([^/]*)\")\n"
+  "for opt in names:gmatch(\"([^/]+)/\?\")do\n"
+  "opts[opt]={name=name,type=type}\n"
+  "end\n"
+  "end\n"
+  "return opts\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function read(args,o,errhandler)\n"
+  "local opts=parseOpts(o)\n"
+  "local words,values={},{}\n"
+  "local errfn=(type(errhandler)==\"function\"and errhandler or\n"
+  "function(msg)error((errhandler or\"getopts\")..\": \"..msg)end)\n"
+  "\n"
+  "local argndx=0\n"
+  "local function nextArg()\n"
+  "argndx=argndx+1\n"
+  "return args[argndx]\n"
+  "end\n"
+  "\n"
+  "for a in nextArg do\n"
+  "local opt,optarg=a:match(\"^(%-%-[^=]*)=(.*)\")\n"
+  "if not opt then\n"
+  "opt,optarg=a:match(\"^(%-.*)\"),false\n"
+  "end\n"
+  "if not opt then\n"
+  "table.insert(words,a)\n"
+  "else\n"
+  "local o=opts[opt]\n"
+  "if o then\n"
+  "local v=values[o.name]\n"
+  "if o.type~=\"\"then\n"
+  "\n"
+  "optarg=optarg or nextArg()\n"
+  "if not optarg then\n"
+  "local e={errfn(\"Missing argument to \"..opt,opt)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "if o.type:match(\"%*\")then\n"
+  "v=v or{}\n"
+  "values[o.name]=v\n"
+  "table.insert(v,optarg)\n"
+  "elseif not v then\n"
+  "values[o.name]=optarg\n"
+  "else\n"
+  "local e={errfn(\"Argument repeated: \"..opt,opt)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "else\n"
+  "\n"
+  "values[o.name]=(v or 0)+1\n"
+  "end\n"
+  "elseif opt==\"--\"then\n"
+  "\n"
+  "for a in nextArg do\n"
+  "table.insert(words,a)\n"
+  "end\n"
+  "break\n"
+  "else\n"
+  "local e={errfn(\"Unrecognized option: \"..a,a)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return words,values\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local G={}\n"
+  "G.parseOpts=parseOpts\n"
+  "G.read=read\n"
+  "return G\n"
+  "";
+
+static const unsigned char data26[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "\n"
+  "local match,byte=string.match,string.byte\n"
+  "\n"
+  "local json={}\n"
+  "\n"
+  "\n"
+  "json.null=function()end\n"
+  "\n"
+  "\n"
+  "local mtArray={\n"
+  "__index=table\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "function json.makeArray(t)\n"
+  "setmetatable(t,mtArray)\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function json.isArray(t)\n"
+  "return type(t)==\"table\"and(t[1]or getmetatable(t)and getmetatable(t).__index)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local escapeChar={\n"
+  "[\"\\\"\"]=\"\\\\\\\"\",\n"
+  "[\"\\\\\"]=\"\\\\\\\\\",\n"
+  "[\"\\n\"]=\"\\\\n\",\n"
+  "[\"\\r\"]=\"\\\\r\",\n"
+  "[\"\\t\"]=\"\\\\t\",\n"
+  "[\"\\f\"]=\"\\\\f\",\n"
+  "[\"\\b\"]=\"\\\\b\",\n"
+  "}\n"
+  "function escapeChar:__index(k)\n"
+  "local s=string.format(\"\\\\u%04x\",byte(k))\n"
+  "self[k]=s\n"
+  "return s\n"
+  "end\n"
+  "setmetatable(escapeChar,escapeChar)\n"
+  "\n"
+  "\n"
+  "local nlstr=\"\"\n"
+  "local encodeKey\n"
+  "\n"
+  "\n"
+  "local function encode(x)\n"
+  "if type(x)==\"string\"then\n"
+  "return'\"'..x:gsub('[%c\\\\\"]',escapeChar)..'\"'\n"
+  "elseif type(x)==\"boolean\"or type(x)==\"number\"then\n"
+  "return tostring(x)\n"
+  "elseif type(x)==\"table\"then\n"
+  "local res={\"\"}\n"
+  "local b1,b2='{','}'\n"
+  "if json.isArray(x)then\n"
+  "b1,b2='[',']'\n"
+  "for _,v in ipairs(x)do\n"
+  "table.insert(res,encode(v))\n"
+  "end\n"
+  "else\n"
+  "for k,v in pairs(x)do\n"
+  "if type(k)==\"string\"then\n"
+  "table.insert(res,encodeKey(k)..\":\"..encode(v))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "local str=table.concat(res,\",\"..nlstr)\n"
+  "return b1..str:sub(2)..nlstr..b2\n"
+  "else\n"
+  "return\"null\"\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function jsEncodeKey(k)\n"
+  "return match(k,\"^[%a_][%w_]*$\")and k or encode(k)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function json.encode(v,mode)\n"
+  "mode=mode or\"\"\n"
+  "nlstr=mode:find(\"n\")and\"\\n\"or\"\"\n"
+  "encodeKey=mode:find(\"j\")and jsEncodeKey or encode\n"
+  "return encode(v)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local unescapeChar={\n"
+  "[byte\"\\\"\"]=\"\\\"\",\n"
+  "[byte\"\\\\\"]=\"\\\\\",\n"
+  "[byte\"/\"]=\"/\",\n"
+  "[byte\"n\"]=\"\\n\",\n"
+  "[byte\"r\"]=\"\\r\",\n"
+  "[byte\"t\"]=\"\\t\",\n"
+  "[byte\"f\"]=\"\\f\",\n"
+  "[byte\"b\"]=\"\\b\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local decodeValues={\n"
+  "[\"null\"]=json.null,\n"
+  "[\"true\"]=true,\n"
+  "[\"false\"]=false,\n"
+  "}\n"
+  "setmetatable(decodeValues,{__index=function(t,k)return tonumber(k)end})\n"
+  "\n"
+  "\n"
+  "local function decodeError(pos,expected)\n"
+  "error(\"Expected \"..expected..\" at offset \"..pos,2)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function makeDecodeFrom(str,err,...)\n"
+  "decodeValues.null=select('#',...)==0 and json.null or(...)\n"
+  "\n"
+  "err=err or decodeError\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function decodeFrom(start)\n"
+  "\n"
+  "\n"
+  "\n"
+  "local v,d,c,n=match(str,'^[ \\t\\n\\r]*\"([^\\\\\"]*)(\"\?)[ \\t\\n\\r]*(.\?)()',start)\n"
+  "if v then\n"
+  "if d=='\"'then return v,c,n end\n"
+  "while c=='\\\\'do\n"
+  "c=unescapeChar[byte(str,n)]\n"
+  "if c then\n"
+  "v=v..c\n"
+  "n=n+1\n"
+  "else\n"
+  "local u=match(str,\"^u(%x%x%x%x)\",n)\n"
+  "if u then\n"
+  "v=v..utf8utils.encode(tonumber(u,16))\n"
+  "n=n+5\n"
+  "else\n"
+  "err(n-1,\"valid escape sequence\")\n"
+  "end\n"
+  "end\n"
+  "local txt\n"
+  "txt,d,c,n=match(str,'([^\\\\\"]*)(\"\?)[ \\t\\n\\r]*(.\?)()',n)\n"
+  "v=v..txt\n"
+  "if d=='\"'then\n"
+  "return v,c,n\n"
+  "end\n"
+  "end\n"
+  "err(n,\"end of string\")\n"
+  "end\n"
+  "\n"
+  "local v,c,n=match(str,\"^[ \\t\\n\\r]*([%[{]\?)[ \\t\\n\\r]*(.\?)()\",start)\n"
+  "if v~=\"\"then\n"
+  "local elem\n"
+  "if v=='{'then\n"
+  "\n"
+  "\n"
+  "\n"
+  "v={}\n"
+  "if c~='}'then\n"
+  "local key,nkey,n2\n"
+  "n=n-1\n"
+  "repeat\n"
+  "nkey=n\n"
+  "\n"
+  "key,n=match(str,'^[ \\t\\n\\r]*\"([^\\\\\"]*)\"[ \\t\\n\\r]*:()',n)\n"
+  "if not key then\n"
+  "\n"
+  "key,c,n=decodeFrom(nkey)\n"
+  "if type(key)~=\"string\"then err(nkey,'string')end\n"
+  "if c~=':'then err(n-1,':')end\n"
+  "end\n"
+  "elem,c,n=decodeFrom(n)\n"
+  "v[key]=elem\n"
+  "until c~=','\n"
+  "if c~='}'then err(n-1,', or }')end\n"
+  "end\n"
+  "\n"
+  "else\n"
+  "\n"
+  "\n"
+  "\n"
+  "v=json.makeArray{}\n"
+  "local index=1\n"
+  "if c~=']'then\n"
+  "n=n-1\n"
+  "repeat\n"
+  "elem,c,n=decodeFrom(n)\n"
+  "v[index]=elem\n"
+  "index=index+1\n"
+  "until c~=','\n"
+  "if c~=']'then err(n-1,', or ]')end\n"
+  "end\n"
+  "end\n"
+  "return v,match(str,\"^[ \\t\\n\\r]*(.\?)()\",n)\n"
+  "\n"
+  "else\n"
+  "\n"
+  "\n"
+  "\n"
+  "local tok\n"
+  "tok,c,n=match(str,\"^([^ \\t\\n\\r,:%]}]*)[ \\t\\n\\r]*(.\?)()\",n-1)\n"
+  "v=decodeValues[tok]\n"
+  "if v~=nil or tok==\"null\"then\n"
+  "return v,c,n\n"
+  "end\n"
+  "err(start,\"value\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return decodeFrom\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function json.decode(str,...)\n"
+  "local function err(pos,expected)\n"
+  "error(\"Expected \"..expected..\" at offset \"..pos,0)\n"
+  "end\n"
+  "\n"
+  "local decodeFrom=makeDecodeFrom(str,err,...)\n"
+  "local succ,v,c,n=pcall(decodeFrom,1)\n"
+  "\n"
+  "if not succ then\n"
+  "return nil,v\n"
+  "end\n"
+  "\n"
+  "if c and c~=\"\"then\n"
+  "return nil,\"Extraneous data at offset \"..n\n"
+  "end\n"
+  "return v\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function json.decodeAt(str,n,...)\n"
+  "return makeDecodeFrom(str,decodeError,...)(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function json.toAscii(str)\n"
+  "local function esc(s)\n"
+  "return\"\\\\u\"..string.format(\"%04x\",utf8utils.decode(s))\n"
+  "end\n"
+  "return(str:gsub(utf8utils.mbpattern,esc))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "json.asciify=json.toAscii\n"
+  "\n"
+  "\n"
+  "return json\n"
+  "";
+
+extern int luaopen_requirefile(lua_State *);
+
+static const unsigned char data27[] = 
+  "\n"
+  "local dbgFlags=os.getenv(\"FARF\")or\"\"\n"
+  "\n"
+  "local function farf(pattern,fmt,...)\n"
+  "if dbgFlags:match(pattern)then\n"
+  "if fmt then\n"
+  "io.stderr:write(string.format(fmt..\"\\n\",...))\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function nada()\n"
+  "end\n"
+  "\n"
+  "return dbgFlags==\"\"and nada or farf\n"
+  "";
+
+static const unsigned char data28[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Event=require\"event\"\n"
+  "local Object=require\"object\"\n"
+  "local thread=require\"thread\"\n"
+  "local json=require\"json\"\n"
+  "local Queue=require\"queue\"\n"
+  "local xpio=require\"xpio\"\n"
+  "\n"
+  "\n"
+  "local clone=require(\"list\").clone\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ERROR_PARSE=400\n"
+  "local ERROR_CANCEL=409\n"
+  "local ERROR_BADID=410\n"
+  "local ERROR_INTERNAL=500\n"
+  "\n"
+  "\n"
+  "\n"
+  "local NOT_FOUND={error=\"unk\"}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local NOT_FOUND_RECORD={value=NOT_FOUND,version=-1}\n"
+  "\n"
+  "\n"
+  "local ADDED={version=0}\n"
+  "\n"
+  "\n"
+  "local function encodeRecord(rec)\n"
+  "local js=rec.json\n"
+  "if not js then\n"
+  "js=json.encode(rec.value)\n"
+  "rec.json=js\n"
+  "end\n"
+  "return js\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local jsonHeaders={\n"
+  "contentType=\"application/json\"\n"
+  "}\n"
+  "\n"
+  "local streamHeaders={\n"
+  "contentType=\"application/x-oweb-stream\",\n"
+  "cacheControl=\"no-cache\"\n"
+  "}\n"
+  "\n"
+  "local function readAll(s)\n"
+  "local o={}\n"
+  "while true do\n"
+  "local data=s:read(15000)\n"
+  "if not data then break end\n"
+  "o[#o+1]=data\n"
+  "end\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Port=Object:new()\n"
+  "\n"
+  "\n"
+  "function Port:initialize(group)\n"
+  "self.group=group\n"
+  "self.entries=0\n"
+  "self.tIdle=nil\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "self.respID=nil\n"
+  "self.respValues={}\n"
+  "\n"
+  "\n"
+  "self.ackID=nil\n"
+  "self.ackValues={}\n"
+  "\n"
+  "\n"
+  "self.subscribed={}\n"
+  "self.event=Event:new()\n"
+  "self.isWaiting=false\n"
+  "\n"
+  "\n"
+  "self.generation=0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Port:discard()\n"
+  "for name,ob in pairs(self.subscribed)do\n"
+  "self.group:unwatch(name,ob,self)\n"
+  "end\n"
+  "self.subscribed={}\n"
+  "\n"
+  "self.group:discardID(self.ackID)\n"
+  "self.group:discardID(self.respID)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Port:invalidate(ob)\n"
+  "self.event:signal()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Port:observe(name)\n"
+  "local ob\n"
+  "if type(name)==\"string\"then\n"
+  "ob=self.subscribed[name]\n"
+  "if not ob then\n"
+  "ob=self.group.observables[name]\n"
+  "if ob then\n"
+  "self.subscribed[name]=ob\n"
+  "self.group:watch(name,ob,self)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return ob\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Port:poll(req)\n"
+  "self.generation=self.generation+1\n"
+  "\n"
+  "if req.id==self.respID then\n"
+  "\n"
+  "self.group:discardID(self.ackID)\n"
+  "self.ackID=req.id\n"
+  "self.ackValues=self.respValues\n"
+  "elseif req.id==self.ackID then\n"
+  "self.group:discardID(self.respID)\n"
+  "else\n"
+  "return ERROR_INTERNAL\n"
+  "end\n"
+  "\n"
+  "\n"
+  "self.respID=nil\n"
+  "self.respValues={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local adds=type(req.add)==\"table\"and req.add or{}\n"
+  "local removes=type(req.remove)==\"table\"and req.remove or{}\n"
+  "\n"
+  "local values=clone(self.ackValues)\n"
+  "for _,name in ipairs(removes)do\n"
+  "values[name]=nil\n"
+  "end\n"
+  "for _,name in ipairs(adds)do\n"
+  "if values[name]==nil then\n"
+  "values[name]=ADDED\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for name,ob in pairs(self.subscribed)do\n"
+  "if values[name]==nil and self.ackValues[name]==nil then\n"
+  "self.group:unwatch(name,ob,self)\n"
+  "self.subscribed[name]=nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "while self.isWaiting do\n"
+  "self.event:signal(nil,\"cancel\")\n"
+  "thread.yield()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local changed={}\n"
+  "\n"
+  "while true do\n"
+  "\n"
+  "\n"
+  "for name,oldRec in pairs(values)do\n"
+  "local rec=self.group:getRecord(name,self:observe(name))\n"
+  "if rec.version~=oldRec.version then\n"
+  "changed[name]=rec\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if next(changed)or removes[1]then break end\n"
+  "\n"
+  "self.isWaiting=true\n"
+  "local cancel=self.event:wait()\n"
+  "self.isWaiting=false\n"
+  "\n"
+  "if cancel==\"cancel\"then\n"
+  "return ERROR_CANCEL\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for name,rec in pairs(changed)do\n"
+  "values[name]=rec\n"
+  "end\n"
+  "\n"
+  "self.respID=self.group:getID(self)\n"
+  "self.respValues=values\n"
+  "\n"
+  "return{\n"
+  "id=self.respID,\n"
+  "values=changed\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local PortGroup=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "PortGroup.streamLimit=256*1024\n"
+  "\n"
+  "\n"
+  "function PortGroup:initialize(observables,lingerTime)\n"
+  "self.observables=observables\n"
+  "self.idToPort={}\n"
+  "self.nextID=1\n"
+  "self.linger=lingerTime or 60\n"
+  "\n"
+  "self.expireQueue=Queue:new()\n"
+  "\n"
+  "\n"
+  "self.records={}\n"
+  "self.stale={}\n"
+  "self.watchers={}\n"
+  "self.version=0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:watch(name,ob,port)\n"
+  "ob:subscribe(port)\n"
+  "local w=self.watchers[name]\n"
+  "if not w then\n"
+  "local stale=self.stale\n"
+  "w={count=0}\n"
+  "function w.invalidate()\n"
+  "stale[name]=true\n"
+  "end\n"
+  "self.watchers[name]=w\n"
+  "ob:subscribe(w)\n"
+  "end\n"
+  "w.count=w.count+1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:unwatch(name,ob,port)\n"
+  "ob:unsubscribe(port)\n"
+  "local w=self.watchers[name]\n"
+  "w.count=w.count-1\n"
+  "if w.count==0 then\n"
+  "ob:unsubscribe(w)\n"
+  "self.watchers[name]=nil\n"
+  "self.records[name]=nil\n"
+  "self.stale[name]=nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:getRecord(name,ob)\n"
+  "if not ob then\n"
+  "return NOT_FOUND_RECORD\n"
+  "end\n"
+  "\n"
+  "local rec=self.records[name]\n"
+  "if rec and not self.stale[name]then\n"
+  "return rec\n"
+  "end\n"
+  "\n"
+  "local value=ob:get()\n"
+  "if value==nil then\n"
+  "value=json.null\n"
+  "end\n"
+  "\n"
+  "if not rec or type(value)==\"table\"or rec.value~=value then\n"
+  "self.version=self.version+1\n"
+  "rec={value=value,version=self.version}\n"
+  "end\n"
+  "\n"
+  "if self.watchers[name]then\n"
+  "self.records[name]=rec\n"
+  "self.stale[name]=nil\n"
+  "end\n"
+  "return rec\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:transact(req)\n"
+  "local id=req.id\n"
+  "local port\n"
+  "if id==nil then\n"
+  "\n"
+  "port=Port:new(self)\n"
+  "else\n"
+  "\n"
+  "port=self.idToPort[id]\n"
+  "if not port then\n"
+  "return ERROR_BADID\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self.expireQueue:remove(port)\n"
+  "port.entries=port.entries+1\n"
+  "\n"
+  "local resp=port:poll(req)\n"
+  "\n"
+  "port.entries=port.entries-1\n"
+  "\n"
+  "if port.entries==0 then\n"
+  "port.tIdle=xpio.gettime()\n"
+  "self.expireQueue:put(port)\n"
+  "end\n"
+  "\n"
+  "self:expire()\n"
+  "\n"
+  "return resp\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:handleRequest(req)\n"
+  "local resp=self:transact(req)\n"
+  "if type(resp)==\"number\"then\n"
+  "return resp\n"
+  "end\n"
+  "\n"
+  "local values={}\n"
+  "for name,rec in pairs(resp.values)do\n"
+  "values[name]=rec.value\n"
+  "end\n"
+  "return{id=resp.id,values=values}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encodeResponse(resp)\n"
+  "local o={}\n"
+  "for name,rec in pairs(resp.values)do\n"
+  "o[#o+1]=json.encode(name)..\":\"..encodeRecord(rec)\n"
+  "end\n"
+  "return'{\"id\":'..json.encode(resp.id)..',\"values\":{'..\n"
+  "table.concat(o,\",\")..'}}'\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:handleRequestJSON(req)\n"
+  "local resp=self:transact(req)\n"
+  "if type(resp)==\"number\"then\n"
+  "return resp\n"
+  "end\n"
+  "return encodeResponse(resp)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:stream(req)\n"
+  "local resp=self:transact(req)\n"
+  "if type(resp)==\"number\"then\n"
+  "return resp\n"
+  "end\n"
+  "\n"
+  "local port=self.idToPort[resp.id]\n"
+  "local generation=port.generation\n"
+  "\n"
+  "return function(emit)\n"
+  "local size=0\n"
+  "while true do\n"
+  "local frame=encodeResponse(resp)..\"\\n\"\n"
+  "if not emit(frame)then\n"
+  "break\n"
+  "end\n"
+  "size=size+#frame\n"
+  "if port.generation~=generation or size>=self.streamLimit then\n"
+  "\n"
+  "break\n"
+  "end\n"
+  "resp=self:transact({id=resp.id})\n"
+  "if type(resp)==\"number\"then\n"
+  "break\n"
+  "end\n"
+  "generation=port.generation\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PortGroup:expire()\n"
+  "local q=self.expireQueue\n"
+  "while q:first()do\n"
+  "local port=q:first()\n"
+  "local t=port.tIdle+self.linger-xpio.gettime()\n"
+  "if t>0 then\n"
+  "return t\n"
+  "else\n"
+  "q:get()\n"
+  "port:discard()\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function PortGroup:getID(port)\n"
+  "local id=self.nextID\n"
+  "self.nextID=id+1\n"
+  "self.idToPort[id]=port\n"
+  "return id\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function PortGroup:discardID(id)\n"
+  "if id~=nil then\n"
+  "self.idToPort[id]=nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function serve(observables,lingerTime)\n"
+  "local group=PortGroup:new(observables,lingerTime)\n"
+  "\n"
+  "local function poll(req)\n"
+  "\n"
+  "\n"
+  "local reqBody=readAll(req.body)\n"
+  "local req=json.decode(reqBody)\n"
+  "if type(req)~=\"table\"then\n"
+  "return ERROR_PARSE\n"
+  "end\n"
+  "\n"
+  "if req.stream then\n"
+  "local body=group:stream(req)\n"
+  "if type(body)==\"number\"then\n"
+  "return body\n"
+  "end\n"
+  "return 200,streamHeaders,body\n"
+  "end\n"
+  "\n"
+  "local resp=group:handleRequestJSON(req)\n"
+  "if type(resp)==\"number\"then\n"
+  "return resp\n"
+  "end\n"
+  "return 200,jsonHeaders,resp\n"
+  "end\n"
+  "\n"
+  "return poll\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "serve=serve,\n"
+  "\n"
+  "PortGroup=PortGroup\n"
+  "}\n"
+  "";
+
+static const unsigned char data29[] = 
+  "\n"
+  "\n"
+  "local object=require'object'\n"
+  "local serialize=require'serialize'\n"
+  "\n"
+  "local M=object:new()\n"
+  "\n"
+  "function M.eq(a,b)\n"
+  "if type(a)==\"table\"and type(b)==\"table\"then\n"
+  "for k,v in pairs(a)do\n"
+  "if not M.eq(v,b[k])then\n"
+  "return false\n"
+  "end\n"
+  "end\n"
+  "for k,v in pairs(b)do\n"
+  "if a[k]==nil then\n"
+  "return false\n"
+  "end\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "return a==b\n"
+  "end\n"
+  "\n"
+  "function M.tostring(t)\n"
+  "return serialize.serialize(t,nil,'s')\n"
+  "end\n"
+  "\n"
+  "function M.clone(self)\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for k,v in pairs(self)do\n"
+  "t[k]=v\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M.append(a,b)\n"
+  "local t=M.clone(a)\n"
+  "for _,v in ipairs(b)do\n"
+  "t[#t+1]=v\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M.merge(a,b)\n"
+  "local t=M.clone(a)\n"
+  "for k,v in pairs(b)do\n"
+  "t[k]=v\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "M.__eq=M.eq\n"
+  "M.__concat=M.append\n"
+  "M.__tostring=M.tostring\n"
+  "M.__index=M\n"
+  "\n"
+  "function M:new(t)\n"
+  "return setmetatable(t and M.clone(t)or{},M)\n"
+  "end\n"
+  "\n"
+  "function M.singleton(v)\n"
+  "return setmetatable({v},M)\n"
+  "end\n"
+  "\n"
+  "function M.empty(mt)\n"
+  "return mt and setmetatable({},mt)or{}\n"
+  "end\n"
+  "\n"
+  "function M.fromString(s)\n"
+  "local t=M.new()\n"
+  "for i=1,#s do\n"
+  "t[i]=string.sub(s,i,i)\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M:keys()\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for k,_ in pairs(self)do\n"
+  "t[#t+1]=k\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M:map(f)\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for k,v in pairs(self)do\n"
+  "t[k]=f(v)\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M:mapWithKeys(f)\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for k,v in pairs(self)do\n"
+  "local v,k2=f(v,k)\n"
+  "t[k2 or k]=v\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M:swap()\n"
+  "return M.mapWithKeys(self,function(x,y)return y,x end)\n"
+  "end\n"
+  "\n"
+  "function M:reverse()\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for i=#self,1,-1 do\n"
+  "t[#t+1]=self[i]\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M:filter(f)\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for i,v in ipairs(self)do\n"
+  "if f(v,i)then\n"
+  "t[#t+1]=v\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function M:partition(f)\n"
+  "local mt=getmetatable(self)\n"
+  "local good=M.empty(mt)\n"
+  "local bad=M.empty(mt)\n"
+  "for k,v in ipairs(self)do\n"
+  "if f(v,k)then\n"
+  "good[#good+1]=v\n"
+  "else\n"
+  "bad[#bad+1]=v\n"
+  "end\n"
+  "end\n"
+  "return good,bad\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function M:partitionWhile(f)\n"
+  "local mt=getmetatable(self)\n"
+  "local good=M.empty(mt)\n"
+  "local bad=M.empty(mt)\n"
+  "local done=false\n"
+  "for k,v in ipairs(self)do\n"
+  "if not done and f(v,k)then\n"
+  "good[#good+1]=v\n"
+  "else\n"
+  "done=true\n"
+  "bad[#bad+1]=v\n"
+  "end\n"
+  "end\n"
+  "return good,bad\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function foldl(t,i,f,...)\n"
+  "if i==#t+1 then\n"
+  "return...\n"
+  "else\n"
+  "return foldl(t,i+1,f,f(t[i],...))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function M:foldFromLeft(f,...)\n"
+  "return foldl(self,1,f,...)\n"
+  "end\n"
+  "\n"
+  "local function foldr(t,i,f,...)\n"
+  "if i==0 then\n"
+  "return...\n"
+  "else\n"
+  "return foldr(t,i-1,f,f(t[i],...))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function M:foldFromRight(f,...)\n"
+  "return foldr(self,#self,f,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function M:fold(f,...)\n"
+  "return foldr(self,#self,f,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function concat(x,y)\n"
+  "return x..y\n"
+  "end\n"
+  "\n"
+  "function M:concat()\n"
+  "local last=self[#self]\n"
+  "if type(last)==\"string\"then\n"
+  "\n"
+  "return table.concat(self)\n"
+  "elseif last==nil or type(last)==\"table\"then\n"
+  "local mt=last and getmetatable(last)\n"
+  "if mt and mt~=M and mt.__concat then\n"
+  "return M.foldFromRight(self,concat,'')\n"
+  "else\n"
+  "local t=M.empty(getmetatable(self))\n"
+  "for _,u in ipairs(self)do\n"
+  "for _,v in ipairs(u)do\n"
+  "t[#t+1]=v\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "else\n"
+  "error(\"error: cannot concat tables of type: \"..type(head))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function add(x,y)return x+y end\n"
+  "local function mul(x,y)return x*y end\n"
+  "\n"
+  "function M:sum()return M.fold(self,add,0)end\n"
+  "function M:product()return M.fold(self,mul,1)end\n"
+  "\n"
+  "function M:concatMap(f)\n"
+  "return M.concat(M.map(self,f))\n"
+  "end\n"
+  "\n"
+  "function M:sort(f)\n"
+  "local t=M.clone(self)\n"
+  "table.sort(t,f)\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "function M:find(x)\n"
+  "for _,v in pairs(self)do\n"
+  "if v==x then\n"
+  "return v\n"
+  "end\n"
+  "end\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "function M:union(t)\n"
+  "local function notInLHS(x)\n"
+  "return M.find(self,x)==nil\n"
+  "end\n"
+  "local t2=M.filter(t,notInLHS)\n"
+  "return M.append(self,t2)\n"
+  "end\n"
+  "\n"
+  "function M:intersect(t)\n"
+  "local function inRHS(x)\n"
+  "return M.find(t,x)~=nil\n"
+  "end\n"
+  "return M.filter(self,inRHS)\n"
+  "end\n"
+  "\n"
+  "return M\n"
+  "\n"
+  "";
+
+static const unsigned char data30[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function ltAny(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local inext=ipairs{}\n"
+  "\n"
+  "local function orderedPairs(t)\n"
+  "local keys={}\n"
+  "local keyIndex=1\n"
+  "local counting=true\n"
+  "\n"
+  "local function _next(seen,s)\n"
+  "local v\n"
+  "\n"
+  "if counting then\n"
+  "\n"
+  "s,v=inext(t,s)\n"
+  "if s~=nil then\n"
+  "seen[s]=true\n"
+  "return s,v\n"
+  "end\n"
+  "counting=false\n"
+  "\n"
+  "\n"
+  "for k,v in pairs(t)do\n"
+  "if not seen[k]then\n"
+  "table.insert(keys,k)\n"
+  "end\n"
+  "end\n"
+  "table.sort(keys,ltAny)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "s=keys[keyIndex]\n"
+  "if s~=nil then\n"
+  "keyIndex=keyIndex+1\n"
+  "v=t[s]\n"
+  "end\n"
+  "return s,v\n"
+  "end\n"
+  "\n"
+  "return _next,{},0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local numtostring={\n"
+  "[tostring(-1/0)]=\"-1/0\",\n"
+  "[tostring(1/0)]=\"1/0\",\n"
+  "[tostring(0/0)]=\"0/0\"\n"
+  "}\n"
+  "\n"
+  "setmetatable(numtostring,{__index=function(t,k)return k end})\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function serialize(x,out,iter)\n"
+  "local visited={}\n"
+  "local iter=iter==\"s\"and orderedPairs or iter or pairs\n"
+  "assert(type(iter)==\"function\")\n"
+  "\n"
+  "local function _serialize(x)\n"
+  "if type(x)==\"string\"then\n"
+  "\n"
+  "out(string.format(\"%q\",x))\n"
+  "\n"
+  "elseif type(x)==\"number\"then\n"
+  "\n"
+  "out(numtostring[tostring(x)])\n"
+  "\n"
+  "elseif type(x)==\"boolean\"or\n"
+  "type(x)==\"nil\"then\n"
+  "\n"
+  "out(tostring(x))\n"
+  "\n"
+  "elseif type(x)==\"table\"then\n"
+  "\n"
+  "if visited[x]then\n"
+  "error(\"serialize: recursive structure\")\n"
+  "end\n"
+  "visited[x]=true\n"
+  "local first,nextIndex=true,1\n"
+  "\n"
+  "out\"{\"\n"
+  "\n"
+  "for k,v in iter(x)do\n"
+  "if first then\n"
+  "first=false\n"
+  "else\n"
+  "out\",\"\n"
+  "end\n"
+  "if k==nextIndex then\n"
+  "nextIndex=nextIndex+1\n"
+  "else\n"
+  "if type(k)==\"string\"and k:match(\"^[%a_][%w_]*$\")then\n"
+  "out(k..\"=\")\n"
+  "else\n"
+  "out\"[\"\n"
+  "_serialize(k)\n"
+  "out\"]=\"\n"
+  "end\n"
+  "end\n"
+  "_serialize(v)\n"
+  "end\n"
+  "\n"
+  "out\"}\"\n"
+  "visited[x]=false\n"
+  "else\n"
+  "error(\"serialize: unsupported type\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local result\n"
+  "if not out then\n"
+  "result={}\n"
+  "out=result\n"
+  "end\n"
+  "\n"
+  "if type(out)==\"table\"then\n"
+  "local t=out\n"
+  "function out(s)\n"
+  "table.insert(t,s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "_serialize(x)\n"
+  "\n"
+  "if result then\n"
+  "return table.concat(result)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return{\n"
+  "orderedPairs=orderedPairs,\n"
+  "serialize=serialize\n"
+  "}\n"
+  "";
+
+static const unsigned char data31[] = 
+  "\n"
+  "local function escapeChar(c)\n"
+  "return string.format(\"\\\\%03d\",c:byte())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function escape(str)\n"
+  "str=str:gsub(\"\\\\\",\"\\\\\\\\\")\n"
+  "str=str:gsub(\"[\\0-\\9\\11-\\31\\127-\\255]\",escapeChar)\n"
+  "return str\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function wrapIndex(self,name)\n"
+  "local inner=rawget(self,\"inner\")\n"
+  "local ivalue=inner[name]\n"
+  "if ivalue==nil then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "assert(type(ivalue)==\"function\")\n"
+  "local value=function(self,...)\n"
+  "return ivalue(self.inner,...)\n"
+  "end\n"
+  "\n"
+  "self[name]=value\n"
+  "return value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local LogSocket={}\n"
+  "\n"
+  "local wrapNum=0\n"
+  "\n"
+  "local function wrapSocket(inner,writeLine)\n"
+  "local me=setmetatable({},{__index=wrapIndex})\n"
+  "me.inner=inner\n"
+  "\n"
+  "wrapNum=wrapNum+1\n"
+  "me._num=wrapNum\n"
+  "me._writeLine=writeLine\n"
+  "\n"
+  "\n"
+  "for k,v in pairs(LogSocket)do\n"
+  "me[k]=v\n"
+  "end\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function LogSocket:_log(name,...)\n"
+  "local writeLine=self._writeLine\n"
+  "local socketNum=self._num\n"
+  "local methodName=\"[\"..socketNum..\"]\"..name\n"
+  "\n"
+  "local numValues=select(\"#\",...)\n"
+  "local value1=select(1,...)\n"
+  "\n"
+  "if numValues==1 and type(value1)==\"string\"then\n"
+  "local prefix=methodName..\": \"\n"
+  "\n"
+  "local data=escape(value1)\n"
+  "local pos=1\n"
+  "while pos<=#data do\n"
+  "local chunk=data:sub(pos,pos+79)\n"
+  "local line=chunk:match(\"(.-)\\n\")\n"
+  "if line then\n"
+  "writeLine(prefix..line)\n"
+  "pos=pos+#line+1\n"
+  "else\n"
+  "writeLine(prefix..chunk..\"\\\\\")\n"
+  "pos=pos+#chunk\n"
+  "end\n"
+  "end\n"
+  "else\n"
+  "local o={methodName,\"->\"}\n"
+  "for n=1,numValues do\n"
+  "local v=select(n,...)\n"
+  "if type(v)==\"string\"then\n"
+  "v=v:format(\"%q\")\n"
+  "else\n"
+  "v=tostring(v)\n"
+  "end\n"
+  "table.insert(o,v)\n"
+  "end\n"
+  "writeLine(table.concat(o,\" \"))\n"
+  "end\n"
+  "return...\n"
+  "end\n"
+  "\n"
+  "function LogSocket:read(...)\n"
+  "return self:_log(\"read\",self.inner:read(...))\n"
+  "end\n"
+  "\n"
+  "function LogSocket:write(...)\n"
+  "assert(select(\"#\",...)==1,\"Too many arguments to `socket:write`\")\n"
+  "local buf=...\n"
+  "assert(type(buf)==\"string\",\"Non-string argument to `socket:write`\")\n"
+  "local amt,err=self.inner:write(buf)\n"
+  "if amt then\n"
+  "self:_log(\"write\",buf:sub(1,amt))\n"
+  "return amt\n"
+  "end\n"
+  "return amt,err\n"
+  "end\n"
+  "\n"
+  "function LogSocket:close(...)\n"
+  "return self:_log(\"close\",self.inner:close(...))\n"
+  "end\n"
+  "\n"
+  "function LogSocket:shutdown(...)\n"
+  "return self:_log(\"shutdown\",self.inner:shutdown(...))\n"
+  "end\n"
+  "\n"
+  "function LogSocket:accept(...)\n"
+  "local values=table.pack(self.inner:accept(...))\n"
+  "if values[1]then\n"
+  "values[1]=wrapSocket(values[1],self._writeLine)\n"
+  "end\n"
+  "return self:_log(\"accept\",table.unpack(values))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "wrap=wrapSocket,\n"
+  "\n"
+  "_log=LogSocket._log,\n"
+  "escape=escape\n"
+  "}\n"
+  "";
+
+static const unsigned char data32[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local O=require\"observable\"\n"
+  "local thread=require\"thread\"\n"
+  "local xpio=require\"xpio\"\n"
+  "\n"
+  "local gettime=xpio.gettime\n"
+  "\n"
+  "local After=O.Observable:basicNew()\n"
+  "\n"
+  "\n"
+  "function After:initialize(when,lag)\n"
+  "O.Observable.initialize(self)\n"
+  "self.when=when\n"
+  "self.lag=lag\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function After:onOff(isOn)\n"
+  "if isOn then\n"
+  "self.when:subscribe(self)\n"
+  "else\n"
+  "self.when:unsubscribe(self)\n"
+  "self:cancelAfter()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function After:get(v)\n"
+  "if self.valid~=true then\n"
+  "if self.valid==nil then\n"
+  "error(\"Observable:get() called during invalidation\")\n"
+  "end\n"
+  "self.value=self:calc()\n"
+  "self.valid=true\n"
+  "end\n"
+  "return self.value\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function After:calc()\n"
+  "local t=self.when:get()\n"
+  "\n"
+  "if t then\n"
+  "self.tWait=t+self.lag\n"
+  "if self.tWait>gettime()then\n"
+  "self:startTimer()\n"
+  "t=false\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function After:timerFunc()\n"
+  "while gettime()<self.tWait do\n"
+  "thread.sleepUntil(self.tWait)\n"
+  "end\n"
+  "self:invalidate()\n"
+  "self.timerThread=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function After:startTimer()\n"
+  "if not self.timerThread then\n"
+  "self.timerThread=thread.new(self.timerFunc,self)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function After:cancelAfter()\n"
+  "if self.timerThread then\n"
+  "thread.kill(self.timerThread)\n"
+  "self.timerThread=nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return After\n"
+  "";
+
+static const unsigned char data33[] = {
+  31, 139, 8, 8, 55, 120, 213, 106, 0, 3, 109, 100, 98, 97, 112, 112, 
+  46, 104, 116, 109, 108, 0, 205, 189, 107, 123, 219, 198, 209, 48, 252, 221, 
+  191, 2, 102, 210, 146, 180, 73, 138, 146, 79, 137, 20, 197, 151, 124, 72, 
+  237, 54, 142, 93, 75, 78, 210, 91, 86, 34, 144, 0, 37, 84, 36, 193, 
+  18, 160, 100, 197, 214, 127, 127, 230, 180, 187, 179, 11, 128, 146, 27, 247, 
+  189, 94, 166, 181, 72, 96, 143, 179, 179, 179, 51, 179, 115, 248, 238, 246, 
+  179, 215, 79, 15, 254, 245, 230, 121, 116, 90, 206, 166, 223, 223, 250, 142, 
+  255, 68, 209, 119, 167, 105, 156, 224, 23, 248, 58, 75, 203, 56, 26, 159, 
+  198, 203, 34, 45, 119, 91, 171, 114, 210, 255, 166, 37, 175, 202, 172, 156, 
+  166, 223, 191, 122, 246, 228, 187, 13, 254, 138, 85, 55, 76, 221, 239, 70, 
+  121, 114, 41, 37, 139, 241, 50, 91, 148, 213, 102, 58, 147, 213, 124, 92, 
+  102, 249, 60, 234, 204, 242, 164, 232, 70, 31, 177, 252, 121, 188, 140, 166, 
+  121, 156, 164, 73, 180, 27, 29, 30, 237, 224, 51, 91, 112, 153, 254, 103, 
+  149, 45, 83, 44, 47, 197, 165, 198, 12, 10, 115, 173, 67, 120, 199, 181, 
+  224, 147, 77, 162, 206, 237, 153, 43, 10, 31, 85, 10, 234, 96, 189, 143, 
+  81, 250, 97, 145, 47, 203, 98, 251, 227, 85, 116, 181, 227, 138, 226, 168, 
+  168, 96, 71, 250, 237, 69, 51, 248, 223, 64, 138, 119, 77, 209, 43, 249, 
+  187, 76, 203, 213, 114, 238, 10, 208, 123, 122, 105, 198, 221, 238, 204, 226, 
+  108, 222, 109, 67, 213, 171, 206, 199, 91, 230, 231, 182, 155, 161, 234, 42, 
+  79, 86, 83, 248, 107, 122, 131, 73, 108, 108, 68, 4, 235, 237, 8, 224, 
+  126, 235, 86, 123, 85, 164, 81, 81, 46, 179, 113, 217, 222, 185, 117, 139, 
+  224, 144, 140, 96, 70, 182, 59, 248, 57, 248, 119, 129, 221, 225, 203, 159, 
+  179, 244, 66, 191, 61, 135, 223, 234, 53, 180, 25, 150, 128, 250, 53, 133, 
+  226, 233, 42, 13, 75, 225, 51, 85, 236, 105, 62, 47, 242, 105, 26, 182, 
+  55, 230, 199, 170, 205, 91, 183, 112, 140, 249, 34, 157, 155, 102, 29, 40, 
+  230, 241, 44, 53, 107, 119, 145, 205, 147, 252, 130, 10, 118, 218, 95, 1, 
+  76, 166, 249, 50, 221, 109, 71, 119, 35, 44, 53, 88, 166, 139, 105, 60, 
+  78, 59, 27, 209, 198, 73, 47, 106, 221, 109, 117, 225, 95, 24, 235, 239, 
+  45, 41, 129, 16, 199, 222, 112, 112, 136, 155, 208, 17, 14, 110, 112, 177, 
+  140, 23, 157, 36, 31, 175, 102, 233, 188, 28, 224, 27, 40, 137, 127, 6, 
+  241, 2, 250, 74, 58, 31, 163, 89, 188, 60, 201, 230, 219, 209, 240, 138, 
+  198, 107, 199, 119, 26, 23, 167, 79, 159, 116, 204, 8, 177, 101, 124, 4, 
+  45, 203, 96, 167, 249, 56, 198, 146, 3, 122, 252, 233, 83, 212, 254, 170, 
+  189, 99, 203, 34, 16, 220, 175, 252, 60, 93, 78, 166, 57, 66, 171, 173, 
+  10, 205, 160, 71, 131, 200, 220, 56, 188, 255, 74, 192, 216, 214, 136, 125, 
+  206, 160, 86, 128, 31, 140, 151, 105, 92, 194, 102, 73, 70, 130, 170, 87, 
+  81, 58, 5, 148, 193, 198, 230, 171, 233, 52, 186, 189, 11, 91, 15, 42, 
+  97, 203, 131, 89, 92, 142, 79, 59, 237, 223, 44, 112, 59, 135, 123, 253, 
+  255, 139, 251, 127, 28, 221, 233, 30, 222, 61, 122, 220, 25, 220, 1, 196, 
+  237, 122, 125, 194, 8, 147, 180, 24, 227, 70, 58, 220, 60, 2, 80, 183, 
+  35, 92, 146, 217, 225, 214, 209, 142, 87, 202, 160, 8, 148, 52, 24, 84, 
+  29, 158, 154, 134, 69, 41, 46, 116, 16, 143, 120, 78, 29, 236, 174, 23, 
+  149, 203, 85, 26, 84, 170, 174, 215, 230, 86, 116, 229, 79, 188, 2, 45, 
+  65, 249, 250, 161, 232, 37, 57, 205, 146, 36, 157, 203, 194, 240, 126, 39, 
+  36, 1, 130, 6, 16, 47, 1, 119, 58, 216, 100, 47, 250, 104, 106, 109, 
+  219, 250, 56, 136, 171, 91, 183, 12, 186, 236, 220, 50, 184, 60, 199, 71, 
+  64, 22, 231, 39, 169, 44, 194, 211, 39, 176, 222, 176, 203, 39, 57, 2, 
+  118, 180, 58, 129, 137, 156, 152, 242, 178, 139, 220, 126, 130, 178, 87, 61, 
+  32, 3, 178, 203, 63, 131, 138, 112, 13, 248, 134, 63, 142, 225, 215, 49, 
+  180, 185, 88, 166, 5, 76, 164, 136, 202, 211, 84, 122, 79, 151, 64, 95, 
+  0, 50, 80, 127, 30, 143, 23, 197, 106, 10, 8, 61, 63, 137, 198, 249, 
+  108, 182, 154, 103, 140, 222, 128, 238, 229, 41, 86, 194, 198, 46, 210, 81, 
+  84, 164, 75, 152, 250, 64, 154, 127, 61, 194, 223, 184, 128, 197, 182, 60, 
+  66, 218, 10, 35, 128, 177, 165, 150, 216, 70, 109, 152, 227, 188, 221, 139, 
+  218, 208, 227, 178, 196, 47, 203, 21, 253, 94, 196, 64, 231, 240, 75, 250, 
+  33, 163, 231, 233, 114, 153, 47, 219, 170, 33, 168, 49, 62, 179, 13, 197, 
+  203, 101, 124, 25, 229, 147, 136, 31, 79, 150, 176, 253, 11, 85, 122, 4, 
+  139, 125, 182, 200, 51, 156, 42, 60, 137, 23, 0, 184, 108, 154, 34, 149, 
+  40, 162, 254, 247, 174, 190, 43, 24, 77, 179, 185, 215, 134, 236, 192, 176, 
+  71, 243, 24, 192, 184, 204, 210, 162, 2, 1, 42, 0, 200, 59, 46, 243, 
+  101, 8, 141, 73, 10, 251, 111, 63, 95, 45, 199, 105, 248, 244, 71, 32, 
+  36, 211, 34, 124, 74, 155, 226, 77, 156, 45, 77, 63, 63, 200, 242, 227, 
+  10, 198, 37, 44, 195, 60, 137, 146, 24, 78, 240, 50, 167, 53, 229, 117, 
+  9, 186, 141, 169, 138, 6, 38, 84, 123, 10, 235, 27, 207, 147, 122, 160, 
+  33, 210, 211, 14, 150, 134, 222, 189, 236, 47, 83, 64, 12, 56, 177, 13, 
+  2, 134, 115, 179, 244, 189, 246, 208, 250, 112, 90, 150, 11, 125, 76, 208, 
+  3, 117, 154, 188, 254, 37, 245, 142, 181, 28, 176, 76, 189, 46, 198, 167, 
+  41, 98, 249, 82, 151, 177, 15, 117, 59, 94, 35, 118, 85, 236, 81, 228, 
+  78, 208, 143, 87, 50, 54, 236, 10, 126, 227, 8, 12, 149, 160, 209, 245, 
+  92, 175, 112, 210, 108, 112, 99, 105, 11, 8, 0, 204, 45, 141, 103, 219, 
+  68, 163, 248, 196, 216, 216, 232, 255, 201, 15, 130, 146, 142, 124, 187, 109, 
+  96, 72, 3, 132, 182, 207, 68, 217, 227, 210, 176, 34, 88, 20, 15, 30, 
+  218, 91, 64, 134, 122, 52, 161, 129, 12, 23, 142, 110, 40, 0, 68, 221, 
+  156, 195, 188, 99, 118, 131, 66, 244, 212, 29, 214, 6, 201, 195, 98, 246, 
+  84, 50, 5, 245, 70, 11, 11, 171, 119, 181, 21, 44, 146, 121, 28, 1, 
+  157, 9, 102, 142, 180, 14, 64, 239, 87, 203, 108, 27, 150, 64, 85, 110, 
+  245, 28, 19, 135, 24, 152, 150, 167, 121, 178, 29, 181, 223, 188, 59, 104, 
+  251, 175, 144, 136, 111, 71, 127, 223, 127, 253, 211, 0, 113, 114, 126, 146, 
+  77, 46, 77, 47, 87, 134, 103, 8, 246, 161, 55, 34, 32, 205, 233, 135, 
+  0, 234, 254, 76, 1, 139, 138, 13, 60, 21, 185, 104, 216, 166, 219, 197, 
+  94, 187, 120, 206, 105, 206, 34, 67, 118, 120, 159, 134, 200, 239, 228, 188, 
+  222, 120, 159, 220, 249, 122, 163, 123, 56, 148, 3, 183, 118, 8, 11, 108, 
+  158, 199, 144, 84, 6, 192, 36, 199, 235, 220, 144, 195, 186, 121, 81, 157, 
+  78, 123, 163, 160, 106, 216, 38, 239, 214, 89, 124, 150, 254, 115, 149, 46, 
+  47, 97, 69, 176, 174, 35, 170, 0, 72, 221, 169, 162, 47, 94, 167, 227, 
+  89, 226, 175, 108, 244, 209, 45, 220, 235, 125, 88, 57, 94, 233, 246, 134, 
+  65, 180, 158, 44, 31, 212, 188, 138, 116, 23, 76, 211, 26, 121, 73, 132, 
+  103, 44, 148, 114, 87, 49, 5, 112, 254, 225, 209, 131, 93, 200, 87, 133, 
+  45, 39, 57, 61, 95, 205, 55, 212, 195, 162, 76, 23, 175, 145, 166, 202, 
+  43, 60, 242, 131, 215, 47, 231, 230, 101, 54, 15, 107, 174, 74, 91, 113, 
+  165, 251, 162, 19, 15, 95, 241, 209, 199, 76, 199, 78, 48, 118, 24, 186, 
+  76, 226, 16, 39, 119, 164, 56, 69, 126, 174, 57, 53, 134, 168, 60, 111, 
+  224, 137, 98, 160, 101, 101, 167, 61, 207, 203, 232, 50, 45, 163, 108, 182, 
+  152, 166, 176, 2, 41, 46, 128, 227, 162, 169, 170, 3, 117, 61, 231, 110, 
+  186, 6, 178, 117, 240, 250, 217, 107, 41, 78, 172, 136, 17, 142, 152, 201, 
+  51, 44, 140, 165, 248, 159, 193, 196, 80, 157, 237, 232, 96, 25, 207, 11, 
+  152, 89, 244, 226, 224, 224, 141, 28, 59, 7, 167, 89, 33, 181, 162, 197, 
+  50, 63, 207, 96, 203, 68, 177, 107, 154, 206, 71, 100, 253, 163, 95, 95, 
+  253, 248, 2, 154, 121, 11, 93, 193, 146, 71, 136, 148, 197, 44, 207, 129, 
+  161, 193, 181, 196, 182, 138, 28, 80, 24, 206, 246, 12, 198, 156, 39, 73, 
+  86, 102, 216, 22, 148, 43, 151, 249, 10, 185, 26, 124, 143, 194, 45, 140, 
+  33, 93, 102, 69, 153, 141, 11, 195, 251, 68, 253, 232, 41, 110, 83, 24, 
+  249, 56, 93, 152, 179, 121, 9, 196, 56, 26, 93, 70, 191, 190, 120, 43, 
+  180, 137, 42, 96, 233, 231, 243, 98, 5, 44, 30, 141, 15, 143, 108, 192, 
+  195, 5, 84, 130, 14, 226, 233, 116, 132, 196, 25, 38, 134, 223, 225, 176, 
+  189, 147, 207, 199, 233, 157, 8, 166, 3, 236, 24, 172, 21, 137, 26, 55, 
+  110, 231, 34, 3, 1, 0, 215, 122, 148, 154, 6, 227, 9, 76, 0, 126, 
+  64, 179, 211, 105, 108, 154, 83, 18, 143, 219, 227, 255, 193, 127, 205, 42, 
+  147, 148, 237, 61, 81, 68, 163, 237, 49, 205, 136, 190, 255, 113, 130, 61, 
+  49, 186, 29, 124, 8, 19, 155, 71, 149, 54, 72, 78, 130, 226, 244, 226, 
+  240, 76, 9, 21, 255, 25, 44, 86, 197, 105, 39, 157, 143, 225, 4, 123, 
+  247, 246, 37, 80, 20, 152, 32, 242, 225, 103, 93, 148, 67, 72, 52, 172, 
+  121, 123, 222, 237, 234, 241, 152, 65, 62, 198, 226, 255, 25, 252, 27, 142, 
+  143, 78, 123, 167, 205, 28, 59, 194, 242, 13, 240, 240, 249, 114, 6, 200, 
+  83, 92, 206, 199, 176, 116, 243, 124, 85, 16, 170, 17, 39, 1, 56, 35, 
+  108, 142, 252, 130, 193, 242, 65, 18, 125, 138, 242, 209, 191, 83, 192, 75, 
+  251, 57, 148, 55, 187, 223, 71, 114, 106, 201, 131, 171, 35, 105, 196, 181, 
+  51, 128, 247, 208, 22, 254, 11, 220, 155, 105, 28, 27, 193, 53, 203, 9, 
+  151, 226, 105, 77, 61, 70, 40, 168, 74, 99, 148, 95, 88, 47, 73, 39, 
+  241, 106, 138, 3, 108, 255, 237, 249, 65, 187, 166, 170, 200, 197, 244, 7, 
+  58, 45, 86, 163, 89, 86, 6, 85, 235, 234, 209, 234, 192, 75, 164, 16, 
+  27, 44, 230, 209, 137, 131, 141, 240, 18, 68, 49, 110, 63, 46, 199, 115, 
+  174, 182, 146, 207, 159, 33, 175, 170, 200, 8, 84, 87, 200, 89, 248, 136, 
+  140, 163, 116, 141, 68, 196, 132, 103, 231, 32, 99, 68, 220, 80, 167, 76, 
+  63, 148, 61, 32, 18, 203, 110, 47, 186, 56, 77, 97, 55, 28, 227, 163, 
+  99, 220, 65, 186, 37, 175, 17, 154, 251, 50, 29, 167, 208, 20, 80, 130, 
+  60, 154, 196, 203, 65, 20, 189, 44, 177, 22, 66, 126, 253, 86, 225, 166, 
+  198, 200, 49, 186, 61, 233, 246, 220, 33, 73, 221, 176, 252, 64, 36, 224, 
+  75, 76, 40, 5, 167, 216, 170, 132, 182, 177, 249, 108, 34, 50, 213, 145, 
+  30, 213, 120, 212, 33, 145, 167, 71, 220, 60, 207, 105, 219, 27, 118, 20, 
+  81, 1, 232, 150, 255, 10, 230, 229, 44, 190, 1, 194, 210, 34, 224, 102, 
+  155, 231, 243, 254, 214, 175, 191, 42, 130, 0, 111, 130, 182, 232, 51, 137, 
+  241, 116, 192, 177, 174, 198, 227, 180, 40, 130, 50, 9, 175, 21, 12, 101, 
+  96, 154, 58, 0, 232, 34, 53, 146, 10, 59, 209, 241, 10, 56, 158, 9, 
+  72, 78, 201, 49, 62, 167, 161, 25, 48, 189, 165, 141, 87, 67, 148, 17, 
+  48, 12, 87, 90, 37, 148, 233, 113, 139, 152, 29, 0, 180, 70, 150, 96, 
+  148, 194, 124, 104, 232, 128, 164, 2, 237, 148, 41, 175, 109, 146, 143, 61, 
+  168, 219, 3, 32, 234, 227, 31, 198, 141, 8, 155, 94, 4, 7, 64, 167, 
+  235, 142, 217, 15, 48, 96, 57, 84, 149, 2, 18, 231, 154, 116, 52, 145, 
+  66, 242, 231, 90, 55, 31, 18, 76, 24, 248, 12, 38, 249, 1, 220, 248, 
+  183, 223, 126, 187, 83, 41, 139, 7, 40, 246, 136, 5, 58, 82, 246, 187, 
+  104, 107, 56, 196, 7, 242, 251, 251, 104, 235, 219, 111, 187, 209, 95, 255, 
+  42, 15, 252, 86, 16, 77, 122, 81, 39, 141, 30, 71, 22, 240, 209, 118, 
+  101, 137, 186, 140, 64, 97, 93, 4, 7, 96, 167, 123, 124, 37, 100, 210, 
+  177, 21, 229, 229, 34, 133, 131, 16, 192, 73, 106, 40, 222, 200, 109, 159, 
+  230, 35, 113, 255, 72, 180, 13, 190, 95, 249, 164, 246, 63, 68, 212, 238, 
+  238, 170, 115, 4, 31, 50, 213, 23, 72, 227, 104, 243, 57, 176, 242, 201, 
+  37, 105, 30, 172, 122, 164, 202, 92, 152, 97, 241, 4, 161, 194, 62, 86, 
+  192, 161, 221, 15, 23, 195, 46, 155, 154, 158, 211, 133, 85, 27, 184, 135, 
+  48, 6, 152, 192, 191, 56, 66, 166, 40, 213, 70, 205, 155, 78, 8, 227, 
+  16, 196, 87, 134, 133, 163, 191, 37, 80, 65, 205, 154, 45, 89, 173, 137, 
+  237, 9, 189, 70, 145, 13, 137, 116, 207, 64, 173, 162, 242, 194, 113, 227, 
+  59, 84, 184, 167, 203, 34, 28, 155, 61, 87, 79, 147, 37, 158, 172, 107, 
+  138, 154, 49, 128, 192, 37, 155, 224, 5, 21, 236, 64, 213, 158, 174, 120, 
+  8, 15, 142, 2, 188, 185, 186, 85, 253, 198, 141, 1, 180, 177, 174, 104, 
+  84, 25, 226, 99, 226, 133, 144, 152, 121, 188, 41, 98, 61, 81, 174, 29, 
+  133, 72, 222, 130, 93, 221, 210, 167, 117, 61, 42, 212, 160, 48, 142, 36, 
+  30, 1, 203, 104, 219, 161, 115, 61, 16, 88, 34, 133, 144, 59, 53, 108, 
+  42, 21, 55, 140, 170, 81, 61, 124, 6, 159, 170, 212, 63, 191, 164, 35, 
+  124, 178, 159, 166, 44, 76, 149, 31, 202, 65, 173, 74, 228, 233, 52, 46, 
+  10, 79, 115, 142, 15, 62, 67, 149, 241, 101, 116, 14, 239, 96, 96, 199, 
+  251, 211, 28, 78, 77, 60, 164, 146, 124, 222, 46, 105, 118, 248, 220, 72, 
+  232, 199, 60, 228, 215, 164, 39, 25, 96, 233, 1, 176, 14, 52, 96, 132, 
+  251, 235, 209, 96, 181, 72, 104, 99, 65, 25, 43, 215, 211, 11, 37, 228, 
+  243, 202, 125, 169, 129, 255, 128, 82, 234, 235, 209, 54, 156, 47, 203, 116, 
+  150, 67, 231, 14, 70, 114, 58, 202, 65, 100, 212, 210, 192, 34, 204, 97, 
+  167, 152, 131, 100, 59, 250, 120, 165, 143, 60, 122, 237, 94, 70, 192, 193, 
+  1, 52, 82, 117, 36, 71, 166, 60, 62, 223, 142, 90, 249, 89, 11, 120, 
+  192, 22, 157, 122, 45, 243, 10, 10, 111, 139, 24, 15, 47, 113, 206, 242, 
+  6, 26, 32, 82, 173, 6, 71, 80, 149, 137, 8, 236, 20, 88, 111, 201, 
+  155, 65, 54, 7, 145, 36, 158, 102, 127, 248, 84, 146, 14, 61, 66, 93, 
+  179, 73, 100, 109, 92, 249, 1, 158, 164, 157, 18, 100, 37, 217, 30, 248, 
+  117, 192, 52, 28, 254, 85, 207, 140, 134, 78, 182, 2, 137, 115, 166, 255, 
+  124, 254, 122, 50, 241, 117, 34, 197, 235, 185, 150, 13, 244, 111, 219, 164, 
+  156, 241, 187, 170, 131, 142, 233, 191, 39, 211, 126, 242, 187, 129, 248, 96, 
+  148, 1, 53, 160, 161, 86, 239, 50, 84, 123, 13, 221, 116, 124, 193, 213, 
+  14, 53, 236, 6, 73, 147, 230, 178, 164, 53, 127, 192, 142, 198, 208, 115, 
+  70, 110, 172, 89, 33, 171, 143, 241, 110, 17, 215, 127, 27, 255, 40, 18, 
+  105, 62, 219, 212, 151, 149, 54, 190, 4, 230, 3, 137, 185, 6, 239, 9, 
+  175, 168, 24, 109, 88, 71, 158, 124, 252, 186, 69, 69, 154, 208, 11, 201, 
+  87, 47, 210, 90, 21, 175, 165, 58, 36, 235, 57, 182, 68, 227, 155, 104, 
+  88, 241, 143, 122, 74, 138, 35, 22, 41, 4, 223, 120, 56, 39, 117, 106, 
+  65, 111, 157, 96, 67, 147, 178, 12, 15, 76, 79, 39, 102, 123, 27, 208, 
+  158, 47, 14, 109, 71, 71, 94, 23, 235, 17, 218, 235, 131, 152, 228, 96, 
+  46, 131, 56, 73, 222, 2, 236, 207, 211, 215, 35, 153, 55, 213, 151, 62, 
+  190, 192, 42, 107, 157, 56, 29, 20, 193, 194, 1, 22, 176, 128, 88, 12, 
+  88, 25, 141, 108, 188, 97, 160, 249, 9, 179, 212, 204, 176, 20, 81, 7, 
+  230, 49, 45, 34, 146, 81, 64, 232, 90, 228, 211, 169, 19, 209, 136, 242, 
+  185, 235, 3, 32, 111, 41, 139, 66, 197, 106, 129, 199, 28, 190, 155, 117, 
+  65, 72, 242, 79, 53, 32, 96, 164, 52, 111, 192, 159, 170, 18, 157, 184, 
+  28, 25, 183, 7, 236, 128, 248, 216, 231, 90, 237, 111, 191, 235, 141, 105, 
+  36, 232, 202, 102, 125, 35, 66, 69, 117, 1, 155, 54, 57, 94, 140, 61, 
+  97, 241, 216, 40, 52, 236, 115, 94, 236, 66, 105, 53, 184, 171, 34, 221, 
+  23, 232, 71, 183, 111, 119, 100, 102, 200, 82, 250, 139, 211, 13, 154, 179, 
+  149, 120, 108, 17, 105, 209, 16, 153, 113, 21, 67, 113, 40, 46, 206, 240, 
+  218, 5, 184, 189, 88, 86, 86, 53, 70, 191, 223, 228, 56, 178, 225, 142, 
+  33, 57, 208, 216, 52, 157, 159, 160, 130, 107, 34, 85, 88, 152, 139, 167, 
+  196, 3, 163, 190, 12, 197, 183, 52, 185, 101, 84, 120, 43, 192, 245, 254, 
+  247, 76, 50, 138, 232, 112, 188, 90, 46, 97, 156, 211, 75, 212, 16, 160, 
+  113, 199, 8, 134, 0, 103, 94, 113, 164, 54, 194, 168, 160, 35, 11, 9, 
+  142, 185, 55, 65, 144, 26, 54, 159, 10, 33, 158, 189, 124, 134, 107, 100, 
+  232, 130, 204, 22, 30, 194, 224, 0, 161, 75, 39, 165, 235, 189, 183, 74, 
+  155, 90, 151, 17, 19, 245, 128, 33, 243, 225, 222, 137, 139, 74, 123, 93, 
+  222, 141, 132, 162, 164, 210, 14, 15, 207, 64, 247, 109, 78, 59, 233, 141, 
+  14, 41, 135, 157, 102, 115, 83, 115, 162, 118, 111, 84, 63, 75, 139, 76, 
+  108, 164, 61, 166, 19, 218, 80, 129, 154, 82, 164, 196, 107, 238, 34, 31, 
+  9, 85, 185, 238, 152, 133, 193, 28, 66, 233, 1, 172, 33, 218, 187, 192, 
+  215, 6, 237, 111, 146, 226, 1, 88, 173, 164, 69, 56, 125, 222, 121, 227, 
+  180, 12, 94, 173, 10, 88, 54, 21, 73, 173, 72, 47, 68, 97, 75, 219, 
+  33, 86, 106, 181, 233, 37, 16, 4, 96, 193, 82, 224, 199, 231, 151, 166, 
+  182, 69, 178, 141, 213, 220, 126, 135, 61, 148, 46, 99, 110, 2, 154, 143, 
+  78, 233, 246, 63, 242, 26, 27, 56, 229, 100, 221, 230, 175, 128, 42, 164, 
+  13, 238, 0, 169, 146, 156, 1, 128, 43, 190, 236, 168, 122, 79, 159, 40, 
+  30, 165, 23, 13, 125, 142, 67, 65, 233, 233, 147, 230, 179, 171, 129, 60, 
+  25, 80, 188, 99, 48, 163, 218, 162, 131, 26, 232, 124, 154, 116, 101, 91, 
+  2, 253, 125, 5, 66, 12, 18, 102, 210, 86, 67, 153, 233, 101, 31, 245, 
+  212, 118, 21, 204, 182, 237, 171, 109, 75, 151, 222, 131, 91, 238, 106, 33, 
+  81, 102, 87, 244, 4, 75, 188, 44, 126, 65, 201, 141, 76, 178, 62, 94, 
+  5, 154, 91, 164, 14, 217, 220, 34, 78, 168, 190, 5, 60, 50, 76, 30, 
+  162, 149, 67, 41, 221, 1, 99, 230, 128, 79, 123, 253, 210, 112, 231, 106, 
+  231, 123, 183, 29, 248, 241, 70, 200, 111, 237, 234, 217, 66, 104, 231, 160, 
+  212, 81, 162, 205, 139, 233, 234, 143, 123, 241, 68, 107, 233, 119, 87, 209, 
+  166, 80, 110, 6, 80, 177, 14, 90, 93, 140, 184, 173, 114, 101, 23, 237, 
+  7, 192, 10, 134, 51, 42, 249, 166, 249, 156, 172, 42, 236, 18, 56, 216, 
+  47, 105, 167, 215, 41, 199, 9, 68, 6, 198, 12, 133, 80, 9, 114, 187, 
+  14, 12, 85, 141, 5, 246, 112, 163, 81, 91, 67, 5, 171, 230, 182, 227, 
+  20, 53, 113, 112, 105, 170, 134, 147, 108, 107, 250, 238, 174, 181, 0, 98, 
+  219, 128, 184, 0, 55, 57, 129, 30, 19, 190, 109, 43, 24, 187, 194, 60, 
+  214, 109, 164, 197, 52, 104, 91, 69, 192, 84, 95, 203, 92, 190, 119, 130, 
+  35, 248, 211, 39, 85, 156, 167, 218, 85, 23, 102, 13, 18, 4, 190, 226, 
+  217, 238, 238, 250, 124, 64, 8, 89, 60, 115, 114, 40, 1, 187, 22, 24, 
+  40, 86, 90, 5, 160, 71, 162, 31, 194, 219, 235, 95, 29, 254, 192, 36, 
+  40, 48, 65, 231, 67, 86, 69, 105, 72, 224, 211, 154, 97, 16, 167, 198, 
+  173, 144, 46, 21, 8, 85, 134, 108, 27, 143, 169, 16, 61, 250, 101, 148, 
+  143, 129, 32, 92, 51, 68, 189, 123, 132, 136, 7, 12, 200, 58, 97, 43, 
+  120, 236, 49, 85, 87, 138, 13, 80, 188, 21, 2, 187, 150, 187, 34, 137, 
+  20, 191, 52, 49, 75, 254, 122, 235, 82, 30, 23, 20, 44, 185, 225, 64, 
+  244, 62, 175, 1, 190, 6, 179, 191, 210, 23, 113, 134, 58, 239, 158, 126, 
+  198, 3, 85, 136, 236, 192, 122, 165, 119, 59, 169, 74, 149, 113, 194, 235, 
+  31, 127, 52, 119, 220, 134, 127, 53, 55, 220, 132, 132, 66, 120, 237, 224, 
+  237, 108, 3, 13, 172, 187, 73, 193, 83, 231, 119, 88, 247, 100, 154, 226, 
+  19, 117, 64, 85, 78, 245, 58, 113, 156, 152, 28, 213, 198, 91, 225, 157, 
+  124, 97, 220, 151, 168, 179, 130, 199, 212, 81, 226, 51, 78, 23, 117, 199, 
+  172, 8, 71, 248, 162, 98, 238, 4, 245, 141, 220, 160, 40, 28, 219, 98, 
+  74, 215, 63, 128, 194, 237, 174, 39, 188, 109, 252, 6, 39, 252, 84, 110, 
+  71, 222, 111, 124, 232, 163, 164, 209, 231, 197, 221, 24, 148, 168, 186, 167, 
+  46, 80, 115, 170, 175, 239, 152, 153, 149, 227, 208, 94, 236, 176, 77, 24, 
+  158, 147, 134, 109, 182, 140, 33, 28, 164, 207, 99, 96, 7, 141, 74, 128, 
+  204, 241, 150, 68, 128, 97, 231, 164, 75, 16, 157, 200, 212, 105, 116, 9, 
+  117, 177, 89, 192, 25, 255, 210, 33, 128, 186, 186, 136, 210, 247, 165, 62, 
+  164, 170, 23, 167, 225, 173, 105, 74, 230, 18, 216, 214, 0, 25, 217, 151, 
+  104, 76, 242, 122, 210, 105, 191, 159, 183, 241, 194, 115, 211, 33, 7, 150, 
+  252, 62, 64, 254, 240, 84, 22, 0, 72, 131, 120, 26, 177, 105, 137, 95, 
+  11, 205, 254, 146, 238, 160, 0, 192, 151, 220, 83, 200, 15, 169, 205, 5, 
+  69, 221, 91, 110, 127, 0, 39, 24, 2, 83, 25, 41, 209, 139, 144, 108, 
+  225, 168, 107, 95, 224, 71, 129, 243, 7, 44, 163, 21, 10, 116, 6, 45, 
+  208, 174, 92, 234, 55, 171, 167, 153, 93, 119, 92, 153, 70, 218, 26, 28, 
+  175, 222, 184, 173, 209, 5, 57, 208, 243, 45, 220, 110, 116, 127, 51, 36, 
+  26, 7, 78, 130, 118, 108, 192, 217, 60, 191, 0, 52, 92, 45, 65, 234, 
+  74, 147, 20, 81, 21, 234, 195, 153, 137, 87, 143, 204, 45, 231, 100, 74, 
+  233, 65, 189, 70, 110, 242, 11, 172, 21, 145, 234, 152, 94, 77, 178, 107, 
+  232, 21, 35, 44, 79, 14, 118, 111, 35, 230, 34, 183, 206, 187, 9, 144, 
+  1, 165, 57, 158, 66, 140, 196, 49, 117, 135, 77, 72, 150, 212, 130, 58, 
+  112, 255, 201, 113, 6, 195, 90, 167, 191, 176, 26, 145, 160, 71, 37, 191, 
+  43, 53, 129, 71, 194, 11, 212, 75, 144, 244, 12, 96, 81, 200, 40, 90, 
+  61, 195, 76, 209, 67, 119, 229, 138, 172, 59, 93, 246, 94, 2, 149, 89, 
+  202, 85, 7, 30, 30, 172, 160, 43, 212, 92, 58, 212, 71, 6, 188, 24, 
+  98, 28, 208, 43, 94, 209, 16, 234, 100, 100, 179, 6, 48, 235, 246, 16, 
+  246, 160, 117, 16, 74, 190, 243, 105, 40, 136, 248, 118, 14, 168, 96, 196, 
+  3, 203, 77, 10, 111, 157, 161, 0, 147, 74, 69, 88, 27, 105, 35, 13, 
+  132, 230, 167, 207, 9, 252, 253, 179, 65, 95, 252, 97, 144, 25, 8, 123, 
+  179, 58, 65, 141, 210, 42, 12, 106, 244, 12, 212, 94, 150, 236, 4, 204, 
+  7, 179, 24, 53, 196, 106, 30, 144, 36, 45, 35, 251, 194, 8, 193, 186, 
+  170, 164, 174, 114, 49, 135, 70, 114, 169, 48, 247, 110, 230, 21, 201, 84, 
+  247, 37, 211, 248, 185, 218, 125, 208, 238, 159, 145, 203, 16, 249, 140, 64, 
+  214, 60, 54, 252, 96, 169, 108, 78, 250, 208, 96, 127, 26, 137, 226, 170, 
+  206, 244, 11, 241, 192, 92, 169, 217, 171, 173, 207, 184, 83, 123, 18, 163, 
+  233, 2, 93, 146, 137, 242, 11, 205, 213, 178, 73, 134, 170, 40, 54, 126, 
+  40, 46, 139, 50, 157, 137, 94, 146, 251, 224, 235, 54, 125, 191, 70, 118, 
+  190, 183, 124, 37, 106, 173, 120, 142, 149, 198, 21, 138, 170, 142, 148, 241, 
+  64, 217, 118, 135, 77, 92, 237, 16, 142, 226, 80, 143, 79, 227, 226, 165, 
+  236, 231, 227, 106, 205, 193, 98, 153, 151, 185, 112, 75, 227, 128, 227, 51, 
+  35, 124, 105, 117, 170, 21, 84, 169, 22, 65, 199, 136, 233, 101, 103, 220, 
+  139, 226, 229, 9, 185, 185, 248, 236, 159, 48, 88, 99, 225, 228, 24, 22, 
+  60, 191, 70, 72, 228, 235, 32, 65, 230, 170, 208, 189, 65, 47, 167, 1, 
+  118, 211, 193, 103, 158, 164, 5, 191, 101, 160, 249, 53, 3, 205, 189, 129, 
+  42, 104, 250, 247, 19, 163, 127, 135, 214, 171, 163, 127, 107, 66, 202, 231, 
+  184, 3, 252, 78, 131, 145, 34, 117, 99, 111, 127, 189, 139, 214, 207, 192, 
+  87, 15, 61, 237, 133, 204, 222, 155, 151, 255, 213, 229, 239, 12, 168, 9, 
+  43, 212, 157, 15, 22, 63, 50, 247, 191, 68, 88, 128, 181, 123, 71, 116, 
+  111, 40, 118, 242, 192, 63, 51, 13, 26, 208, 215, 155, 93, 71, 248, 87, 
+  216, 55, 169, 96, 238, 131, 237, 60, 235, 175, 41, 106, 175, 139, 214, 222, 
+  235, 144, 42, 40, 96, 122, 214, 222, 199, 32, 99, 91, 209, 203, 107, 83, 
+  106, 129, 209, 221, 187, 86, 157, 233, 221, 134, 137, 178, 209, 67, 44, 205, 
+  197, 219, 78, 88, 167, 2, 239, 128, 247, 219, 172, 42, 97, 241, 70, 169, 
+  163, 44, 56, 174, 42, 157, 105, 221, 102, 109, 119, 180, 162, 201, 7, 179, 
+  169, 168, 211, 76, 132, 128, 188, 235, 118, 22, 150, 249, 206, 23, 89, 201, 
+  226, 148, 180, 134, 207, 145, 53, 66, 19, 223, 185, 86, 2, 10, 193, 84, 
+  67, 72, 218, 85, 9, 145, 122, 68, 81, 96, 156, 98, 39, 61, 152, 103, 
+  149, 60, 21, 77, 98, 179, 130, 3, 45, 146, 15, 8, 107, 178, 203, 230, 
+  47, 240, 77, 172, 118, 249, 110, 195, 224, 77, 74, 38, 133, 200, 17, 47, 
+  225, 221, 0, 205, 242, 72, 199, 97, 173, 4, 201, 3, 9, 239, 171, 230, 
+  171, 217, 8, 120, 61, 188, 226, 48, 115, 66, 123, 68, 212, 60, 103, 98, 
+  134, 155, 111, 76, 150, 249, 44, 26, 14, 244, 50, 84, 239, 254, 162, 141, 
+  59, 89, 177, 7, 63, 206, 211, 59, 27, 86, 105, 236, 107, 1, 146, 28, 
+  224, 174, 149, 2, 229, 248, 180, 107, 103, 166, 154, 23, 60, 221, 101, 245, 
+  164, 177, 225, 123, 61, 39, 246, 105, 150, 47, 83, 111, 184, 167, 241, 57, 
+  94, 218, 150, 49, 169, 37, 144, 133, 229, 61, 192, 58, 114, 32, 176, 23, 
+  113, 65, 183, 26, 198, 211, 38, 79, 136, 196, 192, 153, 7, 220, 208, 34, 
+  62, 65, 18, 78, 135, 115, 194, 38, 138, 81, 180, 119, 158, 195, 0, 64, 
+  14, 142, 167, 227, 170, 131, 150, 26, 31, 45, 146, 25, 224, 79, 202, 50, 
+  17, 253, 212, 0, 224, 0, 227, 5, 155, 198, 162, 157, 36, 13, 8, 7, 
+  40, 119, 44, 216, 124, 52, 190, 28, 67, 147, 209, 51, 178, 108, 148, 150, 
+  22, 254, 184, 50, 59, 176, 183, 92, 135, 22, 239, 216, 92, 242, 30, 59, 
+  107, 231, 181, 131, 69, 86, 208, 140, 245, 165, 101, 70, 176, 242, 40, 197, 
+  53, 177, 35, 29, 4, 84, 199, 22, 173, 163, 58, 22, 175, 169, 84, 29, 
+  83, 70, 148, 196, 55, 57, 114, 108, 93, 176, 87, 121, 95, 236, 68, 253, 
+  62, 190, 249, 30, 137, 114, 200, 75, 217, 194, 135, 80, 228, 72, 179, 85, 
+  234, 116, 117, 187, 114, 29, 245, 187, 186, 233, 101, 51, 153, 35, 77, 105, 
+  125, 110, 72, 215, 177, 52, 29, 255, 13, 102, 3, 129, 145, 137, 7, 90, 
+  207, 127, 231, 26, 115, 129, 238, 78, 149, 246, 159, 179, 229, 80, 101, 230, 
+  172, 236, 191, 178, 221, 175, 181, 18, 240, 215, 53, 186, 45, 187, 49, 84, 
+  252, 234, 14, 204, 134, 168, 93, 177, 170, 193, 1, 173, 64, 120, 193, 86, 
+  75, 137, 237, 64, 197, 168, 53, 89, 145, 105, 144, 91, 250, 118, 13, 71, 
+  141, 255, 106, 155, 6, 129, 138, 155, 254, 245, 190, 83, 238, 142, 227, 246, 
+  174, 190, 93, 169, 23, 61, 124, 200, 219, 119, 85, 190, 255, 179, 208, 14, 
+  221, 21, 111, 134, 118, 120, 60, 164, 51, 224, 167, 226, 229, 37, 57, 189, 
+  156, 51, 41, 194, 205, 150, 226, 200, 248, 103, 190, 42, 11, 56, 23, 72, 
+  250, 156, 71, 114, 39, 201, 84, 136, 81, 23, 168, 15, 183, 131, 51, 226, 
+  137, 2, 55, 182, 13, 252, 65, 79, 20, 8, 118, 70, 219, 1, 3, 47, 
+  5, 164, 115, 239, 117, 94, 61, 231, 28, 67, 224, 64, 150, 59, 134, 194, 
+  211, 193, 74, 203, 147, 41, 84, 216, 110, 176, 109, 36, 158, 219, 53, 117, 
+  113, 154, 1, 87, 213, 129, 174, 149, 8, 7, 98, 238, 162, 211, 237, 70, 
+  33, 142, 230, 204, 91, 84, 58, 214, 24, 69, 171, 198, 246, 102, 208, 255, 
+  186, 221, 13, 75, 129, 206, 20, 171, 18, 105, 253, 31, 217, 244, 18, 104, 
+  55, 170, 182, 38, 217, 178, 96, 235, 120, 60, 1, 21, 5, 103, 131, 110, 
+  169, 98, 207, 48, 174, 101, 176, 0, 245, 68, 151, 133, 129, 62, 48, 34, 
+  101, 70, 214, 223, 108, 84, 143, 37, 154, 8, 202, 100, 222, 131, 106, 208, 
+  118, 209, 19, 38, 186, 135, 227, 186, 252, 47, 104, 204, 132, 28, 198, 230, 
+  234, 9, 157, 227, 124, 17, 203, 109, 163, 18, 194, 227, 37, 185, 107, 120, 
+  207, 95, 118, 156, 110, 104, 102, 110, 45, 149, 118, 80, 15, 12, 63, 248, 
+  27, 74, 225, 159, 193, 44, 94, 40, 197, 3, 8, 64, 243, 112, 29, 73, 
+  109, 203, 171, 195, 189, 29, 98, 41, 125, 17, 138, 31, 186, 169, 25, 159, 
+  50, 168, 157, 168, 65, 23, 20, 198, 237, 97, 53, 37, 39, 110, 255, 214, 
+  211, 13, 124, 150, 11, 18, 136, 76, 209, 169, 199, 73, 15, 55, 101, 81, 
+  68, 132, 195, 35, 177, 42, 197, 233, 15, 130, 67, 173, 141, 146, 226, 96, 
+  207, 212, 245, 18, 238, 32, 239, 242, 50, 0, 0, 130, 29, 25, 80, 6, 
+  4, 250, 98, 95, 214, 22, 21, 158, 148, 118, 30, 90, 160, 105, 38, 156, 
+  117, 57, 32, 139, 214, 118, 84, 181, 228, 115, 194, 169, 87, 174, 27, 44, 
+  143, 94, 185, 218, 195, 73, 127, 12, 100, 205, 146, 252, 111, 161, 107, 102, 
+  96, 15, 207, 206, 159, 153, 184, 255, 211, 184, 35, 155, 137, 16, 200, 21, 
+  25, 210, 96, 226, 205, 136, 5, 126, 228, 253, 209, 12, 36, 218, 57, 53, 
+  119, 12, 88, 185, 110, 154, 244, 34, 156, 214, 149, 166, 135, 161, 84, 242, 
+  212, 94, 131, 199, 115, 45, 185, 35, 179, 186, 154, 26, 230, 181, 245, 12, 
+  216, 218, 22, 18, 190, 152, 28, 108, 92, 193, 130, 56, 218, 91, 162, 129, 
+  230, 189, 71, 76, 109, 78, 11, 82, 250, 218, 81, 118, 232, 158, 107, 145, 
+  207, 82, 24, 146, 216, 153, 114, 217, 165, 119, 50, 24, 123, 155, 32, 141, 
+  114, 191, 17, 58, 21, 101, 35, 113, 165, 195, 157, 136, 197, 68, 110, 221, 
+  242, 166, 119, 239, 194, 227, 240, 220, 129, 222, 28, 201, 65, 198, 212, 87, 
+  19, 54, 224, 25, 212, 170, 96, 154, 16, 209, 58, 106, 234, 23, 225, 195, 
+  51, 250, 152, 111, 99, 239, 64, 187, 182, 113, 188, 228, 227, 107, 87, 74, 
+  153, 255, 178, 91, 10, 141, 115, 55, 106, 27, 104, 182, 235, 176, 69, 200, 
+  109, 93, 215, 132, 76, 108, 26, 145, 124, 104, 178, 140, 192, 254, 220, 232, 
+  67, 130, 110, 108, 197, 16, 197, 69, 47, 214, 120, 64, 121, 74, 91, 192, 
+  143, 150, 65, 137, 150, 69, 120, 205, 232, 77, 230, 222, 238, 231, 38, 157, 
+  77, 105, 131, 149, 20, 74, 203, 43, 131, 68, 246, 44, 93, 111, 224, 74, 
+  65, 60, 88, 246, 36, 49, 47, 131, 25, 0, 250, 24, 65, 27, 127, 34, 
+  119, 165, 148, 5, 28, 35, 36, 234, 204, 226, 203, 17, 234, 178, 226, 105, 
+  218, 109, 212, 205, 4, 248, 40, 216, 8, 184, 232, 29, 185, 26, 37, 43, 
+  140, 144, 97, 122, 76, 225, 195, 249, 209, 32, 247, 177, 50, 180, 133, 195, 
+  79, 3, 3, 166, 176, 169, 150, 113, 106, 168, 161, 151, 239, 54, 118, 135, 
+  87, 64, 1, 237, 170, 60, 177, 86, 115, 180, 14, 107, 165, 20, 177, 126, 
+  98, 201, 194, 194, 81, 113, 19, 183, 43, 98, 169, 48, 245, 74, 40, 174, 
+  202, 43, 127, 94, 254, 176, 253, 135, 178, 109, 216, 153, 227, 182, 7, 134, 
+  109, 174, 66, 209, 126, 197, 107, 178, 101, 186, 136, 151, 169, 65, 87, 243, 
+  166, 137, 120, 53, 34, 140, 79, 195, 12, 48, 47, 170, 104, 227, 17, 51, 
+  134, 143, 101, 234, 14, 47, 6, 116, 68, 95, 12, 234, 79, 196, 171, 224, 
+  196, 242, 44, 213, 130, 221, 170, 154, 13, 239, 53, 125, 225, 81, 67, 99, 
+  153, 78, 83, 186, 229, 176, 92, 12, 58, 158, 179, 147, 36, 122, 179, 146, 
+  253, 218, 152, 77, 117, 163, 127, 175, 10, 244, 33, 189, 104, 58, 69, 107, 
+  49, 209, 173, 105, 147, 52, 121, 51, 65, 110, 143, 87, 55, 95, 222, 76, 
+  154, 179, 184, 206, 36, 210, 214, 238, 144, 117, 165, 119, 248, 21, 251, 98, 
+  112, 25, 168, 55, 72, 152, 179, 86, 146, 198, 36, 177, 142, 239, 158, 57, 
+  228, 171, 215, 171, 26, 116, 150, 83, 36, 95, 127, 134, 220, 152, 209, 13, 
+  246, 202, 141, 185, 49, 89, 137, 208, 21, 179, 86, 138, 36, 214, 84, 163, 
+  12, 186, 177, 9, 209, 232, 176, 135, 178, 41, 12, 128, 234, 170, 54, 52, 
+  66, 135, 167, 215, 53, 108, 240, 149, 3, 108, 131, 254, 172, 2, 218, 219, 
+  240, 164, 66, 121, 64, 80, 159, 211, 21, 248, 37, 156, 80, 69, 58, 157, 
+  220, 110, 235, 193, 200, 234, 30, 230, 198, 114, 57, 32, 240, 183, 21, 110, 
+  84, 204, 73, 60, 180, 241, 213, 50, 248, 33, 60, 235, 44, 87, 243, 42, 
+  61, 175, 248, 251, 174, 230, 190, 191, 105, 29, 70, 122, 167, 83, 153, 191, 
+  93, 225, 169, 38, 19, 216, 9, 103, 100, 46, 29, 205, 227, 202, 125, 45, 
+  214, 175, 208, 109, 124, 72, 119, 180, 215, 209, 34, 192, 130, 36, 181, 24, 
+  95, 2, 253, 37, 28, 112, 163, 112, 68, 217, 227, 134, 205, 144, 44, 167, 
+  206, 20, 192, 2, 130, 226, 228, 217, 149, 173, 115, 196, 116, 146, 128, 184, 
+  89, 222, 146, 43, 176, 129, 119, 19, 228, 126, 236, 216, 2, 162, 82, 196, 
+  63, 238, 161, 8, 161, 248, 199, 61, 44, 92, 73, 225, 176, 24, 67, 241, 
+  65, 215, 21, 19, 57, 121, 226, 213, 165, 120, 31, 187, 52, 19, 247, 48, 
+  160, 65, 120, 233, 234, 63, 177, 65, 214, 220, 5, 219, 77, 239, 253, 130, 
+  171, 61, 229, 245, 126, 108, 36, 161, 99, 160, 30, 34, 103, 139, 14, 107, 
+  18, 29, 99, 235, 199, 70, 225, 125, 236, 11, 77, 157, 238, 177, 57, 25, 
+  138, 40, 38, 95, 249, 202, 241, 64, 188, 27, 135, 246, 0, 254, 205, 156, 
+  17, 124, 13, 233, 41, 234, 173, 186, 166, 210, 7, 197, 17, 33, 119, 50, 
+  82, 200, 211, 136, 156, 50, 190, 71, 193, 80, 142, 145, 204, 30, 163, 113, 
+  75, 140, 97, 98, 28, 139, 88, 164, 37, 201, 66, 115, 231, 204, 200, 3, 
+  11, 98, 204, 41, 249, 156, 99, 44, 0, 3, 25, 197, 69, 145, 157, 192, 
+  168, 233, 170, 32, 93, 150, 151, 100, 32, 145, 68, 199, 34, 168, 31, 83, 
+  107, 121, 125, 224, 0, 23, 46, 34, 155, 144, 153, 141, 117, 94, 82, 125, 
+  225, 60, 216, 70, 147, 96, 66, 161, 41, 68, 50, 35, 187, 149, 53, 80, 
+  137, 220, 48, 184, 67, 32, 0, 121, 112, 253, 132, 193, 240, 4, 52, 2, 
+  136, 112, 174, 158, 204, 167, 149, 44, 158, 177, 1, 85, 64, 11, 209, 51, 
+  82, 80, 70, 231, 248, 199, 238, 83, 12, 8, 198, 53, 147, 232, 60, 93, 
+  22, 30, 238, 72, 9, 159, 148, 153, 217, 84, 20, 139, 51, 218, 22, 212, 
+  95, 205, 61, 6, 170, 42, 152, 235, 162, 111, 223, 185, 211, 78, 177, 92, 
+  77, 250, 42, 150, 29, 109, 13, 163, 177, 10, 139, 49, 99, 7, 227, 24, 
+  156, 217, 59, 77, 20, 32, 253, 146, 13, 183, 155, 230, 195, 213, 73, 128, 
+  171, 214, 53, 5, 206, 69, 180, 228, 57, 135, 176, 13, 53, 3, 117, 82, 
+  129, 180, 36, 227, 61, 175, 97, 34, 235, 124, 226, 177, 236, 4, 144, 236, 
+  180, 114, 32, 9, 213, 196, 56, 97, 64, 213, 219, 120, 4, 64, 225, 74, 
+  151, 143, 185, 187, 138, 202, 14, 63, 219, 40, 122, 45, 44, 7, 170, 248, 
+  19, 120, 172, 217, 147, 110, 69, 234, 100, 130, 4, 248, 186, 164, 219, 182, 
+  9, 77, 173, 56, 205, 87, 83, 12, 176, 17, 37, 89, 49, 142, 151, 73, 
+  154, 212, 98, 20, 109, 132, 87, 112, 46, 64, 165, 74, 212, 30, 99, 195, 
+  69, 35, 219, 241, 222, 157, 165, 151, 230, 205, 89, 221, 73, 200, 232, 192, 
+  45, 212, 221, 155, 85, 84, 220, 100, 63, 106, 6, 99, 140, 165, 96, 93, 
+  106, 117, 93, 196, 90, 147, 53, 86, 29, 156, 77, 196, 33, 233, 157, 116, 
+  234, 85, 84, 226, 136, 69, 187, 52, 147, 166, 50, 14, 93, 189, 153, 52, 
+  169, 223, 212, 176, 177, 251, 122, 229, 38, 246, 103, 138, 156, 93, 167, 157, 
+  211, 120, 232, 241, 78, 22, 25, 195, 177, 104, 44, 85, 220, 182, 249, 152, 
+  83, 223, 127, 227, 115, 186, 62, 26, 215, 248, 39, 8, 236, 171, 90, 89, 
+  51, 50, 33, 176, 77, 91, 92, 94, 215, 65, 92, 189, 174, 220, 203, 86, 
+  193, 35, 198, 124, 118, 231, 212, 205, 72, 102, 124, 219, 199, 69, 189, 135, 
+  252, 51, 2, 225, 38, 120, 200, 124, 9, 11, 8, 68, 91, 187, 33, 135, 
+  197, 21, 153, 207, 170, 198, 70, 99, 226, 110, 184, 15, 47, 154, 229, 231, 
+  216, 29, 5, 14, 107, 168, 142, 154, 193, 203, 109, 62, 229, 142, 199, 163, 
+  99, 137, 101, 116, 60, 131, 3, 107, 6, 103, 90, 86, 164, 227, 124, 158, 
+  168, 128, 63, 47, 39, 252, 22, 157, 166, 100, 62, 182, 46, 95, 42, 160, 
+  25, 13, 156, 183, 217, 76, 238, 229, 200, 198, 212, 239, 223, 248, 134, 80, 
+  215, 100, 61, 29, 187, 192, 72, 192, 22, 156, 103, 228, 180, 103, 107, 36, 
+  124, 146, 242, 176, 187, 126, 91, 32, 232, 82, 67, 70, 108, 205, 102, 168, 
+  125, 82, 99, 143, 40, 32, 105, 118, 78, 26, 48, 10, 208, 22, 47, 71, 
+  89, 73, 247, 135, 147, 236, 3, 52, 78, 129, 34, 187, 138, 73, 165, 142, 
+  42, 119, 75, 244, 84, 95, 154, 74, 177, 170, 122, 5, 95, 182, 196, 43, 
+  102, 207, 64, 130, 108, 92, 91, 184, 25, 56, 134, 111, 131, 180, 119, 216, 
+  94, 182, 123, 145, 10, 243, 91, 105, 3, 181, 194, 71, 117, 24, 106, 134, 
+  189, 249, 208, 67, 75, 55, 212, 239, 196, 121, 168, 5, 204, 200, 203, 25, 
+  112, 82, 25, 112, 183, 13, 67, 178, 195, 201, 220, 112, 116, 53, 53, 138, 
+  202, 217, 104, 235, 150, 94, 221, 3, 88, 155, 124, 85, 42, 96, 90, 115, 
+  85, 196, 123, 203, 134, 27, 131, 122, 165, 147, 180, 114, 93, 1, 152, 128, 
+  113, 99, 178, 228, 112, 232, 249, 180, 141, 81, 63, 2, 176, 219, 54, 29, 
+  114, 51, 1, 232, 160, 218, 230, 81, 119, 135, 195, 249, 238, 4, 149, 51, 
+  85, 25, 184, 234, 165, 155, 235, 218, 106, 101, 80, 205, 76, 179, 166, 18, 
+  79, 180, 2, 17, 166, 15, 178, 6, 78, 30, 153, 83, 188, 233, 103, 40, 
+  216, 192, 87, 179, 253, 77, 192, 244, 207, 216, 249, 207, 183, 163, 228, 18, 
+  88, 231, 108, 12, 43, 149, 226, 249, 15, 162, 200, 37, 249, 245, 255, 47, 
+  2, 206, 168, 248, 242, 117, 182, 126, 248, 26, 45, 17, 77, 164, 117, 110, 
+  243, 57, 78, 85, 68, 176, 231, 60, 72, 6, 203, 51, 91, 41, 166, 11, 
+  131, 215, 161, 156, 166, 110, 123, 40, 244, 86, 164, 80, 109, 60, 234, 13, 
+  97, 9, 56, 246, 238, 51, 138, 94, 36, 193, 193, 159, 158, 102, 211, 164, 
+  243, 28, 35, 218, 94, 78, 57, 238, 45, 95, 156, 192, 175, 253, 211, 52, 
+  45, 105, 60, 238, 103, 113, 232, 253, 50, 182, 109, 253, 104, 243, 72, 212, 
+  238, 207, 24, 196, 64, 199, 46, 69, 112, 36, 195, 119, 168, 2, 92, 20, 
+  54, 184, 92, 145, 205, 100, 168, 244, 122, 11, 143, 59, 5, 44, 12, 154, 
+  158, 250, 247, 61, 192, 254, 210, 21, 137, 233, 118, 48, 46, 10, 44, 238, 
+  31, 63, 234, 125, 54, 135, 197, 40, 189, 22, 41, 18, 251, 199, 171, 118, 
+  207, 6, 157, 85, 91, 180, 166, 233, 67, 42, 118, 196, 98, 59, 129, 125, 
+  58, 253, 73, 60, 132, 234, 173, 238, 29, 239, 24, 179, 5, 123, 146, 77, 
+  38, 41, 58, 24, 71, 100, 86, 135, 39, 132, 161, 234, 34, 93, 21, 30, 
+  28, 78, 210, 242, 221, 60, 3, 82, 135, 253, 248, 161, 254, 217, 186, 193, 
+  12, 161, 234, 202, 138, 66, 27, 173, 39, 222, 75, 128, 68, 187, 100, 244, 
+  102, 155, 63, 95, 180, 137, 56, 132, 136, 9, 150, 219, 25, 220, 121, 220, 
+  237, 188, 79, 238, 116, 191, 222, 80, 12, 132, 184, 32, 75, 12, 251, 206, 
+  38, 254, 115, 23, 131, 216, 227, 37, 207, 166, 31, 49, 210, 31, 86, 84, 
+  19, 103, 68, 98, 150, 48, 130, 136, 144, 86, 17, 87, 81, 42, 95, 148, 
+  5, 89, 174, 207, 79, 166, 169, 9, 5, 105, 152, 245, 122, 25, 113, 94, 
+  39, 33, 54, 58, 249, 84, 180, 52, 40, 23, 85, 252, 134, 241, 41, 30, 
+  7, 204, 164, 52, 156, 80, 244, 18, 197, 55, 186, 181, 158, 7, 18, 86, 
+  133, 97, 114, 197, 173, 118, 201, 96, 22, 97, 31, 15, 25, 154, 130, 189, 
+  152, 100, 231, 237, 46, 111, 179, 29, 177, 210, 73, 241, 140, 38, 195, 221, 
+  168, 125, 145, 142, 206, 56, 236, 251, 171, 252, 15, 252, 51, 43, 240, 95, 
+  192, 220, 118, 116, 180, 99, 46, 105, 65, 4, 46, 1, 165, 230, 41, 208, 
+  180, 232, 239, 241, 121, 188, 79, 73, 71, 250, 188, 21, 61, 85, 2, 133, 
+  149, 92, 230, 23, 176, 105, 250, 226, 2, 196, 102, 166, 228, 170, 18, 61, 
+  31, 156, 128, 152, 31, 181, 70, 249, 135, 253, 236, 15, 88, 146, 22, 6, 
+  146, 104, 65, 231, 79, 236, 19, 111, 113, 230, 80, 147, 204, 74, 42, 136, 
+  108, 5, 154, 133, 160, 97, 207, 110, 111, 16, 98, 22, 190, 28, 131, 139, 
+  129, 158, 62, 26, 64, 13, 139, 177, 168, 131, 60, 246, 97, 32, 199, 219, 
+  249, 238, 221, 224, 170, 182, 194, 142, 47, 48, 24, 31, 141, 12, 14, 214, 
+  65, 153, 191, 131, 93, 181, 124, 10, 7, 92, 167, 107, 18, 107, 176, 107, 
+  96, 103, 179, 170, 42, 101, 70, 67, 98, 49, 15, 166, 249, 73, 167, 253, 
+  116, 127, 95, 193, 218, 185, 88, 213, 132, 16, 246, 247, 10, 172, 163, 7, 
+  70, 101, 124, 226, 61, 119, 38, 72, 254, 138, 251, 29, 135, 139, 188, 72, 
+  199, 104, 190, 74, 165, 138, 203, 121, 25, 127, 88, 179, 208, 253, 89, 254, 
+  71, 31, 158, 245, 139, 154, 181, 6, 172, 171, 172, 178, 153, 73, 21, 13, 
+  44, 196, 92, 122, 146, 223, 160, 133, 31, 166, 121, 92, 126, 189, 1, 72, 
+  60, 193, 111, 237, 186, 114, 148, 123, 227, 168, 139, 201, 76, 218, 253, 175, 
+  55, 97, 131, 148, 249, 143, 249, 133, 89, 157, 186, 150, 59, 188, 83, 62, 
+  1, 123, 191, 97, 106, 237, 248, 126, 142, 82, 24, 141, 131, 127, 1, 230, 
+  26, 224, 209, 249, 221, 15, 226, 100, 246, 175, 158, 167, 165, 101, 6, 234, 
+  76, 104, 201, 22, 187, 181, 248, 208, 138, 86, 115, 84, 7, 162, 186, 77, 
+  58, 136, 90, 95, 125, 252, 119, 129, 221, 96, 43, 87, 45, 102, 229, 195, 
+  245, 160, 38, 237, 146, 12, 234, 55, 21, 235, 186, 43, 182, 139, 114, 91, 
+  99, 194, 52, 52, 4, 163, 164, 185, 176, 189, 153, 133, 211, 87, 239, 63, 
+  210, 41, 240, 254, 10, 129, 91, 133, 72, 77, 120, 177, 176, 47, 158, 127, 
+  99, 95, 120, 248, 46, 62, 180, 43, 237, 216, 6, 106, 67, 74, 132, 225, 
+  146, 67, 254, 186, 114, 129, 130, 220, 214, 182, 181, 153, 179, 216, 79, 189, 
+  240, 118, 99, 168, 89, 46, 148, 23, 113, 31, 195, 165, 40, 237, 42, 6, 
+  147, 71, 82, 153, 161, 23, 123, 156, 208, 21, 133, 183, 157, 88, 33, 59, 
+  99, 173, 109, 30, 29, 35, 71, 83, 144, 22, 22, 87, 252, 248, 235, 99, 
+  83, 52, 99, 243, 252, 227, 124, 244, 111, 167, 189, 198, 119, 197, 241, 54, 
+  25, 164, 99, 172, 69, 213, 93, 4, 236, 74, 202, 185, 91, 202, 15, 37, 
+  137, 120, 84, 119, 219, 56, 36, 144, 47, 61, 121, 108, 71, 237, 175, 219, 
+  186, 155, 142, 9, 164, 11, 35, 67, 107, 78, 255, 53, 55, 197, 227, 220, 
+  150, 228, 28, 170, 45, 34, 176, 142, 59, 35, 65, 247, 216, 112, 78, 80, 
+  193, 50, 81, 76, 78, 73, 217, 140, 218, 52, 250, 2, 221, 214, 212, 87, 
+  236, 144, 209, 194, 73, 255, 220, 189, 113, 42, 199, 103, 100, 122, 234, 34, 
+  11, 218, 222, 118, 163, 239, 232, 59, 124, 69, 167, 236, 239, 123, 170, 208, 
+  92, 120, 177, 239, 108, 166, 17, 187, 65, 18, 159, 240, 21, 94, 61, 171, 
+  133, 91, 95, 145, 139, 125, 47, 21, 175, 188, 157, 88, 0, 190, 224, 226, 
+  21, 29, 90, 202, 30, 46, 78, 143, 39, 222, 139, 234, 56, 88, 153, 35, 
+  169, 95, 216, 30, 145, 249, 226, 124, 14, 32, 204, 48, 50, 77, 106, 20, 
+  138, 196, 162, 229, 137, 113, 209, 49, 74, 201, 2, 189, 114, 213, 106, 179, 
+  191, 172, 12, 155, 181, 135, 248, 136, 71, 45, 14, 174, 204, 3, 225, 59, 
+  30, 39, 112, 20, 20, 247, 179, 198, 60, 12, 10, 213, 106, 43, 233, 0, 
+  133, 170, 135, 80, 32, 56, 57, 225, 137, 97, 33, 127, 147, 172, 72, 195, 
+  254, 183, 253, 163, 187, 192, 70, 214, 232, 184, 244, 254, 169, 232, 184, 110, 
+  35, 128, 234, 180, 91, 6, 57, 44, 84, 29, 42, 50, 145, 46, 68, 89, 
+  77, 243, 54, 183, 1, 117, 173, 136, 245, 49, 117, 180, 78, 5, 134, 5, 
+  6, 28, 2, 136, 13, 159, 188, 51, 12, 225, 20, 84, 167, 10, 70, 53, 
+  234, 213, 208, 116, 186, 222, 76, 75, 195, 240, 125, 61, 220, 208, 118, 110, 
+  45, 236, 148, 87, 159, 254, 192, 99, 90, 180, 170, 157, 186, 63, 103, 53, 
+  154, 141, 247, 143, 37, 108, 4, 77, 51, 84, 132, 98, 72, 126, 154, 224, 
+  97, 251, 35, 146, 82, 40, 132, 100, 29, 37, 42, 234, 225, 168, 58, 199, 
+  107, 44, 109, 152, 92, 227, 213, 186, 97, 57, 205, 44, 153, 88, 227, 48, 
+  42, 60, 150, 209, 25, 54, 153, 192, 208, 56, 215, 90, 239, 205, 40, 22, 
+  60, 101, 178, 243, 111, 42, 220, 190, 134, 151, 32, 248, 244, 68, 183, 23, 
+  236, 108, 204, 230, 149, 147, 222, 37, 56, 71, 246, 136, 36, 178, 152, 103, 
+  119, 234, 52, 43, 112, 102, 192, 197, 18, 249, 59, 134, 111, 120, 34, 16, 
+  197, 60, 246, 200, 10, 81, 84, 146, 89, 151, 164, 188, 160, 34, 129, 237, 
+  147, 56, 129, 59, 156, 115, 113, 126, 12, 65, 116, 24, 188, 179, 22, 80, 
+  140, 228, 141, 144, 162, 222, 73, 162, 99, 48, 89, 76, 210, 80, 179, 83, 
+  127, 106, 4, 125, 92, 222, 224, 52, 240, 217, 24, 140, 223, 134, 115, 28, 
+  1, 215, 182, 111, 247, 178, 38, 0, 78, 224, 129, 46, 117, 49, 103, 210, 
+  82, 172, 38, 252, 90, 39, 134, 43, 72, 91, 70, 61, 154, 165, 114, 60, 
+  206, 199, 206, 225, 111, 143, 175, 142, 238, 116, 223, 63, 134, 111, 248, 133, 
+  152, 29, 71, 2, 129, 235, 139, 123, 145, 23, 179, 220, 14, 34, 134, 37, 
+  231, 31, 10, 89, 120, 8, 32, 45, 140, 42, 55, 87, 150, 99, 49, 200, 
+  26, 46, 173, 210, 120, 72, 39, 119, 105, 248, 119, 165, 89, 17, 254, 20, 
+  159, 185, 6, 190, 236, 243, 129, 103, 169, 220, 229, 206, 25, 99, 15, 143, 
+  106, 33, 95, 28, 228, 164, 233, 232, 8, 90, 107, 8, 87, 196, 180, 0, 
+  103, 150, 90, 233, 82, 197, 153, 230, 181, 149, 203, 167, 218, 13, 67, 239, 
+  229, 118, 28, 164, 180, 236, 60, 75, 86, 241, 212, 168, 232, 208, 45, 34, 
+  95, 244, 167, 233, 121, 234, 237, 43, 180, 138, 163, 248, 55, 124, 199, 156, 
+  100, 192, 203, 148, 204, 145, 160, 250, 93, 106, 183, 139, 232, 152, 97, 105, 
+  121, 50, 228, 60, 126, 32, 223, 66, 114, 13, 92, 2, 8, 46, 82, 171, 
+  169, 34, 173, 122, 0, 95, 210, 78, 172, 200, 186, 96, 30, 189, 124, 214, 
+  199, 233, 37, 142, 28, 32, 176, 84, 151, 3, 114, 254, 56, 206, 18, 102, 
+  8, 69, 121, 161, 115, 174, 20, 152, 70, 174, 176, 238, 58, 88, 23, 227, 
+  155, 32, 35, 0, 212, 30, 105, 206, 160, 158, 48, 192, 210, 137, 78, 208, 
+  44, 30, 202, 207, 201, 159, 92, 53, 197, 161, 184, 165, 218, 241, 239, 199, 
+  188, 93, 69, 28, 127, 197, 14, 44, 196, 241, 212, 226, 240, 218, 83, 33, 
+  29, 100, 20, 220, 189, 67, 95, 118, 3, 37, 24, 191, 107, 111, 182, 195, 
+  99, 215, 160, 90, 251, 43, 202, 106, 2, 117, 133, 136, 84, 133, 114, 205, 
+  229, 143, 57, 156, 82, 148, 149, 233, 204, 166, 164, 161, 31, 208, 245, 158, 
+  97, 8, 233, 65, 143, 247, 20, 252, 188, 56, 205, 224, 75, 198, 225, 62, 
+  200, 79, 30, 247, 220, 116, 154, 95, 128, 100, 224, 101, 157, 232, 179, 194, 
+  215, 248, 212, 131, 160, 68, 166, 16, 172, 154, 195, 48, 107, 94, 217, 103, 
+  175, 95, 69, 63, 97, 22, 138, 245, 197, 216, 47, 123, 227, 39, 246, 223, 
+  13, 202, 178, 173, 6, 114, 199, 128, 60, 73, 26, 84, 125, 227, 246, 139, 
+  8, 16, 29, 210, 15, 112, 202, 66, 222, 120, 192, 55, 110, 184, 252, 24, 
+  129, 200, 224, 154, 242, 129, 115, 139, 88, 147, 132, 14, 28, 43, 77, 140, 
+  208, 231, 105, 106, 239, 169, 12, 172, 169, 28, 86, 224, 254, 154, 43, 32, 
+  190, 40, 33, 130, 133, 33, 123, 40, 211, 120, 48, 98, 193, 110, 173, 48, 
+  52, 24, 12, 180, 192, 83, 97, 216, 95, 226, 176, 59, 178, 178, 52, 36, 
+  123, 176, 43, 22, 170, 209, 43, 128, 240, 101, 237, 22, 194, 34, 232, 21, 
+  128, 37, 107, 156, 2, 232, 181, 10, 182, 64, 240, 172, 184, 3, 120, 3, 
+  173, 27, 103, 45, 31, 73, 9, 59, 181, 17, 37, 214, 174, 112, 112, 212, 
+  24, 179, 112, 248, 126, 80, 179, 53, 235, 6, 250, 147, 202, 161, 215, 208, 
+  212, 205, 26, 170, 87, 224, 57, 166, 139, 167, 172, 101, 169, 118, 123, 77, 
+  203, 183, 235, 237, 185, 213, 208, 236, 69, 10, 230, 159, 192, 105, 240, 96, 
+  163, 70, 26, 113, 157, 165, 238, 77, 44, 127, 113, 45, 190, 72, 68, 235, 
+  91, 180, 170, 150, 7, 105, 255, 142, 247, 82, 252, 240, 235, 50, 70, 35, 
+  34, 210, 19, 219, 135, 213, 48, 39, 181, 70, 244, 20, 200, 114, 138, 132, 
+  220, 108, 80, 135, 96, 40, 66, 250, 122, 3, 79, 132, 213, 113, 35, 104, 
+  143, 8, 1, 48, 207, 28, 246, 42, 119, 28, 31, 133, 197, 216, 221, 42, 
+  173, 120, 181, 228, 18, 233, 251, 107, 98, 52, 24, 130, 34, 7, 109, 17, 
+  45, 98, 178, 244, 6, 58, 224, 65, 192, 69, 106, 112, 23, 3, 148, 163, 
+  144, 67, 31, 25, 134, 203, 63, 105, 232, 221, 215, 28, 237, 6, 143, 156, 
+  177, 105, 197, 177, 150, 38, 38, 165, 156, 130, 28, 87, 15, 101, 160, 1, 
+  158, 65, 208, 133, 31, 69, 201, 42, 49, 224, 235, 142, 123, 65, 93, 136, 
+  70, 23, 222, 56, 117, 178, 99, 86, 223, 15, 72, 203, 25, 89, 243, 223, 
+  6, 214, 13, 170, 27, 239, 9, 2, 192, 77, 98, 134, 184, 196, 18, 246, 
+  17, 159, 37, 98, 31, 197, 17, 176, 66, 251, 109, 21, 30, 18, 3, 237, 
+  249, 145, 106, 188, 23, 21, 79, 210, 43, 53, 64, 185, 163, 250, 255, 55, 
+  94, 58, 253, 140, 32, 154, 133, 0, 251, 119, 84, 61, 194, 83, 186, 182, 
+  97, 12, 130, 173, 217, 245, 41, 191, 191, 234, 181, 254, 242, 169, 135, 21, 
+  126, 133, 134, 91, 6, 190, 241, 67, 235, 144, 80, 247, 102, 250, 213, 108, 
+  159, 199, 165, 55, 179, 147, 60, 24, 249, 251, 117, 150, 248, 27, 201, 93, 
+  50, 154, 21, 170, 221, 199, 186, 47, 126, 110, 20, 78, 50, 87, 117, 243, 
+  236, 226, 131, 13, 210, 110, 13, 194, 164, 115, 188, 81, 127, 90, 137, 65, 
+  5, 155, 13, 36, 23, 231, 208, 4, 95, 81, 88, 132, 127, 145, 149, 12, 
+  237, 49, 49, 107, 148, 218, 205, 249, 212, 122, 16, 165, 33, 156, 233, 166, 
+  23, 105, 43, 105, 32, 176, 36, 101, 240, 118, 187, 96, 228, 123, 81, 81, 
+  110, 73, 107, 161, 201, 181, 144, 216, 80, 173, 110, 157, 97, 102, 205, 130, 
+  119, 176, 31, 140, 130, 111, 186, 235, 26, 122, 18, 44, 125, 37, 103, 55, 
+  198, 30, 70, 142, 202, 210, 142, 96, 4, 134, 138, 120, 195, 197, 163, 179, 
+  146, 156, 171, 102, 88, 35, 75, 155, 0, 214, 2, 202, 254, 86, 205, 233, 
+  137, 255, 42, 127, 153, 157, 250, 5, 76, 195, 37, 164, 103, 222, 50, 6, 
+  238, 42, 159, 181, 178, 210, 158, 163, 162, 135, 191, 69, 71, 119, 125, 33, 
+  63, 140, 94, 55, 75, 245, 0, 59, 124, 33, 57, 122, 109, 243, 129, 122, 
+  212, 213, 37, 54, 95, 67, 93, 7, 200, 138, 187, 98, 94, 102, 132, 107, 
+  232, 172, 241, 91, 124, 155, 158, 160, 206, 8, 241, 48, 73, 251, 75, 250, 
+  181, 140, 173, 55, 44, 251, 30, 72, 126, 113, 95, 222, 232, 201, 42, 208, 
+  173, 57, 158, 156, 36, 25, 55, 180, 65, 210, 15, 77, 108, 105, 58, 244, 
+  179, 237, 194, 99, 125, 191, 116, 219, 123, 162, 150, 156, 158, 107, 123, 0, 
+  92, 69, 122, 104, 207, 92, 249, 133, 43, 168, 127, 35, 137, 214, 17, 210, 
+  112, 91, 242, 43, 102, 224, 176, 236, 51, 238, 181, 111, 194, 185, 42, 155, 
+  1, 121, 233, 89, 111, 139, 9, 35, 183, 114, 232, 69, 240, 75, 184, 176, 
+  189, 126, 15, 176, 246, 25, 79, 195, 172, 194, 51, 3, 182, 20, 3, 106, 
+  164, 203, 75, 142, 101, 100, 158, 25, 153, 229, 216, 66, 15, 221, 16, 56, 
+  167, 169, 72, 245, 152, 17, 10, 85, 7, 216, 26, 249, 31, 176, 171, 129, 
+  120, 144, 26, 61, 199, 244, 210, 173, 16, 54, 235, 150, 5, 40, 103, 185, 
+  204, 235, 221, 189, 237, 185, 194, 19, 213, 16, 240, 243, 135, 54, 20, 178, 
+  56, 41, 128, 58, 59, 170, 141, 83, 232, 14, 238, 58, 135, 177, 104, 227, 
+  78, 4, 98, 87, 164, 130, 64, 105, 175, 57, 11, 24, 168, 108, 27, 16, 
+  236, 143, 209, 233, 87, 89, 97, 235, 125, 38, 78, 41, 10, 21, 243, 153, 
+  22, 66, 72, 21, 202, 118, 85, 94, 124, 63, 155, 168, 144, 232, 14, 89, 
+  86, 81, 61, 111, 165, 241, 165, 238, 44, 188, 99, 247, 126, 239, 4, 101, 
+  108, 98, 46, 239, 129, 148, 26, 91, 186, 57, 54, 7, 10, 147, 13, 35, 
+  224, 32, 191, 103, 190, 239, 88, 126, 40, 60, 138, 145, 154, 87, 159, 214, 
+  217, 195, 254, 76, 83, 17, 87, 156, 100, 244, 185, 6, 113, 53, 22, 111, 
+  98, 173, 102, 109, 218, 76, 147, 55, 178, 119, 195, 18, 79, 86, 101, 73, 
+  105, 152, 109, 177, 17, 61, 81, 69, 246, 49, 114, 114, 25, 36, 166, 151, 
+  103, 170, 216, 83, 88, 184, 112, 56, 152, 151, 51, 24, 210, 62, 230, 97, 
+  15, 203, 81, 114, 246, 160, 32, 231, 41, 15, 75, 78, 233, 105, 80, 244, 
+  41, 219, 111, 84, 123, 167, 199, 65, 97, 14, 220, 250, 15, 54, 223, 183, 
+  101, 129, 96, 204, 203, 85, 153, 77, 217, 92, 112, 224, 74, 137, 121, 157, 
+  202, 211, 227, 134, 173, 13, 154, 165, 121, 180, 219, 212, 101, 208, 160, 152, 
+  155, 4, 234, 206, 135, 150, 173, 214, 253, 114, 185, 226, 158, 130, 232, 5, 
+  168, 252, 215, 232, 7, 114, 33, 178, 145, 69, 73, 175, 242, 5, 68, 91, 
+  232, 2, 141, 156, 79, 150, 249, 10, 179, 70, 95, 46, 196, 94, 112, 85, 
+  112, 24, 241, 140, 66, 76, 32, 226, 243, 153, 149, 177, 199, 18, 108, 12, 
+  164, 142, 180, 72, 60, 194, 93, 95, 242, 147, 148, 11, 44, 198, 109, 131, 
+  16, 71, 165, 36, 141, 248, 4, 78, 101, 120, 182, 185, 181, 248, 16, 181, 
+  126, 92, 141, 179, 36, 142, 254, 182, 132, 149, 73, 91, 189, 168, 245, 34, 
+  157, 158, 167, 37, 140, 3, 126, 20, 241, 188, 232, 3, 122, 103, 19, 85, 
+  245, 151, 52, 59, 57, 197, 6, 70, 192, 166, 201, 115, 24, 239, 146, 21, 
+  221, 240, 124, 158, 207, 77, 87, 110, 114, 240, 124, 181, 156, 82, 244, 227, 
+  237, 108, 22, 159, 164, 27, 139, 249, 201, 14, 66, 244, 225, 253, 94, 246, 
+  243, 147, 215, 111, 47, 134, 255, 248, 219, 73, 190, 7, 159, 159, 246, 223, 
+  157, 62, 127, 119, 130, 95, 233, 159, 151, 79, 247, 254, 5, 127, 158, 61, 
+  127, 246, 232, 225, 143, 248, 224, 215, 225, 244, 249, 63, 127, 254, 231, 191, 
+  126, 190, 191, 245, 230, 245, 197, 163, 189, 87, 123, 167, 207, 254, 153, 46, 
+  247, 54, 222, 109, 252, 146, 255, 235, 245, 155, 139, 233, 222, 226, 239, 233, 
+  243, 71, 176, 106, 251, 217, 203, 205, 7, 247, 223, 150, 255, 250, 231, 217, 
+  226, 249, 191, 138, 100, 153, 156, 92, 252, 113, 254, 230, 255, 238, 143, 226, 
+  119, 171, 209, 47, 207, 191, 249, 229, 31, 143, 182, 30, 252, 253, 197, 179, 
+  201, 147, 191, 239, 95, 230, 79, 38, 255, 248, 118, 255, 95, 201, 124, 239, 
+  44, 121, 241, 225, 244, 201, 79, 127, 63, 121, 247, 143, 215, 191, 110, 45, 
+  238, 237, 61, 250, 105, 99, 56, 43, 223, 188, 206, 39, 255, 124, 242, 195, 
+  222, 201, 230, 171, 116, 52, 47, 246, 222, 225, 112, 246, 246, 223, 253, 252, 
+  250, 237, 63, 30, 60, 253, 215, 203, 151, 187, 221, 94, 244, 85, 242, 13, 
+  254, 215, 190, 117, 101, 109, 85, 9, 127, 174, 89, 36, 84, 1, 10, 220, 
+  64, 136, 164, 88, 132, 240, 52, 30, 193, 110, 91, 149, 6, 162, 211, 116, 
+  2, 48, 30, 242, 143, 37, 175, 132, 252, 42, 243, 133, 253, 62, 202, 129, 
+  220, 204, 212, 79, 49, 100, 162, 101, 91, 194, 97, 135, 118, 76, 102, 128, 
+  95, 102, 175, 236, 167, 28, 153, 226, 139, 108, 12, 86, 54, 80, 131, 7, 
+  89, 57, 77, 95, 16, 210, 1, 4, 183, 134, 66, 163, 247, 213, 91, 180, 
+  44, 38, 12, 111, 132, 173, 180, 213, 47, 177, 120, 123, 45, 80, 248, 229, 
+  169, 96, 121, 117, 16, 166, 50, 86, 216, 71, 153, 19, 155, 207, 167, 89, 
+  210, 214, 111, 126, 201, 146, 242, 116, 59, 218, 212, 207, 158, 230, 83, 188, 
+  185, 111, 127, 53, 217, 194, 255, 162, 175, 190, 253, 246, 91, 249, 135, 159, 
+  152, 213, 103, 91, 27, 40, 137, 91, 244, 193, 194, 140, 105, 108, 234, 223, 
+  187, 119, 175, 45, 177, 193, 254, 43, 76, 193, 153, 159, 198, 73, 126, 1, 
+  181, 134, 209, 61, 232, 4, 255, 223, 223, 132, 127, 46, 78, 51, 108, 1, 
+  89, 154, 175, 38, 67, 252, 15, 216, 26, 238, 170, 61, 72, 103, 139, 242, 
+  50, 250, 62, 122, 12, 135, 171, 227, 161, 116, 107, 180, 247, 13, 215, 100, 
+  177, 95, 214, 74, 50, 121, 224, 94, 184, 118, 161, 48, 173, 133, 76, 100, 
+  6, 252, 81, 54, 63, 64, 236, 110, 90, 13, 140, 251, 57, 153, 230, 23, 
+  255, 66, 48, 172, 202, 188, 237, 63, 254, 21, 30, 159, 102, 73, 146, 206, 
+  219, 213, 81, 189, 138, 139, 179, 155, 142, 106, 6, 101, 219, 106, 183, 181, 
+  55, 135, 195, 191, 4, 24, 51, 236, 69, 38, 8, 40, 58, 201, 33, 103, 
+  144, 4, 196, 208, 34, 66, 146, 24, 172, 201, 23, 241, 56, 163, 11, 255, 
+  161, 89, 218, 246, 192, 84, 175, 128, 188, 92, 7, 12, 61, 24, 13, 141, 
+  26, 186, 16, 244, 60, 120, 52, 84, 101, 93, 72, 84, 120, 39, 165, 162, 
+  225, 224, 65, 17, 141, 87, 163, 108, 220, 31, 165, 127, 100, 192, 213, 194, 
+  147, 30, 78, 122, 56, 248, 6, 255, 121, 208, 109, 92, 127, 225, 36, 214, 
+  18, 65, 153, 84, 221, 94, 26, 214, 156, 41, 22, 93, 55, 162, 175, 210, 
+  24, 255, 179, 42, 154, 151, 32, 123, 46, 209, 238, 188, 144, 91, 21, 195, 
+  112, 185, 121, 57, 191, 164, 109, 83, 43, 156, 183, 235, 173, 79, 219, 15, 
+  102, 184, 249, 160, 104, 223, 242, 240, 171, 130, 94, 183, 212, 140, 155, 180, 
+  145, 191, 19, 45, 234, 69, 191, 35, 170, 195, 31, 89, 108, 205, 221, 83, 
+  9, 129, 154, 166, 119, 198, 160, 91, 201, 140, 216, 136, 95, 18, 119, 91, 
+  80, 48, 24, 142, 14, 245, 111, 187, 234, 217, 166, 122, 122, 135, 216, 150, 
+  162, 174, 214, 238, 218, 232, 45, 110, 94, 212, 146, 167, 26, 52, 77, 43, 
+  205, 129, 148, 18, 25, 20, 102, 111, 126, 175, 109, 122, 20, 164, 87, 50, 
+  35, 213, 13, 171, 172, 210, 182, 41, 173, 219, 104, 19, 17, 3, 148, 185, 
+  173, 243, 79, 123, 9, 218, 126, 151, 55, 53, 99, 97, 89, 145, 87, 202, 
+  175, 99, 150, 207, 73, 206, 39, 75, 204, 165, 180, 42, 73, 109, 139, 14, 
+  15, 40, 213, 140, 167, 217, 248, 140, 18, 58, 240, 37, 236, 50, 159, 210, 
+  29, 157, 70, 24, 105, 202, 119, 121, 42, 158, 9, 49, 240, 245, 44, 122, 
+  102, 134, 92, 224, 228, 110, 171, 10, 50, 164, 47, 116, 206, 31, 228, 249, 
+  116, 20, 223, 36, 160, 203, 245, 231, 188, 147, 149, 246, 150, 229, 117, 164, 
+  33, 94, 150, 30, 89, 64, 138, 5, 39, 22, 157, 189, 209, 87, 241, 16, 
+  255, 115, 180, 147, 33, 83, 37, 157, 193, 81, 204, 71, 105, 221, 81, 134, 
+  103, 47, 254, 255, 62, 252, 127, 121, 50, 138, 59, 195, 30, 254, 55, 184, 
+  111, 8, 92, 216, 213, 246, 41, 210, 131, 155, 30, 143, 149, 218, 132, 99, 
+  233, 218, 234, 120, 64, 155, 255, 127, 53, 153, 76, 124, 74, 43, 49, 233, 
+  64, 54, 51, 242, 231, 52, 30, 165, 211, 91, 90, 152, 251, 49, 155, 35, 
+  94, 89, 152, 135, 192, 246, 161, 147, 205, 79, 129, 249, 247, 161, 254, 132, 
+  78, 16, 159, 189, 185, 224, 95, 143, 252, 131, 112, 171, 202, 108, 240, 252, 
+  221, 193, 96, 70, 133, 227, 92, 55, 44, 19, 185, 209, 184, 171, 101, 120, 
+  217, 207, 227, 73, 41, 102, 117, 25, 163, 167, 140, 30, 204, 55, 254, 96, 
+  54, 183, 106, 78, 148, 45, 205, 96, 192, 240, 238, 243, 114, 87, 216, 176, 
+  33, 66, 220, 140, 59, 112, 215, 210, 83, 232, 4, 234, 31, 253, 206, 16, 
+  80, 189, 18, 150, 168, 58, 12, 108, 250, 212, 212, 250, 40, 51, 189, 119, 
+  245, 231, 234, 63, 184, 34, 162, 126, 85, 157, 219, 223, 242, 218, 105, 29, 
+  70, 31, 5, 54, 63, 18, 143, 121, 175, 103, 96, 69, 76, 218, 38, 208, 
+  243, 214, 251, 213, 214, 131, 209, 195, 86, 164, 28, 199, 128, 195, 34, 109, 
+  82, 51, 27, 224, 73, 166, 175, 210, 249, 52, 71, 137, 244, 85, 62, 143, 
+  199, 121, 141, 56, 234, 243, 201, 247, 121, 99, 240, 43, 75, 33, 54, 29, 
+  133, 0, 65, 77, 191, 180, 36, 224, 201, 147, 39, 209, 87, 63, 12, 241, 
+  63, 247, 23, 30, 234, 194, 111, 227, 36, 91, 21, 56, 85, 124, 102, 60, 
+  53, 160, 54, 49, 214, 92, 210, 162, 17, 50, 211, 155, 195, 197, 23, 150, 
+  175, 132, 238, 126, 177, 123, 117, 92, 18, 213, 230, 245, 50, 84, 201, 133, 
+  111, 34, 61, 241, 131, 3, 102, 145, 221, 10, 176, 64, 81, 67, 78, 252, 
+  98, 32, 17, 213, 108, 65, 252, 239, 190, 3, 170, 26, 250, 128, 149, 107, 
+  164, 71, 167, 106, 31, 49, 207, 100, 27, 56, 191, 146, 206, 140, 200, 220, 
+  211, 109, 19, 94, 110, 142, 70, 173, 158, 183, 57, 136, 249, 128, 151, 111, 
+  83, 73, 67, 11, 43, 153, 150, 38, 221, 113, 235, 170, 167, 90, 93, 196, 
+  171, 2, 57, 206, 72, 181, 218, 254, 244, 169, 237, 183, 168, 91, 125, 131, 
+  53, 162, 244, 67, 58, 94, 225, 222, 242, 155, 59, 201, 109, 77, 219, 92, 
+  176, 249, 122, 149, 65, 174, 102, 141, 237, 21, 101, 186, 120, 13, 199, 16, 
+  180, 234, 79, 58, 189, 215, 48, 233, 125, 168, 65, 156, 172, 227, 54, 144, 
+  47, 44, 170, 237, 190, 156, 211, 88, 131, 118, 183, 214, 181, 75, 70, 190, 
+  215, 181, 251, 122, 85, 179, 72, 233, 112, 237, 120, 87, 20, 145, 199, 180, 
+  236, 183, 41, 26, 74, 175, 205, 58, 98, 221, 179, 109, 210, 6, 144, 106, 
+  216, 246, 98, 85, 182, 174, 110, 29, 133, 120, 214, 148, 240, 126, 78, 92, 
+  29, 166, 196, 163, 163, 124, 63, 45, 123, 104, 208, 149, 234, 123, 238, 70, 
+  222, 91, 93, 183, 115, 50, 109, 212, 172, 90, 190, 158, 227, 201, 52, 167, 
+  183, 50, 151, 0, 246, 138, 73, 246, 66, 16, 53, 122, 84, 115, 95, 5, 
+  37, 14, 71, 3, 14, 161, 198, 39, 175, 233, 96, 52, 16, 184, 245, 130, 
+  171, 18, 36, 208, 63, 196, 179, 108, 138, 226, 162, 213, 20, 214, 40, 10, 
+  205, 231, 107, 129, 205, 118, 100, 128, 228, 191, 166, 103, 123, 75, 216, 225, 
+  56, 146, 224, 165, 172, 206, 104, 64, 95, 220, 173, 140, 186, 149, 84, 44, 
+  58, 93, 42, 118, 8, 22, 26, 56, 115, 119, 226, 232, 3, 72, 73, 70, 
+  107, 69, 142, 240, 166, 212, 52, 167, 69, 14, 229, 187, 120, 165, 22, 190, 
+  114, 227, 217, 49, 149, 213, 146, 63, 39, 148, 49, 214, 241, 47, 159, 21, 
+  59, 70, 105, 64, 6, 244, 148, 29, 175, 184, 118, 132, 107, 46, 190, 106, 
+  66, 173, 224, 194, 159, 29, 9, 227, 217, 17, 3, 120, 115, 117, 127, 214, 
+  165, 72, 58, 53, 198, 97, 26, 191, 61, 176, 21, 217, 12, 3, 30, 7, 
+  2, 75, 37, 254, 40, 118, 11, 216, 86, 55, 26, 140, 94, 55, 129, 99, 
+  166, 18, 187, 69, 176, 166, 99, 77, 48, 212, 120, 110, 28, 136, 242, 38, 
+  167, 43, 210, 204, 105, 124, 249, 229, 172, 214, 232, 162, 136, 27, 117, 215, 
+  224, 53, 60, 143, 61, 94, 115, 46, 220, 151, 173, 39, 44, 78, 147, 122, 
+  143, 153, 13, 230, 191, 148, 146, 135, 31, 191, 173, 40, 127, 180, 50, 208, 
+  211, 5, 10, 15, 216, 126, 100, 244, 88, 179, 108, 46, 220, 241, 189, 111, 
+  184, 8, 107, 186, 182, 76, 1, 171, 90, 122, 104, 171, 196, 31, 94, 200, 
+  195, 123, 67, 174, 83, 213, 140, 248, 108, 217, 125, 119, 218, 63, 188, 247, 
+  205, 253, 189, 71, 117, 204, 22, 203, 19, 158, 190, 231, 171, 31, 126, 248, 
+  129, 139, 26, 94, 17, 91, 178, 148, 72, 203, 22, 2, 124, 180, 121, 172, 
+  87, 239, 85, 32, 143, 38, 11, 1, 103, 185, 85, 153, 78, 49, 6, 145, 
+  125, 90, 211, 145, 189, 243, 19, 90, 122, 77, 103, 76, 167, 175, 89, 101, 
+  2, 253, 150, 94, 181, 45, 59, 121, 224, 190, 128, 56, 110, 61, 224, 245, 
+  5, 190, 222, 172, 193, 214, 166, 199, 142, 242, 12, 172, 238, 56, 126, 112, 
+  111, 114, 79, 200, 52, 78, 184, 34, 92, 110, 25, 121, 247, 209, 102, 239, 
+  222, 22, 254, 111, 56, 216, 218, 234, 214, 204, 216, 145, 213, 235, 64, 203, 
+  221, 1, 97, 91, 192, 15, 239, 138, 168, 170, 20, 165, 190, 55, 191, 189, 
+  223, 139, 220, 63, 195, 193, 67, 59, 0, 213, 121, 211, 129, 140, 243, 186, 
+  241, 185, 75, 218, 51, 179, 118, 222, 90, 154, 51, 2, 249, 145, 173, 111, 
+  31, 181, 244, 105, 232, 14, 54, 34, 129, 101, 126, 114, 226, 107, 132, 92, 
+  73, 57, 198, 218, 79, 167, 104, 9, 193, 97, 93, 218, 205, 39, 152, 173, 
+  232, 83, 15, 51, 24, 143, 60, 42, 28, 183, 217, 246, 112, 238, 254, 65, 
+  202, 179, 179, 143, 216, 69, 220, 167, 224, 167, 249, 5, 229, 184, 80, 81, 
+  75, 197, 142, 39, 159, 207, 114, 188, 142, 148, 2, 22, 198, 233, 121, 25, 
+  18, 120, 120, 52, 32, 45, 215, 155, 83, 188, 41, 221, 221, 141, 240, 201, 
+  222, 193, 239, 7, 123, 111, 255, 246, 252, 160, 214, 238, 2, 123, 246, 210, 
+  126, 153, 15, 86, 21, 165, 217, 179, 116, 18, 175, 166, 101, 120, 54, 96, 
+  137, 2, 118, 136, 73, 104, 5, 195, 170, 49, 222, 240, 50, 91, 95, 133, 
+  8, 132, 221, 123, 211, 170, 216, 210, 221, 190, 13, 127, 61, 179, 183, 200, 
+  102, 124, 71, 168, 85, 25, 43, 109, 2, 228, 65, 151, 26, 178, 56, 135, 
+  214, 117, 120, 173, 173, 211, 36, 162, 205, 97, 27, 139, 247, 129, 106, 166, 
+  214, 236, 181, 198, 222, 142, 74, 175, 230, 47, 232, 66, 29, 90, 114, 55, 
+  235, 29, 19, 72, 103, 192, 138, 229, 246, 89, 122, 137, 171, 7, 236, 48, 
+  193, 57, 228, 233, 218, 239, 238, 14, 135, 155, 79, 218, 219, 110, 176, 14, 
+  102, 82, 199, 69, 21, 208, 129, 16, 99, 180, 245, 232, 124, 84, 251, 122, 
+  52, 205, 199, 103, 208, 145, 190, 205, 128, 42, 94, 127, 88, 233, 192, 170, 
+  216, 59, 31, 93, 217, 205, 54, 240, 24, 15, 134, 67, 223, 207, 190, 97, 
+  206, 157, 112, 32, 245, 109, 14, 177, 205, 173, 7, 195, 234, 24, 58, 31, 
+  3, 122, 100, 249, 202, 91, 220, 38, 201, 130, 157, 58, 172, 225, 221, 222, 
+  108, 253, 70, 72, 125, 91, 225, 200, 23, 101, 85, 94, 61, 123, 242, 229, 
+  216, 148, 106, 35, 17, 153, 141, 68, 213, 178, 46, 230, 76, 158, 164, 7, 
+  57, 153, 156, 208, 117, 4, 186, 137, 90, 38, 217, 68, 228, 210, 207, 56, 
+  48, 22, 75, 206, 54, 52, 91, 155, 228, 226, 36, 138, 203, 109, 49, 14, 
+  148, 152, 93, 171, 57, 20, 114, 62, 132, 111, 87, 115, 52, 228, 67, 191, 
+  22, 93, 44, 253, 144, 97, 164, 45, 91, 236, 57, 252, 78, 19, 175, 8, 
+  97, 189, 42, 2, 148, 116, 142, 106, 246, 106, 99, 163, 85, 113, 169, 75, 
+  30, 176, 2, 0, 175, 240, 92, 14, 102, 87, 41, 97, 130, 180, 237, 109, 
+  123, 24, 2, 154, 231, 187, 82, 87, 86, 243, 69, 160, 122, 19, 147, 234, 
+  85, 43, 250, 131, 236, 104, 166, 84, 211, 177, 54, 75, 70, 250, 118, 168, 
+  176, 11, 128, 7, 23, 5, 54, 238, 132, 75, 211, 139, 160, 210, 128, 214, 
+  66, 145, 30, 94, 225, 93, 103, 53, 84, 57, 92, 164, 57, 213, 55, 52, 
+  209, 227, 138, 21, 207, 149, 154, 21, 55, 31, 127, 173, 66, 248, 138, 130, 
+  133, 242, 6, 166, 122, 253, 130, 234, 8, 87, 189, 60, 116, 181, 55, 71, 
+  223, 72, 122, 227, 215, 169, 95, 156, 14, 207, 249, 177, 204, 29, 246, 252, 
+  143, 121, 108, 86, 181, 209, 19, 254, 202, 193, 143, 191, 49, 0, 188, 3, 
+  148, 172, 60, 205, 69, 237, 110, 61, 228, 234, 164, 111, 116, 120, 187, 189, 
+  107, 182, 133, 21, 31, 195, 245, 170, 191, 73, 212, 87, 119, 133, 90, 109, 
+  250, 222, 179, 227, 241, 15, 121, 50, 208, 201, 136, 207, 161, 114, 238, 73, 
+  35, 125, 138, 216, 50, 172, 74, 13, 216, 99, 240, 25, 83, 80, 14, 27, 
+  141, 37, 17, 26, 25, 103, 183, 49, 46, 157, 227, 213, 18, 99, 127, 77, 
+  47, 251, 220, 29, 39, 5, 129, 53, 160, 80, 144, 178, 67, 216, 44, 237, 
+  218, 45, 226, 138, 173, 217, 35, 1, 154, 210, 250, 96, 30, 118, 237, 239, 
+  65, 73, 112, 120, 106, 53, 75, 6, 3, 133, 131, 47, 5, 172, 230, 14, 
+  43, 145, 177, 208, 225, 164, 46, 70, 65, 105, 242, 124, 18, 95, 209, 97, 
+  156, 230, 4, 91, 99, 38, 62, 232, 213, 168, 171, 9, 54, 4, 153, 107, 
+  25, 11, 67, 148, 81, 35, 194, 33, 178, 200, 30, 221, 181, 153, 126, 174, 
+  122, 225, 186, 50, 58, 233, 153, 40, 164, 157, 106, 83, 64, 103, 23, 104, 
+  104, 1, 65, 114, 218, 80, 235, 217, 53, 8, 223, 35, 144, 95, 143, 246, 
+  104, 10, 125, 27, 139, 86, 240, 95, 245, 125, 179, 109, 208, 166, 41, 68, 
+  63, 27, 4, 108, 247, 212, 12, 123, 193, 184, 155, 79, 228, 8, 173, 43, 
+  111, 130, 239, 69, 190, 90, 142, 83, 46, 62, 206, 151, 238, 156, 48, 174, 
+  215, 179, 188, 40, 251, 232, 152, 137, 200, 31, 249, 200, 143, 141, 113, 40, 
+  212, 40, 122, 199, 217, 8, 81, 111, 68, 241, 169, 240, 186, 152, 130, 68, 
+  82, 32, 82, 78, 19, 101, 122, 35, 7, 215, 172, 144, 12, 134, 201, 32, 
+  250, 97, 26, 159, 152, 28, 82, 178, 211, 72, 24, 68, 237, 168, 85, 17, 
+  15, 188, 171, 157, 41, 48, 59, 157, 88, 111, 143, 106, 206, 110, 249, 5, 
+  68, 250, 141, 73, 58, 142, 129, 183, 141, 107, 138, 175, 98, 242, 214, 57, 
+  63, 60, 67, 133, 98, 12, 127, 52, 59, 165, 50, 116, 243, 85, 165, 60, 
+  240, 115, 103, 145, 135, 57, 116, 90, 108, 20, 169, 68, 130, 215, 144, 224, 
+  124, 238, 11, 96, 203, 50, 76, 177, 181, 36, 152, 121, 30, 174, 0, 158, 
+  101, 60, 46, 81, 211, 247, 228, 77, 193, 56, 140, 133, 188, 40, 52, 180, 
+  36, 10, 165, 243, 58, 44, 30, 45, 10, 31, 125, 199, 172, 194, 25, 45, 
+  148, 59, 138, 76, 2, 158, 161, 219, 10, 252, 57, 196, 206, 142, 60, 100, 
+  86, 19, 48, 251, 40, 175, 79, 195, 57, 225, 81, 55, 69, 160, 225, 133, 
+  227, 129, 168, 19, 139, 94, 115, 191, 216, 26, 183, 225, 94, 7, 67, 176, 
+  61, 119, 188, 16, 80, 126, 0, 226, 220, 93, 218, 161, 253, 177, 144, 101, 
+  99, 138, 236, 211, 100, 83, 224, 230, 4, 217, 182, 83, 191, 143, 63, 178, 
+  18, 72, 84, 91, 234, 90, 232, 225, 195, 135, 150, 71, 39, 95, 70, 70, 
+  119, 92, 107, 167, 79, 149, 205, 100, 205, 166, 57, 244, 152, 13, 40, 135, 
+  219, 194, 29, 72, 34, 0, 96, 140, 191, 12, 227, 115, 112, 27, 238, 196, 
+  52, 170, 220, 245, 103, 196, 62, 109, 77, 178, 45, 79, 195, 181, 163, 61, 
+  206, 14, 142, 136, 33, 72, 181, 233, 209, 142, 95, 42, 99, 105, 130, 10, 
+  67, 49, 166, 12, 19, 154, 152, 46, 199, 68, 32, 8, 73, 160, 209, 219, 
+  124, 132, 90, 236, 234, 1, 114, 65, 159, 211, 81, 49, 204, 76, 149, 221, 
+  168, 197, 1, 211, 90, 117, 225, 116, 176, 130, 130, 59, 82, 242, 186, 254, 
+  205, 71, 23, 229, 146, 59, 181, 229, 132, 63, 41, 81, 145, 209, 41, 4, 
+  158, 141, 123, 185, 91, 109, 164, 154, 124, 80, 114, 26, 197, 39, 120, 229, 
+  77, 103, 18, 133, 107, 144, 99, 231, 177, 192, 152, 72, 229, 118, 164, 34, 
+  99, 86, 91, 172, 134, 176, 212, 136, 71, 37, 60, 83, 160, 230, 51, 216, 
+  98, 74, 192, 227, 213, 216, 24, 153, 211, 160, 203, 129, 178, 206, 210, 116, 
+  17, 25, 187, 127, 67, 253, 215, 28, 97, 124, 147, 85, 149, 225, 148, 209, 
+  197, 181, 204, 150, 42, 119, 3, 137, 228, 6, 7, 244, 83, 123, 47, 167, 
+  92, 11, 20, 187, 209, 13, 110, 21, 254, 224, 141, 135, 137, 93, 58, 237, 
+  225, 95, 218, 149, 215, 152, 129, 228, 245, 34, 69, 134, 182, 125, 239, 155, 
+  191, 180, 245, 251, 53, 50, 58, 126, 76, 48, 127, 219, 86, 109, 246, 28, 
+  138, 205, 71, 120, 131, 221, 7, 72, 238, 85, 55, 67, 81, 252, 91, 125, 
+  236, 167, 234, 208, 131, 128, 254, 216, 44, 118, 23, 106, 178, 188, 234, 138, 
+  140, 59, 18, 222, 132, 14, 114, 113, 95, 131, 14, 161, 76, 255, 68, 46, 
+  210, 255, 59, 137, 254, 80, 93, 185, 243, 197, 182, 190, 142, 182, 87, 200, 
+  181, 20, 128, 63, 234, 58, 216, 222, 226, 30, 173, 81, 14, 28, 218, 235, 
+  120, 221, 117, 109, 205, 64, 196, 63, 188, 182, 66, 160, 96, 88, 87, 193, 
+  23, 57, 109, 133, 160, 148, 211, 7, 200, 157, 178, 236, 64, 125, 195, 236, 
+  239, 64, 85, 110, 237, 241, 58, 38, 126, 89, 186, 243, 24, 187, 185, 213, 
+  108, 55, 95, 105, 146, 223, 50, 29, 83, 187, 110, 102, 21, 65, 94, 130, 
+  185, 242, 182, 242, 244, 172, 117, 120, 142, 20, 46, 166, 254, 244, 237, 168, 
+  67, 102, 149, 150, 205, 24, 234, 5, 58, 12, 65, 197, 42, 177, 172, 191, 
+  144, 215, 132, 198, 204, 218, 94, 88, 50, 132, 6, 234, 102, 182, 105, 171, 
+  200, 125, 69, 221, 86, 193, 177, 254, 35, 189, 172, 191, 197, 107, 176, 8, 
+  178, 119, 105, 155, 15, 205, 3, 115, 75, 179, 249, 173, 190, 198, 250, 22, 
+  216, 28, 182, 115, 66, 226, 184, 90, 102, 233, 18, 25, 138, 121, 94, 44, 
+  226, 177, 92, 149, 232, 59, 30, 169, 29, 152, 168, 69, 67, 188, 189, 105, 
+  251, 23, 62, 246, 198, 204, 191, 72, 123, 240, 237, 131, 231, 143, 238, 7, 
+  215, 114, 91, 142, 219, 218, 218, 132, 255, 238, 55, 219, 64, 89, 19, 31, 
+  107, 71, 245, 205, 214, 55, 143, 246, 126, 208, 53, 144, 135, 171, 125, 109, 
+  77, 165, 212, 128, 81, 180, 217, 155, 102, 39, 248, 24, 89, 92, 32, 26, 
+  234, 202, 233, 224, 128, 97, 15, 255, 86, 12, 148, 202, 24, 33, 80, 26, 
+  59, 197, 38, 39, 37, 1, 53, 62, 137, 232, 218, 80, 0, 109, 252, 37, 
+  60, 240, 214, 27, 251, 137, 18, 216, 203, 196, 249, 98, 179, 138, 18, 53, 
+  67, 80, 119, 118, 237, 205, 173, 7, 127, 241, 88, 217, 23, 111, 171, 109, 
+  200, 180, 78, 151, 94, 201, 3, 177, 12, 174, 47, 92, 226, 91, 191, 124, 
+  115, 203, 101, 208, 242, 139, 230, 146, 167, 48, 126, 189, 62, 130, 227, 14, 
+  255, 30, 120, 45, 61, 107, 110, 41, 169, 212, 226, 181, 177, 113, 136, 243, 
+  11, 12, 187, 216, 163, 104, 176, 53, 250, 131, 131, 183, 214, 144, 242, 224, 
+  133, 249, 138, 1, 18, 123, 208, 173, 249, 205, 117, 253, 160, 13, 182, 135, 
+  167, 123, 97, 152, 79, 107, 214, 72, 72, 230, 55, 170, 30, 180, 227, 105, 
+  217, 14, 30, 141, 203, 41, 144, 202, 35, 175, 39, 178, 220, 231, 91, 231, 
+  67, 219, 199, 139, 77, 59, 238, 54, 52, 48, 202, 227, 101, 18, 237, 159, 
+  230, 203, 18, 68, 244, 162, 29, 169, 43, 187, 23, 111, 107, 236, 66, 105, 
+  221, 107, 239, 0, 17, 98, 56, 169, 54, 90, 77, 125, 123, 15, 71, 216, 
+  110, 178, 233, 106, 7, 55, 131, 126, 221, 45, 87, 183, 198, 110, 107, 125, 
+  221, 161, 234, 151, 109, 179, 140, 54, 194, 37, 204, 108, 168, 207, 123, 189, 
+  203, 12, 98, 153, 205, 87, 202, 184, 173, 177, 18, 211, 69, 172, 132, 92, 
+  212, 198, 152, 238, 86, 237, 225, 85, 83, 201, 91, 219, 246, 99, 30, 238, 
+  105, 126, 177, 1, 66, 224, 44, 43, 10, 54, 48, 78, 224, 52, 201, 79, 
+  84, 220, 109, 254, 118, 228, 203, 199, 250, 46, 72, 95, 187, 238, 52, 196, 
+  79, 66, 117, 32, 47, 244, 186, 107, 21, 138, 94, 48, 157, 90, 164, 232, 
+  8, 223, 214, 51, 167, 18, 226, 172, 145, 115, 65, 52, 90, 44, 80, 217, 
+  116, 44, 215, 123, 199, 198, 197, 160, 48, 236, 72, 52, 74, 79, 227, 243, 
+  12, 85, 53, 100, 70, 116, 145, 21, 105, 207, 214, 167, 216, 109, 99, 186, 
+  129, 49, 86, 213, 51, 242, 177, 99, 3, 135, 46, 75, 195, 55, 186, 86, 
+  196, 52, 7, 250, 86, 113, 239, 247, 167, 191, 63, 131, 87, 219, 62, 239, 
+  109, 248, 80, 107, 47, 212, 113, 236, 33, 38, 229, 232, 121, 13, 136, 13, 
+  203, 77, 90, 0, 166, 178, 90, 159, 245, 7, 55, 26, 0, 240, 155, 213, 
+  250, 207, 17, 43, 175, 111, 0, 216, 92, 191, 110, 27, 43, 227, 149, 234, 
+  214, 176, 125, 125, 117, 139, 177, 59, 97, 92, 215, 245, 144, 199, 100, 137, 
+  69, 221, 141, 110, 251, 113, 216, 171, 183, 21, 208, 200, 144, 227, 98, 83, 
+  22, 196, 75, 187, 246, 120, 5, 67, 248, 48, 24, 12, 42, 42, 2, 59, 
+  0, 246, 81, 48, 30, 250, 183, 119, 93, 214, 150, 65, 232, 155, 99, 55, 
+  95, 109, 102, 48, 154, 170, 247, 75, 112, 188, 134, 193, 84, 173, 248, 249, 
+  241, 180, 216, 109, 129, 215, 176, 3, 229, 210, 180, 137, 177, 51, 175, 175, 
+  241, 3, 4, 94, 212, 48, 37, 82, 227, 6, 146, 241, 141, 44, 80, 188, 
+  43, 57, 98, 248, 149, 92, 92, 115, 103, 161, 110, 66, 180, 190, 158, 21, 
+  109, 74, 71, 70, 122, 15, 171, 197, 187, 166, 44, 107, 13, 118, 181, 134, 
+  160, 126, 24, 70, 162, 220, 213, 162, 140, 215, 184, 47, 146, 184, 154, 134, 
+  193, 222, 13, 57, 42, 99, 234, 112, 45, 17, 92, 103, 50, 99, 130, 42, 
+  88, 23, 7, 15, 137, 190, 102, 239, 71, 102, 194, 140, 64, 131, 210, 116, 
+  175, 174, 152, 45, 18, 90, 165, 162, 77, 214, 250, 142, 76, 57, 238, 233, 
+  222, 86, 85, 228, 229, 86, 204, 220, 170, 175, 205, 16, 174, 239, 135, 138, 
+  163, 121, 31, 119, 102, 212, 37, 247, 80, 97, 81, 47, 106, 127, 45, 166, 
+  100, 180, 68, 205, 237, 221, 180, 115, 127, 178, 166, 255, 7, 205, 253, 187, 
+  249, 243, 109, 101, 115, 33, 3, 5, 198, 250, 171, 46, 255, 167, 92, 87, 
+  45, 74, 144, 60, 87, 137, 12, 34, 123, 212, 4, 7, 113, 49, 56, 62, 
+  35, 89, 150, 152, 245, 33, 46, 0, 245, 161, 72, 118, 68, 13, 110, 221, 
+  106, 185, 192, 33, 173, 155, 5, 14, 249, 95, 133, 187, 224, 148, 63, 11, 
+  32, 145, 233, 83, 52, 74, 91, 23, 130, 67, 151, 51, 194, 149, 53, 93, 
+  92, 235, 127, 167, 45, 22, 155, 35, 62, 52, 185, 133, 176, 102, 197, 137, 
+  201, 136, 98, 158, 131, 183, 40, 251, 183, 220, 255, 3, 199, 234, 173, 71, 
+  158, 183, 217, 214, 195, 138, 143, 8, 74, 192, 242, 127, 235, 9, 84, 231, 
+  10, 68, 30, 190, 139, 120, 105, 205, 108, 3, 9, 119, 243, 126, 85, 36, 
+  196, 238, 12, 243, 180, 183, 4, 82, 30, 157, 192, 81, 88, 0, 214, 44, 
+  153, 241, 68, 11, 238, 121, 105, 18, 90, 1, 243, 85, 94, 96, 132, 35, 
+  118, 170, 217, 120, 21, 143, 233, 46, 226, 7, 88, 148, 73, 254, 1, 127, 
+  87, 133, 210, 111, 208, 239, 137, 26, 175, 11, 190, 81, 35, 32, 11, 64, 
+  208, 9, 122, 31, 25, 98, 90, 11, 140, 27, 212, 118, 131, 245, 124, 208, 
+  157, 25, 168, 113, 151, 164, 150, 17, 30, 152, 230, 136, 164, 66, 248, 78, 
+  204, 9, 192, 171, 7, 255, 239, 234, 66, 198, 76, 245, 171, 143, 182, 206, 
+  85, 52, 28, 12, 31, 20, 214, 243, 242, 177, 241, 104, 244, 220, 24, 109, 
+  199, 195, 161, 231, 99, 174, 45, 80, 215, 120, 92, 6, 94, 233, 50, 86, 
+  193, 59, 197, 252, 136, 23, 165, 215, 245, 141, 103, 88, 59, 40, 237, 115, 
+  201, 222, 230, 142, 255, 240, 187, 38, 247, 207, 74, 207, 205, 129, 34, 252, 
+  18, 86, 79, 18, 199, 241, 186, 241, 168, 189, 102, 27, 168, 6, 22, 72, 
+  239, 227, 127, 149, 142, 170, 222, 173, 247, 2, 88, 111, 62, 168, 64, 67, 
+  175, 123, 8, 241, 245, 80, 15, 59, 165, 8, 19, 125, 207, 200, 152, 187, 
+  29, 14, 54, 239, 129, 64, 86, 49, 65, 222, 122, 240, 160, 103, 254, 63, 
+  28, 124, 27, 14, 173, 126, 242, 213, 221, 189, 6, 218, 143, 30, 61, 34, 
+  207, 64, 249, 7, 126, 182, 189, 42, 225, 53, 144, 114, 182, 53, 38, 192, 
+  154, 239, 3, 169, 153, 50, 160, 210, 157, 61, 189, 229, 176, 236, 214, 209, 
+  37, 114, 57, 175, 177, 48, 70, 110, 53, 246, 2, 166, 61, 42, 95, 138, 
+  93, 23, 178, 8, 101, 182, 184, 37, 22, 201, 38, 186, 168, 127, 175, 113, 
+  139, 193, 110, 131, 161, 125, 93, 245, 193, 151, 160, 124, 166, 85, 87, 170, 
+  98, 173, 42, 110, 33, 200, 106, 123, 188, 22, 249, 103, 200, 193, 84, 181, 
+  91, 85, 121, 167, 200, 182, 178, 14, 39, 239, 77, 134, 233, 189, 118, 175, 
+  130, 240, 201, 228, 254, 104, 179, 125, 229, 55, 161, 205, 57, 171, 141, 85, 
+  90, 65, 51, 207, 123, 195, 97, 56, 12, 15, 121, 219, 54, 142, 161, 64, 
+  147, 167, 26, 248, 217, 179, 71, 142, 245, 94, 177, 15, 200, 22, 216, 254, 
+  218, 241, 33, 174, 74, 237, 70, 149, 54, 240, 211, 96, 27, 172, 155, 15, 
+  26, 175, 9, 93, 48, 55, 254, 253, 174, 11, 55, 144, 218, 110, 57, 134, 
+  42, 229, 62, 53, 172, 129, 230, 0, 172, 213, 177, 92, 58, 202, 99, 27, 
+  8, 150, 70, 91, 107, 135, 171, 218, 180, 177, 4, 61, 224, 218, 198, 106, 
+  239, 224, 28, 174, 10, 214, 87, 6, 109, 94, 216, 136, 196, 188, 129, 252, 
+  190, 40, 208, 116, 193, 225, 3, 49, 150, 224, 24, 47, 255, 57, 139, 162, 
+  152, 189, 183, 11, 219, 59, 136, 95, 229, 37, 73, 186, 20, 123, 208, 92, 
+  184, 82, 164, 45, 74, 120, 128, 169, 92, 140, 170, 134, 226, 15, 154, 169, 
+  32, 234, 55, 155, 251, 218, 157, 17, 152, 12, 87, 248, 81, 110, 206, 176, 
+  163, 134, 169, 251, 12, 102, 20, 59, 217, 150, 168, 37, 134, 17, 221, 137, 
+  48, 60, 60, 53, 86, 126, 40, 63, 151, 45, 37, 16, 18, 167, 178, 29, 
+  29, 14, 65, 248, 223, 60, 2, 25, 249, 123, 243, 221, 105, 167, 168, 76, 
+  199, 218, 160, 139, 64, 254, 42, 46, 79, 65, 132, 154, 119, 232, 203, 155, 
+  151, 27, 91, 209, 157, 104, 110, 197, 240, 104, 47, 73, 96, 37, 218, 110, 
+  27, 182, 43, 9, 249, 40, 72, 39, 144, 76, 36, 129, 58, 175, 197, 20, 
+  200, 75, 114, 41, 33, 207, 76, 216, 252, 129, 151, 198, 67, 209, 8, 74, 
+  32, 252, 106, 191, 46, 131, 10, 135, 28, 52, 65, 144, 85, 98, 163, 106, 
+  254, 167, 240, 106, 140, 42, 115, 12, 78, 29, 219, 80, 202, 221, 149, 232, 
+  184, 210, 55, 254, 158, 185, 160, 219, 221, 74, 127, 174, 29, 63, 155, 146, 
+  6, 79, 87, 87, 211, 233, 148, 120, 40, 255, 206, 1, 214, 237, 30, 21, 
+  51, 183, 137, 129, 176, 208, 50, 233, 121, 91, 93, 255, 58, 17, 51, 122, 
+  80, 34, 1, 39, 111, 220, 34, 172, 53, 50, 133, 135, 225, 78, 190, 80, 
+  192, 28, 71, 13, 177, 38, 199, 3, 45, 219, 216, 239, 59, 26, 87, 36, 
+  159, 57, 247, 217, 160, 54, 65, 117, 84, 47, 82, 250, 121, 27, 87, 26, 
+  223, 40, 186, 120, 70, 183, 65, 173, 223, 153, 12, 253, 222, 194, 188, 172, 
+  248, 12, 131, 145, 227, 94, 48, 203, 192, 182, 0, 113, 113, 166, 113, 128, 
+  30, 98, 98, 242, 3, 142, 253, 52, 212, 101, 225, 31, 82, 99, 155, 153, 
+  194, 119, 207, 135, 196, 150, 68, 213, 3, 34, 175, 117, 155, 113, 179, 99, 
+  55, 242, 181, 116, 47, 61, 52, 243, 56, 170, 30, 212, 238, 157, 77, 142, 
+  94, 61, 167, 93, 161, 72, 7, 10, 174, 153, 156, 123, 110, 86, 166, 99, 
+  156, 44, 170, 225, 138, 121, 2, 82, 206, 155, 67, 37, 227, 185, 6, 67, 
+  101, 18, 149, 252, 238, 94, 233, 202, 116, 28, 52, 131, 218, 156, 230, 221, 
+  91, 27, 147, 47, 92, 143, 184, 38, 77, 184, 10, 169, 190, 23, 153, 246, 
+  109, 98, 121, 214, 118, 143, 201, 57, 95, 42, 115, 42, 14, 44, 129, 209, 
+  244, 47, 178, 177, 216, 132, 213, 45, 26, 105, 63, 9, 37, 26, 15, 121, 
+  211, 249, 27, 49, 115, 71, 42, 183, 76, 103, 113, 70, 129, 137, 25, 41, 
+  49, 52, 21, 94, 152, 208, 132, 6, 148, 144, 231, 120, 6, 130, 196, 49, 
+  191, 239, 209, 104, 76, 67, 118, 236, 233, 135, 152, 146, 252, 228, 24, 72, 
+  151, 162, 91, 77, 178, 57, 89, 95, 99, 66, 75, 35, 20, 98, 170, 100, 
+  14, 88, 148, 35, 46, 48, 75, 135, 38, 91, 173, 4, 216, 248, 150, 227, 
+  149, 118, 154, 176, 74, 153, 37, 155, 227, 118, 158, 207, 168, 171, 100, 101, 
+  226, 40, 147, 81, 38, 142, 57, 66, 226, 77, 15, 121, 73, 94, 189, 254, 
+  249, 249, 239, 207, 222, 189, 221, 59, 120, 249, 250, 167, 8, 99, 247, 13, 
+  153, 12, 129, 72, 202, 121, 97, 70, 233, 52, 191, 144, 188, 50, 72, 255, 
+  109, 163, 73, 138, 220, 37, 198, 217, 116, 45, 237, 191, 120, 253, 246, 0, 
+  154, 185, 183, 37, 67, 121, 147, 46, 81, 164, 35, 72, 105, 67, 63, 206, 
+  110, 47, 92, 53, 238, 4, 42, 129, 231, 57, 53, 198, 208, 240, 77, 34, 
+  242, 103, 26, 183, 73, 197, 201, 101, 28, 253, 56, 244, 54, 150, 205, 160, 
+  203, 241, 240, 225, 73, 205, 141, 34, 195, 217, 67, 7, 99, 76, 131, 53, 
+  84, 202, 122, 50, 57, 105, 209, 192, 91, 219, 97, 51, 84, 118, 211, 220, 
+  65, 113, 81, 56, 137, 84, 65, 157, 1, 192, 150, 54, 47, 155, 34, 236, 
+  86, 130, 221, 99, 197, 45, 157, 190, 14, 96, 252, 75, 74, 89, 25, 17, 
+  154, 23, 113, 198, 33, 157, 213, 9, 46, 137, 61, 203, 248, 44, 141, 210, 
+  201, 4, 179, 22, 140, 210, 9, 170, 68, 46, 82, 221, 140, 241, 244, 136, 
+  231, 116, 21, 37, 73, 154, 151, 152, 210, 50, 233, 69, 246, 122, 74, 9, 
+  155, 146, 93, 202, 70, 104, 43, 116, 115, 23, 20, 142, 21, 206, 178, 179, 
+  108, 177, 64, 51, 232, 232, 101, 251, 28, 47, 180, 40, 140, 42, 178, 127, 
+  120, 26, 166, 69, 185, 103, 170, 255, 64, 182, 149, 73, 14, 227, 133, 33, 
+  232, 182, 98, 76, 96, 36, 222, 10, 104, 61, 50, 194, 136, 93, 209, 230, 
+  195, 89, 161, 50, 199, 115, 205, 78, 110, 244, 57, 221, 112, 141, 54, 31, 
+  193, 9, 68, 16, 188, 231, 47, 20, 110, 140, 96, 165, 204, 233, 80, 89, 
+  41, 126, 153, 47, 204, 187, 173, 224, 221, 100, 110, 222, 216, 78, 60, 242, 
+  84, 14, 27, 115, 200, 218, 13, 142, 101, 66, 18, 59, 207, 47, 58, 20, 
+  90, 252, 33, 91, 27, 242, 0, 1, 138, 192, 195, 23, 148, 36, 202, 229, 
+  78, 87, 110, 9, 132, 117, 241, 252, 4, 79, 9, 226, 255, 226, 81, 209, 
+  161, 241, 247, 185, 137, 174, 63, 252, 242, 32, 47, 227, 169, 233, 222, 167, 
+  14, 119, 184, 5, 160, 45, 24, 101, 159, 90, 221, 112, 197, 104, 235, 7, 
+  173, 89, 90, 209, 56, 29, 153, 111, 0, 195, 101, 76, 92, 12, 177, 179, 
+  186, 79, 219, 222, 134, 12, 180, 27, 116, 8, 178, 55, 123, 206, 0, 108, 
+  238, 242, 112, 39, 211, 60, 95, 118, 168, 201, 59, 145, 63, 117, 40, 130, 
+  193, 16, 125, 91, 66, 161, 51, 200, 165, 88, 128, 97, 179, 125, 90, 118, 
+  76, 147, 176, 137, 239, 240, 17, 144, 105, 248, 19, 46, 161, 25, 67, 174, 
+  18, 125, 251, 75, 91, 231, 73, 82, 103, 161, 213, 239, 123, 244, 172, 206, 
+  218, 112, 50, 199, 193, 121, 71, 181, 49, 165, 38, 71, 26, 205, 239, 164, 
+  139, 218, 163, 183, 158, 81, 178, 75, 152, 242, 85, 144, 62, 164, 148, 64, 
+  43, 175, 237, 121, 85, 47, 130, 118, 214, 138, 169, 150, 225, 49, 28, 3, 
+  207, 69, 241, 13, 1, 223, 203, 41, 98, 107, 194, 184, 251, 58, 9, 201, 
+  120, 59, 244, 121, 16, 93, 164, 218, 106, 207, 72, 10, 158, 137, 30, 101, 
+  242, 250, 168, 12, 226, 194, 84, 46, 126, 244, 244, 186, 92, 187, 54, 63, 
+  148, 133, 26, 72, 35, 187, 213, 188, 80, 246, 149, 225, 120, 175, 42, 181, 
+  130, 220, 67, 156, 59, 197, 8, 74, 158, 200, 197, 76, 49, 103, 6, 53, 
+  243, 170, 178, 117, 116, 116, 74, 26, 170, 67, 162, 250, 58, 141, 23, 230, 
+  86, 177, 181, 143, 162, 70, 158, 244, 80, 142, 198, 158, 208, 211, 163, 107, 
+  100, 55, 92, 13, 202, 217, 121, 228, 173, 2, 38, 182, 4, 142, 170, 130, 
+  72, 222, 32, 57, 249, 133, 20, 61, 210, 113, 80, 188, 113, 209, 60, 119, 
+  156, 54, 144, 14, 16, 204, 102, 56, 63, 97, 100, 240, 128, 133, 106, 63, 
+  253, 187, 46, 142, 61, 214, 50, 186, 1, 255, 214, 230, 191, 12, 101, 239, 
+  100, 101, 10, 47, 51, 23, 233, 42, 61, 199, 240, 68, 243, 30, 222, 225, 
+  60, 101, 93, 144, 129, 8, 22, 192, 129, 63, 199, 238, 127, 164, 74, 233, 
+  178, 83, 87, 193, 91, 41, 170, 6, 156, 45, 44, 141, 87, 147, 81, 164, 
+  185, 87, 171, 38, 208, 42, 169, 109, 214, 160, 198, 98, 1, 177, 100, 93, 
+  106, 60, 215, 193, 255, 68, 179, 10, 231, 254, 30, 176, 66, 248, 163, 5, 
+  143, 57, 203, 7, 17, 63, 78, 7, 120, 76, 161, 11, 86, 11, 76, 54, 
+  91, 100, 137, 77, 90, 104, 90, 162, 150, 89, 239, 144, 158, 103, 80, 150, 
+  242, 125, 219, 120, 7, 199, 192, 242, 32, 215, 94, 228, 166, 62, 177, 22, 
+  38, 191, 165, 248, 132, 29, 160, 221, 80, 124, 158, 103, 9, 48, 12, 24, 
+  139, 29, 54, 232, 8, 138, 192, 97, 50, 134, 65, 21, 43, 19, 128, 22, 
+  59, 58, 166, 193, 30, 71, 180, 190, 219, 210, 2, 156, 29, 123, 254, 27, 
+  156, 35, 58, 13, 74, 146, 66, 76, 178, 97, 134, 42, 83, 34, 126, 215, 
+  69, 102, 200, 199, 227, 213, 82, 18, 21, 146, 221, 87, 146, 77, 48, 246, 
+  45, 52, 5, 162, 122, 223, 102, 10, 19, 0, 20, 139, 116, 140, 73, 63, 
+  147, 112, 50, 48, 148, 253, 120, 18, 47, 51, 106, 95, 130, 203, 119, 144, 
+  37, 194, 225, 200, 229, 85, 151, 211, 120, 160, 134, 237, 132, 18, 250, 202, 
+  208, 105, 193, 16, 255, 121, 28, 44, 151, 224, 117, 31, 18, 127, 51, 132, 
+  109, 168, 199, 106, 115, 158, 41, 177, 114, 216, 56, 178, 115, 52, 245, 137, 
+  81, 248, 68, 81, 56, 67, 76, 61, 25, 221, 193, 251, 144, 59, 34, 224, 
+  104, 144, 72, 17, 92, 4, 0, 215, 50, 149, 68, 121, 115, 105, 75, 175, 
+  124, 39, 199, 176, 89, 32, 129, 0, 172, 138, 184, 107, 166, 15, 220, 46, 
+  96, 63, 218, 214, 96, 164, 228, 83, 1, 23, 54, 194, 235, 56, 186, 20, 
+  84, 37, 1, 206, 72, 23, 14, 205, 226, 9, 229, 171, 9, 209, 8, 13, 
+  203, 210, 146, 220, 255, 6, 209, 75, 76, 29, 105, 198, 106, 241, 202, 14, 
+  141, 179, 176, 230, 244, 28, 147, 41, 82, 242, 84, 134, 152, 25, 229, 203, 
+  249, 98, 5, 128, 228, 105, 97, 181, 109, 250, 23, 25, 113, 238, 134, 139, 
+  35, 176, 184, 204, 4, 77, 177, 154, 47, 39, 152, 10, 82, 20, 174, 99, 
+  252, 118, 236, 93, 81, 28, 79, 230, 199, 46, 137, 189, 233, 150, 179, 200, 
+  200, 94, 37, 211, 57, 125, 7, 66, 47, 41, 233, 137, 12, 249, 167, 188, 
+  76, 183, 107, 99, 122, 224, 138, 182, 44, 172, 90, 206, 138, 205, 185, 43, 
+  119, 0, 37, 146, 37, 251, 57, 2, 188, 129, 155, 40, 216, 64, 145, 139, 
+  144, 14, 223, 160, 23, 181, 247, 75, 58, 250, 71, 134, 144, 52, 9, 75, 
+  47, 112, 223, 2, 92, 47, 98, 4, 48, 160, 51, 167, 59, 69, 65, 116, 
+  185, 90, 64, 103, 109, 115, 133, 101, 145, 24, 219, 121, 149, 255, 1, 216, 
+  137, 241, 205, 114, 172, 13, 92, 72, 155, 18, 224, 66, 85, 63, 51, 173, 
+  167, 82, 103, 122, 135, 164, 78, 192, 106, 237, 246, 148, 183, 133, 204, 55, 
+  12, 163, 66, 6, 241, 231, 229, 51, 14, 24, 2, 223, 2, 158, 23, 225, 
+  10, 47, 132, 158, 27, 227, 43, 224, 0, 4, 5, 219, 61, 179, 27, 76, 
+  228, 14, 37, 39, 248, 221, 175, 22, 97, 231, 134, 23, 32, 114, 142, 97, 
+  168, 98, 64, 79, 138, 234, 194, 1, 17, 43, 153, 52, 169, 209, 185, 51, 
+  104, 130, 185, 246, 34, 69, 238, 101, 38, 141, 158, 85, 22, 143, 234, 146, 
+  238, 232, 3, 198, 59, 191, 218, 22, 122, 102, 182, 248, 157, 205, 16, 149, 
+  230, 25, 184, 70, 192, 153, 150, 83, 74, 48, 99, 46, 196, 56, 86, 164, 
+  37, 243, 142, 151, 88, 242, 186, 161, 33, 42, 29, 8, 43, 248, 62, 117, 
+  187, 221, 80, 155, 14, 108, 35, 146, 101, 205, 217, 178, 68, 203, 87, 119, 
+  204, 184, 147, 162, 139, 185, 155, 79, 249, 124, 178, 107, 96, 68, 81, 214, 
+  156, 160, 41, 158, 89, 77, 149, 247, 15, 9, 197, 28, 147, 57, 131, 132, 
+  113, 86, 24, 186, 72, 19, 59, 65, 23, 61, 67, 207, 105, 76, 181, 40, 
+  249, 12, 138, 214, 99, 164, 135, 17, 249, 252, 89, 3, 54, 126, 112, 184, 
+  56, 88, 196, 39, 233, 175, 62, 70, 94, 6, 175, 255, 85, 135, 111, 9, 
+  13, 162, 138, 108, 132, 210, 31, 116, 227, 32, 9, 81, 135, 59, 213, 114, 
+  151, 186, 23, 40, 119, 89, 95, 14, 221, 25, 165, 36, 127, 221, 21, 132, 
+  65, 56, 163, 227, 95, 27, 71, 211, 142, 40, 246, 100, 190, 8, 130, 71, 
+  84, 176, 25, 219, 240, 112, 58, 249, 0, 255, 191, 12, 80, 218, 248, 81, 
+  82, 111, 212, 108, 221, 86, 33, 84, 127, 5, 195, 8, 173, 27, 237, 203, 
+  119, 139, 240, 85, 157, 27, 162, 165, 4, 216, 86, 51, 53, 160, 9, 247, 
+  8, 248, 142, 24, 84, 218, 120, 183, 184, 134, 158, 248, 245, 149, 112, 24, 
+  64, 170, 109, 188, 163, 44, 176, 234, 157, 139, 155, 247, 50, 35, 161, 183, 
+  145, 17, 221, 173, 185, 60, 51, 12, 58, 137, 155, 225, 90, 250, 58, 89, 
+  92, 145, 97, 44, 104, 41, 109, 152, 72, 220, 213, 232, 238, 27, 163, 246, 
+  77, 78, 24, 100, 217, 45, 159, 36, 199, 218, 25, 102, 48, 194, 19, 204, 
+  242, 79, 6, 139, 41, 77, 54, 229, 161, 206, 102, 139, 105, 54, 177, 151, 
+  87, 176, 7, 177, 86, 229, 117, 144, 112, 46, 124, 45, 7, 29, 182, 16, 
+  26, 108, 223, 224, 160, 183, 57, 217, 204, 25, 15, 240, 62, 0, 12, 220, 
+  166, 75, 76, 158, 59, 20, 99, 96, 227, 76, 185, 148, 99, 190, 183, 163, 
+  130, 130, 13, 96, 246, 88, 212, 141, 81, 102, 132, 60, 10, 153, 127, 174, 
+  38, 80, 4, 230, 77, 82, 78, 207, 196, 250, 156, 59, 162, 235, 173, 72, 
+  121, 12, 20, 131, 104, 63, 149, 216, 8, 163, 148, 213, 107, 54, 141, 182, 
+  171, 227, 172, 234, 80, 158, 140, 94, 72, 47, 6, 83, 142, 9, 233, 142, 
+  177, 97, 239, 110, 215, 182, 68, 108, 19, 115, 145, 48, 143, 159, 94, 31, 
+  200, 64, 41, 121, 220, 159, 96, 88, 236, 27, 101, 132, 109, 177, 250, 128, 
+  40, 130, 3, 100, 207, 66, 167, 134, 170, 214, 81, 212, 185, 231, 255, 109, 
+  2, 167, 89, 242, 97, 173, 187, 67, 18, 194, 62, 122, 146, 6, 125, 48, 
+  1, 214, 252, 233, 105, 188, 68, 211, 94, 106, 96, 44, 63, 174, 115, 205, 
+  147, 102, 58, 220, 109, 60, 45, 209, 177, 234, 113, 212, 218, 251, 189, 5, 
+  68, 177, 213, 234, 70, 119, 43, 196, 137, 62, 220, 75, 185, 156, 74, 133, 
+  167, 55, 170, 0, 152, 21, 75, 133, 87, 55, 170, 80, 156, 102, 19, 51, 
+  166, 253, 27, 213, 144, 123, 191, 86, 191, 223, 111, 5, 89, 173, 125, 213, 
+  95, 180, 107, 215, 74, 180, 3, 80, 205, 60, 25, 144, 22, 218, 95, 152, 
+  73, 29, 123, 52, 97, 129, 152, 245, 13, 120, 11, 196, 180, 177, 134, 224, 
+  95, 31, 195, 206, 148, 90, 19, 199, 142, 39, 226, 127, 91, 195, 29, 89, 
+  12, 205, 235, 100, 109, 81, 22, 12, 132, 46, 24, 202, 191, 99, 95, 4, 
+  102, 164, 190, 181, 104, 80, 8, 121, 11, 87, 6, 127, 185, 34, 94, 62, 
+  56, 157, 246, 141, 245, 27, 58, 211, 221, 255, 46, 81, 159, 63, 206, 235, 
+  76, 98, 121, 2, 74, 107, 130, 137, 222, 150, 37, 7, 202, 64, 115, 121, 
+  123, 21, 78, 119, 62, 28, 63, 195, 83, 37, 5, 121, 186, 247, 168, 62, 
+  221, 145, 197, 25, 166, 120, 32, 107, 1, 108, 199, 170, 33, 61, 23, 195, 
+  120, 209, 81, 157, 200, 226, 194, 147, 195, 225, 209, 160, 204, 223, 45, 128, 
+  145, 125, 26, 23, 152, 131, 133, 90, 113, 25, 179, 237, 89, 25, 122, 55, 
+  124, 238, 135, 206, 91, 50, 251, 222, 86, 217, 238, 108, 40, 39, 155, 66, 
+  39, 43, 65, 244, 154, 208, 161, 10, 95, 163, 49, 166, 48, 134, 195, 242, 
+  150, 203, 108, 120, 157, 49, 49, 53, 21, 164, 105, 10, 130, 197, 174, 201, 
+  109, 181, 54, 248, 124, 147, 105, 242, 231, 167, 78, 51, 247, 174, 173, 3, 
+  84, 47, 225, 117, 16, 165, 109, 145, 217, 154, 44, 167, 9, 171, 3, 12, 
+  83, 78, 149, 218, 143, 7, 7, 126, 198, 38, 109, 136, 134, 35, 233, 209, 
+  8, 122, 108, 220, 220, 131, 1, 244, 184, 227, 30, 153, 55, 183, 93, 250, 
+  222, 222, 167, 175, 57, 11, 250, 230, 131, 225, 172, 248, 250, 175, 226, 156, 
+  230, 229, 87, 114, 185, 36, 233, 107, 24, 88, 206, 108, 182, 175, 169, 109, 
+  40, 117, 95, 148, 150, 199, 241, 49, 45, 226, 241, 232, 56, 154, 173, 10, 
+  82, 194, 120, 153, 116, 137, 171, 113, 13, 212, 155, 31, 42, 183, 52, 134, 
+  59, 194, 115, 131, 167, 195, 56, 19, 157, 3, 71, 128, 179, 222, 88, 178, 
+  143, 25, 62, 116, 206, 47, 65, 170, 99, 202, 129, 91, 252, 140, 123, 103, 
+  76, 247, 69, 183, 111, 207, 210, 1, 57, 37, 168, 187, 3, 224, 76, 201, 
+  170, 22, 245, 199, 32, 188, 43, 95, 26, 190, 65, 107, 59, 238, 158, 18, 
+  84, 154, 12, 114, 109, 254, 166, 94, 201, 72, 119, 17, 151, 240, 155, 202, 
+  114, 237, 134, 225, 237, 116, 238, 128, 76, 216, 29, 161, 118, 61, 240, 18, 
+  186, 55, 174, 131, 165, 234, 90, 185, 139, 98, 112, 178, 89, 122, 136, 185, 
+  221, 239, 98, 235, 42, 137, 251, 72, 191, 226, 134, 228, 173, 144, 167, 24, 
+  29, 25, 101, 129, 182, 65, 162, 100, 239, 13, 20, 71, 191, 38, 65, 196, 
+  43, 60, 170, 20, 166, 17, 109, 136, 171, 5, 178, 66, 51, 98, 145, 169, 
+  145, 13, 221, 2, 141, 147, 32, 142, 202, 236, 65, 58, 160, 132, 235, 106, 
+  160, 230, 221, 200, 189, 11, 208, 162, 5, 205, 181, 112, 100, 45, 238, 174, 
+  197, 123, 137, 248, 78, 202, 225, 126, 140, 222, 56, 200, 240, 57, 208, 32, 
+  159, 115, 64, 240, 214, 0, 66, 91, 43, 116, 56, 105, 43, 72, 145, 39, 
+  15, 253, 187, 199, 127, 158, 240, 159, 103, 110, 57, 165, 49, 189, 150, 84, 
+  30, 207, 40, 90, 61, 183, 102, 60, 213, 67, 129, 56, 174, 29, 69, 211, 
+  222, 241, 42, 62, 33, 11, 221, 133, 255, 240, 153, 126, 88, 97, 193, 76, 
+  127, 220, 176, 194, 17, 238, 15, 23, 127, 77, 103, 225, 40, 77, 127, 186, 
+  53, 102, 17, 36, 124, 138, 5, 26, 151, 12, 192, 38, 88, 65, 101, 111, 
+  243, 125, 81, 5, 65, 112, 72, 27, 132, 13, 220, 9, 111, 225, 35, 106, 
+  166, 235, 150, 248, 39, 50, 105, 131, 53, 188, 72, 81, 229, 92, 140, 151, 
+  25, 16, 19, 212, 31, 242, 154, 34, 153, 17, 123, 91, 71, 11, 229, 186, 
+  157, 41, 168, 105, 201, 16, 82, 82, 185, 73, 44, 124, 85, 133, 21, 52, 
+  200, 197, 3, 61, 198, 81, 0, 1, 42, 46, 231, 152, 226, 116, 14, 194, 
+  228, 244, 114, 16, 40, 219, 76, 177, 202, 129, 77, 199, 120, 86, 252, 20, 
+  255, 36, 239, 170, 250, 9, 140, 188, 117, 23, 195, 6, 125, 168, 141, 199, 
+  34, 72, 66, 107, 138, 203, 118, 206, 121, 144, 131, 53, 165, 197, 171, 121, 
+  77, 247, 110, 97, 159, 137, 171, 243, 172, 166, 142, 199, 255, 185, 52, 232, 
+  184, 103, 105, 146, 89, 225, 199, 9, 142, 125, 11, 226, 3, 178, 29, 126, 
+  173, 85, 114, 163, 107, 75, 48, 33, 244, 219, 165, 161, 34, 221, 37, 28, 
+  115, 193, 139, 4, 216, 188, 243, 174, 19, 69, 168, 129, 26, 221, 159, 10, 
+  123, 76, 168, 105, 78, 35, 144, 180, 57, 48, 29, 197, 210, 210, 97, 112, 
+  236, 25, 36, 56, 132, 188, 220, 9, 97, 14, 229, 23, 7, 177, 206, 190, 
+  77, 236, 41, 89, 235, 214, 86, 231, 238, 160, 223, 163, 218, 30, 45, 206, 
+  213, 1, 245, 24, 195, 166, 76, 65, 216, 199, 33, 145, 102, 9, 24, 65, 
+  243, 211, 205, 77, 205, 51, 49, 180, 50, 9, 104, 37, 126, 144, 150, 93, 
+  48, 88, 249, 192, 246, 12, 114, 144, 9, 158, 167, 40, 38, 156, 167, 226, 
+  57, 69, 138, 125, 114, 8, 98, 35, 42, 158, 113, 148, 243, 133, 209, 8, 
+  141, 98, 226, 229, 165, 215, 190, 84, 220, 141, 250, 209, 197, 198, 150, 234, 
+  92, 208, 143, 233, 12, 226, 223, 5, 210, 12, 15, 253, 165, 136, 33, 204, 
+  143, 205, 241, 182, 29, 53, 16, 47, 169, 208, 230, 78, 145, 24, 17, 171, 
+  139, 24, 222, 197, 242, 50, 24, 211, 143, 55, 80, 82, 42, 189, 158, 76, 
+  10, 204, 169, 146, 21, 111, 236, 65, 111, 10, 36, 185, 176, 247, 102, 51, 
+  116, 154, 84, 118, 53, 162, 156, 210, 217, 161, 238, 170, 78, 134, 3, 144, 
+  231, 212, 253, 33, 76, 118, 3, 189, 202, 55, 6, 131, 193, 145, 120, 127, 
+  165, 201, 9, 169, 123, 239, 136, 23, 218, 157, 32, 25, 153, 254, 168, 169, 
+  240, 202, 31, 182, 185, 101, 3, 17, 52, 1, 57, 130, 21, 97, 120, 84, 
+  5, 69, 154, 62, 84, 221, 248, 203, 215, 27, 3, 188, 107, 238, 120, 244, 
+  167, 70, 180, 116, 116, 161, 46, 196, 122, 237, 158, 52, 112, 45, 197, 86, 
+  7, 176, 176, 50, 80, 198, 142, 238, 81, 181, 195, 192, 78, 70, 102, 123, 
+  87, 51, 82, 128, 48, 201, 7, 64, 150, 138, 18, 21, 63, 92, 151, 108, 
+  98, 190, 151, 33, 60, 150, 191, 219, 149, 194, 170, 14, 165, 44, 129, 207, 
+  99, 250, 213, 88, 116, 88, 211, 37, 169, 100, 210, 139, 125, 62, 47, 59, 
+  14, 173, 169, 37, 233, 188, 31, 57, 75, 24, 253, 97, 210, 8, 203, 210, 
+  20, 1, 79, 181, 108, 190, 222, 137, 54, 135, 67, 180, 50, 34, 35, 35, 
+  68, 251, 191, 180, 171, 45, 43, 221, 133, 249, 248, 129, 191, 164, 57, 173, 
+  147, 213, 163, 186, 94, 29, 141, 31, 135, 32, 162, 116, 173, 12, 163, 9, 
+  71, 104, 64, 114, 178, 186, 161, 84, 103, 209, 252, 107, 189, 118, 228, 202, 
+  125, 213, 87, 25, 9, 90, 42, 242, 158, 247, 227, 187, 224, 53, 105, 89, 
+  198, 192, 186, 26, 177, 17, 89, 8, 162, 173, 112, 126, 160, 157, 40, 107, 
+  97, 177, 172, 127, 40, 202, 97, 128, 223, 85, 222, 158, 209, 13, 202, 84, 
+  160, 71, 79, 241, 56, 100, 191, 116, 54, 34, 177, 193, 102, 43, 22, 31, 
+  134, 209, 50, 90, 17, 19, 224, 239, 51, 189, 66, 84, 181, 91, 255, 133, 
+  150, 228, 5, 108, 230, 169, 136, 46, 182, 204, 169, 121, 88, 85, 167, 124, 
+  166, 139, 241, 255, 218, 241, 25, 157, 188, 37, 66, 170, 173, 54, 75, 70, 
+  108, 10, 173, 156, 92, 230, 171, 217, 8, 79, 197, 73, 52, 203, 166, 211, 
+  172, 72, 199, 57, 94, 36, 243, 149, 189, 137, 171, 203, 169, 26, 196, 132, 
+  181, 152, 229, 104, 4, 192, 1, 81, 16, 155, 48, 240, 110, 145, 38, 28, 
+  69, 241, 245, 79, 7, 207, 127, 61, 248, 253, 224, 229, 171, 231, 208, 245, 
+  166, 177, 109, 62, 102, 226, 120, 140, 29, 197, 17, 6, 180, 164, 156, 155, 
+  198, 206, 34, 194, 171, 112, 99, 104, 158, 207, 39, 20, 128, 133, 110, 36, 
+  143, 209, 219, 184, 47, 181, 7, 209, 118, 191, 203, 171, 243, 252, 229, 223, 
+  94, 160, 217, 243, 230, 67, 79, 57, 101, 23, 232, 39, 84, 0, 243, 153, 
+  167, 180, 71, 198, 91, 195, 64, 103, 0, 44, 114, 25, 127, 64, 84, 40, 
+  14, 177, 180, 113, 135, 145, 240, 232, 99, 32, 120, 99, 195, 17, 81, 59, 
+  219, 162, 169, 170, 15, 168, 241, 217, 154, 37, 0, 205, 223, 86, 164, 164, 
+  248, 43, 65, 229, 203, 101, 89, 130, 163, 215, 24, 160, 146, 143, 96, 71, 
+  64, 118, 39, 186, 183, 177, 249, 80, 176, 100, 241, 161, 182, 204, 70, 100, 
+  75, 156, 208, 232, 126, 17, 13, 137, 107, 227, 155, 13, 134, 60, 150, 145, 
+  25, 92, 163, 219, 226, 150, 254, 156, 18, 203, 83, 86, 137, 199, 187, 26, 
+  97, 85, 109, 101, 109, 35, 72, 154, 46, 161, 129, 184, 40, 137, 1, 20, 
+  189, 132, 92, 21, 187, 200, 184, 176, 214, 76, 175, 92, 80, 58, 157, 207, 
+  220, 122, 108, 187, 116, 140, 126, 4, 57, 206, 183, 237, 59, 208, 115, 51, 
+  139, 15, 204, 204, 153, 88, 114, 46, 205, 121, 77, 16, 49, 134, 146, 202, 
+  31, 10, 223, 189, 135, 38, 69, 164, 125, 142, 6, 224, 100, 14, 101, 54, 
+  45, 109, 80, 54, 82, 167, 72, 244, 168, 94, 139, 38, 113, 66, 185, 252, 
+  196, 131, 204, 180, 230, 230, 221, 222, 158, 231, 101, 135, 147, 218, 119, 195, 
+  188, 187, 202, 109, 25, 42, 222, 109, 83, 112, 61, 228, 127, 16, 219, 120, 
+  114, 67, 237, 15, 174, 213, 113, 39, 83, 14, 36, 160, 209, 232, 33, 97, 
+  17, 191, 125, 206, 235, 164, 145, 76, 189, 125, 19, 55, 190, 114, 137, 196, 
+  228, 117, 159, 203, 223, 217, 218, 209, 248, 41, 73, 126, 215, 37, 27, 99, 
+  84, 234, 35, 201, 241, 179, 122, 113, 195, 18, 195, 175, 25, 63, 109, 208, 
+  5, 234, 63, 200, 73, 213, 254, 198, 32, 209, 117, 169, 212, 239, 161, 131, 
+  139, 253, 46, 142, 229, 237, 199, 188, 48, 24, 188, 183, 91, 241, 170, 175, 
+  113, 44, 78, 82, 252, 143, 214, 225, 202, 52, 65, 181, 189, 5, 245, 112, 
+  247, 225, 189, 71, 63, 60, 83, 153, 159, 93, 180, 196, 189, 31, 30, 253, 
+  240, 192, 189, 80, 219, 119, 153, 78, 73, 234, 82, 254, 239, 128, 137, 51, 
+  116, 125, 160, 118, 201, 91, 33, 193, 179, 25, 255, 96, 44, 59, 214, 117, 
+  130, 48, 230, 176, 74, 130, 38, 210, 70, 49, 225, 38, 12, 190, 244, 252, 
+  98, 140, 247, 235, 75, 122, 249, 222, 250, 6, 181, 122, 106, 124, 217, 156, 
+  61, 105, 204, 146, 81, 89, 210, 243, 161, 241, 0, 109, 33, 114, 41, 66, 
+  7, 15, 50, 154, 203, 74, 114, 203, 153, 159, 88, 143, 11, 93, 83, 86, 
+  28, 182, 128, 233, 236, 86, 128, 253, 163, 197, 179, 44, 158, 53, 80, 228, 
+  205, 33, 147, 100, 14, 59, 98, 195, 146, 95, 71, 81, 71, 139, 155, 208, 
+  76, 131, 195, 60, 2, 143, 116, 234, 71, 12, 51, 34, 53, 29, 183, 167, 
+  250, 82, 166, 187, 225, 101, 138, 174, 16, 179, 235, 98, 135, 200, 244, 55, 
+  162, 45, 204, 204, 224, 238, 16, 126, 97, 235, 179, 136, 171, 246, 13, 50, 
+  105, 110, 149, 149, 97, 214, 208, 140, 138, 211, 221, 247, 4, 14, 240, 249, 
+  56, 53, 77, 105, 6, 23, 35, 119, 103, 35, 226, 78, 108, 206, 78, 182, 
+  86, 67, 62, 240, 216, 161, 175, 57, 124, 72, 19, 103, 90, 130, 67, 2, 
+  134, 112, 140, 4, 83, 46, 2, 224, 72, 57, 70, 163, 128, 99, 148, 225, 
+  129, 13, 57, 196, 123, 252, 167, 251, 251, 91, 131, 77, 96, 247, 153, 245, 
+  216, 132, 205, 58, 120, 116, 180, 230, 120, 19, 250, 218, 148, 16, 93, 59, 
+  238, 115, 170, 185, 71, 61, 56, 199, 232, 127, 3, 192, 143, 48, 220, 135, 
+  165, 32, 188, 226, 134, 98, 60, 40, 130, 92, 234, 220, 97, 99, 38, 245, 
+  134, 84, 115, 91, 152, 101, 142, 254, 55, 28, 60, 124, 164, 59, 95, 59, 
+  210, 205, 74, 30, 248, 209, 226, 186, 108, 243, 247, 159, 13, 253, 248, 39, 
+  117, 97, 18, 30, 61, 24, 61, 24, 53, 36, 165, 175, 68, 200, 184, 255, 
+  208, 65, 238, 161, 29, 146, 14, 156, 202, 145, 40, 215, 110, 47, 151, 248, 
+  208, 17, 118, 123, 218, 234, 32, 56, 234, 116, 240, 175, 217, 164, 133, 107, 
+  56, 158, 134, 107, 54, 234, 133, 248, 29, 143, 195, 81, 155, 149, 131, 249, 
+  193, 156, 239, 68, 91, 193, 220, 110, 112, 216, 225, 224, 26, 143, 186, 47, 
+  154, 163, 219, 48, 87, 95, 44, 65, 183, 229, 214, 174, 89, 65, 35, 2, 
+  214, 50, 106, 147, 201, 36, 228, 233, 28, 22, 86, 83, 91, 214, 4, 21, 
+  2, 49, 93, 5, 209, 181, 25, 128, 41, 69, 123, 207, 6, 46, 14, 226, 
+  21, 43, 142, 64, 113, 51, 247, 107, 162, 9, 213, 112, 6, 155, 20, 81, 
+  168, 130, 103, 58, 254, 12, 90, 83, 102, 226, 28, 219, 140, 115, 255, 229, 
+  173, 47, 134, 49, 66, 198, 240, 26, 10, 242, 85, 154, 6, 12, 160, 205, 
+  110, 209, 120, 87, 74, 93, 163, 219, 201, 137, 145, 38, 152, 109, 83, 41, 
+  137, 109, 17, 137, 35, 171, 19, 60, 234, 215, 162, 103, 176, 69, 123, 186, 
+  97, 93, 48, 221, 167, 181, 53, 190, 86, 169, 122, 117, 138, 79, 173, 14, 
+  192, 244, 226, 137, 151, 186, 37, 147, 165, 65, 93, 253, 196, 243, 241, 105, 
+  110, 4, 40, 150, 61, 38, 36, 111, 88, 236, 37, 15, 130, 105, 138, 174, 
+  132, 194, 173, 71, 171, 197, 6, 154, 253, 117, 173, 180, 202, 213, 141, 98, 
+  92, 205, 163, 122, 213, 136, 47, 209, 137, 53, 152, 14, 185, 83, 77, 19, 
+  36, 22, 85, 71, 56, 137, 128, 147, 207, 11, 3, 137, 230, 196, 0, 83, 
+  110, 193, 116, 51, 224, 42, 63, 218, 251, 103, 252, 160, 142, 141, 202, 161, 
+  5, 144, 244, 26, 106, 217, 212, 148, 6, 210, 38, 253, 9, 53, 234, 180, 
+  15, 237, 192, 167, 94, 63, 117, 105, 44, 121, 47, 87, 194, 184, 24, 112, 
+  121, 88, 224, 199, 115, 49, 94, 220, 199, 136, 45, 199, 219, 94, 18, 35, 
+  114, 153, 17, 227, 73, 78, 1, 66, 37, 85, 242, 24, 168, 112, 232, 178, 
+  245, 96, 142, 30, 50, 190, 63, 66, 243, 233, 120, 185, 140, 47, 113, 209, 
+  41, 165, 6, 43, 91, 138, 168, 179, 137, 58, 72, 114, 35, 101, 51, 60, 
+  124, 219, 237, 225, 29, 48, 94, 54, 110, 216, 69, 50, 198, 250, 203, 20, 
+  141, 223, 200, 60, 19, 109, 178, 113, 11, 162, 154, 145, 204, 16, 92, 2, 
+  26, 198, 65, 111, 13, 25, 253, 117, 178, 29, 231, 253, 175, 158, 222, 50, 
+  107, 71, 32, 26, 45, 246, 136, 87, 168, 120, 132, 153, 23, 90, 35, 233, 
+  189, 136, 116, 54, 49, 229, 239, 166, 211, 21, 237, 234, 142, 189, 172, 170, 
+  94, 80, 31, 34, 51, 61, 158, 129, 245, 218, 171, 217, 188, 130, 134, 124, 
+  25, 62, 116, 219, 239, 45, 91, 138, 48, 47, 47, 76, 160, 202, 215, 5, 
+  208, 37, 157, 186, 110, 62, 122, 28, 29, 30, 161, 114, 27, 233, 10, 25, 
+  99, 116, 218, 239, 93, 240, 17, 161, 11, 3, 92, 9, 183, 211, 157, 251, 
+  0, 136, 60, 148, 85, 69, 233, 155, 136, 186, 74, 136, 110, 57, 149, 189, 
+  0, 81, 208, 90, 146, 219, 74, 190, 234, 214, 146, 47, 157, 84, 157, 198, 
+  77, 89, 236, 77, 119, 130, 196, 221, 234, 204, 133, 242, 120, 115, 247, 70, 
+  235, 228, 226, 206, 239, 189, 104, 158, 124, 168, 25, 182, 43, 99, 35, 117, 
+  59, 1, 197, 69, 228, 22, 251, 203, 14, 52, 114, 119, 51, 12, 50, 174, 
+  246, 221, 143, 2, 119, 127, 30, 174, 19, 47, 196, 146, 222, 190, 10, 6, 
+  97, 115, 186, 52, 182, 139, 201, 191, 78, 40, 116, 20, 225, 34, 193, 68, 
+  169, 0, 62, 209, 99, 191, 74, 241, 75, 86, 158, 62, 121, 195, 46, 167, 
+  2, 70, 218, 177, 253, 239, 201, 238, 58, 138, 58, 20, 208, 1, 112, 132, 
+  49, 7, 24, 176, 51, 163, 162, 28, 45, 186, 42, 33, 173, 194, 244, 219, 
+  85, 95, 211, 112, 183, 240, 121, 229, 229, 184, 225, 52, 54, 79, 222, 120, 
+  217, 115, 252, 116, 89, 10, 182, 152, 249, 20, 101, 237, 121, 110, 66, 60, 
+  157, 83, 228, 39, 94, 246, 15, 165, 11, 236, 68, 104, 59, 80, 168, 149, 
+  205, 210, 125, 201, 193, 27, 120, 137, 11, 69, 180, 148, 197, 12, 201, 35, 
+  45, 4, 8, 173, 88, 69, 101, 110, 225, 31, 82, 180, 62, 222, 49, 100, 
+  222, 43, 168, 43, 91, 21, 206, 59, 108, 220, 126, 107, 150, 7, 75, 232, 
+  180, 123, 64, 81, 119, 132, 171, 146, 220, 107, 228, 184, 194, 131, 67, 59, 
+  214, 195, 35, 207, 126, 1, 43, 24, 244, 59, 156, 171, 171, 58, 108, 248, 
+  16, 223, 82, 216, 24, 47, 160, 50, 140, 218, 190, 233, 184, 31, 143, 153, 
+  102, 32, 111, 149, 36, 237, 202, 170, 168, 90, 187, 130, 67, 187, 223, 139, 
+  138, 155, 157, 66, 147, 218, 162, 212, 154, 43, 10, 191, 164, 32, 205, 144, 
+  198, 15, 19, 132, 42, 21, 7, 169, 136, 195, 1, 21, 212, 86, 95, 71, 
+  80, 32, 107, 106, 180, 14, 176, 61, 133, 103, 114, 234, 83, 95, 212, 44, 
+  120, 195, 218, 245, 102, 233, 168, 251, 85, 128, 41, 234, 116, 141, 170, 17, 
+  140, 210, 243, 242, 221, 194, 57, 64, 105, 187, 209, 10, 141, 192, 20, 136, 
+  225, 217, 113, 77, 80, 25, 199, 47, 105, 54, 200, 156, 255, 59, 62, 1, 
+  132, 243, 53, 33, 210, 87, 231, 107, 102, 92, 101, 200, 193, 203, 205, 89, 
+  162, 199, 16, 40, 211, 1, 235, 44, 126, 146, 212, 141, 174, 227, 10, 108, 
+  177, 53, 85, 186, 206, 100, 198, 184, 12, 87, 230, 67, 62, 107, 14, 205, 
+  205, 217, 37, 166, 234, 43, 138, 47, 160, 102, 242, 110, 209, 237, 26, 186, 
+  3, 163, 244, 198, 193, 131, 193, 42, 126, 29, 94, 139, 186, 194, 29, 217, 
+  46, 63, 17, 223, 130, 221, 209, 129, 36, 132, 184, 91, 95, 41, 92, 73, 
+  131, 142, 54, 53, 44, 173, 55, 113, 60, 215, 198, 8, 146, 188, 117, 218, 
+  71, 213, 51, 106, 34, 173, 62, 58, 25, 71, 19, 114, 220, 92, 122, 164, 
+  100, 222, 72, 108, 240, 65, 13, 198, 223, 166, 90, 178, 67, 156, 125, 156, 
+  126, 234, 199, 13, 72, 97, 112, 234, 109, 147, 113, 155, 43, 225, 17, 23, 
+  181, 204, 35, 92, 72, 73, 47, 137, 110, 51, 220, 167, 138, 219, 136, 71, 
+  37, 47, 131, 122, 88, 228, 203, 82, 249, 250, 199, 61, 140, 174, 110, 115, 
+  72, 70, 223, 71, 163, 29, 107, 96, 19, 238, 37, 119, 101, 14, 231, 151, 
+  99, 129, 77, 46, 207, 22, 106, 138, 91, 198, 90, 198, 121, 70, 19, 242, 
+  161, 78, 76, 4, 134, 172, 100, 167, 83, 186, 61, 245, 216, 81, 147, 101, 
+  206, 163, 3, 0, 3, 125, 100, 8, 42, 87, 80, 198, 16, 48, 159, 47, 
+  85, 135, 123, 229, 76, 85, 239, 252, 133, 37, 141, 183, 239, 233, 165, 24, 
+  83, 159, 95, 192, 95, 59, 55, 197, 209, 122, 60, 162, 238, 20, 51, 38, 
+  96, 2, 8, 225, 237, 52, 42, 31, 177, 206, 177, 91, 121, 115, 78, 163, 
+  249, 49, 87, 193, 67, 112, 134, 174, 143, 168, 116, 226, 8, 141, 194, 117, 
+  144, 7, 22, 173, 143, 19, 250, 114, 27, 147, 173, 194, 16, 59, 146, 193, 
+  6, 36, 60, 218, 1, 91, 173, 120, 239, 161, 149, 87, 177, 189, 11, 156, 
+  197, 31, 36, 254, 138, 87, 131, 213, 93, 119, 100, 192, 61, 107, 54, 98, 
+  26, 32, 203, 41, 172, 119, 183, 182, 94, 71, 42, 34, 127, 216, 247, 71, 
+  172, 203, 121, 109, 254, 68, 58, 30, 59, 40, 238, 165, 231, 130, 226, 240, 
+  184, 123, 88, 180, 219, 13, 209, 197, 49, 56, 64, 174, 59, 77, 129, 112, 
+  76, 33, 12, 51, 163, 111, 175, 245, 194, 227, 190, 32, 229, 179, 119, 247, 
+  205, 215, 109, 192, 110, 101, 104, 81, 167, 249, 45, 118, 220, 71, 91, 248, 
+  2, 69, 193, 172, 56, 149, 51, 156, 240, 142, 87, 140, 38, 231, 209, 129, 
+  106, 248, 216, 158, 213, 62, 105, 74, 128, 174, 146, 104, 25, 47, 109, 244, 
+  172, 6, 98, 223, 44, 188, 98, 29, 53, 181, 240, 194, 112, 106, 177, 113, 
+  95, 137, 80, 110, 175, 242, 170, 248, 33, 7, 107, 100, 46, 46, 214, 100, 
+  204, 97, 186, 49, 198, 28, 158, 5, 197, 103, 88, 115, 232, 122, 219, 209, 
+  62, 93, 219, 187, 135, 40, 149, 135, 54, 30, 80, 233, 239, 241, 121, 12, 
+  35, 206, 22, 165, 132, 42, 216, 142, 14, 232, 54, 7, 53, 68, 241, 178, 
+  16, 30, 107, 158, 99, 148, 174, 108, 156, 25, 71, 231, 52, 46, 46, 163, 
+  139, 248, 82, 162, 36, 168, 102, 200, 189, 62, 94, 74, 96, 54, 227, 146, 
+  204, 86, 13, 172, 29, 96, 19, 47, 186, 82, 45, 89, 3, 48, 202, 202, 
+  37, 90, 26, 90, 155, 185, 30, 42, 21, 46, 243, 21, 6, 216, 99, 17, 
+  226, 199, 85, 220, 46, 162, 99, 110, 97, 64, 182, 230, 199, 131, 8, 111, 
+  71, 176, 8, 26, 139, 137, 147, 243, 241, 50, 61, 1, 192, 12, 128, 216, 
+  148, 47, 49, 209, 245, 177, 49, 203, 64, 219, 95, 202, 124, 51, 192, 52, 
+  65, 157, 238, 177, 209, 29, 80, 40, 9, 12, 9, 134, 163, 145, 0, 147, 
+  183, 232, 190, 132, 189, 112, 76, 240, 11, 30, 61, 170, 164, 212, 12, 209, 
+  21, 115, 153, 74, 124, 190, 132, 13, 69, 84, 105, 214, 239, 30, 255, 118, 
+  140, 227, 148, 112, 21, 100, 187, 129, 231, 50, 235, 191, 0, 10, 199, 110, 
+  180, 59, 84, 152, 38, 152, 22, 236, 197, 29, 219, 201, 141, 210, 147, 108, 
+  110, 238, 111, 176, 151, 59, 220, 205, 29, 76, 7, 93, 16, 108, 217, 183, 
+  7, 205, 195, 120, 150, 209, 69, 190, 2, 161, 98, 177, 204, 209, 186, 147, 
+  130, 121, 230, 179, 180, 164, 132, 227, 156, 253, 72, 110, 191, 147, 180, 128, 
+  137, 36, 65, 212, 91, 156, 237, 34, 93, 158, 198, 139, 130, 252, 221, 49, 
+  240, 5, 45, 20, 208, 47, 139, 17, 23, 24, 130, 208, 46, 142, 113, 40, 
+  220, 131, 173, 4, 211, 166, 238, 71, 169, 67, 32, 190, 174, 2, 92, 46, 
+  105, 56, 101, 154, 96, 8, 21, 104, 224, 141, 244, 67, 94, 150, 182, 222, 
+  12, 239, 227, 241, 42, 50, 199, 83, 228, 82, 80, 207, 4, 70, 137, 129, 
+  179, 65, 220, 162, 245, 2, 132, 133, 5, 144, 224, 39, 57, 30, 158, 35, 
+  196, 43, 23, 113, 133, 240, 122, 153, 163, 181, 23, 45, 2, 95, 92, 22, 
+  54, 194, 133, 65, 30, 65, 16, 49, 242, 65, 125, 149, 209, 106, 85, 177, 
+  203, 186, 62, 148, 249, 89, 138, 30, 172, 28, 217, 69, 130, 6, 144, 114, 
+  12, 109, 62, 231, 17, 223, 88, 34, 16, 77, 226, 109, 193, 17, 10, 201, 
+  34, 11, 78, 48, 158, 231, 243, 62, 35, 71, 138, 111, 230, 115, 204, 234, 
+  103, 131, 82, 160, 222, 203, 56, 198, 194, 146, 2, 254, 77, 46, 57, 125, 
+  56, 247, 255, 11, 177, 131, 54, 167, 53, 59, 250, 83, 243, 137, 160, 135, 
+  233, 20, 96, 128, 141, 220, 49, 125, 161, 21, 42, 78, 207, 156, 163, 56, 
+  235, 21, 208, 102, 244, 13, 190, 200, 151, 73, 1, 12, 245, 224, 100, 16, 
+  181, 210, 121, 210, 234, 146, 139, 5, 199, 224, 83, 67, 201, 72, 125, 199, 
+  197, 70, 92, 142, 174, 181, 41, 228, 1, 26, 16, 33, 132, 246, 224, 236, 
+  70, 52, 129, 225, 97, 113, 9, 199, 71, 119, 10, 132, 230, 156, 41, 61, 
+  0, 3, 194, 56, 230, 164, 9, 9, 69, 57, 73, 19, 209, 71, 14, 228, 
+  210, 67, 130, 209, 10, 161, 140, 58, 109, 19, 210, 182, 109, 175, 126, 180, 
+  209, 26, 149, 15, 124, 158, 112, 141, 231, 128, 188, 79, 1, 127, 196, 58, 
+  138, 82, 116, 81, 48, 150, 88, 249, 254, 162, 34, 193, 186, 33, 227, 43, 
+  54, 250, 231, 165, 150, 237, 106, 160, 78, 199, 94, 76, 33, 6, 83, 14, 
+  52, 64, 213, 93, 68, 233, 162, 200, 78, 230, 76, 20, 50, 23, 222, 39, 
+  34, 167, 94, 4, 124, 155, 88, 169, 24, 86, 35, 62, 73, 237, 106, 152, 
+  66, 227, 124, 134, 140, 63, 21, 98, 61, 108, 31, 21, 165, 179, 213, 180, 
+  204, 232, 254, 42, 146, 18, 182, 6, 171, 89, 169, 2, 170, 92, 83, 56, 
+  17, 120, 50, 177, 117, 104, 111, 51, 158, 112, 25, 193, 153, 41, 70, 244, 
+  99, 218, 136, 37, 232, 242, 78, 206, 78, 89, 95, 156, 104, 7, 47, 91, 
+  12, 129, 138, 71, 176, 168, 93, 156, 145, 187, 42, 104, 136, 225, 107, 192, 
+  238, 157, 167, 230, 33, 234, 170, 228, 171, 99, 197, 223, 162, 194, 134, 182, 
+  189, 28, 43, 101, 74, 183, 216, 246, 212, 67, 229, 94, 60, 103, 133, 2, 
+  109, 120, 210, 81, 73, 44, 73, 206, 221, 237, 141, 140, 52, 64, 205, 23, 
+  47, 152, 78, 244, 249, 220, 234, 205, 236, 56, 222, 32, 225, 97, 86, 157, 
+  227, 203, 240, 225, 107, 98, 203, 12, 34, 12, 57, 166, 227, 80, 97, 248, 
+  126, 179, 220, 72, 35, 138, 124, 156, 81, 102, 102, 21, 172, 117, 64, 244, 
+  74, 68, 21, 70, 174, 172, 240, 52, 230, 72, 177, 108, 104, 87, 201, 31, 
+  18, 76, 136, 117, 167, 21, 173, 148, 150, 48, 148, 220, 140, 9, 237, 15, 
+  149, 103, 148, 176, 221, 173, 150, 123, 164, 214, 195, 91, 159, 80, 215, 155, 
+  206, 178, 178, 106, 93, 72, 152, 194, 1, 211, 130, 77, 86, 213, 238, 58, 
+  61, 196, 20, 202, 243, 221, 81, 224, 132, 67, 227, 195, 123, 148, 118, 197, 
+  80, 153, 250, 151, 235, 229, 72, 146, 236, 233, 247, 50, 181, 118, 197, 61, 
+  199, 137, 214, 68, 198, 129, 26, 162, 83, 61, 249, 3, 157, 210, 145, 36, 
+  132, 8, 96, 47, 40, 206, 145, 98, 145, 248, 246, 132, 148, 95, 98, 76, 
+  42, 56, 101, 77, 75, 72, 200, 212, 233, 80, 71, 142, 77, 100, 82, 204, 
+  47, 194, 1, 225, 68, 121, 106, 218, 160, 71, 203, 98, 131, 171, 46, 139, 
+  129, 146, 2, 160, 229, 183, 104, 76, 186, 49, 60, 252, 240, 235, 209, 225, 
+  176, 255, 237, 94, 255, 135, 184, 63, 57, 186, 251, 169, 243, 62, 185, 251, 
+  126, 240, 248, 211, 251, 193, 251, 164, 251, 62, 185, 211, 57, 124, 158, 30, 
+  29, 246, 239, 30, 61, 134, 23, 221, 199, 159, 14, 223, 95, 252, 14, 197, 
+  250, 253, 193, 157, 79, 135, 237, 214, 17, 252, 121, 127, 184, 123, 231, 253, 
+  225, 224, 206, 198, 137, 19, 210, 184, 119, 3, 2, 32, 175, 227, 51, 56, 
+  138, 209, 61, 153, 157, 124, 105, 114, 76, 213, 146, 156, 195, 211, 224, 56, 
+  21, 38, 209, 232, 81, 117, 105, 225, 45, 100, 108, 59, 218, 248, 237, 48, 
+  238, 255, 177, 215, 255, 191, 223, 143, 54, 156, 249, 2, 3, 134, 222, 194, 
+  184, 62, 253, 198, 195, 82, 5, 152, 136, 97, 1, 152, 224, 251, 68, 189, 
+  17, 114, 135, 175, 250, 253, 13, 94, 86, 165, 19, 53, 32, 108, 26, 77, 
+  7, 86, 241, 19, 41, 2, 62, 37, 249, 39, 84, 85, 116, 178, 9, 192, 
+  10, 78, 179, 79, 36, 37, 127, 50, 184, 249, 233, 36, 47, 243, 79, 217, 
+  225, 100, 126, 244, 137, 146, 77, 125, 154, 103, 240, 255, 188, 252, 148, 47, 
+  63, 45, 83, 96, 161, 203, 79, 188, 131, 63, 225, 145, 252, 9, 53, 27, 
+  159, 40, 46, 208, 39, 210, 148, 117, 191, 174, 157, 207, 77, 150, 49, 125, 
+  174, 150, 177, 243, 248, 246, 33, 188, 186, 56, 234, 214, 2, 240, 253, 97, 
+  103, 247, 78, 23, 215, 244, 241, 251, 163, 247, 155, 239, 1, 154, 237, 206, 
+  225, 111, 237, 247, 240, 237, 253, 251, 65, 247, 78, 251, 211, 111, 45, 120, 
+  208, 178, 15, 90, 77, 208, 172, 105, 170, 223, 135, 238, 121, 117, 186, 128, 
+  53, 21, 112, 179, 104, 61, 12, 133, 79, 33, 166, 129, 20, 73, 252, 143, 
+  58, 185, 176, 212, 96, 48, 136, 166, 121, 126, 70, 168, 38, 150, 99, 244, 
+  177, 26, 76, 105, 139, 249, 54, 34, 112, 190, 106, 247, 118, 69, 229, 168, 
+  228, 253, 105, 58, 63, 209, 206, 82, 181, 174, 11, 92, 30, 227, 207, 3, 
+  211, 7, 204, 245, 12, 157, 235, 195, 154, 248, 161, 241, 216, 11, 48, 219, 
+  166, 253, 198, 132, 209, 12, 154, 67, 46, 208, 48, 132, 115, 31, 246, 200, 
+  101, 36, 160, 133, 168, 217, 142, 118, 104, 20, 223, 121, 163, 142, 2, 248, 
+  181, 240, 28, 152, 165, 45, 20, 26, 160, 116, 75, 9, 213, 68, 37, 28, 
+  231, 202, 170, 8, 55, 68, 75, 74, 94, 17, 129, 219, 181, 53, 26, 129, 
+  234, 74, 87, 34, 6, 35, 73, 188, 187, 235, 77, 172, 234, 8, 67, 91, 
+  76, 195, 232, 214, 53, 245, 123, 106, 128, 188, 18, 125, 191, 85, 94, 165, 
+  176, 80, 205, 28, 189, 82, 176, 148, 65, 17, 142, 5, 197, 135, 188, 135, 
+  109, 238, 238, 214, 46, 11, 86, 56, 35, 99, 97, 166, 113, 181, 254, 98, 
+  252, 234, 240, 236, 136, 253, 175, 168, 239, 218, 176, 104, 51, 242, 107, 99, 
+  250, 132, 197, 9, 248, 92, 188, 234, 37, 35, 227, 60, 171, 190, 9, 64, 
+  203, 224, 173, 1, 52, 111, 14, 82, 255, 24, 199, 159, 22, 211, 141, 22, 
+  222, 47, 216, 103, 66, 3, 90, 149, 49, 219, 168, 207, 232, 31, 225, 182, 
+  45, 218, 129, 26, 99, 0, 175, 60, 206, 15, 232, 200, 227, 254, 99, 71, 
+  73, 54, 154, 103, 137, 227, 171, 236, 221, 168, 202, 142, 165, 23, 24, 201, 
+  233, 249, 135, 69, 167, 253, 254, 168, 77, 251, 115, 243, 8, 237, 37, 224, 
+  87, 21, 112, 222, 246, 67, 84, 128, 63, 55, 4, 86, 101, 48, 138, 59, 
+  241, 155, 80, 28, 16, 18, 139, 224, 45, 105, 1, 119, 235, 201, 72, 45, 
+  1, 50, 91, 130, 160, 84, 219, 22, 189, 169, 54, 166, 148, 177, 222, 88, 
+  233, 137, 176, 151, 121, 147, 114, 202, 114, 146, 70, 59, 165, 61, 100, 62, 
+  67, 57, 165, 170, 69, 219, 78, 110, 34, 165, 56, 199, 9, 249, 113, 21, 
+  71, 73, 92, 138, 28, 85, 136, 12, 244, 174, 0, 129, 199, 9, 68, 179, 
+  115, 237, 154, 226, 165, 24, 165, 247, 231, 108, 242, 54, 59, 151, 119, 84, 
+  14, 149, 107, 156, 218, 27, 75, 253, 55, 158, 78, 175, 245, 59, 103, 200, 
+  162, 74, 4, 162, 167, 47, 121, 114, 170, 196, 17, 167, 140, 178, 37, 70, 
+  244, 196, 43, 34, 217, 20, 85, 17, 147, 120, 178, 235, 249, 240, 148, 37, 
+  205, 169, 46, 228, 116, 157, 181, 31, 126, 172, 197, 223, 116, 21, 247, 89, 
+  62, 81, 166, 162, 146, 101, 189, 88, 196, 115, 245, 84, 114, 12, 110, 162, 
+  209, 104, 163, 201, 30, 163, 87, 143, 83, 222, 176, 219, 15, 221, 46, 57, 
+  183, 33, 203, 102, 89, 22, 75, 198, 255, 209, 217, 21, 62, 220, 124, 244, 
+  224, 201, 61, 201, 118, 255, 139, 241, 42, 193, 236, 134, 237, 200, 100, 238, 
+  52, 252, 81, 77, 245, 111, 183, 30, 108, 161, 101, 226, 186, 234, 134, 29, 
+  170, 169, 62, 124, 244, 237, 183, 247, 31, 173, 175, 110, 185, 160, 106, 245, 
+  7, 63, 124, 243, 228, 155, 111, 164, 186, 201, 216, 151, 149, 32, 225, 142, 
+  219, 166, 122, 6, 211, 230, 125, 204, 213, 187, 188, 225, 16, 84, 47, 231, 
+  147, 252, 38, 182, 154, 232, 141, 168, 44, 36, 205, 202, 180, 94, 164, 211, 
+  243, 20, 93, 100, 235, 146, 63, 214, 120, 227, 212, 140, 50, 200, 167, 57, 
+  140, 190, 89, 124, 104, 43, 131, 89, 10, 76, 36, 99, 52, 195, 109, 28, 
+  103, 138, 133, 195, 238, 71, 176, 60, 218, 2, 87, 18, 168, 25, 96, 250, 
+  45, 32, 142, 146, 133, 152, 180, 34, 232, 169, 31, 73, 122, 68, 64, 65, 
+  54, 234, 191, 239, 165, 254, 244, 108, 63, 201, 171, 60, 236, 251, 109, 222, 
+  8, 111, 233, 108, 89, 169, 243, 15, 202, 29, 180, 222, 34, 26, 203, 245, 
+  1, 209, 131, 145, 27, 63, 38, 185, 156, 178, 37, 199, 169, 53, 156, 173, 
+  247, 24, 49, 164, 191, 206, 249, 233, 92, 60, 163, 205, 59, 116, 216, 13, 
+  199, 108, 92, 28, 111, 48, 106, 34, 188, 13, 227, 182, 246, 232, 211, 120, 
+  81, 164, 100, 56, 204, 95, 237, 58, 147, 158, 31, 95, 160, 78, 185, 255, 
+  159, 85, 110, 45, 105, 235, 134, 89, 157, 152, 202, 235, 42, 182, 228, 108, 
+  188, 45, 118, 191, 237, 199, 219, 219, 172, 199, 15, 210, 131, 154, 126, 91, 
+  192, 165, 180, 181, 208, 82, 193, 251, 70, 144, 241, 1, 233, 155, 135, 91, 
+  98, 44, 169, 220, 2, 208, 57, 19, 229, 205, 173, 207, 55, 112, 86, 233, 
+  108, 85, 164, 8, 135, 27, 217, 220, 89, 157, 235, 60, 181, 10, 195, 181, 
+  117, 253, 208, 141, 192, 18, 47, 206, 20, 22, 108, 236, 161, 94, 76, 227, 
+  120, 242, 192, 173, 133, 159, 44, 84, 65, 68, 249, 202, 214, 41, 77, 237, 
+  137, 124, 125, 82, 115, 102, 189, 18, 138, 78, 148, 140, 132, 237, 176, 245, 
+  209, 212, 77, 109, 79, 149, 7, 33, 206, 60, 23, 85, 78, 227, 133, 79, 
+  45, 243, 142, 143, 207, 101, 144, 244, 194, 94, 143, 83, 92, 40, 100, 19, 
+  161, 22, 95, 29, 117, 54, 80, 222, 221, 235, 255, 95, 220, 255, 227, 247, 
+  35, 210, 129, 220, 233, 182, 190, 222, 232, 170, 26, 211, 83, 50, 127, 132, 
+  138, 143, 245, 105, 54, 200, 18, 195, 120, 100, 9, 244, 209, 173, 70, 13, 
+  56, 108, 31, 182, 229, 206, 49, 100, 67, 48, 67, 89, 47, 106, 31, 181, 
+  143, 2, 14, 204, 204, 218, 180, 109, 219, 52, 148, 199, 188, 128, 97, 169, 
+  76, 214, 110, 143, 123, 247, 162, 97, 183, 18, 166, 134, 170, 153, 235, 77, 
+  178, 157, 65, 82, 253, 12, 88, 35, 119, 72, 99, 26, 117, 220, 224, 111, 
+  83, 138, 99, 58, 78, 73, 77, 13, 220, 28, 94, 14, 25, 76, 157, 76, 
+  17, 199, 222, 205, 207, 230, 120, 121, 204, 4, 63, 88, 74, 30, 2, 143, 
+  143, 15, 14, 157, 16, 172, 24, 83, 180, 152, 69, 58, 215, 171, 154, 21, 
+  198, 220, 78, 210, 129, 75, 17, 47, 70, 215, 201, 73, 144, 94, 204, 211, 
+  10, 114, 11, 206, 116, 35, 186, 109, 30, 157, 152, 71, 206, 248, 82, 181, 
+  139, 86, 209, 156, 111, 225, 208, 1, 215, 210, 1, 3, 92, 30, 184, 207, 
+  152, 155, 124, 147, 219, 50, 54, 63, 236, 11, 39, 75, 5, 96, 61, 39, 
+  247, 190, 13, 75, 55, 29, 131, 174, 151, 179, 210, 99, 251, 253, 106, 107, 
+  43, 222, 108, 175, 233, 85, 118, 212, 32, 7, 80, 49, 236, 237, 229, 54, 
+  62, 199, 56, 103, 192, 251, 54, 12, 11, 225, 139, 194, 43, 74, 80, 23, 
+  80, 45, 191, 208, 35, 163, 175, 122, 27, 141, 173, 39, 233, 235, 1, 174, 
+  128, 178, 173, 17, 56, 3, 23, 148, 194, 14, 123, 3, 59, 176, 8, 245, 
+  181, 102, 45, 66, 25, 202, 203, 14, 99, 123, 247, 227, 181, 224, 150, 166, 
+  140, 43, 182, 117, 195, 211, 235, 82, 132, 138, 98, 227, 205, 53, 106, 99, 
+  0, 57, 188, 63, 164, 82, 3, 122, 112, 228, 13, 10, 196, 95, 87, 108, 
+  128, 40, 175, 116, 1, 50, 226, 219, 220, 199, 99, 199, 20, 153, 101, 251, 
+  49, 143, 145, 106, 15, 6, 131, 118, 72, 33, 110, 119, 42, 35, 219, 67, 
+  149, 126, 23, 218, 177, 140, 150, 105, 200, 78, 40, 108, 133, 199, 205, 210, 
+  30, 138, 232, 195, 186, 81, 176, 141, 120, 88, 149, 54, 165, 53, 86, 230, 
+  134, 208, 122, 138, 49, 70, 145, 96, 109, 37, 97, 141, 211, 174, 60, 179, 
+  91, 187, 234, 22, 13, 105, 129, 168, 5, 198, 1, 159, 206, 177, 28, 84, 
+  13, 161, 244, 181, 108, 192, 109, 179, 19, 149, 112, 98, 15, 121, 99, 168, 
+  205, 200, 169, 239, 129, 168, 109, 20, 33, 89, 224, 230, 91, 184, 120, 142, 
+  7, 87, 196, 39, 23, 46, 35, 26, 40, 72, 244, 103, 75, 167, 16, 137, 
+  14, 114, 81, 4, 248, 36, 42, 16, 173, 58, 17, 156, 26, 18, 64, 135, 
+  95, 63, 118, 183, 100, 193, 33, 128, 42, 142, 247, 73, 88, 216, 92, 187, 
+  85, 10, 83, 28, 16, 214, 45, 119, 191, 14, 107, 141, 242, 124, 154, 130, 
+  96, 86, 169, 182, 17, 205, 179, 41, 230, 95, 27, 161, 192, 109, 199, 142, 
+  204, 47, 74, 210, 184, 38, 152, 11, 213, 175, 133, 205, 218, 67, 16, 245, 
+  238, 71, 119, 54, 186, 112, 136, 218, 115, 161, 46, 242, 3, 218, 21, 187, 
+  95, 2, 245, 167, 180, 134, 8, 229, 231, 22, 151, 37, 72, 62, 146, 148, 
+  169, 10, 95, 65, 189, 46, 179, 17, 93, 60, 211, 58, 73, 198, 65, 22, 
+  236, 143, 241, 245, 177, 92, 111, 225, 146, 97, 137, 86, 101, 221, 90, 81, 
+  7, 19, 145, 34, 146, 149, 176, 33, 188, 101, 12, 78, 188, 198, 181, 84, 
+  234, 61, 206, 30, 101, 151, 95, 147, 19, 47, 16, 14, 139, 29, 53, 150, 
+  255, 234, 168, 181, 231, 156, 110, 229, 202, 241, 37, 60, 164, 74, 44, 13, 
+  36, 50, 154, 183, 16, 9, 121, 71, 163, 221, 185, 218, 208, 210, 120, 189, 
+  174, 198, 192, 194, 168, 106, 156, 130, 225, 51, 20, 53, 182, 210, 182, 56, 
+  164, 147, 199, 142, 156, 90, 100, 198, 197, 121, 51, 172, 191, 13, 71, 199, 
+  249, 76, 165, 202, 45, 165, 19, 1, 208, 93, 235, 198, 77, 5, 81, 36, 
+  172, 50, 208, 90, 110, 104, 246, 185, 247, 29, 27, 199, 227, 113, 40, 159, 
+  62, 120, 240, 160, 194, 111, 27, 135, 217, 161, 39, 4, 253, 194, 158, 225, 
+  181, 188, 116, 251, 1, 20, 127, 64, 49, 30, 134, 214, 157, 25, 36, 23, 
+  178, 35, 241, 4, 23, 0, 245, 82, 178, 14, 162, 161, 67, 126, 102, 204, 
+  112, 150, 58, 232, 6, 204, 184, 78, 212, 209, 130, 78, 179, 7, 163, 27, 
+  158, 145, 246, 201, 19, 189, 209, 79, 89, 129, 165, 50, 219, 246, 16, 39, 
+  37, 240, 112, 82, 8, 126, 196, 83, 254, 190, 123, 98, 28, 101, 213, 35, 
+  113, 160, 236, 223, 215, 237, 179, 231, 100, 127, 43, 236, 147, 3, 24, 160, 
+  248, 103, 224, 250, 80, 180, 76, 14, 162, 53, 178, 160, 248, 117, 18, 224, 
+  78, 226, 133, 152, 77, 161, 13, 96, 223, 56, 22, 114, 92, 187, 228, 242, 
+  255, 59, 160, 86, 221, 254, 93, 25, 156, 161, 5, 254, 211, 167, 79, 155, 
+  129, 31, 145, 70, 134, 180, 50, 21, 192, 15, 171, 128, 31, 214, 64, 249, 
+  81, 47, 82, 174, 251, 104, 105, 3, 59, 154, 52, 175, 64, 167, 49, 45, 
+  108, 84, 128, 92, 108, 194, 105, 226, 71, 60, 96, 67, 208, 163, 73, 90, 
+  159, 226, 175, 214, 120, 172, 7, 66, 37, 193, 210, 143, 198, 178, 233, 162, 
+  96, 52, 45, 164, 191, 48, 44, 139, 154, 231, 87, 61, 175, 118, 117, 99, 
+  173, 173, 92, 17, 245, 153, 4, 61, 201, 147, 107, 53, 59, 66, 131, 16, 
+  123, 12, 237, 0, 80, 46, 125, 10, 100, 98, 63, 180, 239, 185, 32, 54, 
+  110, 87, 5, 180, 66, 86, 52, 88, 89, 21, 85, 103, 115, 104, 31, 9, 
+  38, 124, 59, 172, 140, 253, 102, 227, 110, 80, 49, 244, 71, 211, 124, 124, 
+  86, 163, 84, 180, 58, 197, 26, 149, 98, 179, 62, 135, 245, 12, 118, 165, 
+  93, 146, 59, 171, 198, 135, 66, 1, 7, 136, 180, 28, 117, 199, 219, 145, 
+  196, 75, 199, 219, 222, 158, 226, 7, 225, 119, 79, 241, 128, 240, 243, 138, 
+  21, 249, 210, 208, 245, 254, 210, 226, 237, 236, 206, 27, 79, 86, 54, 61, 
+  89, 177, 208, 247, 56, 115, 109, 202, 16, 66, 87, 24, 155, 219, 28, 230, 
+  132, 187, 2, 29, 88, 138, 195, 208, 185, 104, 92, 185, 34, 229, 42, 236, 
+  232, 244, 20, 43, 118, 180, 48, 115, 229, 215, 174, 118, 29, 206, 206, 97, 
+  178, 153, 157, 169, 84, 117, 73, 242, 56, 120, 1, 130, 20, 110, 98, 46, 
+  184, 121, 27, 134, 191, 132, 243, 244, 115, 35, 206, 253, 47, 238, 93, 254, 
+  187, 208, 114, 234, 42, 5, 221, 124, 94, 206, 25, 254, 236, 130, 197, 196, 
+  218, 128, 218, 56, 52, 161, 187, 20, 10, 142, 232, 214, 237, 187, 53, 249, 
+  229, 241, 147, 178, 111, 85, 80, 86, 243, 132, 42, 255, 33, 221, 152, 184, 
+  88, 254, 56, 16, 186, 158, 239, 208, 87, 205, 182, 98, 204, 195, 29, 217, 
+  169, 214, 149, 15, 13, 43, 48, 77, 104, 138, 55, 99, 84, 101, 96, 146, 
+  18, 74, 186, 230, 125, 14, 243, 210, 221, 137, 238, 222, 245, 36, 111, 142, 
+  161, 189, 171, 218, 245, 115, 181, 250, 35, 155, 231, 101, 146, 45, 235, 19, 
+  13, 24, 121, 162, 115, 248, 219, 198, 209, 29, 144, 96, 78, 186, 164, 150, 
+  251, 114, 33, 224, 246, 17, 225, 40, 23, 243, 23, 11, 145, 65, 173, 189, 
+  33, 131, 129, 181, 4, 116, 130, 229, 208, 206, 160, 202, 123, 106, 101, 124, 
+  93, 24, 43, 119, 163, 178, 201, 60, 97, 228, 93, 130, 208, 8, 126, 226, 
+  180, 42, 254, 16, 92, 132, 126, 59, 239, 235, 134, 73, 91, 178, 79, 131, 
+  173, 187, 36, 34, 141, 52, 230, 65, 101, 157, 116, 171, 170, 148, 118, 124, 
+  47, 86, 184, 239, 14, 36, 61, 7, 21, 71, 38, 60, 242, 54, 111, 28, 
+  234, 8, 185, 228, 235, 130, 116, 192, 225, 30, 70, 240, 170, 240, 171, 163, 
+  209, 40, 8, 165, 243, 216, 164, 227, 243, 82, 40, 104, 205, 182, 158, 132, 
+  14, 195, 22, 116, 91, 215, 142, 142, 167, 211, 199, 250, 125, 47, 162, 206, 
+  176, 71, 255, 13, 54, 129, 166, 234, 112, 59, 42, 140, 10, 181, 82, 19, 
+  11, 100, 136, 255, 53, 243, 229, 143, 30, 61, 138, 190, 218, 219, 219, 147, 
+  127, 224, 103, 56, 232, 1, 103, 52, 76, 147, 134, 176, 35, 117, 161, 203, 
+  42, 177, 203, 154, 218, 188, 118, 33, 244, 122, 55, 54, 114, 221, 194, 56, 
+  78, 173, 113, 8, 215, 45, 74, 16, 117, 187, 6, 210, 15, 238, 61, 26, 
+  142, 227, 58, 24, 76, 134, 105, 156, 62, 240, 239, 130, 220, 230, 107, 186, 
+  216, 160, 237, 102, 232, 33, 109, 79, 87, 208, 165, 57, 51, 42, 48, 58, 
+  105, 39, 178, 153, 233, 175, 210, 172, 162, 53, 178, 121, 60, 160, 31, 112, 
+  220, 8, 209, 117, 15, 187, 168, 49, 224, 159, 168, 11, 192, 95, 237, 199, 
+  42, 37, 5, 27, 64, 81, 245, 187, 81, 123, 27, 45, 97, 164, 54, 169, 
+  99, 184, 184, 242, 74, 195, 169, 216, 94, 41, 195, 19, 22, 121, 191, 218, 
+  26, 110, 222, 55, 33, 181, 57, 1, 2, 22, 160, 116, 152, 228, 234, 140, 
+  206, 46, 158, 74, 68, 26, 210, 218, 199, 143, 114, 137, 152, 181, 175, 122, 
+  81, 187, 131, 85, 186, 214, 11, 92, 114, 172, 214, 52, 253, 212, 107, 151, 
+  39, 212, 62, 124, 122, 212, 190, 182, 230, 179, 207, 26, 145, 155, 115, 197, 
+  128, 172, 149, 164, 163, 213, 201, 73, 186, 108, 121, 86, 120, 30, 51, 105, 
+  142, 15, 211, 54, 26, 162, 249, 58, 118, 250, 88, 26, 111, 202, 225, 176, 
+  186, 145, 83, 94, 254, 249, 195, 204, 29, 20, 55, 177, 34, 160, 115, 34, 
+  136, 225, 244, 47, 115, 75, 238, 63, 254, 117, 219, 38, 214, 209, 59, 34, 
+  192, 115, 111, 67, 4, 140, 234, 181, 91, 130, 226, 235, 98, 84, 157, 239, 
+  17, 215, 201, 41, 201, 236, 121, 7, 114, 151, 209, 213, 94, 12, 81, 212, 
+  8, 189, 173, 106, 248, 117, 212, 129, 86, 152, 117, 159, 43, 39, 131, 163, 
+  170, 30, 62, 144, 38, 161, 91, 44, 72, 58, 114, 69, 19, 120, 65, 123, 
+  234, 140, 14, 109, 204, 113, 96, 112, 196, 80, 204, 135, 113, 205, 187, 15, 
+  192, 150, 70, 187, 53, 17, 121, 76, 40, 158, 36, 247, 195, 240, 152, 218, 
+  181, 22, 98, 214, 178, 22, 155, 173, 179, 45, 180, 47, 155, 211, 132, 85, 
+  134, 125, 120, 180, 83, 1, 6, 131, 13, 200, 19, 123, 0, 164, 23, 175, 
+  210, 2, 5, 60, 134, 120, 173, 16, 163, 214, 241, 37, 180, 220, 209, 1, 
+  213, 141, 115, 166, 137, 94, 98, 213, 167, 158, 152, 18, 8, 40, 14, 19, 
+  93, 255, 30, 38, 86, 25, 85, 143, 18, 216, 222, 235, 204, 107, 240, 99, 
+  184, 167, 135, 215, 154, 216, 152, 210, 181, 54, 53, 248, 113, 28, 212, 208, 
+  83, 224, 216, 195, 39, 142, 41, 188, 159, 156, 126, 38, 126, 178, 63, 77, 
+  65, 133, 27, 199, 140, 160, 219, 176, 241, 244, 76, 194, 31, 88, 25, 7, 
+  11, 75, 216, 6, 65, 50, 131, 182, 20, 3, 3, 107, 220, 174, 84, 193, 
+  134, 195, 74, 215, 196, 38, 8, 87, 92, 73, 54, 216, 73, 183, 58, 67, 
+  87, 216, 155, 36, 153, 240, 234, 72, 24, 170, 229, 52, 193, 154, 21, 87, 
+  119, 253, 210, 119, 62, 183, 124, 82, 53, 179, 105, 165, 102, 228, 135, 106, 
+  178, 80, 21, 101, 190, 219, 38, 135, 52, 196, 35, 7, 197, 243, 96, 80, 
+  231, 205, 227, 184, 102, 0, 231, 89, 224, 2, 237, 19, 68, 119, 207, 77, 
+  131, 130, 45, 249, 145, 198, 178, 29, 209, 31, 57, 228, 182, 121, 0, 244, 
+  253, 170, 81, 194, 183, 11, 97, 132, 124, 114, 104, 40, 254, 247, 82, 254, 
+  141, 2, 177, 99, 193, 31, 105, 64, 130, 32, 107, 15, 57, 30, 122, 31, 
+  87, 231, 127, 36, 12, 109, 213, 10, 67, 141, 42, 65, 163, 19, 83, 82, 
+  210, 87, 233, 55, 248, 223, 77, 44, 214, 120, 226, 181, 146, 98, 253, 196, 
+  231, 78, 10, 172, 191, 42, 169, 215, 157, 106, 107, 170, 86, 133, 128, 177, 
+  61, 214, 189, 240, 177, 132, 247, 189, 175, 89, 231, 208, 102, 240, 198, 246, 
+  130, 178, 76, 76, 66, 163, 77, 188, 74, 105, 253, 184, 26, 103, 73, 28, 
+  253, 13, 164, 140, 36, 133, 181, 218, 91, 102, 214, 178, 201, 217, 23, 38, 
+  42, 66, 170, 93, 189, 205, 97, 5, 138, 55, 25, 17, 67, 17, 26, 227, 
+  202, 174, 226, 26, 3, 39, 119, 66, 221, 128, 247, 177, 59, 217, 224, 121, 
+  163, 89, 179, 45, 121, 3, 6, 39, 60, 72, 107, 185, 27, 76, 163, 98, 
+  152, 25, 115, 126, 227, 150, 18, 30, 163, 57, 7, 10, 93, 155, 66, 43, 
+  212, 42, 39, 8, 225, 171, 239, 26, 171, 5, 30, 89, 115, 83, 194, 190, 
+  17, 198, 172, 59, 229, 21, 228, 101, 152, 254, 209, 80, 186, 88, 66, 114, 
+  200, 59, 26, 81, 177, 164, 114, 187, 200, 218, 62, 72, 76, 54, 108, 135, 
+  37, 129, 72, 241, 240, 222, 2, 85, 76, 170, 168, 14, 219, 85, 81, 141, 
+  70, 186, 234, 230, 224, 210, 117, 204, 129, 4, 124, 118, 198, 142, 207, 167, 
+  172, 215, 90, 165, 255, 47, 243, 107, 120, 153, 92, 27, 21, 179, 58, 197, 
+  235, 231, 100, 229, 120, 179, 42, 129, 111, 166, 68, 219, 113, 201, 167, 29, 
+  69, 173, 62, 38, 99, 38, 84, 205, 146, 27, 55, 198, 136, 120, 57, 145, 
+  239, 236, 194, 77, 142, 20, 248, 187, 71, 166, 7, 92, 7, 95, 88, 135, 
+  116, 110, 110, 7, 143, 114, 85, 113, 110, 140, 25, 122, 126, 37, 96, 107, 
+  40, 77, 8, 246, 73, 21, 7, 78, 105, 138, 155, 17, 6, 89, 146, 183, 
+  43, 59, 118, 41, 246, 12, 161, 110, 82, 167, 11, 126, 189, 141, 231, 39, 
+  54, 120, 36, 197, 244, 219, 167, 152, 36, 174, 190, 122, 245, 28, 246, 141, 
+  126, 97, 27, 70, 136, 179, 49, 23, 90, 189, 237, 27, 110, 193, 180, 91, 
+  200, 173, 195, 222, 116, 74, 253, 21, 238, 5, 16, 78, 30, 194, 151, 205, 
+  224, 241, 34, 43, 202, 156, 226, 70, 252, 121, 113, 151, 189, 248, 169, 189, 
+  6, 115, 84, 121, 219, 68, 172, 253, 187, 33, 37, 227, 208, 3, 235, 173, 
+  232, 40, 42, 55, 48, 148, 13, 110, 90, 7, 80, 53, 9, 28, 220, 242, 
+  161, 173, 125, 247, 46, 134, 181, 130, 2, 149, 126, 108, 145, 160, 113, 88, 
+  182, 55, 172, 211, 247, 58, 120, 186, 90, 234, 203, 6, 203, 13, 115, 222, 
+  171, 97, 197, 63, 218, 118, 164, 122, 170, 191, 68, 114, 131, 149, 161, 74, 
+  87, 117, 194, 156, 54, 127, 137, 15, 251, 125, 211, 141, 137, 238, 165, 233, 
+  177, 115, 148, 87, 83, 251, 41, 12, 194, 90, 59, 161, 239, 234, 199, 236, 
+  247, 126, 247, 238, 205, 122, 255, 98, 129, 186, 137, 116, 127, 225, 88, 221, 
+  212, 230, 77, 248, 90, 57, 57, 52, 99, 27, 198, 219, 238, 95, 44, 227, 
+  69, 168, 155, 31, 54, 112, 157, 21, 54, 151, 237, 59, 54, 45, 67, 219, 
+  236, 148, 224, 49, 172, 178, 211, 218, 235, 13, 52, 220, 237, 179, 190, 118, 
+  14, 186, 169, 177, 183, 16, 67, 135, 77, 101, 84, 224, 69, 231, 38, 44, 
+  110, 240, 145, 160, 119, 120, 187, 188, 41, 210, 181, 213, 45, 163, 67, 15, 
+  28, 62, 215, 185, 21, 188, 127, 191, 245, 232, 225, 164, 85, 81, 77, 115, 
+  188, 133, 107, 157, 18, 106, 125, 18, 106, 46, 46, 216, 2, 245, 38, 131, 
+  217, 124, 216, 10, 21, 15, 236, 136, 240, 160, 97, 134, 53, 154, 251, 131, 
+  124, 33, 22, 5, 155, 53, 195, 187, 255, 224, 209, 131, 36, 174, 140, 144, 
+  253, 67, 214, 53, 22, 218, 138, 240, 164, 130, 201, 152, 228, 43, 155, 247, 
+  190, 185, 247, 141, 223, 9, 108, 48, 168, 52, 205, 41, 1, 139, 119, 15, 
+  80, 198, 229, 170, 88, 115, 185, 241, 252, 155, 116, 244, 252, 155, 58, 88, 
+  15, 227, 135, 195, 205, 205, 245, 170, 26, 45, 186, 232, 45, 249, 102, 153, 
+  207, 22, 20, 41, 198, 109, 209, 107, 247, 230, 130, 42, 133, 242, 137, 192, 
+  180, 206, 78, 226, 94, 141, 251, 6, 249, 158, 137, 54, 118, 85, 162, 238, 
+  222, 222, 111, 112, 42, 15, 206, 127, 23, 57, 213, 168, 20, 179, 123, 243, 
+  85, 158, 100, 147, 75, 218, 183, 113, 2, 68, 33, 179, 91, 234, 34, 29, 
+  157, 101, 229, 187, 250, 50, 125, 216, 161, 25, 197, 105, 235, 163, 161, 143, 
+  71, 72, 60, 172, 89, 183, 209, 27, 183, 79, 21, 196, 55, 75, 82, 64, 
+  69, 255, 59, 73, 190, 46, 79, 65, 72, 218, 254, 100, 232, 127, 103, 231, 
+  130, 142, 45, 148, 15, 29, 33, 0, 112, 20, 147, 23, 50, 89, 149, 89, 
+  32, 191, 225, 76, 25, 142, 34, 243, 152, 162, 215, 168, 226, 69, 138, 247, 
+  86, 180, 129, 245, 81, 137, 209, 101, 86, 163, 89, 86, 218, 48, 54, 178, 
+  203, 57, 178, 164, 133, 233, 13, 92, 113, 110, 118, 95, 165, 124, 117, 244, 
+  179, 27, 74, 173, 167, 150, 81, 51, 199, 191, 203, 70, 224, 74, 97, 182, 
+  45, 255, 166, 70, 183, 177, 8, 118, 33, 239, 202, 235, 210, 26, 64, 155, 
+  61, 93, 223, 116, 232, 4, 142, 142, 122, 75, 145, 4, 207, 210, 75, 76, 
+  45, 96, 116, 131, 218, 229, 226, 249, 156, 242, 90, 179, 234, 19, 191, 191, 
+  193, 168, 48, 105, 162, 133, 87, 91, 24, 228, 236, 252, 226, 221, 66, 138, 
+  199, 248, 235, 218, 226, 168, 97, 93, 95, 129, 119, 144, 7, 55, 76, 75, 
+  48, 203, 49, 176, 17, 123, 205, 40, 205, 112, 200, 10, 166, 162, 190, 181, 
+  172, 96, 133, 15, 76, 215, 36, 213, 12, 214, 2, 58, 158, 128, 220, 82, 
+  212, 164, 96, 174, 230, 27, 240, 181, 23, 244, 139, 163, 101, 123, 130, 191, 
+  218, 33, 46, 254, 162, 195, 102, 212, 61, 28, 228, 70, 158, 229, 129, 63, 
+  221, 230, 208, 87, 120, 196, 161, 113, 99, 68, 41, 45, 233, 119, 193, 145, 
+  198, 48, 144, 24, 210, 66, 42, 254, 220, 169, 154, 120, 196, 152, 249, 14, 
+  127, 71, 51, 190, 62, 224, 24, 255, 111, 137, 28, 226, 217, 46, 229, 208, 
+  102, 210, 24, 172, 163, 128, 142, 175, 56, 244, 153, 116, 198, 43, 179, 207, 
+  119, 107, 120, 76, 217, 122, 252, 219, 68, 67, 219, 55, 97, 15, 1, 136, 
+  99, 232, 114, 48, 24, 180, 184, 238, 1, 233, 156, 78, 204, 192, 36, 226, 
+  206, 7, 233, 134, 46, 35, 1, 242, 64, 150, 39, 188, 113, 161, 56, 31, 
+  198, 174, 184, 26, 34, 180, 132, 193, 90, 207, 179, 88, 170, 194, 131, 110, 
+  21, 164, 188, 8, 30, 214, 96, 65, 197, 137, 195, 79, 68, 23, 155, 107, 
+  97, 125, 164, 215, 32, 124, 57, 230, 165, 128, 250, 159, 62, 217, 96, 229, 
+  88, 0, 186, 194, 208, 34, 24, 36, 28, 69, 47, 104, 29, 58, 129, 111, 
+  143, 177, 42, 122, 179, 68, 219, 20, 53, 213, 176, 3, 123, 251, 251, 239, 
+  94, 61, 231, 192, 66, 23, 24, 108, 113, 12, 39, 62, 138, 232, 207, 95, 
+  30, 188, 120, 254, 118, 219, 148, 139, 162, 59, 17, 239, 126, 19, 153, 137, 
+  128, 161, 95, 115, 108, 47, 9, 215, 104, 226, 82, 218, 185, 242, 192, 208, 
+  143, 166, 162, 81, 3, 74, 162, 181, 106, 53, 145, 89, 140, 41, 22, 54, 
+  178, 3, 223, 190, 163, 89, 193, 108, 42, 54, 87, 188, 25, 146, 132, 174, 
+  68, 104, 234, 135, 243, 163, 174, 6, 163, 6, 30, 65, 71, 118, 131, 202, 
+  75, 176, 60, 35, 146, 91, 160, 68, 216, 227, 137, 234, 184, 105, 56, 154, 
+  152, 133, 56, 201, 209, 176, 113, 251, 112, 115, 235, 104, 163, 27, 90, 143, 
+  37, 31, 216, 126, 12, 191, 124, 23, 197, 54, 166, 12, 12, 218, 79, 117, 
+  64, 215, 30, 80, 22, 70, 155, 124, 56, 2, 222, 151, 242, 39, 116, 90, 
+  183, 135, 120, 246, 222, 110, 5, 145, 97, 176, 189, 191, 68, 91, 33, 133, 
+  193, 22, 236, 104, 59, 231, 181, 23, 133, 220, 3, 22, 172, 17, 231, 98, 
+  210, 73, 104, 36, 22, 80, 54, 106, 5, 51, 126, 169, 244, 124, 58, 36, 
+  47, 251, 129, 224, 83, 207, 139, 212, 57, 185, 101, 194, 240, 97, 252, 153, 
+  77, 85, 147, 226, 80, 120, 71, 161, 246, 145, 155, 90, 201, 94, 145, 45, 
+  231, 240, 65, 91, 221, 93, 22, 89, 63, 147, 159, 219, 58, 228, 74, 251, 
+  173, 103, 205, 224, 198, 84, 19, 220, 194, 105, 77, 9, 100, 206, 66, 194, 
+  54, 246, 166, 169, 49, 135, 76, 54, 13, 92, 181, 3, 166, 212, 179, 243, 
+  32, 42, 17, 93, 49, 206, 138, 147, 128, 65, 14, 204, 79, 189, 139, 47, 
+  128, 141, 62, 176, 113, 107, 201, 161, 141, 13, 233, 87, 28, 12, 154, 121, 
+  228, 78, 221, 145, 160, 143, 225, 90, 101, 130, 138, 96, 231, 159, 93, 42, 
+  66, 187, 90, 6, 142, 37, 23, 132, 146, 211, 76, 12, 34, 91, 39, 8, 
+  37, 167, 27, 174, 210, 8, 91, 34, 96, 232, 116, 43, 87, 213, 153, 105, 
+  6, 192, 63, 213, 93, 32, 126, 19, 132, 223, 155, 217, 78, 56, 111, 172, 
+  49, 32, 95, 105, 152, 152, 176, 37, 237, 232, 177, 183, 43, 43, 211, 20, 
+  221, 83, 199, 3, 84, 157, 54, 63, 172, 133, 106, 157, 176, 86, 183, 10, 
+  225, 48, 227, 135, 87, 3, 167, 4, 191, 28, 252, 172, 10, 21, 149, 225, 
+  202, 194, 90, 136, 85, 51, 20, 137, 67, 105, 86, 252, 5, 156, 140, 36, 
+  226, 174, 180, 130, 81, 230, 235, 204, 11, 36, 176, 15, 191, 241, 22, 133, 
+  55, 196, 243, 160, 196, 151, 66, 122, 85, 160, 17, 233, 45, 94, 24, 170, 
+  36, 186, 96, 140, 105, 158, 205, 82, 232, 191, 83, 173, 104, 49, 39, 95, 
+  12, 209, 120, 57, 12, 146, 142, 31, 10, 91, 155, 81, 192, 202, 213, 12, 
+  217, 43, 18, 11, 37, 232, 33, 138, 180, 20, 159, 245, 143, 116, 153, 71, 
+  157, 199, 221, 176, 217, 77, 213, 44, 187, 56, 68, 253, 40, 173, 9, 109, 
+  110, 17, 6, 235, 124, 79, 35, 10, 143, 18, 29, 9, 28, 89, 119, 134, 
+  139, 10, 2, 110, 62, 54, 24, 248, 144, 162, 129, 111, 246, 244, 26, 230, 
+  104, 38, 163, 167, 26, 81, 216, 241, 29, 227, 249, 236, 53, 100, 131, 131, 
+  155, 39, 194, 241, 114, 152, 247, 166, 216, 222, 118, 233, 118, 188, 117, 116, 
+  116, 215, 35, 194, 59, 228, 196, 148, 115, 188, 68, 138, 157, 133, 34, 179, 
+  225, 135, 190, 219, 96, 87, 200, 239, 111, 225, 119, 244, 68, 249, 254, 214, 
+  119, 27, 167, 229, 108, 250, 253, 173, 255, 7, 60, 59, 239, 220, 124, 133, 
+  1, 0, 
+  0
+};
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@mdb.lua", (const char *) data1, 3859, 0 },
+   { "httpd", "@../monoglot/.out/exports/httpd.lua", (const char *) data2, 17150, 0 },
+   { "object", "@../luau/.out/exports/object.lua", (const char *) data3, 398, 0 },
+   { "xpio", "@../monoglot/.out/exports/xpio.lua", (const char *) data4, 3909, 0 },
+   { "xpio_c", 0, (const char *) 0, 0, luaopen_xpio_c },
+   { "xpfs", 0, (const char *) 0, 0, luaopen_xpfs },
+   { "xuri", "@../luau/.out/exports/xuri.lua", (const char *) data5, 4523, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c },
+   { "thread", "@../monoglot/.out/exports/thread.lua", (const char *) data6, 9693, 0 },
+   { "heap", "@../monoglot/.out/exports/heap.lua", (const char *) data7, 701, 0 },
+   { "queue", "@../monoglot/.out/exports/queue.lua", (const char *) data8, 776, 0 },
+   { "substream", "@../monoglot/.out/exports/substream.lua", (const char *) data9, 986, 0 },
+   { "chunkedstream", "@../monoglot/.out/exports/chunkedstream.lua", (const char *) data10, 1435, 0 },
+   { "bufio", "@../monoglot/.out/exports/bufio.lua", (const char *) data11, 1673, 0 },
+   { "deflate_c", 0, (const char *) 0, 0, luaopen_deflate_c },
+   { "lpeg", 0, (const char *) 0, 0, luaopen_lpeg },
+   { "dino", "@../monoglot/.out/exports/dino.lua", (const char *) data12, 3315, 0 },
+   { "memoize", "@../luau/.out/exports/memoize.lua", (const char *) data13, 785, 0 },
+   { "htmlgen", "@../luau/.out/exports/htmlgen.lua", (const char *) data14, 4728, 0 },
+   { "utf8utils", "@../luau/.out/exports/utf8utils.lua", (const char *) data15, 2235, 0 },
+   { "doctree", "@../luau/.out/exports/doctree.lua", (const char *) data16, 712, 0 },
+   { "opairs", "@../luau/.out/exports/opairs.lua", (const char *) data17, 419, 0 },
+   { "trapfilter", "@../monoglot/.out/exports/trapfilter.lua", (const char *) data18, 634, 0 },
+   { "logfilter", "@../monoglot/.out/exports/logfilter.lua", (const char *) data19, 318, 0 },
+   { "target", "@target.lua", (const char *) data20, 3442, 0 },
+   { "event", "@../monoglot/.out/exports/event.lua", (const char *) data21, 1267, 0 },
+   { "mdbser", "@mdbser.lua", (const char *) data22, 1876, 0 },
+   { "futex", "@../monoglot/.out/exports/futex.lua", (const char *) data23, 379, 0 },
+   { "observable", "@observable.lua", (const char *) data24, 2239, 0 },
+   { "mdbser_c", 0, (const char *) 0, 0, luaopen_mdbser_c },
+   { "getopts", "@../luau/.out/exports/getopts.lua", (const char *) data25, 1615, 0 },
+   { "json", "@../luau/.out/exports/json.lua", (const char *) data26, 3874, 0 },
+   { "requirefile", 0, (const char *) 0, 0, luaopen_requirefile },
+   { "farf", "@farf.lua", (const char *) data27, 253, 0 },
+   { "owebserve", "@owebserve.lua", (const char *) data28, 6691, 0 },
+   { "list", "@../luau/.out/exports/list.lua", (const char *) data29, 3689, 0 },
+   { "serialize", "@../luau/.out/exports/serialize.lua", (const char *) data30, 1867, 0 },
+   { "logsocket", "@logsocket.lua", (const char *) data31, 2263, 0 },
+   { "after", "@after.lua", (const char *) data32, 1127, 0 }
+};
+
+
+
+typedef struct {
+   const char * pszPath;      // requirefile path
+   const char * pc;
+   size_t       cb;
+} RequireFiles;
+
+
+static const RequireFiles rfiles[] = { 
+   { "mdb/mdbapp.html.gz", (const char *) data33, 28050 }
+};
+
+
+// path --> contents
+static int requirefile(lua_State *L)
+{
+   const char *path = lua_tostring(L, -1);
+   size_t ndx;
+
+   for (ndx = 0; ndx < ARRAYLENGTH(rfiles); ++ndx) {
+      if (!strcmp(path, rfiles[ndx].pszPath)) {
+         lua_pushlstring(L, rfiles[ndx].pc, rfiles[ndx].cb);
+         return 1;
+      }
+   }
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
@@ -0,0 +1 @@
+return {stamp="4070:1171519:65024:1792361468",path="../jsu/anim.js",value={requires={"view.js","class.js"}}}
@@ -0,0 +1 @@
+return {stamp="2647:1171523:65024:1792361468",path="../jsu/button.js",value={requires={"view.js","scheduler.js","anim.js","eventutils.js"}}}
@@ -0,0 +1 @@
+return {value={requires={}},stamp="628:1171526:65024:1792361468",path="../jsu/class.js"}
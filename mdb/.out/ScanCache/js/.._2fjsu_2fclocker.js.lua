@@ -0,0 +1 @@
+return {path="../jsu/clocker.js",stamp="1761:1171529:65024:1792361468",value={requires={}}}
@@ -0,0 +1 @@
+return {path="../jsu/demo.js",stamp="2296:1171530:65024:1792361468",value={requires={"view.js","serialize.js"}}}
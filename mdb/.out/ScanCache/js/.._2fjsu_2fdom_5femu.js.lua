@@ -0,0 +1 @@
+return {value={requires={"class.js","expect.js"}},stamp="10889:1171531:65024:1792361468",path="../jsu/dom_emu.js"}
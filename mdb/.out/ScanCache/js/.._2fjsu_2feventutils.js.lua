@@ -0,0 +1 @@
+return {value={requires={}},stamp="4260:1171532:65024:1792361468",path="../jsu/eventutils.js"}
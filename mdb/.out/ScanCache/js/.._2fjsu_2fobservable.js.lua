@@ -0,0 +1 @@
+return {value={requires={"class.js","memoize.js"}},stamp="7103:1171541:65024:1792361468",path="../jsu/observable.js"}
@@ -0,0 +1 @@
+return {stamp="6941:1171544:65024:1792363170",value={requires={"class.js","observable.js"}},path="../jsu/oweb.js"}
@@ -0,0 +1 @@
+return {stamp="964:1171552:65024:1792361468",path="../jsu/scheduler.js",value={requires={}}}
@@ -0,0 +1 @@
+return {value={requires={}},stamp="2990:1171554:65024:1792361468",path="../jsu/serialize.js"}
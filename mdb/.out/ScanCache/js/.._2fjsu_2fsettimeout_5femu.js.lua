@@ -0,0 +1 @@
+return {stamp="255:1171556:65024:1792361468",path="../jsu/settimeout_emu.js",value={requires={}}}
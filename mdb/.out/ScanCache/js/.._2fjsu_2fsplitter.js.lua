@@ -0,0 +1 @@
+return {stamp="4316:1171557:65024:1792361468",path="../jsu/splitter.js",value={requires={"view.js","eventutils.js"}}}
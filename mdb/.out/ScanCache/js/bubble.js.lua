@@ -0,0 +1 @@
+return {stamp="2083:1171633:65024:1792361468",path="bubble.js",value={requires={"view.js"}}}
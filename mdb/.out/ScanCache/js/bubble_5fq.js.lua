@@ -0,0 +1 @@
+return {path="bubble_q.js",stamp="437:1171635:65024:1792361468",value={requires={"dom_emu.js","settimeout_emu.js","bubble.js","demo.js","observable.js","expect.js"}}}
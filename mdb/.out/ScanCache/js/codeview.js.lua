@@ -0,0 +1 @@
+return {stamp="8595:1171636:65024:1792361468",path="codeview.js",value={requires={"view.js","highlight.js","eventutils.js","scheduler.js","anim.js","mdbvalue.js"}}}
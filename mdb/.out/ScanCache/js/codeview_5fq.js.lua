@@ -0,0 +1 @@
+return {value={requires={"dom_emu.js","settimeout_emu.js","expect.js","codeview.js"}},stamp="377:1171638:65024:1792361468",path="codeview_q.js"}
@@ -0,0 +1 @@
+return {stamp="6644:1171639:65024:1792361468",path="consoleview.js",value={requires={"view.js","class.js","scheduler.js","anim.js","eventutils.js","mdbvalue.js"}}}
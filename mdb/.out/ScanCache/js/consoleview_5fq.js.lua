@@ -0,0 +1 @@
+return {path="consoleview_q.js",value={requires={"dom_emu.js","consoleview.js","mdb_emu.js","expect.js"}},stamp="315:1171641:65024:1792361468"}
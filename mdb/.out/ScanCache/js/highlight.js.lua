@@ -0,0 +1 @@
+return {stamp="4707:1171644:65024:1792361468",path="highlight.js",value={requires={"class.js"}}}
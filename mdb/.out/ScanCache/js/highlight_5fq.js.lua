@@ -0,0 +1 @@
+return {path="highlight_q.js",stamp="1558:1171645:65024:1792361468",value={requires={"expect.js","highlight.js","clocker.js","samplelua.js"}}}
@@ -0,0 +1 @@
+return {stamp="1309:1171646:65024:1792361468",path="localsview.js",value={requires={"view.js","mdbvalue.js"}}}
@@ -0,0 +1 @@
+return {path="localsview_q.js",stamp="375:1171648:65024:1792361468",value={requires={"dom_emu.js","localsview.js"}}}
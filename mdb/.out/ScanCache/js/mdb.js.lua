@@ -0,0 +1 @@
+return {stamp="2190:1171940:65024:1792363170",value={requires={"xhttp.js","oweb.js","scheduler.js","observable.js"}},path="mdb.js"}
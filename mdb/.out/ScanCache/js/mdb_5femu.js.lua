@@ -0,0 +1 @@
+return {stamp="6636:1171654:65024:1792361468",path="mdb_emu.js",value={requires={"observable.js","scheduler.js","samplelua.js","xhttp.js"}}}
@@ -0,0 +1 @@
+return {stamp="1041:1171658:65024:1792361468",value={title="MDB",requires={"mdb.js","view.js","mdbview.js","mdbvalue.js","consoleview.js"}},path="mdbapp.js"}
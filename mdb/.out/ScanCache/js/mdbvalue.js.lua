@@ -0,0 +1 @@
+return {stamp="4465:1171661:65024:1792361468",path="mdbvalue.js",value={requires={"view.js","observable.js","class.js","bubble.js","button.js"}}}
@@ -0,0 +1 @@
+return {path="mdbvalue_q.js",value={requires={"dom_emu.js","expect.js","mdbvalue.js"}},stamp="1169:1171663:65024:1792361468"}
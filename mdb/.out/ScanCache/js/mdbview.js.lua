@@ -0,0 +1 @@
+return {stamp="17380:1171664:65024:1792361468",path="mdbview.js",value={requires={"view.js","observable.js","button.js","splitter.js","codeview.js","stackview.js","localsview.js","consoleview.js","eventutils.js","scheduler.js","anim.js"}}}
@@ -0,0 +1 @@
+return {stamp="220:1171666:65024:1792361468",path="mdbview_q.js",value={requires={"dom_emu.js","settimeout_emu.js","mdb_emu.js","mdbview.js"}}}
@@ -0,0 +1 @@
+return {stamp="1499:1171673:65024:1792361468",path="samplelua.js",value={requires={}}}
@@ -0,0 +1 @@
+return {value={requires={"view.js","observable.js","eventutils.js"}},stamp="4010:1171674:65024:1792361468",path="stackview.js"}
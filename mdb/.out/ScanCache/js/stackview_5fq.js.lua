@@ -0,0 +1 @@
+return {value={requires={"dom_emu.js","stackview.js"}},stamp="261:1171676:65024:1792361468",path="stackview_q.js"}
@@ -0,0 +1 @@
+return {value={},stamp="8210:1173410:65024:1792372283",path="../luau/.out/exports/fsu.lua"}
@@ -0,0 +1 @@
+return {value={"require","utf8utils"},stamp="6442:1173416:65024:1792372283",path="../luau/.out/exports/json.lua"}
@@ -0,0 +1 @@
+return {stamp="5299:1173420:65024:1792372283",value={"require","object","require","serialize"},path="../luau/.out/exports/list.lua"}
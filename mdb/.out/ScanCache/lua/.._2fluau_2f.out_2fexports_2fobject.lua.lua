@@ -0,0 +1 @@
+return {path="../luau/.out/exports/object.lua",value={},stamp="676:1173428:65024:1792372283"}
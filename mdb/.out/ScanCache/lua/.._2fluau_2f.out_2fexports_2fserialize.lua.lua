@@ -0,0 +1 @@
+return {stamp="4036:1173438:65024:1792372283",value={},path="../luau/.out/exports/serialize.lua"}
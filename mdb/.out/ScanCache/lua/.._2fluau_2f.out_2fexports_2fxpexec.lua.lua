@@ -0,0 +1 @@
+return {stamp="5282:1173448:65024:1792372283",value={},path="../luau/.out/exports/xpexec.lua"}
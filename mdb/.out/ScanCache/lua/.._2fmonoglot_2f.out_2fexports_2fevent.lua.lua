@@ -0,0 +1 @@
+return {path="../monoglot/.out/exports/event.lua",value={"require","object","require","xpio"},stamp="2245:1173967:65024:1792371891"}
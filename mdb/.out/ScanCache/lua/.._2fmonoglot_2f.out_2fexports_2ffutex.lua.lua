@@ -0,0 +1 @@
+return {path="../monoglot/.out/exports/futex.lua",value={"require","event"},stamp="620:1173969:65024:1792361630"}
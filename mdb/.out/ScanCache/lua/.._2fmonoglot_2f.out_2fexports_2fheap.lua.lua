@@ -0,0 +1 @@
+return {path="../monoglot/.out/exports/heap.lua",value={"require","object"},stamp="1075:1173971:65024:1792361630"}
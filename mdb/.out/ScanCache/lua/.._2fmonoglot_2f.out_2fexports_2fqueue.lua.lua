@@ -0,0 +1 @@
+return {path="../monoglot/.out/exports/queue.lua",value={"require","object"},stamp="1187:1173983:65024:1792371891"}
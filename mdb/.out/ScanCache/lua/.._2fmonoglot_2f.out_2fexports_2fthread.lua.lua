@@ -0,0 +1 @@
+return {stamp="17491:1173987:65024:1792374803",value={"require","xpio","require","heap","require","queue"},path="../monoglot/.out/exports/thread.lua"}
@@ -0,0 +1 @@
+return {path="../monoglot/.out/exports/xpio.lua",value={"require","xpio_c","require","xpfs"},stamp="7991:1173991:65024:1792371891"}
@@ -0,0 +1 @@
+return {path="after.lua",value={"require","observable","require","thread","require","xpio"},stamp="2066:1171629:65024:1792361468"}
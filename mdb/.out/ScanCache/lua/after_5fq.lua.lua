@@ -0,0 +1 @@
+return {path="after_q.lua",value={"require","qtest","require","timeharness","require","thread","require","xpio","require","observable","require","after"},stamp="1351:1171630:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="agentlib.lua",value={"require","xpio_c","require","object","require","mdbser","require","valuemap","require","farf"},stamp="25209:1171631:65024:1792363459"}
@@ -0,0 +1 @@
+return {stamp="2033:1171632:65024:1792361468",path="agentlib_q.lua",value={"require","qtest","require","xpio","require","agentlib"}}
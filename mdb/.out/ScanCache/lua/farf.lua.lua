@@ -0,0 +1 @@
+return {path="farf.lua",value={},stamp="324:1171643:65024:1792361468"}
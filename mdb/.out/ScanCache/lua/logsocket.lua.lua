@@ -0,0 +1 @@
+return {value={},path="logsocket.lua",stamp="3108:1171649:65024:1792361468"}
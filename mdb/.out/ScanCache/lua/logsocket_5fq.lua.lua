@@ -0,0 +1 @@
+return {value={"require","qtest","require","logsocket","require","object"},path="logsocket_q.lua",stamp="2230:1171650:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="mdbagent.lua",value={"require","agentlib","require","agentlib"},stamp="1300:1171656:65024:1792361468"}
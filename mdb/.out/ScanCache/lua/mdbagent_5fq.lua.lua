@@ -0,0 +1 @@
+return {path="mdbagent_q.lua",stamp="1167:1171657:65024:1792361468",value={"require","qtest","require","testexe","require","testtarget"}}
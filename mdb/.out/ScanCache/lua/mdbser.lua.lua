@@ -0,0 +1 @@
+return {stamp="2984:1171659:65024:1792372090",path="mdbser.lua",value={}}
@@ -0,0 +1 @@
+return {path="mdbser_c_q.lua",stamp="2412:1172839:65024:1792363431",value={"require","qtest","require","mdbser","require","mdbser_c"}}
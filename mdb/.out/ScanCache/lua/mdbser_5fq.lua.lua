@@ -0,0 +1 @@
+return {stamp="797:1171660:65024:1792361468",path="mdbser_q.lua",value={"require","qtest","require","mdbser"}}
@@ -0,0 +1 @@
+return {path="observable.lua",value={"require","object"},stamp="3676:1171667:65024:1792361468"}
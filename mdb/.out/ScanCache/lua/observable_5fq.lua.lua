@@ -0,0 +1 @@
+return {path="observable_q.lua",stamp="3446:1171668:65024:1792361468",value={"require","qtest","require","observable","require","list"}}
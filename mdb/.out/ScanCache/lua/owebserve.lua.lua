@@ -0,0 +1 @@
+return {path="owebserve.lua",value={"require","event","require","object","require","thread","require","json","require","queue","require","xpio","require","list"},stamp="14098:1171670:65024:1792373899"}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","observable","require","thread","require","owebserve","require","valuemap","require","object","require","xpio","require","json","require","json"},path="owebserve_q.lua",stamp="13541:1171671:65024:1792373869"}
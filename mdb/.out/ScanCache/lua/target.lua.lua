@@ -0,0 +1 @@
+return {path="target.lua",value={"require","object","require","thread","require","xpio","require","event","require","mdbser","require","futex","require","observable","require","mdbser_c"},stamp="5848:1171677:65024:1792371996"}
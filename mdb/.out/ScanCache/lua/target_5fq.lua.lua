@@ -0,0 +1 @@
+return {path="target_q.lua",value={"require","qtest","require","fsu","require","observable","require","thread","require","target","require","farf","require","xpio","require","json","require","mdbagent"},stamp="14104:1171678:65024:1792372003"}
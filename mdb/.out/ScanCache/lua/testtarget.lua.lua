@@ -0,0 +1 @@
+return {path="testtarget.lua",stamp="231:1171679:65024:1792361468",value={}}
@@ -0,0 +1 @@
+return {path="timeharness.lua",value={},stamp="3692:1171680:65024:1792361468"}
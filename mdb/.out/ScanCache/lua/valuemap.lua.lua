@@ -0,0 +1 @@
+return {stamp="1453:1171682:65024:1792361468",value={"require","object"},path="valuemap.lua"}
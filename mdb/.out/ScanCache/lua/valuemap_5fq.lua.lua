@@ -0,0 +1 @@
+return {stamp="537:1171683:65024:1792361468",value={"require","qtest","require","valuemap"},path="valuemap_q.lua"}
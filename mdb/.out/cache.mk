@@ -0,0 +1,689 @@
+_cachedIDs = Alias(default) Copy(LuaBundle(mdbagent.lua),dir:.out/exports/) Copy(LuaExe(mdb.lua),dir:.out/exports/) Copy(mdb.txt,dir:.out/exports/) GZip(JSToHTML(mdbapp.js)) JSScan(bubble_q.js) JSScan(codeview_q.js) JSScan(consoleview_q.js) JSScan(highlight_q.js) JSScan(localsview_q.js) JSScan(mdbvalue_q.js) JSScan(mdbview_q.js) JSScan(stackview_q.js) JSTest(bubble_q.js) JSTest(codeview_q.js) JSTest(consoleview_q.js) JSTest(highlight_q.js) JSTest(localsview_q.js) JSTest(mdbvalue_q.js) JSTest(mdbview_q.js) JSTest(stackview_q.js) JSToHTML(mdbapp.js) LuaBundle(mdbagent.lua) LuaCC(LuaToC(mdb.lua)) LuaExe(mdb.lua) LuaScan(after_q.lua) LuaScan(agentlib_q.lua) LuaScan(logsocket_q.lua) LuaScan(mdbagent_q.lua) LuaScan(mdbser_c_q.lua) LuaScan(mdbser_q.lua) LuaScan(observable_q.lua) LuaScan(owebserve_q.lua) LuaScan(target_q.lua) LuaScan(valuemap_q.lua) LuaTest(after_q.lua) LuaTest(agentlib_q.lua) LuaTest(logsocket_q.lua) LuaTest(mdbagent_q.lua) LuaTest(mdbser_c_q.lua) LuaTest(mdbser_q.lua) LuaTest(observable_q.lua) LuaTest(owebserve_q.lua) LuaTest(target_q.lua) LuaTest(valuemap_q.lua) LuaToC(mdb.lua) Ship(exports)
+
+.PHONY: default
+default : .out/Ship/exports .out/LuaTest/after_q.ok .out/LuaTest/agentlib_q.ok .out/LuaTest/logsocket_q.ok .out/LuaTest/mdbagent_q.ok .out/LuaTest/mdbser_c_q.ok .out/LuaTest/mdbser_q.ok .out/LuaTest/observable_q.ok .out/LuaTest/owebserve_q.ok .out/LuaTest/target_q.ok .out/LuaTest/valuemap_q.ok .out/JSTest/bubble_q.ok .out/JSTest/codeview_q.ok .out/JSTest/consoleview_q.ok .out/JSTest/highlight_q.ok .out/JSTest/localsview_q.ok .out/JSTest/mdbvalue_q.ok .out/JSTest/mdbview_q.ok .out/JSTest/stackview_q.ok  | 
+	$(call _traceRecord,B,$@ 'Alias$[default$]')
+	@true
+	$(call _traceRecord,E,$@ $^ $|)
+	$(if $(and $(minionOutputCache),$(filter default,$(or $(MAKECMDGOALS),default))),@../build/ocache.sh --stats .out/ocache.log)
+
+
+ 
+.out/exports/mdbagent.lua : .out/LuaBundle/mdbagent.lua  | 
+	$(call _traceRecord,B,$@ 'Copy$[LuaBundle$[mdbagent.lua$]$;dir:.out/exports/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@D_LuaBundle/ .out/exports/
+	@echo '_vv=.cp .out/LuaBundle/mdbagent.lua !@.lua.' > .out/Copy_@1,dir@C.out@Dexports@D_LuaBundle/mdbagent.lua.vv
+	cp .out/LuaBundle/mdbagent.lua .out/exports/mdbagent.lua
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@D_LuaBundle/mdbagent.lua.vv
+ifneq "$(_vv)" ".cp .out/LuaBundle/mdbagent.lua !@.lua."
+  .out/exports/mdbagent.lua: .out/FORCE
+endif
+
+ 
+.out/exports/mdb : .out/LuaExe/mdb  | 
+	$(call _traceRecord,B,$@ 'Copy$[LuaExe$[mdb.lua$]$;dir:.out/exports/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@D_LuaExe/ .out/exports/
+	@echo '_vv=.cp .out/LuaExe/mdb !@.' > .out/Copy_@1,dir@C.out@Dexports@D_LuaExe/mdb.vv
+	cp .out/LuaExe/mdb .out/exports/mdb
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@D_LuaExe/mdb.vv
+ifneq "$(_vv)" ".cp .out/LuaExe/mdb !@."
+  .out/exports/mdb: .out/FORCE
+endif
+
+ 
+.out/exports/mdb.txt : mdb.txt  | 
+	$(call _traceRecord,B,$@ 'Copy$[mdb.txt$;dir:.out/exports/$]')
+	@mkdir -p .out/Copy_@1,dir@C.out@Dexports@D/ .out/exports/
+	@echo '_vv=.cp mdb.txt !@.txt.' > .out/Copy_@1,dir@C.out@Dexports@D/mdb.txt.vv
+	cp mdb.txt .out/exports/mdb.txt
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/Copy_@1,dir@C.out@Dexports@D/mdb.txt.vv
+ifneq "$(_vv)" ".cp mdb.txt !@.txt."
+  .out/exports/mdb.txt: .out/FORCE
+endif
+
+ 
+.out/GZip_JSToHTML/mdbapp.html.gz : .out/JSToHTML/mdbapp.html  | 
+	$(call _traceRecord,B,$@ 'GZip$[JSToHTML$[mdbapp.js$]$]')
+	@mkdir -p .out/GZip_JSToHTML/
+	@echo '_vv=.(  gzip -c .out/JSToHTML/mdbapp.html ) > !@.gz || ( rm -f !@.gz; false ).' > .out/GZip_JSToHTML/mdbapp.html.vv
+	(  gzip -c .out/JSToHTML/mdbapp.html ) > .out/GZip_JSToHTML/mdbapp.html.gz || ( rm -f .out/GZip_JSToHTML/mdbapp.html.gz; false )
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/GZip_JSToHTML/mdbapp.html.vv
+ifneq "$(_vv)" ".(  gzip -c .out/JSToHTML/mdbapp.html ) > !@.gz || ( rm -f !@.gz; false )."
+  .out/GZip_JSToHTML/mdbapp.html.gz: .out/FORCE
+endif
+
+ 
+.out/JSScan/bubble_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[bubble_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep bubble_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/bubble_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/bubble_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep bubble_q.js -MF .out/JSScan/bubble_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/bubble_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/bubble_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep bubble_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/bubble_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/bubble_q.d: .out/FORCE
+endif
+-include .out/JSScan/bubble_q.d
+
+ 
+.out/JSScan/codeview_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[codeview_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep codeview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/codeview_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/codeview_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep codeview_q.js -MF .out/JSScan/codeview_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/codeview_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/codeview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep codeview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/codeview_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/codeview_q.d: .out/FORCE
+endif
+-include .out/JSScan/codeview_q.d
+
+ 
+.out/JSScan/consoleview_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[consoleview_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep consoleview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/consoleview_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/consoleview_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep consoleview_q.js -MF .out/JSScan/consoleview_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/consoleview_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/consoleview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep consoleview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/consoleview_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/consoleview_q.d: .out/FORCE
+endif
+-include .out/JSScan/consoleview_q.d
+
+ 
+.out/JSScan/highlight_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[highlight_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep highlight_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/highlight_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/highlight_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep highlight_q.js -MF .out/JSScan/highlight_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/highlight_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/highlight_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep highlight_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/highlight_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/highlight_q.d: .out/FORCE
+endif
+-include .out/JSScan/highlight_q.d
+
+ 
+.out/JSScan/localsview_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[localsview_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep localsview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/localsview_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/localsview_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep localsview_q.js -MF .out/JSScan/localsview_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/localsview_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/localsview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep localsview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/localsview_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/localsview_q.d: .out/FORCE
+endif
+-include .out/JSScan/localsview_q.d
+
+ 
+.out/JSScan/mdbvalue_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[mdbvalue_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep mdbvalue_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/mdbvalue_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/mdbvalue_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep mdbvalue_q.js -MF .out/JSScan/mdbvalue_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/mdbvalue_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/mdbvalue_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep mdbvalue_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/mdbvalue_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/mdbvalue_q.d: .out/FORCE
+endif
+-include .out/JSScan/mdbvalue_q.d
+
+ 
+.out/JSScan/mdbview_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[mdbview_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep mdbview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/mdbview_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/mdbview_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep mdbview_q.js -MF .out/JSScan/mdbview_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/mdbview_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/mdbview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep mdbview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/mdbview_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/mdbview_q.d: .out/FORCE
+endif
+-include .out/JSScan/mdbview_q.d
+
+ 
+.out/JSScan/stackview_q.d :   | 
+	$(call _traceRecord,B,$@ 'JSScan$[stackview_q.js$]')
+	@mkdir -p .out/JSScan/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep stackview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/stackview_q.ok -MTF --scan-cache=.out/ScanCache.' > .out/JSScan/stackview_q.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep stackview_q.js -MF .out/JSScan/stackview_q.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/stackview_q.ok -MTF --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSScan/stackview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep stackview_q.js -MF !@.d -Moo .out/JSTest/^B_q.ok -MT .out/JSTest/stackview_q.ok -MTF --scan-cache=.out/ScanCache."
+  .out/JSScan/stackview_q.d: .out/FORCE
+endif
+-include .out/JSScan/stackview_q.d
+
+ 
+.out/JSTest/bubble_q.ok : bubble_q.js .out/JSScan/bubble_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[bubble_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  bubble_q.js!ntouch !@.ok.' > .out/JSTest/bubble_q.js.vv
+	NODE_PATH='.:../jsu'  node  bubble_q.js
+	touch .out/JSTest/bubble_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/bubble_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  bubble_q.js!ntouch !@.ok."
+  .out/JSTest/bubble_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/codeview_q.ok : codeview_q.js .out/JSScan/codeview_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[codeview_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  codeview_q.js!ntouch !@.ok.' > .out/JSTest/codeview_q.js.vv
+	NODE_PATH='.:../jsu'  node  codeview_q.js
+	touch .out/JSTest/codeview_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/codeview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  codeview_q.js!ntouch !@.ok."
+  .out/JSTest/codeview_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/consoleview_q.ok : consoleview_q.js .out/JSScan/consoleview_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[consoleview_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  consoleview_q.js!ntouch !@.ok.' > .out/JSTest/consoleview_q.js.vv
+	NODE_PATH='.:../jsu'  node  consoleview_q.js
+	touch .out/JSTest/consoleview_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/consoleview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  consoleview_q.js!ntouch !@.ok."
+  .out/JSTest/consoleview_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/highlight_q.ok : highlight_q.js .out/JSScan/highlight_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[highlight_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  highlight_q.js!ntouch !@.ok.' > .out/JSTest/highlight_q.js.vv
+	NODE_PATH='.:../jsu'  node  highlight_q.js
+	touch .out/JSTest/highlight_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/highlight_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  highlight_q.js!ntouch !@.ok."
+  .out/JSTest/highlight_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/localsview_q.ok : localsview_q.js .out/JSScan/localsview_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[localsview_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  localsview_q.js!ntouch !@.ok.' > .out/JSTest/localsview_q.js.vv
+	NODE_PATH='.:../jsu'  node  localsview_q.js
+	touch .out/JSTest/localsview_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/localsview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  localsview_q.js!ntouch !@.ok."
+  .out/JSTest/localsview_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/mdbvalue_q.ok : mdbvalue_q.js .out/JSScan/mdbvalue_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[mdbvalue_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  mdbvalue_q.js!ntouch !@.ok.' > .out/JSTest/mdbvalue_q.js.vv
+	NODE_PATH='.:../jsu'  node  mdbvalue_q.js
+	touch .out/JSTest/mdbvalue_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/mdbvalue_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  mdbvalue_q.js!ntouch !@.ok."
+  .out/JSTest/mdbvalue_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/mdbview_q.ok : mdbview_q.js .out/JSScan/mdbview_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[mdbview_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  mdbview_q.js!ntouch !@.ok.' > .out/JSTest/mdbview_q.js.vv
+	NODE_PATH='.:../jsu'  node  mdbview_q.js
+	touch .out/JSTest/mdbview_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/mdbview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  mdbview_q.js!ntouch !@.ok."
+  .out/JSTest/mdbview_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSTest/stackview_q.ok : stackview_q.js .out/JSScan/stackview_q.d | 
+	$(call _traceRecord,B,$@ 'JSTest$[stackview_q.js$]')
+	@mkdir -p .out/JSTest/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  node  stackview_q.js!ntouch !@.ok.' > .out/JSTest/stackview_q.js.vv
+	NODE_PATH='.:../jsu'  node  stackview_q.js
+	touch .out/JSTest/stackview_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/JSTest/stackview_q.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  node  stackview_q.js!ntouch !@.ok."
+  .out/JSTest/stackview_q.ok: .out/FORCE
+endif
+
+ 
+.out/JSToHTML/mdbapp.html : mdbapp.js ../build-js/.out/exports/jsdep | 
+	$(call _traceRecord,B,$@ 'JSToHTML$[mdbapp.js$]')
+	@mkdir -p .out/JSToHTML/
+	@echo '_vv=.NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep --html -o !@.html -MF !@.js.d --scan-cache=.out/ScanCache mdbapp.js.' > .out/JSToHTML/mdbapp.js.vv
+	NODE_PATH='.:../jsu'  ../build-js/.out/exports/jsdep --html -o .out/JSToHTML/mdbapp.html -MF .out/JSToHTML/mdbapp.js.d --scan-cache=.out/ScanCache mdbapp.js
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/JSToHTML/mdbapp.js.d
+_vv =
+-include .out/JSToHTML/mdbapp.js.vv
+ifneq "$(_vv)" ".NODE_PATH=`.:../jsu`  ../build-js/.out/exports/jsdep --html -o !@.html -MF !@.js.d --scan-cache=.out/ScanCache mdbapp.js."
+  .out/JSToHTML/mdbapp.html: .out/FORCE
+endif
+
+ 
+.out/LuaBundle/mdbagent.lua : mdbagent.lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaBundle$[mdbagent.lua$]')
+	@mkdir -p .out/LuaBundle/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua -o !@.lua --luaout --minify   -MF !@.lua.d  -MP -Werror  -- mdbagent.lua.' > .out/LuaBundle/mdbagent.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua -o .out/LuaBundle/mdbagent.lua --luaout --minify   -MF .out/LuaBundle/mdbagent.lua.d  -MP -Werror  -- mdbagent.lua
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/LuaBundle/mdbagent.lua.d
+_vv =
+-include .out/LuaBundle/mdbagent.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua -o !@.lua --luaout --minify   -MF !@.lua.d  -MP -Werror  -- mdbagent.lua."
+  .out/LuaBundle/mdbagent.lua: .out/FORCE
+endif
+
+ 
+.out/LuaCC_LuaToC/mdb.o : .out/LuaToC/mdb.c  | 
+	$(call _traceRecord,B,$@ 'LuaCC$[LuaToC$[mdb.lua$]$]')
+	@mkdir -p .out/LuaCC_LuaToC/
+	@echo '_vv=.gcc -c -o !@.o .out/LuaToC/mdb.c -O2 -Werror -Wall -Wextra -pedantic -Wshadow -Wcast-qual -Wcast-align -Wno-unused-parameter -Wstrict-prototypes -Wmissing-prototypes -Wold-style-definition -Wnested-externs -Wbad-function-cast -Winit-self -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -Wno-overlength-strings  -I../lua/.out/exports/src -MMD -MP -MF !@.c.d.' > .out/LuaCC_LuaToC/mdb.c.vv
+	gcc -c -o .out/LuaCC_LuaToC/mdb.o .out/LuaToC/mdb.c -O2 -Werror -Wall -Wextra -pedantic -Wshadow -Wcast-qual -Wcast-align -Wno-unused-parameter -Wstrict-prototypes -Wmissing-prototypes -Wold-style-definition -Wnested-externs -Wbad-function-cast -Winit-self -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -Wno-overlength-strings  -I../lua/.out/exports/src -MMD -MP -MF .out/LuaCC_LuaToC/mdb.c.d
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/LuaCC_LuaToC/mdb.c.d
+_vv =
+-include .out/LuaCC_LuaToC/mdb.c.vv
+ifneq "$(_vv)" ".gcc -c -o !@.o .out/LuaToC/mdb.c -O2 -Werror -Wall -Wextra -pedantic -Wshadow -Wcast-qual -Wcast-align -Wno-unused-parameter -Wstrict-prototypes -Wmissing-prototypes -Wold-style-definition -Wnested-externs -Wbad-function-cast -Winit-self -std=c99 -fno-strict-aliasing -fPIC -fstack-protector -Wno-overlength-strings  -I../lua/.out/exports/src -MMD -MP -MF !@.c.d."
+  .out/LuaCC_LuaToC/mdb.o: .out/FORCE
+endif
+
+ 
+.out/LuaExe/mdb : .out/LuaCC_LuaToC/mdb.o ../lua/.out/exports/lib/liblua.lib ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaExe$[mdb.lua$]')
+	@mkdir -p .out/LuaExe/
+	@echo '_vv=.gcc -o !@ .out/LuaCC_LuaToC/mdb.o ../lua/.out/exports/lib/liblua.lib -lm -ldl -Wl,--export-dynamic  !S( ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua --readlibs -MF !@.lua.d  -MT !@ -MP .out/LuaToC/mdb.c ).' > .out/LuaExe/mdb.lua.vv
+	gcc -o .out/LuaExe/mdb .out/LuaCC_LuaToC/mdb.o ../lua/.out/exports/lib/liblua.lib -lm -ldl -Wl,--export-dynamic  $$( ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua --readlibs -MF .out/LuaExe/mdb.lua.d  -MT .out/LuaExe/mdb -MP .out/LuaToC/mdb.c )
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/LuaExe/mdb.lua.d
+_vv =
+-include .out/LuaExe/mdb.lua.vv
+ifneq "$(_vv)" ".gcc -o !@ .out/LuaCC_LuaToC/mdb.o ../lua/.out/exports/lib/liblua.lib -lm -ldl -Wl,--export-dynamic  !S( ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua --readlibs -MF !@.lua.d  -MT !@ -MP .out/LuaToC/mdb.c )."
+  .out/LuaExe/mdb: .out/FORCE
+endif
+
+ 
+.out/LuaScan/after_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[after_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua after_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/after_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/after_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua after_q.lua -MF .out/LuaScan/after_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/after_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/after_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua after_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/after_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/after_q.d: .out/FORCE
+endif
+-include .out/LuaScan/after_q.d
+
+ 
+.out/LuaScan/agentlib_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[agentlib_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua agentlib_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/agentlib_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/agentlib_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua agentlib_q.lua -MF .out/LuaScan/agentlib_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/agentlib_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/agentlib_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua agentlib_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/agentlib_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/agentlib_q.d: .out/FORCE
+endif
+-include .out/LuaScan/agentlib_q.d
+
+ 
+.out/LuaScan/logsocket_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[logsocket_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua logsocket_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/logsocket_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/logsocket_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua logsocket_q.lua -MF .out/LuaScan/logsocket_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/logsocket_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/logsocket_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua logsocket_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/logsocket_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/logsocket_q.d: .out/FORCE
+endif
+-include .out/LuaScan/logsocket_q.d
+
+ 
+.out/LuaScan/mdbagent_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[mdbagent_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbagent_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbagent_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/mdbagent_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbagent_q.lua -MF .out/LuaScan/mdbagent_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbagent_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/mdbagent_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbagent_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbagent_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/mdbagent_q.d: .out/FORCE
+endif
+-include .out/LuaScan/mdbagent_q.d
+
+ 
+.out/LuaScan/mdbser_c_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[mdbser_c_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbser_c_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbser_c_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/mdbser_c_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbser_c_q.lua -MF .out/LuaScan/mdbser_c_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbser_c_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/mdbser_c_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbser_c_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbser_c_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/mdbser_c_q.d: .out/FORCE
+endif
+-include .out/LuaScan/mdbser_c_q.d
+
+ 
+.out/LuaScan/mdbser_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[mdbser_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbser_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbser_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/mdbser_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbser_q.lua -MF .out/LuaScan/mdbser_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbser_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/mdbser_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua mdbser_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/mdbser_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/mdbser_q.d: .out/FORCE
+endif
+-include .out/LuaScan/mdbser_q.d
+
+ 
+.out/LuaScan/observable_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[observable_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua observable_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/observable_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/observable_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua observable_q.lua -MF .out/LuaScan/observable_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/observable_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/observable_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua observable_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/observable_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/observable_q.d: .out/FORCE
+endif
+-include .out/LuaScan/observable_q.d
+
+ 
+.out/LuaScan/owebserve_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[owebserve_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua owebserve_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/owebserve_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/owebserve_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua owebserve_q.lua -MF .out/LuaScan/owebserve_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/owebserve_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/owebserve_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua owebserve_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/owebserve_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/owebserve_q.d: .out/FORCE
+endif
+-include .out/LuaScan/owebserve_q.d
+
+ 
+.out/LuaScan/target_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[target_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  LUA=`../lua/.out/exports/bin/lua`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua target_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/target_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/target_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  LUA='../lua/.out/exports/bin/lua'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua target_q.lua -MF .out/LuaScan/target_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/target_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/target_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  LUA=`../lua/.out/exports/bin/lua`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua target_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/target_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/target_q.d: .out/FORCE
+endif
+-include .out/LuaScan/target_q.d
+
+ 
+.out/LuaScan/valuemap_q.d :  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua | 
+	$(call _traceRecord,B,$@ 'LuaScan$[valuemap_q.lua$]')
+	@mkdir -p .out/LuaScan/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua valuemap_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/valuemap_q.ok -MTF -MP --scan-cache=.out/ScanCache.' > .out/LuaScan/valuemap_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua valuemap_q.lua -MF .out/LuaScan/valuemap_q.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/valuemap_q.ok -MTF -MP --scan-cache=.out/ScanCache
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaScan/valuemap_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua valuemap_q.lua -MF !@.d -Moo .out/LuaTest/^B_q.ok -MT .out/LuaTest/valuemap_q.ok -MTF -MP --scan-cache=.out/ScanCache."
+  .out/LuaScan/valuemap_q.d: .out/FORCE
+endif
+-include .out/LuaScan/valuemap_q.d
+
+ 
+.out/LuaTest/after_q.ok : after_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/after_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[after_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  after_q.lua !ntouch !@.ok.' > .out/LuaTest/after_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  after_q.lua 
+	touch .out/LuaTest/after_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/after_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  after_q.lua !ntouch !@.ok."
+  .out/LuaTest/after_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/agentlib_q.ok : agentlib_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/agentlib_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[agentlib_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  agentlib_q.lua !ntouch !@.ok.' > .out/LuaTest/agentlib_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  agentlib_q.lua 
+	touch .out/LuaTest/agentlib_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/agentlib_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  agentlib_q.lua !ntouch !@.ok."
+  .out/LuaTest/agentlib_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/logsocket_q.ok : logsocket_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/logsocket_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[logsocket_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  logsocket_q.lua !ntouch !@.ok.' > .out/LuaTest/logsocket_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  logsocket_q.lua 
+	touch .out/LuaTest/logsocket_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/logsocket_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  logsocket_q.lua !ntouch !@.ok."
+  .out/LuaTest/logsocket_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/mdbagent_q.ok : mdbagent_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/mdbagent_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[mdbagent_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  mdbagent_q.lua !ntouch !@.ok.' > .out/LuaTest/mdbagent_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  mdbagent_q.lua 
+	touch .out/LuaTest/mdbagent_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/mdbagent_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  mdbagent_q.lua !ntouch !@.ok."
+  .out/LuaTest/mdbagent_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/mdbser_c_q.ok : mdbser_c_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/mdbser_c_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[mdbser_c_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  mdbser_c_q.lua !ntouch !@.ok.' > .out/LuaTest/mdbser_c_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  mdbser_c_q.lua 
+	touch .out/LuaTest/mdbser_c_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/mdbser_c_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  mdbser_c_q.lua !ntouch !@.ok."
+  .out/LuaTest/mdbser_c_q.ok: .out/FORCE
+endif
+
+
+.out/LuaTest/mdbser_q.ok : mdbser_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/mdbser_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[mdbser_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  mdbser_q.lua !ntouch !@.ok.' > .out/LuaTest/mdbser_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  mdbser_q.lua 
+	touch .out/LuaTest/mdbser_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/mdbser_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  mdbser_q.lua !ntouch !@.ok."
+  .out/LuaTest/mdbser_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/observable_q.ok : observable_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/observable_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[observable_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  observable_q.lua !ntouch !@.ok.' > .out/LuaTest/observable_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  observable_q.lua 
+	touch .out/LuaTest/observable_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/observable_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  observable_q.lua !ntouch !@.ok."
+  .out/LuaTest/observable_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/owebserve_q.ok : owebserve_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/owebserve_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[owebserve_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  owebserve_q.lua !ntouch !@.ok.' > .out/LuaTest/owebserve_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  owebserve_q.lua 
+	touch .out/LuaTest/owebserve_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/owebserve_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  owebserve_q.lua !ntouch !@.ok."
+  .out/LuaTest/owebserve_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/target_q.ok : target_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/target_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[target_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  LUA=`../lua/.out/exports/bin/lua`  ../lua/.out/exports/bin/lua  target_q.lua !ntouch !@.ok.' > .out/LuaTest/target_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  LUA='../lua/.out/exports/bin/lua'  ../lua/.out/exports/bin/lua  target_q.lua 
+	touch .out/LuaTest/target_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/target_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  LUA=`../lua/.out/exports/bin/lua`  ../lua/.out/exports/bin/lua  target_q.lua !ntouch !@.ok."
+  .out/LuaTest/target_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaTest/valuemap_q.ok : valuemap_q.lua ../lua/.out/exports/bin/lua .out/LuaScan/valuemap_q.d | 
+	$(call _traceRecord,B,$@ 'LuaTest$[valuemap_q.lua$]')
+	@mkdir -p .out/LuaTest/ 
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  valuemap_q.lua !ntouch !@.ok.' > .out/LuaTest/valuemap_q.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  ../lua/.out/exports/bin/lua  valuemap_q.lua 
+	touch .out/LuaTest/valuemap_q.ok
+	$(call _traceRecord,E,$@ $^ $|)
+
+_vv =
+-include .out/LuaTest/valuemap_q.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  ../lua/.out/exports/bin/lua  valuemap_q.lua !ntouch !@.ok."
+  .out/LuaTest/valuemap_q.ok: .out/FORCE
+endif
+
+ 
+.out/LuaToC/mdb.c : mdb.lua ../build-lua/cfromlua.lua .out/GZip_JSToHTML/mdbapp.html.gz | 
+	$(call _traceRecord,B,$@ 'LuaToC$[mdb.lua$]')
+	@mkdir -p .out/LuaToC/
+	@echo '_vv=.LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  REQUIREFILE_PATH=`.out/GZip_JSToHTML/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua -o !@.c --minify   -MF !@.lua.d  -MP -Werror  -- mdb.lua.' > .out/LuaToC/mdb.lua.vv
+	LUA_PATH='./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua'  LUA_CPATH='./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so'  OUTDIR='.out/'  REQUIREFILE_PATH='.out/GZip_JSToHTML/'  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua -o .out/LuaToC/mdb.c --minify   -MF .out/LuaToC/mdb.lua.d  -MP -Werror  -- mdb.lua
+	$(call _traceRecord,E,$@ $^ $|)
+
+-include .out/LuaToC/mdb.lua.d
+_vv =
+-include .out/LuaToC/mdb.lua.vv
+ifneq "$(_vv)" ".LUA_PATH=`./?.lua;../luau/.out/exports/?.lua;../monoglot/.out/exports/?.lua;../lpeg/.out/exports/?.lua`  LUA_CPATH=`./?.so;../luau/.out/exports/?.so;../monoglot/.out/exports/?.so;../lpeg/.out/exports/?.so`  OUTDIR=`.out/`  REQUIREFILE_PATH=`.out/GZip_JSToHTML/`  ../lua/.out/exports/bin/lua ../build-lua/cfromlua.lua -o !@.c --minify   -MF !@.lua.d  -MP -Werror  -- mdb.lua."
+  .out/LuaToC/mdb.c: .out/FORCE
+endif
+
+ 
+.PHONY: .out/Ship/exports
+.out/Ship/exports : .out/exports/mdb .out/exports/mdbagent.lua .out/exports/mdb.txt  | 
+	$(call _traceRecord,B,$@ 'Ship$[exports$]')
+	@true
+	$(call _traceRecord,E,$@ $^ $|)
+
+
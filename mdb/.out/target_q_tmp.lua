@@ -0,0 +1,10 @@
+local function f(n)
+   if n < 5 then
+      n = n + 1
+      debug.pause()
+      return f(n)
+   end
+   return n
+end
+
+f(0)
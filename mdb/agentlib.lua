@@ -134,10 +134,20 @@ local function newWeakKeys()
 end
 
 
-local sock, send, recv, peek
+-- Messages are newline-terminated lines.  While a batch is open (see
+-- `batch`), `send` queues messages, and they are written together, in one
+-- write, before we wait for a command.
+
+-- Largest amount of data to queue before writing
+local MAXBATCH = 65536
+
+local sock, send, recv, peek, batch
 do
    sock = assert(xpio.fdopen(mdbFD))
    local recvBuf = ""
+   local recvPos = 1
+   local sendQ, sendSize = {}, 0
+   local batching = false
 
    sock:setsockopt("O_NONBLOCK", true)
 
@@ -148,20 +158,35 @@ do
       return a, b
    end
 
+   local function append(data)
+      recvBuf = string.sub(recvBuf, recvPos) .. data
+      recvPos = 1
+   end
+
+   local function flush()
+      if sendQ[1] then
+         sendQ[#sendQ+1] = ""
+         blockOn("try_write", table.concat(sendQ, "\n"))
+         sendQ, sendSize = {}, 0
+      end
+   end
+
    function peek()
-      local data, err = sock:try_read(200)
+      local data, err = sock:try_read(4096)
       if data then
-         recvBuf = recvBuf .. data
+         append(data)
          return true
       end
    end
 
    -- returns: msgID payload
    function recv(blocking)
+      flush()
       while true do
-         local line, rest = match(recvBuf,"(.-)\n(.*)")
-         if line then
-            recvBuf = rest
+         local a, b = string.find(recvBuf, "\n", recvPos, true)
+         if a then
+            local line = string.sub(recvBuf, recvPos, a - 1)
+            recvPos = b + 1
             farf("p", "C: %s", line)
             return match(line, "^([^ ]*) ?(.*)")
          end
@@ -169,12 +194,12 @@ do
          if peek() then
             -- have more data
          elseif blocking then
-            local data, er = blockOn("try_read", 1000)
+            local data, er = blockOn("try_read", 4096)
             if not data then
                io.stderr:write("mdb: control port closed; exiting\n")
                os.exit(1)
             end
-            recvBuf = recvBuf .. data
+            append(data)
          else
             return -- not blocking
          end
@@ -184,7 +209,19 @@ do
    function send(mtyp, ...)
       local msg = mtyp .. " " .. mdbser.encode(...)
       farf("p", "S: %s", msg)
-      blockOn("try_write", msg .. "\n")
+      sendQ[#sendQ+1] = msg
+      sendSize = sendSize + #msg
+      if not batching or sendSize >= MAXBATCH then
+         flush()
+      end
+   end
+
+   -- Call fn(...), batching all messages it sends.
+   function batch(fn, ...)
+      batching = true
+      fn(...)
+      batching = false
+      flush()
    end
 
 end
@@ -786,10 +823,10 @@ local function installHook(thread)
 
       hookRunLimit = nil
 
-      xpcall(hookIdle, function (msg)
+      xpcall(batch, function (msg)
                 print(debug.traceback(msg .. " [MDB internal]"))
                 os.exit(1)
-             end)
+             end, hookIdle)
 
       if hookRunLimit then
          -- a `run` command was processed
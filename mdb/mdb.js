@@ -36,7 +36,7 @@ var O = require('observable.js');
 
 var mdb = {};
 
-var oweb = OWeb.create(xhttp, scheduler, "/observe");
+var oweb = OWeb.create(xhttp, scheduler, "/observe", {stream: true});
 
 
 //----------------------------------------------------------------
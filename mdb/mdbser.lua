@@ -4,6 +4,16 @@
 -- * Circular data structures are not supported.
 -- * The encoded form of a value contains no spaces or newline characters.
 --
+-- When the native codec (mdbser_c) is available, `encode` and `decode` are
+-- implemented in C.  The agent side may run in any Lua interpreter, so the
+-- Lua implementation remains the reference.
+--
+
+local rtrequire = require
+local succ, mdbser_c = pcall(rtrequire, "mdbser_c")
+if not succ then
+   mdbser_c = nil
+end
 
 local byte, char = string.byte, string.char
 local insert, concat = table.insert, table.concat
@@ -113,6 +123,10 @@ end
 
 
 return {
-   encode = encode,
-   decode = decode
+   encode = mdbser_c and mdbser_c.encode or encode,
+   decode = mdbser_c and mdbser_c.decode or decode,
+   isNative = mdbser_c and true or false,
+   -- for testing
+   _luaEncode = encode,
+   _luaDecode = decode,
 }
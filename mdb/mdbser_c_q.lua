@@ -0,0 +1,111 @@
+-- Compare the native mdbser codec (luau/mdbser_c.c) with the Lua
+-- implementation in mdbser.lua.
+
+local qt = require "qtest"
+local mdbser = require "mdbser"
+local mdbser_c = require "mdbser_c"
+
+local eq = qt.eq
+local luaEncode, luaDecode = mdbser._luaEncode, mdbser._luaDecode
+local cEncode, cDecode = mdbser_c.encode, mdbser_c.decode
+
+eq(true, mdbser.isNative)
+eq(cEncode, mdbser.encode)
+
+
+local function pack(...)
+   return { n = select('#', ...), ... }
+end
+
+
+-- Assert: same encoding, and both decoders reproduce the same values.
+--
+local function check(...)
+   local e = luaEncode(...)
+   eq(e, cEncode(...))
+   eq(pack(luaDecode(e)), pack(cDecode(e)))
+   return e
+end
+
+
+-- simple values
+
+check()
+check(nil)
+check(true, false)
+check(0, -1, 1.5, 1e300, -123.456, 2^53, 1/3)
+check(1/0, -1/0)
+check("", "a b", "\r\n", "\128\191\255")
+check(print, nil, coroutine.create(print))
+
+local all = {}
+for n = 0, 255 do
+   all[#all+1] = string.char(n)
+end
+all = table.concat(all)
+check(all)
+check({all, {all, {all, {all}}}})
+
+
+-- tables, including nested tables and table keys
+
+check({1, 2, 3})
+check({a=true, b=false, [5]={"a b", "c d"}})
+check({[{1}]={2}, x={y={z={"\n"}}}})
+check({{}, {{}}, {{{}}}})
+
+
+-- pseudo-random strings and tables
+
+local seed = 1
+local function rand(n)
+   seed = (seed * 1103515245 + 12345) % 2147483648
+   return seed % n
+end
+
+local function randString()
+   local o = {}
+   for ii = 1, rand(12) do
+      o[ii] = string.char(rand(256))
+   end
+   return table.concat(o)
+end
+
+local function randValue(depth)
+   local r = rand(depth > 0 and 6 or 4)
+   if r == 0 then
+      return rand(2) == 0
+   elseif r == 1 then
+      return rand(100000) / 8 - 1000
+   elseif r <= 3 then
+      return randString()
+   end
+   local t = {}
+   for ii = 1, rand(5) do
+      t[randString()] = randValue(depth - 1)
+   end
+   for ii = 1, rand(4) do
+      t[ii] = randValue(depth - 1)
+   end
+   return t
+end
+
+for ii = 1, 300 do
+   check(randValue(4), randValue(2))
+end
+
+
+-- decoding from an offset
+
+local e = check(1, "two", {3})
+eq(pack(luaDecode(e, 3)), pack(cDecode(e, 3)))
+eq(pack(luaDecode(e, #e + 5)), pack(cDecode(e, #e + 5)))
+eq(pack(luaDecode("  t  f ")), pack(cDecode("  t  f ")))
+
+
+-- malformed words decode the same way
+
+for _, word in ipairs{ "q", "tt", "nx", "ninf", "n0x10", "m", "m ", "m t",
+                       "s\128", "s\129", "s\129`" } do
+   eq(pack(luaDecode(word)), pack(cDecode(word)))
+end
@@ -0,0 +1,144 @@
+-- mdbserperf: measure MDB protocol costs for large-table inspection
+--
+-- Usage:  lua mdbserperf.lua [ENTRIES [MESSAGES]]
+--
+-- A "pairs" listing of a table with ENTRIES entries is encoded and decoded
+-- with the Lua and native mdbser codecs.  Then MESSAGES messages (each a
+-- listing of 50 entries) are sent over a socket pair, one write per message
+-- and read line-by-line (as before batching), and then batched as in
+-- agentlib.lua and target.lua.
+
+local mdbser = require "mdbser"
+local thread = require "thread"
+local xpio = require "xpio"
+local BufIO = require "bufio"
+
+local clock = os.clock
+
+local numEntries = tonumber(arg[1]) or 20000
+local numMessages = tonumber(arg[2]) or 2000
+
+
+-- Construct a value like the agent's description of a table's contents.
+--
+local function makeListing(n)
+   local t = {}
+   for ii = 1, n do
+      t[ii] = { ("%q"):format("key " .. ii), "{table 0x" .. ii .. "}",
+                ii % 3 == 0 }
+   end
+   return t
+end
+
+
+local function time(name, count, fn)
+   collectgarbage()
+   local t0 = clock()
+   for ii = 1, count do
+      fn()
+   end
+   local t = clock() - t0
+   print(("%-18s %8.3f s   %9.1f ops/s"):format(name, t, count / t))
+end
+
+
+local function codecs()
+   local value = makeListing(numEntries)
+   local lenc, ldec = mdbser._luaEncode, mdbser._luaDecode
+   local str = lenc("pairs/1", value)
+   print(("Listing: %d entries, %.1f KB encoded"):format(numEntries, #str / 1e3))
+
+   time("encode (Lua)", 5, function () lenc("pairs/1", value) end)
+   time("decode (Lua)", 5, function () ldec(str) end)
+   if not mdbser.isNative then
+      print("Native codec (mdbser_c) not found.")
+      return
+   end
+   assert(mdbser.encode("pairs/1", value) == str)
+   time("encode (native)", 5, function () mdbser.encode("pairs/1", value) end)
+   time("decode (native)", 5, function () mdbser.decode(str) end)
+end
+
+
+-- Send `msgs` over a socket pair, and read them on the other end, returning
+-- the elapsed time.
+--
+local function transfer(msgs, batched)
+   local a, b = xpio.socketpair()
+   local count = 0
+
+   local reader = thread.new(function ()
+      if batched then
+         local partial = ""
+         while true do
+            local data = b:read(65536)
+            if not data then break end
+            data = partial .. data
+            local pos = 1
+            while true do
+               local nl = data:find("\n", pos, true)
+               if not nl then break end
+               mdbser.decode(data:sub(pos, nl - 1))
+               count = count + 1
+               pos = nl + 1
+            end
+            partial = data:sub(pos)
+         end
+      else
+         local bf = BufIO:new(b)
+         while true do
+            local line = bf:read()
+            if not line then break end
+            mdbser.decode(line)
+            count = count + 1
+         end
+      end
+   end)
+
+   local t0 = xpio.gettime()
+   if batched then
+      -- write up to 64KB at once, as agentlib does
+      local q, size = {}, 0
+      for _, msg in ipairs(msgs) do
+         q[#q+1] = msg
+         size = size + #msg
+         if size >= 65536 then
+            q[#q+1] = ""
+            a:write(table.concat(q, "\n"))
+            q, size = {}, 0
+         end
+      end
+      q[#q+1] = ""
+      a:write(table.concat(q, "\n"))
+   else
+      for _, msg in ipairs(msgs) do
+         a:write(msg .. "\n")
+      end
+   end
+   a:close()
+   thread.join(reader)
+   assert(count == #msgs)
+   b:close()
+   return xpio.gettime() - t0
+end
+
+
+local function framing()
+   local msgs = {}
+   local listing = makeListing(50)
+   for ii = 1, numMessages do
+      msgs[ii] = "set " .. mdbser.encode("pairs/" .. ii, listing)
+   end
+
+   for _, batched in ipairs{false, true} do
+      local t = transfer(msgs, batched)
+      print(("%-18s %8.3f s   %9.1f msgs/s"):format(
+               batched and "batched" or "line per message", t, numMessages / t))
+   end
+end
+
+
+thread.dispatch(function ()
+   codecs()
+   framing()
+end)
@@ -0,0 +1,81 @@
+-- owebperf: measure OWeb poll fan-out: N ports watching M observables
+--
+-- Usage:  lua owebperf.lua [PORTS [OBSERVABLES [ROUNDS]]]
+--
+-- Each round changes every observable and then completes one poll for
+-- each port.  Results are reported for responses encoded per port
+-- (json.encode of each response) and for encode-once responses
+-- (PortGroup:handleRequestJSON).
+
+local observable = require "observable"
+local owebserve = require "owebserve"
+local thread = require "thread"
+local json = require "json"
+
+local clock = os.clock
+
+local numPorts = tonumber(arg[1]) or 500
+local numObs = tonumber(arg[2]) or 20
+local numRounds = tonumber(arg[3]) or 4
+
+
+-- Construct a value similar to an MDB stack or variable listing
+local function makeValue(round, n)
+   local t = {}
+   for ii = 1, 20 do
+      t[ii] = { name = "var" .. ii, value = ("%d:%d:%d"):format(round, n, ii),
+                kind = "string", expandable = false }
+   end
+   return { len = #t, a = t }
+end
+
+
+local function run(name, handle)
+   local obs, names = {}, {}
+   for n = 1, numObs do
+      names[n] = "ob" .. n
+      obs[names[n]] = observable.Slot:new(makeValue(0, n))
+   end
+
+   local grp = owebserve.PortGroup:new(obs)
+   local ids = {}
+   for p = 1, numPorts do
+      ids[p] = json.decode(handle(grp, {add = names})).id
+   end
+
+   collectgarbage()
+   local bytes = 0
+   local t0 = clock()
+   for round = 1, numRounds do
+      for n = 1, numObs do
+         obs[names[n]]:set(makeValue(round, n))
+      end
+      for p = 1, numPorts do
+         local resp = handle(grp, {id = ids[p]})
+         bytes = bytes + #resp
+         -- the successor ID is the first number in the response
+         ids[p] = tonumber(resp:match('"id":(%d+)'))
+      end
+   end
+   local t = clock() - t0
+
+   local polls = numPorts * numRounds
+   print(("%-12s %8.3f s   %8.0f polls/s   %6.1f MB/s")
+            :format(name, t, polls / t, bytes / t / 1e6))
+end
+
+
+local function main()
+   print(("%d ports, %d observables, %d rounds"):format(numPorts, numObs, numRounds))
+
+   run("per-port", function (grp, req)
+      return json.encode(grp:handleRequest(req))
+   end)
+
+   run("encode-once", function (grp, req)
+      return grp:handleRequestJSON(req)
+   end)
+end
+
+
+thread.dispatch(main)
@@ -12,6 +12,10 @@
 --
 -- `Port` objects implement the POLL transaction handler.  See oweb.txt.
 --
+-- When a request asks for a stream (`stream: true`), the response remains
+-- open and delivers a sequence of newline-terminated frames, one for each
+-- change, as described in oweb.txt.
+--
 
 
 local Event = require "event"
@@ -36,10 +40,51 @@ local ERROR_INTERNAL = 500
 local NOT_FOUND = { error = "unk" }
 
 
+----------------------------------------------------------------
+-- Version records
+--
+-- Each observed value is described by an immutable record:
+--
+--    { value = <value>, version = <number>, json = <encoded value> }
+--
+-- The PortGroup holds the current record for each name that some port
+-- observes.  It subscribes to each such observable, and when one is
+-- invalidated it marks the record stale.  The next poll reads the value
+-- and creates a new record, with the next version number, unless the
+-- value is an equal non-table value.  (A table may have been modified in
+-- place, so it always gets a new version.)  Version numbers are unique
+-- within the group.  Ports compare version numbers to detect changes, and
+-- responses share the JSON encoding of each record, so a value is read
+-- and encoded at most once per change, no matter how many ports report
+-- it.  Records are discarded when no port observes their names.
+----------------------------------------------------------------
+
+-- Record for names that are not found in the set of observables.
+local NOT_FOUND_RECORD = { value = NOT_FOUND, version = -1 }
+
+-- Record for names that have been added but not yet reported.
+local ADDED = { version = 0 }
+
+
+local function encodeRecord(rec)
+   local js = rec.json
+   if not js then
+      js = json.encode(rec.value)
+      rec.json = js
+   end
+   return js
+end
+
+
 local jsonHeaders = {
    contentType = "application/json"
 }
 
+local streamHeaders = {
+   contentType = "application/x-oweb-stream",
+   cacheControl = "no-cache"
+}
+
 local function readAll(s)
    local o = {}
    while true do
@@ -77,7 +122,7 @@ function Port:initialize(group)
 
    -- respXXX = most recent response
    --   ID = repsonse ID
-   --   Values = name->value for every subscribed name, as of that response
+   --   Values = name->record for every subscribed name, as of that response
    self.respID = nil
    self.respValues = {}
 
@@ -89,12 +134,15 @@ function Port:initialize(group)
    self.subscribed = {}
    self.event = Event:new()
    self.isWaiting = false
+
+   -- incremented on each transaction; see PortGroup:stream()
+   self.generation = 0
 end
 
 
 function Port:discard()
    for name, ob in pairs(self.subscribed) do
-      ob:unsubscribe(self)
+      self.group:unwatch(name, ob, self)
    end
    self.subscribed = {}
 
@@ -119,7 +167,7 @@ function Port:observe(name)
          ob = self.group.observables[name]
          if ob then
             self.subscribed[name] = ob
-            ob:subscribe(self)
+            self.group:watch(name, ob, self)
          end
       end
    end
@@ -127,11 +175,9 @@ function Port:observe(name)
 end
 
 
--- Unique value (unequal to all observed values)
-local ADDED = {}
-
-
 function Port:poll(req)
+   self.generation = self.generation + 1
+
    if req.id == self.respID then
       -- acknowledge previous transaction
       self.group:discardID(self.ackID)
@@ -149,7 +195,7 @@ function Port:poll(req)
 
    -- Construct values[]:
    --   Names = set observed by this transaction
-   --   Values = values as of previous transaction
+   --   Values = records as of previous transaction
 
    local adds = type(req.add) == "table" and req.add or {}
    local removes = type(req.remove) == "table" and req.remove or {}
@@ -167,7 +213,7 @@ function Port:poll(req)
    -- unsubscribe from observables that are not in this set or the acked set
    for name, ob in pairs(self.subscribed) do
       if values[name] == nil and self.ackValues[name] == nil then
-         ob:unsubscribe(self)
+         self.group:unwatch(name, ob, self)
          self.subscribed[name] = nil
       end
    end
@@ -179,23 +225,16 @@ function Port:poll(req)
    end
 
 
-   -- name->value for each value that differs from ackValues[]
+   -- name->record for each value that differs from ackValues[]
    local changed = {}
 
    while true do
 
-      -- check values
-      for name, oldValue in pairs(values) do
-         local value = NOT_FOUND
-         local ob = self:observe(name)
-         if ob then
-            value = ob:get()
-            if value == nil then
-               value = json.null
-            end
-         end
-         if value ~= oldValue then
-            changed[name] = value
+      -- check versions
+      for name, oldRec in pairs(values) do
+         local rec = self.group:getRecord(name, self:observe(name))
+         if rec.version ~= oldRec.version then
+            changed[name] = rec
          end
       end
 
@@ -211,8 +250,8 @@ function Port:poll(req)
    end
 
    -- Update values[] to reflect values as of response time
-   for name, value in pairs(changed) do
-      values[name] = value
+   for name, rec in pairs(changed) do
+      values[name] = rec
    end
 
    self.respID = self.group:getID(self)
@@ -228,6 +267,11 @@ end
 
 local PortGroup = Object:new()
 
+-- A stream ends after this many bytes have been written, so that the
+-- client's buffered response text does not grow without bound.  The
+-- client resumes with a successor request.
+PortGroup.streamLimit = 256 * 1024
+
 
 function PortGroup:initialize(observables, lingerTime)
    self.observables = observables
@@ -236,10 +280,84 @@ function PortGroup:initialize(observables, lingerTime)
    self.linger = lingerTime or 60
 
    self.expireQueue = Queue:new()
+
+   -- name -> current version record, for observed names
+   self.records = {}
+   self.stale = {}        -- name -> true when the record may be out of date
+   self.watchers = {}     -- name -> subscriber that marks the record stale
+   self.version = 0       -- most recently assigned version number
 end
 
 
-function PortGroup:handleRequest(req)
+-- Subscribe `port` to observable `ob`, known as `name`.
+--
+function PortGroup:watch(name, ob, port)
+   ob:subscribe(port)
+   local w = self.watchers[name]
+   if not w then
+      local stale = self.stale
+      w = { count = 0 }
+      function w.invalidate()
+         stale[name] = true
+      end
+      self.watchers[name] = w
+      ob:subscribe(w)
+   end
+   w.count = w.count + 1
+end
+
+
+-- Undo `watch`.  The record for `name` is discarded when no port observes
+-- it.
+--
+function PortGroup:unwatch(name, ob, port)
+   ob:unsubscribe(port)
+   local w = self.watchers[name]
+   w.count = w.count - 1
+   if w.count == 0 then
+      ob:unsubscribe(w)
+      self.watchers[name] = nil
+      self.records[name] = nil
+      self.stale[name] = nil
+   end
+end
+
+
+-- Return the current version record for `name`.  `ob` is the observable
+-- (or nil if the name is not recognized).
+--
+function PortGroup:getRecord(name, ob)
+   if not ob then
+      return NOT_FOUND_RECORD
+   end
+
+   local rec = self.records[name]
+   if rec and not self.stale[name] then
+      return rec
+   end
+
+   local value = ob:get()
+   if value == nil then
+      value = json.null
+   end
+
+   if not rec or type(value) == "table" or rec.value ~= value then
+      self.version = self.version + 1
+      rec = { value = value, version = self.version }
+   end
+   -- Records of names that no port observes would never be marked stale.
+   if self.watchers[name] then
+      self.records[name] = rec
+      self.stale[name] = nil
+   end
+   return rec
+end
+
+
+-- Process a request, returning an error code, or a response whose
+-- `values` field maps names to version records.
+--
+function PortGroup:transact(req)
    local id = req.id
    local port
    if id == nil then
@@ -271,6 +389,90 @@ function PortGroup:handleRequest(req)
 end
 
 
+-- Process a request, returning an error code or a response table:
+--   { id = <response ID>, values = <name -> value> }
+--
+function PortGroup:handleRequest(req)
+   local resp = self:transact(req)
+   if type(resp) == "number" then
+      return resp
+   end
+
+   local values = {}
+   for name, rec in pairs(resp.values) do
+      values[name] = rec.value
+   end
+   return { id = resp.id, values = values }
+end
+
+
+-- Encode a response returned by `transact`.
+--
+local function encodeResponse(resp)
+   local o = {}
+   for name, rec in pairs(resp.values) do
+      o[#o+1] = json.encode(name) .. ":" .. encodeRecord(rec)
+   end
+   return '{"id":' .. json.encode(resp.id) .. ',"values":{' ..
+      table.concat(o, ",") .. '}}'
+end
+
+
+-- Process a request, returning an error code or the JSON-encoded response
+-- (as described for `handleRequest`).  Encoded values are shared by all
+-- responses that report the same version.
+--
+function PortGroup:handleRequestJSON(req)
+   local resp = self:transact(req)
+   if type(resp) == "number" then
+      return resp
+   end
+   return encodeResponse(resp)
+end
+
+
+-- Process a streaming request, returning an error code or a function that
+-- writes a sequence of frames using `emit` (as in `WDConn:respond`).
+--
+-- The first frame is the response to `req`.  Each subsequent frame is the
+-- response to a successor transaction that acknowledges the previous
+-- frame, so it holds all values that changed since the previous frame.
+-- Changes that occur while a frame is being written are coalesced into the
+-- next one.  The stream ends when `emit` fails, when another transaction
+-- on the same port pre-empts it, or when `streamLimit` bytes have been
+-- written.
+--
+function PortGroup:stream(req)
+   local resp = self:transact(req)
+   if type(resp) == "number" then
+      return resp
+   end
+
+   local port = self.idToPort[resp.id]
+   local generation = port.generation
+
+   return function (emit)
+      local size = 0
+      while true do
+         local frame = encodeResponse(resp) .. "\n"
+         if not emit(frame) then
+            break
+         end
+         size = size + #frame
+         if port.generation ~= generation or size >= self.streamLimit then
+            -- pre-empted by another transaction, or long enough
+            break
+         end
+         resp = self:transact({id = resp.id})
+         if type(resp) == "number" then
+            break
+         end
+         generation = port.generation
+      end
+   end
+end
+
+
 -- Discard ports that have not been used in more than LINGER seconds.
 -- Return the number of seconds until the next expiration, or nil if
 -- there are no inactive ports.
@@ -322,11 +524,19 @@ local function serve(observables, lingerTime)
          return ERROR_PARSE
       end
 
-      local resp = group:handleRequest(req)
+      if req.stream then
+         local body = group:stream(req)
+         if type(body) == "number" then
+            return body
+         end
+         return 200, streamHeaders, body
+      end
+
+      local resp = group:handleRequestJSON(req)
       if type(resp) == "number" then
          return resp
       end
-      return 200, jsonHeaders, json.encode(resp)
+      return 200, jsonHeaders, resp
    end
 
    return poll
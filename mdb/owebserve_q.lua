@@ -162,6 +162,17 @@ end
 
 local PortGroup = owebserve.PortGroup
 
+
+-- Ports record versions of values; return name->value.
+--
+local function recordValues(records)
+   local values = {}
+   for name, rec in pairs(records) do
+      values[name] = rec.value
+   end
+   return values
+end
+
 local omap = {
    foo = observable.Slot:new(9),
    bar = observable.Slot:new(8)
@@ -202,7 +213,7 @@ local function testPoll()
       respErr = grp:handleRequest({id = eid1, remove={"def"}})
       assert(respErr.id)
       eq(respErr.values, {})
-      eq(eport.respValues, { abc = {error="unk"} })
+      eq(recordValues(eport.respValues), { abc = {error="unk"} })
    end
 
    -- Assertion: successor response registers same Port with second reponse ID.
@@ -218,8 +229,8 @@ local function testPoll()
    eq(omap.foo:isSubscribed(), true)
    eq(omap.bar:isSubscribed(), true)
 
-   eq(port1.ackValues, {foo=9})
-   eq(port1.respValues, {bar=8})
+   eq(recordValues(port1.ackValues), {foo=9})
+   eq(recordValues(port1.respValues), {bar=8})
 
    -- Assertion: predecessor of predecessor is discarded (foo unsubscribed).
    -- Assertion: response is immediate when value of watched entity has
@@ -241,8 +252,8 @@ local function testPoll()
    eq(omap.foo:isSubscribed(), false)
    eq(omap.bar:isSubscribed(), true)
 
-   eq(port1.ackValues, {bar=8})
-   eq(port1.respValues, {bar=1})
+   eq(recordValues(port1.ackValues), {bar=8})
+   eq(recordValues(port1.respValues), {bar=1})
 
 
    -- Assertion: add AND remove of same entity => entity is ready
@@ -252,8 +263,8 @@ local function testPoll()
    eq(resp.values, { bar = 1 })
    eq(grp.idToPort[id2], nil)
 
-   eq(port1.ackValues, {bar=1})
-   eq(port1.respValues, {bar=1})
+   eq(recordValues(port1.ackValues), {bar=1})
+   eq(recordValues(port1.respValues), {bar=1})
 
 
    -- Assertion: different successor of ackID discards other successor
@@ -270,8 +281,8 @@ local function testPoll()
    eq(omap.foo:isSubscribed(), true)
    eq(omap.bar:isSubscribed(), true)
 
-   eq(port1.ackValues, {bar=1})
-   eq(port1.respValues, {foo=9})
+   eq(recordValues(port1.ackValues), {bar=1})
+   eq(recordValues(port1.respValues), {foo=9})
 
 
    -- Assertion: no additions => pause until an entity changes.
@@ -297,7 +308,7 @@ local function testPoll()
    eq(omap.foo:isSubscribed(), true)
    eq(omap.bar:isSubscribed(), false)
 
-   eq(port1.ackValues, {foo=9})
+   eq(recordValues(port1.ackValues), {foo=9})
 
 
    -- Assertion: pre-empted transaction returns error, while pre-empting
@@ -348,6 +359,98 @@ local function constStream(data)
 end
 
 
+-- Assertion: each version of a value is encoded once, and shared by all
+-- ports that report it.
+--
+local function testEncodeOnce()
+   local obs = {
+      foo = observable.Slot:new(1),
+      bar = observable.Slot:new("x"),
+   }
+   local grp = PortGroup:new(obs)
+   local json = require "json"
+
+   local function decode(resp)
+      eq("string", type(resp))
+      return json.decode(resp)
+   end
+
+   local r1 = decode(grp:handleRequestJSON({add = {"foo", "bar", "baz"}}))
+   local r2 = decode(grp:handleRequestJSON({add = {"foo"}}))
+   eq(r1.values, {foo=1, bar="x", baz={error="unk"}})
+   eq(r2.values, {foo=1})
+
+   local rec = grp.records.foo
+   eq(rec.json, "1")
+
+   -- change => new version, encoded once for both ports
+   obs.foo:set(2)
+   local encode = json.encode
+   local count = 0
+   json.encode = function (...)
+      count = count + 1
+      return encode(...)
+   end
+   r1 = decode(grp:handleRequestJSON({id = r1.id}))
+   r2 = decode(grp:handleRequestJSON({id = r2.id}))
+   json.encode = encode
+
+   eq(r1.values, {foo=2})
+   eq(r2.values, {foo=2})
+   eq(grp.records.foo.version > rec.version, true)
+   -- 1 encoding of `2`, plus 2 names and 2 IDs
+   eq(count, 5)
+
+   -- setting a value equal to the current one does not change the version
+   local barVersion = grp.records.bar.version
+   obs.bar:set("y")
+   obs.bar:set("x")
+   eq(grp:getRecord("bar", obs.bar).version, barVersion)
+
+   eq(grp:handleRequestJSON({id = 12345}), 410)
+end
+
+
+-- Assertion: values are read only after they change; a table always gets
+-- a new version; records are discarded when no port observes them.
+--
+local function testRecords()
+   local t = { n = 1 }
+   local obs = { t = observable.Slot:new(t) }
+   local gets = 0
+   local get = obs.t.get
+   function obs.t:get()
+      gets = gets + 1
+      return get(self)
+   end
+   local grp = PortGroup:new(obs)
+
+   local r1 = grp:handleRequest({add = {"t"}})
+   local r2 = grp:handleRequest({add = {"t"}})
+   eq(gets, 1)
+   local rec = grp.records.t
+
+   -- an unchanged value is not read again
+   eq(grp:getRecord("t", obs.t), rec)
+   eq(gets, 1)
+
+   -- a table modified in place gets a new version (and encoding)
+   t.n = 2
+   obs.t:invalidate()
+   r1 = grp:handleRequest({id = r1.id})
+   eq(r1.values, {t = {n = 2}})
+   eq(gets, 2)
+   eq(grp.records.t.version > rec.version, true)
+   eq(grp.records.t.json, nil)
+
+   -- the record is discarded when the last port stops observing it
+   grp.linger = 0
+   grp:expire()
+   eq(grp.records.t, nil)
+   eq(obs.t:isSubscribed(), false)
+end
+
+
 local function testServe()
    local poll = owebserve.serve(omap)
 
@@ -356,6 +459,90 @@ local function testServe()
    }
 
    eq(a, 200)
+   eq(type(c), "string")
+
+   -- streaming request => function body
+   local a, b, c = poll {
+      body = constStream '{"add":["A"],"stream":true}'
+   }
+   eq(a, 200)
+   eq(b.contentType, "application/x-oweb-stream")
+   eq(type(c), "function")
+
+   eq(poll { body = constStream '{"id":12345,"stream":true}' }, 410)
+end
+
+
+-- Assertion: a stream emits one frame per change, each acknowledging its
+-- predecessor, and ends when pre-empted or when `emit` fails.
+--
+local function testStream()
+   local json = require "json"
+   local obs = {
+      foo = observable.Slot:new(1),
+      bar = observable.Slot:new(2),
+   }
+   local grp = PortGroup:new(obs)
+
+   local frames = {}
+   local emitOK = true
+   local function emit(data)
+      eq(data:sub(-1), "\n")
+      frames[#frames+1] = json.decode(data)
+      return emitOK
+   end
+
+   local body = grp:stream({add = {"foo", "bar"}})
+   eq(type(body), "function")
+   local task = thread.new(body, emit)
+   thread.yield()
+
+   eq(frames[1].values, {foo=1, bar=2})
+   local port = grp.idToPort[frames[1].id]
+   eq(#frames, 1)
+
+   -- changes made together are coalesced into one frame
+   obs.foo:set(10)
+   obs.bar:set(20)
+   thread.yield()
+   thread.yield()
+   eq(#frames, 2)
+   eq(frames[2].values, {foo=10, bar=20})
+   -- the stream has acknowledged frame 2 and is waiting for a change
+   eq(port.ackID, frames[2].id)
+   eq(grp.idToPort[frames[1].id], nil)
+
+   obs.bar:set(21)
+   thread.yield()
+   thread.yield()
+   eq(#frames, 3)
+   eq(frames[3].values, {bar=21})
+
+   -- A successor request pre-empts the stream.
+   local resp = grp:handleRequest({id = frames[3].id, remove = {"bar"}})
+   eq(resp.values, {})
+   thread.join(task)
+   eq(#frames, 3)
+   eq(grp.idToPort[resp.id], port)
+
+   -- A stream ends when `emit` fails.
+   obs.foo:set(11)
+   body = grp:stream({id = resp.id})
+   emitOK = false
+   thread.join(thread.new(body, emit))
+   eq(#frames, 4)
+   eq(frames[4].values, {foo=11})
+
+   -- A stream ends after `streamLimit` bytes.  The client resumes from the
+   -- last frame.
+   emitOK = true
+   grp.streamLimit = 1
+   obs.foo:set(12)
+   body = grp:stream({id = frames[4].id})
+   thread.join(thread.new(body, emit))
+   eq(#frames, 5)
+   eq(frames[5].values, {foo=12})
+   eq(grp:handleRequest({id = frames[5].id, remove = {"foo"}}).values, {})
 end
 
 --------------------------------
@@ -366,7 +553,10 @@ local done = false
 
 local function main()
    testPoll()
+   testEncodeOnce()
+   testRecords()
    testServe()
+   testStream()
    done = true
 end
 
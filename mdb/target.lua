@@ -5,14 +5,17 @@
 local Object = require "object"
 local thread = require "thread"
 local xpio = require "xpio"
-local BufIO = require "bufio"
 local Event = require "event"
 local mdbser = require "mdbser"
+-- @require mdbser_c   (bundle the native codec used by mdbser)
 local futex = require "futex"
 local O = require "observable"
 
 local Target = Object:new()
 
+-- Amount of data to read from the control port at once
+local READSIZE = 65536
+
 
 -- On entry:
 --   `command` is an array of words describing the command to execute.
@@ -47,7 +50,7 @@ function Target:start()
    env.mdbFD = "3"
 
    self.proc = xpio.spawn(self.command, env, fds, {})
-   self.ctl = BufIO:new(ctl)
+   self.ctl = ctl
    self.reader = thread.new(self.readLoop, self, self.ctl)
    self.log:append("SStarting target process")
 
@@ -86,37 +89,76 @@ function Target:shutdown()
 end
 
 
+-- Read messages from the agent.  Each read may deliver many messages (see
+-- `batch` in agentlib.lua); all complete messages are handled before
+-- reading again.
+--
 function Target:readLoop(ctl)
+   local partial = {}   -- pieces of an incomplete message
    while true do
-      local msg = ctl:read() or "exit"
-
-      local id, body = msg:match("^([^ ]*) ?(.*)")
-      if id == "ack" then
-         self.pending = self.pending - 1
-         if self.pending == 0 then
-            self.busy:set(false)
+      local data = ctl:read(READSIZE)
+      if not data then
+         if partial[1] then
+            print("Target:readLoop: incomplete message at end of stream '"
+                  .. table.concat(partial):sub(1, 40) .. "'")
          end
-      elseif id == "exit" then
-         self:shutdown()
+         self:handleMessage("exit")
          return
-      elseif id == "log" then
-         self.log:append(mdbser.decode(body))
-      elseif (id == "pause" or
-              id == "run")  then
-         self.status:set(id)
-      elseif id == "set" then
-         local name, value = mdbser.decode(body)
-         local ob = self.ovalues[name]
-         if ob then
-            ob:set(value)
+      end
+
+      local pos = 1
+      while true do
+         local nl = data:find("\n", pos, true)
+         if not nl then
+            break
+         end
+         local msg = data:sub(pos, nl - 1)
+         if partial[1] then
+            partial[#partial+1] = msg
+            msg = table.concat(partial)
+            partial = {}
          end
-      else
-         print("Target:readLoop: unrecognized message '" .. id .. "'")
+         if self:handleMessage(msg) then
+            return
+         end
+         pos = nl + 1
+      end
+      if pos <= #data then
+         partial[#partial+1] = data:sub(pos)
       end
    end
 end
 
 
+-- Handle one message from the agent.  Return true after "exit".
+--
+function Target:handleMessage(msg)
+   local id, body = msg:match("^([^ ]*) ?(.*)")
+   if id == "ack" then
+      self.pending = self.pending - 1
+      if self.pending == 0 then
+         self.busy:set(false)
+      end
+   elseif id == "exit" then
+      self:shutdown()
+      return true
+   elseif id == "log" then
+      self.log:append(mdbser.decode(body))
+   elseif (id == "pause" or
+           id == "run")  then
+      self.status:set(id)
+   elseif id == "set" then
+      local name, value = mdbser.decode(body)
+      local ob = self.ovalues[name]
+      if ob then
+         ob:set(value)
+      end
+   else
+      print("Target:readLoop: unrecognized message '" .. id .. "'")
+   end
+end
+
+
 -- Send a message to the target process.
 --
 function Target:send(id, ...)
@@ -700,6 +700,29 @@ local function testPerf()
 end
 
 
+-- readLoop splits batched reads into messages, and reports a message
+-- truncated by the end of the stream.
+--
+local function testReadLoop()
+   local reads = { "set a 1\nlog x", "\nrun 0\nlog trunc" }
+   local ctl = { read = function () return table.remove(reads, 1) end }
+   local t = Target:basicNew()
+   local msgs = {}
+   function t:handleMessage(msg)
+      msgs[#msgs+1] = msg
+   end
+
+   local printed = {}
+   local savePrint = print
+   print = function (str) printed[#printed+1] = str end
+   t:readLoop(ctl)
+   print = savePrint
+
+   eq({"set a 1", "log x", "run 0", "exit"}, msgs)
+   qt.match(printed[1], "incomplete message.*log trunc")
+end
+
+
 --------------------------------
 -- main
 --------------------------------
@@ -712,6 +735,7 @@ local function main()
       os.exit(1)
    end
 
+   testReadLoop()
    testBasic()
    testEval()
    testDebug()
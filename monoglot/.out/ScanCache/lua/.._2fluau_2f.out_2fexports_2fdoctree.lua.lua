@@ -0,0 +1 @@
+return {value={"require","memoize"},path="../luau/.out/exports/doctree.lua",stamp="2797:1173406:65024:1792372283"}
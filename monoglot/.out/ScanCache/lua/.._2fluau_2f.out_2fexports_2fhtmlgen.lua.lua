@@ -0,0 +1 @@
+return {path="../luau/.out/exports/htmlgen.lua",value={"require","object","require","utf8utils","require","doctree","require","opairs","require","textcodec_c"},stamp="11797:1173414:65024:1792375024"}
@@ -0,0 +1 @@
+return {path="../luau/.out/exports/memoize.lua",value={},stamp="2577:1173424:65024:1792372283"}
@@ -0,0 +1 @@
+return {value={},stamp="676:1173428:65024:1792372283",path="../luau/.out/exports/object.lua"}
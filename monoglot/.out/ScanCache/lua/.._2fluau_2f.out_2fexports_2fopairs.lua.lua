@@ -0,0 +1 @@
+return {value={},path="../luau/.out/exports/opairs.lua",stamp="870:1173430:65024:1792372283"}
@@ -0,0 +1 @@
+return {stamp="4007:1173444:65024:1792374939",path="../luau/.out/exports/utf8utils.lua",value={"require","textcodec_c"}}
@@ -0,0 +1 @@
+return {value={"require","textcodec_c"},path="../luau/.out/exports/xuri.lua",stamp="12476:1173450:65024:1792374892"}
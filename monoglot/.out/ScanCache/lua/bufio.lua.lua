@@ -0,0 +1 @@
+return {value={"require","object"},stamp="2756:1171687:65024:1792361468",path="bufio.lua"}
@@ -0,0 +1 @@
+return {path="bufio_q.lua",stamp="1856:1171688:65024:1792361468",value={"require","qtest","require","object","require","bufio"}}
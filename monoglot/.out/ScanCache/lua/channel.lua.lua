@@ -0,0 +1 @@
+return {stamp="4508:1175518:65024:1792371858",path="channel.lua",value={"require","object","require","queue","require","event","require","thread","require","xpio"}}
@@ -0,0 +1 @@
+return {stamp="4005:1175522:65024:1792371858",path="channel_q.lua",value={"require","qtest","require","thread","require","xpio","require","channel"}}
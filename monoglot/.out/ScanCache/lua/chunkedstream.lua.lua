@@ -0,0 +1 @@
+return {stamp="2624:1175509:65024:1792371858",path="chunkedstream.lua",value={"require","object","require","bufio","require","substream"}}
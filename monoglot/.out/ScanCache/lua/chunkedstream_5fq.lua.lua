@@ -0,0 +1 @@
+return {path="chunkedstream_q.lua",stamp="1981:1175510:65024:1792371858",value={"require","qtest","require","chunkedstream"}}
@@ -0,0 +1 @@
+return {value={"require","object","require","memoize","require","htmlgen","require","lpeg","require","xuri"},stamp="5420:1171689:65024:1792361468",path="dino.lua"}
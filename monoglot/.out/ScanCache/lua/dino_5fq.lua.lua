@@ -0,0 +1 @@
+return {value={"require","qtest","require","dino"},stamp="3160:1171691:65024:1792361468",path="dino_q.lua"}
@@ -0,0 +1 @@
+return {path="event.lua",stamp="2245:1172739:65024:1792371858",value={"require","object","require","xpio"}}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","thread","require","event","require","xpio"},path="event_q.lua",stamp="2186:1171694:65024:1792371858"}
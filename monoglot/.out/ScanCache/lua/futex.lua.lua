@@ -0,0 +1 @@
+return {stamp="620:1171695:65024:1792361468",value={"require","event"},path="futex.lua"}
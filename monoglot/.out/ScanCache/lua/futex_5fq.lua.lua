@@ -0,0 +1 @@
+return {stamp="735:1171697:65024:1792361468",value={"require","qtest","require","thread","require","futex"},path="futex_q.lua"}
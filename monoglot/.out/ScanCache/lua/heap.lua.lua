@@ -0,0 +1 @@
+return {value={"require","object"},path="heap.lua",stamp="1075:1171698:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="heap_q.lua",value={"require","qtest","require","heap"},stamp="343:1171699:65024:1792361468"}
@@ -0,0 +1 @@
+return {value={"require","object","require","xpio","require","thread","require","substream","require","chunkedstream","require","httpd"},path="httpc.lua",stamp="13700:1175504:65024:1792373910"}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","httpc","require","httpd","require","xpio","require","thread"},path="httpc_q.lua",stamp="6586:1175508:65024:1792373913"}
@@ -0,0 +1 @@
+return {stamp="28857:1175441:65024:1792373696",path="httpd.lua",value={"require","object","require","xpio","require","xuri","require","thread","require","substream","require","chunkedstream","require","deflate_c","require","lpeg"}}
@@ -0,0 +1 @@
+return {stamp="27333:1172741:65024:1792373701",path="httpd_q.lua",value={"require","qtest","require","httpd","require","memoize","require","xpio","require","thread","require","bufio","require","deflate_c","require","qtest"}}
@@ -0,0 +1 @@
+return {stamp="3932:1175527:65024:1792371858",path="pipeline.lua",value={"require","xpio","require","bufio","require","object"}}
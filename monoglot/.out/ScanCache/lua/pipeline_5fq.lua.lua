@@ -0,0 +1 @@
+return {stamp="2350:1175531:65024:1792371858",path="pipeline_q.lua",value={"require","qtest","require","pipeline","require","thread","require","xpio","require","bufio"}}
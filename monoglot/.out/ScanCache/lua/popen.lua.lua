@@ -0,0 +1 @@
+return {value={"require","xpio","require","bufio"},stamp="999:1171707:65024:1792361468",path="popen.lua"}
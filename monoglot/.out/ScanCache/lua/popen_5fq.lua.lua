@@ -0,0 +1 @@
+return {value={"require","qtest","require","popen","require","thread"},stamp="588:1171708:65024:1792361468",path="popen_q.lua"}
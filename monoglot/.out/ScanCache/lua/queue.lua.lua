@@ -0,0 +1 @@
+return {stamp="1187:1171710:65024:1792371858",value={"require","object"},path="queue.lua"}
@@ -0,0 +1 @@
+return {path="queue_q.lua",stamp="752:1171711:65024:1792361468",value={"require","qtest","require","queue"}}
@@ -0,0 +1 @@
+return {stamp="1820:1171714:65024:1792361468",value={"require","object"},path="substream.lua"}
@@ -0,0 +1 @@
+return {stamp="1845:1171715:65024:1792361468",value={"require","qtest","require","substream"},path="substream_q.lua"}
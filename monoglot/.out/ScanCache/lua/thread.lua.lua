@@ -0,0 +1 @@
+return {stamp="17491:1175775:65024:1792374628",path="thread.lua",value={"require","xpio","require","heap","require","queue"}}
@@ -0,0 +1 @@
+return {stamp="9570:1172759:65024:1792374643",path="thread_q.lua",value={"require","qtest","require","thread","require","xpio"}}
@@ -0,0 +1 @@
+return {value={"require","xpio_c","require","xpfs"},path="xpio.lua",stamp="7991:1171721:65024:1792371858"}
@@ -0,0 +1 @@
+return {stamp="3022:1171725:65024:1792361468",value={"require","qtest","require","xpio_c"},path="xpio_c_q.lua"}
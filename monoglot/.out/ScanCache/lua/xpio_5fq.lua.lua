@@ -0,0 +1 @@
+return {path="xpio_q.lua",value={"require","qtest","require","xpio"},stamp="10026:1171726:65024:1792372060"}
@@ -0,0 +1,194 @@
+-- channel.lua: bounded buffers for passing values between threads
+
+local Object = require "object"
+local Queue = require "queue"
+local Event = require "event"
+local thread = require "thread"
+local xpio = require "xpio"
+
+
+local Channel = Object:new()
+
+
+function Channel:initialize(capacity)
+   capacity = capacity or 1
+   if type(capacity) ~= "number" or capacity < 1 then
+      error("Channel: invalid capacity: " .. tostring(capacity), 3)
+   end
+   self.capacity = capacity
+   self.buf = Queue:new()
+   self.readers = Event:new()   -- threads waiting for a value
+   self.writers = Event:new()   -- threads waiting for space
+   self.closed = false
+end
+
+
+-- Add a value to the buffer without blocking.
+--    true         : success
+--    nil, "retry" : buffer is full
+--    nil, "closed": channel has been closed
+--
+function Channel:try_send(value)
+   if value == nil then
+      error("Channel: cannot send nil", 2)
+   elseif self.closed then
+      return nil, "closed"
+   end
+   local buf = self.buf
+   if buf:length() >= self.capacity then
+      return nil, "retry"
+   end
+   buf:put(value)
+   self.readers:signal(1)
+   return true
+end
+
+
+-- Remove a value from the buffer without blocking.
+--    value        : success
+--    nil, "retry" : buffer is empty
+--    nil, "closed": buffer is empty and channel has been closed
+--
+function Channel:try_recv()
+   local value = self.buf:get()
+   if value == nil then
+      return nil, self.closed and "closed" or "retry"
+   end
+   self.writers:signal(1)
+   return value
+end
+
+
+-- "when" functions (see thread.waitUntil)
+
+function Channel:when_recv(task)
+   self.readers:when(task)
+end
+
+
+function Channel:when_send(task)
+   self.writers:when(task)
+end
+
+
+local function deadlineOf(timeout)
+   return timeout and xpio.gettime() + timeout
+end
+
+
+function Channel:send(value, timeout)
+   local deadline = deadlineOf(timeout)
+   repeat
+      local ok, err = self:try_send(value)
+      if ok or err ~= "retry" then
+         return ok, err
+      end
+   until not thread.waitUntil(deadline, self.when_send, self)
+   return nil, "timeout"
+end
+
+
+function Channel:recv(timeout)
+   local deadline = deadlineOf(timeout)
+   repeat
+      local value, err = self:try_recv()
+      if value ~= nil or err ~= "retry" then
+         return value, err
+      end
+   until not thread.waitUntil(deadline, self.when_recv, self)
+   return nil, "timeout"
+end
+
+
+-- Close the channel.  Pending and future sends fail; values already in the
+-- buffer can still be received.
+--
+function Channel:close()
+   self.closed = true
+   self.readers:signal()
+   self.writers:signal()
+end
+
+
+function Channel:length()
+   return self.buf:length()
+end
+
+
+----------------------------------------------------------------
+-- select
+----------------------------------------------------------------
+
+
+-- Attempt operation `c` without blocking.  Returns true followed by the
+-- operation's results on completion.
+--
+local function tryCase(c)
+   local op = c[2]
+   if op == "recv" then
+      local value, err = c[1]:try_recv()
+      if value ~= nil or err ~= "retry" then
+         return true, value, err
+      end
+   elseif op == "send" then
+      local ok, err = c[1]:try_send(c[3])
+      if ok or err ~= "retry" then
+         return true, ok, err
+      end
+   end
+   return false
+end
+
+
+local whenOps = {
+   recv = Channel.when_recv,
+   send = Channel.when_send,
+}
+
+local socketOps = {
+   read = "when_read",
+   write = "when_write",
+}
+
+
+-- Wait for the first of a number of operations to complete.  See
+-- channel.txt.
+--
+function Channel.select(cases, timeout)
+   local deadline = deadlineOf(timeout)
+   local whens = {}
+   for ndx, c in ipairs(cases) do
+      local op = c[2]
+      if whenOps[op] then
+         whens[ndx] = { whenOps[op], c[1] }
+      elseif socketOps[op] then
+         whens[ndx] = { c[1][socketOps[op]], c[1] }
+      else
+         error("Channel.select: invalid operation: " .. tostring(op), 2)
+      end
+   end
+
+   -- After waking, try the case that woke us first, so that the wakeup
+   -- is not lost when other cases are also ready.
+   local first = 1
+   while true do
+      for n = 0, #cases - 1 do
+         local ndx = (first + n - 1) % #cases + 1
+         local done, a, b = tryCase(cases[ndx])
+         if done then
+            return ndx, a, b
+         end
+      end
+
+      local ndx = thread.waitAny(deadline, whens)
+      if not ndx then
+         return nil, "timeout"
+      elseif socketOps[cases[ndx][2]] then
+         return ndx
+      end
+      first = ndx
+   end
+end
+
+
+return Channel
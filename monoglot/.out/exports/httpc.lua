@@ -0,0 +1,556 @@
+-- httpc.lua
+--
+-- Usage:
+--
+--    local HTTPC = require "httpc"
+--    local client = HTTPC:new{ readTimeout = 10 }
+--    local response, err = client:request{ url = "http://127.0.0.1:8001/" }
+--    client:close()
+--
+
+local Object = require "object"
+local xpio = require "xpio"
+local thread = require "thread"
+local SubStream = require "substream"
+local ChunkedStream = require "chunkedstream"
+local HTTPD = require "httpd"
+
+local pairs, ipairs, tonumber, type, error = pairs, ipairs, tonumber, type, error
+
+local insert, remove, concat = table.insert, table.remove, table.concat
+
+local gettime, waitUntil = xpio.gettime, thread.waitUntil
+local headerOut, parseList, parseTE = HTTPD.headerOut, HTTPD.parseList, HTTPD.parseTE
+local chunkEncode = HTTPD.chunkEncode
+
+local BUFSIZE = 16384
+
+
+-- Methods that may be re-sent when a reused connection turns out to have
+-- been closed by the server [RFC 7230 6.3.1].
+local idempotent = {
+   GET = true, HEAD = true, PUT = true, DELETE = true, OPTIONS = true,
+   TRACE = true
+}
+
+
+-- parseURL(url) --> addr, host, path
+--
+-- `addr` is an xpio socket address, `host` is the value for the Host
+-- header.  Only "http:" URLs with numeric IPv4 addresses (or "localhost")
+-- are supported.
+--
+local function parseURL(url)
+   local host, path = url:match("^[hH][tT][tT][pP]://([^/%?#]+)([^#]*)")
+   if not host then
+      return nil, "unsupported URL: " .. url
+   end
+   local ip, port = host:match("^([^:]*):?(%d*)$")
+   if ip == "localhost" then
+      ip = "127.0.0.1"
+   elseif not (ip and ip:match("^[%d%.]+$")) then
+      return nil, "unsupported host: " .. host
+   end
+   if path == "" then
+      path = "/"
+   end
+   return ip .. ":" .. (port == "" and "80" or port), host, path
+end
+
+
+----------------------------------------------------------------
+-- RP : Parse HTTP Response head
+----------------------------------------------------------------
+--
+-- RP is the request parser of httpd.lua, with a different start line.
+-- On completion:
+--
+--   rp.version  --> HTTP 1.x minor version
+--   rp.status   --> status code (number)
+--   rp.reason   --> reason phrase
+--   rp.headers  --> as in httpd.txt
+--   rp.error    --> "bad" | "unsupported"
+
+local RP = HTTPD.PH:basicNew()
+
+local patStatus = "^HTTP/(%d+)%.(%d+) (%d%d%d) ?([^\r\n]*)\r?\n"
+
+function RP:parseStart(data, pos)
+   local a, b, status, reason = data:match(patStatus, pos)
+   if not a then
+      self.error = "bad"
+      return self.pstDONE
+   elseif a ~= "1" then
+      self.error = "unsupported"
+      return self.pstDONE
+   end
+   self.version = tonumber(b)
+   self.status = tonumber(status)
+   self.reason = reason
+   return self.pstHDRS
+end
+
+
+----------------------------------------------------------------
+-- Conn: one connection to a server
+----------------------------------------------------------------
+
+local Conn = Object:new()
+
+
+function Conn:initialize(client, addr)
+   self.client = client
+   self.addr = addr
+   self.socket = xpio.socket("TCP")
+   self.readAhead = ""
+   self.reusable = true
+   self.rp = RP:new()
+end
+
+
+function Conn:close()
+   self.reusable = false
+   if self.socket then
+      self.socket:close()
+      self.socket = nil
+   end
+end
+
+
+-- Wait for the socket to become readable or writable.  Returns false after
+-- `deadline` (nil => no deadline).
+--
+function Conn:wait(when, deadline)
+   return waitUntil(deadline, when, self.socket)
+end
+
+
+function Conn:connect(timeout)
+   local sock = self.socket
+   local deadline = timeout and gettime() + timeout
+   repeat
+      local succ, err = sock:try_connect(self.addr)
+      if succ then
+         -- requests are written whole
+         sock:setsockopt("TCP_NODELAY", true)
+         return true
+      elseif err ~= "retry" then
+         return nil, err
+      end
+   until not self:wait(sock.when_write, deadline)
+   return nil, "timeout"
+end
+
+
+-- Read up to `amt` bytes from the socket, waiting at most `readTimeout`
+-- for data to arrive.  Conn serves as the parent stream for body streams.
+--
+function Conn:read(amt)
+   local sock = self.socket
+   local timeout = self.client.readTimeout
+   local deadline = timeout and gettime() + timeout
+   repeat
+      local data, err = sock:try_read(amt)
+      if data then
+         return data
+      elseif err ~= "retry" then
+         return nil, err
+      end
+   until not self:wait(sock.when_read, deadline)
+   return nil, "timeout"
+end
+
+
+-- Return a stream for the body of a response [RFC 7230 3.3.3].
+--
+function Conn:bodyStream(method, rp)
+   local hdrs = rp.headers
+   local conn = parseList((hdrs.connection or ""):lower())
+   if conn.close or rp.version < 1 and not conn["keep-alive"] then
+      self.reusable = false
+   end
+
+   local readAhead = self.readAhead
+   self.readAhead = ""
+
+   if method == "HEAD" or rp.status == 204 or rp.status == 304 then
+      return SubStream:new(self, readAhead, 0)
+   end
+
+   local te = hdrs.transferEncoding and parseTE(hdrs.transferEncoding)
+   if te and te[1] then
+      if te[#te].name:lower() == "chunked" then
+         return ChunkedStream:new(self, readAhead)
+      end
+   else
+      local len = tonumber(hdrs.contentLength)
+      if len then
+         return SubStream:new(self, readAhead, len)
+      end
+   end
+
+   -- delimited by close
+   self.reusable = false
+   return SubStream:new(self, readAhead, math.huge)
+end
+
+
+-- Called when the body of the current response has been read.
+--
+function Conn:finish(strm, err)
+   if err then
+      self.reusable = false
+   else
+      self.readAhead = strm:leftovers()
+   end
+end
+
+
+-- Read the head of the next response, skipping 1xx responses.
+--
+-- Returns: rp | nil, err, none
+--    none = true if no part of the response was received.
+--
+function Conn:readHead()
+   local rp = self.rp
+   local none = true
+   repeat
+      rp:restart()
+      rp:takeData(self.readAhead)
+      none = none and self.readAhead == ""
+      while not rp:isDone() do
+         local data, err = self:read(BUFSIZE)
+         if not data then
+            self.reusable = false
+            return nil, err or "closed", none
+         end
+         none = false
+         rp:takeData(data)
+      end
+      self.readAhead = rp.data
+      rp.data = ""
+      if rp.error then
+         self.reusable = false
+         return nil, rp.error
+      end
+   until rp.status >= 200
+   return rp
+end
+
+
+----------------------------------------------------------------
+-- Body: response body delivered as a stream
+----------------------------------------------------------------
+
+local Body = Object:new()
+
+
+function Body:initialize(conn, strm)
+   self.conn = conn
+   self.strm = strm
+end
+
+
+function Body:read(amt)
+   local strm = self.strm
+   if not strm then
+      return nil
+   end
+   local data, err = strm:read(amt)
+   if data == nil then
+      self.strm = nil
+      self.conn:finish(strm, err)
+      self.conn.client:release(self.conn)
+   end
+   return data, err
+end
+
+
+Body.drain = SubStream.drain
+
+
+-- Abandon the rest of the body.  The connection is closed.
+--
+function Body:close()
+   if self.strm then
+      self.strm = nil
+      self.conn:close()
+   end
+end
+
+
+----------------------------------------------------------------
+-- HTTPC: client with a pool of idle connections per server
+----------------------------------------------------------------
+
+local HTTPC = Object:new()
+
+-- defaults
+HTTPC.connectTimeout = 10
+HTTPC.readTimeout = 30
+HTTPC.keepAlive = true
+HTTPC.maxIdle = 8
+
+
+function HTTPC:initialize(options)
+   for k, v in pairs(options or {}) do
+      self[k] = v
+   end
+   self.idle = {}     -- addr -> array of Conn (most recently used last)
+end
+
+
+-- Obtain a connection to `addr`.  Returns conn, reused | nil, err
+--
+function HTTPC:acquire(addr)
+   local idle = self.idle[addr]
+   while idle and idle[1] do
+      local conn = remove(idle)
+      -- discard connections closed by the server while idle
+      local _, err = conn.socket:try_read(1)
+      if err == "retry" then
+         return conn, true
+      end
+      conn:close()
+   end
+
+   local conn = Conn:new(self, addr)
+   local succ, err = conn:connect(self.connectTimeout)
+   if not succ then
+      conn:close()
+      return nil, err
+   end
+   return conn, false
+end
+
+
+-- Return a connection to the pool, or close it.
+--
+function HTTPC:release(conn)
+   if conn.reusable and self.keepAlive and conn.readAhead == "" then
+      local idle = self.idle[conn.addr]
+      if not idle then
+         idle = {}
+         self.idle[conn.addr] = idle
+      end
+      if #idle < self.maxIdle then
+         insert(idle, conn)
+         return
+      end
+   end
+   conn:close()
+end
+
+
+-- Close all idle connections.
+--
+function HTTPC:close()
+   for addr, idle in pairs(self.idle) do
+      for _, conn in ipairs(idle) do
+         conn:close()
+      end
+      self.idle[addr] = nil
+   end
+end
+
+
+local function formatRequest(req, path, host, keepAlive)
+   local method = req.method or "GET"
+   local body = req.body
+   local headers = req.headers or {}
+   local lines = {
+      method .. " " .. path .. " HTTP/1.1",
+      "Host: " .. host
+   }
+   for k, v in pairs(headers) do
+      insert(lines, headerOut[k] .. ": " .. v)
+   end
+   if type(body) == "function" then
+      -- stream function: see sendRequests()
+      insert(lines, "Transfer-Encoding: chunked")
+      body = nil
+   elseif body and not headers.contentLength then
+      insert(lines, "Content-Length: " .. #body)
+   end
+   if not keepAlive then
+      insert(lines, "Connection: close")
+   end
+   insert(lines, "")
+   insert(lines, body or "")
+   return concat(lines, "\r\n")
+end
+
+
+-- Send a body generated by a stream function (as in stack.txt), using the
+-- chunked transfer coding.  Returns: nil | error
+--
+local function sendChunked(socket, bodyFunc)
+   local err
+
+   local function emit(data)
+      if err then
+         return nil, err
+      elseif data ~= "" then
+         local _
+         _, err = socket:write(chunkEncode(data))
+      end
+      return not err, err
+   end
+
+   bodyFunc(emit)
+   if not err then
+      local _
+      _, err = socket:write("0\r\n\r\n")
+   end
+   return err
+end
+
+
+-- Write reqs[first...] to `conn`.  Returns: nil | error
+--
+local function sendRequests(conn, reqs, paths, first, host, keepAlive)
+   local socket = conn.socket
+   local out = {}
+   local _, err
+   for ii = first, #reqs do
+      local req = reqs[ii]
+      out[#out+1] = formatRequest(req, paths[ii], host, keepAlive)
+      if type(req.body) == "function" then
+         _, err = socket:write(concat(out))
+         out = {}
+         err = err or sendChunked(socket, req.body)
+         if err then
+            return err
+         end
+      end
+   end
+   _, err = socket:write(concat(out))
+   return err
+end
+
+
+-- Read a response to `req` from `conn`.
+--
+-- Returns: response | nil, err, none  (see Conn:readHead)
+--
+local function readResponse(conn, req, stream)
+   local rp, err, none = conn:readHead()
+   if not rp then
+      return nil, err, none
+   end
+
+   local response = {
+      status = rp.status,
+      reason = rp.reason,
+      version = rp.version,
+      headers = rp.headers,
+   }
+
+   local strm = conn:bodyStream(req.method or "GET", rp)
+   if stream then
+      response.body = Body:new(conn, strm)
+      return response
+   end
+
+   local body = {}
+   repeat
+      local data
+      data, err = strm:read(BUFSIZE)
+      insert(body, data)
+   until not data
+   conn:finish(strm, err)
+   if err then
+      return nil, err
+   end
+   response.body = concat(body)
+   return response
+end
+
+
+-- Send `reqs` (all to the same server) on one connection without waiting
+-- for responses, and return an array of responses in the same order.
+--
+-- If the connection closes before all responses have arrived, remaining
+-- requests with idempotent methods are sent again on a new connection.
+-- Each request is retried at most once.
+--
+-- Returns: responses | nil, err
+--
+function HTTPC:pipeline(reqs, stream)
+   if stream and #reqs > 1 then
+      -- Each body would have to be read before the next response.
+      error("httpc: stream is not supported for pipelined requests", 2)
+   end
+   local addr, host
+   local paths = {}
+   for ii, req in ipairs(reqs) do
+      local a, h, path = parseURL(req.url)
+      if not a then
+         return nil, h
+      elseif ii > 1 and a ~= addr then
+         error("httpc: pipelined requests must be sent to one server", 2)
+      end
+      addr, host, paths[ii] = a, h, path
+   end
+
+   local responses = {}
+   local lastRetry
+   while #responses < #reqs do
+      local first = #responses + 1
+      local conn, reused = self:acquire(addr)
+      if not conn then
+         return nil, reused
+      end
+
+      local err = sendRequests(conn, reqs, paths, first, host, self.keepAlive)
+      local none = true
+
+      if not err then
+         for ii = first, #reqs do
+            local rsp
+            rsp, err, none = readResponse(conn, reqs[ii], stream)
+            if not rsp then
+               break
+            end
+            responses[ii] = rsp
+         end
+      end
+
+      if not err then
+         if not stream then
+            self:release(conn)
+         end
+      else
+         conn:close()
+         local ii = #responses + 1
+         if not (none and (reused or ii > first) and ii ~= lastRetry) then
+            return nil, err
+         end
+         for n = ii, #reqs do
+            local req = reqs[n]
+            if not idempotent[req.method or "GET"] or type(req.body) == "function" then
+               return nil, err
+            end
+         end
+         lastRetry = ii
+      end
+   end
+
+   return responses
+end
+
+
+-- Perform one request.
+--
+-- Returns: response | nil, err
+--
+function HTTPC:request(req)
+   local responses, err = self:pipeline({req}, req.stream)
+   return responses and responses[1], err
+end
+
+
+HTTPC.RP = RP
+HTTPC.parseURL = parseURL
+
+return HTTPC
@@ -0,0 +1,1116 @@
+-- httpd.lua
+--
+-- Usage:
+--
+--    local HTTPD = require "httpd"
+--    local server = HTTPD:new(addr, options)
+--    server:start(handler)
+--    server:stop()
+--
+
+local Object = require "object"
+local xpio = require "xpio"
+local xuri = require "xuri"
+local thread = require "thread"
+local SubStream = require "substream"
+local ChunkedStream = require "chunkedstream"
+local deflate_c = require "deflate_c"
+local lpeg = require "lpeg"
+
+local pairs, ipairs, rawset, tonumber, tostring, assert, type =
+   pairs, ipairs, rawset, tonumber, tostring, assert, type
+
+local insert, concat = table.insert, table.concat
+
+local bLog = os.getenv("httpd_log") == "1"
+
+
+-- uriSplit(uri) --> prefix, path, query
+--
+-- Split a URI presented by the client. If "scheme://authority" precedes
+-- the path, that is extracted as prefix.  If a "?" appears in that path,
+-- that is extracted as `query`.
+--
+local function uriSplit(uri)
+   local prefix
+   if not uri then
+      return
+   elseif not uri:match("^/") then
+      prefix, uri = uri:match("([^/:]+://[^/]*)(/?.*)")
+      if uri == "" then
+         uri = "/"
+      elseif not uri then
+         return
+      end
+   end
+
+   return prefix, uri:match("([^%?]*)(.*)")
+end
+
+
+local charEscape = {}
+charEscape["\n"] = "\\n\n"
+charEscape["\r"] = "\\r"
+charEscape["\\"] = "\\\\"
+setmetatable(charEscape, { __index = function (t,ch) return ("\\%03d"):format(ch:byte()) end })
+
+
+local function log(who, data)
+   if bLog then
+      local enc = data:gsub("[%z\1-\31\128-\255\\]", charEscape)
+      print(who .. ": " .. enc:gsub("\n(.)", "\n : %1"))
+   end
+end
+
+
+local function flatten(v)
+   if v == nil then
+      return ""
+   end
+   local t = {}
+   local n = 0
+   local err
+
+   local function f(v)
+      if type(v) == "string" then
+         n = n + 1
+         t[n] = v
+      elseif type(v) == "table" then
+         for _, e in ipairs(v) do
+            f(e)
+         end
+      else
+         err = "Invalid value in response.body: type = " .. type(v)
+      end
+   end
+
+   f(v)
+   return concat(t), err
+end
+
+
+local function clone(old)
+   local new = {}
+   for k, v in pairs(old) do
+      new[k] = v
+   end
+   return new
+end
+
+
+-- Return the q-value given to content-coding `coding` by an
+-- Accept-Encoding field value [RFC 7231 5.3.4].
+--
+local function acceptQ(accept, coding)
+   local q, qStar
+   for item in accept:gmatch("[^,]+") do
+      local name, params = item:match("^%s*([^;%s]+)%s*(.*)")
+      if name then
+         local qv = tonumber(params:match("[qQ]%s*=%s*([%d.]+)") or 1) or 0
+         name = name:lower()
+         if name == coding then
+            q = qv
+         elseif name == "*" then
+            qStar = qv
+         end
+      end
+   end
+   return q or qStar or 0
+end
+
+
+-- Strict patterns for HTTP "token" [3.2]
+
+local patToken = "[^\0-\32\127()<>@,;:\\\"/[%]%?={}]+"
+-- local TOK = R("!!", "#'", "*+", "-.", "09", "AZ", "^z", "||", "~~")^1
+
+local function parseList(str)
+   local t = {}
+   for tok in (str or ""):gmatch(patToken) do
+      t[#t+1] = tok
+      t[tok] = #t
+   end
+   return t
+end
+
+
+-- encode one chunk
+local function chunkEncode(str)
+   return string.format("%X", #str) .. "\r\n" .. str .. "\r\n"
+end
+
+
+local parseTE
+do
+   local P, R, S, C, Cs, Ct = lpeg.P, lpeg.R, lpeg.S, lpeg.C, lpeg.Cs, lpeg.Ct
+
+   local lws   = R'\1\32'^0
+   local function T(pat)
+      return pat * lws
+   end
+
+   local function makeTE(name, tbl)
+      tbl.name = name
+      return tbl
+   end
+
+   local TOK   = C((R'!~' - S',;="')^1) * lws
+   local QSTR  = P'"' * Cs( ((1 - S'"\\') + (P'\\'/'' * 1))^0) * P'"' * lws
+   local PARAM = TOK * T'=' * (TOK + QSTR) / function (a,b) return a.."="..b end
+   local TE    = TOK * Ct( (T';' * PARAM)^0 ) / makeTE
+   local TC    = lws * Ct(TE * (T',' * TE)^0 + P(true))
+
+   function parseTE(str)
+      return TC:match(str)
+   end
+end
+
+
+------------------------------------------------------------------------
+-- cacheTable: cache results of a string->string translation function
+------------------------------------------------------------------------
+
+-- limits mitigate DoS
+local cacheLimit = 10000
+local keyLimit = 40
+
+local function cacheTable(f)
+   local room = cacheLimit
+   local function index(t, k)
+      local v = f(k)
+
+      if #k <= keyLimit then
+         room = room - #k
+         if room < 0 then
+            -- dump entire cache
+            for k, v in pairs(t) do
+               rawset(t, k, nil)
+            end
+            room = cacheLimit - #k
+         end
+         rawset(t, k, v)
+      end
+      return v
+   end
+   return setmetatable({}, {__index=index, __call=index})
+end
+
+local function headerInFunc(k)
+   return ( k:lower():gsub("%-([a-z])", string.upper) )
+end
+
+local function headerOutFunc(k)
+   return ( k:gsub("[A-Z]", "-%1"):gsub("^[a-z]", string.upper) )
+end
+
+local headerIn = cacheTable(headerInFunc)
+local headerOut = cacheTable(headerOutFunc)
+
+
+----------------------------------------------------------------
+-- PH : Parse HTTP Request
+----------------------------------------------------------------
+--
+-- Synopsis:
+--
+--   ph = HTTPD:new()   -- or ph:restart()
+--   repeat
+--      ph:takeData(...)
+--   until ph:isDone()
+--   if not ph.error then
+--      ph.version  --> HTTP 1.x minor version, or -1 for HTTP 0.9
+--      ph.method   --> method
+--      ph.uri      --> URI
+--      ph.headers  --> as defined in httpd.txt
+--   else
+--      ph.error    --> "bad" (malformed) | "unsupported" (HTTP 2+)
+--   end
+
+
+-- HTTP version --> major, minor
+local patVersion = "HTTP/(%d+)%.(%d+)"
+
+-- request line --> method, uri, major, minor   [matches complete string]
+local patRequest = "^(" .. patToken .. ") ([^ ]+) " .. patVersion .. " *\r?\n"
+
+
+local PH = Object:new()
+
+local pstSTART = 1
+local pstHDRS = 2
+local pstDONE = 3
+
+
+function PH:initialize()
+   self:restart()
+end
+
+function PH:restart()
+   self.state = pstSTART
+   self.data = ""
+   self.version = -1
+   self.headers = {}
+   self.lastHeader = false
+end
+
+
+function PH:isDone()
+   return self.state == pstDONE
+end
+
+
+-- Parse the first line, which begins at `pos` in `data`.  Returns the
+-- next parser state.  Subclasses override this to parse other kinds of
+-- messages (see httpc.lua).
+--
+function PH:parseStart(data, pos)
+   -- try HTTP/1.0+ (explicit version number)
+   local m, u, a, b = data:match(patRequest, pos)
+
+   if not m then
+      -- try HTTP/0.9 (no version)
+      m, u = data:match("^([^ \t]+) +(/[^ \t\r\n]*)\r?\n", pos)
+      if m then
+         self.method = m
+         self.uri = u
+      else
+         self.error = "bad"
+      end
+      return pstDONE
+   elseif a ~= "1" then
+      self.error = "unsupported"
+      return pstDONE
+   end
+
+   self.method = m
+   self.uri = u
+   self.version = tonumber(b)
+   return pstHDRS
+end
+
+
+function PH:takeData(newData)
+   local st = self.state
+   local data = self.data .. newData
+   local nextLine = 1
+   local hdrs = self.headers
+
+   while st ~= pstDONE do
+      local lineEnd = data:find("\n", nextLine)
+      if not lineEnd then break end
+
+      local thisLine = nextLine
+      nextLine = lineEnd + 1
+
+      if st == pstSTART then
+         st = self:parseStart(data, thisLine)
+
+      elseif st == pstHDRS then
+         -- parse header line
+
+         local name, value = data:match("^([^\0-\32:]+)[ \t]*:[ \t]*([^\r\n]*)\r?\n", thisLine)
+         if name then
+            -- name ":" value
+            name = headerIn[name]
+            if hdrs[name] then
+               value = hdrs[name] .. "; " .. value
+            end
+            hdrs[name] = value
+            self.lastHeader = name
+         elseif data:match("^\r?\n", thisLine) then
+            -- empty line
+            st = pstDONE
+            break
+         else
+            -- continuation line
+            local cont = data:match("^[ \t]*([^\r\n]*)", thisLine)
+            if cont and self.lastHeader then
+               hdrs[self.lastHeader] = hdrs[self.lastHeader] .. " " .. cont
+            else
+               self.error = "bad"
+               st = pstDONE
+            end
+         end
+      end
+   end
+
+   self.data = data:sub(nextLine)  -- preserve un-consumed data
+   self.state = st
+end
+
+
+----------------------------------------------------------------
+-- Status codes
+----------------------------------------------------------------
+
+local httpStatusCodes = {
+   [100] = "Continue",
+   [101] = "Switching Protocols",
+   [200] = "OK",
+   [201] = "Created",
+   [202] = "Accepted",
+   [203] = "Non-Authoritative Information",
+   [204] = "No Content",
+   [205] = "Reset Content",
+   [206] = "Partial Content",
+   [300] = "Multiple Choices",
+   [301] = "Moved Permanently",
+   [302] = "Found",
+   [303] = "See Other",
+   [304] = "Not Modified",
+   [305] = "Use Proxy",
+   [306] = "(Unused)",
+   [307] = "Temporary Redirect",
+   [400] = "Bad Request",
+   [401] = "Unauthorized",
+   [402] = "Payment Required",
+   [403] = "Forbidden",
+   [404] = "Not Found",
+   [405] = "Method Not Allowed",
+   [406] = "Not Acceptable",
+   [407] = "Proxy Authentication Required",
+   [408] = "Request Timeout",
+   [409] = "Conflict",
+   [410] = "Gone",
+   [411] = "Length Required",
+   [412] = "Precondition Failed",
+   [413] = "Request Entity Too Large",
+   [414] = "Request-URI Too Long",
+   [415] = "Unsupported Media Type",
+   [416] = "Requested Range Not Satisfiable",
+   [417] = "Expectation Failed",
+   [500] = "Internal Server Error",
+   [501] = "Not Implemented",
+   [502] = "Bad Gateway",
+   [503] = "Service Unavailable",
+   [504] = "Gateway Timeout",
+   [505] = "HTTP Version Not Supported",
+}
+
+
+----------------------------------------------------------------
+-- WDConn: Web Daemon connection
+----------------------------------------------------------------
+
+local BUFSIZE = 1024
+
+
+-- Return the time `timeout` seconds from now, or nil if `timeout` is false
+-- (no time limit).
+--
+local function timeAfter(timeout)
+   return timeout and xpio.gettime() + timeout or nil
+end
+
+
+-- Construct a complete response that closes the connection.
+--
+local function closingResponse(code, extraHeaders)
+   return "HTTP/1.1 " .. code .. " " .. httpStatusCodes[code] .. "\r\n" ..
+      (extraHeaders or "") ..
+      "Connection: Close\r\nContent-Length: 0\r\n\r\n"
+end
+
+local WDConn = Object:new()
+
+local cstINIT    = 1
+local cstREQUEST = 2
+local cstHANDLER = 3
+local cstDISCARD = 4
+local cstRESPOND = 5
+
+
+function WDConn:initialize(socket, handler, httpd)
+   self.socket = socket
+   self.handler = handler
+   self.data = ""
+   self.ph = PH:new()
+   self.httpd = httpd
+   self.thread = thread.new(self.run, self)
+   -- (not "system", as inherited from the accepting thread)
+   thread.setPriority("interactive", self.thread)
+   self.server = httpd.name
+   self.context = {
+      client = socket:getpeername()
+   }
+end
+
+
+function WDConn:shutDown(timeout)
+   -- TODO: let pending transactions finish (in up to `timeout` seconds)
+   self:dtor()
+end
+
+
+function WDConn:dtor()
+   if not self.inDtor then
+      self.inDtor = true
+      if self.thread then
+         -- this might re-entre dtor (due to atExit function)
+         thread.kill(self.thread)
+      end
+      if self.isActive then
+         self.isActive = false
+         self.httpd.active = self.httpd.active - 1
+      end
+      self.socket:close()
+      self.httpd:removeConn(self)
+   end
+end
+
+
+-- Read up to `amt` bytes, waiting no later than `deadline` (nil => no
+-- limit).  Returns: data | nil, err  (err = "timeout" when time runs out)
+--
+function WDConn:readUntil(amt, deadline)
+   local sock = self.socket
+   repeat
+      local data, err = sock:try_read(amt)
+      if data then
+         return data
+      elseif err ~= "retry" then
+         return nil, err
+      end
+   until not thread.waitUntil(deadline, sock.when_read, sock)
+
+   local stats = self.httpd.stats
+   stats.timedOut = stats.timedOut + 1
+   return nil, "timeout"
+end
+
+
+function WDConn:warn(...)
+   print("httpd.lua warning: " .. string.format(...))
+end
+
+
+-- Read from the socket on behalf of the request body stream.
+--
+function WDConn:read(amt)
+   if self.expectContinue then
+      local err = self:sendContinue()
+      if err then
+         return nil, err
+      end
+   end
+   return self:readUntil(amt, timeAfter(self.httpd.bodyTimeout))
+end
+
+
+-- Send "100 Continue" to a client that is waiting for it before sending
+-- the request body [RFC 7231 5.1.1].  Returns: nil | error
+--
+function WDConn:sendContinue()
+   self.expectContinue = false
+   log("S", "HTTP/1.1 100 Continue\r\n\r\n")
+   local _, err = self.socket:write("HTTP/1.1 100 Continue\r\n\r\n")
+   return err
+end
+
+
+-- Handle request
+--
+-- On exit:
+--    self.subStream = nil | readStream
+--    self.connClose = true => close conn to terminate response
+--    self.expectContinue = true => client awaits "100 Continue"
+--
+-- If `subStream` is non-nil, it contains a read stream (a SubStream, or a
+-- ChunkedStream for chunked request bodies), which may have been partially
+-- or completely consumed by the handler, and it may continue to be
+-- consumed when respond() is executed.
+--
+function WDConn:handle()
+   local prefix, path, query = uriSplit(self.ph.uri)
+   if not path or self.ph.error then
+      self.connClose = true
+      return 505, {}, ""
+   end
+
+   local headers = self.ph.headers
+   local len = tonumber(headers.contentLength)
+
+   local connHdr = parseList( (headers.connection or ""):lower() )
+   self.connClose = connHdr.close
+      or self.ph.version < 1 and not connHdr.keepAlive
+
+   -- Message body [see 4.4]
+   local chunked
+   local teUsed = headers.transferEncoding
+   if teUsed then
+      local tencs = parseTE(teUsed)
+      local name = tencs[1] and tencs[1].name:lower()
+      if name == "chunked" and not tencs[2] then
+         chunked = true
+      elseif name and name ~= "identity" then
+         -- request transfer-encoding not supported => cannot determine
+         -- request body length => abandon transaction and socket
+         self.connClose = true
+         return 501, {}, ""
+      end
+   end
+
+   local extra = self.ph.data
+   self.ph.data = ""
+
+   -- [8.2.3] Expect: 100-continue
+   local expect = headers.expect
+   if expect and self.ph.version >= 1 then
+      if expect:lower() ~= "100-continue" then
+         -- the client may or may not send the body => abandon socket
+         self.connClose = true
+         return 417, {}, ""
+      end
+      -- Defer "100 Continue" until the body is read.
+      self.expectContinue = extra == "" and (chunked or (len or 0) > 0)
+   end
+
+   if chunked then
+      self.subStream = ChunkedStream:new(self, extra)
+   else
+      self.subStream = SubStream:new(self, extra, len or 0)
+   end
+
+   -- Shed load when too many handlers are running.  Any request body will
+   -- be skipped (or, if the client awaits "100 Continue", not sent).
+   local httpd = self.httpd
+   if httpd.maxActive and httpd.active >= httpd.maxActive then
+      httpd.stats.shed = httpd.stats.shed + 1
+      return 503, {retryAfter = "1"}, ""
+   end
+   httpd.active = httpd.active + 1
+   self.isActive = true
+
+   local request = {
+      method = self.ph.method,
+      server = self.server,
+      root = "",
+      path = path,
+      query = query,
+      headers = headers,
+      body = self.subStream,
+      context = self.context
+   }
+
+   -- handler(request) --> status, headers, body
+   return self.handler(request)
+end
+
+-- Add Accept-Encoding to the Vary header, keeping any other fields.
+--
+local function varyEncoding(headers)
+   local vary = headers.vary
+   if not vary then
+      headers.vary = "Accept-Encoding"
+   elseif not vary:lower():match("accept%-encoding") then
+      headers.vary = vary .. ", Accept-Encoding"
+   end
+end
+
+
+-- Compress the response body if compression is enabled, the content type
+-- is listed in `compressTypes`, and the client accepts it.  `headers` is
+-- updated.  Returns the new body (bodyBytes, bodyFunc).
+--
+function WDConn:compressBody(headers, bodyBytes, bodyFunc)
+   local httpd = self.httpd
+   local mediaType = (headers.contentType or ""):match("^[^;%s]*"):lower()
+   local compressible
+   for _, pat in ipairs(httpd.compressTypes) do
+      if mediaType:match(pat) then
+         compressible = true
+         break
+      end
+   end
+   if not compressible or headers.contentEncoding then
+      return bodyBytes, bodyFunc
+   end
+
+   -- Caches must not serve this response to clients that differ in
+   -- Accept-Encoding.
+   varyEncoding(headers)
+
+   if bodyBytes and #bodyBytes < httpd.compressMinSize then
+      return bodyBytes, bodyFunc
+   end
+
+   local accept = self.ph.headers.acceptEncoding or ""
+   local coding = acceptQ(accept, "gzip") > 0 and "gzip"
+      or acceptQ(accept, "deflate") > 0 and "deflate"
+   if not coding then
+      return bodyBytes, bodyFunc
+   end
+   local format = coding == "gzip" and "gzip" or "zlib"
+   local level = httpd.compressLevel
+
+   if bodyBytes then
+      local data = deflate_c.compress(bodyBytes, format, level)
+      if #data >= #bodyBytes then
+         return bodyBytes, bodyFunc
+      end
+      bodyBytes = data
+   else
+      -- Flush after each emit() so that streamed data is not delayed.
+      local fn = bodyFunc
+      bodyFunc = function (emit)
+         local z = deflate_c.new(format, level)
+         local err
+         fn(function (data)
+            if err then
+               return nil, err
+            end
+            data = flatten(data)
+            if data == "" then
+               return true
+            end
+            local ok, e = emit(z:write(data) .. z:flush())
+            err = not ok and (e or "write failed")
+            return ok, e
+         end)
+         -- After a write error the response is abandoned; no trailer.
+         if not err then
+            emit(z:finish())
+         end
+      end
+   end
+
+   headers.contentEncoding = coding
+   headers.contentLength = nil
+   return bodyBytes, bodyFunc
+end
+
+
+-- Returns: nil | error
+--
+function WDConn:respond(code, headers, body)
+   local status      -- status description
+   local bodyBytes   -- body as a string
+   local bodyFunc    -- body as a streaming function
+   local chunked     -- true IFF body is chunked
+
+   -- status code & text
+
+   status = httpStatusCodes[code]
+   if not status then
+      code = 500
+      status = httpStatusCodes[code]
+   end
+
+   -- body
+
+   -- See RFC 2616 4.4
+   local isHead = self.ph.method == "HEAD"
+   if code == 204
+      or code == 304
+      or code <= 199
+   then
+      -- No body to be sent (per spec)
+   elseif type(body) == "function" then
+      if isHead then
+         -- The body is not sent (see below).
+      elseif self.ph.version < 1 then
+         self.connClose = true
+      elseif not self.connClose then
+         chunked = true
+      end
+      bodyFunc = body
+   else
+      local err
+      bodyBytes, err = flatten(body)
+      if err then
+         self:warn(err)
+      end
+   end
+
+   -- normalize headers
+
+   if type(headers) ~= "table" then
+      self:warn("headers is not a table")
+      headers = {}
+   else
+      headers = clone(headers)
+   end
+
+   if self.httpd.compress and (bodyBytes or bodyFunc) then
+      bodyBytes, bodyFunc = self:compressBody(headers, bodyBytes, bodyFunc)
+   end
+
+   -- A HEAD response carries the headers a GET would get (including
+   -- Content-Encoding and Vary), but no body (per spec).
+   if isHead then
+      bodyBytes, bodyFunc = nil, nil
+   end
+
+   if self.connClose then
+      headers.connection = "Close"
+   elseif chunked then
+      headers.transferEncoding = "chunked"
+      headers.contentLength = nil
+   end
+
+   if bodyBytes and not headers.contentLength then
+      headers.contentLength = tostring(#bodyBytes)
+   end
+
+   -- construct response
+
+   local responseLines = {
+      "HTTP/1.1 " .. code .. " " .. status
+   }
+   for k, v in pairs(headers) do
+      insert(responseLines, headerOut[k] .. ": " .. v)
+   end
+   insert(responseLines, "")
+   insert(responseLines, bodyBytes or "")
+
+   local response = concat(responseLines, "\r\n")
+
+   log("S", response)
+   local _, responseError = self.socket:write(response)
+
+   if bodyFunc then
+
+      local function emit(data)
+         if responseError then
+            return nil, responseError
+         end
+         data = flatten(data)
+         if data == "" then
+            return true
+         end
+
+         if chunked then
+            data = chunkEncode(data)
+         end
+         log("S", data)
+         local _, err = self.socket:write(data)
+         if err then
+            responseError = err
+            return nil, responseError
+         end
+         return true
+      end
+
+      bodyFunc(emit)
+      if chunked and not responseError then
+         -- last chunk, (empty) trailer, and final CRLF
+         log("S", "0\r\n")
+         self.socket:write("0\r\n\r\n")
+      end
+   end
+
+   return responseError
+end
+
+
+
+function WDConn:run()
+   thread.atExit(self.dtor, self)
+
+   local httpd = self.httpd
+   local headStarted = false
+
+   while true do
+
+      -- The idle timeout applies until the first byte of a request
+      -- arrives; then the whole request head must arrive within
+      -- `headerTimeout`.
+      local deadline = timeAfter(headStarted and httpd.headerTimeout
+                                    or httpd.idleTimeout)
+
+      while not self.ph:isDone() do
+         local data, err = self:readUntil(BUFSIZE, deadline)
+         if data then
+            log("C", data)
+            if not headStarted then
+               headStarted = true
+               deadline = timeAfter(httpd.headerTimeout)
+            end
+            self.ph:takeData(data)
+         elseif err == "timeout" then
+            log("C", "<timeout>")
+            if headStarted then
+               self.socket:try_write(closingResponse(408))
+            end
+            return
+         elseif err then
+            -- read error: abandon connection
+            log("C", "<error: " .. tostring(err) .. ">")
+            return
+         elseif self.ph.data ~= "" then
+            -- close after partial request
+            log("C", "<close after partial request>")
+            return
+         else
+            -- no requests bytes => graceful close (common after first
+            -- request/response, but there is no reason to complain if we
+            -- get an immediate EOF at the start)
+            log("C", "<close>")
+            return
+         end
+      end
+
+      local code, headers, body = self:handle()
+      local err
+
+      if self.expectContinue then
+         if type(body) == "function" then
+            -- the stream function may read the request body
+            err = self:sendContinue()
+         else
+            -- The client has not been asked for the body, and may or may
+            -- not send it, so it cannot be skipped; close instead.
+            self.expectContinue = false
+            self.connClose = true
+         end
+      end
+
+      -- respond
+      err = err or self:respond(code, headers, body)
+
+      if self.isActive then
+         self.isActive = false
+         httpd.active = httpd.active - 1
+      end
+
+      if err then
+         log("S", "<error: " .. tostring(err) .. ">")
+         return
+      end
+
+      if self.connClose then
+         -- close connection
+         return
+      end
+
+      local leftovers
+
+      -- read and discard the request body (if not already consumed)
+      if self.subStream then
+         local err = self.subStream:drain()
+         if err then
+            -- error in stream
+            log("C", "<error: " .. tostring(err) .. ">")
+            return
+         end
+
+         -- collect any remaining read-ahead
+         leftovers = self.subStream:leftovers()
+         self.subStream = nil
+      else
+         leftovers = self.ph.data
+      end
+
+      headStarted = leftovers ~= ""
+      self.ph:restart()
+      self.ph:takeData(leftovers)
+   end
+end
+
+
+----------------------------------------------------------------
+-- HTTPD: listen + accept loop
+----------------------------------------------------------------
+
+local HTTPD = Object:new()
+
+-- defaults; see httpd.txt
+HTTPD.maxConns = 1000
+HTTPD.maxActive = false
+HTTPD.idleTimeout = 60
+HTTPD.headerTimeout = 20
+HTTPD.bodyTimeout = 60
+HTTPD.compress = false
+HTTPD.compressLevel = 6
+HTTPD.compressMinSize = 1024
+HTTPD.compressTypes = {
+   "^text/",
+   "^application/json$",
+   "^application/javascript$",
+   "^application/x%-oweb%-stream$",
+   "[/+]xml$",
+}
+
+
+function HTTPD:initialize(addr, options)
+   for k, v in pairs(options or {}) do
+      self[k] = v
+   end
+   self.addr = addr
+   self.name = "http://" .. addr:gsub("^:", "127.0.0.1:")
+   self.conns = {}       -- set of WDConn
+   self.numConns = 0
+   self.active = 0       -- number of requests being handled
+   self.stats = {
+      accepted = 0,      -- connections accepted
+      rejected = 0,      -- connections refused due to `maxConns`
+      shed = 0,          -- requests refused due to `maxActive`
+      timedOut = 0,      -- reads that timed out
+   }
+   self.sock = xpio.socket("TCP")
+end
+
+
+function HTTPD:serve()
+   local stats = self.stats
+   while true do
+      local s, err = self.sock:accept()
+      if s and self.numConns >= self.maxConns then
+         -- Shed the connection, making one attempt to say why.
+         stats.rejected = stats.rejected + 1
+         s:try_write(closingResponse(503, "Retry-After: 1\r\n"))
+         s:close()
+      elseif s then
+         stats.accepted = stats.accepted + 1
+         -- responses are written whole, so Nagle's algorithm only adds
+         -- latency (especially with pipelined requests)
+         s:setsockopt("TCP_NODELAY", true)
+         local conn = WDConn:new(s, self.handler, self)
+         self.conns[conn] = true
+         self.numConns = self.numConns + 1
+      elseif err ~= "retry" then
+         error(err)
+      end
+   end
+end
+
+
+function HTTPD:start(handler)
+   self.handler = handler
+   assert( self.sock:setsockopt("SO_REUSEADDR", true) )
+   assert( self.sock:bind(self.addr) )
+   assert( self.sock:listen() )
+
+   self.thread = thread.new(self.serve, self)
+   -- accept promptly even when handlers are busy
+   thread.setPriority("system", self.thread)
+end
+
+
+function HTTPD:removeConn(conn)
+   if self.conns[conn] then
+      self.conns[conn] = nil
+      self.numConns = self.numConns - 1
+   end
+end
+
+
+function HTTPD:getAddr()
+   return self.sock:getsockname()
+end
+
+
+-- Stop the accepting thread, and optionally kill all pending connection threads
+--
+function HTTPD:shutDown(timeout)
+   thread.kill(self.thread)
+   for conn in pairs(self.conns) do
+      conn:shutDown(timeout)
+   end
+end
+
+
+function HTTPD:stop()
+   self:shutDown(0)
+end
+
+
+----------------------------------------------------------------
+-- Static files
+----------------------------------------------------------------
+
+-- Content types by file name extension, for fileResponse
+HTTPD.mimeTypes = {
+   css = "text/css",
+   gif = "image/gif",
+   htm = "text/html",
+   html = "text/html",
+   ico = "image/x-icon",
+   jpeg = "image/jpeg",
+   jpg = "image/jpeg",
+   js = "application/javascript",
+   json = "application/json",
+   lua = "text/plain",
+   png = "image/png",
+   svg = "image/svg+xml",
+   txt = "text/plain",
+   xml = "application/xml",
+}
+
+
+local function readFile(name)
+   local f = io.open(name, "rb")
+   if f then
+      local data = f:read("*a")
+      f:close()
+      return data
+   end
+end
+
+
+local function fileExists(name)
+   local f = io.open(name, "rb")
+   if f then
+      f:close()
+      return true
+   end
+   return false
+end
+
+
+-- Construct a response for the contents of a file.  When `filename..".gz"`
+-- exists and the client accepts gzip, that is sent instead.  See
+-- httpd.txt.
+--
+function HTTPD.fileResponse(request, filename, headers)
+   headers = clone(headers or {})
+   if not headers.contentType then
+      local ext = filename:match("%.([^./]*)$")
+      headers.contentType = HTTPD.mimeTypes[ext and ext:lower()]
+         or "application/octet-stream"
+   end
+
+   -- RFC 7231 permits any coding when Accept-Encoding is absent, but
+   -- clients that omit it (such as httpc) generally cannot decode gzip.
+   local accept = request.headers.acceptEncoding
+   local gzipOK = accept and acceptQ(accept, "gzip") > 0
+
+   local data = gzipOK and readFile(filename .. ".gz")
+   if data then
+      headers.contentEncoding = "gzip"
+      varyEncoding(headers)
+      return 200, headers, data
+   end
+
+   data = readFile(filename)
+   local refused = not gzipOK and fileExists(filename .. ".gz")
+   if data then
+      if refused then
+         varyEncoding(headers)
+      end
+      return 200, headers, data
+   elseif refused then
+      return 406, {contentType = "text/plain", vary = "Accept-Encoding"},
+         "Not acceptable: gzip encoding required"
+   end
+   return 404, {contentType = "text/plain"}, "Not found"
+end
+
+
+HTTPD.headerIn = headerIn
+HTTPD.headerOut = headerOut
+
+
+-- shared with httpc.lua
+HTTPD.PH = PH
+HTTPD.PH.pstHDRS = pstHDRS
+HTTPD.PH.pstDONE = pstDONE
+HTTPD.parseTE = parseTE
+HTTPD.parseList = parseList
+HTTPD.chunkEncode = chunkEncode
+HTTPD.httpStatusCodes = httpStatusCodes
+HTTPD.acceptQ = acceptQ
+HTTPD.WDConn = WDConn
+
+
+return HTTPD
@@ -0,0 +1,700 @@
+-- thread.lua
+--
+-- Thread.lua exports a number of functions that deal with "threads".  A
+-- "thread" consists of a *task* and a *coroutine*.
+--
+-- Task Objects
+-- -------------
+--
+-- Task objects represent a pending operation, and store the following:
+--
+--   * the dispatch context [needed to schedule a coroutine]
+--   * what the coroutine is waiting on [needed to dequeue it]
+--   * cleanup functions to be called when the coroutine exits
+--   * values returned from the coroutine's start function
+--
+-- Dispatch Objects
+-- ----------------
+--
+-- Dispatch objects represent a context for dispatching -- i.e. the state
+-- associated with an invocation of `thread.dispatch()`.  When a task is
+-- waiting on a blocking function -- e.g. read() -- it is stored in a queue
+-- owned by its dispatch context. When a task is being executed, it is being
+-- called (or resumed) from the instance of `dispatch()` associated with its
+-- dispatch context.
+--
+-- Priority Classes
+-- ----------------
+--
+-- Each task belongs to a priority class, and each dispatch context keeps a
+-- ready queue for each class.  Each iteration of the dispatch loop runs
+-- the tasks that were ready when it began, highest class first.  Lower
+-- classes are subject to a time budget per iteration (see thread.budget).
+
+local xpio = require "xpio"
+local Heap = require "heap"
+local Queue = require "queue"
+
+
+-- reverse of table.pack
+--
+local function undoPack(t)
+   return table.unpack(t, 1, t.n)
+end
+
+
+local thread = {}
+
+-- currentTask holds the task currently executing
+local currentTask
+
+
+-- Priority classes, highest first.
+local classNames = { "system", "interactive", "batch" }
+local classIndex = { system = 1, interactive = 2, batch = 3 }
+local defaultClass = classIndex.interactive
+
+-- Configuration; see thread.txt.
+thread.budget = {
+   interactive = 0.05,  -- seconds per dispatch iteration
+   batch = 0.01,
+}
+
+
+local function taskAtExit(me, fn, ...)
+   local id = table.pack(fn, ...)
+   table.insert(me.atExits, id)
+   return id
+end
+
+
+local function taskCancelAtExit(me, id)
+   for n = #me.atExits, 1, -1 do
+      if id == me.atExits[n] then
+         table.remove(me.atExits, n)
+         return true
+      end
+   end
+   return nil
+end
+
+
+local function taskRunAtExits(me)
+   while true do
+      local oe = table.remove(me.atExits)
+      if not oe then return end
+      oe[1](table.unpack(oe, 2, oe.n))
+   end
+end
+
+
+local function taskDelete(me)
+   if me._dequeue then
+      me:_dequeue()
+   end
+   taskRunAtExits(me)
+   me.dispatch.all[me] = nil
+end
+
+
+-- Task class
+thread.Task = {}
+
+-- Create a new task
+--
+-- Other task members not assigned herein:
+--   me._dequeue
+--   me._dequeuedata
+--
+local function taskNew(dispatch, fn, ...)
+   local fargs = table.pack(...)
+   local me = setmetatable({}, thread.Task)
+
+   local function preamble()
+      me.results = table.pack(xpcall(fn, debug.traceback, undoPack(fargs)))
+      me.failed = not table.remove(me.results, 1)
+      me.results.n = me.results.n - 1
+      if me.failed then
+         dispatch.all[me] = nil
+      end
+      taskDelete(me)
+   end
+
+   me.coroutine = coroutine.create(preamble)
+   me.dispatch = dispatch
+   me.atExits = {}
+   me._queue = dispatch._queue
+   me.makeReady = dispatch.makeReady
+
+   -- inherit the creator's priority class
+   me.priority = currentTask and currentTask.priority or defaultClass
+
+   -- accounting (see thread.taskStats)
+   me.runs = 0
+   me.runTime = 0
+   me.maxRun = 0
+
+   me:makeReady()
+   dispatch.all[me] = true
+   return me
+end
+
+
+function thread.new(fn, ...)
+   return taskNew(currentTask.dispatch, fn, ...)
+end
+
+
+function thread.yield()
+   currentTask:makeReady()
+   coroutine.yield()
+end
+
+
+local function joinWake(task)
+   task._dequeue = nil
+   task._dequeueTask = nil
+   task._dequeueID = nil
+   task:makeReady()
+end
+
+
+local function joinDequeue(task)
+   taskCancelAtExit(task._dequeueTask, task._dequeueID)
+   task._dequeue = nil
+   task._dequeueTask = nil
+   task._dequeueID = nil
+end
+
+
+function thread.join(task)
+   if not task.results then
+      local id = taskAtExit(task, joinWake, currentTask)
+      currentTask._dequeue = joinDequeue
+      currentTask._dequeueTask = task
+      currentTask._dequeueID = id
+      coroutine.yield()
+   end
+   if task.failed then
+      error(task.results[1], 0)
+   else
+      return undoPack(task.results)
+   end
+end
+
+
+function thread.atExit(fn, ...)
+   return taskAtExit(currentTask, fn, ...)
+end
+
+
+function thread.cancelAtExit(id)
+   return taskCancelAtExit(currentTask, id)
+end
+
+
+function thread.kill(task)
+   if not task.results then
+      task.results = table.pack(nil, "killed")
+      taskDelete(task)
+   end
+end
+
+
+function thread.setPriority(class, task)
+   local c = classIndex[class]
+   if not c then
+      error("thread.setPriority: invalid class: " .. tostring(class), 2)
+   end
+   task = task or currentTask
+   task.priority = c
+   if task._dequeue and task._dequeue == task.dispatch.dqQueue then
+      -- move to the new class's ready queue
+      task:_dequeue()
+      task:makeReady()
+   end
+end
+
+
+function thread.getPriority(task)
+   return classNames[(task or currentTask).priority]
+end
+
+
+function thread.taskStats(task)
+   task = task or currentTask
+   return {
+      priority = classNames[task.priority],
+      runs = task.runs,
+      time = task.runTime,
+      max = task.maxRun,
+   }
+end
+
+
+-- Return an array of the unfinished tasks in the current dispatch context.
+--
+function thread.tasks()
+   local tasks = {}
+   for task in pairs(currentTask.dispatch.all) do
+      tasks[#tasks+1] = task
+   end
+   return tasks
+end
+
+
+----------------------------------------------------------------
+-- Idle-time garbage collection
+----------------------------------------------------------------
+
+-- Configuration; see thread.txt.
+thread.gc = {
+   mode = "incremental",  -- "incremental", "generational", or "idle"
+   budget = 0.002,        -- maximum seconds of GC per idle period
+   stepSize = 8,          -- argument to collectgarbage("step")
+   threshold = 1.5,       -- heap growth that starts an idle-time cycle
+   limit = 4,             -- heap growth that forces a step ("idle" mode)
+   clock = xpio.gettime,  -- measures the budget
+}
+
+-- number of active dispatch loops, and the mode set by the outermost one
+local dispatchDepth = 0
+local gcMode
+
+
+local function gcEnter()
+   dispatchDepth = dispatchDepth + 1
+   if dispatchDepth == 1 then
+      gcMode = thread.gc.mode
+      if gcMode == "generational" then
+         collectgarbage("generational")
+      elseif gcMode == "idle" then
+         collectgarbage("stop")
+      end
+   end
+end
+
+
+local function gcLeave()
+   dispatchDepth = dispatchDepth - 1
+   if dispatchDepth == 0 then
+      if gcMode == "generational" then
+         collectgarbage("incremental")
+      elseif gcMode == "idle" then
+         collectgarbage("restart")
+      end
+   end
+end
+
+
+-- Run GC steps for up to `budget` seconds, or until the current cycle
+-- completes.
+--
+local function gcSlice(stats, budget, tStart)
+   local cfg = thread.gc
+   local tEnd = tStart + budget
+   local t
+   repeat
+      stats.steps = stats.steps + 1
+      if collectgarbage("step", cfg.stepSize) then
+         stats.cycles = stats.cycles + 1
+         stats.active = false
+         stats.base = collectgarbage("count")
+         t = cfg.clock()
+         break
+      end
+      t = cfg.clock()
+   until t >= tEnd
+
+   -- Allocate a large block, so that the C allocator consolidates the
+   -- small blocks freed by this slice now (glibc does so on the next large
+   -- request), instead of during whatever task next needs a large block.
+   local _ = string.rep(" ", 4096)
+
+   local elapsed = t - tStart
+   stats.slices = stats.slices + 1
+   stats.time = stats.time + elapsed
+   if elapsed > stats.max then
+      stats.max = elapsed
+   end
+end
+
+
+-- Perform idle-time collection before blocking for up to `timeout`
+-- seconds (nil => no timeout).  A cycle is started when the heap has grown
+-- by `threshold` since the last cycle completed, and then continued in
+-- later idle periods until it completes.
+--
+local function gcIdle(stats, timeout)
+   local cfg = thread.gc
+   local budget = math.min(cfg.budget, timeout or math.huge)
+   if budget <= 0 then
+      return
+   end
+   if not stats.active then
+      -- The heap shrinks when the automatic collector completes a cycle,
+      -- so the smallest size seen approximates the live data.
+      local kb = collectgarbage("count")
+      if kb < stats.base * cfg.threshold then
+         stats.base = math.min(stats.base, kb)
+         return
+      end
+      stats.active = true
+   end
+   gcSlice(stats, budget, cfg.clock())
+end
+
+
+-- In "idle" mode, the collector only runs when we call it.  Step anyway
+-- when the heap has grown by `limit` without an idle period.
+--
+local function gcCheckLimit(stats)
+   local cfg = thread.gc
+   if gcMode == "idle" and collectgarbage("count") > stats.base * cfg.limit then
+      stats.forced = stats.forced + 1
+      stats.active = true
+      gcSlice(stats, cfg.budget, cfg.clock())
+   end
+end
+
+
+-- Create a new "dispatch" (dispatching context)
+--
+local function newDispatch()
+   local me = {}
+   local ready = {}   -- ready[class] = queue of tasks
+   local sleepers = Heap:new()
+   local tq = xpio.tqueue()
+
+   for c = 1, #classNames do
+      ready[c] = Queue:new()
+   end
+
+   -- Count of dispatch loop iterations.  Tasks made ready during an
+   -- iteration are run in the next one.
+   local iteration = 0
+
+   me.all = {}  -- all unfinished tasks
+
+   me._queue = tq
+
+   -- GC statistics (see thread.gcStats)
+   me.gcStats = {
+      slices = 0, steps = 0, forced = 0, cycles = 0, time = 0, max = 0,
+      active = false, base = collectgarbage("count")
+   }
+
+   local function dqQueue(task)
+      task._dequeuedata:remove(task)
+      task._dequeuedata = nil
+      task._dequeue = nil
+   end
+
+   me.dqQueue = dqQueue
+
+   function me.makeReady(task)
+      assert(not task._dequeue)
+      local q = ready[task.priority]
+      task._dequeue = dqQueue
+      task._dequeuedata = q
+      task._readyIteration = iteration
+      q:put(task)
+   end
+
+   local function anyReady()
+      for c = 1, #ready do
+         if ready[c]:first() then
+            return true
+         end
+      end
+      return false
+   end
+
+   local function dqSleeper(task)
+      sleepers:remove(task)
+      task._dequeue = nil
+   end
+
+   function me.wakeAt(task, timeDue)
+      assert(not task._dequeue)
+      task._dequeue = dqSleeper
+      task.timeDue = timeDue
+      sleepers:put(task, timeDue)
+   end
+
+
+   function me:dtor()
+      for c = 1, #ready do
+         while true do
+            local t = ready[c]:first()
+            if not t then break end
+            taskDelete(t)
+         end
+      end
+   end
+
+
+   -- Run tasks in queue `q` that were ready before this iteration.  After
+   -- the first task, stop when `budget` seconds have elapsed since
+   -- `tStart`.  Returns the time after the last task ran.
+   --
+   local function runQueue(q, budget, tStart)
+      local t0 = tStart
+      local count = 0
+      while true do
+         local task = q:first()
+         if not task or task._readyIteration >= iteration
+            or budget and count > 0 and t0 - tStart >= budget
+         then
+            return t0
+         end
+         count = count + 1
+
+         -- dequeue (see dqQueue)
+         q:get()
+         task._dequeuedata = nil
+         task._dequeue = nil
+
+         currentTask = task
+         xpio.setCurrentTask(task)
+
+         local succ, err = coroutine.resume(task.coroutine)
+
+         local t1 = xpio.gettime()
+         local elapsed = t1 - t0
+         task.runs = task.runs + 1
+         task.runTime = task.runTime + elapsed
+         if elapsed > task.maxRun then
+            task.maxRun = elapsed
+         end
+         t0 = t1
+
+         if not succ then
+            gcLeave()
+            me:dtor()
+            local msg = ("*** Uncaught error in thread:\n\t" .. tostring(err)):gsub("\n(.)", "\n | %1")
+            error(msg, 0)
+         end
+      end
+   end
+
+
+   function me:dispatch()
+      local thisTask = currentTask
+      local gcStats = me.gcStats
+      local budget = thread.budget
+
+      gcEnter()
+
+      while true do
+         --printf("%d readers, %d writers, %d sleepers\n",
+         --     count(readers), count(writers), #sleepers, ready:length())
+
+         -- Run ready tasks, highest class first.  Any tasks placed on a
+         -- ready queue during this time will be run in the next
+         -- iteration, as will tasks left over when a budget runs out.
+
+         iteration = iteration + 1
+         local t = xpio.gettime()
+         for c = 1, #ready do
+            local q = ready[c]
+            if q:first() then
+               -- Each class is charged only for its own tasks.
+               t = runQueue(q, budget[classNames[c]], t)
+            end
+         end
+         currentTask = nil
+         xpio.setCurrentTask(nil)
+
+         gcCheckLimit(gcStats)
+
+         local s = sleepers:first()
+         local timeout = anyReady() and 0 or s and s.timeDue - xpio.gettime()
+         if timeout ~= 0 and (s or not tq:isEmpty()) then
+            -- We would block, so collect garbage first.
+            gcIdle(gcStats, timeout)
+            timeout = s and math.max(0, s.timeDue - xpio.gettime())
+         end
+         local tasks = tq:wait(timeout)
+
+         --printf("wait(%s) ->%s\n", tostring(timeout), tasks and #tasks or "nil")
+
+         if tasks then
+            for _, task in ipairs(tasks) do
+               task:makeReady()
+            end
+         elseif not anyReady() then
+            -- nothing to wait on
+            break
+         end
+
+         -- wake sleepers
+         local tNow = xpio.gettime()
+         while true do
+            local task = sleepers:first()
+            if not task or task.timeDue > tNow then
+               break
+            end
+            task:_dequeue()
+            task:makeReady()
+         end
+      end
+
+      gcLeave()
+      currentTask = thisTask
+      xpio.setCurrentTask(currentTask)
+   end
+
+   return me
+end
+
+
+function thread.dispatch(func, ...)
+   local me = newDispatch()
+   local t = taskNew(me, func, ...)
+   me:dispatch()
+   me:dtor()
+   if t.failed then
+      error(t.results[1], 0)
+   end
+
+   for task in pairs(me.all) do
+      print("*** Dangling thread:")
+      print(debug.traceback(task.coroutine))
+   end
+end
+
+
+function thread.gcStats()
+   local stats = currentTask.dispatch.gcStats
+   return {
+      slices = stats.slices,
+      steps = stats.steps,
+      forced = stats.forced,
+      cycles = stats.cycles,
+      time = stats.time,
+      max = stats.max,
+      mean = stats.slices > 0 and stats.time / stats.slices or 0,
+   }
+end
+
+
+function thread.sleepUntil(t)
+   currentTask.dispatch.wakeAt(currentTask, t)
+   coroutine.yield()
+end
+
+
+function thread.sleep(delay)
+   thread.sleepUntil(delay + xpio.gettime())
+end
+
+
+-- A Timer stands in for a task in the sleepers heap while the task waits
+-- in thread.waitUntil().  When it comes due, it wakes the task if the task
+-- is still waiting.
+--
+local Timer = {}
+Timer.__index = Timer
+
+function Timer:makeReady()
+   local task = self.task
+   if task._dequeue == self.dequeue then
+      self.expired = true
+      task:_dequeue()
+      task:makeReady()
+   end
+end
+
+
+-- Block until woken by the event registered by `when(obj, task)` (e.g.
+-- `socket.when_read`), or until time `timeDue`, whichever comes first.
+-- Returns true if the event occurred, or false on timeout.
+--
+function thread.waitUntil(timeDue, when, obj)
+   local task = currentTask
+   when(obj, task)
+   if not timeDue then
+      coroutine.yield()
+      return true
+   end
+
+   local ioDequeue = task._dequeue
+   local timer = setmetatable({ task = task }, Timer)
+
+   -- Dequeuing the task (e.g. when it is killed) also cancels the timer.
+   function timer.dequeue(t)
+      ioDequeue(t)
+      if timer._dequeue then
+         timer:_dequeue()
+      end
+   end
+   task._dequeue = timer.dequeue
+
+   task.dispatch.wakeAt(timer, timeDue)
+   coroutine.yield()
+   if timer._dequeue then
+      timer:_dequeue()
+   end
+   return not timer.expired
+end
+
+
+-- A Waiter stands in for a task that waits in thread.waitAny().  The
+-- first waiter to be made ready records its index, cancels the others,
+-- and wakes the task.
+--
+local Waiter = {}
+Waiter.__index = Waiter
+
+function Waiter:makeReady()
+   local task = self.task
+   if task._dequeue == self.dequeue then
+      self.result.index = self.index
+      task:_dequeue()
+      task:makeReady()
+   end
+end
+
+
+-- Block until one of a number of events occurs, or until time `timeDue`.
+-- `whens` is an array of {when, obj} pairs, each describing an event as
+-- in thread.waitUntil().  Returns the index of the first event to occur,
+-- or nil on timeout.
+--
+function thread.waitAny(timeDue, whens)
+   local task = currentTask
+   local waiters = {}
+   local result = {}
+
+   local function dequeue(t)
+      t._dequeue = nil
+      for _, w in ipairs(waiters) do
+         if w._dequeue then
+            w:_dequeue()
+         end
+      end
+   end
+
+   local function newWaiter(index)
+      local w = setmetatable({ task = task, result = result, index = index,
+                               dequeue = dequeue, _queue = task._queue },
+                             Waiter)
+      waiters[#waiters+1] = w
+      return w
+   end
+
+   for ndx, pair in ipairs(whens) do
+      pair[1](pair[2], newWaiter(ndx))
+   end
+   if timeDue then
+      task.dispatch.wakeAt(newWaiter(nil), timeDue)
+   end
+
+   task._dequeue = dequeue
+   coroutine.yield()
+   return result.index
+end
+
+
+return thread
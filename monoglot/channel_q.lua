@@ -0,0 +1,157 @@
+local qt = require "qtest"
+local thread = require "thread"
+local xpio = require "xpio"
+local Channel = require "channel"
+
+local eq = qt.eq
+
+
+local function main()
+
+   -- >> try_send / try_recv
+
+   local ch = Channel:new(2)
+   eq(true, (ch:try_send("a")))
+   eq(true, (ch:try_send(false)))
+   eq({nil, "retry"}, {ch:try_send("c")})
+   eq(2, ch:length())
+   eq("a", (ch:try_recv()))
+   eq(false, (ch:try_recv()))
+   eq({nil, "retry"}, {ch:try_recv()})
+   qt.assert(not pcall(ch.try_send, ch, nil))
+   qt.assert(not pcall(Channel.new, Channel, 0))
+
+   -- >> send blocks while the buffer is full; recv blocks while it is empty
+
+   local out = {}
+   local producer = thread.new(function ()
+      for n = 1, 5 do
+         ch:send(n)
+         out[#out+1] = "s" .. n
+      end
+      ch:close()
+   end)
+   thread.yield()
+   eq({"s1", "s2"}, out)
+
+   out = {}
+   local recvd = {}
+   repeat
+      local v, err = ch:recv()
+      recvd[#recvd+1] = v or err
+   until not v
+   eq({1, 2, 3, 4, 5, "closed"}, recvd)
+   thread.join(producer)
+
+   -- >> close: sends fail; buffered values may still be received
+
+   ch = Channel:new(4)
+   ch:send("x")
+   ch:close()
+   eq({nil, "closed"}, {ch:send("y")})
+   eq("x", (ch:recv()))
+   eq({nil, "closed"}, {ch:recv()})
+
+   -- >> close wakes blocked senders and receivers
+
+   local c1, c2 = Channel:new(), Channel:new()
+   c2:send(1)
+   local results = {}
+   thread.new(function () results.r = {c1:recv()} end)
+   thread.new(function () results.s = {c2:send(2)} end)
+   thread.yield()
+   c1:close()
+   c2:close()
+   thread.yield()
+   thread.yield()
+   eq({nil, "closed"}, results.r)
+   eq({nil, "closed"}, results.s)
+
+   -- >> timeouts
+
+   ch = Channel:new(1)
+   local t0 = xpio.gettime()
+   eq({nil, "timeout"}, {ch:recv(0.02)})
+   qt.assert(xpio.gettime() >= t0 + 0.02)
+   ch:send(1)
+   eq({nil, "timeout"}, {ch:send(2, 0)})
+
+   -- >> many producers and consumers: every value is delivered once
+
+   ch = Channel:new(3)
+   local total, count = 0, 0
+   local producers, consumers = {}, {}
+   for p = 1, 5 do
+      producers[p] = thread.new(function ()
+         for n = 1, 100 do
+            ch:send(n)
+            if n % 7 == 0 then thread.yield() end
+         end
+      end)
+   end
+   for c = 1, 3 do
+      consumers[c] = thread.new(function ()
+         for v in function () return ch:recv() end do
+            total = total + v
+            count = count + 1
+         end
+      end)
+   end
+   for _, t in ipairs(producers) do thread.join(t) end
+   ch:close()
+   for _, t in ipairs(consumers) do thread.join(t) end
+   eq(500, count)
+   eq(5 * 5050, total)
+
+   -- >> killed receivers do not consume values
+
+   ch = Channel:new(1)
+   local victim = thread.new(ch.recv, ch)
+   thread.yield()
+   thread.kill(victim)
+   ch:send("v")
+   eq("v", (ch:recv()))
+
+   -- >> select: ready cases complete without blocking
+
+   local a, b = Channel:new(1), Channel:new(1)
+   b:send("B")
+   eq({2, "B"}, {Channel.select{ {a, "recv"}, {b, "recv"} }})
+   eq({1, true}, {Channel.select{ {a, "send", "A"}, {b, "recv"} }})
+
+   -- >> select: blocks until a case can complete
+
+   thread.new(function () thread.sleep(0.01) ; b:send("later") end)
+   eq({2, "later"}, {Channel.select{ {a, "send", "A2"}, {b, "recv"} }})
+   eq("A", (a:recv()))
+
+   -- >> select: timeout; waiters are removed
+
+   eq({nil, "timeout"}, {Channel.select({ {b, "recv"} }, 0.01)})
+   eq(0, b.readers.waiting)
+
+   -- >> select: socket readiness
+
+   local r, w = xpio.socketpair()
+   thread.new(function () thread.sleep(0.01) ; w:try_write("z") end)
+   eq(2, (Channel.select{ {b, "recv"}, {r, "read"} }))
+   eq("z", (r:try_read(10)))
+   eq(0, b.readers.waiting)
+   r:close()
+   w:close()
+
+   -- >> select: closed channel
+
+   a:close()
+   eq({1, nil, "closed"}, {Channel.select{ {a, "recv"}, {b, "recv"} }})
+   qt.assert(not pcall(Channel.select, { {a, "bogus"} }))
+end
+
+
+local function testmain()
+   local tt = thread.new(function () thread.sleep(5) ; error("Timeout!") end)
+   main()
+   thread.kill(tt)
+end
+
+thread.dispatch(testmain)
@@ -0,0 +1,115 @@
+local Object = require "object"
+local BufIO = require "bufio"
+local SubStream = require "substream"
+
+
+----------------------------------------------------------------
+-- ChunkedStream
+----------------------------------------------------------------
+--
+-- Decode a message body that uses the "chunked" transfer coding [RFC 7230
+-- 4.1].  This has the same interface as SubStream: `read`, `drain`, and
+-- `leftovers`.  Chunk extensions and trailer fields are discarded.
+
+local ChunkedStream = Object:new()
+
+
+-- maximum length of a chunk-size line or trailer line
+ChunkedStream.LINEMAX = 4096
+
+
+--  parent = stream from which to read
+--  readAhead = data already consumed from the parent stream
+
+function ChunkedStream:initialize(parent, readAhead)
+   self.bio = BufIO:new(parent)
+   self.bio.buf = readAhead or ""
+   self.bio.LINEMAX = self.LINEMAX
+   self.left = 0       -- bytes remaining in current chunk
+   self.started = false
+end
+
+
+-- Read the next chunk header.
+--    false       : a chunk follows
+--    true        : last chunk (trailer has been consumed)
+--    nil, err    : error
+--
+local function nextChunk(self)
+   local bio = self.bio
+   local line, err
+   if self.started then
+      -- CRLF after chunk data
+      line, err = bio:read("*l")
+      if line ~= "" then
+         return nil, err or "bad chunk"
+      end
+   end
+   self.started = true
+
+   line, err = bio:read("*l")
+   local size = line and line:match("^%x+")
+   if not size then
+      return nil, err or "bad chunk"
+   end
+   self.left = tonumber(size, 16)
+   if self.left > 0 then
+      return false
+   end
+
+   -- skip trailer
+   repeat
+      line, err = bio:read("*l")
+      if not line then
+         return nil, err or "bad chunk"
+      end
+   until line == ""
+   return true
+end
+
+
+function ChunkedStream:read(amt)
+   if self.done then
+      return nil
+   elseif amt <= 0 then
+      return ""
+   end
+
+   if self.left == 0 then
+      local last, err = nextChunk(self)
+      if last == nil then
+         self.done = true
+         return nil, err
+      elseif last then
+         self.done = true
+         return nil
+      end
+   end
+
+   local data, err = self.bio:read(amt < self.left and amt or self.left)
+   if not data then
+      self.done = true
+      return nil, err or "truncated"
+   end
+   self.left = self.left - #data
+   return data
+end
+
+
+ChunkedStream.drain = SubStream.drain
+
+
+-- extract any data read from the parent beyond the end of the body
+function ChunkedStream:leftovers()
+   return self.bio.buf
+end
+
+
+-- Release reference to parent.
+function ChunkedStream:close()
+   self.done = true
+   self.bio.f = nil
+end
+
+
+return ChunkedStream
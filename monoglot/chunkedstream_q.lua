@@ -0,0 +1,72 @@
+local qt = require "qtest"
+local ChunkedStream = require "chunkedstream"
+
+local eq = qt.eq
+
+
+-- stream that returns (up to `amt` bytes of) one string per read
+local function pieces(...)
+   local t = {...}
+   return {
+      read = function (self, amt)
+         local data = t[1]
+         if data and #data > amt then
+            t[1] = data:sub(amt + 1)
+            return data:sub(1, amt)
+         end
+         return table.remove(t, 1)
+      end
+   }
+end
+
+
+-- read entire stream, returning data and error
+local function readAll(s)
+   local t = {}
+   repeat
+      local data, err = s:read(4096)
+      if err then
+         return table.concat(t), err
+      end
+      t[#t+1] = data
+   until not data
+   return table.concat(t)
+end
+
+
+-- >> chunks may span reads; extensions and trailers are discarded
+
+local cs = ChunkedStream:new(pieces("cde\r\n1\r\nc", "\r\n0\r\nX: y\r\n\r\nnext"),
+                             "5;ext=1\r\nab")
+eq("ab", cs:read(100))
+eq("cde", cs:read(100))
+eq("c", cs:read(100))
+eq(nil, cs:read(100))
+eq(nil, cs:read(100))
+eq("next", cs:leftovers())
+
+-- >> read(amt) returns at most `amt` bytes
+
+cs = ChunkedStream:new(pieces("A\r\n0123456789\r\n0\r\n\r\n"))
+eq("012", cs:read(3))
+eq("3456789", cs:read(100))
+eq("", cs:read(0))
+
+-- >> drain consumes the rest of the body
+
+cs = ChunkedStream:new(pieces("3\r\nabc\r\n", "0\r\n\r\nGET"))
+eq(nil, cs:drain())
+eq("GET", cs:leftovers())
+
+-- >> malformed or truncated bodies are errors
+
+eq({"", "bad chunk"}, {readAll(ChunkedStream:new(pieces("x\r\n")))})
+eq({"abc", "bad chunk"}, {readAll(ChunkedStream:new(pieces("3\r\nabcd\r\n")))})
+eq({"ab", "truncated"}, {readAll(ChunkedStream:new(pieces("ab"), "5\r\n"))})
+eq({"", "bad chunk"}, {readAll(ChunkedStream:new(pieces("0\r\n")))})
+eq({"a", "bad chunk"}, {readAll(ChunkedStream:new(pieces("1\r\na\r\n")))})
+
+-- >> chunk-size lines are limited in length
+
+cs = ChunkedStream:new(pieces(("0"):rep(5000) .. "1\r\na"))
+eq({"", "maximum line length exceeded"}, {readAll(cs)})
@@ -1,4 +1,9 @@
 -- event object
+--
+-- Waiting tasks are kept in a queue in the array part of the event object:
+-- self[a ... b-1].  Entries for tasks that stopped waiting (e.g. killed
+-- tasks) are set to false and skipped, so `wait` and `signal` are O(1) per
+-- task.
 
 local Object = require "object"
 local xpio = require "xpio"
@@ -8,31 +13,94 @@ local yield = coroutine.yield
 local Event = Object:new()
 
 
+function Event:initialize()
+   self.a = 1
+   self.b = 1
+   self.waiting = 0
+end
+
+
+-- Discard entries of tasks that stopped waiting.
+--
+local function reset(evt)
+   for n = evt.a, evt.b - 1 do
+      evt[n] = nil
+   end
+   evt.a = 1
+   evt.b = 1
+end
+
+
+local function dqEvent(task)
+   local evt, ndx = task._dequeuedata, task._eventIndex
+   task._dequeue = nil
+   task._dequeuedata = nil
+   task._eventIndex = nil
+
+   evt[ndx] = false
+   evt.waiting = evt.waiting - 1
+
+   if evt.waiting == 0 then
+      reset(evt)
+   elseif ndx == evt.b - 1 then
+      evt[ndx] = nil
+      evt.b = ndx
+   end
+end
+
+
+-- Register `task` to be made ready when the event is signaled.  This is a
+-- "when" function, as used by thread.waitUntil().
+--
+function Event:when(task)
+   assert(not task._dequeue)
+   local b = self.b
+   self[b] = task
+   self.b = b + 1
+   self.waiting = self.waiting + 1
+   task._dequeue = dqEvent
+   task._dequeuedata = self
+   task._eventIndex = b
+end
+
+
 function Event:wait()
    local task = xpio.getCurrentTask()
-   self[#self+1] = task
+   self:when(task)
    yield()
    return task.value
 end
 
 
+-- Wake up to `count` waiting tasks (all, if `count` is nil), passing
+-- `value` to each.  Returns the number of tasks awakened.
+--
 function Event:signal(count, value)
-   local maxElem = #self
-   if not count or count > maxElem then
-      count = maxElem
-   elseif count <= 0 then
+   if self.waiting == 0 then
       return 0
    end
-
-   for ndx = 1, maxElem do
-      if ndx <= count then
-         local task = self[ndx]
+   count = count or self.waiting
+   local n = 0
+   -- Re-read state each time: makeReady may dequeue other entries.
+   while n < count and self.waiting > 0 do
+      local a = self.a
+      local task = self[a]
+      self[a] = nil
+      self.a = a + 1
+      if task then
+         n = n + 1
+         self.waiting = self.waiting - 1
+         task._dequeue = nil
+         task._dequeuedata = nil
+         task._eventIndex = nil
          task.value = value
          task:makeReady()
       end
-      self[ndx] = self[ndx+count]
    end
-   return count
+   if self.waiting == 0 then
+      reset(self)
+   end
+   return n
 end
 
 
@@ -1,6 +1,7 @@
 local qt = require "qtest"
 local thread = require "thread"
 local Event = require "event"
+local xpio = require "xpio"
 
 local outs = ""
 local done = false
@@ -62,6 +63,47 @@ local function main()
    yield()
    eq(o2, "barB.barC.")
 
+   -- killed threads stop waiting
+
+   local e3 = Event:new()
+   local o3 = ""
+   local tk = {}
+   for _, name in ipairs{"A", "B", "C", "D"} do
+      tk[name] = thread.new(function () e3:wait(); o3 = o3 .. name end)
+   end
+   yield()
+   thread.kill(tk.B)
+   thread.kill(tk.D)
+   eq(2, e3.waiting)
+   eq(1, e3:signal(1))
+   eq(1, e3:signal(3))
+   eq(0, e3:signal())
+   yield()
+   eq(o3, "AC")
+
+   -- timed waits (Event.when is a "when" function)
+
+   local t0 = xpio.gettime()
+   eq(false, thread.waitUntil(t0 + 0.01, e3.when, e3))
+   eq(0, e3.waiting)
+   thread.new(function () e3:signal() end)
+   eq(true, thread.waitUntil(t0 + 10, e3.when, e3))
+
+   -- many waiters
+
+   local e4 = Event:new()
+   local woken = 0
+   for _ = 1, 1000 do
+      thread.new(function () e4:wait(); woken = woken + 1 end)
+   end
+   yield()
+   for _ = 1, 10 do
+      eq(100, e4:signal(100))
+   end
+   yield()
+   eq(1000, woken)
+   eq(1, e4.b)
+
    done = true
 end
 
@@ -0,0 +1,246 @@
+----------------------------------------------------------------
+-- Test HTTP client
+----------------------------------------------------------------
+--
+-- Test cases are prefixed by comments in the following format:
+--
+--   >> ASSERTION
+--
+
+local qt = require "qtest"
+local HTTPC = require "httpc"
+local HTTPD = require "httpd"
+local xpio = require "xpio"
+local thread = require "thread"
+
+local eq = qt.eq
+
+
+--------------------------------
+-- parseURL
+--------------------------------
+
+local parseURL = HTTPC.parseURL
+
+eq({"127.0.0.1:8001", "127.0.0.1:8001", "/a?b=c"},
+   {parseURL("http://127.0.0.1:8001/a?b=c#frag")})
+eq({"127.0.0.1:80", "localhost", "/"}, {parseURL("HTTP://localhost")})
+eq(nil, (parseURL("https://127.0.0.1/")))
+eq(nil, (parseURL("http://example.com/")))
+
+
+--------------------------------
+-- RP: response head parser
+--------------------------------
+
+local rp = HTTPC.RP:new()
+rp:takeData("HTTP/1.1 404 Not Found\r\nContent-Length: 3\r\n")
+eq(false, rp:isDone())
+rp:takeData("\r\nabc")
+eq(true, rp:isDone())
+eq(nil, rp.error)
+eq(404, rp.status)
+eq("Not Found", rp.reason)
+eq(1, rp.version)
+eq("3", rp.headers.contentLength)
+eq("abc", rp.data)
+
+rp:restart()
+rp:takeData("HTTP/2.0 200 OK\r\n\r\n")
+eq("unsupported", rp.error)
+
+rp:restart()
+rp:takeData("GET / HTTP/1.1\r\n\r\n")
+eq("bad", rp.error)
+
+
+--------------------------------
+-- Test client with servers
+--------------------------------
+
+local function testHandler(request)
+   if request.path == "/hello" then
+      return 200, {contentType = "text/plain"}, "Hello!"
+   elseif request.path == "/peer" then
+      return 200, {}, request.context.client
+   elseif request.path == "/echo" then
+      local body = {}
+      repeat
+         local data = request.body:read(4096)
+         body[#body+1] = data
+      until not data
+      return 200, {}, body
+   elseif request.path == "/stream" then
+      return 200, {}, function (emit)
+         for ii = 1, 3 do
+            emit(("x"):rep(ii * 10000))
+         end
+      end
+   end
+   return 404, {}, "Not found"
+end
+
+
+-- Start a raw server that accepts connections and calls fn(socket) for
+-- each one on a new thread.
+--
+local function rawServer(fn)
+   local s = xpio.socket("TCP")
+   assert(s:bind("127.0.0.1:0"))
+   assert(s:listen())
+   local t = thread.new(function ()
+      while true do
+         thread.new(fn, assert(s:accept()))
+      end
+   end)
+   local function stop()
+      thread.kill(t)
+      s:close()
+   end
+   return "http://" .. s:getsockname(), stop
+end
+
+
+local function testClient()
+   local d = HTTPD:new("127.0.0.1:0")
+   d:start(testHandler)
+   local base = "http://" .. d:getAddr()
+
+   local client = HTTPC:new()
+
+   -- >> simple request
+
+   local r = assert(client:request{ url = base .. "/hello" })
+   eq(200, r.status)
+   eq("OK", r.reason)
+   eq("text/plain", r.headers.contentType)
+   eq("Hello!", r.body)
+
+   -- >> connections are reused
+
+   local peer = client:request{ url = base .. "/peer" }.body
+   eq(peer, client:request{ url = base .. "/peer" }.body)
+   eq(1, #client.idle[d:getAddr()])
+
+   -- >> request bodies are sent; HEAD responses have no body
+
+   eq("abc", client:request{ url = base .. "/echo", method = "POST", body = "abc" }.body)
+
+   -- >> request bodies may be streamed (using chunked transfer coding)
+
+   local function upload(emit)
+      emit("ab")
+      emit("")
+      emit("cd")
+   end
+   eq("abcd", client:request{ url = base .. "/echo", method = "POST", body = upload }.body)
+   eq(peer, client:request{ url = base .. "/peer" }.body)
+
+   r = client:request{ url = base .. "/hello", method = "HEAD" }
+   eq({200, ""}, {r.status, r.body})
+
+   -- >> chunked responses
+
+   r = client:request{ url = base .. "/stream" }
+   eq("chunked", r.headers.transferEncoding)
+   eq(60000, #r.body)
+
+   -- >> streamed responses; connection returns to pool at end of stream
+
+   r = client:request{ url = base .. "/stream", stream = true }
+   eq(0, #client.idle[d:getAddr()])
+   local size = 0
+   repeat
+      local data = r.body:read(4096)
+      size = size + #(data or "")
+   until not data
+   eq(60000, size)
+   eq(1, #client.idle[d:getAddr()])
+   eq(peer, client:request{ url = base .. "/peer" }.body)
+
+   -- >> pipelined requests on one connection
+
+   local rs = assert(client:pipeline {
+      { url = base .. "/hello" },
+      { url = base .. "/stream" },
+      { url = base .. "/peer" },
+      { url = base .. "/missing" },
+   })
+   eq("Hello!", rs[1].body)
+   eq(60000, #rs[2].body)
+   eq(peer, rs[3].body)
+   eq(404, rs[4].status)
+
+   -- streamed bodies cannot be pipelined
+   qt.assert(not pcall(client.pipeline, client,
+                       { { url = base .. "/hello" }, { url = base .. "/peer" } },
+                       true))
+
+   -- >> keepAlive = false closes each connection
+
+   local c2 = HTTPC:new{ keepAlive = false }
+   r = c2:request{ url = base .. "/peer" }
+   qt.assert(r.body ~= c2:request{ url = base .. "/peer" }.body)
+   eq(nil, c2.idle[d:getAddr()])
+
+   -- >> idle connections closed by the server are discarded
+
+   for conn in pairs(d.conns) do
+      conn:shutDown(0)
+   end
+   qt.assert(peer ~= client:request{ url = base .. "/peer" }.body)
+   d:stop()
+   client:close()
+
+   -- >> requests are re-sent when a reused connection closes, and
+   --    interim (1xx) responses are skipped
+
+   local nconn = 0
+   local url, stop = rawServer(function (s)
+      nconn = nconn + 1
+      local reqs = 0
+      while true do
+         local data = s:read(4096)
+         if not data then break end
+         reqs = reqs + select(2, data:gsub("\r\n\r\n", ""))
+         -- close on second request on each connection
+         if reqs > 1 then break end
+         s:write("HTTP/1.1 100 Continue\r\n\r\n" ..
+                 "HTTP/1.1 200 OK\r\nContent-Length: 1\r\n\r\n" .. nconn)
+      end
+      s:close()
+   end)
+   eq("1", client:request{ url = url }.body)
+   eq("2", client:request{ url = url }.body)
+   eq(2, nconn)
+
+   -- >> non-idempotent requests are not re-sent
+
+   eq({nil, "closed"}, {client:request{ url = url, method = "POST", body = "" }})
+   client:close()
+   stop()
+
+   -- >> read timeout
+
+   url, stop = rawServer(function (s) thread.sleep(10) end)
+   local t0 = xpio.gettime()
+   eq({nil, "timeout"}, {HTTPC:new{ readTimeout = 0.05 }:request{ url = url }})
+   qt.assert(xpio.gettime() < t0 + 1)
+   stop()
+
+   -- >> connection errors
+
+   local err
+   r, err = client:request{ url = url }
+   eq(nil, r)
+   qt.assert(err)
+end
+
+
+local function testmain()
+   local tt = thread.new(function () thread.sleep(5) ; error("Timeout!") end)
+   testClient()
+   thread.kill(tt)
+end
+
+thread.dispatch(testmain)
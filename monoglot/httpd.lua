@@ -3,8 +3,8 @@
 -- Usage:
 --
 --    local HTTPD = require "httpd"
---    local server = HTTPD:new(addr, handler)
---    server:start()
+--    local server = HTTPD:new(addr, options)
+--    server:start(handler)
 --    server:stop()
 --
 
@@ -13,12 +13,14 @@ local xpio = require "xpio"
 local xuri = require "xuri"
 local thread = require "thread"
 local SubStream = require "substream"
+local ChunkedStream = require "chunkedstream"
+local deflate_c = require "deflate_c"
 local lpeg = require "lpeg"
 
 local pairs, ipairs, rawset, tonumber, tostring, assert, type =
    pairs, ipairs, rawset, tonumber, tostring, assert, type
 
-local insert, remove, concat = table.insert, table.remove, table.concat
+local insert, concat = table.insert, table.concat
 
 local bLog = os.getenv("httpd_log") == "1"
 
@@ -96,6 +98,27 @@ local function clone(old)
 end
 
 
+-- Return the q-value given to content-coding `coding` by an
+-- Accept-Encoding field value [RFC 7231 5.3.4].
+--
+local function acceptQ(accept, coding)
+   local q, qStar
+   for item in accept:gmatch("[^,]+") do
+      local name, params = item:match("^%s*([^;%s]+)%s*(.*)")
+      if name then
+         local qv = tonumber(params:match("[qQ]%s*=%s*([%d.]+)") or 1) or 0
+         name = name:lower()
+         if name == coding then
+            q = qv
+         elseif name == "*" then
+            qStar = qv
+         end
+      end
+   end
+   return q or qStar or 0
+end
+
+
 -- Strict patterns for HTTP "token" [3.2]
 
 local patToken = "[^\0-\32\127()<>@,;:\\\"/[%]%?={}]+"
@@ -236,6 +259,36 @@ function PH:isDone()
 end
 
 
+-- Parse the first line, which begins at `pos` in `data`.  Returns the
+-- next parser state.  Subclasses override this to parse other kinds of
+-- messages (see httpc.lua).
+--
+function PH:parseStart(data, pos)
+   -- try HTTP/1.0+ (explicit version number)
+   local m, u, a, b = data:match(patRequest, pos)
+
+   if not m then
+      -- try HTTP/0.9 (no version)
+      m, u = data:match("^([^ \t]+) +(/[^ \t\r\n]*)\r?\n", pos)
+      if m then
+         self.method = m
+         self.uri = u
+      else
+         self.error = "bad"
+      end
+      return pstDONE
+   elseif a ~= "1" then
+      self.error = "unsupported"
+      return pstDONE
+   end
+
+   self.method = m
+   self.uri = u
+   self.version = tonumber(b)
+   return pstHDRS
+end
+
+
 function PH:takeData(newData)
    local st = self.state
    local data = self.data .. newData
@@ -250,30 +303,7 @@ function PH:takeData(newData)
       nextLine = lineEnd + 1
 
       if st == pstSTART then
-         -- parse first line
-
-         -- try HTTP/1.0+ (explicit version number)
-         local m, u, a, b = data:match(patRequest, thisLine)
-
-         if not m then
-            -- try HTTP/0.9 (no version)
-            m, u = data:match("^([^ \t]+) +(/[^ \t\r\n]*)\r?\n", thisLine)
-            if m then
-               self.method = m
-               self.uri = u
-            else
-               self.error = "bad"
-            end
-            st = pstDONE
-         elseif a ~= "1" then
-            self.error = "unsupported"
-            st = pstDONE
-         else
-            self.method = m
-            self.uri = u
-            self.version = tonumber(b)
-            st = pstHDRS
-         end
+         st = self:parseStart(data, thisLine)
 
       elseif st == pstHDRS then
          -- parse header line
@@ -364,6 +394,23 @@ local httpStatusCodes = {
 
 local BUFSIZE = 1024
 
+
+-- Return the time `timeout` seconds from now, or nil if `timeout` is false
+-- (no time limit).
+--
+local function timeAfter(timeout)
+   return timeout and xpio.gettime() + timeout or nil
+end
+
+
+-- Construct a complete response that closes the connection.
+--
+local function closingResponse(code, extraHeaders)
+   return "HTTP/1.1 " .. code .. " " .. httpStatusCodes[code] .. "\r\n" ..
+      (extraHeaders or "") ..
+      "Connection: Close\r\nContent-Length: 0\r\n\r\n"
+end
+
 local WDConn = Object:new()
 
 local cstINIT    = 1
@@ -380,6 +427,8 @@ function WDConn:initialize(socket, handler, httpd)
    self.ph = PH:new()
    self.httpd = httpd
    self.thread = thread.new(self.run, self)
+   -- (not "system", as inherited from the accepting thread)
+   thread.setPriority("interactive", self.thread)
    self.server = httpd.name
    self.context = {
       client = socket:getpeername()
@@ -400,26 +449,76 @@ function WDConn:dtor()
          -- this might re-entre dtor (due to atExit function)
          thread.kill(self.thread)
       end
+      if self.isActive then
+         self.isActive = false
+         self.httpd.active = self.httpd.active - 1
+      end
       self.socket:close()
       self.httpd:removeConn(self)
    end
 end
 
 
+-- Read up to `amt` bytes, waiting no later than `deadline` (nil => no
+-- limit).  Returns: data | nil, err  (err = "timeout" when time runs out)
+--
+function WDConn:readUntil(amt, deadline)
+   local sock = self.socket
+   repeat
+      local data, err = sock:try_read(amt)
+      if data then
+         return data
+      elseif err ~= "retry" then
+         return nil, err
+      end
+   until not thread.waitUntil(deadline, sock.when_read, sock)
+
+   local stats = self.httpd.stats
+   stats.timedOut = stats.timedOut + 1
+   return nil, "timeout"
+end
+
+
 function WDConn:warn(...)
    print("httpd.lua warning: " .. string.format(...))
 end
 
 
+-- Read from the socket on behalf of the request body stream.
+--
+function WDConn:read(amt)
+   if self.expectContinue then
+      local err = self:sendContinue()
+      if err then
+         return nil, err
+      end
+   end
+   return self:readUntil(amt, timeAfter(self.httpd.bodyTimeout))
+end
+
+
+-- Send "100 Continue" to a client that is waiting for it before sending
+-- the request body [RFC 7231 5.1.1].  Returns: nil | error
+--
+function WDConn:sendContinue()
+   self.expectContinue = false
+   log("S", "HTTP/1.1 100 Continue\r\n\r\n")
+   local _, err = self.socket:write("HTTP/1.1 100 Continue\r\n\r\n")
+   return err
+end
+
+
 -- Handle request
 --
 -- On exit:
 --    self.subStream = nil | readStream
 --    self.connClose = true => close conn to terminate response
+--    self.expectContinue = true => client awaits "100 Continue"
 --
--- If `subStream` is non-nil, it contains a read stream, which may
--- have been partially or completely consumed by the handler, and it
--- may continue to be consumed when respond() is executed.
+-- If `subStream` is non-nil, it contains a read stream (a SubStream, or a
+-- ChunkedStream for chunked request bodies), which may have been partially
+-- or completely consumed by the handler, and it may continue to be
+-- consumed when respond() is executed.
 --
 function WDConn:handle()
    local prefix, path, query = uriSplit(self.ph.uri)
@@ -436,10 +535,14 @@ function WDConn:handle()
       or self.ph.version < 1 and not connHdr.keepAlive
 
    -- Message body [see 4.4]
+   local chunked
    local teUsed = headers.transferEncoding
    if teUsed then
       local tencs = parseTE(teUsed)
-      if tencs[1] and tencs[1].name ~= "identity" then
+      local name = tencs[1] and tencs[1].name:lower()
+      if name == "chunked" and not tencs[2] then
+         chunked = true
+      elseif name and name ~= "identity" then
          -- request transfer-encoding not supported => cannot determine
          -- request body length => abandon transaction and socket
          self.connClose = true
@@ -449,7 +552,34 @@ function WDConn:handle()
 
    local extra = self.ph.data
    self.ph.data = ""
-   self.subStream = SubStream:new(self.socket, extra, len or 0)
+
+   -- [8.2.3] Expect: 100-continue
+   local expect = headers.expect
+   if expect and self.ph.version >= 1 then
+      if expect:lower() ~= "100-continue" then
+         -- the client may or may not send the body => abandon socket
+         self.connClose = true
+         return 417, {}, ""
+      end
+      -- Defer "100 Continue" until the body is read.
+      self.expectContinue = extra == "" and (chunked or (len or 0) > 0)
+   end
+
+   if chunked then
+      self.subStream = ChunkedStream:new(self, extra)
+   else
+      self.subStream = SubStream:new(self, extra, len or 0)
+   end
+
+   -- Shed load when too many handlers are running.  Any request body will
+   -- be skipped (or, if the client awaits "100 Continue", not sent).
+   local httpd = self.httpd
+   if httpd.maxActive and httpd.active >= httpd.maxActive then
+      httpd.stats.shed = httpd.stats.shed + 1
+      return 503, {retryAfter = "1"}, ""
+   end
+   httpd.active = httpd.active + 1
+   self.isActive = true
 
    local request = {
       method = self.ph.method,
@@ -466,6 +596,90 @@ function WDConn:handle()
    return self.handler(request)
 end
 
+-- Add Accept-Encoding to the Vary header, keeping any other fields.
+--
+local function varyEncoding(headers)
+   local vary = headers.vary
+   if not vary then
+      headers.vary = "Accept-Encoding"
+   elseif not vary:lower():match("accept%-encoding") then
+      headers.vary = vary .. ", Accept-Encoding"
+   end
+end
+
+
+-- Compress the response body if compression is enabled, the content type
+-- is listed in `compressTypes`, and the client accepts it.  `headers` is
+-- updated.  Returns the new body (bodyBytes, bodyFunc).
+--
+function WDConn:compressBody(headers, bodyBytes, bodyFunc)
+   local httpd = self.httpd
+   local mediaType = (headers.contentType or ""):match("^[^;%s]*"):lower()
+   local compressible
+   for _, pat in ipairs(httpd.compressTypes) do
+      if mediaType:match(pat) then
+         compressible = true
+         break
+      end
+   end
+   if not compressible or headers.contentEncoding then
+      return bodyBytes, bodyFunc
+   end
+
+   -- Caches must not serve this response to clients that differ in
+   -- Accept-Encoding.
+   varyEncoding(headers)
+
+   if bodyBytes and #bodyBytes < httpd.compressMinSize then
+      return bodyBytes, bodyFunc
+   end
+
+   local accept = self.ph.headers.acceptEncoding or ""
+   local coding = acceptQ(accept, "gzip") > 0 and "gzip"
+      or acceptQ(accept, "deflate") > 0 and "deflate"
+   if not coding then
+      return bodyBytes, bodyFunc
+   end
+   local format = coding == "gzip" and "gzip" or "zlib"
+   local level = httpd.compressLevel
+
+   if bodyBytes then
+      local data = deflate_c.compress(bodyBytes, format, level)
+      if #data >= #bodyBytes then
+         return bodyBytes, bodyFunc
+      end
+      bodyBytes = data
+   else
+      -- Flush after each emit() so that streamed data is not delayed.
+      local fn = bodyFunc
+      bodyFunc = function (emit)
+         local z = deflate_c.new(format, level)
+         local err
+         fn(function (data)
+            if err then
+               return nil, err
+            end
+            data = flatten(data)
+            if data == "" then
+               return true
+            end
+            local ok, e = emit(z:write(data) .. z:flush())
+            err = not ok and (e or "write failed")
+            return ok, e
+         end)
+         -- After a write error the response is abandoned; no trailer.
+         if not err then
+            emit(z:finish())
+         end
+      end
+   end
+
+   headers.contentEncoding = coding
+   headers.contentLength = nil
+   return bodyBytes, bodyFunc
+end
+
+
 -- Returns: nil | error
 --
 function WDConn:respond(code, headers, body)
@@ -485,14 +699,16 @@ function WDConn:respond(code, headers, body)
    -- body
 
    -- See RFC 2616 4.4
+   local isHead = self.ph.method == "HEAD"
    if code == 204
       or code == 304
       or code <= 199
-      or self.ph.method == "HEAD"
    then
       -- No body to be sent (per spec)
    elseif type(body) == "function" then
-      if self.ph.version < 1 then
+      if isHead then
+         -- The body is not sent (see below).
+      elseif self.ph.version < 1 then
          self.connClose = true
       elseif not self.connClose then
          chunked = true
@@ -515,6 +731,16 @@ function WDConn:respond(code, headers, body)
       headers = clone(headers)
    end
 
+   if self.httpd.compress and (bodyBytes or bodyFunc) then
+      bodyBytes, bodyFunc = self:compressBody(headers, bodyBytes, bodyFunc)
+   end
+
+   -- A HEAD response carries the headers a GET would get (including
+   -- Content-Encoding and Vary), but no body (per spec).
+   if isHead then
+      bodyBytes, bodyFunc = nil, nil
+   end
+
    if self.connClose then
       headers.connection = "Close"
    elseif chunked then
@@ -581,13 +807,32 @@ end
 function WDConn:run()
    thread.atExit(self.dtor, self)
 
+   local httpd = self.httpd
+   local headStarted = false
+
    while true do
 
+      -- The idle timeout applies until the first byte of a request
+      -- arrives; then the whole request head must arrive within
+      -- `headerTimeout`.
+      local deadline = timeAfter(headStarted and httpd.headerTimeout
+                                    or httpd.idleTimeout)
+
       while not self.ph:isDone() do
-         local data, err = self.socket:read(BUFSIZE)
+         local data, err = self:readUntil(BUFSIZE, deadline)
          if data then
             log("C", data)
+            if not headStarted then
+               headStarted = true
+               deadline = timeAfter(httpd.headerTimeout)
+            end
             self.ph:takeData(data)
+         elseif err == "timeout" then
+            log("C", "<timeout>")
+            if headStarted then
+               self.socket:try_write(closingResponse(408))
+            end
+            return
          elseif err then
             -- read error: abandon connection
             log("C", "<error: " .. tostring(err) .. ">")
@@ -606,9 +851,28 @@ function WDConn:run()
       end
 
       local code, headers, body = self:handle()
+      local err
+
+      if self.expectContinue then
+         if type(body) == "function" then
+            -- the stream function may read the request body
+            err = self:sendContinue()
+         else
+            -- The client has not been asked for the body, and may or may
+            -- not send it, so it cannot be skipped; close instead.
+            self.expectContinue = false
+            self.connClose = true
+         end
+      end
 
       -- respond
-      local err = self:respond(code, headers, body)
+      err = err or self:respond(code, headers, body)
+
+      if self.isActive then
+         self.isActive = false
+         httpd.active = httpd.active - 1
+      end
+
       if err then
          log("S", "<error: " .. tostring(err) .. ">")
          return
@@ -637,6 +901,7 @@ function WDConn:run()
          leftovers = self.ph.data
       end
 
+      headStarted = leftovers ~= ""
       self.ph:restart()
       self.ph:takeData(leftovers)
    end
@@ -649,20 +914,60 @@ end
 
 local HTTPD = Object:new()
 
-function HTTPD:initialize(addr)
+-- defaults; see httpd.txt
+HTTPD.maxConns = 1000
+HTTPD.maxActive = false
+HTTPD.idleTimeout = 60
+HTTPD.headerTimeout = 20
+HTTPD.bodyTimeout = 60
+HTTPD.compress = false
+HTTPD.compressLevel = 6
+HTTPD.compressMinSize = 1024
+HTTPD.compressTypes = {
+   "^text/",
+   "^application/json$",
+   "^application/javascript$",
+   "^application/x%-oweb%-stream$",
+   "[/+]xml$",
+}
+
+
+function HTTPD:initialize(addr, options)
+   for k, v in pairs(options or {}) do
+      self[k] = v
+   end
    self.addr = addr
    self.name = "http://" .. addr:gsub("^:", "127.0.0.1:")
-   self.conns = {}
+   self.conns = {}       -- set of WDConn
+   self.numConns = 0
+   self.active = 0       -- number of requests being handled
+   self.stats = {
+      accepted = 0,      -- connections accepted
+      rejected = 0,      -- connections refused due to `maxConns`
+      shed = 0,          -- requests refused due to `maxActive`
+      timedOut = 0,      -- reads that timed out
+   }
    self.sock = xpio.socket("TCP")
 end
 
 
 function HTTPD:serve()
+   local stats = self.stats
    while true do
       local s, err = self.sock:accept()
-      if s then
+      if s and self.numConns >= self.maxConns then
+         -- Shed the connection, making one attempt to say why.
+         stats.rejected = stats.rejected + 1
+         s:try_write(closingResponse(503, "Retry-After: 1\r\n"))
+         s:close()
+      elseif s then
+         stats.accepted = stats.accepted + 1
+         -- responses are written whole, so Nagle's algorithm only adds
+         -- latency (especially with pipelined requests)
+         s:setsockopt("TCP_NODELAY", true)
          local conn = WDConn:new(s, self.handler, self)
-         insert(self.conns, conn)
+         self.conns[conn] = true
+         self.numConns = self.numConns + 1
       elseif err ~= "retry" then
          error(err)
       end
@@ -677,15 +982,15 @@ function HTTPD:start(handler)
    assert( self.sock:listen() )
 
    self.thread = thread.new(self.serve, self)
+   -- accept promptly even when handlers are busy
+   thread.setPriority("system", self.thread)
 end
 
 
 function HTTPD:removeConn(conn)
-   for n = 1, #self.conns do
-      if self.conns[n] == conn then
-         remove(self.conns, n)
-         return
-      end
+   if self.conns[conn] then
+      self.conns[conn] = nil
+      self.numConns = self.numConns - 1
    end
 end
 
@@ -699,7 +1004,7 @@ end
 --
 function HTTPD:shutDown(timeout)
    thread.kill(self.thread)
-   for _, conn in ipairs(self.conns) do
+   for conn in pairs(self.conns) do
       conn:shutDown(timeout)
    end
 end
@@ -710,13 +1015,102 @@ function HTTPD:stop()
 end
 
 
+----------------------------------------------------------------
+-- Static files
+----------------------------------------------------------------
+
+-- Content types by file name extension, for fileResponse
+HTTPD.mimeTypes = {
+   css = "text/css",
+   gif = "image/gif",
+   htm = "text/html",
+   html = "text/html",
+   ico = "image/x-icon",
+   jpeg = "image/jpeg",
+   jpg = "image/jpeg",
+   js = "application/javascript",
+   json = "application/json",
+   lua = "text/plain",
+   png = "image/png",
+   svg = "image/svg+xml",
+   txt = "text/plain",
+   xml = "application/xml",
+}
+
+
+local function readFile(name)
+   local f = io.open(name, "rb")
+   if f then
+      local data = f:read("*a")
+      f:close()
+      return data
+   end
+end
+
+
+local function fileExists(name)
+   local f = io.open(name, "rb")
+   if f then
+      f:close()
+      return true
+   end
+   return false
+end
+
+
+-- Construct a response for the contents of a file.  When `filename..".gz"`
+-- exists and the client accepts gzip, that is sent instead.  See
+-- httpd.txt.
+--
+function HTTPD.fileResponse(request, filename, headers)
+   headers = clone(headers or {})
+   if not headers.contentType then
+      local ext = filename:match("%.([^./]*)$")
+      headers.contentType = HTTPD.mimeTypes[ext and ext:lower()]
+         or "application/octet-stream"
+   end
+
+   -- RFC 7231 permits any coding when Accept-Encoding is absent, but
+   -- clients that omit it (such as httpc) generally cannot decode gzip.
+   local accept = request.headers.acceptEncoding
+   local gzipOK = accept and acceptQ(accept, "gzip") > 0
+
+   local data = gzipOK and readFile(filename .. ".gz")
+   if data then
+      headers.contentEncoding = "gzip"
+      varyEncoding(headers)
+      return 200, headers, data
+   end
+
+   data = readFile(filename)
+   local refused = not gzipOK and fileExists(filename .. ".gz")
+   if data then
+      if refused then
+         varyEncoding(headers)
+      end
+      return 200, headers, data
+   elseif refused then
+      return 406, {contentType = "text/plain", vary = "Accept-Encoding"},
+         "Not acceptable: gzip encoding required"
+   end
+   return 404, {contentType = "text/plain"}, "Not found"
+end
+
+
 HTTPD.headerIn = headerIn
 HTTPD.headerOut = headerOut
 
 
--- export for unit test
+-- shared with httpc.lua
 HTTPD.PH = PH
+HTTPD.PH.pstHDRS = pstHDRS
+HTTPD.PH.pstDONE = pstDONE
 HTTPD.parseTE = parseTE
+HTTPD.parseList = parseList
+HTTPD.chunkEncode = chunkEncode
+HTTPD.httpStatusCodes = httpStatusCodes
+HTTPD.acceptQ = acceptQ
+HTTPD.WDConn = WDConn
 
 
 return HTTPD
@@ -13,6 +13,7 @@ local memoize = require "memoize"
 local xpio = require "xpio"
 local thread = require "thread"
 local BufIO = require "bufio"
+local deflate_c = require "deflate_c"
 
 local eq = qt.eq
 
@@ -226,6 +227,21 @@ local function testHandler(request)
 
       return 200, hdrs, strm
 
+   elseif request.path == "/slow" then
+
+      thread.sleep(0.1)
+      body = "Slow"
+
+   elseif request.path == "/bodyErr" then
+
+      -- return the error encountered reading the body
+      repeat
+         local data, err = request.body:read(4096)
+         if err then
+            return 200, {}, err
+         end
+      until not data
+
    elseif request.path == "/streamEcho" then
 
       local function strm(emit)
@@ -517,6 +533,66 @@ local function testServer()
    expect(501, "")
    eq(headers.connection, "Close")
 
+   -- >> [3.6.1] Chunked request bodies are decoded; chunk extensions and
+   --    trailers are ignored, and Content-Length is ignored.
+
+   connect()
+   request{ uri="/echo", method="POST", "Transfer-Encoding: chunked",
+            "Content-Length: 2",
+            body="7;x=y\r\nPayload\r\n3\r\n123\r\n0\r\nTrailer: t\r\n\r\n" }
+   expect(200, "Payload123")
+
+   -- >> Unread chunked bodies are skipped.
+
+   s:write("POST /hello HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n" ..
+           "3\r\nabc\r\n0\r\n\r\n" ..
+           "GET /hello HTTP/1.1\r\n\r\n")
+   expect(200, "Hello!")
+   expect(200, "Hello!")
+
+   -- >> A streaming response may consume a chunked request body.
+
+   s:write("POST /streamEcho HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n")
+   for ii = 1, #LARGE, 7000 do
+      s:write(HTTPD.chunkEncode(LARGE:sub(ii, ii + 6999)))
+   end
+   s:write("0\r\n\r\n")
+   expect(200, LARGE)
+
+   -- >> Malformed chunked bodies abandon the connection.
+
+   s:write("POST /hello HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nxyz\r\n")
+   expect(200, "Hello!")
+   eq(nil, (s:read('*l')))
+
+   -- >> [8.2.3] "100 Continue" is sent when the handler reads the body.
+
+   connect()
+   s:write("POST /echo HTTP/1.1\r\nExpect: 100-continue\r\nContent-Length: 3\r\n\r\n")
+   expect(100, false)
+   s:write("abc")
+   expect(200, "abc")
+
+   s:write("POST /echo HTTP/1.1\r\nExpect: 100-Continue\r\n" ..
+           "Transfer-Encoding: chunked\r\n\r\n")
+   expect(100, false)
+   s:write("3\r\nxyz\r\n0\r\n\r\n")
+   expect(200, "xyz")
+
+   -- >> A response is sent without "100 Continue" when the handler does
+   --    not read the body, and then the connection is closed.
+
+   s:write("POST /hello HTTP/1.1\r\nExpect: 100-continue\r\nContent-Length: 3\r\n\r\n")
+   expect(200, "Hello!")
+   eq(headers.connection, "Close")
+
+   -- >> Unsupported expectations yield 417.
+
+   connect()
+   request{ uri="/echo", method="POST", "Expect: x-magic", body="abc" }
+   expect(417, "")
+   eq(headers.connection, "Close")
+
    -- >> Unrecognized major version => reject connection.
 
    connect()
@@ -536,6 +612,117 @@ local function testServer()
 end
 
 
+--------------------------------
+-- Test limits and timeouts
+--------------------------------
+
+local function testLimits()
+   local function newServer(options)
+      local d = HTTPD:new("127.0.0.1:0", options)
+      d:start(testHandler)
+      return d
+   end
+
+   local function connect(d)
+      local s = xpio.socket("TCP")
+      assert(s:connect(d:getAddr()))
+      return BufIO:new(s)
+   end
+
+   local function get(s, path)
+      s:write("GET " .. path .. " HTTP/1.1\r\n\r\n")
+      return readStatus(s), readHeaders(s)
+   end
+
+   -- >> Connections beyond `maxConns` are refused with 503.
+
+   local d = newServer{ maxConns = 2 }
+   local a, b = connect(d), connect(d)
+   local c = connect(d)
+   eq(503, readStatus(c))
+   eq("1", readHeaders(c).retryAfter)
+   eq(nil, (c:read('*l')))
+   eq(200, (get(a, "/hello")))
+   a:read('=', 6)
+   eq({accepted = 2, rejected = 1, shed = 0, timedOut = 0}, d.stats)
+   eq(2, d.numConns)
+
+   -- >> Closed connections are removed, making room for more.
+
+   a:close()
+   thread.sleep(0.01)
+   eq(1, d.numConns)
+   c = connect(d)
+   eq(200, (get(c, "/hello")))
+   d:stop()
+
+   -- >> Idle connections are closed after `idleTimeout`.
+
+   d = newServer{ idleTimeout = 0.05, headerTimeout = 0.1 }
+   a = connect(d)
+   local t0 = xpio.gettime()
+   eq(nil, (a:read('*l')))
+   lessThan(xpio.gettime(), t0 + 1)
+   eq(1, d.stats.timedOut)
+
+   -- >> The whole request head must arrive within `headerTimeout`, even
+   --    when data trickles in.  The server responds with 408.
+
+   a = connect(d)
+   local writer = thread.new(function ()
+      a:write("GET /hello HTTP/1.1\r\n")
+      for _ = 1, 50 do
+         thread.sleep(0.02)
+         a:write("X")
+      end
+   end)
+   t0 = xpio.gettime()
+   eq(408, readStatus(a))
+   eq("Close", readHeaders(a).connection)
+   lessThan(xpio.gettime(), t0 + 0.5)
+   thread.kill(writer)
+   d:stop()
+
+   -- >> Reads of the request body time out after `bodyTimeout`.
+
+   d = newServer{ bodyTimeout = 0.05 }
+   a = connect(d)
+   a:write("POST /bodyErr HTTP/1.1\r\nContent-Length: 10\r\n\r\nabc")
+   eq(200, readStatus(a))
+   eq("7", readHeaders(a).contentLength)
+   eq("timeout", a:read('=', 7))
+   d:stop()
+
+   -- >> Requests beyond `maxActive` concurrent handlers get 503.
+
+   d = newServer{ maxActive = 1 }
+   a, b = connect(d), connect(d)
+   a:write("GET /slow HTTP/1.1\r\n\r\n")
+   thread.sleep(0.02)
+   local st, hdrs = get(b, "/hello")
+   eq(503, st)
+   eq("1", hdrs.retryAfter)
+   eq(nil, hdrs.connection)
+   eq(200, readStatus(a))
+   readHeaders(a)
+   eq("Slow", a:read('=', 4))
+   eq(200, (get(b, "/hello")))
+   eq(1, d.stats.shed)
+   eq(0, d.active)
+   d:stop()
+
+   -- >> Killing a connection mid-handler releases its slot.
+
+   d = newServer{ maxActive = 1 }
+   a = connect(d)
+   a:write("GET /slow HTTP/1.1\r\n\r\n")
+   thread.sleep(0.02)
+   eq(1, d.active)
+   d:stop()
+   eq(0, d.active)
+end
+
+
 ----------------------------------
 -- Requirements form HTTP/1.1 spec
 ----------------------------------
@@ -592,12 +779,216 @@ end
 
 -- * What about requests with "scheme://auth" on the request line?
 
+----------------------------------------------------------------
+-- Compression
+----------------------------------------------------------------
+
+local function writeFile(name, data)
+   local f = assert(io.open(name, "wb"))
+   f:write(data)
+   f:close()
+end
+
+
+-- Decompress gzip data using `gzip -d`
+--
+local function gunzip(data)
+   local tmp = os.tmpname()
+   writeFile(tmp, data)
+   local p = assert(io.popen("gzip -dc < " .. tmp, "r"))
+   local out = p:read("*a")
+   p:close()
+   os.remove(tmp)
+   return out
+end
+
+
+local function testCompress()
+   local acceptQ = HTTPD.acceptQ
+
+   -- >> acceptQ
+
+   eq(1, acceptQ("gzip, deflate", "gzip"))
+   eq(0.5, acceptQ("deflate, GZIP;q=0.5", "gzip"))
+   eq(0, acceptQ("gzip;q=0, *", "gzip"))
+   eq(0.1, acceptQ("br, *;q=0.1", "gzip"))
+   eq(0, acceptQ("identity", "gzip"))
+
+   local page = ("<p>Hello, compression!</p>\n"):rep(200)
+   local dir = os.tmpname()
+   os.remove(dir)
+   writeFile(dir .. ".html", page)
+   writeFile(dir .. ".html.gz", deflate_c.compress(page .. "(gz)"))
+   writeFile(dir .. ".js.gz", deflate_c.compress("var x;"))
+
+   local function handler(request)
+      local p = request.path
+      if p == "/page" then
+         return 200, {contentType = "text/html; charset=utf-8"}, page
+      elseif p == "/small" then
+         return 200, {contentType = "text/plain"}, "small"
+      elseif p == "/png" then
+         return 200, {contentType = "image/png"}, page
+      elseif p == "/encoded" then
+         return 200, {contentType = "text/plain", contentEncoding = "gzip"},
+            deflate_c.compress("pre")
+      elseif p == "/stream" then
+         return 200, {contentType = "application/json"}, function (emit)
+            emit("[1")
+            emit({",", page})
+            emit("]")
+         end
+      elseif p == "/vary.html" then
+         return HTTPD.fileResponse(request, dir .. ".html", {vary = "Cookie"})
+      elseif p:match("^/file") then
+         return HTTPD.fileResponse(request, dir .. p:sub(6))
+      end
+      return 404, {}, ""
+   end
+
+   local d = HTTPD:new("127.0.0.1:0", { compress = true })
+   d:start(handler)
+   local s = xpio.socket("TCP")
+   assert(s:connect(d:getAddr()))
+   s = BufIO:new(s)
+
+   local function get(path, accept)
+      local req = { uri = path }
+      if accept then
+         req[1] = "Accept-Encoding: " .. accept
+      end
+      s:write(makeRequest(req))
+      local code, hdrs = readStatus(s), readHeaders(s)
+      local body
+      if hdrs.transferEncoding then
+         body = readChunkedBody(s)
+      else
+         body = s:read("=", tonumber(hdrs.contentLength))
+      end
+      return code, hdrs, body
+   end
+
+   -- >> Buffered bodies are compressed when the client accepts gzip.
+
+   local code, hdrs, body = get("/page", "deflate, gzip")
+   eq(200, code)
+   eq("gzip", hdrs.contentEncoding)
+   eq("Accept-Encoding", hdrs.vary)
+   lessThan(#body, #page / 4)
+   eq(page, gunzip(body))
+
+   -- >> "deflate" is used when gzip is not accepted.
+
+   code, hdrs, body = get("/page", "gzip;q=0, deflate")
+   eq("deflate", hdrs.contentEncoding)
+   eq("\120\156", body:sub(1, 2))
+
+   -- >> Not compressed: when not accepted; small bodies; other content
+   --    types; bodies already encoded by the handler.
+
+   code, hdrs, body = get("/page")
+   eq({nil, "Accept-Encoding", page}, {hdrs.contentEncoding, hdrs.vary, body})
+   code, hdrs, body = get("/small", "gzip")
+   eq({nil, "small"}, {hdrs.contentEncoding, body})
+   code, hdrs, body = get("/png", "gzip")
+   eq({nil, nil, page}, {hdrs.contentEncoding, hdrs.vary, body})
+   code, hdrs, body = get("/encoded", "gzip")
+   eq("pre", gunzip(body))
+
+   -- >> Streamed bodies are compressed incrementally.
+
+   code, hdrs, body = get("/stream", "gzip")
+   eq("chunked", hdrs.transferEncoding)
+   eq("gzip", hdrs.contentEncoding)
+   eq("[1," .. page .. "]", gunzip(body))
+
+   -- >> HEAD responses get the same Content-Encoding and Vary headers,
+   --    without a body.
+
+   local function head(path, accept)
+      s:write(makeRequest{ method = "HEAD", uri = path,
+                           accept and "Accept-Encoding: " .. accept })
+      return readStatus(s), readHeaders(s)
+   end
+
+   code, hdrs = head("/page", "gzip")
+   eq({200, "gzip", "Accept-Encoding", nil},
+      {code, hdrs.contentEncoding, hdrs.vary, hdrs.contentLength})
+   code, hdrs = head("/stream", "gzip")
+   eq({"gzip", "Accept-Encoding", nil},
+      {hdrs.contentEncoding, hdrs.vary, hdrs.transferEncoding})
+   code, hdrs = head("/page")
+   eq({nil, "Accept-Encoding"}, {hdrs.contentEncoding, hdrs.vary})
+   -- no body was sent: the connection is still in sync
+   code, hdrs, body = get("/small", "gzip")
+   eq({200, "small"}, {code, body})
+
+   -- >> A streamed body stops after the first failed write, and the
+   --    compressed trailer is not written.
+
+   local conn = { httpd = d, ph = { headers = { acceptEncoding = "gzip" } } }
+   local _, streamFn = HTTPD.WDConn.compressBody(
+      conn, {contentType = "text/plain"}, nil, function (emit)
+         eq({nil, "closed"}, {emit("a")})
+         eq({nil, "closed"}, {emit("b")})
+      end)
+   local writes = 0
+   streamFn(function ()
+      writes = writes + 1
+      return nil, "closed"
+   end)
+   eq(1, writes)
+
+   -- >> fileResponse sends a ".gz" sibling to clients that accept gzip.
+
+   code, hdrs, body = get("/file.html", "gzip")
+   eq({200, "text/html", "gzip"}, {code, hdrs.contentType, hdrs.contentEncoding})
+   eq(page .. "(gz)", gunzip(body))
+   -- A client that sends no Accept-Encoding gets the plain file.
+   code, hdrs, body = get("/file.html")
+   eq({200, nil, "Accept-Encoding", page},
+      {code, hdrs.contentEncoding, hdrs.vary, body})
+
+   -- The plain file is sent otherwise (and may be compressed on the fly).
+   code, hdrs, body = get("/file.html", "identity")
+   eq({200, nil, "Accept-Encoding", page},
+      {code, hdrs.contentEncoding, hdrs.vary, body})
+   code, hdrs, body = get("/file.html", "deflate")
+   eq({"deflate", "Accept-Encoding"}, {hdrs.contentEncoding, hdrs.vary})
+
+   -- A caller-supplied Vary is extended, not replaced.
+   code, hdrs = get("/vary.html", "gzip")
+   eq({"gzip", "Cookie, Accept-Encoding"}, {hdrs.contentEncoding, hdrs.vary})
+
+   -- Only a ".gz" file exists.
+   eq(200, (get("/file.js", "gzip")))
+   eq(406, (get("/file.js")))
+   eq(406, (get("/file.js", "identity")))
+   eq(404, (get("/file.css")))
+
+   -- >> Compression is off by default.
+
+   d:stop()
+   d = HTTPD:new("127.0.0.1:0")
+   d:start(handler)
+   s = xpio.socket("TCP")
+   assert(s:connect(d:getAddr()))
+   s = BufIO:new(s)
+   code, hdrs, body = get("/page", "gzip")
+   eq({nil, nil, page}, {hdrs.contentEncoding, hdrs.vary, body})
+   d:stop()
+
+   os.remove(dir .. ".html")
+   os.remove(dir .. ".html.gz")
+   os.remove(dir .. ".js.gz")
+end
+
+
+
 -- * Buffer streamed output and flush based on timer (or "on-block")
 
 -- * Enhance handler API to describe accurate URL reconstruction logic.
 
--- * Connection timeout
-
 -- * Put limits on everything.
 
 -- * WDConn:warn() should use logging object (not `print`) that could be (a)
@@ -611,6 +1002,8 @@ end
 local function testmain()
    local tt = thread.new(function () thread.sleep(5) ; error("Timeout!") end)
    testServer()
+   testLimits()
+   testCompress()
    thread.kill(tt)
 end
 
@@ -0,0 +1,163 @@
+-- pipeline() runs a sequence of commands connected by pipes, like a shell
+-- pipeline (`cmd1 | cmd2 | ...`).  Data flows directly from one process to
+-- the next; it does not pass through the Lua process.  See pipeline.txt.
+
+local xpio = require "xpio"
+local BufIO = require "bufio"
+local Object = require "object"
+
+
+local Pipeline = Object:new()
+
+
+-- Exit status as returned by POpen:close()
+--
+local function statusCode(reason, code)
+   return reason == "signal" and code*256 or code
+end
+
+
+-- Release every file object in `files` (pipe ends not yet granted).
+--
+local function closeAll(files)
+   for _, f in pairs(files) do
+      if type(f) == "userdata" then
+         f:close()
+      end
+   end
+end
+
+
+function Pipeline:initialize(commands, opts)
+   opts = opts or {}
+   assert(commands[1], "pipeline: no commands")
+
+   local env = opts.env or xpio.env
+   local stdin = opts.stdin or 0
+   local stdout = opts.stdout or 1
+   local stderr = opts.stderr or 2
+
+   if stdin == "pipe" then
+      local r, w = xpio.pipe()
+      stdin = r
+      self.stdin = BufIO:new(w)
+   end
+   if stdout == "pipe" then
+      local r, w = xpio.pipe()
+      stdout = w
+      self.stdout = BufIO:new(r)
+   end
+
+   -- stderr is granted to every stage, so spawn() must not close it.
+   local stderrObj
+   if type(stderr) == "userdata" then
+      stderrObj, stderr = stderr, stderr:fileno()
+   end
+
+   self.procs = {}
+   self.statuses = {}
+
+   -- Each stage is spawned with the read end of the previous pipe and the
+   -- write end of the next one.  spawn() closes those in this process, and
+   -- closes all other inherited descriptors in the child, so each pipe is
+   -- held open only by its reader and writer.
+   local input = stdin
+   for ndx, command in ipairs(commands) do
+      local output, nextInput
+      if ndx == #commands then
+         output = stdout
+      else
+         nextInput, output = xpio.pipe()
+      end
+
+      local ok, proc, err = pcall(xpio.spawn, command, env,
+                                  {[0] = input, [1] = output, [2] = stderr})
+      if not (ok and proc) then
+         closeAll{input, output, nextInput, stdout, stderrObj}
+         self:kill()
+         self:close()
+         error(ok and (err or "spawn failed") or proc, 2)
+      end
+
+      self.procs[ndx] = proc
+      input = nextInput
+   end
+
+   if stderrObj then
+      stderrObj:close()
+   end
+end
+
+
+-- Return statuses of all stages, or `nil, "retry"` if some have not
+-- exited.
+--
+function Pipeline:try_wait()
+   local statuses = self.statuses
+   for ndx, proc in ipairs(self.procs) do
+      if not statuses[ndx] then
+         local reason, code = proc:try_wait()
+         if reason == nil then
+            return nil, code
+         end
+         statuses[ndx] = statusCode(reason, code)
+      end
+   end
+   return statuses
+end
+
+
+-- Wake `task` when a stage that has not been waited for exits.
+--
+function Pipeline:when_wait(task)
+   for ndx, proc in ipairs(self.procs) do
+      if not self.statuses[ndx] then
+         return proc:when_wait(task)
+      end
+   end
+end
+
+
+-- Wait for all stages to exit.  Each stage's exit is observed through the
+-- task queue as it happens, so the total wait is that of the slowest stage.
+--
+function Pipeline:wait()
+   for ndx, proc in ipairs(self.procs) do
+      if not self.statuses[ndx] then
+         self.statuses[ndx] = statusCode(proc:wait())
+      end
+   end
+   return self.statuses
+end
+
+
+function Pipeline:kill()
+   for ndx, proc in ipairs(self.procs) do
+      if not self.statuses[ndx] then
+         proc:kill()
+      end
+   end
+end
+
+
+-- Close the pipes connected to the first and last stages, then wait.
+--
+function Pipeline:close()
+   if self.stdin then
+      self.stdin:close()
+      self.stdin = nil
+   end
+   if self.stdout then
+      self.stdout:close()
+      self.stdout = nil
+   end
+   return self:wait()
+end
+
+
+local function pipeline(commands, opts)
+   return Pipeline:new(commands, opts)
+end
+
+
+return pipeline
@@ -0,0 +1,87 @@
+local qt = require "qtest"
+local pipeline = require "pipeline"
+local thread = require "thread"
+local xpio = require "xpio"
+local BufIO = require "bufio"
+
+
+local eq = qt.eq
+
+
+local function main()
+
+   -- >> Read the output of the last stage
+
+   local p = pipeline({ {"printf", "b\\na\\nc\\nb\\n"}, {"sort"}, {"uniq"} },
+                      { stdout = "pipe" })
+   eq(3, #p.procs)
+   eq("a\nb\nc\n", p.stdout:read("*a"))
+   eq({0, 0, 0}, p:close())
+   eq(nil, p.stdout)
+
+   -- >> Write to the first stage and read from the last
+
+   p = pipeline({ {"grep", "x"}, {"wc", "-l"} },
+                { stdin = "pipe", stdout = "pipe" })
+   p.stdin:write("ax\nb\nxc\nd\n")
+   p.stdin:close()
+   qt.match(p.stdout:read("*a"), "^%s*2%s*$")
+   eq({0, 0}, p:close())
+
+   -- >> Each stage's exit status is reported
+
+   p = pipeline{ {"sh", "-c", "exit 3"}, {"sh", "-c", "kill -9 $$"}, {"true"} }
+   eq({3, 9*256, 0}, p:wait())
+
+   -- >> Stages are waited for concurrently
+
+   p = pipeline{ {"sleep", "0.1"}, {"true"} }
+   eq({nil, "retry"}, {p:try_wait()})
+   local t0 = xpio.gettime()
+   eq({0, 0}, p:wait())
+   qt.assert(xpio.gettime() - t0 < 1)
+   eq({0, 0}, p:try_wait())
+
+   -- when_wait wakes the task as stages exit
+   p = pipeline{ {"true"}, {"sleep", "0.02"} }
+   local wakes = 0
+   while not p:try_wait() do
+      thread.waitUntil(nil, p.when_wait, p)
+      wakes = wakes + 1
+   end
+   qt.assert(wakes >= 1)
+
+   -- >> Output can be sent directly to a socket
+
+   local r, w = xpio.socketpair()
+   p = pipeline({ {"echo", "hi"}, {"tr", "a-z", "A-Z"} }, { stdout = w })
+   eq("HI\n", BufIO:new(r):read("*a"))   -- EOF: `w` was closed
+   eq({0, 0}, p:wait())
+   r:close()
+
+   -- >> stderr is shared by all stages
+
+   r, w = xpio.socketpair()
+   p = pipeline({ {"sh", "-c", "echo e1 >&2"}, {"sh", "-c", "echo e2 >&2"} },
+                { stderr = w })
+   local text = BufIO:new(r):read("*a")
+   qt.match(text, "e1\n")
+   qt.match(text, "e2\n")
+   eq({0, 0}, p:wait())
+   r:close()
+
+   -- >> Failure to spawn a stage stops the stages already started
+
+   local ok, err = pcall(pipeline, { {"sleep", "5"}, {"no-such-command-q"} })
+   eq(false, ok)
+   qt.match(err, "no%-such%-command%-q")
+end
+
+
+local function testmain()
+   local tt = thread.new(function () thread.sleep(5) ; error("Timeout!") end)
+   main()
+   thread.kill(tt)
+end
+
+thread.dispatch(testmain)
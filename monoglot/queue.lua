@@ -52,6 +52,13 @@ end
 function Queue:remove(value)
    local a, b, q = self.a, self.b, self.q
 
+   -- common case: the dispatcher removes tasks from the front
+   if a < b and q[a] == value then
+      q[a] = nil
+      self.a = a+1
+      return value
+   end
+
    for n = a, b-1 do
       if value == q[n] then
          for i = n, b-2 do
@@ -22,6 +22,14 @@
 -- owned by its dispatch context. When a task is being executed, it is being
 -- called (or resumed) from the instance of `dispatch()` associated with its
 -- dispatch context.
+--
+-- Priority Classes
+-- ----------------
+--
+-- Each task belongs to a priority class, and each dispatch context keeps a
+-- ready queue for each class.  Each iteration of the dispatch loop runs
+-- the tasks that were ready when it began, highest class first.  Lower
+-- classes are subject to a time budget per iteration (see thread.budget).
 
 local xpio = require "xpio"
 local Heap = require "heap"
@@ -41,6 +49,18 @@ local thread = {}
 local currentTask
 
 
+-- Priority classes, highest first.
+local classNames = { "system", "interactive", "batch" }
+local classIndex = { system = 1, interactive = 2, batch = 3 }
+local defaultClass = classIndex.interactive
+
+-- Configuration; see thread.txt.
+thread.budget = {
+   interactive = 0.05,  -- seconds per dispatch iteration
+   batch = 0.01,
+}
+
+
 local function taskAtExit(me, fn, ...)
    local id = table.pack(fn, ...)
    table.insert(me.atExits, id)
@@ -106,6 +126,14 @@ local function taskNew(dispatch, fn, ...)
    me._queue = dispatch._queue
    me.makeReady = dispatch.makeReady
 
+   -- inherit the creator's priority class
+   me.priority = currentTask and currentTask.priority or defaultClass
+
+   -- accounting (see thread.taskStats)
+   me.runs = 0
+   me.runTime = 0
+   me.maxRun = 0
+
    me:makeReady()
    dispatch.all[me] = true
    return me
@@ -173,29 +201,213 @@ function thread.kill(task)
 end
 
 
+function thread.setPriority(class, task)
+   local c = classIndex[class]
+   if not c then
+      error("thread.setPriority: invalid class: " .. tostring(class), 2)
+   end
+   task = task or currentTask
+   task.priority = c
+   if task._dequeue and task._dequeue == task.dispatch.dqQueue then
+      -- move to the new class's ready queue
+      task:_dequeue()
+      task:makeReady()
+   end
+end
+
+
+function thread.getPriority(task)
+   return classNames[(task or currentTask).priority]
+end
+
+
+function thread.taskStats(task)
+   task = task or currentTask
+   return {
+      priority = classNames[task.priority],
+      runs = task.runs,
+      time = task.runTime,
+      max = task.maxRun,
+   }
+end
+
+
+-- Return an array of the unfinished tasks in the current dispatch context.
+--
+function thread.tasks()
+   local tasks = {}
+   for task in pairs(currentTask.dispatch.all) do
+      tasks[#tasks+1] = task
+   end
+   return tasks
+end
+
+
+----------------------------------------------------------------
+-- Idle-time garbage collection
+----------------------------------------------------------------
+
+-- Configuration; see thread.txt.
+thread.gc = {
+   mode = "incremental",  -- "incremental", "generational", or "idle"
+   budget = 0.002,        -- maximum seconds of GC per idle period
+   stepSize = 8,          -- argument to collectgarbage("step")
+   threshold = 1.5,       -- heap growth that starts an idle-time cycle
+   limit = 4,             -- heap growth that forces a step ("idle" mode)
+   clock = xpio.gettime,  -- measures the budget
+}
+
+-- number of active dispatch loops, and the mode set by the outermost one
+local dispatchDepth = 0
+local gcMode
+
+
+local function gcEnter()
+   dispatchDepth = dispatchDepth + 1
+   if dispatchDepth == 1 then
+      gcMode = thread.gc.mode
+      if gcMode == "generational" then
+         collectgarbage("generational")
+      elseif gcMode == "idle" then
+         collectgarbage("stop")
+      end
+   end
+end
+
+
+local function gcLeave()
+   dispatchDepth = dispatchDepth - 1
+   if dispatchDepth == 0 then
+      if gcMode == "generational" then
+         collectgarbage("incremental")
+      elseif gcMode == "idle" then
+         collectgarbage("restart")
+      end
+   end
+end
+
+
+-- Run GC steps for up to `budget` seconds, or until the current cycle
+-- completes.
+--
+local function gcSlice(stats, budget, tStart)
+   local cfg = thread.gc
+   local tEnd = tStart + budget
+   local t
+   repeat
+      stats.steps = stats.steps + 1
+      if collectgarbage("step", cfg.stepSize) then
+         stats.cycles = stats.cycles + 1
+         stats.active = false
+         stats.base = collectgarbage("count")
+         t = cfg.clock()
+         break
+      end
+      t = cfg.clock()
+   until t >= tEnd
+
+   -- Allocate a large block, so that the C allocator consolidates the
+   -- small blocks freed by this slice now (glibc does so on the next large
+   -- request), instead of during whatever task next needs a large block.
+   local _ = string.rep(" ", 4096)
+
+   local elapsed = t - tStart
+   stats.slices = stats.slices + 1
+   stats.time = stats.time + elapsed
+   if elapsed > stats.max then
+      stats.max = elapsed
+   end
+end
+
+
+-- Perform idle-time collection before blocking for up to `timeout`
+-- seconds (nil => no timeout).  A cycle is started when the heap has grown
+-- by `threshold` since the last cycle completed, and then continued in
+-- later idle periods until it completes.
+--
+local function gcIdle(stats, timeout)
+   local cfg = thread.gc
+   local budget = math.min(cfg.budget, timeout or math.huge)
+   if budget <= 0 then
+      return
+   end
+   if not stats.active then
+      -- The heap shrinks when the automatic collector completes a cycle,
+      -- so the smallest size seen approximates the live data.
+      local kb = collectgarbage("count")
+      if kb < stats.base * cfg.threshold then
+         stats.base = math.min(stats.base, kb)
+         return
+      end
+      stats.active = true
+   end
+   gcSlice(stats, budget, cfg.clock())
+end
+
+
+-- In "idle" mode, the collector only runs when we call it.  Step anyway
+-- when the heap has grown by `limit` without an idle period.
+--
+local function gcCheckLimit(stats)
+   local cfg = thread.gc
+   if gcMode == "idle" and collectgarbage("count") > stats.base * cfg.limit then
+      stats.forced = stats.forced + 1
+      stats.active = true
+      gcSlice(stats, cfg.budget, cfg.clock())
+   end
+end
+
+
 -- Create a new "dispatch" (dispatching context)
 --
 local function newDispatch()
    local me = {}
-   local ready = Queue:new()
+   local ready = {}   -- ready[class] = queue of tasks
    local sleepers = Heap:new()
    local tq = xpio.tqueue()
 
+   for c = 1, #classNames do
+      ready[c] = Queue:new()
+   end
+
+   -- Count of dispatch loop iterations.  Tasks made ready during an
+   -- iteration are run in the next one.
+   local iteration = 0
+
    me.all = {}  -- all unfinished tasks
 
    me._queue = tq
 
+   -- GC statistics (see thread.gcStats)
+   me.gcStats = {
+      slices = 0, steps = 0, forced = 0, cycles = 0, time = 0, max = 0,
+      active = false, base = collectgarbage("count")
+   }
+
    local function dqQueue(task)
       task._dequeuedata:remove(task)
       task._dequeuedata = nil
       task._dequeue = nil
    end
 
+   me.dqQueue = dqQueue
+
    function me.makeReady(task)
       assert(not task._dequeue)
+      local q = ready[task.priority]
       task._dequeue = dqQueue
-      task._dequeuedata = ready
-      ready:put(task)
+      task._dequeuedata = q
+      task._readyIteration = iteration
+      q:put(task)
+   end
+
+   local function anyReady()
+      for c = 1, #ready do
+         if ready[c]:first() then
+            return true
+         end
+      end
+      return false
    end
 
    local function dqSleeper(task)
@@ -212,43 +424,97 @@ local function newDispatch()
 
 
    function me:dtor()
+      for c = 1, #ready do
+         while true do
+            local t = ready[c]:first()
+            if not t then break end
+            taskDelete(t)
+         end
+      end
+   end
+
+
+   -- Run tasks in queue `q` that were ready before this iteration.  After
+   -- the first task, stop when `budget` seconds have elapsed since
+   -- `tStart`.  Returns the time after the last task ran.
+   --
+   local function runQueue(q, budget, tStart)
+      local t0 = tStart
+      local count = 0
       while true do
-         local t = ready:first()
-         if not t then break end
-         taskDelete(t)
+         local task = q:first()
+         if not task or task._readyIteration >= iteration
+            or budget and count > 0 and t0 - tStart >= budget
+         then
+            return t0
+         end
+         count = count + 1
+
+         -- dequeue (see dqQueue)
+         q:get()
+         task._dequeuedata = nil
+         task._dequeue = nil
+
+         currentTask = task
+         xpio.setCurrentTask(task)
+
+         local succ, err = coroutine.resume(task.coroutine)
+
+         local t1 = xpio.gettime()
+         local elapsed = t1 - t0
+         task.runs = task.runs + 1
+         task.runTime = task.runTime + elapsed
+         if elapsed > task.maxRun then
+            task.maxRun = elapsed
+         end
+         t0 = t1
+
+         if not succ then
+            gcLeave()
+            me:dtor()
+            local msg = ("*** Uncaught error in thread:\n\t" .. tostring(err)):gsub("\n(.)", "\n | %1")
+            error(msg, 0)
+         end
       end
    end
 
 
    function me:dispatch()
       local thisTask = currentTask
-      local run = Queue:new()
+      local gcStats = me.gcStats
+      local budget = thread.budget
+
+      gcEnter()
 
       while true do
          --printf("%d readers, %d writers, %d sleepers\n",
          --     count(readers), count(writers), #sleepers, ready:length())
 
-         -- Move ready tasks to the run queue, and then run them. During
-         -- this time, any tasks placed on the ready queue will be run in
-         -- the next iteration.
-
-         run, ready = ready, run
-         while true do
-            currentTask = run:first()
-            xpio.setCurrentTask(currentTask)
-            if not currentTask then break end
-            currentTask:_dequeue()
-
-            local succ, err = coroutine.resume(currentTask.coroutine)
-            if not succ then
-               me:dtor()
-               local msg = ("*** Uncaught error in thread:\n\t" .. tostring(err)):gsub("\n(.)", "\n | %1")
-               error(msg, 0)
+         -- Run ready tasks, highest class first.  Any tasks placed on a
+         -- ready queue during this time will be run in the next
+         -- iteration, as will tasks left over when a budget runs out.
+
+         iteration = iteration + 1
+         local t = xpio.gettime()
+         for c = 1, #ready do
+            local q = ready[c]
+            if q:first() then
+               -- Each class is charged only for its own tasks.
+               t = runQueue(q, budget[classNames[c]], t)
             end
          end
+         currentTask = nil
+         xpio.setCurrentTask(nil)
+
+         gcCheckLimit(gcStats)
 
          local s = sleepers:first()
-         local timeout = ready:first() and 0 or s and s.timeDue - xpio.gettime()
+         local timeout = anyReady() and 0 or s and s.timeDue - xpio.gettime()
+         if timeout ~= 0 and (s or not tq:isEmpty()) then
+            -- We would block, so collect garbage first.
+            gcIdle(gcStats, timeout)
+            timeout = s and math.max(0, s.timeDue - xpio.gettime())
+         end
          local tasks = tq:wait(timeout)
 
          --printf("wait(%s) ->%s\n", tostring(timeout), tasks and #tasks or "nil")
@@ -257,7 +523,7 @@ local function newDispatch()
             for _, task in ipairs(tasks) do
                task:makeReady()
             end
-         elseif not ready:first() then
+         elseif not anyReady() then
             -- nothing to wait on
             break
          end
@@ -274,6 +540,7 @@ local function newDispatch()
          end
       end
 
+      gcLeave()
       currentTask = thisTask
       xpio.setCurrentTask(currentTask)
    end
@@ -298,6 +565,20 @@ function thread.dispatch(func, ...)
 end
 
 
+function thread.gcStats()
+   local stats = currentTask.dispatch.gcStats
+   return {
+      slices = stats.slices,
+      steps = stats.steps,
+      forced = stats.forced,
+      cycles = stats.cycles,
+      time = stats.time,
+      max = stats.max,
+      mean = stats.slices > 0 and stats.time / stats.slices or 0,
+   }
+end
+
+
 function thread.sleepUntil(t)
    currentTask.dispatch.wakeAt(currentTask, t)
    coroutine.yield()
@@ -309,4 +590,111 @@ function thread.sleep(delay)
 end
 
 
+-- A Timer stands in for a task in the sleepers heap while the task waits
+-- in thread.waitUntil().  When it comes due, it wakes the task if the task
+-- is still waiting.
+--
+local Timer = {}
+Timer.__index = Timer
+
+function Timer:makeReady()
+   local task = self.task
+   if task._dequeue == self.dequeue then
+      self.expired = true
+      task:_dequeue()
+      task:makeReady()
+   end
+end
+
+
+-- Block until woken by the event registered by `when(obj, task)` (e.g.
+-- `socket.when_read`), or until time `timeDue`, whichever comes first.
+-- Returns true if the event occurred, or false on timeout.
+--
+function thread.waitUntil(timeDue, when, obj)
+   local task = currentTask
+   when(obj, task)
+   if not timeDue then
+      coroutine.yield()
+      return true
+   end
+
+   local ioDequeue = task._dequeue
+   local timer = setmetatable({ task = task }, Timer)
+
+   -- Dequeuing the task (e.g. when it is killed) also cancels the timer.
+   function timer.dequeue(t)
+      ioDequeue(t)
+      if timer._dequeue then
+         timer:_dequeue()
+      end
+   end
+   task._dequeue = timer.dequeue
+
+   task.dispatch.wakeAt(timer, timeDue)
+   coroutine.yield()
+   if timer._dequeue then
+      timer:_dequeue()
+   end
+   return not timer.expired
+end
+
+
+-- A Waiter stands in for a task that waits in thread.waitAny().  The
+-- first waiter to be made ready records its index, cancels the others,
+-- and wakes the task.
+--
+local Waiter = {}
+Waiter.__index = Waiter
+
+function Waiter:makeReady()
+   local task = self.task
+   if task._dequeue == self.dequeue then
+      self.result.index = self.index
+      task:_dequeue()
+      task:makeReady()
+   end
+end
+
+
+-- Block until one of a number of events occurs, or until time `timeDue`.
+-- `whens` is an array of {when, obj} pairs, each describing an event as
+-- in thread.waitUntil().  Returns the index of the first event to occur,
+-- or nil on timeout.
+--
+function thread.waitAny(timeDue, whens)
+   local task = currentTask
+   local waiters = {}
+   local result = {}
+
+   local function dequeue(t)
+      t._dequeue = nil
+      for _, w in ipairs(waiters) do
+         if w._dequeue then
+            w:_dequeue()
+         end
+      end
+   end
+
+   local function newWaiter(index)
+      local w = setmetatable({ task = task, result = result, index = index,
+                               dequeue = dequeue, _queue = task._queue },
+                             Waiter)
+      waiters[#waiters+1] = w
+      return w
+   end
+
+   for ndx, pair in ipairs(whens) do
+      pair[1](pair[2], newWaiter(ndx))
+   end
+   if timeDue then
+      task.dispatch.wakeAt(newWaiter(nil), timeDue)
+   end
+
+   task._dequeue = dequeue
+   coroutine.yield()
+   return result.index
+end
+
+
 return thread
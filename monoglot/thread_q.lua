@@ -194,3 +194,210 @@ local t = xpio.gettime()
 run( {1, 3, 5}, ts1 )
 assert(xpio.gettime() >= t + 0.05)
 
+
+-- >> waitUntil returns when the event occurs or the time passes; killing a
+--    waiting thread cancels its timer.
+
+local function tw1()
+   local r, w = xpio.socketpair()
+   local t0 = xpio.gettime()
+
+   -- time passes
+   log(thread.waitUntil(t0 + 0.02, r.when_read, r))
+   assert(xpio.gettime() >= t0 + 0.02)
+
+   -- event occurs
+   thread.new(function () thread.sleep(0.01) ; w:try_write("x") end)
+   log(thread.waitUntil(xpio.gettime() + 10, r.when_read, r))
+   log(r:try_read(10))
+
+   -- no time limit
+   w:try_write("y")
+   log(thread.waitUntil(nil, r.when_read, r))
+
+   -- killed while waiting
+   local t = thread.new(thread.waitUntil, xpio.gettime() + 10, r.when_read, r)
+   thread.yield()
+   thread.kill(t)
+end
+
+t = xpio.gettime()
+run( {false, true, "x", true}, tw1 )
+assert(xpio.gettime() < t + 1)
+
+
+
+-- >> waitAny returns the index of the first event to occur, or nil on
+--    timeout; the other waits are cancelled.
+
+local function twa()
+   local r1, w1 = xpio.socketpair()
+   local r2, w2 = xpio.socketpair()
+   local whens = { {r1.when_read, r1}, {r2.when_read, r2} }
+
+   log(thread.waitAny(xpio.gettime() + 0.01, whens) or "timeout")
+
+   thread.new(function () thread.sleep(0.01) ; w2:try_write("x") end)
+   log(thread.waitAny(nil, whens))
+
+   -- waits were cancelled, so the sockets can be waited on again
+   w1:try_write("y")
+   log(thread.waitAny(xpio.gettime() + 10, whens))
+   log(r1:read(10))
+
+   local t = thread.new(thread.waitAny, xpio.gettime() + 10, whens)
+   thread.yield()
+   thread.kill(t)
+end
+
+run( {"timeout", 2, 1, "y"}, twa )
+
+
+
+-- >> Ready tasks run highest class first; new tasks inherit the class of
+--    their creator.
+
+local function tp1()
+   local function logPriority(name)
+      log(name .. "=" .. thread.getPriority())
+   end
+   local b = thread.new(function ()
+      logPriority("b")
+      thread.new(logPriority, "b2")
+   end)
+   local i = thread.new(logPriority, "i")
+   local s = thread.new(logPriority, "s")
+   thread.setPriority("batch", b)
+   thread.setPriority("system", s)
+   assert(not pcall(thread.setPriority, "bogus"))
+end
+
+run( {"s=system", "i=interactive", "b=batch", "b2=batch"}, tp1 )
+
+
+-- >> Lower classes are limited to a time budget in each iteration, but at
+--    least one task in each class runs.
+
+local function spin(name, seconds)
+   local t = xpio.gettime() + seconds
+   repeat until xpio.gettime() >= t
+   log(name)
+end
+
+local function tp2()
+   for _, name in ipairs{"A", "B", "C"} do
+      thread.setPriority("batch", thread.new(spin, name, 0.004))
+   end
+   thread.new(function ()
+      for _ = 1, 3 do
+         log("i")
+         thread.yield()
+      end
+   end)
+end
+
+local savedBudget = thread.budget.batch
+thread.budget.batch = 0.002
+run( {"i", "A", "i", "B", "i", "C"}, tp2 )
+thread.budget.batch = math.huge
+run( {"i", "A", "B", "C", "i", "i"}, tp2 )
+thread.budget.batch = savedBudget
+
+
+-- >> A class's budget is not charged for time spent in higher classes.
+
+local function tp4()
+   thread.setPriority("system", thread.new(function ()
+      for _ = 1, 3 do
+         spin("s", 0.01)
+         thread.yield()
+      end
+   end))
+   for _, name in ipairs{"A", "B"} do
+      thread.setPriority("batch", thread.new(log, name))
+   end
+end
+
+thread.budget.batch = 0.005
+run( {"s", "A", "B", "s", "s"}, tp4 )
+thread.budget.batch = savedBudget
+
+
+-- >> Run time is accounted per task.
+
+local function tp3()
+   local t = thread.new(spin, "x", 0.01)
+   local found = false
+   for _, task in ipairs(thread.tasks()) do
+      found = found or task == t
+   end
+   log(found)
+   thread.join(t)
+   local stats = thread.taskStats(t)
+   log(stats.runs)
+   assert(stats.time >= 0.01 and stats.max >= 0.01 and stats.max <= stats.time)
+   log(stats.priority)
+end
+
+run( {true, "x", 1, "interactive"}, tp3 )
+
+
+-- >> Collect garbage while idle, and restore the collector afterwards.
+
+local function churn(n)
+   local t = {}
+   for ii = 1, n do
+      t[ii] = { ii }
+   end
+end
+
+local function gcIdle()
+   local stats
+   -- Whether a given idle period completes a cycle depends on how far the
+   -- automatic collector has progressed, so continue until one does.
+   for _ = 1, 200 do
+      churn(20000)
+      thread.sleep(0.002)
+      stats = thread.gcStats()
+      if stats.cycles > 0 then
+         break
+      end
+   end
+   assert(stats.slices > 0 and stats.cycles > 0)
+   assert(stats.max >= stats.mean and stats.time >= stats.max)
+   -- The simulated clock advances one tick per reading, so each slice
+   -- takes at most budget/tick steps.
+   assert(stats.steps <= stats.slices * 4)
+   assert(stats.max <= thread.gc.budget + 1e-9)
+   log(stats.forced)
+end
+
+-- simulated clock for thread.gc: advances 1/4 of the budget per reading
+local ticks = 0
+thread.gc.clock = function ()
+   ticks = ticks + 1
+   return ticks * thread.gc.budget / 4
+end
+run( {0}, gcIdle )
+thread.gc.clock = xpio.gettime
+assert(collectgarbage("isrunning"))
+
+
+-- >> In "idle" mode the collector is stopped except when idle, but steps
+--    are forced when the heap grows by `limit`.
+
+local function gcForced()
+   assert(not collectgarbage("isrunning"))
+   for _ = 1, 20 do
+      churn(20000)
+      thread.yield()
+   end
+   local stats = thread.gcStats()
+   assert(stats.forced > 0)
+   log(stats.slices >= stats.forced)
+end
+
+thread.gc.mode = "idle"
+run( {true}, gcForced )
+thread.gc.mode = "incremental"
+assert(collectgarbage("isrunning"))
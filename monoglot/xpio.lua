@@ -53,6 +53,65 @@ function Socket:read(amt)
 end
 
 
+-- Receive one datagram.
+--
+function Socket:recvfrom(size)
+   repeat
+      local data, addr = self:try_recvfrom(size)
+      if data then
+         return data, addr
+      elseif addr ~= "retry" then
+         return nil, addr
+      end
+      yield( self:when_read(currentTask) )
+   until false
+end
+
+
+function Socket:sendto(data, addr)
+   repeat
+      local num, err = self:try_sendto(data, addr)
+      if num or err ~= "retry" then
+         return num, err
+      end
+      yield( self:when_write(currentTask) )
+   until false
+end
+
+
+-- Receive at least one and at most `count` datagrams.
+--
+function Socket:recvmany(count, size)
+   repeat
+      local datas, addrs = self:try_recvmany(count, size)
+      if datas then
+         return datas, addrs
+      elseif addrs ~= "retry" then
+         return nil, addrs
+      end
+      yield( self:when_read(currentTask) )
+   until false
+end
+
+
+-- Send *all* of the datagrams before returning.
+--
+function Socket:sendmany(datas, addrs)
+   local sent = 0
+   while sent < #datas do
+      local num, err = self:try_sendmany(datas, addrs, sent + 1)
+      if num then
+         sent = sent + num
+      elseif err ~= "retry" then
+         return nil, err
+      else
+         yield( self:when_write(currentTask) )
+      end
+   end
+   return sent
+end
+
+
 function Socket:connect(...)
    repeat
       local succ, err = self:try_connect(...)
@@ -10,6 +10,7 @@
 #define _GNU_SOURCE // on Linux, _POSIX_C_SOURCE does not pull in waitpid()
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/types.h>
@@ -18,6 +19,7 @@
 #include <sys/wait.h>
 #include <sys/errno.h>
 #include <sys/socket.h>
+#include <sys/uio.h>    // struct iovec
 #include <sys/resource.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>  // TCP_NODELAY
@@ -44,6 +46,11 @@
 
 #define ZERO_REC(r)  (memset(&(r), 0, sizeof (r)))
 
+// recvmmsg() and sendmmsg() transfer several datagrams in one system call.
+#if defined(__linux__)
+#  define HAVE_MMSG 1
+#endif
+
 #define SLL_DEQUEUE(ptr, head, T, next)                  \
    {  T **__pp = &(head);                                \
       for (;*__pp; __pp = &(*__pp)->next) {              \
@@ -919,7 +926,7 @@ static int xpproc_try_wait(lua_State *L)
       return 2;
    } else if (WIFSIGNALED(me->status)) {
       lua_pushstring(L, "signal");
-      lua_pushinteger(L, WSTOPSIG(me->status));
+      lua_pushinteger(L, WTERMSIG(me->status));
       return 2;
    } else {
       // exit status not ready
@@ -1010,6 +1017,10 @@ static int xpsocket_try_connect(lua_State *L);
 static int xpsocket_try_accept(lua_State *L);
 static int xpsocket_try_read(lua_State *L);
 static int xpsocket_try_write(lua_State *L);
+static int xpsocket_try_recvfrom(lua_State *L);
+static int xpsocket_try_sendto(lua_State *L);
+static int xpsocket_try_recvmany(lua_State *L);
+static int xpsocket_try_sendmany(lua_State *L);
 static int xpsocket_when_read(lua_State *L);
 static int xpsocket_when_write(lua_State *L);
 static int xpsocket_bind(lua_State *L);
@@ -1028,6 +1039,10 @@ static const luaL_Reg XPSocket_regs[] = {
    {"try_accept", xpsocket_try_accept},
    {"try_read", xpsocket_try_read},
    {"try_write", xpsocket_try_write},
+   {"try_recvfrom", xpsocket_try_recvfrom},
+   {"try_sendto", xpsocket_try_sendto},
+   {"try_recvmany", xpsocket_try_recvmany},
+   {"try_sendmany", xpsocket_try_sendmany},
    {"when_read", xpsocket_when_read},
    {"when_write", xpsocket_when_write},
    {"bind", xpsocket_bind},
@@ -1247,6 +1262,287 @@ static int xpsocket_try_write(lua_State *L)
 }
 
 
+//--------------------------------
+// datagrams
+//--------------------------------
+
+// Default maximum size of a received datagram.  Larger datagrams are
+// truncated.
+#define DGRAM_SIZE  2048
+
+// Maximum number of datagrams transferred by one call to try_recvmany() or
+// try_sendmany().
+#define DGRAM_BATCH 64
+
+
+// Push the address of a datagram's sender, or `false` if it is not an
+// IPv4 address (e.g. the peer of a UNIX-domain socket).
+//
+static void pushAddr(lua_State *L, struct sockaddr_in *psin, socklen_t len)
+{
+   unsigned char *pby = (unsigned char *) &psin->sin_addr;
+
+   if (len < sizeof *psin || psin->sin_family != AF_INET) {
+      lua_pushboolean(L, 0);
+      return;
+   }
+   lua_pushfstring(L, "%d.%d.%d.%d:%d",
+                   (int) pby[0],
+                   (int) pby[1],
+                   (int) pby[2],
+                   (int) pby[3],
+                   (int) (unsigned short) htons(psin->sin_port));
+}
+
+
+static size_t checkDgramSize(lua_State *L, int ndx)
+{
+   return lua_isnoneornil(L, ndx) ? DGRAM_SIZE : checkUInt(L, ndx);
+}
+
+
+// socket:try_recvfrom([size])  -->  data, addr
+//
+static int xpsocket_try_recvfrom(lua_State *L)
+{
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   size_t size = checkDgramSize(L, 2);
+   struct sockaddr_in sin;
+   socklen_t len = sizeof sin;
+   luaL_Buffer b;
+   ssize_t n;
+
+   char *pbuf = luaL_buffinitsize(L, &b, size);
+
+   ZERO_REC(sin);
+   n = recvfrom(me->s, pbuf, size, 0, (struct sockaddr *) &sin, &len);
+   if (n < 0) {
+      return pushError(L, isRetry(errno) ? "retry" : NULL);
+   }
+
+   // Unlike read(), zero indicates an empty datagram, not end of stream.
+   luaL_pushresultsize(&b, n);
+   pushAddr(L, &sin, len);
+   return 2;
+}
+
+
+// socket:try_sendto(data, [addr])  -->  size
+//
+static int xpsocket_try_sendto(lua_State *L)
+{
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   size_t size;
+   const char *data = luaL_checklstring(L, 2, &size);
+   struct sockaddr_in sin;
+   ssize_t n;
+
+   if (lua_isnoneornil(L, 3)) {
+      n = send(me->s, data, size, 0);
+   } else {
+      if (addrFromString(&sin, luaL_checkstring(L, 3))) {
+         return pushError(L, "xpio: mal-formed address");
+      }
+      n = sendto(me->s, data, size, 0, (struct sockaddr *) &sin, sizeof sin);
+   }
+   if (n < 0) {
+      return pushError(L, isRetry(errno) ? "retry" : NULL);
+   }
+
+   lua_pushinteger(L, n);
+   return 1;
+}
+
+
+// socket:try_recvmany(count, [size])  -->  datagrams, addrs
+//
+// Receive up to `count` datagrams (no more than DGRAM_BATCH) with one
+// system call where supported.  Returns "retry" only when no datagrams are
+// available.
+//
+static int xpsocket_try_recvmany(lua_State *L)
+{
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   unsigned count = checkUInt(L, 2);
+   size_t size = checkDgramSize(L, 3);
+   struct sockaddr_in sins[DGRAM_BATCH];
+   socklen_t lens[DGRAM_BATCH];
+   size_t sizes[DGRAM_BATCH];
+   char *buf;
+   int n, ii;
+
+   if (count > DGRAM_BATCH) {
+      count = DGRAM_BATCH;
+   } else if (count == 0) {
+      count = 1;
+   }
+
+   // Allocating the buffer as a userdata ensures it is freed if a Lua
+   // error occurs.
+   buf = (char *) lua_newuserdata(L, count * size + 1);
+   memset(sins, 0, count * sizeof sins[0]);
+
+#ifdef HAVE_MMSG
+   {
+      struct mmsghdr msgs[DGRAM_BATCH];
+      struct iovec iovs[DGRAM_BATCH];
+
+      memset(msgs, 0, count * sizeof msgs[0]);
+      for (ii = 0; ii < (int) count; ++ii) {
+         iovs[ii].iov_base = buf + ii * size;
+         iovs[ii].iov_len = size;
+         msgs[ii].msg_hdr.msg_iov = &iovs[ii];
+         msgs[ii].msg_hdr.msg_iovlen = 1;
+         msgs[ii].msg_hdr.msg_name = &sins[ii];
+         msgs[ii].msg_hdr.msg_namelen = sizeof sins[ii];
+      }
+
+      n = recvmmsg(me->s, msgs, count, 0, NULL);
+      for (ii = 0; ii < n; ++ii) {
+         sizes[ii] = msgs[ii].msg_len;
+         lens[ii] = msgs[ii].msg_hdr.msg_namelen;
+      }
+   }
+#else
+   for (n = 0; n < (int) count; ++n) {
+      ssize_t cb;
+      lens[n] = sizeof sins[n];
+      cb = recvfrom(me->s, buf + n * size, size, 0,
+                    (struct sockaddr *) &sins[n], &lens[n]);
+      if (cb < 0) {
+         break;
+      }
+      sizes[n] = cb;
+   }
+   if (n == 0) {
+      n = -1;
+   }
+#endif
+
+   if (n < 0) {
+      return pushError(L, isRetry(errno) ? "retry" : NULL);
+   }
+
+   lua_createtable(L, n, 0);
+   lua_createtable(L, n, 0);
+   for (ii = 0; ii < n; ++ii) {
+      lua_pushlstring(L, buf + ii * size, sizes[ii]);
+      lua_rawseti(L, -3, ii+1);
+      pushAddr(L, &sins[ii], lens[ii]);
+      lua_rawseti(L, -2, ii+1);
+   }
+   return 2;
+}
+
+
+// socket:try_sendmany(datagrams, [addrs], [first])  -->  count
+//
+// Send datagrams[first], datagrams[first+1], ... (at most DGRAM_BATCH of
+// them) with one system call where supported.  `addrs` is an array of
+// addresses corresponding to `datagrams`, a single address for all of
+// them, or nil (for connected sockets).  Returns the number sent, which
+// may be fewer than requested.
+//
+static int xpsocket_try_sendmany(lua_State *L)
+{
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   int first = lua_isnoneornil(L, 4) ? 1 : (int) checkUInt(L, 4);
+   int bAddrs = !lua_isnoneornil(L, 3);
+   int bAddrArray = lua_istable(L, 3);
+   struct sockaddr_in sins[DGRAM_BATCH];
+   const char *datas[DGRAM_BATCH];
+   size_t sizes[DGRAM_BATCH];
+   int count, n, ii;
+
+   luaL_checktype(L, 2, LUA_TTABLE);
+   if (first < 1) {
+      first = 1;
+   }
+   count = lengthOf(L, 2) - first + 1;
+   if (count > DGRAM_BATCH) {
+      count = DGRAM_BATCH;
+   } else if (count <= 0) {
+      lua_pushinteger(L, 0);
+      return 1;
+   }
+
+   if (bAddrs && !bAddrArray &&
+       addrFromString(&sins[0], luaL_checkstring(L, 3))) {
+      return pushError(L, "xpio: mal-formed address");
+   }
+
+   // Strings remain referenced by `datagrams` until we return.  Other
+   // types are rejected: lua_tolstring() would convert only the copy on
+   // the stack, leaving nothing to keep the result alive.
+   for (ii = 0; ii < count; ++ii) {
+      lua_rawgeti(L, 2, first + ii);
+      if (lua_type(L, -1) != LUA_TSTRING) {
+         return luaL_error(L, "xpio: datagram #%d is not a string", first + ii);
+      }
+      datas[ii] = lua_tolstring(L, -1, &sizes[ii]);
+      lua_pop(L, 1);
+
+      if (bAddrArray) {
+         const char *addr;
+         int bad;
+         lua_rawgeti(L, 3, first + ii);
+         addr = lua_tostring(L, -1);
+         bad = !addr || addrFromString(&sins[ii], addr);
+         lua_pop(L, 1);
+         if (bad) {
+            return pushError(L, "xpio: mal-formed address");
+         }
+      } else if (ii > 0) {
+         sins[ii] = sins[0];
+      }
+   }
+
+#ifdef HAVE_MMSG
+   {
+      struct mmsghdr msgs[DGRAM_BATCH];
+      struct iovec iovs[DGRAM_BATCH];
+
+      memset(msgs, 0, count * sizeof msgs[0]);
+      for (ii = 0; ii < count; ++ii) {
+         // sendmmsg() does not modify the data
+         iovs[ii].iov_base = (void *) (uintptr_t) datas[ii];
+         iovs[ii].iov_len = sizes[ii];
+         msgs[ii].msg_hdr.msg_iov = &iovs[ii];
+         msgs[ii].msg_hdr.msg_iovlen = 1;
+         if (bAddrs) {
+            msgs[ii].msg_hdr.msg_name = &sins[ii];
+            msgs[ii].msg_hdr.msg_namelen = sizeof sins[ii];
+         }
+      }
+      n = sendmmsg(me->s, msgs, count, 0);
+   }
+#else
+   for (n = 0; n < count; ++n) {
+      ssize_t cb;
+      if (bAddrs) {
+         cb = sendto(me->s, datas[n], sizes[n], 0,
+                     (struct sockaddr *) &sins[n], sizeof sins[n]);
+      } else {
+         cb = send(me->s, datas[n], sizes[n], 0);
+      }
+      if (cb < 0) {
+         break;
+      }
+   }
+   if (n == 0) {
+      n = -1;
+   }
+#endif
+
+   if (n < 0) {
+      return pushError(L, isRetry(errno) ? "retry" : NULL);
+   }
+
+   lua_pushinteger(L, n);
+   return 1;
+}
+
+
 static int xpsocket_shutdown(lua_State *L)
 {
    XPSocket *me = XLUA_CAST(L, 1, XPSocket);
@@ -1627,9 +1923,12 @@ static int xpio__spawn(lua_State *L)
    luaL_checktype(L, 3, LUA_TTABLE);
    luaL_checktype(L, 4, LUA_TTABLE);
 
+   // Create the process object (and install the SIGCHLD handler) before
+   // forking, so a child that exits right away is not missed.
+   XPProc *pproc = xpproc_new(L);
+
    pid_t pid = fork();
    if (pid) {
-      XPProc *pproc = xpproc_new(L);
       pproc->pid = pid;
       return 1;
    }
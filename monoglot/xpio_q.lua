@@ -237,6 +237,60 @@ do
 end
 
 
+-- datagrams
+
+do
+   local a = assert(xpio.socket("UDP"))
+   local b = assert(xpio.socket("UDP"))
+   assert(a:bind("127.0.0.1:0"))
+   assert(b:bind("127.0.0.1:0"))
+   local aAddr, bAddr = a:getsockname(), b:getsockname()
+
+   -- try_recvfrom retry
+   eq({b:try_recvfrom()}, {nil, "retry"})
+   eq({b:try_recvmany(8)}, {nil, "retry"})
+
+   -- try_sendto & try_recvfrom
+   eq(a:try_sendto("hello", bAddr), 5)
+   eq({retry(b.try_recvfrom, b)}, {"hello", aAddr})
+
+   -- empty datagrams; truncation
+   eq(a:try_sendto("", bAddr), 0)
+   eq(a:try_sendto("0123456789", bAddr), 10)
+   eq({retry(b.try_recvfrom, b, 100)}, {"", aAddr})
+   eq({retry(b.try_recvfrom, b, 4)}, {"0123", aAddr})
+
+   eq({a:try_sendto("x", "1.2.3.4.5")}, {nil, "xpio: mal-formed address"})
+
+   -- try_sendmany & try_recvmany
+   eq(a:try_sendmany({"a", "bb", "ccc"}, bAddr), 3)
+   eq(a:try_sendmany({"a", "bb", "ccc", "dddd"}, {bAddr, bAddr, bAddr, bAddr}, 4), 1)
+   eq(a:try_sendmany({"a"}, bAddr, 2), 0)
+   qt.assert(not pcall(a.try_sendmany, a, {"a", 2}, bAddr))
+   sleep(0.01)
+   eq({b:try_recvmany(3)}, { {"a", "bb", "ccc"}, {aAddr, aAddr, aAddr} })
+   eq({b:try_recvmany(10)}, { {"dddd"}, {aAddr} })
+
+   -- connected socket
+   assert(retry(a.try_connect, a, bAddr))
+   eq(a:try_sendto("conn"), 4)
+   eq(a:try_sendmany({"m1", "m2"}), 2)
+   sleep(0.01)
+   eq({b:try_recvmany(10)}, { {"conn", "m1", "m2"}, {aAddr, aAddr, aAddr} })
+
+   -- when_read
+   local queue = xpio.tqueue()
+   b:when_read{ _queue = queue, name = "b r" }
+   eq(a:try_sendto("ping"), 4)
+   local r = queue:wait(10)
+   eq(r[1].name, "b r")
+   eq({b:try_recvfrom()}, {"ping", aAddr})
+
+   a:close()
+   b:close()
+end
+
+
 -- pipes
 
 local function pipeTest()
@@ -356,6 +410,42 @@ end
 dispatch(testProcs)
 
 
+-- blocking datagram functions
+
+local function testDatagrams()
+   local a = assert(xpio.socket("UDP"))
+   local b = assert(xpio.socket("UDP"))
+   assert(a:bind("127.0.0.1:0"))
+   assert(b:bind("127.0.0.1:0"))
+   local aAddr, bAddr = a:getsockname(), b:getsockname()
+
+   local datas = {}
+   for n = 1, 100 do
+      datas[n] = "msg" .. n
+   end
+   eq(a:sendmany(datas, bAddr), 100)
+
+   local got = {}
+   while #got < 100 do
+      local ds, addrs = b:recvmany(32)
+      assert(#ds >= 1 and #ds <= 32)
+      eq(addrs[1], aAddr)
+      for _, d in ipairs(ds) do
+         got[#got+1] = d
+      end
+   end
+   eq(got, datas)
+
+   eq(a:sendto("last", bAddr), 4)
+   eq({b:recvfrom()}, {"last", aAddr})
+
+   a:close()
+   b:close()
+end
+
+dispatch(testDatagrams)
+
+
 local function testFDOpen()
    local f = xpio.fdopen(1)
    f:write("write via fdopen succeeded") -- TODO: automate this test
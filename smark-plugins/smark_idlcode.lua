@@ -92,15 +92,6 @@ local lexer = compile {
    ['wstring'  ] = 'keyword',
 }
 
-local append = table.insert
-
 return function(node, doc)
-   local E = require("smarklib").E
-   local styleMap = require("codestyle")
-   local t = {}
-   for k,v in lexer.gmatch(node.text) do
-      append(t, styleMap[k] and E.span{v, style=styleMap[k]} or v)
-   end
-   return E.pre(t)
+   return lexer.highlight(node.text)
 end
-
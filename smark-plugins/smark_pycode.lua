@@ -36,8 +36,10 @@ local float = (D^1 * P'.' * D^0 + P'.' * D^1) * (S'eE' * sign * D^1)^-1
 define('number', hexadecimal + float + decimal)
 
 -- Pattern for long strings and long comments.
-local longstring = #(P'[[' + (P'[' * P'=' ^ 0 * P'[')) * P(function(input, index)
-  local level = input:match('^%[(=*)%[', index)
+-- (The leading '[' is consumed by P'[' so that the pattern cannot match an
+-- empty string; see smarklex.tokenize.)
+local longstring = #(P'[[' + (P'[' * P'=' ^ 0 * P'[')) * P'[' * P(function(input, index)
+  local level = input:match('^(=*)%[', index)
   if level then
     local _, stop = input:find(']' .. level .. ']', index, true)
     if stop then return stop + 1 end
@@ -101,15 +103,6 @@ local lexer = compile {
   ['yield'   ] = 'keyword',
 }
 
-local append = table.insert
-
 return function(node, doc)
-   local E = require("smarklib").E
-   local styleMap = require("codestyle")
-   local t = {}
-   for k,v in lexer.gmatch(node.text) do
-      append(t, styleMap[k] and E.span{v, style=styleMap[k]} or v)
-   end
-   return E.pre(t)
+   return lexer.highlight(node.text)
 end
-
@@ -2,7 +2,13 @@ local lpeg = require 'lpeg'
 
 -- Lexing. {{{1
 
+-- Maximum number of code blocks to remember per lexer (see M.highlight).
+local MEMO_LIMIT = 1000
+
 -- Construct a context for defining a lexer using LPeg.
+--
+-- Lexers are compiled once, when the plugin module is loaded, and are
+-- then shared by all code blocks processed by that plugin.
 local function buildLexer(language)
 
   -- Table of LPeg patterns to match all kinds of tokens.
@@ -16,14 +22,31 @@ local function buildLexer(language)
     patterns[#patterns + 1] = name
   end
 
-  -- Return an iterator that produces (kind, text) on each iteration.
-  local any, keywords
+  -- `any` captures one (kind, text) pair; `all` captures every pair in a
+  -- string in a table: { kind1, text1, kind2, text2, ... }.
+  local any, all, keywords
+
+  -- Compile all patterns into a single pattern that captures a (kind, text) pair.
+  local function compile(_keywords)
+    local function id(n) return lpeg.Cc(n) * lpeg.C(patterns[n]) end
+    any = id(patterns[1])
+    for i = 2, #patterns do any = any + id(patterns[i]) end
+    -- LPeg rejects `any^0` when a token pattern may match an empty string;
+    -- in that case M.tokenize falls back to repeated matches.
+    local ok, patt = pcall(function() return lpeg.Ct(any^0) end)
+    all = ok and patt or nil
+    keywords = _keywords
+    return M
+  end
+
+  -- Return an iterator that produces (kind, text) on each iteration.  It
+  -- stops at the first position where no token (or only an empty one)
+  -- matches.
   function M.gmatch(sources)
     local index = 1
     return function()
-      if not any then any = compile() end
       local kind, text = any:match(sources, index)
-      if kind and text then
+      if kind and text and text ~= "" then
         index = index + #text
         if keywords then
           kind = keywords[text] or kind
@@ -33,13 +56,58 @@ local function buildLexer(language)
     end
   end
 
-  -- Compile all patterns into a single pattern that captures a (kind, text) pair.
-  local function compile(_keywords)
-    local function id(n) return lpeg.Cc(n) * lpeg.C(patterns[n]) end
-    any = id(patterns[1])
-    for i = 2, #patterns do any = any + id(patterns[i]) end
-    keywords = _keywords
-    return M
+  -- Return all tokens in `sources` in one array, as (kind, text) pairs:
+  -- { kind1, text1, kind2, text2, ... }.  The result is the same as
+  -- collecting the values from `gmatch`, but requires only one match.
+  function M.tokenize(sources)
+    local t
+    if all then
+      t = all:match(sources)
+    else
+      t = {}
+      local index = 1
+      while true do
+        local kind, text = any:match(sources, index)
+        if not (kind and text and text ~= "") then break end
+        local n = #t
+        t[n + 1], t[n + 2] = kind, text
+        index = index + #text
+      end
+    end
+    if keywords then
+      for i = 1, #t, 2 do
+        t[i] = keywords[t[i + 1]] or t[i]
+      end
+    end
+    return t
+  end
+
+  -- Return a PRE element that displays `sources` with styles from
+  -- codestyle.lua.  Results are remembered, so repeated code blocks are
+  -- lexed only once.
+  local memo, memoCount = {}, 0
+  function M.highlight(sources)
+    local E = require("smarklib").E
+    local children = memo[sources]
+    if not children then
+      local styleMap = require("codestyle")
+      local t = M.tokenize(sources)
+      children = {}
+      for i = 1, #t, 2 do
+        local k, v = t[i], t[i + 1]
+        children[#children + 1] = styleMap[k] and E.span{v, style=styleMap[k]} or v
+      end
+      if memoCount >= MEMO_LIMIT then
+        memo, memoCount = {}, 0
+      end
+      memo[sources] = children
+      memoCount = memoCount + 1
+    end
+
+    -- Each document node gets its own array of children.
+    local pre = {}
+    for i = 1, #children do pre[i] = children[i] end
+    return E.pre(pre)
   end
 
   -- Return the two functions.
@@ -50,4 +118,3 @@ end
 return {
    buildLexer = buildLexer,
 }
-
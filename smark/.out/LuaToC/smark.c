@@ -0,0 +1,8514 @@
+// Generated by cfromlua
+// lib: /root/repo/lpeg/.out/exports/lpeg.lib
+// lib: /root/repo/luau/.out/exports/textcodec_c.lib
+// lib: /root/repo/luau/.out/exports/xpfs.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "local markup=require\"markup\"\n"
+  "local getopts=require\"getopts\"\n"
+  "local errors=require\"errors\"\n"
+  "local htmlgen=require\"htmlgen\"\n"
+  "local defaultCSS=require\"defaultcss\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local smarkmisc=require\"smarkmisc\"\n"
+  "local serialize=require\"serialize\"\n"
+  "local Source=require\"source\"\n"
+  "local smarkcache=require\"smarkcache\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "local E=doctree.E\n"
+  "local fatal=smarkmisc.fatal\n"
+  "\n"
+  "local progname=(arg[0]or\"smark\"):match(\"([^/\\\\]*)$\")\n"
+  "\n"
+  "local versionStr=[[\n"
+  "smark 0.6\n"
+  "]]\n"
+  "\n"
+  "local function readFile(name)\n"
+  "return(assert(smarkmisc.readFile(name),\"exit: Could not read file: \"..name))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function setPath()\n"
+  "local sp=os.getenv(\"SMARK_PATH\")or\"\?.lua\"\n"
+  "package.path=sp:gsub(\";$\",\"\")..\";\"..package.path:gsub(\"^;\",\"\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function openForWrite(fileName)\n"
+  "local f=io.open(fileName,\"w\")\n"
+  "if not f then\n"
+  "fatal(\"Unable to open file %s for writing\",fileName)\n"
+  "end\n"
+  "return f\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function writeOutputs(opts,html,files)\n"
+  "\n"
+  "local fo=opts.out and io.stdout or openForWrite(opts.o)\n"
+  "fo:write(html)\n"
+  "fo:close()\n"
+  "\n"
+  "\n"
+  "if opts.deps then\n"
+  "local fd=openForWrite(opts.deps)\n"
+  "if files[1]then\n"
+  "\n"
+  "local deps=table.concat(files,\" \",2)\n"
+  "fd:write(opts.o..\": \"..deps..\"\\n\\n\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "for n=2,#files do\n"
+  "fd:write(files[n]..\":\\n\\n\")\n"
+  "end\n"
+  "fd:close()\n"
+  "end\n"
+  "\n"
+  "return 0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local usageStr=[=[\n"
+  "Usage: smark [options] [<infile> -o <outfile>]\n"
+  "\n"
+  "Options:\n"
+  "   --output=<file>\n"
+  "   -o <file>\n"
+  "       Write output to <file>.\n"
+  "   --out\n"
+  "       Write output to stdout.\n"
+  "   --in\n"
+  "       Read input from stdin.\n"
+  "   --deps=<file>\n"
+  "       Output a makefile that lists dependencies for the output file.\n"
+  "   --cache=<dir>\n"
+  "       Re-use output from a previous run when the input files, plugins,\n"
+  "       and options have not changed.  Cache entries are stored in <dir>.\n"
+  "   --css=<file>\n"
+  "       Incorporate CSS style sheet into generated document.\n"
+  "   --no-default-css\n"
+  "       Do not include the default CSS in the generated document.\n"
+  "   --error\n"
+  "       Treat warnings as errors.\n"
+  "   --help\n"
+  "   -h\n"
+  "       Show this message.\n"
+  "   --version\n"
+  "   -v\n"
+  "       Display version number and exit.\n"
+  "]=]\n"
+  "\n"
+  "\n"
+  "local optionSpec={\n"
+  "\"-h/--help\",\n"
+  "\"-o/--output=\",\n"
+  "\"--css=*\",\n"
+  "\"--no-default-css\",\n"
+  "\"-v/--version\",\n"
+  "\"--config=\",\n"
+  "\"--deps=\",\n"
+  "\"--cache=\",\n"
+  "\"--in\",\n"
+  "\"--out\",\n"
+  "\"--error\"\n"
+  "}\n"
+  "\n"
+  "local function main()\n"
+  "if arg[1]=='-e'then\n"
+  "\n"
+  "\n"
+  "table.remove(arg,1)\n"
+  "local fname=assert(table.remove(arg,1),\"-e: no file name given\")\n"
+  "return(assert(loadfile(fname)))()\n"
+  "end\n"
+  "\n"
+  "local names,opts=getopts.read(arg,optionSpec,\"exit\")\n"
+  "\n"
+  "local cntInFiles=#names+(opts[\"in\"]and 1 or 0)\n"
+  "local cntOutFiles=#{opts.o}+#{opts.out}\n"
+  "\n"
+  "if opts.h then\n"
+  "io.write(usageStr)\n"
+  "return\n"
+  "elseif opts.v then\n"
+  "io.write(versionStr)\n"
+  "return\n"
+  "elseif cntInFiles<1 then\n"
+  "fatal(\"Input file not specified.  Try '%s -h' for help.\",progname)\n"
+  "elseif cntInFiles>1 then\n"
+  "fatal(\"Multiple input files specified.  Try '%s -h' for help.\",progname)\n"
+  "elseif cntOutFiles<1 then\n"
+  "fatal(\"Output file not specified.  Try '%s -h' for help.\",progname)\n"
+  "elseif cntOutFiles>1 then\n"
+  "fatal(\"Output file *and* stdout specified.  Try '%s -h' for help.\",progname)\n"
+  "end\n"
+  "\n"
+  "local configEnv=setmetatable({},{__index=_G})\n"
+  "if opts.config then\n"
+  "local f=assert(loadfile(opts.config,nil,configEnv))\n"
+  "f()\n"
+  "end\n"
+  "\n"
+  "setPath()\n"
+  "\n"
+  "local data=opts[\"in\"]and io.read(\"*a\")\n"
+  "\n"
+  "\n"
+  "\n"
+  "local codeHash=opts.cache and smarkcache.hashCode()\n"
+  "local cacheKey=codeHash and smarkcache.hash(table.concat({\n"
+  "codeHash,\n"
+  "serialize.serialize(opts,nil,\"s\"),\n"
+  "os.getenv(\"SMARK_PATH\")or\"\",\n"
+  "data or\"\",\n"
+  "},\"\\0\"))\n"
+  "\n"
+  "local entry=cacheKey and smarkcache.lookup(opts.cache,opts.o or\"-\",cacheKey)\n"
+  "if entry then\n"
+  "return writeOutputs(opts,entry.html,entry.files)\n"
+  "end\n"
+  "\n"
+  "local modulesBefore={}\n"
+  "for name in pairs(package.loaded)do\n"
+  "modulesBefore[name]=true\n"
+  "end\n"
+  "\n"
+  "local source=Source:new():newFile(names[1],data)\n"
+  "local doctree=markup.parseDoc(source)\n"
+  "doctree=markup.expandDoc(doctree,configEnv)\n"
+  "\n"
+  "\n"
+  "local sheets={}\n"
+  "if not opts[\"no-default-css\"]then\n"
+  "sheets={defaultCSS}\n"
+  "end\n"
+  "for _,name in ipairs(opts.css or{})do\n"
+  "source:addFile(name)\n"
+  "table.insert(sheets,readFile(name))\n"
+  "end\n"
+  "local css=E.style{type=\"text/css\",table.concat(sheets,\"\\n\")}\n"
+  "table.insert(doctree,1,E.head{css})\n"
+  "\n"
+  "\n"
+  "table.insert(doctree,E.head{E.title{opts.o}})\n"
+  "\n"
+  "\n"
+  "if source.didWarn and opts.error then\n"
+  "return fatal(\"Warnings treated as errors\")\n"
+  "end\n"
+  "\n"
+  "local html=htmlgen.generateDoc(doctree)\n"
+  "\n"
+  "\n"
+  "if cacheKey and not source.didWarn and not doctree._uncacheable then\n"
+  "\n"
+  "local inputs={opts.config}\n"
+  "for name in pairs(package.loaded)do\n"
+  "local path=not modulesBefore[name]and smarkcache.modulePath(name)\n"
+  "if path then\n"
+  "table.insert(inputs,path)\n"
+  "end\n"
+  "end\n"
+  "table.sort(inputs)\n"
+  "for _,name in ipairs(source.files)do\n"
+  "table.insert(inputs,name)\n"
+  "end\n"
+  "\n"
+  "local deps=smarkcache.hashFiles(inputs)\n"
+  "if deps then\n"
+  "smarkcache.store(opts.cache,opts.o or\"-\",{\n"
+  "key=cacheKey,\n"
+  "deps=deps,\n"
+  "files=source.files,\n"
+  "html=html,\n"
+  "})\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return writeOutputs(opts,html,source.files)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local e=errors.catch(\"exit: (.*)\",main)\n"
+  "if e then\n"
+  "io.stderr:write(progname..\": \"..e.values[1]..\"\\n\")\n"
+  "end\n"
+  "return e and 1 or 0\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local smarkmisc=require\"smarkmisc\"\n"
+  "local lpeg=require\"lpeg\"\n"
+  "local htmlrefs=require\"htmlrefs\"\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "local Object=require\"object\"\n"
+  "local Source=require\"source\"\n"
+  "local Html2D=require\"html2d\"\n"
+  "local Svg2D=require\"svg2d\"\n"
+  "local doctree=require\"doctree\"\n"
+  "\n"
+  "local insert=table.insert\n"
+  "local E,TYPE=doctree.E,doctree.TYPE\n"
+  "local urlEncode=smarkmisc.urlEncode\n"
+  "\n"
+  "\n"
+  "local function iclone(tbl)\n"
+  "local o={}\n"
+  "for ndx,v in ipairs(tbl)do\n"
+  "o[ndx]=v\n"
+  "end\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local linePEG do\n"
+  "local P,S,R,C,Cp=lpeg.P,lpeg.S,lpeg.R,lpeg.C,lpeg.Cp\n"
+  "\n"
+  "\n"
+  "local function r12(...)\n"
+  "return R(...)*(R(...)+P\"\")\n"
+  "end\n"
+  "\n"
+  "local function oneOrTwo(c)return c*c^1 end\n"
+  "\n"
+  "local pNL=P\"\\n\"+\"\\n\"\n"
+  "local pTag=(C(S\"*-\")\n"
+  "+r12(\"AZ\")/\"A\"*\")\"\n"
+  "+r12(\"az\")/\"a\"*\")\"\n"
+  "+r12(\"09\",\"##\")/\"1\"*S\".)\"\n"
+  ")*P\" \"^1\n"
+  "\n"
+  "linePEG=P\" \"^0*Cp()*(pTag+C\"\")*Cp()*C((1-pNL)^0)*Cp()*pNL^-1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local LayoutNode=Object:new()\n"
+  "\n"
+  "function LayoutNode:__tostring()\n"
+  "if self.i then return nil end\n"
+  "return self.source.data:sub(self[1],self[2])\n"
+  "end\n"
+  "\n"
+  "function LayoutNode:isBlank()\n"
+  "return self[1]and self[1]==self[2]\n"
+  "end\n"
+  "\n"
+  "function LayoutNode:isBlock()\n"
+  "return self.i~=nil\n"
+  "end\n"
+  "\n"
+  "function LayoutNode:new(t)\n"
+  "return self:adopt(t or{})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function LayoutNode:match(pattern,init)\n"
+  "return self.source.data:match(pattern,(init and self[1]+init-1 or self[1]))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseLayout(source)\n"
+  "\n"
+  "local str=source.data\n"
+  "local Node=LayoutNode:new{source=source}\n"
+  "local parent={}\n"
+  "local top=Node:new{i=0}\n"
+  "local node=top\n"
+  "local ndx=1\n"
+  "\n"
+  "\n"
+  "local function nest(p,tag,tagi)\n"
+  "local i=p-ndx\n"
+  "while i<node.i do\n"
+  "node=parent[node]\n"
+  "end\n"
+  "if node.i==i and node.tag~=tag then\n"
+  "node=parent[node]\n"
+  "end\n"
+  "if i>node.i then\n"
+  "local t=Node:new{i=i,tag=tag,tagi=tagi and tagi-ndx}\n"
+  "parent[t]=node\n"
+  "insert(node,t)\n"
+  "node=t\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "while ndx<=#str do\n"
+  "local p0,tag,p1,txt,p2=linePEG:match(str,ndx)\n"
+  "if txt~=\"\"then\n"
+  "if tag~=\"\"then\n"
+  "nest(p1-0.5,tag,p0)\n"
+  "end\n"
+  "nest(p1)\n"
+  "elseif tag~=\"\"then\n"
+  "Node.source:warn(p0,'ignoring list tag \"%s\" with empty paragraph',\n"
+  "str:match(\"[^ ]*\",p0))\n"
+  "end\n"
+  "\n"
+  "insert(node,Node:new{p1,p2})\n"
+  "ndx=p2+1\n"
+  "end\n"
+  "\n"
+  "return top\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function makeLocalLink(node,doc)\n"
+  "local u=urlEncode(node.link)\n"
+  "if not doc.anchors[u]then\n"
+  "doc:warn(node,0,\"Missing target for link '%s'\",node.link)\n"
+  "end\n"
+  "\n"
+  "local elem=iclone(node)\n"
+  "elem[TYPE]=\"a\"\n"
+  "elem.href=\"#\"..u\n"
+  "return elem\n"
+  "end\n"
+  "\n"
+  "local function expandLocalLink(node)\n"
+  "node.expand=makeLocalLink\n"
+  "return E._defer{node}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local parseInline do\n"
+  "local P,S,C,R,V=lpeg.P,lpeg.S,lpeg.C,lpeg.R,lpeg.V\n"
+  "local Cb,Cc,Cp,Cs,Ct,Cg,Cmt=lpeg.Cb,lpeg.Cc,lpeg.Cp,lpeg.Cs,\n"
+  "lpeg.Ct,lpeg.Cg,lpeg.Cmt\n"
+  "\n"
+  "\n"
+  "local currentSource\n"
+  "local inquote=false\n"
+  "\n"
+  "local spcChar=S\" \\n\"\n"
+  "local spc=spcChar^0\n"
+  "local lit=spcChar^1/\" \"+1\n"
+  "local alnum=R(\"AZ\",\"az\",\"09\")\n"
+  "\n"
+  "\n"
+  "local utf8Char=(R\"\\0\\127\"+\n"
+  "R\"\\194\\223\"*R\"\\128\\191\"+\n"
+  "P\"\\224\"*R\"\\160\\191\"*R\"\\128\\191\"+\n"
+  "R\"\\225\\239\"*R\"\\128\\191\"*R\"\\128\\191\"+\n"
+  "P\"\\240\"*R\"\\144\\191\"*R\"\\128\\191\"*R\"\\128\\191\"+\n"
+  "R\"\\240\\243\"*R\"\\128\\191\"*R\"\\128\\191\"*R\"\\128\\191\"+\n"
+  "P\"\\244\"*R\"\\128\\143\"*R\"\\128\\191\"*R\"\\128\\191\")\n"
+  "\n"
+  "local uchar=utf8utils.encode\n"
+  "\n"
+  "local function mtNonUTF(s,i,match)\n"
+  "currentSource:warn(i-#match,\"invalid UTF-8 character; assuming ISO-Latin-1\")\n"
+  "return true,uchar(match:byte())\n"
+  "end\n"
+  "local litChar=C(utf8Char)+Cmt(C(1),mtNonUTF)\n"
+  "\n"
+  "\n"
+  "local function mtWarn(s,i,match)\n"
+  "currentSource:warn(i-#match,\n"
+  "\"unbalanced/unescaped markup symbol: %s\",\n"
+  "match:gsub(\"[ \\n]$\",\"\"))\n"
+  "return true,match\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function catStrings(t)\n"
+  "local o=1\n"
+  "for i=2,#t do\n"
+  "local s=t[i]\n"
+  "t[i]=nil\n"
+  "if type(s)==\"string\"and type(t[o])==\"string\"then\n"
+  "t[o]=t[o]..s\n"
+  "else\n"
+  "o=o+1\n"
+  "t[o]=s\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function mkNode(t,typ)\n"
+  "catStrings(t)\n"
+  "t[TYPE]=typ\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function atCap(s,i,cap)\n"
+  "return s:sub(i,i+#cap-1)==cap and i+#cap\n"
+  "end\n"
+  "local codeEnd=Cmt(Cb\"code\",atCap)\n"
+  "local code=(Cg(P'`'^1,\"code\")*spcChar^-1\n"
+  "*Ct(Cs((lit-spcChar^-1*codeEnd)^1))*spcChar^-1\n"
+  "*codeEnd*Cc\"code\"/mkNode)\n"
+  "+Cmt(P\"`\",mtWarn)\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function mkRef(i,s)\n"
+  "local n=htmlrefs[s]or\n"
+  "tonumber(s:match(\"^#(%d+)$\")or\"\")or\n"
+  "tonumber(s:match(\"^#[xX](%x+)$\")or\"\",16)\n"
+  "if not n then\n"
+  "currentSource:warn(i-1,\"unrecognized entity reference: &%s;\",s)\n"
+  "return\"&\"..s..\";\"\n"
+  "end\n"
+  "return uchar(n)\n"
+  "end\n"
+  "\n"
+  "local function atDQ()\n"
+  "inquote=not inquote\n"
+  "return uchar(inquote and 0x201C or 0x201D)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function atBR(s,i,n)\n"
+  "return true,E.br{}\n"
+  "end\n"
+  "local linebreak=\"\\\\\"*P\" \"^0*Cmt(\"\\n\"+P(-1),atBR)*spc\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function atMacro(s,i,name,pos)\n"
+  "local subsrc=currentSource:extract(pos-1-#name,{{pos,i-2}})\n"
+  "return true,E._macro{macro=name,_source=subsrc,text=subsrc.data}\n"
+  "end\n"
+  "local mname=alnum^1\n"
+  "local mtext=P{\n"
+  "(lit-S\"{}\"+V\"matched\")^0,\n"
+  "matched=P\"{\"*V(1)*P\"}\"\n"
+  "}\n"
+  "local macro=P\"\\\\\"*Cmt(C(mname)*\"{\"*Cp()*mtext*\"}\",atMacro)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local chars=Cs(alnum^1\n"
+  "+S\".,:()\"\n"
+  "+spcChar^1/\" \"*(P\"*\"^1*#spcChar+\"\")\n"
+  "+\"&\"*Cp()*C(P\"#\"^-1*(alnum)^1)*\";\"/mkRef\n"
+  "+P'<--'/uchar(0x2190)\n"
+  "+P'-->'/uchar(0x2192)\n"
+  "+P'<=='/uchar(0x21D0)\n"
+  "+P'==>'/uchar(0x21D2)\n"
+  "+P'<=>'/uchar(0x21D4)\n"
+  "+P'!='/uchar(0x2260)\n"
+  "+P'<='/uchar(0x2264)\n"
+  "+P'>='/uchar(0x2265)\n"
+  "+P'--'/uchar(0x2014)\n"
+  "+P\"\\\\\"/\"\"*S[[!\"#$%&'()*+,-./:;<=>\?@[\\]^_`{|}~]]\n"
+  ")^1\n"
+  "+P'\"'/atDQ\n"
+  "+linebreak\n"
+  "+macro\n"
+  "+(litChar-S\"*][\")\n"
+  "\n"
+  "\n"
+  "local function ET(tok)\n"
+  "return function(s,i)\n"
+  "if not s:sub(i-1,i-1):match(\"[ \\n]\")and s:sub(i,i+#tok-1)==tok then\n"
+  "return i+#tok,(#tok==1 and\"i\"or\"b\")\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function isempty(s,i,c)\n"
+  "if c==\"\"then return i end\n"
+  "end\n"
+  "\n"
+  "local function notIn(name)\n"
+  "return Cmt(Cb(name),isempty)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function enter(name)\n"
+  "return P(name)*notIn(name)*Cg(Cp(),name)\n"
+  "end\n"
+  "\n"
+  "local function rtrimNode(node)\n"
+  "if type(node[#node])==\"string\"then\n"
+  "node[#node]=smarkmisc.rtrim(node[#node])\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local g={\n"
+  "\n"
+  "\n"
+  "Cg(\"\",\"*\")*Cg(\"\",\"**\")*Cg(\"\",\"[\")*V\"m\"\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "g.m=Ct((V\"b\"\n"
+  "+V\"i\"\n"
+  "+V\"link\"\n"
+  "+V\"href\"\n"
+  "+V\"url\"\n"
+  "+code\n"
+  "+chars\n"
+  "+notIn\"[\"*C(S\"][\")\n"
+  "+notIn\"*\"*notIn\"**\"*Cmt(C(\"*\"*P\"*\"^-1),mtWarn)\n"
+  ")^1)/catStrings\n"
+  "\n"
+  "\n"
+  "\n"
+  "g.b=enter\"**\"*#-spcChar*V\"m\"*ET\"**\"/mkNode\n"
+  "\n"
+  "\n"
+  "\n"
+  "g.i=(enter\"*\"-\"**\")*#-spcChar*V\"m\"*ET\"*\"/mkNode\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function linkNode(at,pos,node)\n"
+  "rtrimNode(node)\n"
+  "if at==\"@\"then\n"
+  "node[TYPE]=\"a\"\n"
+  "node.name=doctree.treeConcat(node)\n"
+  "else\n"
+  "node[TYPE]=\"_object\"\n"
+  "node.expand=expandLocalLink\n"
+  "node.link=doctree.treeConcat(node)\n"
+  "end\n"
+  "node._source=currentSource:newWarner(pos)\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "g.link=enter\"[\"*\"[\"*Cs(P\"@\"^-1)*spc*Cp()*V\"m\"*\"]]\"/linkNode\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function hrefNode(node,at,pos,href,title)\n"
+  "rtrimNode(node)\n"
+  "node[TYPE]=\"a\"\n"
+  "if at==\"@\"then\n"
+  "node.name=href\n"
+  "else\n"
+  "node.href=smarkmisc.urlNormalize(href)\n"
+  "end\n"
+  "node.title=title\n"
+  "node._source=currentSource:newWarner(pos)\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "g.href=enter\"[\"*spc*V\"m\"*\"]\"*spc\n"
+  "*\"(\"*Cs(P\"@\"^-1)*spc*Cp()*Cs((lit-spcChar^0*S'\")')^0)*spc\n"
+  "*('\"'*Cs((lit-spc*P'\"')^0)*spc*'\"'*spc+\"\")\n"
+  "*\")\"/hrefNode\n"
+  "\n"
+  "local scheme=P\"http:\"+\"https:\"+\"ftp:\"+\"mailto:\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function urlNode(url)\n"
+  "return E.a{\n"
+  "url,\n"
+  "href=smarkmisc.urlNormalize(url),\n"
+  "}\n"
+  "end\n"
+  "g.url=\"<\"*#scheme*Cs((spcChar^1/\" \"+(1-P\">\"))^1)*\">\"/urlNode\n"
+  "\n"
+  "local mu=P(g)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function parseInline(source)\n"
+  "currentSource=source\n"
+  "inquote=false\n"
+  "return mu:match(smarkmisc.rtrim(source.data))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getLines(node,a,b,runs,i)\n"
+  "i=math.floor(i or node.i)\n"
+  "for x=a,b do\n"
+  "local child=node[x]\n"
+  "if child:isBlock()then\n"
+  "getLines(child,1,#child,runs,i)\n"
+  "else\n"
+  "local r=child\n"
+  "if r[1]<r[2]then\n"
+  "\n"
+  "r={child[1]-(node.i-i),child[2]}\n"
+  "end\n"
+  "insert(runs,r)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function makeParg(typ,node,a,b)\n"
+  "local runs={}\n"
+  "getLines(node,a,b,runs)\n"
+  "local t=parseInline(node.source:extract(nil,runs))\n"
+  "t[TYPE]=typ\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local hdrTags={\n"
+  "[\"#\"]=\"h1\",\n"
+  "[\"=\"]=\"h2\",\n"
+  "[\"-\"]=\"h3\",\n"
+  "[\".\"]=\"h4\"\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function formatParg(parg,a,b)\n"
+  "\n"
+  "if b-a>=1 then\n"
+  "local u,pos=parg[b]:match(\"^([#=.-])[#=.-]* *()\")\n"
+  "if pos==parg[b][2]then\n"
+  "return makeParg(hdrTags[u],parg,a,b-1)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "if b==a and parg[a]:match(\"^[-=][-=][-=]+ *()\")==parg[a][2]then\n"
+  "return E.hr{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local indent,prefix=99999999,\"\"\n"
+  "for n=a,b do\n"
+  "local line=parg[n]\n"
+  "local posln,pre\n"
+  "pre,posln=line:match(\"^([:%.;%+|]) *()\")\n"
+  "if not pre then prefix=\"\";break end\n"
+  "if not prefix:find(pre,1,true)then\n"
+  "prefix=prefix..pre\n"
+  "end\n"
+  "if posln<line[2]then\n"
+  "\n"
+  "indent=math.min(indent,posln-line[1])\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if prefix==\";\"then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "local isTable=prefix==\"+|\"\n"
+  "\n"
+  "\n"
+  "if isTable or((prefix==\".\"or prefix==\":\")and indent>=2)then\n"
+  "local chop=isTable and 0 or indent\n"
+  "local maxlen=0\n"
+  "local runs={}\n"
+  "\n"
+  "getLines(parg,a,b,runs)\n"
+  "for _,r in ipairs(runs)do\n"
+  "r[1]=math.min(r[2],r[1]+chop)\n"
+  "maxlen=math.max(maxlen,r[2]-r[1]+1)\n"
+  "end\n"
+  "\n"
+  "local src=parg.source:extract(nil,runs)\n"
+  "local data=src.data\n"
+  "local t\n"
+  "if isTable then\n"
+  "t=E._macro{macro=\"table\",text=data,_source=src}\n"
+  "elseif prefix==\":\"then\n"
+  "t=E._macro{macro=\"art\",text=data,_source=src}\n"
+  "else\n"
+  "t=E.pre{data}\n"
+  "if maxlen>80 then\n"
+  "t.style=string.format(\"font-size: %d%%\",(8000*0.90/maxlen))\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return makeParg(\"p\",parg,a,b)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local listStyles={\n"
+  "[\"1\"]={[TYPE]=\"ol\",type=\"1\"},\n"
+  "[\"a\"]={[TYPE]=\"ol\",type=\"a\"},\n"
+  "[\"A\"]={[TYPE]=\"ol\",type=\"A\"},\n"
+  "[\"*\"]={[TYPE]=\"ul\"},\n"
+  "[\"-\"]={[TYPE]=\"ul\",type=\"circle\"},\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function markupDoc(node,parent)\n"
+  "local source=assert(node.source)\n"
+  "\n"
+  "local t={_source=source}\n"
+  "local ls=listStyles[node.tag]\n"
+  "if ls then\n"
+  "t[TYPE]=ls[TYPE]\n"
+  "t.type=ls.type\n"
+  "elseif parent and parent.tag then\n"
+  "t[TYPE]=\"li\"\n"
+  "end\n"
+  "\n"
+  "local ndx=1\n"
+  "while node[ndx]do\n"
+  "local e=node[ndx]\n"
+  "\n"
+  "if e:isBlock()then\n"
+  "\n"
+  "\n"
+  "local m=markupDoc(e,node)\n"
+  "if e.i-node.i>=4 then\n"
+  "m[TYPE]=m[TYPE]or\"div\"\n"
+  "m.class=\"indent\"\n"
+  "end\n"
+  "insert(t,m)\n"
+  "ndx=ndx+1\n"
+  "else\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ndxStart=ndx\n"
+  "while node[ndx]and not node[ndx].i and not node[ndx]:isBlank()do\n"
+  "ndx=ndx+1\n"
+  "end\n"
+  "\n"
+  "if ndx>ndxStart then\n"
+  "\n"
+  "local line=node[ndxStart]\n"
+  "local macro,d,argp=line:match(\"^%.([%a_][%w_%-%.]*) *(:\?) *()\")\n"
+  "\n"
+  "if macro==\"end\"then\n"
+  "source:warn(line[1],\"Mismatched macro end.\")\n"
+  "end\n"
+  "if ndx==ndxStart+1 and macro and(d==\":\"or argp==line[2])then\n"
+  "\n"
+  "\n"
+  "local runs={}\n"
+  "if d==\":\"then\n"
+  "\n"
+  "insert(runs,{argp,line[2]})\n"
+  "else\n"
+  "\n"
+  "local imin=math.huge\n"
+  "while node[ndx]and(node[ndx].i or node[ndx]:isBlank())do\n"
+  "local i=node[ndx].tagi or node[ndx].i\n"
+  "if i then\n"
+  "imin=math.min(imin,i)\n"
+  "end\n"
+  "ndx=ndx+1\n"
+  "end\n"
+  "getLines(node,ndxStart+1,ndx-1,runs,imin)\n"
+  "\n"
+  "while runs[1]and runs[#runs][1]==runs[#runs][2]do\n"
+  "table.remove(runs)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local endmacro=node[ndx]and node[ndx]:match(\"^%.end +([^ \\n]*)\")\n"
+  "if endmacro==macro then\n"
+  "ndx=ndx+1\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local ss=source:extract(line[1]+1,runs)\n"
+  "insert(t,E._macro{macro=macro,text=ss.data,_source=ss})\n"
+  "\n"
+  "elseif ndx==ndxStart+1 and line[1]==line[2]-1 and line:match(\"^%.\")then\n"
+  "\n"
+  "else\n"
+  "\n"
+  "insert(t,formatParg(node,ndxStart,ndx-1))\n"
+  "end\n"
+  "end\n"
+  "while node[ndx]and node[ndx]:isBlank()do\n"
+  "ndx=ndx+1\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseDoc(source)\n"
+  "\n"
+  "\n"
+  "if type(source)==\"function\"then\n"
+  "io.stderr:write(\"Warning: source function (not object) supplied to parseDoc()\")\n"
+  "assert(not os.getenv(\"SMARK_WERR\"))\n"
+  "source=source()\n"
+  "end\n"
+  "if type(source)==\"string\"then\n"
+  "io.stderr:write(\"Warning: source string (not object) supplied to parseDoc()\")\n"
+  "assert(not os.getenv(\"SMARK_WERR\"))\n"
+  "source=Source:newString(nil,source)\n"
+  "end\n"
+  "\n"
+  "return markupDoc(parseLayout(source))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local macros={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function loadMacro(doc,node,name)\n"
+  "local mmod=macros[name]\n"
+  "if not mmod then\n"
+  "local succ,r=pcall(require,\"smark_\"..name)\n"
+  "if not succ then\n"
+  "doc:warn(node,0,\"%s\",r)\n"
+  "end\n"
+  "mmod=r\n"
+  "end\n"
+  "if type(mmod)==\"function\"then\n"
+  "mmod={expand=mmod}\n"
+  "elseif type(mmod)~=\"table\"then\n"
+  "doc:warn(node,0,\"macro library %s did not return function or table\",name)\n"
+  "mmod={expand=function(x)return x.text end}\n"
+  "end\n"
+  "return mmod\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function macros.css(node)\n"
+  "return E.head{E.style{type=\"text/css\",node.text}}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function macros.comment()end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function genTOC(tocNode,doc)\n"
+  "local tree=doc.top\n"
+  "\n"
+  "\n"
+  "local toc=E.div{}\n"
+  "\n"
+  "\n"
+  "local latest={[0]=toc}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local afterTOC,prevLevel=false,0\n"
+  "\n"
+  "local function visit(node)\n"
+  "if not afterTOC then\n"
+  "afterTOC=node==tocNode\n"
+  "return\n"
+  "end\n"
+  "local lvl=node._toclvl\n"
+  "if lvl and lvl>0 then\n"
+  "\n"
+  "\n"
+  "for level=math.min(lvl,prevLevel+1),lvl do\n"
+  "local new=E.div{class=\"tocLevel\"}\n"
+  "insert(latest[level-1],new)\n"
+  "latest[level]=new\n"
+  "end\n"
+  "insert(latest[lvl],E.a{href=\"#\"..node._tocname,node._toctext})\n"
+  "prevLevel=lvl\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "doctree.visitElems(tree,visit)\n"
+  "\n"
+  "\n"
+  "while not toc[2]and toc[1]and toc[1][1].class==\"tocLevel\"do\n"
+  "toc=toc[1]\n"
+  "end\n"
+  "\n"
+  "toc.class=\"toc\"\n"
+  "return toc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function macros.toc(node,doc)\n"
+  "node.expand=genTOC\n"
+  "return E._defer{node}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function nameNode(node,name,anchors)\n"
+  "local prev=anchors[name]\n"
+  "if prev and(not prev._toclvl or prev._toclvl<=node._toclvl)then\n"
+  "nameNode(node,\"_\"..name,anchors)\n"
+  "else\n"
+  "node._tocname=name\n"
+  "anchors[name]=node\n"
+  "if prev then nameNode(prev,\"_\"..name,anchors)end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function markAnchors(doc)\n"
+  "local a=doc.anchors or{}\n"
+  "doc.anchors=a\n"
+  "\n"
+  "\n"
+  "local function scanAnchors(node)\n"
+  "if node.name and not a[node.name]then\n"
+  "a[node.name]=node\n"
+  "end\n"
+  "end\n"
+  "doctree.visitElems(doc.top,scanAnchors,'a')\n"
+  "\n"
+  "\n"
+  "local function nameHeaders(node)\n"
+  "local lvl=tonumber(node[TYPE]and node[TYPE]:match(\"^h(%d)$\")or 0)\n"
+  "if lvl>0 and not node._toclvl then\n"
+  "node._toclvl=lvl\n"
+  "node._toctext=doctree.treeConcat(node)\n"
+  "nameNode(node,urlEncode(node._toctext),a)\n"
+  "insert(node,1,E.a{name=node._tocname})\n"
+  "if lvl==1 and not doc.title then\n"
+  "doc.title=node._toctext\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "doctree.visitElems(doc.top,nameHeaders)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function expand(node,doc)\n"
+  "if type(node)~=\"table\"then\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if node[TYPE]==\"_defer\"then\n"
+  "node[TYPE]=nil\n"
+  "insert(doc.expandNodes,node)\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if node[TYPE]==\"_macro\"then\n"
+  "\n"
+  "local mmod=loadMacro(doc,node,node.macro)\n"
+  "node[TYPE]=\"_object\"\n"
+  "setmetatable(node,{__index=mmod})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if node[TYPE]==\"_object\"then\n"
+  "local exp=node.text\n"
+  "\n"
+  "if node.render2D then\n"
+  "local GC=doc.config.graphics==\"svg\"and Svg2D or Html2D\n"
+  "local gc=GC:new()\n"
+  "local succ,r=pcall(node.render2D,node,gc)\n"
+  "if succ then\n"
+  "exp=gc:genTree()\n"
+  "else\n"
+  "doc:warn(node,0,\"error invoking object.render2D:\\n%s\\n\",tostring(r))\n"
+  "end\n"
+  "elseif node.expand then\n"
+  "local succ,r=pcall(node.expand,node,doc)\n"
+  "if succ then\n"
+  "exp=r\n"
+  "else\n"
+  "doc:warn(node,0,\"error invoking object.expand\\n\"..tostring(r))\n"
+  "end\n"
+  "else\n"
+  "doc:warn(node,0,\"cannot render this object: %s\\n\",tostring(node.macro))\n"
+  "end\n"
+  "\n"
+  "node=expand(exp,doc)\n"
+  "\n"
+  "elseif type(node)==\"table\"and tostring(node[TYPE]):sub(1,1)~=\"_\"then\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ndxOut=1\n"
+  "for ndx=1,#node do\n"
+  "\n"
+  "local child=expand(node[ndx],doc)\n"
+  "node[ndx]=nil\n"
+  "if child then\n"
+  "node[ndxOut]=child\n"
+  "ndxOut=ndxOut+1\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function Doc_warn(self,node,pos,...)\n"
+  "local source=(node and node._source)or self.top._source or Source\n"
+  "source:warn(pos,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function expandDoc(tree,configEnv)\n"
+  "assert(type(tree)==\"table\"and tostring(tree[TYPE]):sub(1,1)~=\"_\")\n"
+  "\n"
+  "\n"
+  "local doc={\n"
+  "parse=parseDoc,\n"
+  "macros=macros,\n"
+  "config=configEnv or{},\n"
+  "warn=Doc_warn,\n"
+  "expandNodes={tree},\n"
+  "top=tree,\n"
+  "}\n"
+  "\n"
+  "local n=1\n"
+  "while n<=#doc.expandNodes do\n"
+  "expand(doc.expandNodes[n],doc)\n"
+  "markAnchors(doc)\n"
+  "n=n+1\n"
+  "end\n"
+  "\n"
+  "if doc.title then\n"
+  "\n"
+  "\n"
+  "insert(tree,E.head{E.title{doc.title}})\n"
+  "end\n"
+  "\n"
+  "local a={}\n"
+  "local function checkAnchors(node)\n"
+  "if node.name then\n"
+  "local othernode=a[node.name]\n"
+  "if othernode then\n"
+  "doc:warn(node,0,\"duplicated anchor name '%s'\",node.name)\n"
+  "if othernode._source then\n"
+  "othernode._source:warn(0,\"... anchor also used here:\")\n"
+  "end\n"
+  "end\n"
+  "a[node.name]=node\n"
+  "end\n"
+  "end\n"
+  "doctree.visitElems(tree,checkAnchors,'a')\n"
+  "\n"
+  "tree[TYPE]=\"div\"\n"
+  "tree.class=\"smarkdoc\"\n"
+  "\n"
+  "\n"
+  "tree._uncacheable=doc.uncacheable\n"
+  "return tree\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "parseDoc=parseDoc,\n"
+  "expandDoc=expandDoc\n"
+  "}\n"
+  "";
+
+static const unsigned char data3[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function rtrim(str)\n"
+  "\n"
+  "if str:match(\"[ \\t\\n]\",-1)then\n"
+  "for n=#str-1,1,-1 do\n"
+  "if str:find(\"^[^ \\t\\n]\",n)then\n"
+  "return str:sub(1,n)\n"
+  "end\n"
+  "end\n"
+  "return\"\"\n"
+  "end\n"
+  "return str\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function expandTabs(str)\n"
+  "if str:match(\"\\t\")then\n"
+  "local lstart=1\n"
+  "local function et(c,pos)\n"
+  "if c==\"\\n\"then\n"
+  "lstart=pos\n"
+  "else\n"
+  "local exp=8-(pos-lstart-1)%8\n"
+  "lstart=lstart-exp+1\n"
+  "return string.rep(\" \",exp)\n"
+  "end\n"
+  "end\n"
+  "str=str:gsub(\"([\\n\\t])()\",et)\n"
+  "end\n"
+  "return str\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function findRowCol(str,pos)\n"
+  "local lnum,lpos,lstart=0,1,1\n"
+  "while lpos and lpos<=pos do\n"
+  "lnum=lnum+1\n"
+  "lstart=lpos\n"
+  "lpos=str:match(\"\\r\?\\n()\",lpos)\n"
+  "end\n"
+  "return lnum,pos-lstart+1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function urlEncodeByte(c)\n"
+  "return\"%\"..string.format(\"%02x\",string.byte(c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function urlEncode(str)\n"
+  "return(str:gsub(\"[\?#;&%% \\\"<>%[\\\\%]^`{|}]\",urlEncodeByte))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function urlNormalize(str)\n"
+  "str=str:gsub(\"[%% \\\"<>%[\\\\%]^`{|}]\",urlEncodeByte)\n"
+  "str=str:gsub(\"%%25(%x%x)\",\"%%%1\")\n"
+  "return str\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function fatal(fmt,...)\n"
+  "local message=fmt and string.format(fmt,...)or\"smark exited.\"\n"
+  "error(\"exit: \"..message)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function readFile(name)\n"
+  "local f,err=io.open(name,\"r\")\n"
+  "if not f then\n"
+  "return f,err\n"
+  "end\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function lineToPos(str,line)\n"
+  "local n=1\n"
+  "local pos=1\n"
+  "for p in str:gmatch(\"\\n()\")do\n"
+  "n=n+1\n"
+  "if n>line then break end\n"
+  "pos=p\n"
+  "end\n"
+  "return pos<=#str and pos or#str\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "rtrim=rtrim,\n"
+  "expandTabs=expandTabs,\n"
+  "findRowCol=findRowCol,\n"
+  "urlEncode=urlEncode,\n"
+  "urlNormalize=urlNormalize,\n"
+  "readFile=readFile,\n"
+  "fatal=fatal,\n"
+  "lineToPos=lineToPos,\n"
+  "}\n"
+  "";
+
+extern int luaopen_lpeg(lua_State *);
+
+static const unsigned char data4[] = 
+  "\n"
+  "\n"
+  "return{quot=34,amp=38,lt=60,gt=62,nbsp=160,iexcl=161,cent=162,pound=163,\n"
+  "curren=164,yen=165,brvbar=166,sect=167,uml=168,copy=169,ordf=170,laquo=171,\n"
+  "[\"not\"]=172,shy=173,reg=174,macr=175,deg=176,plusmn=177,sup2=178,sup3=179,\n"
+  "acute=180,micro=181,para=182,middot=183,cedil=184,sup1=185,ordm=186,raquo=187,\n"
+  "frac14=188,frac12=189,frac34=190,iquest=191,Agrave=192,Aacute=193,Acirc=194,\n"
+  "Atilde=195,Auml=196,Aring=197,AElig=198,Ccedil=199,Egrave=200,Eacute=201,\n"
+  "Ecirc=202,Euml=203,Igrave=204,Iacute=205,Icirc=206,Iuml=207,ETH=208,Ntilde=209,\n"
+  "Ograve=210,Oacute=211,Ocirc=212,Otilde=213,Ouml=214,times=215,Oslash=216,\n"
+  "Ugrave=217,Uacute=218,Ucirc=219,Uuml=220,Yacute=221,THORN=222,szlig=223,\n"
+  "agrave=224,aacute=225,acirc=226,atilde=227,auml=228,aring=229,aelig=230,\n"
+  "ccedil=231,egrave=232,eacute=233,ecirc=234,euml=235,igrave=236,iacute=237,\n"
+  "icirc=238,iuml=239,eth=240,ntilde=241,ograve=242,oacute=243,ocirc=244,\n"
+  "otilde=245,ouml=246,divide=247,oslash=248,ugrave=249,uacute=250,ucirc=251,\n"
+  "uuml=252,yacute=253,thorn=254,yuml=255,OElig=338,oelig=339,Scaron=352,\n"
+  "scaron=353,Yuml=376,fnof=402,circ=710,tilde=732,Alpha=913,Beta=914,Gamma=915,\n"
+  "Delta=916,Epsilon=917,Zeta=918,Eta=919,Theta=920,Iota=921,Kappa=922,Lambda=923,\n"
+  "Mu=924,Nu=925,Xi=926,Omicron=927,Pi=928,Rho=929,Sigma=931,Tau=932,Upsilon=933,\n"
+  "Phi=934,Chi=935,Psi=936,Omega=937,alpha=945,beta=946,gamma=947,delta=948,\n"
+  "epsilon=949,zeta=950,eta=951,theta=952,iota=953,kappa=954,lambda=955,mu=956,\n"
+  "nu=957,xi=958,omicron=959,pi=960,rho=961,sigmaf=962,sigma=963,tau=964,\n"
+  "upsilon=965,phi=966,chi=967,psi=968,omega=969,thetasym=977,upsih=978,piv=982,\n"
+  "ensp=8194,emsp=8195,thinsp=8201,zwnj=8204,zwj=8205,lrm=8206,rlm=8207,\n"
+  "ndash=8211,mdash=8212,lsquo=8216,rsquo=8217,sbquo=8218,ldquo=8220,rdquo=8221,\n"
+  "bdquo=8222,dagger=8224,Dagger=8225,bull=8226,hellip=8230,permil=8240,\n"
+  "prime=8242,Prime=8243,lsaquo=8249,rsaquo=8250,oline=8254,frasl=8260,euro=8364,\n"
+  "image=8465,weierp=8472,real=8476,trade=8482,alefsym=8501,larr=8592,uarr=8593,\n"
+  "rarr=8594,darr=8595,harr=8596,crarr=8629,lArr=8656,uArr=8657,rArr=8658,\n"
+  "dArr=8659,hArr=8660,forall=8704,part=8706,exist=8707,empty=8709,nabla=8711,\n"
+  "isin=8712,notin=8713,ni=8715,prod=8719,sum=8721,minus=8722,lowast=8727,\n"
+  "radic=8730,prop=8733,infin=8734,ang=8736,[\"and\"]=8743,[\"or\"]=8744,cap=8745,\n"
+  "cup=8746,int=8747,there4=8756,sim=8764,cong=8773,asymp=8776,ne=8800,equiv=8801,\n"
+  "le=8804,ge=8805,sub=8834,sup=8835,nsub=8836,sube=8838,supe=8839,oplus=8853,\n"
+  "otimes=8855,perp=8869,sdot=8901,lceil=8968,rceil=8969,lfloor=8970,rfloor=8971,\n"
+  "lang=9001,rang=9002,loz=9674,spades=9824,clubs=9827,hearts=9829,diams=9830}\n"
+  "";
+
+static const unsigned char data5[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local char=string.char\n"
+  "local byte=string.byte\n"
+  "local match=string.match\n"
+  "local modf=math.modf\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(n)\n"
+  "if n<=0x7F then\n"
+  "return char(n)\n"
+  "end\n"
+  "if n<=0x7FF then\n"
+  "local a\n"
+  "a,n=modf(n/64)\n"
+  "return char(192+a,128+n*64)\n"
+  "end\n"
+  "if n<=0xFFFF then\n"
+  "local a,b\n"
+  "a,n=modf(n/4096)\n"
+  "b,n=modf(n*64)\n"
+  "return char(224+a,128+b,128+n*64)\n"
+  "end\n"
+  "if n<=0x10FFFF then\n"
+  "local a,b,c\n"
+  "a,n=modf(n/262144)\n"
+  "b,n=modf(n*64)\n"
+  "c,n=modf(n*64)\n"
+  "return char(240+a,128+b,128+c,128+n*64)\n"
+  "end\n"
+  "error(\"utf8: bad argument #1 to 'encode'\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mbpattern=\"[\\128-\\255][\\128-\\191]*\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaDecode(s,ferr)\n"
+  "\n"
+  "local n,min\n"
+  "if match(s,\"^[\\192-\\223][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(byte(s,1)-192)*64+byte(s,2)-128\n"
+  "min=0x80\n"
+  "elseif match(s,\"^[\\224-\\239][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=((byte(s,1)-224)*64+byte(s,2)-128)*64+byte(s,3)-128\n"
+  "min=0x800\n"
+  "elseif match(s,\"^[\\240-\\244][\\128-\\191][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(((byte(s,1)-240)*64+byte(s,2)-128)*64+byte(s,3)-128)*64+byte(s,4)-128\n"
+  "min=0x10000\n"
+  "elseif match(s,\"^[%z\\1-\\127]$\")then\n"
+  "\n"
+  "n=byte(s,1)\n"
+  "min=0\n"
+  "else\n"
+  "n=-1\n"
+  "min=0\n"
+  "end\n"
+  "if n>=min then\n"
+  "return n\n"
+  "end\n"
+  "if(ferr)then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaValidate(str)\n"
+  "for s in str:gmatch(mbpattern)do\n"
+  "luaDecode(s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local decode,validate=luaDecode,luaValidate\n"
+  "\n"
+  "if succ then\n"
+  "local utf8Decode,utf8Check=textcodec_c.utf8Decode,textcodec_c.utf8Check\n"
+  "\n"
+  "function decode(s,ferr)\n"
+  "local n,valid=utf8Decode(s)\n"
+  "if valid then\n"
+  "return n\n"
+  "elseif ferr then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function validate(str)\n"
+  "local a,b=utf8Check(str)\n"
+  "if a then\n"
+  "decode(str:sub(a,b))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gsub=string.gsub\n"
+  "\n"
+  "local function b2c(c)\n"
+  "local n=byte(c)\n"
+  "if n<192 then\n"
+  "return\"\\194\"..c\n"
+  "end\n"
+  "return\"\\195\"..char(n-64)\n"
+  "end\n"
+  "\n"
+  "local function binToChars(str)\n"
+  "return(gsub(str,\"[\\128-\\255]\",b2c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function c2b(s)\n"
+  "return char((byte(s)-194)*64+byte(s,2))\n"
+  "end\n"
+  "\n"
+  "local function charsToBin(str)\n"
+  "return(gsub(str,\"[\\194\\195][\\128-\\255]\",c2b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=encode,\n"
+  "decode=decode,\n"
+  "validate=validate,\n"
+  "mbpattern=mbpattern,\n"
+  "binToChars=binToChars,\n"
+  "charsToBin=charsToBin,\n"
+  "isNative=succ,\n"
+  "\n"
+  "_luaDecode=luaDecode,\n"
+  "_luaValidate=luaValidate,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+static const unsigned char data6[] = 
+  "\n"
+  "\n"
+  "local Object={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Object:adopt(o)\n"
+  "rawset(self,\"__index\",self)\n"
+  "setmetatable(o,self)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:getParent()\n"
+  "local p=getmetatable(self).__index\n"
+  "return type(p)==\"table\"and p or nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:basicNew()\n"
+  "return self:adopt{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:new(...)\n"
+  "local o=self:basicNew()\n"
+  "o:initialize(...)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:initialize()\n"
+  "\n"
+  "end\n"
+  "\n"
+  "return Object\n"
+  "";
+
+static const unsigned char data7[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local smarkmisc=require\"smarkmisc\"\n"
+  "local lfsu=require\"lfsu\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Source=Object:new()\n"
+  "\n"
+  "local FileSource,SubSource,StringSource\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Source:printError(message,source,pos,line,col)\n"
+  "if self.parent then\n"
+  "self.parent:printError(message,source,pos,line,col)\n"
+  "else\n"
+  "io.stderr:write(\"ERROR: Dropped PrintError\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Source:addFile(filename)\n"
+  "table.insert(self.files,filename)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Source:warn(pos,...)\n"
+  "self:printError(string.format(...),self:where(pos))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Source:where(pos)\n"
+  "if not pos or pos<1 then\n"
+  "return self\n"
+  "end\n"
+  "\n"
+  "return self,pos,smarkmisc.findRowCol(self.data,pos)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Source:newFile(fileName,data,pos)\n"
+  "if not data then\n"
+  "\n"
+  "local dir=lfsu.splitpath(self:where().fileName or\"./\")\n"
+  "local paths={lfsu.resolve(dir,fileName)}\n"
+  "if fileName~=paths[1]then\n"
+  "paths[2]=fileName\n"
+  "end\n"
+  "\n"
+  "local err\n"
+  "for _,path in ipairs(paths)do\n"
+  "data,err=smarkmisc.readFile(path)\n"
+  "if data then\n"
+  "fileName=path\n"
+  "break\n"
+  "end\n"
+  "end\n"
+  "if not data then\n"
+  "table.insert(paths,1,\"\")\n"
+  "local locs=table.concat(paths,\"\\n ... attempted to open: \")\n"
+  "self:warn(pos,\"Could not find file: %s%s\\n\",fileName,locs)\n"
+  "smarkmisc.fatal(\"\")\n"
+  "end\n"
+  "self:addFile(fileName)\n"
+  "end\n"
+  "return FileSource:new(self,pos,fileName,data)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Source:newString(pos,str)\n"
+  "return FileSource:new(self,pos,\"(unknown)\",str)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Source:extract(pos,runs,suffix)\n"
+  "return SubSource:new(self,pos,runs,suffix)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Source:newWarner(posInParent)\n"
+  "local parent=self\n"
+  "local w={}\n"
+  "w.data=\"\"\n"
+  "function w:warn(pos,...)\n"
+  "return parent:warn(pos+posInParent,...)\n"
+  "end\n"
+  "return w\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "FileSource=Source:new()\n"
+  "\n"
+  "\n"
+  "function FileSource:initialize(parent,pos,fileName,data)\n"
+  "\n"
+  "\n"
+  "self.data=smarkmisc.expandTabs(data:gsub(\"\\r\",\"\"))\n"
+  "self.fileName=fileName\n"
+  "self.parent=parent\n"
+  "self.files=parent.files\n"
+  "self.parentPos=pos\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "SubSource=Source:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubSource:initialize(parent,pos,runs,suffix)\n"
+  "self.parent=parent\n"
+  "self.files=parent.files\n"
+  "self.parentPos=pos or runs[1]and runs[1][1]\n"
+  "self.runs=runs\n"
+  "self.suffix=suffix or\"\"\n"
+  "\n"
+  "\n"
+  "local t={}\n"
+  "for _,r in ipairs(runs)do\n"
+  "assert(r[2]>=r[1]-1)\n"
+  "table.insert(t,parent.data:sub(r[1],r[2])..self.suffix)\n"
+  "end\n"
+  "self.data=table.concat(t)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function SubSource:where(pos)\n"
+  "local parentPos=self.parentPos\n"
+  "\n"
+  "if not pos or pos<1 then\n"
+  "pos=1\n"
+  "end\n"
+  "\n"
+  "for _,r in ipairs(self.runs)do\n"
+  "local runLen=r[2]-r[1]+1+#self.suffix\n"
+  "if pos<=runLen then\n"
+  "parentPos=pos+r[1]-1\n"
+  "break\n"
+  "end\n"
+  "pos=pos-runLen\n"
+  "end\n"
+  "\n"
+  "return self.parent:where(parentPos)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local SmarkSource=Source:basicNew()\n"
+  "\n"
+  "\n"
+  "local warnTemplate=\n"
+  "\"smark warning:\\n\"..\n"
+  "\"{F}:{L}:{C}: {E}\\n\"..\n"
+  "\"{F}: {T}\\n\"..\n"
+  "\"{F}: {S}^\\n\"..\n"
+  "\"{D}\"\n"
+  "\n"
+  "\n"
+  "function SmarkSource:printError(message,source,pos,line,col)\n"
+  "local warning\n"
+  "local fileName=source.fileName\n"
+  "local data=source.data\n"
+  "\n"
+  "if not fileName then\n"
+  "warning=\"smark error: \"..message\n"
+  "elseif not line then\n"
+  "warning=string.format(\"%s: %s\\n\",fileName,message)\n"
+  "else\n"
+  "local fields={F=fileName,L=line,C=col}\n"
+  "\n"
+  "fields.E,fields.D=message:match(\"([^\\n]*)\\n\?(.*)\")\n"
+  "fields.T=data:match(\"[^\\r\\n]*\",pos-col+1)\n"
+  "fields.S=(\" \"):rep(col-1)\n"
+  "warning=warnTemplate:gsub(\"{(%w*)}\",fields)\n"
+  "end\n"
+  "io.stderr:write(warning)\n"
+  "\n"
+  "while source.parent and source.parent.data do\n"
+  "source,pos,line,col=source.parent:where(source.parentPos)\n"
+  "fileName=source.fileName or\"\?\?\"\n"
+  "message=(\"   included from: %s:%s:\\n\"):format(fileName,line or\"\?\?\")\n"
+  "io.stderr:write(message)\n"
+  "end\n"
+  "\n"
+  "source.didWarn=true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function SmarkSource:initialize()\n"
+  "self.files={}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return SmarkSource:new()\n"
+  "\n"
+  "";
+
+static const unsigned char data8[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpfs=require\"xpfs\"\n"
+  "local fsu=require\"fsu\"\n"
+  "\n"
+  "local iswin=xpfs.getcwd():match(\"^[a-zA-Z]%:\\\\\")\n"
+  "local base=iswin and fsu.win or fsu.nix\n"
+  "\n"
+  "local U=setmetatable({},{__index=base})\n"
+  "\n"
+  "U.iswindows=iswin\n"
+  "\n"
+  "\n"
+  "function U.relpathto(src,dst,cwd)\n"
+  "return base.relpathto(src,dst,cwd or xpfs.getcwd())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function U.abspath(path)\n"
+  "return base.resolve(xpfs.getcwd(),path)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function _mkdir_p(dir,split)\n"
+  "local e,m=true\n"
+  "\n"
+  "local st=xpfs.stat(dir,\"k\")\n"
+  "if not st then\n"
+  "local p=split(dir)\n"
+  "if p==dir then\n"
+  "return nil,\"unexpected error: \"..dir..\" does not exist\"\n"
+  "end\n"
+  "e,m=_mkdir_p(p,split)\n"
+  "if e then\n"
+  "e,m=xpfs.mkdir(dir)\n"
+  "end\n"
+  "elseif st.kind~=\"d\"then\n"
+  "e,m=nil,\"could not create directory \"..dir\n"
+  "end\n"
+  "return e,m\n"
+  "end\n"
+  "\n"
+  "function U.mkdir_p(path)\n"
+  "return _mkdir_p(path,base.splitpath)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function removeTree(dir)\n"
+  "local dirs={dir}\n"
+  "local iter,err=xpfs.walk(dir)\n"
+  "if not iter then\n"
+  "return nil,err\n"
+  "end\n"
+  "for path,kind,err in iter do\n"
+  "if kind==\"d\"then\n"
+  "table.insert(dirs,path)\n"
+  "elseif kind then\n"
+  "local s,e=xpfs.remove(path)\n"
+  "if not s then return s,e end\n"
+  "else\n"
+  "return nil,err\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "for ndx=#dirs,1,-1 do\n"
+  "local s,e=xpfs.rmdir(dirs[ndx])\n"
+  "if not s then return s,e end\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function U.rm_rf(name)\n"
+  "local s,e=true\n"
+  "\n"
+  "if xpfs.walk then\n"
+  "local st=xpfs.stat(name,\"k\")\n"
+  "if st and st.kind==\"d\"then\n"
+  "return removeTree(name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local todo={name}\n"
+  "while#todo>0 do\n"
+  "local f=table.remove(todo)\n"
+  "if type(f)==\"table\"then\n"
+  "s,e=xpfs.rmdir(f[1])\n"
+  "if not s then break end\n"
+  "else\n"
+  "local st=xpfs.stat(f,\"k\")\n"
+  "if st and st.kind==\"d\"then\n"
+  "table.insert(todo,{f})\n"
+  "local de=xpfs.dir(f)\n"
+  "for _,g in ipairs(de)do\n"
+  "if g~=\".\"and g~=\"..\"then\n"
+  "table.insert(todo,f..\"/\"..g)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "else\n"
+  "s,e=xpfs.remove(f)\n"
+  "if not s then break end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return s,e\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return U\n"
+  "";
+
+extern int luaopen_xpfs(lua_State *);
+
+static const unsigned char data9[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function addslash(p)\n"
+  "if p:sub(-1)==\"/\"then\n"
+  "return p\n"
+  "end\n"
+  "return p..\"/\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function splitpath(path)\n"
+  "if path:sub(-1)==\"/\"then\n"
+  "path=path:sub(1,-2)\n"
+  "end\n"
+  "local dir,name=path:match(\"(.*)/(.*)\")\n"
+  "if dir then\n"
+  "return(dir==\"\"and\"/\"or dir),name\n"
+  "elseif path==\"\"then\n"
+  "return\"/\",\".\"\n"
+  "end\n"
+  "return\".\",path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function cleanpath(path)\n"
+  "local init,path=path:match(\"^(/*)(.*)\")\n"
+  "\n"
+  "while path:sub(1,2)==\"./\"do\n"
+  "path=path:sub(3)\n"
+  "end\n"
+  "\n"
+  "local e,post\n"
+  "local n=1\n"
+  "repeat\n"
+  "n,e,post=path:match(\"/()(%.%.\?)(.\?)\",n)\n"
+  "if post~=\"\"and post~=\"/\"then\n"
+  "\n"
+  "elseif e==\".\"then\n"
+  "\n"
+  "path=path:sub(1,n-2)..path:sub(n+1)\n"
+  "n=n-1\n"
+  "else\n"
+  "\n"
+  "local a=n-2\n"
+  "while a>0 and path:sub(a,a)~=\"/\"do\n"
+  "a=a-1\n"
+  "end\n"
+  "local parent=path:sub(a+1,n-2)\n"
+  "if parent~=\"\"and parent~=\"..\"then\n"
+  "path=path:sub(1,a)..path:sub(n+3)\n"
+  "n=a\n"
+  "end\n"
+  "end\n"
+  "until n==nil\n"
+  "\n"
+  "\n"
+  "if path:sub(-1,-1)then\n"
+  "path=path:match(\"(.-)/*$\")\n"
+  "end\n"
+  "\n"
+  "path=init..path\n"
+  "return path~=\"\"and path or\".\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function xrelpathto(src,dst,streq)\n"
+  "local s=addslash(src)\n"
+  "local d=addslash(dst)\n"
+  "\n"
+  "while true do\n"
+  "local a,b=s:match(\"[^/]*/\"),d:match(\"[^/]*/\")\n"
+  "if not a then\n"
+  "break\n"
+  "elseif streq(a,b)then\n"
+  "s=s:sub(#a+1)\n"
+  "d=d:sub(#a+1)\n"
+  "elseif a==\"../\"then\n"
+  "return nil,\"relpathto: destination is above root directory\"\n"
+  "elseif a==\"/\"then\n"
+  "return nil,\"relpathto: no base for destination directory\"\n"
+  "elseif b==\"/\"then\n"
+  "break\n"
+  "else\n"
+  "s=s:sub(#a+1)\n"
+  "d=\"../\"..d\n"
+  "end\n"
+  "end\n"
+  "d=d:sub(1,-2)\n"
+  "return d==\"\"and\".\"or d\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function read(name)\n"
+  "local f,err=io.open(name,\"r\")\n"
+  "if not f then\n"
+  "return f,err\n"
+  "end\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function write(name,data)\n"
+  "local f,err=io.open(name,\"wb\")\n"
+  "if not f then\n"
+  "return f,err\n"
+  "end\n"
+  "f:write(data)\n"
+  "f:close()\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local nix={\n"
+  "read=read,\n"
+  "write=write,\n"
+  "cleanpath=cleanpath,\n"
+  "splitpath=splitpath,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function streq(a,b)\n"
+  "return a==b\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function nix.resolve(dir,path)\n"
+  "if path:sub(1,1)==\"/\"then\n"
+  "\n"
+  "else\n"
+  "path=addslash(dir)..path\n"
+  "end\n"
+  "return cleanpath(path)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function nix.relpathto(src,dst,cwd)\n"
+  "if cwd then\n"
+  "src=nix.resolve(cwd,src)\n"
+  "dst=nix.resolve(cwd,dst)\n"
+  "end\n"
+  "return xrelpathto(src,dst,streq)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function splitdev(path)\n"
+  "local drv,rest=path:match(\"^([a-zA-Z]%:)(.*)\")\n"
+  "return drv,rest or path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joindev(drive,path)\n"
+  "return drive and drive..path or path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function streqi(a,b)\n"
+  "return a==b or a and b and a:upper()==b:upper()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function fixslashes(path)\n"
+  "return path:gsub(\"\\\\\",\"/\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local win={\n"
+  "read=read,\n"
+  "write=write,\n"
+  "}\n"
+  "\n"
+  "function win.cleanpath(path)\n"
+  "local drv,p=splitdev(fixslashes(path))\n"
+  "return joindev(drv,cleanpath(p))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function win.splitpath(path)\n"
+  "local drv,x=splitdev(fixslashes(path))\n"
+  "local xdir,xpath=splitpath(x)\n"
+  "return joindev(drv,xdir),xpath\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function win.resolve(dir,path)\n"
+  "if path:match(\"^[a-zA-Z]:[/\\\\]\")then\n"
+  "\n"
+  "elseif path:match(\"^[/\\\\]\")then\n"
+  "path=joindev(dir:match(\"^([a-zA-Z]:)\"),path)\n"
+  "else\n"
+  "path=addslash(dir)..path\n"
+  "end\n"
+  "return win.cleanpath(path)\n"
+  "end\n"
+  "\n"
+  "function win.relpathto(src,dst,cwd)\n"
+  "if cwd then\n"
+  "src=win.resolve(cwd,src)\n"
+  "dst=win.resolve(cwd,dst)\n"
+  "end\n"
+  "\n"
+  "local sd,sp=splitdev(src)\n"
+  "local dd,dp=splitdev(dst)\n"
+  "if streqi(sd,dd)then\n"
+  "return xrelpathto(sp,dp,streqi)\n"
+  "end\n"
+  "return dst\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "nix=nix,\n"
+  "win=win,\n"
+  "}\n"
+  "";
+
+static const unsigned char data10[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local E,TYPE=doctree.E,doctree.TYPE\n"
+  "\n"
+  "local sprintf=string.format\n"
+  "\n"
+  "local htmlSubs={\n"
+  "[\"<\"]=\"&lt;\",\n"
+  "[\">\"]=\"&gt;\",\n"
+  "[\"&\"]=\"&amp;\",\n"
+  "['\"']=\"&quot;\"\n"
+  "}\n"
+  "\n"
+  "local function htmlEscapeStr(str)\n"
+  "return(str:gsub(\"[<>&]\",htmlSubs))\n"
+  "end\n"
+  "\n"
+  "local function htmlQuoteAttr(a)\n"
+  "if not a:match(\"^%a%w*$\")then\n"
+  "a='\"'..htmlEscapeStr(a)..'\"'\n"
+  "end\n"
+  "return a\n"
+  "end\n"
+  "\n"
+  "local function htmlEscape(node)\n"
+  "if type(node)==\"string\"then\n"
+  "return htmlEscapeStr(node)\n"
+  "end\n"
+  "local o=setmetatable({},{__call=table.insert})\n"
+  "if node[TYPE]then\n"
+  "o(\"<\"..node[TYPE])\n"
+  "for k,v in opairs(node or{})do\n"
+  "if type(k)==\"string\"and k:sub(1,1)~=\"_\"then\n"
+  "o(\" \"..k..\"=\"..htmlQuoteAttr(v))\n"
+  "end\n"
+  "end\n"
+  "o(\">\")\n"
+  "end\n"
+  "for _,v in ipairs(node)do\n"
+  "o(htmlEscape(v))\n"
+  "end\n"
+  "if node[TYPE]then\n"
+  "o(\"</\"..node[TYPE]..\">\")\n"
+  "end\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "local function xor(a,b)\n"
+  "return(not a and b)or(not b and a)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function range(a,b)\n"
+  "local lower=math.min(a,b)\n"
+  "return lower,math.max(a,b)-lower\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mtPoint={}\n"
+  "mtPoint.__index=mtPoint\n"
+  "\n"
+  "local function Point(x,y)\n"
+  "return setmetatable(y and{x,y}or x or{},mtPoint)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function mtPoint.__mul(a,b)\n"
+  "if type(a)==\"number\"then\n"
+  "a,b=b,a\n"
+  "end\n"
+  "if type(b)==\"number\"then\n"
+  "return Point(a[1]*b,a[2]*b)\n"
+  "end\n"
+  "local x,y=b[1],b[2]\n"
+  "return Point(a[1]*x-a[2]*y,a[2]*x+a[1]*y)\n"
+  "end\n"
+  "\n"
+  "local function unpackArg(x)\n"
+  "if type(x)==\"table\"then\n"
+  "return x[1],x[2]\n"
+  "else\n"
+  "return x,0\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function mtPoint.__div(p,q)\n"
+  "local a,b=unpackArg(p)\n"
+  "local c,d=unpackArg(q)\n"
+  "local x=c*c+d*d\n"
+  "return Point((a*c+b*d)/x,(b*c-a*d)/x)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function mtPoint.__add(p,q)\n"
+  "return Point(p[1]+q[1],p[2]+q[2])\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function mtPoint.__sub(p,q)\n"
+  "return Point(p[1]-q[1],p[2]-q[2])\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function mtPoint.__eq(a,b)\n"
+  "return a[1]==b[1]and a[2]==b[2]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function mtPoint:__tostring()\n"
+  "return\"(\"..self[1]..\",\"..self[2]..\")\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local CSS=Object:new()\n"
+  "\n"
+  "function CSS:f(...)\n"
+  "local prop=sprintf(...):gsub(\";+$\",\"\")\n"
+  "if prop~=\"\"then\n"
+  "table.insert(self,prop)\n"
+  "end\n"
+  "return prop\n"
+  "end\n"
+  "\n"
+  "function CSS:string()\n"
+  "self[1]=table.concat(self,\";\")\n"
+  "for n=2,#self do self[n]=nil end\n"
+  "return self[1]\n"
+  "end\n"
+  "\n"
+  "function CSS:border(style,color,width)\n"
+  "style=style or\"solid\"\n"
+  "color=color or\"default\"\n"
+  "\n"
+  "if style~=\"solid\"and color~=\"default\"and width then\n"
+  "self:f(\"border:%spx %s %s\",width,style,color)\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "if style~=\"solid\"then\n"
+  "self:f(\"border-style:%s\",style)\n"
+  "end\n"
+  "if color~=\"default\"then\n"
+  "self:f(\"border-color:%s\",color)\n"
+  "end\n"
+  "if width then\n"
+  "self:f(\"border-width:%spx\",width)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function CSS:radius(r)\n"
+  "if r and r>0 then\n"
+  "r=math.floor(r)\n"
+  "self:f(\"-webkit-border-radius:%dpx\",r)\n"
+  "self:f(\"-moz-border-radius:%dpx\",r)\n"
+  "self:f(\"border-radius:%dpx\",r)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function CSS:radiusCorner(r,lr,tb)\n"
+  "r=math.floor(r)\n"
+  "self:f(\"-webkit-border-%s-%s-radius:%dpx\",tb,lr,r)\n"
+  "self:f(\"-moz-border-radius-%s%s:%dpx;\",tb,lr,r)\n"
+  "self:f(\"border-%s-%s-radius:%dpx\",tb,lr,r)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local GC=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:initialize(w,h)\n"
+  "self.out={}\n"
+  "self.iprops={}\n"
+  "\n"
+  "self.pxi=function(x)return math.floor(x+0.5)end\n"
+  "self.canvasClass=\"content\"\n"
+  "\n"
+  "\n"
+  "self.fillColor=\"#000\"\n"
+  "self.strokeColor=\"default\"\n"
+  "self.bgColor=\"#fff\"\n"
+  "self.lineWidth=2\n"
+  "self.arrowLength=9\n"
+  "self.arrowWidth=6\n"
+  "self.fontSize=14\n"
+  "self.lineHeight=16\n"
+  "self.width=w\n"
+  "self.height=h\n"
+  "\n"
+  "self.mtOpts={}\n"
+  "function self.mtOpts.__index(t,k)\n"
+  "return t._opts[k]or self[k]\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function GC:round(x)\n"
+  "return self.pxi and self.pxi(x)or x\n"
+  "end\n"
+  "\n"
+  "function GC:round2(x)\n"
+  "return self:round(x*2)/2\n"
+  "end\n"
+  "\n"
+  "function GC:opts(opts)\n"
+  "assert(opts)\n"
+  "return setmetatable({_opts=opts},self.mtOpts)\n"
+  "end\n"
+  "\n"
+  "function GC:setSize(w,h)\n"
+  "self.width=self:round(w)\n"
+  "self.height=self:round(h)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:iProp(css,name,...)\n"
+  "local value=sprintf(...)\n"
+  "local i=self.iprops[name]\n"
+  "if not i then\n"
+  "self.iprops[name]=value\n"
+  "elseif i~=value then\n"
+  "css:f(\"%s:%s\",name,value)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:block(x,y,w,h,css,txt,o)\n"
+  "css:f(\"left:%spx\",x)\n"
+  "css:f(\"top:%spx\",y)\n"
+  "\n"
+  "if w>0 then css:f(\"right:%spx\",self.width-x-w)end\n"
+  "if h>0 then css:f(\"bottom:%spx\",self.height-y-h)end\n"
+  "\n"
+  "if not txt and h<self.lineHeight then\n"
+  "\n"
+  "\n"
+  "\n"
+  "css:f(\"%s\",\"line-height:0\")\n"
+  "end\n"
+  "\n"
+  "local cls=o and o.class and\" class=\"..htmlQuoteAttr(o.class)\n"
+  "local html=sprintf('<div%s style=\"%s\">%s</div>\\n',\n"
+  "cls or\"\",css:string(),txt or\"\")\n"
+  "table.insert(self.out,html)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function GC:strokeX(x,y,w,clr)\n"
+  "local css=CSS:new()\n"
+  "\n"
+  "local lh=self:round(w*3)\n"
+  "css:f(\"font:%spx Verdana, Arial\",lh)\n"
+  "css:f(\"line-height:%spx\",lh)\n"
+  "css:f(\"color:%s\",clr or self.fillColor)\n"
+  "\n"
+  "if self.pxi then\n"
+  "x,y=self:round(x-lh/3),self:round(y-lh/2.2)\n"
+  "end\n"
+  "self:block(x+0.5,y-3,0,0,css,\"x\")\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function GC:emitHTML(...)\n"
+  "table.insert(self.out,sprintf(...))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:beginTransform(deg,xscale,ox,oy)\n"
+  "local scaleStr=xscale and\" scale(\"..xscale..\",1)\"or\"\"\n"
+  "local pfmt='-webkit-transform:rotate(%ddeg)%s;'..\n"
+  "'-webkit-transform-origin:%fpx %fpx;'\n"
+  "local props=sprintf(pfmt,deg,scaleStr,ox,oy)\n"
+  "\n"
+  "self:emitHTML('<div style=\"position:relative;%s%s%s\">',\n"
+  "props,\n"
+  "props:gsub(\"webkit\",\"moz\"),\n"
+  "props:gsub(\"webkit\",\"ms\"),\n"
+  "props:gsub(\"webkit\",\"o\"))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function GC:endTransform()\n"
+  "self:emitHTML(\"</div>\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:wedge(x,y,len,a,d,flip,color)\n"
+  "local x2,y2=self:round2(x+len),self:round2(y+a+d)\n"
+  "x,y,a=self:round2(x),self:round2(y),self:round2(a)\n"
+  "d=self:round2(y2-y-a)\n"
+  "len=self:round2(x2-x)\n"
+  "color=color or self.strokeColor\n"
+  "\n"
+  "local t,r,b,l={a},{math.abs(len),true},{d},{0}\n"
+  "\n"
+  "if len<0 then r,l=l,r end\n"
+  "if flip then t,r,b,l=l,b,r,t end\n"
+  "\n"
+  "local css=CSS:new()\n"
+  "\n"
+  "if color==\"default\"then\n"
+  "\n"
+  "for k,v in opairs{top=t,right=r,bottom=b,left=l}do\n"
+  "if v[2]then\n"
+  "css:f(\"border-%s-width: %spx\",k,v[1],color)\n"
+  "elseif v[1]~=0 then\n"
+  "css:f(\"border-%s: %spx solid transparent\",k,v[1])\n"
+  "end\n"
+  "end\n"
+  "else\n"
+  "\n"
+  "css:f(\"border:%spx solid transparent\",a)\n"
+  "for k,v in opairs{top=t,right=r,bottom=b,left=l}do\n"
+  "if v[2]then\n"
+  "css:f(\"border-%s: %dpx solid %s\",k,math.floor(v[1]),color)\n"
+  "elseif v[1]~=a then\n"
+  "css:f(\"border-%s-width: %spx\",k,v[1])\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:block(x-l[1],y-t[1],0,0,css)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function corner(x,y,pt)\n"
+  "local lr=pt[1]>x and\"right\"or\"left\"\n"
+  "local tb=pt[2]>y and\"bottom\"or\"top\"\n"
+  "return lr,tb\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function setRadius(css,x,y,radius)\n"
+  "if type(radius)==\"table\"then\n"
+  "for _,p in ipairs(radius)do\n"
+  "css:radiusCorner(radius.value,corner(x,y,p))\n"
+  "end\n"
+  "else\n"
+  "css:radius(radius)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:rect(x,y,w,h,opts)\n"
+  "local o=self:opts(opts)\n"
+  "local p=self:round(o.lineWidth)\n"
+  "local r=tonumber(o.radius)\n"
+  "local css=CSS:new()\n"
+  "local internalHeight=h\n"
+  "local html\n"
+  "\n"
+  "setRadius(css,x,y,o.radius)\n"
+  "\n"
+  "\n"
+  "local ss=o.strokeStyle\n"
+  "if ss and ss~=\"transparent\"and p>0 then\n"
+  "local c=o.strokeColor\n"
+  "x,y,w,h=x-p/2,y-p/2,w+p,h+p\n"
+  "internalHeight=internalHeight-p\n"
+  "\n"
+  "if c~=\"default\"and ss~=\"default\"then\n"
+  "css:f(\"border:%spx %s %s\",p,o.strokeStyle or\"solid\",c)\n"
+  "else\n"
+  "css:f(\"border-width:%spx\",p)\n"
+  "if ss~=\"default\"then\n"
+  "css:f(\"border-style:%s\",ss)\n"
+  "end\n"
+  "if c~=\"default\"then\n"
+  "css:f(\"border-color:%s\",c)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "for _,b in ipairs(o.omitBorders or{})do\n"
+  "css:f(\"border-%s:0\",b)\n"
+  "end\n"
+  "else\n"
+  "p=0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local x2,y2=self:round(x+w),self:round(y+h)\n"
+  "x,y=self:round(x),self:round(y)\n"
+  "w,h=x2-x,y2-y\n"
+  "\n"
+  "if o.fill then\n"
+  "css:f(\"background-color:%s\",o.fillColor)\n"
+  "end\n"
+  "\n"
+  "if o.shadow then\n"
+  "css:f(\"-webkit-box-shadow: 2px 2px 4px #888\")\n"
+  "css:f(\"-moz-box-shadow: 2px 2px 4px #888\")\n"
+  "end\n"
+  "\n"
+  "if o.text and o.text~=\"\"then\n"
+  "local cntBR\n"
+  "html=htmlEscape(o.text or\"\"):gsub(\"\\n$\",\"\")\n"
+  "self:iProp(css,\"white-space\",\"nowrap\")\n"
+  "html,cntBR=html:gsub(\"\\n\",\"<br>\")\n"
+  "\n"
+  "if o.textColor then\n"
+  "css:f(\"color:%s\",o.textColor)\n"
+  "end\n"
+  "if o.textAlign~=\"left\"then\n"
+  "css:f(\"text-align:%s\",o.textAlign or\"center\")\n"
+  "end\n"
+  "if o.fontSize then\n"
+  "self:iProp(css,\"font-size\",\"%spx\",o.fontSize)\n"
+  "end\n"
+  "\n"
+  "if o.textBG then\n"
+  "html=sprintf('<span style=\"background-color:%s\">%s</span>',\n"
+  "o.textBG,html)\n"
+  "end\n"
+  "\n"
+  "local lh=o.lineHeight\n"
+  "self:iProp(css,\"line-height\",\"%spx\",lh)\n"
+  "\n"
+  "\n"
+  "\n"
+  "local tp=self:round((internalHeight-(cntBR+1)*lh)/2)\n"
+  "if tp>0 then\n"
+  "css:f(\"padding-top:%spx\",tp)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if o.css then\n"
+  "css:f(\"%s\",o.css)\n"
+  "end\n"
+  "\n"
+  "self:block(x,y,w,h,css,html,o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:fillRect(x,y,w,h,color)\n"
+  "self:rect(x,y,w,h,\n"
+  "{fill=true,fillColor=color or self.fillColor,strokeStyle=false})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function roundCorner(css,x,y,w,h,lw,radius,p)\n"
+  "if p.round then\n"
+  "local r=math.min(radius,w+lw/2,h+lw/2)\n"
+  "css:radiusCorner(r,corner(x,y,p))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function sideTo(a,b)\n"
+  "return a[1]<b[1]and\"right\"or\n"
+  "a[1]>b[1]and\"left\"or\n"
+  "a[2]<b[2]and\"bottom\"or\n"
+  "a[2]>b[2]and\"top\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function chooseSides(a,b,c,d)\n"
+  "local incr=1\n"
+  "local bb,cc,dd=b\n"
+  "\n"
+  "if b==a then\n"
+  "bb=nil\n"
+  "elseif c then\n"
+  "local r,i=table.unpack((c-b)/(b-a))\n"
+  "if i==0 then\n"
+  "\n"
+  "\n"
+  "if r>=0 then\n"
+  "\n"
+  "bb=nil\n"
+  "else\n"
+  "\n"
+  "end\n"
+  "\n"
+  "elseif r==0 then\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "cc,incr=c,2\n"
+  "if c.round then\n"
+  "cc=(b+c)/2\n"
+  "cc.mid=true\n"
+  "incr=1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "if d then\n"
+  "local r,i=table.unpack((c-d)/(b-a))\n"
+  "if i==0 and r>=(d.round and 2 or 1)then\n"
+  "cc=c\n"
+  "dd=c+(a-b)\n"
+  "incr=3\n"
+  "if dd~=d then\n"
+  "dd.mid=true\n"
+  "incr=2\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return incr,bb,cc,dd\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function aligned(a,b,c)\n"
+  "if a==b then\n"
+  "return true\n"
+  "end\n"
+  "local r,i=table.unpack((c-a)/(b-a))\n"
+  "return i==0 and r>=1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:path(path)\n"
+  "local radius=tonumber(path.radius)\n"
+  "local borderStyle=path.lineStyle or\"solid\"\n"
+  "local color=path.color or self.strokeColor\n"
+  "local lw=path.lineWidth or self.lineWidth\n"
+  "local hlw=lw/2\n"
+  "\n"
+  "\n"
+  "\n"
+  "local pts={}\n"
+  "for _,pt in ipairs(path)do\n"
+  "\n"
+  "local p=Point(self:round(pt[1]-hlw)+hlw,\n"
+  "self:round(pt[2]-hlw)+hlw)\n"
+  "p.round=radius and(not pt.flags or pt.flags:match\"r\")\n"
+  "table.insert(pts,p)\n"
+  "end\n"
+  "\n"
+  "local a=pts[1]\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "if a==pts[#pts]and a.round and not aligned(pts[#pts-1],a,pts[2])then\n"
+  "a=(a+pts[2])/2\n"
+  "pts[1]=a\n"
+  "table.insert(pts,a)\n"
+  "end\n"
+  "a.round=false\n"
+  "pts[#pts].round=false\n"
+  "\n"
+  "local n=2\n"
+  "while pts[n]do\n"
+  "\n"
+  "\n"
+  "\n"
+  "local incr,b,c,d=chooseSides(a,pts[n],pts[n+1],pts[n+2])\n"
+  "n=n+incr\n"
+  "\n"
+  "\n"
+  "\n"
+  "if b then\n"
+  "local css=CSS:new()\n"
+  "local oc=c or b\n"
+  "local x,w=range(a[1],oc[1])\n"
+  "local y,h=range(a[2],oc[2])\n"
+  "\n"
+  "\n"
+  "local grow={top=hlw,bottom=hlw,left=hlw,right=hlw}\n"
+  "\n"
+  "css:border(borderStyle,color)\n"
+  "\n"
+  "if d then\n"
+  "\n"
+  "css:f(\"border-width:%spx\",lw)\n"
+  "css:f(\"border-%s-width:0\",sideTo(b,a))\n"
+  "roundCorner(css,x,y,w,h,lw,radius,b)\n"
+  "roundCorner(css,x,y,w,h,lw,radius,c)\n"
+  "\n"
+  "if a.mid and d.mid then grow[sideTo(b,a)]=0 end\n"
+  "elseif c then\n"
+  "\n"
+  "\n"
+  "css:f(\"border-%s-width:%spx\",sideTo(a,b),lw)\n"
+  "css:f(\"border-%s-width:%spx\",sideTo(c,b),lw)\n"
+  "roundCorner(css,x,y,w,h,lw,radius,b)\n"
+  "\n"
+  "if a.mid then grow[sideTo(b,a)]=0 end\n"
+  "if c.mid then grow[sideTo(b,c)]=0 end\n"
+  "else\n"
+  "\n"
+  "css:f(\"border-%s-width:%spx\",w>0 and\"top\"or\"left\",lw)\n"
+  "if a.mid then grow[sideTo(b,a)]=0 end\n"
+  "if b.mid then grow[sideTo(a,b)]=0 end\n"
+  "end\n"
+  "\n"
+  "self:block(x-grow.left,\n"
+  "y-grow.top,\n"
+  "w+grow.left+grow.right,\n"
+  "h+grow.top+grow.bottom,css,nil,path)\n"
+  "\n"
+  "a=d or c or b\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function GC:circle(x,y,radius,opts)\n"
+  "opts=opts or{}\n"
+  "local lw=opts.lineWidth or self.lineWidth\n"
+  "local borderStyle=opts.strokeStyle or self.strokeStyle or\"solid\"\n"
+  "local color=opts.strokeColor or self.strokeColor or\"#000\"\n"
+  "local w=radius*2+lw\n"
+  "local css=CSS:new()\n"
+  "\n"
+  "css:border(borderStyle,color,lw)\n"
+  "css:radius(radius+lw)\n"
+  "if opts.fill then\n"
+  "css:r(\"background-color:%s\",opts.fillColor or self.fillColor)\n"
+  "end\n"
+  "self:block(self:round2(x-radius-lw/2),self:round2(y-radius-lw/2),w,w,css)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:arrow(pt,ptFrom,o)\n"
+  "o=o or{}\n"
+  "local x,y=table.unpack(pt)\n"
+  "local xmul=pt[1]<ptFrom[1]and 1 or-1\n"
+  "local len=o.arrowLength or self.arrowLength\n"
+  "local wid=o.arrowWidth or self.arrowWidth\n"
+  "local lw=o.lineWidth or self.lineWidth\n"
+  "len=len*xmul\n"
+  "\n"
+  "if self.pxi then\n"
+  "\n"
+  "\n"
+  "y=self.pxi(y)+0.5\n"
+  "end\n"
+  "\n"
+  "local a=wid/2\n"
+  "local wa=o.noTop and 0 or a\n"
+  "local wd=o.noBottom and 0 or a\n"
+  "local setback=(xmul+len/a)/2\n"
+  "\n"
+  "self:wedge(x,y,len,wa,wd,nil,o.color)\n"
+  "if o.open then\n"
+  "local dx=math.floor(lw*math.sqrt(1+(len*len)/(a*a))+0.5)*xmul\n"
+  "if math.abs(dx)>2 then\n"
+  "local waNew=math.floor(wa*(len-dx+xmul)/len+0.5)\n"
+  "local r=waNew/wa\n"
+  "len,wa,wd=len*r,wa*r,wd*r\n"
+  "end\n"
+  "self:wedge(x+dx,y,len,wa,wd,nil,o.bgcolor or self.bgColor)\n"
+  "end\n"
+  "local adj=(o.noTop or o.noBottom)and xmul/2 or setback\n"
+  "pt[1]=pt[1]+adj*lw\n"
+  "return adj\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function GC:fillText(x,y,txt)\n"
+  "local css=CSS:new()\n"
+  "\n"
+  "self:iProp(css,\"font-size\",\"%spx\",self.fontSize)\n"
+  "self:iProp(css,\"line-height\",\"%spx\",self.lineHeight)\n"
+  "self:iProp(css,\"color\",\"%s\",self.fillColor)\n"
+  "self:iProp(css,\"white-space\",\"nowrap\")\n"
+  "\n"
+  "if self.pxi then\n"
+  "x,y=self:round(x),self:round(y)\n"
+  "end\n"
+  "self:block(x,y,0,0,css,htmlEscape(txt))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local html2dStyle=[[\n"
+  ".html2d { position: relative; }\n"
+  ".html2d div { position: absolute; border-width: 0; border-style: solid; }\n"
+  ".html2d div div { position: absolute; border-width: 0; border-style: solid; }\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function GC:genHTML(props)\n"
+  "\n"
+  "\n"
+  "\n"
+  "if not(self.width and self.height)then return\"\"end\n"
+  "\n"
+  "local css=CSS:new()\n"
+  "css:f(\"width:%spx\",self.width)\n"
+  "css:f(\"height:%spx\",self.height)\n"
+  "for k,v in opairs(self.iprops)do\n"
+  "css:f(\"%s:%s\",k,v)\n"
+  "end\n"
+  "css:f(\"%s\",props or'')\n"
+  "\n"
+  "local diagramStyle=\"\"\n"
+  "if self.float then\n"
+  "diagramStyle=sprintf(' style=\"float:%s\"',self.float)\n"
+  "end\n"
+  "\n"
+  "local class=table.concat({\"html2d\",self.canvasClass},\" \")\n"
+  "local divs=\n"
+  "'<div class=diagram'..diagramStyle..'>\\n'..\n"
+  "'<div class='..htmlQuoteAttr(class)..' style=\"'..css:string()..'\">\\n'\n"
+  "\n"
+  "local html=divs..table.concat(self.out,\"\")..\"</div>\\n</div>\\n\"\n"
+  "\n"
+  "return html,html2dStyle\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function GC:genTree(...)\n"
+  "local html,css=self:genHTML(...)\n"
+  "return{E._html{html},E.head{E.style{_once=\"html2d\",type=\"text/css\",css}}}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GC.htmlEscape=htmlEscape\n"
+  "\n"
+  "\n"
+  "return GC\n"
+  "";
+
+static const unsigned char data11[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local memoize=require\"memoize\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local TYPE=\"_type\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local E=memoize.newTable(function(e)return function(t)t._type=e;return t end end)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function treeConcat(tree)\n"
+  "local o={}\n"
+  "\n"
+  "local function fc(node)\n"
+  "if type(node)==\"table\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "fc(child)\n"
+  "end\n"
+  "else\n"
+  "table.insert(o,tostring(node))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "fc(tree)\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function visitElems(node,f,ofType)\n"
+  "if type(node)==\"table\"then\n"
+  "if ofType==node._type or not ofType and type(node._type)==\"string\"then\n"
+  "f(node)\n"
+  "end\n"
+  "for n=1,#node do\n"
+  "visitElems(node[n],f,ofType)\n"
+  "end\n"
+  "end\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "E=E,\n"
+  "TYPE=TYPE,\n"
+  "treeConcat=treeConcat,\n"
+  "visitElems=visitElems\n"
+  "}\n"
+  "";
+
+static const unsigned char data12[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function callTable(t,k)\n"
+  "return t[k]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newTable(f,weak)\n"
+  "local function index(t,k)\n"
+  "local x=f(k)\n"
+  "t[k]=x\n"
+  "return x\n"
+  "end\n"
+  "return setmetatable({},{__mode=weak,__index=index,__call=callTable})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local NIL={}\n"
+  "\n"
+  "local combine=newTable(function(f)\n"
+  "return newTable(function(a)\n"
+  "if a==NIL then a=nil end\n"
+  "return function(...)return f(a,...)end\n"
+  "end)\n"
+  "end)\n"
+  "\n"
+  "local function curry(f,...)\n"
+  "for n=1,select('#',...)do\n"
+  "local v=select(n,...)\n"
+  "f=combine[f][v==nil and NIL or v]\n"
+  "end\n"
+  "return f\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newFunction(f)\n"
+  "local values=newTable(function(f)return table.pack(f())end)\n"
+  "return function(...)\n"
+  "local o=values[curry(f,...)]\n"
+  "return table.unpack(o,1,o.n)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "newTable=newTable,\n"
+  "newFunction=newFunction,\n"
+  "curry=curry\n"
+  "}\n"
+  "";
+
+static const unsigned char data13[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function defaultCmp(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local function opairs(tbl,cmp)\n"
+  "local keys={}\n"
+  "for k in pairs(tbl)do\n"
+  "keys[#keys+1]=k\n"
+  "end\n"
+  "table.sort(keys,cmp or defaultCmp)\n"
+  "\n"
+  "local n=1\n"
+  "\n"
+  "return function()\n"
+  "local k=keys[n]\n"
+  "if k~=nil then\n"
+  "n=n+1\n"
+  "return k,tbl[k]\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return opairs\n"
+  "";
+
+static const unsigned char data14[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Html2D=require\"html2d\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local E=doctree.E\n"
+  "\n"
+  "local sprintf=string.format\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function num(n)\n"
+  "local s=sprintf(\"%.2f\",n):gsub(\"%.\?0+$\",\"\")\n"
+  "return s==\"-0\"and\"0\"or s\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local classNames={}\n"
+  "local classDecls={}\n"
+  "\n"
+  "local function className(decl)\n"
+  "local name=classNames[decl]\n"
+  "if not name then\n"
+  "local h=5381\n"
+  "for ii=1,#decl do\n"
+  "h=(h*33+decl:byte(ii))%4294967296\n"
+  "end\n"
+  "local base=sprintf(\"g%08x\",h)\n"
+  "name=base\n"
+  "local n=1\n"
+  "while classDecls[name]do\n"
+  "n=n+1\n"
+  "name=base..\"-\"..n\n"
+  "end\n"
+  "classNames[decl]=name\n"
+  "classDecls[name]=decl\n"
+  "end\n"
+  "return name\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joinClasses(...)\n"
+  "local t={}\n"
+  "for n=1,select(\"#\",...)do\n"
+  "local c=select(n,...)\n"
+  "if c and c~=\"\"then\n"
+  "t[#t+1]=c\n"
+  "end\n"
+  "end\n"
+  "return table.concat(t,\" \")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Props={}\n"
+  "Props.__index=Props\n"
+  "\n"
+  "local function newProps()\n"
+  "return setmetatable({},Props)\n"
+  "end\n"
+  "\n"
+  "function Props:f(...)\n"
+  "local prop=sprintf(...):gsub(\";+$\",\"\")\n"
+  "if prop~=\"\"then\n"
+  "table.insert(self,prop)\n"
+  "end\n"
+  "return prop\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function strokeProps(props,color,style,lw)\n"
+  "props:f(\"stroke-width:%s\",num(lw))\n"
+  "if style==\"dotted\"then\n"
+  "props:f(\"stroke-dasharray:0 %s;stroke-linecap:round\",num(lw*2))\n"
+  "elseif style==\"dashed\"then\n"
+  "props:f(\"stroke-dasharray:%s %s;stroke-linecap:butt\",num(lw*3),num(lw*2))\n"
+  "end\n"
+  "if color==nil or color==\"default\"then\n"
+  "return\"ds\"\n"
+  "end\n"
+  "props:f(\"stroke:%s\",color)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local PathData={}\n"
+  "PathData.__index=PathData\n"
+  "\n"
+  "local function newPathData()\n"
+  "return setmetatable({},PathData)\n"
+  "end\n"
+  "\n"
+  "function PathData:moveTo(x,y)\n"
+  "table.insert(self,\"M\"..num(x)..\" \"..num(y))\n"
+  "self.x,self.y=x,y\n"
+  "end\n"
+  "\n"
+  "function PathData:lineTo(x,y)\n"
+  "if y==self.y and x~=self.x then\n"
+  "table.insert(self,\"H\"..num(x))\n"
+  "elseif x==self.x and y~=self.y then\n"
+  "table.insert(self,\"V\"..num(y))\n"
+  "elseif x~=self.x or y~=self.y then\n"
+  "table.insert(self,\"L\"..num(x)..\" \"..num(y))\n"
+  "end\n"
+  "self.x,self.y=x,y\n"
+  "end\n"
+  "\n"
+  "function PathData:arcTo(r,sweep,x,y)\n"
+  "table.insert(self,sprintf(\"A%s %s 0 0 %d %s %s\",\n"
+  "num(r),num(r),sweep,num(x),num(y)))\n"
+  "self.x,self.y=x,y\n"
+  "end\n"
+  "\n"
+  "function PathData:close()\n"
+  "table.insert(self,\"Z\")\n"
+  "end\n"
+  "\n"
+  "function PathData:string()\n"
+  "return table.concat(self)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function dist(a,b)\n"
+  "return math.sqrt((b[1]-a[1])^2+(b[2]-a[2])^2)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function corner(pd,a,v,b,r,ra,rb)\n"
+  "local ux,uy=v[1]-a[1],v[2]-a[2]\n"
+  "local wx,wy=b[1]-v[1],b[2]-v[2]\n"
+  "local cross=ux*wy-uy*wx\n"
+  "r=math.min(r or 0,ra,rb)\n"
+  "if r<=0 or cross==0 or ux*wx+uy*wy~=0 then\n"
+  "pd:lineTo(v[1],v[2])\n"
+  "return\n"
+  "end\n"
+  "local la,lb=dist(a,v),dist(v,b)\n"
+  "pd:lineTo(v[1]-ux/la*r,v[2]-uy/la*r)\n"
+  "pd:arcTo(r,cross>0 and 1 or 0,v[1]+wx/lb*r,v[2]+wy/lb*r)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function between(a,b,c)\n"
+  "local ux,uy=b[1]-a[1],b[2]-a[2]\n"
+  "local wx,wy=c[1]-b[1],c[2]-b[2]\n"
+  "return ux*wy-uy*wx==0 and ux*wx+uy*wy>0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function roundRectData(x,y,w,h,r)\n"
+  "local pd=newPathData()\n"
+  "local x2,y2=x+w,y+h\n"
+  "pd:moveTo(x+r[1],y)\n"
+  "pd:lineTo(x2-r[2],y)\n"
+  "if r[2]>0 then pd:arcTo(r[2],1,x2,y+r[2])end\n"
+  "pd:lineTo(x2,y2-r[3])\n"
+  "if r[3]>0 then pd:arcTo(r[3],1,x2-r[3],y2)end\n"
+  "pd:lineTo(x+r[4],y2)\n"
+  "if r[4]>0 then pd:arcTo(r[4],1,x,y2-r[4])end\n"
+  "pd:lineTo(x,y+r[1])\n"
+  "if r[1]>0 then pd:arcTo(r[1],1,x+r[1],y)end\n"
+  "pd:close()\n"
+  "return pd:string()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Svg2D=Html2D:basicNew()\n"
+  "\n"
+  "\n"
+  "function Svg2D:initialize(w,h)\n"
+  "Html2D.initialize(self,w,h)\n"
+  "self.rules={}\n"
+  "self.ruleNames={}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:propClass(props)\n"
+  "if not props[1]then\n"
+  "return nil\n"
+  "end\n"
+  "local decl=table.concat(props,\";\")\n"
+  "local name=className(decl)\n"
+  "if not self.rules[name]then\n"
+  "self.rules[name]=sprintf(\"svg.svg2d .%s{%s}\",name,decl)\n"
+  "table.insert(self.ruleNames,name)\n"
+  "end\n"
+  "return name\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:elem(tag,attrs,class,content)\n"
+  "local o={\"<\",tag}\n"
+  "for n=1,#attrs,2 do\n"
+  "o[#o+1]=sprintf(' %s=\"%s\"',attrs[n],attrs[n+1])\n"
+  "end\n"
+  "if class and class~=\"\"then\n"
+  "o[#o+1]=sprintf(' class=\"%s\"',class)\n"
+  "end\n"
+  "if content then\n"
+  "o[#o+1]=\">\"..content..\"</\"..tag..\">\\n\"\n"
+  "else\n"
+  "o[#o+1]=\"/>\\n\"\n"
+  "end\n"
+  "table.insert(self.out,table.concat(o))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:classRadius()\n"
+  "return 0.6*self.fontSize\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:textLines(x,top,lh,lines,anchor,props)\n"
+  "if anchor~=\"start\"then\n"
+  "props:f(\"text-anchor:%s\",anchor)\n"
+  "end\n"
+  "local class=self:propClass(props)\n"
+  "\n"
+  "if#lines==1 then\n"
+  "self:elem(\"text\",{\"x\",num(x),\"y\",num(top+lh/2)},class,lines[1])\n"
+  "else\n"
+  "local spans={}\n"
+  "for n,line in ipairs(lines)do\n"
+  "spans[n]=sprintf('<tspan x=\"%s\" y=\"%s\">%s</tspan>',\n"
+  "num(x),num(top+(n-0.5)*lh),line)\n"
+  "end\n"
+  "self:elem(\"text\",{},class,table.concat(spans))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:rect(x,y,w,h,opts)\n"
+  "local o=self:opts(opts)\n"
+  "local p=self:round(o.lineWidth)\n"
+  "local props=newProps()\n"
+  "local strokes=newProps()\n"
+  "local ds\n"
+  "\n"
+  "local ss=o.strokeStyle\n"
+  "if ss and ss~=\"transparent\"and p>0 then\n"
+  "ds=strokeProps(strokes,o.strokeColor,ss,p)\n"
+  "else\n"
+  "p=0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local x1,y1=self:round(x-p/2),self:round(y-p/2)\n"
+  "local x2,y2=self:round(x+w+p/2),self:round(y+h+p/2)\n"
+  "local rx,ry=x1+p/2,y1+p/2\n"
+  "local rw,rh=math.max(0,x2-x1-p),math.max(0,y2-y1-p)\n"
+  "\n"
+  "if o.fill then\n"
+  "props:f(\"fill:%s\",o.fillColor)\n"
+  "end\n"
+  "if o.shadow then\n"
+  "props:f(\"filter:drop-shadow(2px 2px 2px #888)\")\n"
+  "end\n"
+  "if o.css then\n"
+  "props:f(\"%s\",o.css)\n"
+  "end\n"
+  "\n"
+  "if p>0 or props[1]or o.class then\n"
+  "\n"
+  "local radii\n"
+  "if type(o.radius)==\"table\"then\n"
+  "local r=(\" \"..tostring(o.class)..\" \"):match(\" round \")and self:classRadius()or 0\n"
+  "radii={r,r,r,r}\n"
+  "for _,pt in ipairs(o.radius)do\n"
+  "local n=pt[2]>y and(pt[1]>x and 3 or 4)or(pt[1]>x and 2 or 1)\n"
+  "radii[n]=o.radius.value\n"
+  "end\n"
+  "else\n"
+  "local r=math.floor(tonumber(o.radius)or 0)\n"
+  "radii={r,r,r,r}\n"
+  "end\n"
+  "for n=1,4 do\n"
+  "radii[n]=math.max(0,math.min(radii[n],rw/2,rh/2))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local omit={}\n"
+  "for _,side in ipairs(o.omitBorders or{})do\n"
+  "omit[side]=true\n"
+  "end\n"
+  "local whole=not next(omit)\n"
+  "if whole then\n"
+  "for _,prop in ipairs(strokes)do\n"
+  "table.insert(props,prop)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local class=joinClasses(o.class,self:propClass(props),whole and ds)\n"
+  "if radii[1]==radii[2]and radii[1]==radii[3]and radii[1]==radii[4]then\n"
+  "local attrs={\"x\",num(rx),\"y\",num(ry),\"width\",num(rw),\"height\",num(rh)}\n"
+  "if radii[1]>0 then\n"
+  "table.insert(attrs,\"rx\")\n"
+  "table.insert(attrs,num(radii[1]))\n"
+  "end\n"
+  "self:elem(\"rect\",attrs,class)\n"
+  "else\n"
+  "self:elem(\"path\",{\"d\",roundRectData(rx,ry,rw,rh,radii)},class)\n"
+  "end\n"
+  "\n"
+  "if not whole and p>0 then\n"
+  "local pd=newPathData()\n"
+  "local rx2,ry2=rx+rw,ry+rh\n"
+  "for _,s in ipairs{{\"top\",rx,ry,rx2,ry},{\"right\",rx2,ry,rx2,ry2},\n"
+  "{\"bottom\",rx,ry2,rx2,ry2},{\"left\",rx,ry,rx,ry2}}do\n"
+  "if not omit[s[1]]then\n"
+  "pd:moveTo(s[2],s[3])\n"
+  "pd:lineTo(s[4],s[5])\n"
+  "end\n"
+  "end\n"
+  "if pd[1]then\n"
+  "self:elem(\"path\",{\"d\",pd:string()},joinClasses(self:propClass(strokes),ds))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if o.text and o.text~=\"\"then\n"
+  "local html=self.htmlEscape(o.text):gsub(\"\\n$\",\"\")\n"
+  "local lines={}\n"
+  "for line in(html..\"\\n\"):gmatch(\"([^\\n]*)\\n\")do\n"
+  "lines[#lines+1]=line\n"
+  "end\n"
+  "\n"
+  "local tprops=newProps()\n"
+  "if o.textColor then\n"
+  "tprops:f(\"fill:%s\",o.textColor)\n"
+  "end\n"
+  "if o.fontSize then\n"
+  "self:iProp(tprops,\"font-size\",\"%spx\",o.fontSize)\n"
+  "end\n"
+  "if o.textBG then\n"
+  "tprops:f(\"stroke:%s;stroke-width:4px;stroke-linejoin:round;paint-order:stroke\",\n"
+  "o.textBG)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local lh=o.lineHeight\n"
+  "local tp=self:round((h-p-#lines*lh)/2)\n"
+  "local top=y1+p+math.max(tp,0)\n"
+  "\n"
+  "local align=o.textAlign or\"center\"\n"
+  "if align==\"left\"then\n"
+  "self:textLines(x1+p,top,lh,lines,\"start\",tprops)\n"
+  "elseif align==\"right\"then\n"
+  "self:textLines(x2-p,top,lh,lines,\"end\",tprops)\n"
+  "else\n"
+  "self:textLines((x1+x2)/2,top,lh,lines,\"middle\",tprops)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:path(path)\n"
+  "local radius=tonumber(path.radius)\n"
+  "local color=path.color or self.strokeColor\n"
+  "local lw=path.lineWidth or self.lineWidth\n"
+  "local hlw=lw/2\n"
+  "\n"
+  "local pts={}\n"
+  "for _,pt in ipairs(path)do\n"
+  "local p={self:round(pt[1]-hlw)+hlw,\n"
+  "self:round(pt[2]-hlw)+hlw}\n"
+  "p.round=radius and(not pt.flags or pt.flags:match\"r\")\n"
+  "local q=pts[#pts]\n"
+  "if not(q and q[1]==p[1]and q[2]==p[2])then\n"
+  "if pts[2]and between(pts[#pts-1],q,p)then\n"
+  "pts[#pts]=p\n"
+  "else\n"
+  "pts[#pts+1]=p\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "if#pts<2 then\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local closed=#pts>2 and pts[1][1]==pts[#pts][1]and pts[1][2]==pts[#pts][2]\n"
+  "if closed then\n"
+  "table.remove(pts)\n"
+  "if#pts>2 and between(pts[#pts],pts[1],pts[2])then\n"
+  "table.remove(pts,1)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local n=#pts\n"
+  "local function at(i)\n"
+  "return pts[(i-1)%n+1]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function radiusAt(i)\n"
+  "local p=at(i)\n"
+  "return p.round and(closed or(i>1 and i<n))and radius or 0\n"
+  "end\n"
+  "local function room(i)\n"
+  "local len=dist(at(i),at(i+1))\n"
+  "return(radiusAt(i)>0 and radiusAt(i+1)>0)and len/2 or len\n"
+  "end\n"
+  "\n"
+  "local pd=newPathData()\n"
+  "if closed then\n"
+  "local a,b=pts[1],pts[2]\n"
+  "pd:moveTo((a[1]+b[1])/2,(a[2]+b[2])/2)\n"
+  "for i=2,n+1 do\n"
+  "corner(pd,at(i-1),at(i),at(i+1),radiusAt(i),room(i-1),room(i))\n"
+  "end\n"
+  "pd:close()\n"
+  "else\n"
+  "pd:moveTo(pts[1][1],pts[1][2])\n"
+  "for i=2,n-1 do\n"
+  "corner(pd,pts[i-1],pts[i],pts[i+1],radiusAt(i),room(i-1),room(i))\n"
+  "end\n"
+  "pd:lineTo(pts[n][1],pts[n][2])\n"
+  "end\n"
+  "\n"
+  "local props=newProps()\n"
+  "local ds=strokeProps(props,color,path.lineStyle,lw)\n"
+  "self:elem(\"path\",{\"d\",pd:string()},joinClasses(path.class,self:propClass(props),ds))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Svg2D:circle(x,y,radius,opts)\n"
+  "opts=opts or{}\n"
+  "local lw=opts.lineWidth or self.lineWidth\n"
+  "local style=opts.strokeStyle or self.strokeStyle or\"solid\"\n"
+  "local color=opts.strokeColor or self.strokeColor or\"#000\"\n"
+  "local props=newProps()\n"
+  "local ds=strokeProps(props,color,style,lw)\n"
+  "if opts.fill then\n"
+  "props:f(\"fill:%s\",opts.fillColor or self.fillColor)\n"
+  "end\n"
+  "self:elem(\"circle\",{\"cx\",num(x),\"cy\",num(y),\"r\",num(radius)},\n"
+  "joinClasses(self:propClass(props),ds))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:wedge(x,y,len,a,d,flip,color)\n"
+  "local x2,y2=self:round2(x+len),self:round2(y+a+d)\n"
+  "x,y,a=self:round2(x),self:round2(y),self:round2(a)\n"
+  "d=self:round2(y2-y-a)\n"
+  "len=self:round2(x2-x)\n"
+  "color=color or self.strokeColor\n"
+  "\n"
+  "local pts\n"
+  "if flip then\n"
+  "pts={x,y,x-a,y+len,x+d,y+len}\n"
+  "else\n"
+  "pts={x,y,x+len,y-a,x+len,y+d}\n"
+  "end\n"
+  "local s=sprintf(\"%s,%s %s,%s %s,%s\",num(pts[1]),num(pts[2]),num(pts[3]),\n"
+  "num(pts[4]),num(pts[5]),num(pts[6]))\n"
+  "\n"
+  "local props=newProps()\n"
+  "local df\n"
+  "if color==\"default\"then\n"
+  "df=\"df\"\n"
+  "else\n"
+  "props:f(\"fill:%s\",color)\n"
+  "end\n"
+  "self:elem(\"polygon\",{\"points\",s},joinClasses(self:propClass(props),df))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Svg2D:strokeX(x,y,w,clr)\n"
+  "local props=newProps()\n"
+  "props:f(\"font:%spx Verdana, Arial\",self:round(w*3))\n"
+  "props:f(\"fill:%s\",clr or self.fillColor)\n"
+  "props:f(\"text-anchor:middle\")\n"
+  "self:elem(\"text\",{\"x\",num(self:round(x)),\"y\",num(self:round(y))},\n"
+  "self:propClass(props),\"x\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Svg2D:fillText(x,y,txt)\n"
+  "local props=newProps()\n"
+  "self:iProp(props,\"font-size\",\"%spx\",self.fontSize)\n"
+  "self:iProp(props,\"fill\",\"%s\",self.fillColor)\n"
+  "if self.pxi then\n"
+  "x,y=self:round(x),self:round(y)\n"
+  "end\n"
+  "self:textLines(x,y,self.lineHeight,{self.htmlEscape(txt)},\"start\",props)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Svg2D:beginTransform(deg,xscale,ox,oy)\n"
+  "local t\n"
+  "if xscale then\n"
+  "t=sprintf(\"translate(%s %s) rotate(%s) scale(%s 1) translate(%s %s)\",\n"
+  "num(ox),num(oy),num(deg),xscale,num(-ox),num(-oy))\n"
+  "else\n"
+  "t=sprintf(\"rotate(%s %s %s)\",num(deg),num(ox),num(oy))\n"
+  "end\n"
+  "self:emitHTML('<g transform=\"%s\">\\n',t)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Svg2D:endTransform()\n"
+  "self:emitHTML(\"</g>\\n\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local svg2dStyle=[[\n"
+  "svg.svg2d { display: block; overflow: visible; }\n"
+  "svg.svg2d rect, svg.svg2d path, svg.svg2d circle { fill: none; }\n"
+  "svg.svg2d path { stroke-linecap: square; }\n"
+  "svg.svg2d text { dominant-baseline: central; white-space: pre; }\n"
+  "svg .ds { stroke: currentColor; }\n"
+  "svg .df { fill: currentColor; }\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "function Svg2D:genHTML(props)\n"
+  "if not(self.width and self.height)then return\"\"end\n"
+  "\n"
+  "local css=newProps()\n"
+  "for k,v in opairs(self.iprops)do\n"
+  "css:f(\"%s:%s\",k,v)\n"
+  "end\n"
+  "css:f(\"%s\",props or'')\n"
+  "local style=css[1]and sprintf(' style=\"%s\"',table.concat(css,\";\"))or\"\"\n"
+  "\n"
+  "local diagramStyle=\"\"\n"
+  "if self.float then\n"
+  "diagramStyle=sprintf(' style=\"float:%s\"',self.float)\n"
+  "end\n"
+  "\n"
+  "local w,h=num(self.width),num(self.height)\n"
+  "local html=\n"
+  "'<div class=diagram'..diagramStyle..'>\\n'..\n"
+  "sprintf('<svg class=\"svg2d %s\" width=\"%s\" height=\"%s\" viewBox=\"0 0 %s %s\"%s>\\n',\n"
+  "self.canvasClass,w,h,w,h,style)..\n"
+  "table.concat(self.out,\"\")..\"</svg>\\n</div>\\n\"\n"
+  "\n"
+  "local rules={svg2dStyle}\n"
+  "for _,name in ipairs(self.ruleNames)do\n"
+  "rules[#rules+1]=self.rules[name]..\"\\n\"\n"
+  "end\n"
+  "\n"
+  "return html,table.concat(rules)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Svg2D:genTree(...)\n"
+  "local html=self:genHTML(...)\n"
+  "local head=E.head{E.style{_once=\"svg2d\",_group=\"svg2d\",type=\"text/css\",svg2dStyle}}\n"
+  "for _,name in ipairs(self.ruleNames)do\n"
+  "table.insert(head,E.style{_once=\"svg2d.\"..name,_group=\"svg2d\",\n"
+  "type=\"text/css\",self.rules[name]..\"\\n\"})\n"
+  "end\n"
+  "return{E._html{html},head}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Svg2D\n"
+  "";
+
+static const unsigned char data15[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseOpts(o)\n"
+  "local opts={}\n"
+  "local f\n"
+  "if type(o)==\"string\"then\n"
+  "f=o:gmatch(\"([^%s]+)%s*\")\n"
+  "else\n"
+  "local n=0\n"
+  "function f()n=n+1;return o[n]end\n"
+  "end\n"
+  "for desc in f do\n"
+  "local names,type=desc:match(\"([^:=]*)(:\?=\?%*\?)\")\n"
+  "assert(names)\n"
+  "local name=names:match(\"-*([^/]*)\")\n"
+  "for opt in names:gmatch(\"([^/]+)/\?\")do\n"
+  "opts[opt]={name=name,type=type}\n"
+  "end\n"
+  "end\n"
+  "return opts\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function read(args,o,errhandler)\n"
+  "local opts=parseOpts(o)\n"
+  "local words,values={},{}\n"
+  "local errfn=(type(errhandler)==\"function\"and errhandler or\n"
+  "function(msg)error((errhandler or\"getopts\")..\": \"..msg)end)\n"
+  "\n"
+  "local argndx=0\n"
+  "local function nextArg()\n"
+  "argndx=argndx+1\n"
+  "return args[argndx]\n"
+  "end\n"
+  "\n"
+  "for a in nextArg do\n"
+  "local opt,optarg=a:match(\"^(%-%-[^=]*)=(.*)\")\n"
+  "if not opt then\n"
+  "opt,optarg=a:match(\"^(%-.*)\"),false\n"
+  "end\n"
+  "if not opt then\n"
+  "table.insert(words,a)\n"
+  "else\n"
+  "local o=opts[opt]\n"
+  "if o then\n"
+  "local v=values[o.name]\n"
+  "if o.type~=\"\"then\n"
+  "\n"
+  "optarg=optarg or nextArg()\n"
+  "if not optarg then\n"
+  "local e={errfn(\"Missing argument to \"..opt,opt)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "if o.type:match(\"%*\")then\n"
+  "v=v or{}\n"
+  "values[o.name]=v\n"
+  "table.insert(v,optarg)\n"
+  "elseif not v then\n"
+  "values[o.name]=optarg\n"
+  "else\n"
+  "local e={errfn(\"Argument repeated: \"..opt,opt)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "else\n"
+  "\n"
+  "values[o.name]=(v or 0)+1\n"
+  "end\n"
+  "elseif opt==\"--\"then\n"
+  "\n"
+  "for a in nextArg do\n"
+  "table.insert(words,a)\n"
+  "end\n"
+  "break\n"
+  "else\n"
+  "local e={errfn(\"Unrecognized option: \"..a,a)}\n"
+  "if e[1]then\n"
+  "return table.unpack(e)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return words,values\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local G={}\n"
+  "G.parseOpts=parseOpts\n"
+  "G.read=read\n"
+  "return G\n"
+  "";
+
+static const unsigned char data16[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local debug=require\"debug\"\n"
+  "\n"
+  "\n"
+  "local function catch(pats,func,...)\n"
+  "local r=table.pack(xpcall(func,debug.traceback,...))\n"
+  "local succ=r[1]\n"
+  "if succ then\n"
+  "return false,table.unpack(r,2,r.n)\n"
+  "end\n"
+  "\n"
+  "if type(pats)==\"string\"then\n"
+  "local t={}\n"
+  "for p in pats:gmatch(\"([^,]+),\?\")do\n"
+  "table.insert(t,p)\n"
+  "end\n"
+  "pats=t\n"
+  "end\n"
+  "local e=r[2]\n"
+  "local m=e:match(\"(.-)\\nstack traceback:\\n\")or e\n"
+  "m=m:match(\"^.-:%d+: (.*)\")or m\n"
+  "\n"
+  "for _,p in ipairs(pats)do\n"
+  "local v={m:match(\"^\"..p)}\n"
+  "if v[1]then\n"
+  "return{\n"
+  "errstr=e,\n"
+  "message=m,\n"
+  "values=v,\n"
+  "reThrow=function(self)error(self.errstr,0)end\n"
+  "}\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "error(e,0)\n"
+  "end\n"
+  "\n"
+  "return{\n"
+  "catch=catch,\n"
+  "}\n"
+  "";
+
+static const unsigned char data17[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "local E,TYPE=doctree.E,doctree.TYPE\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlSubs={\n"
+  "[\"<\"]=\"&lt;\",\n"
+  "[\">\"]=\"&gt;\",\n"
+  "[\"&\"]=\"&amp;\",\n"
+  "['\"']=\"&quot;\"\n"
+  "}\n"
+  "\n"
+  "local function badUTF8(n)\n"
+  "return 0xFFDD;\n"
+  "end\n"
+  "\n"
+  "local function makeCharRef(ch)\n"
+  "return(\"&#%d;\"):format(utf8utils.decode(ch,badUTF8))\n"
+  "end\n"
+  "\n"
+  "local function luaHtmlEscape(str)\n"
+  "return(str:gsub(\"[<>&]\",htmlSubs):gsub(utf8utils.mbpattern,makeCharRef))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local htmlEscape=succ and textcodec_c.htmlEscape or luaHtmlEscape\n"
+  "\n"
+  "local function htmlEscapeAttr(str)\n"
+  "return(str:gsub('[>&\"]',htmlSubs))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function encodeAttrs(node)\n"
+  "local ta={\"\"}\n"
+  "for k,v in opairs(node or{})do\n"
+  "if v and type(k)==\"string\"and k:sub(1,1)~=\"_\"then\n"
+  "local a=k\n"
+  "if v~=true then\n"
+  "a=k..'=\"'..htmlEscapeAttr(tostring(v))..'\"'\n"
+  "end\n"
+  "insert(ta,a)\n"
+  "end\n"
+  "end\n"
+  "return ta[2]and concat(ta,\" \")or\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsEmpty={\n"
+  "area=true,\n"
+  "base=true,\n"
+  "br=true,\n"
+  "col=true,\n"
+  "hr=true,\n"
+  "img=true,\n"
+  "input=true,\n"
+  "link=true,\n"
+  "meta=true,\n"
+  "param=true,\n"
+  "\n"
+  "command=true,\n"
+  "embed=true,\n"
+  "keygen=true,\n"
+  "source=true,\n"
+  "track=true,\n"
+  "wbr=true,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsBlock={\n"
+  "address=true,\n"
+  "blockquote=true,\n"
+  "\n"
+  "h1=true,\n"
+  "h2=true,\n"
+  "h3=true,\n"
+  "h4=true,\n"
+  "h5=true,\n"
+  "h6=true,\n"
+  "p=true,\n"
+  "\n"
+  "ol=true,\n"
+  "ul=true,\n"
+  "li=true,\n"
+  "hr=true,\n"
+  "html=true,\n"
+  "body=true,\n"
+  "head=true,\n"
+  "meta=true,\n"
+  "style=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local elemIsCDATA={\n"
+  "style=true,\n"
+  "script=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local HTMLGen=Object:new()\n"
+  "\n"
+  "\n"
+  "function HTMLGen:initialize(options)\n"
+  "self.options=options or{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:warn(node,...)\n"
+  "local warn=self.options.warn\n"
+  "if warn then\n"
+  "warn(node,string.format(...))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:append(str)\n"
+  "insert(self.strings,str)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serializeNode(node)\n"
+  "if type(node)==\"string\"then\n"
+  "self:append(htmlEscape(node))\n"
+  "return\n"
+  "elseif type(node)~=\"table\"then\n"
+  "self:warn(\"Unrecognized node type: %s\",type(node))\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local name=node[TYPE]\n"
+  "\n"
+  "if name and name:sub(1,1)==\"_\"then\n"
+  "\n"
+  "\n"
+  "if name==\"_html\"then\n"
+  "for _,chile in ipairs(node)do\n"
+  "self:append(chile)\n"
+  "end\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local o,c=\"\",\"\"\n"
+  "if name then\n"
+  "local nl=(elemIsBlock[name]and not node._whitespace)and\"\\n\"or\"\"\n"
+  "local attrs=encodeAttrs(node)\n"
+  "o=string.format(\"<%s%s>%s\",name,attrs,nl)\n"
+  "if not(elemIsEmpty[name]or node._isEmpty)then\n"
+  "c=string.format(\"%s</%s>\",nl,name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(o)\n"
+  "\n"
+  "if elemIsCDATA[name]then\n"
+  "local text=doctree.treeConcat(node)\n"
+  "if text:match(\"</\")then\n"
+  "self:warn(node,\"Invalid content for CDATA element %s: '</'\",name)\n"
+  "\n"
+  "\n"
+  "text=text:gsub(\"</\",\"<\\\\/\")\n"
+  "end\n"
+  "self:append(text)\n"
+  "else\n"
+  "for _,child in ipairs(node)do\n"
+  "self:serializeNode(child)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(c)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlPreamble=[[\n"
+  "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\" \"http://www.w3.org/TR/html4/loose.dtd\">\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serialize(tree)\n"
+  "assert(self~=HTMLGen)\n"
+  "\n"
+  "self.strings={htmlPreamble}\n"
+  "\n"
+  "self:serializeNode(tree)\n"
+  "self:append(\"\\n\")\n"
+  "return concat(self.strings)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTMLGen:normalize(tree)\n"
+  "local head=E.head{}\n"
+  "local body=E.body{}\n"
+  "local seen={}\n"
+  "local groups={}\n"
+  "\n"
+  "local function appendToHead(child)\n"
+  "if type(child)==\"table\"then\n"
+  "local seenkey=child._once or(child[TYPE]==\"title\"and\"title\")\n"
+  "if seenkey then\n"
+  "if seen[seenkey]then return end\n"
+  "seen[seenkey]=true\n"
+  "end\n"
+  "local group=child._group\n"
+  "if group then\n"
+  "local first=groups[group]\n"
+  "if first then\n"
+  "for _,c in ipairs(child)do\n"
+  "table.insert(first,c)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "first={}\n"
+  "for k,v in pairs(child)do\n"
+  "first[k]=v\n"
+  "end\n"
+  "groups[group]=first\n"
+  "child=first\n"
+  "end\n"
+  "end\n"
+  "table.insert(head,child)\n"
+  "end\n"
+  "\n"
+  "local function visit(node,tbl)\n"
+  "if type(node)~=\"table\"then\n"
+  "table.insert(tbl,node)\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local ty=node[TYPE]\n"
+  "\n"
+  "if ty==\"head\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "appendToHead(child)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local o=tbl\n"
+  "if ty and ty~=\"html\"and ty~=\"body\"then\n"
+  "\n"
+  "o={}\n"
+  "for k,v in pairs(node)do\n"
+  "if type(k)~=\"number\"then\n"
+  "o[k]=v\n"
+  "end\n"
+  "end\n"
+  "table.insert(tbl,o)\n"
+  "end\n"
+  "\n"
+  "for _,child in ipairs(node)do\n"
+  "visit(child,o)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local charset=self.options.charset\n"
+  "if charset~=false then\n"
+  "if type(charset)~=\"string\"then\n"
+  "charset=\"utf-8\"\n"
+  "end\n"
+  "appendToHead(E.meta{[\"http-equiv\"]=\"Content-Type\",\n"
+  "content=\"text/html;charset=\"..charset})\n"
+  "end\n"
+  "\n"
+  "visit(tree,body)\n"
+  "\n"
+  "appendToHead(E.title{})\n"
+  "\n"
+  "return E.html{\n"
+  "head,body\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlgen={}\n"
+  "\n"
+  "function htmlgen.generateDoc(tree,options)\n"
+  "local hg=HTMLGen:new(options)\n"
+  "return hg:serialize(hg:normalize(tree))\n"
+  "end\n"
+  "\n"
+  "function htmlgen.serialize(tree,options)\n"
+  "return HTMLGen:new(options):serialize(tree)\n"
+  "end\n"
+  "\n"
+  "function htmlgen.normalize(tree,options)\n"
+  "return HTMLGen:new(options):normalize(tree)\n"
+  "end\n"
+  "\n"
+  "htmlgen.HTMLGen=HTMLGen\n"
+  "htmlgen._luaHtmlEscape=luaHtmlEscape\n"
+  "htmlgen._htmlEscape=htmlEscape\n"
+  "\n"
+  "return htmlgen\n"
+  "";
+
+static const unsigned char data18[] = 
+  "\n"
+  "\n"
+  "return[=[\n"
+  "table {\n"
+  "   border-collapse: collapse;\n"
+  "   border-width: 1px;\n"
+  "   border-spacing: 1px;\n"
+  "   border-color: transparent;\n"
+  "   margin: 16px 0;\n"
+  "   width: 100%;\n"
+  "}\n"
+  "th {\n"
+  "   background-color: #bbb; color: white;\n"
+  "}\n"
+  "td, th {\n"
+  "   border-style: solid;\n"
+  "   border-color: black;\n"
+  "   border-width: 1px;\n"
+  "   padding: 0 6px;\n"
+  "}\n"
+  "td p:first-child, th p:first-child {\n"
+  "   margin-top: 3px;\n"
+  "}\n"
+  "td p:last-child, th p:last-child {\n"
+  "   margin-bottom: 3px;\n"
+  "}\n"
+  "\n"
+  ".smarkdoc {\n"
+  "  margin-left: 42px; margin-right: 42px;\n"
+  "  font-size: 13px;\n"
+  "  font-family: 'Lucida Grande', Geneva, Helvetica, Arial, sans-serif;\n"
+  "}\n"
+  "\n"
+  "h1, h2, h3 { color: #3c4c6c; }\n"
+  "h1 {\n"
+  "  text-align: center;\n"
+  "  font-size: 200%;\n"
+  "/*    margin-left: -30px; */\n"
+  "  clear: both;\n"
+  "}\n"
+  "h2 {\n"
+  "  font-size: 160%;\n"
+  "  margin: 32px -40px 24px -42px;\n"
+  "  padding: 3px 24px 8px;\n"
+  "  border-bottom: 2px solid #5088c5;\n"
+  "  clear: both;\n"
+  "}\n"
+  "h3 {\n"
+  "  font-size: 130%;\n"
+  "  margin: 20px -4px 10px;\n"
+  "  padding: 4px;\n"
+  "  clear: both;\n"
+  "}\n"
+  "h4 {\n"
+  "  font-size: 110%;\n"
+  "  margin: 2em 0 1em;\n"
+  "}\n"
+  "\n"
+  "pre {\n"
+  "  font-size: 90%;\n"
+  "  background-color: #f0f0f4; padding: 6px; border: 1px solid #d0d0ee;\n"
+  "  font-family: \"Courier New\", \"Lucida Console\", \"Monaco\", monospace;\n"
+  "}\n"
+  "\n"
+  ".pre {\n"
+  "  font-size: 90%;\n"
+  "  padding: 6px;\n"
+  "  background-color: #f0f0f4;\n"
+  "  font-family: \"Courier New\", \"Lucida Console\", \"Monaco\", monospace;\n"
+  "}\n"
+  "\n"
+  "code {\n"
+  "  font-size: 90%;\n"
+  "  font-family: \"Courier New\", \"Lucida Console\", \"Monaco\", monospace;\n"
+  "}\n"
+  "\n"
+  "h3 code {\n"
+  "  font-size: 100%;\n"
+  "}\n"
+  "\n"
+  "p {\n"
+  "  margin: 0.8em 0;\n"
+  "}\n"
+  "ul, ol {\n"
+  "  margin: 1em 0 1em 3em; padding: 0;\n"
+  "}\n"
+  "div.indent {\n"
+  "  margin: 0 3em;\n"
+  "}\n"
+  "\n"
+  "a[href] {\n"
+  "  text-decoration: none;\n"
+  "  color: #2020b0;\n"
+  "}\n"
+  "a[href]:hover {\n"
+  "  border-bottom: 1px dotted #2030d0;\n"
+  "}\n"
+  "\n"
+  "/* Smark Users Guide */\n"
+  "\n"
+  ".codebox {\n"
+  "  padding: 0 1px;  margin-right:1px;\n"
+  "  border:1px solid #d0d0ee;\n"
+  "  background-color: #f0f0f4;\n"
+  "  font-weight: bold;\n"
+  "  font-family: \"Courier New\", \"Lucida Console\", \"Monaco\", monospace;\n"
+  "}\n"
+  "\n"
+  "/* ================ Smark-specific classes ================ */\n"
+  "\n"
+  ".indent {\n"
+  "  margin: 0 3em;\n"
+  "}\n"
+  "\n"
+  "/*\n"
+  "|| Floats affect text flow but not block boundaries, so graphics in a DIV\n"
+  "|| would overlap floats if not for \"clear: both\"\n"
+  "*/\n"
+  ".diagram {\n"
+  "  margin: 18px 0;\n"
+  "  clear: both;\n"
+  "}\n"
+  "\n"
+  "/* ASCII Art */\n"
+  "\n"
+  ".art {\n"
+  "  margin-right: auto; margin-left: auto; /* center */\n"
+  "  font-family: Arial, Verdana, \"Lucida Console\", Monaco, monospace;\n"
+  "  font-weight: bold;\n"
+  "}\n"
+  ".art * {\n"
+  "   border-color: #543;\n"
+  "}\n"
+  ".art .dline, .art .drect {\n"
+  "   border-style: dotted;\n"
+  "}\n"
+  ".art .rect {\n"
+  "   -webkit-box-shadow: 0.2em 0.2em 0.3em rgba(0,0,0,0.3);\n"
+  "   -moz-box-shadow: 0.2em 0.2em 0.3em rgba(0,0,0,0.3);\n"
+  "   box-shadow: 0.2em 0.2em 0.2em #875;\n"
+  "   background-color: #f9faf4; /* #fafff4; #f8f8ec;  */\n"
+  "}\n"
+  ".art .nofx {\n"
+  "   background-color: #f9faf4;\n"
+  "}\n"
+  ".art .round {\n"
+  "   border-radius: 0.6em;\n"
+  "   -webkit-border-radius: 0.6em;\n"
+  "   -moz-border-radius: 0.6em;\n"
+  "}\n"
+  "\n"
+  "/* ASCII Art and Sequence Charts rendered as SVG (config.graphics = \"svg\") */\n"
+  "\n"
+  ".art .ds {\n"
+  "   stroke: #543;\n"
+  "}\n"
+  ".art .df {\n"
+  "   fill: #543;\n"
+  "}\n"
+  ".art .dline.ds, .art .drect.ds {\n"
+  "   stroke-dasharray: 0 2px;\n"
+  "   stroke-linecap: round;\n"
+  "}\n"
+  ".art rect.rect, .art path.rect {\n"
+  "   fill: #f9faf4;\n"
+  "   filter: drop-shadow(0.2em 0.2em 0.1em #875);\n"
+  "}\n"
+  ".art rect.nofx, .art path.nofx {\n"
+  "   fill: #f9faf4;\n"
+  "}\n"
+  "\n"
+  "/* .art .line {  -webkit-box-shadow: 0.1em 0.1em 0.2em rgba(0,0,0,0.3); } */\n"
+  "\n"
+  "/* Sequence Charts */\n"
+  "\n"
+  ".msc {\n"
+  "   font: 11px Verdana, Monaco, \"Lucida Console\";\n"
+  "   margin-left: auto; margin-right: auto;\n"
+  "   background-color: white;\n"
+  "   /* border: 1px solid #555; */  /* Useful for non-white pages */\n"
+  "}\n"
+  "\n"
+  "/* Table of Contents */\n"
+  "\n"
+  ".tocLevel {\n"
+  "  margin-left: 2em;\n"
+  "  font-weight: normal;\n"
+  "}\n"
+  ".tocLevel .tocLevel {\n"
+  "  font-size: 90%; /* ...of inherited font size */\n"
+  "  line-height: 150%; /* ...of font size */\n"
+  "}\n"
+  ".toc > .tocLevel {\n"
+  "  font-weight: bold;\n"
+  "  margin: 0.5em 0\n"
+  "}\n"
+  ".toc {\n"
+  "  column-count: 2; column-gap: 2em;\n"
+  "  -moz-column-count: 2; -moz-column-gap: 2em;\n"
+  "  -webkit-column-count: 2; -webkit-column-gap: 2em;\n"
+  "}\n"
+  "\n"
+  "/* ordinary text content is in P elements */\n"
+  "\n"
+  "td p:first-child, th p:first-child {\n"
+  "   margin-top: 3px;\n"
+  "}\n"
+  "td p:last-child, th p:last-child {\n"
+  "   margin-bottom: 3px;\n"
+  "}\n"
+  "li p:only-child {\n"
+  "  margin-top: 0;\n"
+  "  margin-bottom: 0;\n"
+  "}\n"
+  "\n"
+  "/* ================ Print ================ */\n"
+  "\n"
+  "@media print {\n"
+  "\n"
+  "  @page {\n"
+  "    margin: 0.75in 0.75in;\n"
+  "    size: Letter;\n"
+  "    @bottom {\n"
+  "      content: counter(page);\n"
+  "      vertical-align: top;\n"
+  "      padding-top: 1em;\n"
+  "    }\n"
+  "  }\n"
+  "  h1 { text-align: center;\n"
+  "       margin: 3in 0 20px; }\n"
+  "  h2 { page-break-before: always; }\n"
+  "  h2 { string-set: section content() }\n"
+  "  .toc { margin: 3em -2em }\n"
+  "  .toc a::after {\n"
+  "     font-size: 10px;\n"
+  "     content: leader(' . ') \"  \" target-counter(attr(href), page);\n"
+  "  }\n"
+  "  table { page-break-inside: avoid; }\n"
+  "}\n"
+  "]=]\n"
+  "";
+
+static const unsigned char data19[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function ltAny(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local inext=ipairs{}\n"
+  "\n"
+  "local function orderedPairs(t)\n"
+  "local keys={}\n"
+  "local keyIndex=1\n"
+  "local counting=true\n"
+  "\n"
+  "local function _next(seen,s)\n"
+  "local v\n"
+  "\n"
+  "if counting then\n"
+  "\n"
+  "s,v=inext(t,s)\n"
+  "if s~=nil then\n"
+  "seen[s]=true\n"
+  "return s,v\n"
+  "end\n"
+  "counting=false\n"
+  "\n"
+  "\n"
+  "for k,v in pairs(t)do\n"
+  "if not seen[k]then\n"
+  "table.insert(keys,k)\n"
+  "end\n"
+  "end\n"
+  "table.sort(keys,ltAny)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "s=keys[keyIndex]\n"
+  "if s~=nil then\n"
+  "keyIndex=keyIndex+1\n"
+  "v=t[s]\n"
+  "end\n"
+  "return s,v\n"
+  "end\n"
+  "\n"
+  "return _next,{},0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local numtostring={\n"
+  "[tostring(-1/0)]=\"-1/0\",\n"
+  "[tostring(1/0)]=\"1/0\",\n"
+  "[tostring(0/0)]=\"0/0\"\n"
+  "}\n"
+  "\n"
+  "setmetatable(numtostring,{__index=function(t,k)return k end})\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function serialize(x,out,iter)\n"
+  "local visited={}\n"
+  "local iter=iter==\"s\"and orderedPairs or iter or pairs\n"
+  "assert(type(iter)==\"function\")\n"
+  "\n"
+  "local function _serialize(x)\n"
+  "if type(x)==\"string\"then\n"
+  "\n"
+  "out(string.format(\"%q\",x))\n"
+  "\n"
+  "elseif type(x)==\"number\"then\n"
+  "\n"
+  "out(numtostring[tostring(x)])\n"
+  "\n"
+  "elseif type(x)==\"boolean\"or\n"
+  "type(x)==\"nil\"then\n"
+  "\n"
+  "out(tostring(x))\n"
+  "\n"
+  "elseif type(x)==\"table\"then\n"
+  "\n"
+  "if visited[x]then\n"
+  "error(\"serialize: recursive structure\")\n"
+  "end\n"
+  "visited[x]=true\n"
+  "local first,nextIndex=true,1\n"
+  "\n"
+  "out\"{\"\n"
+  "\n"
+  "for k,v in iter(x)do\n"
+  "if first then\n"
+  "first=false\n"
+  "else\n"
+  "out\",\"\n"
+  "end\n"
+  "if k==nextIndex then\n"
+  "nextIndex=nextIndex+1\n"
+  "else\n"
+  "if type(k)==\"string\"and k:match(\"^[%a_][%w_]*$\")then\n"
+  "out(k..\"=\")\n"
+  "else\n"
+  "out\"[\"\n"
+  "_serialize(k)\n"
+  "out\"]=\"\n"
+  "end\n"
+  "end\n"
+  "_serialize(v)\n"
+  "end\n"
+  "\n"
+  "out\"}\"\n"
+  "visited[x]=false\n"
+  "else\n"
+  "error(\"serialize: unsupported type\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local result\n"
+  "if not out then\n"
+  "result={}\n"
+  "out=result\n"
+  "end\n"
+  "\n"
+  "if type(out)==\"table\"then\n"
+  "local t=out\n"
+  "function out(s)\n"
+  "table.insert(t,s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "_serialize(x)\n"
+  "\n"
+  "if result then\n"
+  "return table.concat(result)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return{\n"
+  "orderedPairs=orderedPairs,\n"
+  "serialize=serialize\n"
+  "}\n"
+  "";
+
+static const unsigned char data20[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local serialize=require\"serialize\"\n"
+  "local lfsu=require\"lfsu\"\n"
+  "local xpfs=require\"xpfs\"\n"
+  "local smarkmisc=require\"smarkmisc\"\n"
+  "\n"
+  "local byte=string.byte\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function mul32(a,b)\n"
+  "local bl=b%65536\n"
+  "local bh=(b-bl)/65536\n"
+  "return(a*bl+(a*bh%65536)*65536)%4294967296\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function hash(str)\n"
+  "local a,b=2166136261,3339675911\n"
+  "for ndx=1,#str,3 do\n"
+  "local c1,c2,c3=byte(str,ndx,ndx+2)\n"
+  "local w=c1+(c2 or 0)*256+(c3 or 0)*65536\n"
+  "a=mul32(bit32.bxor(a,w),16777619)\n"
+  "b=mul32(bit32.bxor(b,w),2654435761)\n"
+  "end\n"
+  "a=mul32(bit32.bxor(a,#str%4294967296),16777619)\n"
+  "return(\"%08x%08x\"):format(a,b)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function hashFiles(names)\n"
+  "local deps={}\n"
+  "for ndx,name in ipairs(names)do\n"
+  "local data=smarkmisc.readFile(name)\n"
+  "if not data then\n"
+  "return nil\n"
+  "end\n"
+  "deps[ndx]={name,hash(data)}\n"
+  "end\n"
+  "return deps\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function modulePath(name)\n"
+  "if not package.preload[name]then\n"
+  "return package.searchpath(name,package.path)\n"
+  "or package.searchpath(name,package.cpath)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function hashCode()\n"
+  "local names={}\n"
+  "local bundled=false\n"
+  "for name,value in pairs(package.loaded)do\n"
+  "\n"
+  "if rawget(_G,name)~=value then\n"
+  "local path=modulePath(name)\n"
+  "if path then\n"
+  "names[#names+1]=path\n"
+  "else\n"
+  "bundled=true\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "if bundled then\n"
+  "names={xpfs.stat(\"/proc/self/exe\",\"k\")and\"/proc/self/exe\"\n"
+  "or arg and arg[0]}\n"
+  "elseif arg and arg[0]then\n"
+  "\n"
+  "local script=arg[0]\n"
+  "names[#names+1]=xpfs.stat(script,\"k\")and script\n"
+  "or package.searchpath((script:gsub(\"%.lua$\",\"\")),package.path)\n"
+  "end\n"
+  "table.sort(names)\n"
+  "\n"
+  "local ids={}\n"
+  "for ndx,name in ipairs(names)do\n"
+  "local st=xpfs.stat(name,\"sim\")\n"
+  "if not st then\n"
+  "return nil\n"
+  "end\n"
+  "ids[ndx]={name,st.size,st.inode,st.mtime}\n"
+  "end\n"
+  "return hash(serialize.serialize(ids))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function entryName(dir,outName)\n"
+  "return dir..\"/\"..hash(outName)..\".lua\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function lookup(dir,outName,key)\n"
+  "local f=loadfile(entryName(dir,outName),\"t\",{})\n"
+  "local succ,entry=pcall(f or error)\n"
+  "if not(succ and type(entry)==\"table\"and entry.key==key)then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "for _,dep in ipairs(entry.deps)do\n"
+  "local data=smarkmisc.readFile(dep[1])\n"
+  "if not data or hash(data)~=dep[2]then\n"
+  "return nil\n"
+  "end\n"
+  "end\n"
+  "return entry\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function store(dir,outName,entry)\n"
+  "local succ,err=lfsu.mkdir_p(dir)\n"
+  "if not succ then\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local name=entryName(dir,outName)\n"
+  "local tmpName=(\"%s.%d.tmp\"):format(name,xpfs.getpid())\n"
+  "succ,err=lfsu.write(tmpName,\"return \"..serialize.serialize(entry)..\"\\n\")\n"
+  "if succ then\n"
+  "succ,err=os.rename(tmpName,name)\n"
+  "end\n"
+  "if not succ then\n"
+  "return nil,err\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "hash=hash,\n"
+  "hashFiles=hashFiles,\n"
+  "hashCode=hashCode,\n"
+  "modulePath=modulePath,\n"
+  "lookup=lookup,\n"
+  "store=store,\n"
+  "}\n"
+  "";
+
+static const unsigned char data21[] = 
+  "\n"
+  "\n"
+  "require\"smark_art\"\n"
+  "require\"smark_pre\"\n"
+  "require\"smark_msc\"\n"
+  "require\"smark_lua\"\n"
+  "require\"smark_counter\"\n"
+  "require\"smark_example\"\n"
+  "require\"smark_table\"\n"
+  "require\"smark_include\"\n"
+  "\n"
+  "";
+
+static const unsigned char data22[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local smarkmisc=require\"smarkmisc\"\n"
+  "local memoize=require\"memoize\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local rtrim=smarkmisc.rtrim\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "\n"
+  "local bdebug=os.getenv(\"SmarkArtDebug\")\n"
+  "\n"
+  "\n"
+  "local function AutoTable()\n"
+  "return memoize.newTable(function()return{}end)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function reverse(a)\n"
+  "local min,max=1,#a\n"
+  "while min<max do\n"
+  "a[min],a[max]=a[max],a[min]\n"
+  "min,max=min+1,max-1\n"
+  "end\n"
+  "return a\n"
+  "end\n"
+  "\n"
+  "local function clone(t)\n"
+  "local r={}\n"
+  "for k,v in pairs(t)do\n"
+  "r[k]=v\n"
+  "end\n"
+  "return r\n"
+  "end\n"
+  "\n"
+  "local function minmax(a,b)\n"
+  "if a>b then a,b=b,a end\n"
+  "return a,b\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function sign(a)\n"
+  "return a>0 and 1 or a<0 and-1 or 0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function xyDir(a,b)\n"
+  "return sign(b[1]-a[1]),sign(b[2]-a[2])\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encodeLine(tbl,x,y,txt,pos)\n"
+  "local p,px=pos or 1,#txt+1\n"
+  "\n"
+  "\n"
+  "local pd,ps=txt:find(\"%.\",p),txt:find(\"[~%-]\",p)\n"
+  "local pds=pd and ps and math.max(pd,ps)\n"
+  "\n"
+  "\n"
+  "local aa=txt:match(\">()\",p)\n"
+  "local ab=txt:match(\".()<\",p)\n"
+  "\n"
+  "\n"
+  "local da=txt:match(\"`()\",p)\n"
+  "local db=txt:match(\".(),\",p)\n"
+  "\n"
+  "\n"
+  "local o1=txt:match(\"[^~%-]()o\",p)\n"
+  "local o2=txt:match(\"o()\",txt:sub(p,p+1):match\"o[%-~]\"and p+1 or p)\n"
+  "\n"
+  "px=math.min(aa or px,ab or px,pds or px,o1 or px,o2 or px,\n"
+  "da or px,db or px,px)\n"
+  "\n"
+  "\n"
+  "\n"
+  "local c1,c2=txt:sub(p,p),txt:sub(px-1,px-1)\n"
+  "if px>p+1 or string.find(\"-~.<>,`\",c1,1,true)then\n"
+  "local f=\"\"\n"
+  "\n"
+  "local function setFlag(chars,a,b)\n"
+  "if a and chars:find(c1,1,true)then f=f..a end\n"
+  "if b and chars:find(c2,1,true)then f=f..b end\n"
+  "end\n"
+  "\n"
+  "setFlag(\"+,`x\",\"c\",\"C\")\n"
+  "setFlag(\"<\",\"a\",nil)\n"
+  "setFlag(\">\",nil,\"A\")\n"
+  "setFlag(\"x,`\",\"r\",\"R\")\n"
+  "setFlag(\"o\",\"o\",\"O\")\n"
+  "\n"
+  "if c1==\"<\"and txt:sub(p-1,p-1)==\"+\"then f=f..\"e\"end\n"
+  "if c2==\">\"and txt:sub(px,px)==\"+\"then f=f..\"E\"end\n"
+  "\n"
+  "if pd and pd<px then f=f..\"d\"end\n"
+  "if ps and ps<px then f=f..\"s\"end\n"
+  "\n"
+  "if(txt:find(\"~\",p)or px)<px then f=f..\"l\"end\n"
+  "\n"
+  "table.insert(tbl,{y-1,x+p-2,x+px-2,f})\n"
+  "end\n"
+  "\n"
+  "if px<=#txt then\n"
+  "if txt:sub(px-1,px):match(\"o[%-~]\")then\n"
+  "px=px-1\n"
+  "end\n"
+  "encodeLine(tbl,x,y,txt,px)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getHLines(textLines)\n"
+  "local hlines={}\n"
+  "\n"
+  "for y,line in ipairs(textLines)do\n"
+  "line=line:gsub(\"%a%a+\",function(s)return string.rep(\" \",#s)end)\n"
+  "\n"
+  "for x,str in line:gmatch(\"()([-~+<>%.%,`o]+)\")do\n"
+  "local isG=#str>1 and not str:match(\"^%.%.%.\?$\")\n"
+  "if not isG then\n"
+  "local border=line:sub(x-1,x-1)..line:sub(x+#str,x+#str)\n"
+  "isG=border:match(\"[|:]\")\n"
+  "end\n"
+  "if isG then\n"
+  "\n"
+  "encodeLine(hlines,x,y,str:gsub(\"[`,]\",\"x\"),1)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return hlines\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local vtoh={\n"
+  "['v']='>',\n"
+  "['V']='>',\n"
+  "['^']='<',\n"
+  "['|']='-',\n"
+  "['+']='+',\n"
+  "[':']='.',\n"
+  "[',']=',',\n"
+  "['`']='`'\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getVLines(textLines)\n"
+  "local vlines={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "local columns=AutoTable()\n"
+  "for nrow,line in ipairs(textLines)do\n"
+  "for ncol,ch in line:gmatch(\"()([%+|:vV^,`o])\")do\n"
+  "local alpha=line:sub(ncol-1,ncol+1):match(\"[a-zA-Z]\?[ovV,][a-zA-Z]\?\")\n"
+  "if not(alpha and#alpha>1)then\n"
+  "local col=columns[ncol]\n"
+  "if col[nrow-1]then\n"
+  "ch=col[nrow-1]..ch\n"
+  "col[nrow-1]=nil\n"
+  "end\n"
+  "col[nrow]=ch\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "for x,col in opairs(columns)do\n"
+  "for y,str in opairs(col)do\n"
+  "if#str>1 or str==\"|\"then\n"
+  "encodeLine(vlines,y-#str+1,x,str:gsub(\".\",vtoh),1)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return vlines\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function ptEQ(a,b)\n"
+  "return a[1]==b[1]and a[2]==b[2]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function splitLineFlags(flags)\n"
+  "local fp=flags:gsub(\"[^dsl]\",\"\")\n"
+  "local fr=flags:gsub(\"[^ERAOC]\",\"\"):lower()\n"
+  "local fl=flags:gsub(\"[^eraoc]\",\"\")\n"
+  "return fp,fl,fr\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function cannotMerge(pa,pb)\n"
+  "local s=pa.flags..pb.flags\n"
+  "return s:match(\"d\")and s:match(\"s\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function catUnique(a,b)\n"
+  "return a..b:gsub(\".\",function(c)return a:find(c,1,true)and\"\"or c end)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getPaths(hl,vl)\n"
+  "\n"
+  "local xyToPath=AutoTable()\n"
+  "local pathSeen={}\n"
+  "local pathList={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function mergePaths(pa,x,y)\n"
+  "local pb=xyToPath[x][y]\n"
+  "if pa==pb then\n"
+  "pa.loop=true\n"
+  "return pa\n"
+  "elseif not pb then\n"
+  "xyToPath[x][y]=pa\n"
+  "return pa\n"
+  "elseif cannotMerge(pa,pb)then\n"
+  "return pa\n"
+  "end\n"
+  "\n"
+  "\n"
+  "pathSeen[pb]=nil\n"
+  "if not ptEQ({x,y},pa[#pa])then reverse(pa)end\n"
+  "if not ptEQ({x,y},pb[1])then reverse(pb)end\n"
+  "for n=2,#pb do\n"
+  "table.insert(pa,pb[n])\n"
+  "end\n"
+  "\n"
+  "\n"
+  "pa.flags=catUnique(pa.flags,pb.flags)\n"
+  "\n"
+  "\n"
+  "for _,pt in ipairs(pb)do\n"
+  "xyToPath[pt[1]][pt[2]]=pa\n"
+  "end\n"
+  "\n"
+  "return pa\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function addPath(line,vert)\n"
+  "local y,x1,x2,f=unpack(line)\n"
+  "local cl,cr=f:match\"c\",f:match\"C\"\n"
+  "y=y+0.5\n"
+  "if cl then\n"
+  "x1=x1+0.5\n"
+  "end\n"
+  "if cr then\n"
+  "x2=x2-0.5\n"
+  "end\n"
+  "local y1,y2=y,y\n"
+  "if vert then\n"
+  "x1,y1,x2,y2=y1,x1,y2,x2\n"
+  "end\n"
+  "local p={{x1,y1},{x2,y2}}\n"
+  "\n"
+  "\n"
+  "if x1==x2 and y1==y2 then return end\n"
+  "\n"
+  "p.flags,p[1].flags,p[2].flags=splitLineFlags(f)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "pathSeen[p]=true\n"
+  "pathList[#pathList+1]=p\n"
+  "if cl then p=mergePaths(p,x1,y1)end\n"
+  "if cr then mergePaths(p,x2,y2)end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for _,line in ipairs(hl)do\n"
+  "addPath(line)\n"
+  "end\n"
+  "for _,line in ipairs(vl)do\n"
+  "addPath(line,true)\n"
+  "end\n"
+  "\n"
+  "local paths={}\n"
+  "for _,p in ipairs(pathList)do\n"
+  "if pathSeen[p]then\n"
+  "paths[#paths+1]=p\n"
+  "end\n"
+  "end\n"
+  "return paths\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function pathCrossesHV(a,b)\n"
+  "local ahStart=a[1][1]~=a[2][1]and 1 or 2\n"
+  "local bvStart=b[1][2]~=b[2][2]and 1 or 2\n"
+  "\n"
+  "for i=ahStart,#a-1,2 do\n"
+  "local y,x1,x2=a[i][2],minmax(a[i][1],a[i+1][1])\n"
+  "for j=bvStart,#b-1,2 do\n"
+  "local x,y1,y2=b[j][1],minmax(b[j][2],b[j+1][2])\n"
+  "if x1<x and x2>x and y1<y and y2>y then\n"
+  "return true\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function makeShape(path)\n"
+  "if not path.loop or pathCrossesHV(path,path)or path.flags:match('l')then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local xyToPoint=AutoTable()\n"
+  "for n=1,#path do\n"
+  "local p=path[n]\n"
+  "xyToPoint[p[1]][p[2]]=p\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ys={}\n"
+  "local yToXs={}\n"
+  "for n=1,#path,2 do\n"
+  "local y=path[n][2]\n"
+  "if not yToXs[y]then\n"
+  "yToXs[y]={}\n"
+  "ys[#ys+1]=y\n"
+  "end\n"
+  "end\n"
+  "table.sort(ys)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local nStart=(path[1][2]==path[2][2])and 2 or 1\n"
+  "for n=nStart,#path-1,2 do\n"
+  "local x=path[n][1]\n"
+  "local y1,y2=minmax(path[n][2],path[n+1][2])\n"
+  "\n"
+  "for _,y in ipairs(ys)do\n"
+  "if y1<=y and y2>y then\n"
+  "\n"
+  "table.insert(yToXs[y],x)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local shape={\n"
+  "path=path,\n"
+  "rects={}\n"
+  "}\n"
+  "\n"
+  "local sx1,sy1,sx2,sy2=math.huge,math.huge,-math.huge,-math.huge\n"
+  "\n"
+  "local dotted=path.flags:match\"d\"and true\n"
+  "\n"
+  "for ny=1,#ys-1 do\n"
+  "local y1,y2=ys[ny],ys[ny+1]\n"
+  "local xs=yToXs[y1]\n"
+  "table.sort(xs)\n"
+  "for nx=1,#xs,2 do\n"
+  "local x1,x2=xs[nx],xs[nx+1]\n"
+  "local rect={x1,y1,x2-x1,y2-y1}\n"
+  "rect.dotted=dotted\n"
+  "\n"
+  "sx1=math.min(sx1,x1)\n"
+  "sy1=math.min(sy1,y1)\n"
+  "sx2=math.max(sx2,x2)\n"
+  "sy2=math.max(sy2,y2)\n"
+  "\n"
+  "\n"
+  "local radius={}\n"
+  "radius.value=0\n"
+  "for _,x in ipairs{x1,x2}do\n"
+  "for _,y in ipairs{y1,y2}do\n"
+  "local p=xyToPoint[x][y]\n"
+  "if not p or not p.flags:match\"r\"then\n"
+  "table.insert(radius,{x,y,flags=\"\"})\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "if#radius<4 then\n"
+  "\n"
+  "rect.radius=radius\n"
+  "end\n"
+  "\n"
+  "table.insert(shape.rects,rect)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "shape.x=sx1\n"
+  "\n"
+  "return shape\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function rectsCover(rects,r,ndx)\n"
+  "local x,y,w,h=unpack(r)\n"
+  "local x2,y2=x+w,y+h\n"
+  "\n"
+  "local rr=rects[ndx]\n"
+  "ndx=ndx+1\n"
+  "if not rr then return false end\n"
+  "\n"
+  "local xx,yy,ww,hh=unpack(rr)\n"
+  "local xx2,yy2=xx+ww,yy+hh\n"
+  "\n"
+  "if xx>=x2 or yy>=y2 or xx2<=x or yy2<=y then\n"
+  "\n"
+  "return rectsCover(rects,r,ndx)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "if yy>y and not rectsCover(rects,{x,y,w,yy-y},ndx)then\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "local y4=math.min(yy2,y2)\n"
+  "if y4>yy then\n"
+  "\n"
+  "if xx>x and not rectsCover(rects,{x,yy,xx-x,y4-yy},ndx)then\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "if xx2<x2 and not rectsCover(rects,{xx2,yy,x2-xx,y4-yy},ndx)then\n"
+  "return false\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return y4>=y2 or rectsCover(rects,{x,y4,w,y2-y4},ndx)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function shapeContains(a,b)\n"
+  "for _,rb in ipairs(b.rects)do\n"
+  "if not rectsCover(a.rects,rb,1)then\n"
+  "return false\n"
+  "end\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getShapes(paths)\n"
+  "local shapes,others={},{}\n"
+  "for _,path in ipairs(paths)do\n"
+  "local shape=makeShape(path)\n"
+  "if shape then\n"
+  "shapes[#shapes+1]=shape\n"
+  "else\n"
+  "others[#others+1]=path\n"
+  "end\n"
+  "end\n"
+  "return shapes,others\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function isOver(a,b)\n"
+  "for _,ll in ipairs(b.overs or{})do\n"
+  "if a==ll then return true end\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function shapeCrosses(a,b)\n"
+  "local pa=a.origPath or a.path\n"
+  "local pb=b.origPath or b.path\n"
+  "return pathCrossesHV(pa,pb)or pathCrossesHV(pb,pa)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local boxes=setmetatable({},{__mode=\"k\"})\n"
+  "\n"
+  "local function shapeBox(s)\n"
+  "local b=boxes[s]\n"
+  "if not b then\n"
+  "local huge=math.huge\n"
+  "b={huge,huge,-huge,-huge,huge,huge,-huge,-huge}\n"
+  "for _,p in ipairs(s.origPath or s.path)do\n"
+  "local x,y=p[1],p[2]\n"
+  "if x<b[1]then b[1]=x end\n"
+  "if y<b[2]then b[2]=y end\n"
+  "if x>b[3]then b[3]=x end\n"
+  "if y>b[4]then b[4]=y end\n"
+  "end\n"
+  "for _,r in ipairs(s.rects)do\n"
+  "local x,y=r[1],r[2]\n"
+  "local x2,y2=x+r[3],y+r[4]\n"
+  "if x<b[5]then b[5]=x end\n"
+  "if y<b[6]then b[6]=y end\n"
+  "if x2>b[7]then b[7]=x2 end\n"
+  "if y2>b[8]then b[8]=y2 end\n"
+  "end\n"
+  "boxes[s]=b\n"
+  "end\n"
+  "return b\n"
+  "end\n"
+  "\n"
+  "local function layerBox(layer)\n"
+  "local b=boxes[layer]\n"
+  "if not b then\n"
+  "local huge=math.huge\n"
+  "b={huge,huge,-huge,-huge,huge,huge,-huge,-huge}\n"
+  "for _,s in ipairs(layer)do\n"
+  "local sb=shapeBox(s)\n"
+  "for n=1,8 do\n"
+  "b[n]=(n-1)%4<2 and math.min(b[n],sb[n])or math.max(b[n],sb[n])\n"
+  "end\n"
+  "end\n"
+  "boxes[layer]=b\n"
+  "end\n"
+  "return b\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function pathBoxesMeet(a,b)\n"
+  "return a[1]<=b[3]and b[1]<=a[3]and a[2]<=b[4]and b[2]<=a[4]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function rectBoxEncloses(a,b)\n"
+  "return a[5]<=b[5]and a[6]<=b[6]and b[7]<=a[7]and b[8]<=a[8]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gridSize=64\n"
+  "local grids=setmetatable({},{__mode=\"k\"})\n"
+  "\n"
+  "local function gridCells(grid,layer,fn)\n"
+  "local b=layerBox(layer)\n"
+  "local floor=math.floor\n"
+  "for cx=floor(math.min(b[1],b[5])/gridSize),floor(math.max(b[3],b[7])/gridSize)do\n"
+  "local col=grid.cells[cx]\n"
+  "if not col then\n"
+  "col={}\n"
+  "grid.cells[cx]=col\n"
+  "end\n"
+  "for cy=floor(math.min(b[2],b[6])/gridSize),floor(math.max(b[4],b[8])/gridSize)do\n"
+  "col[cy]=fn(col[cy])\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function gridAdd(grid,layer)\n"
+  "grid.count=grid.count+1\n"
+  "grid.seq[layer]=grid.count\n"
+  "if#layer[1].rects==0 then\n"
+  "grid.always[layer]=true\n"
+  "else\n"
+  "gridCells(grid,layer,function(cell)\n"
+  "cell=cell or{}\n"
+  "cell[layer]=true\n"
+  "return cell\n"
+  "end)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function gridRemove(grid,layer)\n"
+  "grid.seq[layer]=nil\n"
+  "if grid.always[layer]then\n"
+  "grid.always[layer]=nil\n"
+  "else\n"
+  "gridCells(grid,layer,function(cell)\n"
+  "cell[layer]=nil\n"
+  "return cell\n"
+  "end)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function getGrid(layers)\n"
+  "local grid=grids[layers]\n"
+  "if not grid then\n"
+  "grid={cells={},seq={},always={},count=0}\n"
+  "for n=#layers,1,-1 do\n"
+  "gridAdd(grid,layers[n])\n"
+  "end\n"
+  "grids[layers]=grid\n"
+  "end\n"
+  "return grid\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gridFind(grid,layers,shape)\n"
+  "if#shape.rects==0 then\n"
+  "return layers\n"
+  "end\n"
+  "\n"
+  "local b=shapeBox(shape)\n"
+  "local floor=math.floor\n"
+  "local found={}\n"
+  "for l in pairs(grid.always)do\n"
+  "found[l]=true\n"
+  "end\n"
+  "for cx=floor(math.min(b[1],b[5])/gridSize),floor(math.max(b[3],b[7])/gridSize)do\n"
+  "local col=grid.cells[cx]\n"
+  "for cy=floor(math.min(b[2],b[6])/gridSize),floor(math.max(b[4],b[8])/gridSize)do\n"
+  "for l in pairs(col and col[cy]or{})do\n"
+  "found[l]=true\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local seq=grid.seq\n"
+  "local list={}\n"
+  "for l in pairs(found)do\n"
+  "list[#list+1]=l\n"
+  "end\n"
+  "table.sort(list,function(a,b)return seq[a]>seq[b]end)\n"
+  "return list\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function addShape(layers,shape,overs)\n"
+  "local oldToNew={}\n"
+  "local layer={shape,overs=overs or{}}\n"
+  "local bConflict=false\n"
+  "\n"
+  "\n"
+  "local function mergeLayer(ll)\n"
+  "if isOver(ll,layer)or isOver(layer,ll)then\n"
+  "bConflict=true\n"
+  "return\n"
+  "end\n"
+  "for _,s in ipairs(ll)do\n"
+  "table.insert(layer,s)\n"
+  "end\n"
+  "for _,o in ipairs(ll.overs or{})do\n"
+  "table.insert(layer.overs,o)\n"
+  "end\n"
+  "oldToNew[ll]=layer\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local grid=getGrid(layers)\n"
+  "local sb=shapeBox(shape)\n"
+  "\n"
+  "\n"
+  "for _,ll in ipairs(gridFind(grid,layers,shape))do\n"
+  "local merged=false\n"
+  "if pathBoxesMeet(sb,layerBox(ll))then\n"
+  "for _,ss in ipairs(ll)do\n"
+  "if pathBoxesMeet(sb,shapeBox(ss))and shapeCrosses(shape,ss)then\n"
+  "merged=true\n"
+  "mergeLayer(ll)\n"
+  "break\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "if not merged then\n"
+  "local lb=shapeBox(ll[1])\n"
+  "if rectBoxEncloses(lb,sb)and shapeContains(ll[1],shape)then\n"
+  "ll.overs=ll.overs or{}\n"
+  "table.insert(ll.overs,layer)\n"
+  "elseif rectBoxEncloses(sb,lb)and shapeContains(shape,ll[1])then\n"
+  "table.insert(layer.overs,ll)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if bConflict then return false end\n"
+  "\n"
+  "table.insert(layers,1,layer)\n"
+  "\n"
+  "if next(oldToNew)then\n"
+  "\n"
+  "local nOut=1\n"
+  "for nIn=1,#layers do\n"
+  "local ll=layers[nIn]\n"
+  "layers[nIn]=nil\n"
+  "if not oldToNew[ll]then\n"
+  "layers[nOut]=ll\n"
+  "nOut=nOut+1\n"
+  "for ndx=1,ll.overs and#ll.overs or 0 do\n"
+  "ll.overs[ndx]=oldToNew[ll.overs[ndx]]or ll.overs[ndx]\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "for ll in pairs(oldToNew)do\n"
+  "gridRemove(grid,ll)\n"
+  "end\n"
+  "end\n"
+  "gridAdd(grid,layer)\n"
+  "\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getLayers(shapes)\n"
+  "local layers={}\n"
+  "for _,s in ipairs(shapes)do\n"
+  "addShape(layers,s)\n"
+  "end\n"
+  "return layers\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function sortLayers(layers)\n"
+  "local o={}\n"
+  "local visited={}\n"
+  "local function visit(ary)\n"
+  "for _,l in ipairs(ary)do\n"
+  "if not visited[l]then\n"
+  "visited[l]=true\n"
+  "if l.overs then visit(l.overs)end\n"
+  "table.insert(o,l)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "visit(layers)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function isCovered(a,b,layers,overs,cwid,chgt,sorted)\n"
+  "local dir=(a[1]==b[1])and 2 or 1\n"
+  "local runs={{minmax(a[dir],b[dir])}}\n"
+  "local axis=a[3-dir]\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local lo,hi=runs[1][1],runs[1][2]\n"
+  "local pad={cwid,chgt}\n"
+  "local perp=3-dir\n"
+  "\n"
+  "for _,layer in ipairs(sorted or sortLayers(layers))do\n"
+  "local lb=layerBox(layer)\n"
+  "if lb[4+perp]-pad[perp]<=axis and axis<=lb[6+perp]+pad[perp]and\n"
+  "(lo==hi or lb[4+dir]-pad[dir]<=hi and lo<=lb[6+dir]+pad[dir])then\n"
+  "local layerIsOver=false\n"
+  "for _,s in ipairs(layer)do\n"
+  "for _,r in ipairs(s.rects)do\n"
+  "local x,y,w,h=unpack(r)\n"
+  "local x2,y2=x+w+cwid,y+h+chgt\n"
+  "x=x-cwid\n"
+  "y=y-chgt\n"
+  "\n"
+  "if dir==2 then\n"
+  "x,y,x2,y2=y,x,y2,x2\n"
+  "end\n"
+  "\n"
+  "if y<=axis and axis<=y2 then\n"
+  "local n=1\n"
+  "while runs[n]do\n"
+  "local r=runs[n]\n"
+  "local a,b,c,d\n"
+  "a,b=r[1],math.min(r[2],x)\n"
+  "c,d=math.max(x2,r[1]),r[2]\n"
+  "\n"
+  "if a>=b and c>=d then\n"
+  "\n"
+  "table.remove(runs,n)\n"
+  "layerIsOver=true\n"
+  "elseif a<b and c<d then\n"
+  "\n"
+  "runs[n]={c,d}\n"
+  "table.insert(runs,n,{a,b})\n"
+  "layerIsOver=true\n"
+  "else\n"
+  "\n"
+  "if c<d then a,b=c,d end\n"
+  "if a~=r[1]or b~=r[2]then\n"
+  "layerIsOver=true\n"
+  "r[1]=a\n"
+  "r[2]=b\n"
+  "end\n"
+  "n=n+1\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "if layerIsOver then\n"
+  "table.insert(overs,layer)\n"
+  "end\n"
+  "if#runs==0 then return true end\n"
+  "end\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function inferShape(path,layers,cw,ch,sorted)\n"
+  "if path.loop then return end\n"
+  "if#path<3 then return end\n"
+  "\n"
+  "local decorations=path[1].flags..path[#path].flags\n"
+  "if decorations:match\"[oa]\"then return end\n"
+  "\n"
+  "local a,a2=path[1],path[2]\n"
+  "local b,b2=path[#path],path[#path-1]\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function nextVertex(a,b)\n"
+  "local d=a[1]==b[1]and 2 or 1\n"
+  "local e=3-d\n"
+  "if a.flags:match\"c\"then\n"
+  "\n"
+  "return{[d]={a[d],a[d]},\n"
+  "[e]={-math.huge,math.huge}}\n"
+  "else\n"
+  "\n"
+  "return{\n"
+  "[d]=a[d]>b[d]and{a[d],math.huge}or{-math.huge,a[d]},\n"
+  "[e]={a[e],a[e]}\n"
+  "}\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local c1=nextVertex(path[1],path[2])\n"
+  "local c2=nextVertex(path[#path],path[#path-1])\n"
+  "\n"
+  "local function rangeIntersect(a,b)\n"
+  "return math.max(a[1],b[1]),math.min(a[2],b[2])\n"
+  "end\n"
+  "\n"
+  "local x,xMax=rangeIntersect(c1[1],c2[1])\n"
+  "local y,yMax=rangeIntersect(c1[2],c2[2])\n"
+  "\n"
+  "if x~=xMax or y~=yMax then\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local overs={}\n"
+  "if not isCovered(a,{x,y},layers,overs,cw,ch,sorted)or\n"
+  "not isCovered(b,{x,y},layers,overs,cw,ch,sorted)then\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local p2=clone(path)\n"
+  "local p={x,y,flags=\"\"}\n"
+  "\n"
+  "if p2[1].flags:match\"c\"then\n"
+  "table.insert(p2,1,p)\n"
+  "else\n"
+  "p2[1]=p\n"
+  "end\n"
+  "if p2[#p2].flags:match\"c\"then\n"
+  "table.insert(p2,p)\n"
+  "else\n"
+  "p2[#p2]=p\n"
+  "end\n"
+  "p2.loop=true\n"
+  "\n"
+  "local shape=makeShape(p2)\n"
+  "if shape then\n"
+  "shape.origPath=path\n"
+  "return shape,overs\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function inferShapes(layers,paths,cw,ch)\n"
+  "local found\n"
+  "repeat\n"
+  "found=false\n"
+  "local sorted=sortLayers(layers)\n"
+  "for n=#paths,1,-1 do\n"
+  "local shape,overs=inferShape(paths[n],layers,cw,ch,sorted)\n"
+  "if shape then\n"
+  "if addShape(layers,shape,overs)then\n"
+  "found=true\n"
+  "table.remove(paths,n)\n"
+  "end\n"
+  "\n"
+  "sorted=sortLayers(layers)\n"
+  "end\n"
+  "end\n"
+  "until found==false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function arrowAt(gc,pt,ptFrom,cwid,chgt)\n"
+  "if not pt.flags:match(\"a\")then return end\n"
+  "\n"
+  "local len=chgt*2/3\n"
+  "local mx,my=xyDir(pt,ptFrom)\n"
+  "\n"
+  "\n"
+  "local hwid=math.max(3,math.floor(1+len/3))\n"
+  "\n"
+  "if pt.flags:match(\"e\")then\n"
+  "pt[1]=pt[1]-mx*cwid/2\n"
+  "pt[2]=pt[2]-my*chgt/2\n"
+  "end\n"
+  "\n"
+  "gc:wedge(pt[1],pt[2],(mx+my)*len,hwid,hwid,my~=0)\n"
+  "pt[1]=pt[1]+mx*hwid\n"
+  "pt[2]=pt[2]+my*hwid\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function circleAt(gc,pt,ptFrom,cwid,chgt)\n"
+  "if not pt.flags:match(\"o\")then return end\n"
+  "\n"
+  "local r=math.floor((cwid+chgt)/6)\n"
+  "local lw=2\n"
+  "\n"
+  "\n"
+  "local mx,my=xyDir(pt,ptFrom)\n"
+  "local x=pt[1]+mx*(cwid/2)\n"
+  "local y=pt[2]+my*(chgt/2)\n"
+  "\n"
+  "gc:circle(x,y,r,{lineWidth=lw})\n"
+  "\n"
+  "\n"
+  "pt[1]=x+mx*(r+lw/2)\n"
+  "pt[2]=y+my*(r+lw/2)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function drawRect(gc,rect,class,o)\n"
+  "local x,y,w,h=unpack(rect)\n"
+  "local class=class or\"rect\"\n"
+  "if rect.dotted then class=\"d\"..class end\n"
+  "\n"
+  "o=o or{}\n"
+  "o.strokeStyle=\"default\"\n"
+  "o.lineWidth=o.lineWidth or(rect.dotted and 2 or 3)\n"
+  "o.class=class\n"
+  "\n"
+  "if rect.radius then\n"
+  "o.class=o.class..\" round\"\n"
+  "o.radius=rect.radius\n"
+  "end\n"
+  "gc:rect(x,y,w,h,o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function drawPaths(gc,paths,cwid,chgt)\n"
+  "\n"
+  "\n"
+  "for _,path in ipairs(paths)do\n"
+  "for n,pt in ipairs(path)do\n"
+  "path[n]={pt[1]*cwid,pt[2]*chgt,flags=pt.flags}\n"
+  "\n"
+  "path.flags=path.flags..pt.flags\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local shapes\n"
+  "\n"
+  "shapes,paths=getShapes(paths)\n"
+  "\n"
+  "local layers=getLayers(shapes)\n"
+  "\n"
+  "inferShapes(layers,paths,cwid,chgt)\n"
+  "\n"
+  "for _,layer in ipairs(reverse(sortLayers(layers)))do\n"
+  "local rects={}\n"
+  "for _,shape in ipairs(layer)do\n"
+  "for _,rect in ipairs(shape.rects)do\n"
+  "table.insert(rects,rect)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for _,rect in ipairs(rects)do\n"
+  "drawRect(gc,rect,\"rect\")\n"
+  "end\n"
+  "\n"
+  "if#rects>1 then\n"
+  "\n"
+  "for _,rect in ipairs(rects)do\n"
+  "drawRect(gc,rect,\"nofx\",{strokeColor=\"transparent\"})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for _,shape in ipairs(layer)do\n"
+  "local p=shape.path\n"
+  "p.class=p.flags:match(\"d\")and\"dline\"or\"line\"\n"
+  "if p.flags:match(\"r\")then\n"
+  "p.radius=cwid\n"
+  "end\n"
+  "p.lineWidth=3\n"
+  "gc:path(shape.path)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "for _,p in ipairs(paths)do\n"
+  "p.class=p.flags:match(\"d\")and\"dline\"or\"line\"\n"
+  "\n"
+  "if p.flags:match(\"r\")then\n"
+  "\n"
+  "\n"
+  "p.radius=cwid\n"
+  "end\n"
+  "\n"
+  "arrowAt(gc,p[1],p[2],cwid,chgt)\n"
+  "arrowAt(gc,p[#p],p[#p-1],cwid,chgt)\n"
+  "circleAt(gc,p[1],p[2],cwid,chgt)\n"
+  "circleAt(gc,p[#p],p[#p-1],cwid,chgt)\n"
+  "\n"
+  "gc:path(p)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function clearChars(str,a,b)\n"
+  "return str:sub(1,a-1)..string.rep(\"\\t\",b-a+1)..str:sub(b+1)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function clearLineChars(textLines,hl,vl)\n"
+  "local t={}\n"
+  "for n,v in ipairs(textLines)do\n"
+  "t[n]=v\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for _,line in ipairs(hl)do\n"
+  "local y=line[1]+1\n"
+  "t[y]=clearChars(t[y],line[2]+1,line[3])\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for _,line in ipairs(vl)do\n"
+  "local x=line[1]+1\n"
+  "for y=line[2]+1,line[3]do\n"
+  "t[y]=clearChars(t[y],x,x)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function scan(textLines)\n"
+  "local o={}\n"
+  "\n"
+  "o.rows=#textLines\n"
+  "o.columns=0\n"
+  "for _,line in ipairs(textLines)do\n"
+  "line=rtrim(line)\n"
+  "if#line>o.columns then\n"
+  "o.columns=#line\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local h,v,r\n"
+  "h=getHLines(textLines)\n"
+  "v=getVLines(textLines)\n"
+  "o.txt=clearLineChars(textLines,h,v)\n"
+  "o.paths=getPaths(h,v)\n"
+  "\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function getRuns(g)\n"
+  "local runs={}\n"
+  "local nextXTR={}\n"
+  "\n"
+  "for nline,txt in ipairs(g.txt)do\n"
+  "local xToRun=nextXTR\n"
+  "nextXTR={}\n"
+  "\n"
+  "local pos=1\n"
+  "while pos<=#txt do\n"
+  "local a=txt:find(\"[^ \\t]\",pos)\n"
+  "if not a then break end\n"
+  "local b1=txt:find(\"   \",a)or#txt+1\n"
+  "local b2=txt:find(\"\\t\",a)or#txt+1\n"
+  "local b=math.min(b1,b2)\n"
+  "local text=rtrim(txt:sub(a,b-1))\n"
+  "\n"
+  "\n"
+  "local toleft\n"
+  "for n=a-1,1,-1 do\n"
+  "local c=txt:sub(n,n)\n"
+  "if c~=\" \"then\n"
+  "if c==\"\\t\"then\n"
+  "toleft=a-n-1\n"
+  "end\n"
+  "break\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local toright=txt:match(\"^ *()\\t\",b)\n"
+  "if toright then\n"
+  "toright=toright-(a+#text)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local mid\n"
+  "if toleft and toright and math.abs(toleft-toright)<=1 then\n"
+  "mid=a-1+(#text+toright-toleft)/2\n"
+  "end\n"
+  "\n"
+  "local run={\n"
+  "x=a-1,\n"
+  "y=nline-1,\n"
+  "text=text,\n"
+  "mid=mid,\n"
+  "atleft=(toleft and toleft<2)and toleft or nil,\n"
+  "atright=(toright and toright<2)and toright or nil\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local prev=xToRun[a]\n"
+  "if prev then\n"
+  "prev.left=true\n"
+  "run.left=true\n"
+  "end\n"
+  "prev=xToRun[a+#text-1/2]\n"
+  "if prev then\n"
+  "prev.right=true\n"
+  "run.right=true\n"
+  "end\n"
+  "nextXTR[a]=run\n"
+  "nextXTR[a+#text-1/2]=run\n"
+  "\n"
+  "table.insert(runs,run)\n"
+  "pos=b+1\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return runs\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function drawGrid(gc,g,lw,cwid,chgt)\n"
+  "local c=gc.fillColor\n"
+  "gc.fillColor=\"#bbb\"\n"
+  "for n=0,g.rows-1 do\n"
+  "gc:fillRect(0,n*chgt,g.columns*cwid,lw)\n"
+  "end\n"
+  "for n=0,g.columns-1 do\n"
+  "gc:fillRect(n*cwid,0,lw,g.rows*chgt)\n"
+  "end\n"
+  "gc.fillColor=c\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function round(n)\n"
+  "return math.floor(n*100+.05)/100\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gen(g,gc)\n"
+  "local aspect=2.0\n"
+  "local maxWidth=640\n"
+  "local maxEm=16\n"
+  "local fontScale=0.78\n"
+  "\n"
+  "gc.canvasClass=\"art\"\n"
+  "\n"
+  "\n"
+  "local em=math.min(maxEm,round(maxWidth/g.columns*aspect))\n"
+  "local chgt=em\n"
+  "local cwid=em/aspect\n"
+  "\n"
+  "gc:setSize(g.columns*cwid,g.rows*chgt)\n"
+  "gc.arrowLength=round(em*8/12)\n"
+  "gc.fontSize=round(em*fontScale)\n"
+  "gc.lineHeight=chgt\n"
+  "gc.strokeColor=\"default\"\n"
+  "gc.strokeStyle=nil\n"
+  "gc.fillColor=\"black\"\n"
+  "\n"
+  "if bdebug then drawGrid(gc,g,1,cwid,chgt)end\n"
+  "\n"
+  "\n"
+  "\n"
+  "drawPaths(gc,g.paths,cwid,chgt)\n"
+  "\n"
+  "\n"
+  "\n"
+  "local runs=getRuns(g)\n"
+  "for _,r in ipairs(runs)do\n"
+  "local x,y,w=r.x*cwid,r.y*chgt,#r.text*cwid\n"
+  "local align\n"
+  "if r.mid then\n"
+  "x=r.mid*cwid-w/2\n"
+  "elseif r.atleft then\n"
+  "align=\"left\"\n"
+  "elseif r.atright then\n"
+  "align=\"right\"\n"
+  "elseif r.left then\n"
+  "align=\"left\"\n"
+  "elseif r.right then\n"
+  "align=\"right\"\n"
+  "end\n"
+  "if align==\"right\"then\n"
+  "x=x-w\n"
+  "w=w*2\n"
+  "end\n"
+  "gc:rect(x,y,w,gc.lineHeight,{text=r.text,textAlign=align})\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function splitLines(txt)\n"
+  "local lines={}\n"
+  "for line in txt:gmatch(\"([^\\n]*)\\n\?\")do\n"
+  "table.insert(lines,line)\n"
+  "end\n"
+  "if lines[#lines]==\"\"then table.remove(lines)end\n"
+  "return lines\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function render2D(node,gc)\n"
+  "local lines=splitLines(node.text)\n"
+  "return gen(scan(lines),gc)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "render2D=render2D\n"
+  "}\n"
+  "";
+
+static const unsigned char data23[] = 
+  "\n"
+  "\n"
+  "return function(node)\n"
+  "local E=require(\"smarklib\").E\n"
+  "return E.pre{node.text}\n"
+  "end\n"
+  "";
+
+static const unsigned char data24[] = 
+  "local mu=require\"markup\"\n"
+  "local doctree=require\"doctree\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function visitNodes(tree,ofType,fn)\n"
+  "return doctree.visitElems(tree,fn,ofType)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "parse=mu.parseDoc,\n"
+  "expand=mu.expandDoc,\n"
+  "E=doctree.E,\n"
+  "TYPE=doctree.TYPE,\n"
+  "visitNodes=visitNodes,\n"
+  "}\n"
+  "";
+
+static const unsigned char data25[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mscgen=require\"mscgen\"\n"
+  "\n"
+  "local MSC={}\n"
+  "\n"
+  "function MSC:render2D(gc)\n"
+  "local function warn(pos,...)\n"
+  "self._source:warn(pos,...)\n"
+  "end\n"
+  "return mscgen.render(mscgen.parse(self.text,warn),gc)\n"
+  "end\n"
+  "\n"
+  "return MSC\n"
+  "";
+
+static const unsigned char data26[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local lpeg=require\"lpeg\"\n"
+  "local maxn=require\"maxn\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local parse do\n"
+  "local P,R,S=lpeg.P,lpeg.R,lpeg.S\n"
+  "local Cc,Cmt,Ct,Cs,Cp=lpeg.Cc,lpeg.Cmt,lpeg.Ct,lpeg.Cs,lpeg.Cp\n"
+  "\n"
+  "local comment,spaces,string,op,oppat,ident,attr,attrs,\n"
+  "arc,arcgrp,arcs,entity,entities,option,options,mscbody,msc\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local failures\n"
+  "local function wanted(s,i,c)\n"
+  "if not failures[i]then\n"
+  "failures[i]={}\n"
+  "end\n"
+  "table.insert(failures[i],c)\n"
+  "end\n"
+  "local function fail(desc)\n"
+  "return Cmt(Cc(desc),wanted)*P(false)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function Attr(name,value)\n"
+  "return{key=name,value=value}\n"
+  "end\n"
+  "\n"
+  "local function Arc(arc,...)\n"
+  "local a={attrs={...}}\n"
+  "if type(arc)==\"table\"then\n"
+  "a.lpos,a.lhs,a.op,a.rpos,a.rhs=table.unpack(arc)\n"
+  "else\n"
+  "a.op=arc\n"
+  "end\n"
+  "return a\n"
+  "end\n"
+  "local function Entity(name,...)\n"
+  "return{key=name,attrs={...}}\n"
+  "end\n"
+  "local function Option(a,b,c,d)\n"
+  "return{kpos=a,key=b,vpos=c,value=d,}\n"
+  "end\n"
+  "local function MSC(a,b,c)\n"
+  "return{options=a,entities=b,arcs=c}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "comment=(P\"#\"+P\"//\")*(1-P\"\\n\")^0*(\"\\n\"+-P(1))\n"
+  "+P\"/*\"*(1-P\"*/\")^0*P\"*/\"\n"
+  "\n"
+  "spaces=(S\" \\t\\r\\n\"^1+comment)^0\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function L(str,desc)\n"
+  "return str*spaces+fail(desc or str)\n"
+  "end\n"
+  "local function T(str,desc)\n"
+  "return L(Cs(str),desc or str)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function ipat(str)\n"
+  "local pat\n"
+  "for c in str:gmatch(\".\")do\n"
+  "local cpat=S(c:lower()..c:upper())\n"
+  "pat=pat and(pat*cpat)or cpat\n"
+  "end\n"
+  "return pat\n"
+  "end\n"
+  "\n"
+  "local function ci(str)\n"
+  "return ipat(str)/str\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "ident=T(R(\"AZ\",\"az\",\"09\",\"__\")^1,\"identifier\")\n"
+  "\n"
+  "string=ident+'\"'*Cs((P\"\\\\n\"/\"\\n\"\n"
+  "+P\"\\\\\"/\"\"*S\"\\\\'\\\"\"\n"
+  "+(1-P'\"'))^0)*L'\"'\n"
+  "\n"
+  "oppat=P\"<->\"+\"<=>\"+\"<.>\"+\"<<=>>\"+\"<:>\"+\"<<>>\"+\n"
+  "\"->\"+\">>\"+\"=>>\"+\"=>\"+\".>\"+\":>\"+\n"
+  "\"<<=\"+\"<<\"+\"<-\"+\"<=\"+\"<.\"+\"<:\"+\n"
+  "\"--\"+\"==\"+\"..\"+\"::\"+\n"
+  "ci\"-x\"+ci\"x-\"+ci\"rbox\"+ci\"abox\"+ci\"box\"\n"
+  "\n"
+  "op=T(oppat,'operator (\"->\", \"box\", ..)')\n"
+  "\n"
+  "attr=ident*L\"=\"*string/Attr\n"
+  "attrs=attr*(L\",\"*attr)^0\n"
+  "\n"
+  "arc=(T\"...\"+T\"---\"+T\"|||\"\n"
+  "+Ct(Cp()*(string+T\"*\")*op*Cp()*(string+T\"*\")))\n"
+  "*(L\"[\"*attrs*L\"]\")^0/Arc\n"
+  "arcgrp=Ct(arc*(L\",\"*arc)^0)\n"
+  "arcs=Ct(arcgrp*(L\";\"*arcgrp)^0)*L\";\"+Ct(\"\")\n"
+  "\n"
+  "entity=string*(L\"[\"*attrs*L\"]\")^0/Entity\n"
+  "entities=Ct(entity*(L\",\"*entity)^0)*L\";\"+Ct(\"\")\n"
+  "\n"
+  "option=Cp()*ident*L\"=\"*Cp()*string/Option\n"
+  "options=Ct(option*(L\",\"*option)^0*L\";\"+\"\")\n"
+  "\n"
+  "mscbody=options*entities*arcs\n"
+  "msc=spaces*((L(ipat\"msc\")+\"\")*L\"{\"*mscbody*L\"}\"\n"
+  "+mscbody)/MSC*spaces\n"
+  "*(-P(1)+fail(\"end of chart\"))\n"
+  "\n"
+  "\n"
+  "function parse(str,warn)\n"
+  "failures={[1]={\"identifier\"}}\n"
+  "local a,b=msc:match(str)\n"
+  "if not a then\n"
+  "local n=maxn(failures)\n"
+  "warn(n,\"msc: expected %s\",table.concat(failures[n],\" or \"))\n"
+  "else\n"
+  "a.warn=warn\n"
+  "end\n"
+  "return a,b\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function sign(x)\n"
+  "return x>0 and 1 or x<0 and-1 or 0\n"
+  "end\n"
+  "\n"
+  "local function minmax(a,b)\n"
+  "if a<b then return a,b else return b,a end\n"
+  "end\n"
+  "\n"
+  "local function round(val,res)\n"
+  "res=res or 1\n"
+  "return math.floor(math.floor(val*res+0.5)/res)\n"
+  "end\n"
+  "\n"
+  "local function drawAngleBox(gc,x,y,w,h,txt,clr)\n"
+  "local lw,lwSav=2,gc.lineWidth\n"
+  "gc.lineWidth=lw\n"
+  "local a\n"
+  "\n"
+  "x,y,w,h,a=round(x),round(y-lw/2),round(w),round(h+lw),round(h/4)\n"
+  "x=x+a\n"
+  "w=w-2*a\n"
+  "local ym=y+h/2\n"
+  "local o={open=true,color=clr,arrowLength=a,arrowWidth=h}\n"
+  "local pl,pr={x-a,ym},{x+w+a,ym}\n"
+  "gc:arrow(pl,pr,o)\n"
+  "gc:arrow(pr,pl,o)\n"
+  "\n"
+  "gc:rect(x+lw/2,y+lw/2,w-lw,h-lw,{\n"
+  "text=txt,fill=true,fillColor=\"white\",\n"
+  "strokeStyle=\"solid\",omitBorders={\"right\",\"left\"},\n"
+  "strokeColor=clr or nil\n"
+  "})\n"
+  "\n"
+  "gc.lineWidth=lwSav\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local r2l={\n"
+  "[\"<<=\"]=\"=>>\",\n"
+  "[\"<<\"]=\">>\",\n"
+  "[\"<-\"]=\"->\",\n"
+  "[\"<=\"]=\"=>\",\n"
+  "[\"<.\"]=\".>\",\n"
+  "[\"<:\"]=\":>\",\n"
+  "[\"x-\"]=\"-x\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local arcStyles={\n"
+  "[\"->\"]={open=true,noTop=true,arrowWidth=12},\n"
+  "[\"=>>\"]={open=true,arrowWidth=12},\n"
+  "[\"-x\"]={open=true,noTop=true},\n"
+  "[\"=>\"]={},\n"
+  "[\".>\"]={lineStyle=\"dotted\"},\n"
+  "[\">>\"]={lineStyle=\"dashed\"},\n"
+  "[\":>\"]={arrowLength=13,arrowWidth=10,lineStyle=\"double\",lineWidth=3},\n"
+  "}\n"
+  "arcStyles[\"--\"]=arcStyles[\"->\"]\n"
+  "arcStyles[\"==\"]=arcStyles[\"=>\"]\n"
+  "arcStyles[\"..\"]=arcStyles[\".>\"]\n"
+  "arcStyles[\"::\"]=arcStyles[\":>\"]\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newType(name,f)\n"
+  "return setmetatable({name},{__index=function(t,k)return f(k)end})\n"
+  "end\n"
+  "\n"
+  "local numeric=newType(\"numeric\",tonumber)\n"
+  "local any=newType(\"any\",function(x)return x end)\n"
+  "\n"
+  "local optionTypes={\n"
+  "\"option\",\n"
+  "arcgradient=numeric,\n"
+  "entities={'\"on\" or \"off\"',on=\"on\",off=\"off\"},\n"
+  "float={'\"left\" or \"right\"',right=\"right\",left=\"left\"},\n"
+  "hscale=numeric,\n"
+  "width=numeric,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local attrTypes={\n"
+  "\"attribute\",\n"
+  "arclinecolor=any,\n"
+  "arcskip=numeric,\n"
+  "arctextbgcolor=any,\n"
+  "arctextcolor=any,\n"
+  "id=any,\n"
+  "idurl=any,\n"
+  "label=any,\n"
+  "linecolor=any,\n"
+  "textbgcolor=any,\n"
+  "textcolor=any,\n"
+  "url=any,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getValues(m,tbl,types)\n"
+  "local options={}\n"
+  "for _,o in ipairs(tbl)do\n"
+  "local key=o.key:lower():gsub(\"colour\",\"color\")\n"
+  "local typ=types[key]\n"
+  "\n"
+  "if not typ then\n"
+  "m.warn(o.kpos,\"msc: unsupported %s: %s\",types[1],o.key)\n"
+  "elseif options[key]then\n"
+  "m.warn(o.kpos,\"msc: %s appears twice: %s\",types[1],o.key)\n"
+  "elseif not typ[o.value]then\n"
+  "m.warn(o.vpos,\"msc: %s %s ignored; value should be %s\",\n"
+  "types[1],o.key,typ[1])\n"
+  "else\n"
+  "options[key]=typ[o.value]\n"
+  "end\n"
+  "end\n"
+  "return options\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function makeLink(node,url)\n"
+  "if url then\n"
+  "if type(node)==\"string\"or node._type then\n"
+  "node={node}\n"
+  "end\n"
+  "node._type=\"a\"\n"
+  "node.href=url\n"
+  "end\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getLabel(a)\n"
+  "if a.label or a.id then\n"
+  "local label=a.label or\"\"\n"
+  "if a.id then\n"
+  "label={label,makeLink({type=\"sup\",a.id},a.idurl)}\n"
+  "end\n"
+  "return makeLink(label,a.url)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function beginRot(gc,gradient,skip,dy,src,dst,dx,path)\n"
+  "local offset=math.max(gradient or 0,0)+math.max((skip or 0)*dy,0)\n"
+  "if offset>=1 and src~=dst then\n"
+  "local a,b=path[1],path[2]\n"
+  "local rad=math.atan(offset/((dst-src)*dx))\n"
+  "local scale=round(1/math.cos(rad),1000)\n"
+  "\n"
+  "local xscale\n"
+  "if math.abs((scale-1)*(b[1]-a[1]))>=1.5 then\n"
+  "xscale=scale\n"
+  "end\n"
+  "gc:beginTransform(round(math.deg(rad),100),xscale,a[1],a[2])\n"
+  "return gc\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function endRot(gc)\n"
+  "if gc then gc:endTransform()end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getBoxHeight(a,dy,lineHeight)\n"
+  "local nls=select(2,string.gsub(a.label or\"\",\"\\n\",\"%1\"))\n"
+  "return math.max(dy,(nls+2)*lineHeight)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function scanArcs(m,options,y,dy,lineHeight)\n"
+  "local arcY={}\n"
+  "local abox=false\n"
+  "arcY[1]=y\n"
+  "for n,arcgrp in ipairs(m.arcs)do\n"
+  "local skip=0\n"
+  "local boxhgt=0\n"
+  "for _,a in ipairs(arcgrp)do\n"
+  "if a.op==\"abox\"then\n"
+  "abox=true\n"
+  "end\n"
+  "a.av=getValues(m,a.attrs,attrTypes)\n"
+  "skip=math.max(skip,a.av.arcskip or 0)\n"
+  "if a.op:match(\"box\")then\n"
+  "boxhgt=math.max(boxhgt,getBoxHeight(a.av,dy,lineHeight))\n"
+  "end\n"
+  "end\n"
+  "local hgt=math.max(0,options.arcgradient or 0)+(skip+1)*dy\n"
+  "y=y+math.max(hgt,boxhgt)\n"
+  "arcY[n+1]=y\n"
+  "end\n"
+  "return arcY,abox\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function render(m,gc)\n"
+  "if not m then\n"
+  "return(\"<pre>msc: Syntax error</pre>\")\n"
+  "end\n"
+  "\n"
+  "local eattrs={}\n"
+  "for ndx,e in ipairs(m.entities)do\n"
+  "local a=getValues(m,e.attrs,attrTypes)\n"
+  "a.ndx=ndx\n"
+  "eattrs[e.key]=a\n"
+  "eattrs[e]=a\n"
+  "end\n"
+  "\n"
+  "local options=getValues(m,m.options,optionTypes)\n"
+  "local w=options.width or 600\n"
+  "if options.hscale then\n"
+  "w=w*options.hscale\n"
+  "end\n"
+  "if options.float then\n"
+  "gc.float=options.float\n"
+  "end\n"
+  "local hideEnts=(options.entities==\"off\")\n"
+  "\n"
+  "local lineHeight=14\n"
+  "local ne=#m.entities\n"
+  "local boxw=120\n"
+  "local boxh=40\n"
+  "local dx=w/(ne>=1 and ne or 1)\n"
+  "local dy=30\n"
+  "local x0=dx/2\n"
+  "local y0=lineHeight*1.5\n"
+  "local spineWidth=2\n"
+  "\n"
+  "if hideEnts then\n"
+  "y0=0\n"
+  "end\n"
+  "\n"
+  "local arcY,usesABOX=scanArcs(m,options,y0,dy,lineHeight)\n"
+  "local maxy=arcY[#arcY]\n"
+  "\n"
+  "gc:setSize(w,maxy)\n"
+  "gc.fontSize=12\n"
+  "gc.canvasClass=\"msc\"\n"
+  "gc.lineHeight=lineHeight\n"
+  "gc.arrowLength=12\n"
+  "gc.arrowWidth=8\n"
+  "\n"
+  "\n"
+  "\n"
+  "gc.lineWidth=spineWidth\n"
+  "for n,e in ipairs(m.entities)do\n"
+  "local x=x0+(n-1)*dx\n"
+  "\n"
+  "if not hideEnts then\n"
+  "local textColor=eattrs[e].textcolor\n"
+  "local txt=eattrs[e].label or e.key\n"
+  "gc:rect(x-dx/2,0,dx,lineHeight,{\n"
+  "text=txt,textColor=textColor,\n"
+  "})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local color=eattrs[e].linecolor or\"#000\"\n"
+  "local yDrawn=y0\n"
+  "local function vlineto(nArc,style)\n"
+  "local y=arcY[nArc+1]\n"
+  "if y>yDrawn then\n"
+  "gc:path{{x,yDrawn},{x,y},\n"
+  "lineStyle=style,color=color}\n"
+  "yDrawn=y\n"
+  "end\n"
+  "end\n"
+  "for nArc,a in ipairs(m.arcs)do\n"
+  "if a[1]and a[1].op==\"...\"then\n"
+  "vlineto(nArc-1)\n"
+  "vlineto(nArc,\"dotted\")\n"
+  "end\n"
+  "end\n"
+  "vlineto(#m.arcs)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function arcTextAttrs(label,arcAttrs,entAttrs,textAlign)\n"
+  "return{\n"
+  "text=label,\n"
+  "textColor=arcAttrs.textcolor or entAttrs.arctextcolor,\n"
+  "textBG=arcAttrs.textbgcolor or entAttrs.arctextbgcolor or\"#fff\",\n"
+  "textAlign=textAlign\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function drawArc(y,src,dst,op,label,arcAttrs,entAttrs)\n"
+  "local xs,xd=x0+(src-1)*dx,x0+(dst-1)*dx\n"
+  "local xa,xb=minmax(xs,xd)\n"
+  "\n"
+  "if op:match(\"box\")then\n"
+  "\n"
+  "local ytop=y-dy*7/16\n"
+  "local boxwid=dx*7/8\n"
+  "local boxhgt=getBoxHeight(arcAttrs,dy,gc.lineHeight)-dy*1/8\n"
+  "xa=xa-boxwid/2\n"
+  "xb=xb+boxwid/2\n"
+  "local clr=arcAttrs.linecolor or nil\n"
+  "if op:match(\"abox\")then\n"
+  "drawAngleBox(gc,xa,ytop+0.5,xb-xa,boxhgt+1,label,clr)\n"
+  "else\n"
+  "local opts={\n"
+  "text=label,fill=true,fillColor=\"#fff\",strokeStyle=\"solid\",\n"
+  "radius=op:match(\"rbox\")and gc.lineHeight/2,strokeColor=clr\n"
+  "}\n"
+  "if usesABOX then\n"
+  "opts.lineWidth=2\n"
+  "else\n"
+  "opts.shadow=true\n"
+  "end\n"
+  "gc:rect(xa,ytop,xb-xa,boxhgt,opts)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local astyle=arcStyles[op:gsub(\"<\",\"\")]or{}\n"
+  "local color=arcAttrs.linecolor or entAttrs.arclinecolor\n"
+  "local lw=astyle.lineWidth or gc.lineWidth\n"
+  "local endcapwid=sign(xd-xs)*lw/2\n"
+  "local path={{xs+endcapwid,y},{xd-endcapwid,y}}\n"
+  "local top=y-gc.lineHeight-gc.lineWidth*2\n"
+  "local align=nil\n"
+  "\n"
+  "if src==dst then\n"
+  "\n"
+  "local wid=dx/3*(src==1 and-1 or 1)\n"
+  "local x2,y1,y2=xs+wid,y-dy/4,y+dy/4\n"
+  "path={{xs,y1},{x2,y1},{x2,y2},{xs,y2},radius=dy/4+lw/2}\n"
+  "\n"
+  "top=y1-gc.lineHeight/2\n"
+  "if src==1 then\n"
+  "xb=xb+dx\n"
+  "align=\"left\"\n"
+  "else\n"
+  "xa=xa-dx\n"
+  "align=\"right\"\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local rot=beginRot(gc,options.arcgradient,arcAttrs.arcskip,dy,src,dst,dx,path)\n"
+  "\n"
+  "if label then\n"
+  "gc:rect(xa+spineWidth*2,top,xb-xa-spineWidth*4,gc.lineHeight,\n"
+  "arcTextAttrs(label,arcAttrs,entAttrs,align))\n"
+  "end\n"
+  "local b,a=path[#path-1],path[#path]\n"
+  "if op==\"-x\"then\n"
+  "\n"
+  "a[1]=a[1]-(a[1]-b[1])/4\n"
+  "gc:strokeX(a[1],a[2]+1,4,color)\n"
+  "elseif op:match(\">\")then\n"
+  "\n"
+  "astyle.color=color\n"
+  "gc:arrow(a,b,astyle)\n"
+  "if op:match(\"<\")then\n"
+  "gc:arrow(path[1],path[2],astyle)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "path.lineStyle=astyle.lineStyle\n"
+  "path.lineWidth=astyle.lineWidth\n"
+  "path.color=color\n"
+  "gc:path(path)\n"
+  "\n"
+  "endRot(rot)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "gc.lineWidth=1\n"
+  "for n,arcgrp in ipairs(m.arcs)do\n"
+  "local y=arcY[n]+dy/2\n"
+  "for _,a in ipairs(arcgrp)do\n"
+  "local attrs=getValues(m,a.attrs,attrTypes)\n"
+  "local attrs=a.av\n"
+  "local arcOp=a.op\n"
+  "local label=getLabel(attrs)\n"
+  "\n"
+  "if a.lhs then\n"
+  "\n"
+  "local src,op,dst=a.lhs,a.op,a.rhs\n"
+  "if r2l[op]then\n"
+  "src,op,dst=dst,r2l[op],src\n"
+  "end\n"
+  "local from=eattrs[src]\n"
+  "local to=eattrs[dst]\n"
+  "if not from or(not to and dst~=\"*\")then\n"
+  "local e,pos=a.lhs,a.lpos\n"
+  "if eattrs[e]then\n"
+  "e,pos=a.rhs,a.rpos\n"
+  "end\n"
+  "m.warn(pos,\"msc: unknown entity: %s\",e)\n"
+  "elseif to then\n"
+  "\n"
+  "drawArc(y,from.ndx,to.ndx,op,label,attrs,from)\n"
+  "else\n"
+  "\n"
+  "for ndx=1,ne do\n"
+  "if ndx~=from.ndx then\n"
+  "drawArc(y,from.ndx,ndx,op,nil,attrs,from)\n"
+  "end\n"
+  "end\n"
+  "if label then\n"
+  "local top=y-gc.lineHeight-gc.lineWidth*2\n"
+  "gc:rect(0,top,dx*ne,gc.lineHeight,\n"
+  "arcTextAttrs(label,attrs,from))\n"
+  "end\n"
+  "end\n"
+  "else\n"
+  "\n"
+  "\n"
+  "if arcOp==\"---\"then\n"
+  "gc:path{{0,y},{w,y},lineStyle=\"dashed\",color=attrs.linecolor}\n"
+  "end\n"
+  "if label then\n"
+  "gc:rect(0,y-gc.lineHeight/2,w,gc.lineHeight,\n"
+  "arcTextAttrs(label,attrs,{}))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return{\n"
+  "render=render,\n"
+  "parse=parse,\n"
+  "}\n"
+  "";
+
+static const unsigned char data27[] = 
+  "\n"
+  "local function maxn(tbl)\n"
+  "local max=0\n"
+  "for k in pairs(tbl)do\n"
+  "if type(k)==\"number\"and k>max then\n"
+  "max=k\n"
+  "end\n"
+  "end\n"
+  "return max\n"
+  "end\n"
+  "\n"
+  "return maxn\n"
+  "";
+
+static const unsigned char data28[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local smarklib=require\"smarklib\"\n"
+  "local smarkmisc=require\"smarkmisc\"\n"
+  "\n"
+  "local lineToPos=smarkmisc.lineToPos\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function loadstringwith(str,name,locals,globals)\n"
+  "assert(type(str)==\"string\")\n"
+  "local f,err\n"
+  "if not locals or next(locals)==nil then\n"
+  "f,err=load(str,name,nil,globals)\n"
+  "else\n"
+  "local names,values={},{}\n"
+  "for k,v in pairs(locals)do\n"
+  "table.insert(names,k)\n"
+  "table.insert(values,v)\n"
+  "end\n"
+  "local c=string.format(\"local %s=... return function () %s\\nend\",\n"
+  "table.concat(names,\",\"),str)\n"
+  "f,err=load(c,name or str,nil,globals)\n"
+  "if f then\n"
+  "f=f(table.unpack(values))\n"
+  "end\n"
+  "end\n"
+  "return f,err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local locators={}\n"
+  "\n"
+  "local _pcall=pcall\n"
+  "\n"
+  "local function embeddedErrLocation(nstr,nline)\n"
+  "local locator=locators[tonumber(nstr)]\n"
+  "if locator then\n"
+  "local file,line,col=locator(nline)\n"
+  "return(file or\"\?\?\")..\":\"..(line or\"\?\?\")..\":\"..\n"
+  "(tonumber(col)and col..\":\"or\"\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function embeddedFixError(err)\n"
+  "if type(err)==\"string\"then\n"
+  "err=err:gsub(\"%.lua!(%d):(%d+):\",embeddedErrLocation)\n"
+  "end\n"
+  "return err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function embedded_pcall(fn,...)\n"
+  "local succ,result=_pcall(fn,...)\n"
+  "if not succ then\n"
+  "return succ,embeddedFixError(result)\n"
+  "end\n"
+  "return succ,result\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "pcall=embedded_pcall\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function loadsourcedlua(str,locator,locals,globals)\n"
+  "table.insert(locators,locator)\n"
+  "local f,msg=loadstringwith(str,\"@.lua!\"..(#locators),locals,globals)\n"
+  "if not f then\n"
+  "msg=embeddedFixError(msg)\n"
+  "end\n"
+  "return f,msg\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function luaMacro(node,doc)\n"
+  "local source=node._source\n"
+  "local text=node.text\n"
+  "\n"
+  "\n"
+  "local locals={\n"
+  "doc=doc,\n"
+  "source=source\n"
+  "}\n"
+  "for k,v in pairs(smarklib)do\n"
+  "locals[k]=v\n"
+  "end\n"
+  "\n"
+  "if not text:match(\"\\n\")then\n"
+  "\n"
+  "text=\"return \"..text\n"
+  "end\n"
+  "\n"
+  "local function locator(line)\n"
+  "local pos=lineToPos(text,tonumber(line))\n"
+  "local fsrc,pos,line,col=source:where(pos)\n"
+  "return fsrc.fileName,line,col\n"
+  "end\n"
+  "\n"
+  "local f,msg=loadsourcedlua(text,locator,locals,_G)\n"
+  "if not f then\n"
+  "source:warn(nil,\".lua macro compilation\\n%s\\n\",msg)\n"
+  "else\n"
+  "local succ,result=embedded_pcall(f)\n"
+  "if succ then\n"
+  "return result\n"
+  "end\n"
+  "source:warn(nil,\".lua macro execution\\n%s\\n\",result)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return luaMacro\n"
+  "";
+
+static const unsigned char data29[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local m=require\"memoize\"\n"
+  "\n"
+  "local function newClass(class)\n"
+  "local n=0\n"
+  "return m.newTable(function(item)n=n+1;return n end)\n"
+  "end\n"
+  "\n"
+  "local counts=m.newTable(newClass)\n"
+  "\n"
+  "return function(node)\n"
+  "local class,item=node.text:match(\"^([^ \\n]*)[ \\n]*(.*)\")\n"
+  "if not class then\n"
+  "class,item=\"\",node.text\n"
+  "end\n"
+  "return tostring(counts[class][item])\n"
+  "end\n"
+  "";
+
+static const unsigned char data30[] = 
+  "\n"
+  "\n"
+  "return function(node,doc)\n"
+  "local E=require(\"smarklib\").E\n"
+  "return E.table{\n"
+  "E.tr{\n"
+  "E.th{\"Input\",align=\"center\",width=\"50%\"},\n"
+  "E.th{\"Output\",align=\"center\",width=\"50%\"},\n"
+  "},\n"
+  "E.tr{\n"
+  "E.td{\n"
+  "class=\"pre\",style=\"white-space: pre;\",_whitespace=true,\n"
+  "node.text,\n"
+  "},\n"
+  "E.td{\n"
+  "doc.parse(node._source),\n"
+  "}\n"
+  "},\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "";
+
+static const unsigned char data31[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local memoize=require\"memoize\"\n"
+  "local smarklib=require\"smarklib\"\n"
+  "\n"
+  "local E,TYPE=smarklib.E,smarklib.TYPE\n"
+  "local insert=table.insert\n"
+  "\n"
+  "\n"
+  "local function lineCmp(a,b)\n"
+  "return a[1]<b[1]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getHLines(xyt)\n"
+  "local hlines={}\n"
+  "for pos,str in xyt.text:gmatch(\"()(%+[%+%-=]+%+)\")do\n"
+  "local x,y=xyt:getXY(pos)\n"
+  "insert(hlines,{y,x,x+#str-1,str})\n"
+  "end\n"
+  "return hlines\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getVLines(xyt)\n"
+  "local vlines={}\n"
+  "\n"
+  "\n"
+  "local columns=memoize.newTable(function()return{}end)\n"
+  "for pos in xyt.text:gmatch(\"()[%+|]\")do\n"
+  "local x,y=xyt:getXY(pos)\n"
+  "local col=columns[x]\n"
+  "if col[y-1]then\n"
+  "col[y]=col[y-1]+1\n"
+  "col[y-1]=nil\n"
+  "else\n"
+  "col[y]=1\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "for x,col in pairs(columns)do\n"
+  "for y,len in pairs(col)do\n"
+  "if len>2 then\n"
+  "insert(vlines,{x,y-(len-1),y})\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "table.sort(vlines,lineCmp)\n"
+  "return vlines\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newXYText(source)\n"
+  "local text=source.data\n"
+  "local self={text=text,1}\n"
+  "\n"
+  "for pos in text:gmatch(\"\\n()\")do\n"
+  "insert(self,pos)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local y=1\n"
+  "function self:getXY(pos)\n"
+  "while pos<self[y]and y>1 do\n"
+  "y=y-1\n"
+  "end\n"
+  "while pos>=(self[y+1]or math.huge)do\n"
+  "y=y+1\n"
+  "end\n"
+  "return pos-self[y]+1,y\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function self:sourceRect(x1,y1,x2,y2)\n"
+  "local runs={}\n"
+  "for y=y1,y2 do\n"
+  "local pos=self[y]\n"
+  "local posmax=(self[y+1]or#pos+2)-2\n"
+  "local a=math.min(pos+x1-1,posmax+1)\n"
+  "local b=math.min(pos+x2-1,posmax)\n"
+  "insert(runs,{a,b})\n"
+  "end\n"
+  "return source:extract(self[y1]+x1-1,runs,\"\\n\")\n"
+  "end\n"
+  "\n"
+  "return self\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function scanRow(vl,y1,y2,f)\n"
+  "local left,leftcol=(vl[1]and vl[1][1]),1\n"
+  "local col,colx=0,0\n"
+  "for _,v in ipairs(vl)do\n"
+  "local x,ya,yb,str=table.unpack(v)\n"
+  "if x>colx then\n"
+  "col=col+1\n"
+  "colx=x\n"
+  "end\n"
+  "if ya<=y1 and yb>=y2 then\n"
+  "if x>left then\n"
+  "local colspan=col-leftcol\n"
+  "f(left,x,colspan,(str or\"\"):sub(y1-ya+1,y2-ya+1))\n"
+  "left=x\n"
+  "leftcol=col\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local nonSpecialAttrs={[1]=true,[TYPE]=true,_source=true}\n"
+  "\n"
+  "local function canUnwrap(node)\n"
+  "if type(node)~=\"table\"or(node[TYPE]or\"div\")~=\"div\"then\n"
+  "return false\n"
+  "end\n"
+  "for k in pairs(node)do\n"
+  "if not nonSpecialAttrs[k]then\n"
+  "return false\n"
+  "end\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function parse(src)\n"
+  "local doc=smarklib.parse(src)\n"
+  "while canUnwrap(doc)do\n"
+  "doc=doc[1]\n"
+  "end\n"
+  "return doc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function getOutermostLines(hin,vin)\n"
+  "local hout,vout={},{table.remove(vin,1)}\n"
+  "\n"
+  "\n"
+  "local v={u=vin,c=vout,n=0}\n"
+  "local h={u=hin,c=hout,n=0}\n"
+  "\n"
+  "while true do\n"
+  "local nconn=#h.c\n"
+  "while v.n<#v.c do\n"
+  "v.n=v.n+1\n"
+  "local x,y1,y2=table.unpack(v.c[v.n])\n"
+  "\n"
+  "\n"
+  "local nn=1\n"
+  "for n=1,#h.u do\n"
+  "local l=h.u[n]\n"
+  "h.u[n]=nil\n"
+  "\n"
+  "local y,x1,x2=table.unpack(l)\n"
+  "if y1<=y and y<=y2 and x1<=x and x<=x2 then\n"
+  "insert(h.c,l)\n"
+  "else\n"
+  "h.u[nn]=l\n"
+  "nn=nn+1\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "if nconn==#h.c then break end\n"
+  "h,v=v,h\n"
+  "end\n"
+  "\n"
+  "table.sort(hout,lineCmp)\n"
+  "table.sort(vout,lineCmp)\n"
+  "\n"
+  "return hout,vout\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function makeTable(source)\n"
+  "local xyt=newXYText(source)\n"
+  "\n"
+  "\n"
+  "local hl=getHLines(xyt)\n"
+  "local vl=getVLines(xyt)\n"
+  "\n"
+  "\n"
+  "hl,vl=getOutermostLines(hl,vl)\n"
+  "\n"
+  "\n"
+  "local cols={}\n"
+  "for _,v in ipairs(vl)do\n"
+  "local x=v[1]\n"
+  "if cols[#cols]~=x then insert(cols,v)end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local tbl=E.table{}\n"
+  "local top=hl[1]and hl[1][1]\n"
+  "local spans={}\n"
+  "local nrow=0\n"
+  "for _,h in ipairs(hl)do\n"
+  "local y=h[1]\n"
+  "\n"
+  "if y>top then\n"
+  "nrow=nrow+1\n"
+  "\n"
+  "local row=E.tr{}\n"
+  "local ncol=1\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function rowcell(x1,x2,colspan)\n"
+  "if(spans[ncol]or 0)>nrow then ncol=ncol+colspan;return end\n"
+  "\n"
+  "\n"
+  "local ymax=y\n"
+  "local rowspan=1\n"
+  "local chars\n"
+  "scanRow(hl,x1,x2,function(y1,y2,r,ch)\n"
+  "if y1==top then\n"
+  "rowspan=r\n"
+  "chars=ch\n"
+  "ymax=y2\n"
+  "end\n"
+  "end)\n"
+  "\n"
+  "local src=xyt:sourceRect(x1+1,top+1,x2-1,ymax-1)\n"
+  "local tree=parse(src)\n"
+  "\n"
+  "local typ=chars:match(\"=\")and\"th\"or\"td\"\n"
+  "local cell=E(typ){\n"
+  "tree,\n"
+  "colspan=colspan>1 and colspan or nil,\n"
+  "rowspan=rowspan>1 and rowspan or nil,\n"
+  "}\n"
+  "insert(row,cell)\n"
+  "\n"
+  "\n"
+  "for nn=1,colspan do\n"
+  "spans[ncol]=nrow+rowspan\n"
+  "ncol=ncol+1\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "scanRow(vl,top,y,rowcell)\n"
+  "insert(tbl,row)\n"
+  "top=y\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return tbl\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function expand(node,doc)\n"
+  "return makeTable(node._source)\n"
+  "end\n"
+  "\n"
+  "return expand\n"
+  "";
+
+static const unsigned char data32[] = 
+  "\n"
+  "local function expand(node,doc)\n"
+  "local filename=node.text:gsub(\"^%s*(.-)%s*$\",\"%1\")\n"
+  "return doc.parse(node._source:newFile(filename))\n"
+  "end\n"
+  "\n"
+  "return{\n"
+  "expand=expand\n"
+  "}\n"
+  "";
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@smark.lua", (const char *) data1, 4839, 0 },
+   { "markup", "@/root/repo/smark/markup.lua", (const char *) data2, 14874, 0 },
+   { "smarkmisc", "@/root/repo/smark/smarkmisc.lua", (const char *) data3, 1540, 0 },
+   { "lpeg", 0, (const char *) 0, 0, luaopen_lpeg },
+   { "htmlrefs", "@/root/repo/smark/htmlrefs.lua", (const char *) data4, 2567, 0 },
+   { "utf8utils", "@/root/repo/luau/.out/exports/utf8utils.lua", (const char *) data5, 2235, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c },
+   { "object", "@/root/repo/luau/.out/exports/object.lua", (const char *) data6, 398, 0 },
+   { "source", "@/root/repo/smark/source.lua", (const char *) data7, 3514, 0 },
+   { "lfsu", "@/root/repo/luau/.out/exports/lfsu.lua", (const char *) data8, 1741, 0 },
+   { "xpfs", 0, (const char *) 0, 0, luaopen_xpfs },
+   { "fsu", "@/root/repo/luau/.out/exports/fsu.lua", (const char *) data9, 3208, 0 },
+   { "html2d", "@/root/repo/smark/html2d.lua", (const char *) data10, 13037, 0 },
+   { "doctree", "@/root/repo/luau/.out/exports/doctree.lua", (const char *) data11, 712, 0 },
+   { "memoize", "@/root/repo/luau/.out/exports/memoize.lua", (const char *) data12, 785, 0 },
+   { "opairs", "@/root/repo/luau/.out/exports/opairs.lua", (const char *) data13, 419, 0 },
+   { "svg2d", "@/root/repo/smark/svg2d.lua", (const char *) data14, 11982, 0 },
+   { "getopts", "@/root/repo/luau/.out/exports/getopts.lua", (const char *) data15, 1615, 0 },
+   { "errors", "@/root/repo/luau/.out/exports/errors.lua", (const char *) data16, 626, 0 },
+   { "htmlgen", "@/root/repo/luau/.out/exports/htmlgen.lua", (const char *) data17, 4728, 0 },
+   { "defaultcss", "@/root/repo/smark/defaultcss.lua", (const char *) data18, 4582, 0 },
+   { "serialize", "@/root/repo/luau/.out/exports/serialize.lua", (const char *) data19, 1867, 0 },
+   { "smarkcache", "@/root/repo/smark/smarkcache.lua", (const char *) data20, 2600, 0 },
+   { "smarkmacros", "@/root/repo/smark/smarkmacros.lua", (const char *) data21, 169, 0 },
+   { "smark_art", "@/root/repo/smark/smark_art.lua", (const char *) data22, 20249, 0 },
+   { "smark_pre", "@/root/repo/smark/smark_pre.lua", (const char *) data23, 82, 0 },
+   { "smarklib", "@/root/repo/smark/smarklib.lua", (const char *) data24, 254, 0 },
+   { "smark_msc", "@/root/repo/smark/smark_msc.lua", (const char *) data25, 204, 0 },
+   { "mscgen", "@/root/repo/smark/mscgen.lua", (const char *) data26, 10604, 0 },
+   { "maxn", "@/root/repo/luau/.out/exports/maxn.lua", (const char *) data27, 137, 0 },
+   { "smark_lua", "@/root/repo/smark/smark_lua.lua", (const char *) data28, 2061, 0 },
+   { "smark_counter", "@/root/repo/smark/smark_counter.lua", (const char *) data29, 330, 0 },
+   { "smark_example", "@/root/repo/smark/smark_example.lua", (const char *) data30, 293, 0 },
+   { "smark_table", "@/root/repo/smark/smark_table.lua", (const char *) data31, 3720, 0 },
+   { "smark_include", "@/root/repo/smark/smark_include.lua", (const char *) data32, 162, 0 }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
@@ -0,0 +1 @@
+return {value={"require","memoize"},stamp="2797:1173406:65024:1792372283",path="/root/repo/luau/.out/exports/doctree.lua"}
@@ -0,0 +1 @@
+return {path="/root/repo/luau/.out/exports/fsu.lua",value={},stamp="8210:1173410:65024:1792372283"}
@@ -0,0 +1 @@
+return {stamp="5855:1173412:65024:1792372283",path="/root/repo/luau/.out/exports/getopts.lua",value={}}
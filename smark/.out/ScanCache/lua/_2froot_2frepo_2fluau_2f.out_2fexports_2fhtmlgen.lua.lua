@@ -0,0 +1 @@
+return {stamp="10995:1173414:65024:1792374892",path="/root/repo/luau/.out/exports/htmlgen.lua",value={"require","object","require","utf8utils","require","doctree","require","opairs","require","textcodec_c"}}
@@ -0,0 +1 @@
+return {value={"require","xpfs","require","fsu"},path="/root/repo/luau/.out/exports/lfsu.lua",stamp="3368:1173418:65024:1792374835"}
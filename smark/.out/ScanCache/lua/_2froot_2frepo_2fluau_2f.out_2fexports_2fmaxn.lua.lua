@@ -0,0 +1 @@
+return {value={},stamp="180:1173422:65024:1792372283",path="/root/repo/luau/.out/exports/maxn.lua"}
@@ -0,0 +1 @@
+return {value={},stamp="2577:1173424:65024:1792372283",path="/root/repo/luau/.out/exports/memoize.lua"}
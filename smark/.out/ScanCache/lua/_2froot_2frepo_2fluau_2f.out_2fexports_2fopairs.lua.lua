@@ -0,0 +1 @@
+return {value={},stamp="870:1173430:65024:1792372283",path="/root/repo/luau/.out/exports/opairs.lua"}
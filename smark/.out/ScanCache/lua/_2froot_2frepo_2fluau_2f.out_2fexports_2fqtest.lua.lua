@@ -0,0 +1 @@
+return {value={"require","debug"},stamp="13597:1173432:65024:1792372283",path="/root/repo/luau/.out/exports/qtest.lua"}
@@ -0,0 +1 @@
+return {stamp="9711:1173440:65024:1792372283",path="/root/repo/luau/.out/exports/testexe.lua",value={"require","object","require","redir","require","xpexec"}}
@@ -0,0 +1 @@
+return {value={"require","textcodec_c"},path="/root/repo/luau/.out/exports/utf8utils.lua",stamp="4007:1173444:65024:1792374939"}
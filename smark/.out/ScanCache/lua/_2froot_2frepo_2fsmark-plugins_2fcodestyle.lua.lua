@@ -0,0 +1 @@
+return {path="/root/repo/smark-plugins/codestyle.lua",value={},stamp="258:1171903:65024:1792361468"}
@@ -0,0 +1 @@
+return {path="/root/repo/smark-plugins/smark_ccode.lua",value={"require","smarklex","require","lpeg"},stamp="4289:1171905:65024:1792362706"}
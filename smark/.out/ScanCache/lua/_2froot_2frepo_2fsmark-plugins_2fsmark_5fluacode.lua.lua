@@ -0,0 +1 @@
+return {path="/root/repo/smark-plugins/smark_luacode.lua",value={"require","smarklex","require","lpeg"},stamp="2967:1171909:65024:1792362749"}
@@ -0,0 +1 @@
+return {path="/root/repo/smark-plugins/smarklex.lua",stamp="3602:1171575:65024:1792375106",value={"require","lpeg","require","smarklib","require","codestyle"}}
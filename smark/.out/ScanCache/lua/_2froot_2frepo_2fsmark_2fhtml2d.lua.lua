@@ -0,0 +1 @@
+return {path="/root/repo/smark/html2d.lua",value={"require","object","require","doctree","require","opairs"},stamp="27809:1171918:65024:1792371858"}
@@ -0,0 +1 @@
+return {path="/root/repo/smark/htmlrefs.lua",value={},stamp="2610:1171920:65024:1792361468"}
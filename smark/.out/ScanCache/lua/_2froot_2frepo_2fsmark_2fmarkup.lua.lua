@@ -0,0 +1 @@
+return {stamp="28695:1171921:65024:1792371858",value={"require","smarkmisc","require","lpeg","require","htmlrefs","require","utf8utils","require","object","require","source","require","html2d","require","svg2d","require","doctree"},path="/root/repo/smark/markup.lua"}
@@ -0,0 +1 @@
+return {path="/root/repo/smark/mscgen.lua",value={"require","lpeg","require","maxn"},stamp="17499:1171923:65024:1792371858"}
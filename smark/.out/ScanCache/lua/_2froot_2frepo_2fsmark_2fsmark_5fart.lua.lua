@@ -0,0 +1 @@
+return {path="/root/repo/smark/smark_art.lua",value={"require","smarkmisc","require","memoize","require","opairs"},stamp="44407:1171928:65024:1792371858"}
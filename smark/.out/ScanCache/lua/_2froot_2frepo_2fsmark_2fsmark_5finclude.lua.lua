@@ -0,0 +1 @@
+return {stamp="180:1171933:65024:1792361468",value={},path="/root/repo/smark/smark_include.lua"}
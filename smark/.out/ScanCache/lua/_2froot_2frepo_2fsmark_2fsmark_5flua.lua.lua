@@ -0,0 +1 @@
+return {value={"require","smarklib","require","smarkmisc"},stamp="4416:1171935:65024:1792361468",path="/root/repo/smark/smark_lua.lua"}
@@ -0,0 +1 @@
+return {stamp="357:1171937:65024:1792361468",value={"require","mscgen"},path="/root/repo/smark/smark_msc.lua"}
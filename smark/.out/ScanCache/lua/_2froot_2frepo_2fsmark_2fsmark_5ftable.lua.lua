@@ -0,0 +1 @@
+return {path="/root/repo/smark/smark_table.lua",value={"require","memoize","require","smarklib"},stamp="6590:1171941:65024:1792361468"}
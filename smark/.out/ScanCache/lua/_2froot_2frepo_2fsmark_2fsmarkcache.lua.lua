@@ -0,0 +1 @@
+return {value={"require","serialize","require","lfsu","require","xpfs","require","smarkmisc"},path="/root/repo/smark/smarkcache.lua",stamp="5538:1173103:65024:1792374813"}
@@ -0,0 +1 @@
+return {path="/root/repo/smark/smarklib.lua",value={"require","markup","require","doctree"},stamp="348:1171944:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="2386:1171946:65024:1792361468",value={},path="/root/repo/smark/smarkmisc.lua"}
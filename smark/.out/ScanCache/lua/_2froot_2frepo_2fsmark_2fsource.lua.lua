@@ -0,0 +1 @@
+return {stamp="8675:1171948:65024:1792361468",value={"require","object","require","smarkmisc","require","lfsu"},path="/root/repo/smark/source.lua"}
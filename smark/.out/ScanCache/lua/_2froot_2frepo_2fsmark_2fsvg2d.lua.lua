@@ -0,0 +1 @@
+return {value={"require","html2d","require","doctree","require","opairs"},path="/root/repo/smark/svg2d.lua",stamp="19303:1175495:65024:1792375008"}
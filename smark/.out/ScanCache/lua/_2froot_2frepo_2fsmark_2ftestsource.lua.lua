@@ -0,0 +1 @@
+return {stamp="750:1171950:65024:1792361468",value={"require","qtest","require","source"},path="/root/repo/smark/testsource.lua"}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","html2d"},path="html2d_q.lua",stamp="9976:1171919:65024:1792361468"}
@@ -0,0 +1 @@
+return {stamp="14329:1171922:65024:1792361468",path="markup_q.lua",value={"require","qtest","require","doctree","require","utf8utils","require","source","require","testsource","require","markup"}}
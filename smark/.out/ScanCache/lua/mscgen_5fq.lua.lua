@@ -0,0 +1 @@
+return {stamp="4564:1171924:65024:1792361468",value={"require","html2d","require","qtest","require","mscgen"},path="mscgen_q.lua"}
@@ -0,0 +1 @@
+return {value={"require","qtest","require","smark_art"},path="smark_art_q.lua",stamp="19950:1171929:65024:1792371858"}
@@ -0,0 +1 @@
+return {stamp="544:1171934:65024:1792361468",value={"require","qtest","require","markup","require","smark_include","require","testsource"},path="smark_include_q.lua"}
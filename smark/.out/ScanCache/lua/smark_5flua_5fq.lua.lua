@@ -0,0 +1 @@
+return {value={"require","qtest","require","smark_lua","require","testsource"},stamp="615:1171936:65024:1792361468",path="smark_lua_q.lua"}
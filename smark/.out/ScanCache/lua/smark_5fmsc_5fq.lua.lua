@@ -0,0 +1 @@
+return {stamp="1601:1171938:65024:1792361468",value={"require","qtest","require","markup","require","source","require","testsource","require","smark_msc"},path="smark_msc_q.lua"}
@@ -0,0 +1 @@
+return {path="smark_q.lua",value={"require","qtest","require","xpfs","require","lfsu","require","testexe","require","getopts","require","smarkcache","require","lpeg","require","cachemod"},stamp="7256:1172767:65024:1792373749"}
@@ -0,0 +1 @@
+return {path="smark_table_q.lua",value={"require","qtest","require","doctree","require","source","require","smark_table"},stamp="2711:1171942:65024:1792361468"}
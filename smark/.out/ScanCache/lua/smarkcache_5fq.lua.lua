@@ -0,0 +1 @@
+return {value={"require","qtest","require","smarkcache","require","lfsu"},path="smarkcache_q.lua",stamp="2034:1172770:65024:1792362620"}
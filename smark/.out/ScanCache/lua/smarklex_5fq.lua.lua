@@ -0,0 +1 @@
+return {stamp="2786:1172884:65024:1792375082",value={"require","qtest","require","lpeg","require","smarklex","require","codestyle","require","smark_luacode","require","smark_ccode"},path="smarklex_q.lua"}
@@ -0,0 +1 @@
+return {path="smarkmisc_q.lua",stamp="1658:1171947:65024:1792361468",value={"require","qtest","require","smarkmisc","require","doctree"}}
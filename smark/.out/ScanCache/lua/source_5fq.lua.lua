@@ -0,0 +1 @@
+return {stamp="1248:1171949:65024:1792361468",value={"require","qtest","require","source"},path="source_q.lua"}
@@ -0,0 +1 @@
+return {stamp="6251:1175496:65024:1792375021",path="svg2d_q.lua",value={"require","qtest","require","html2d","require","smark_art","require","mscgen","require","htmlgen","require","svg2d"}}
@@ -149,6 +149,26 @@ a[href]:hover {
    -moz-border-radius: 0.6em;
 }
 
+/* ASCII Art and Sequence Charts rendered as SVG (config.graphics = "svg") */
+
+.art .ds {
+   stroke: #543;
+}
+.art .df {
+   fill: #543;
+}
+.art .dline.ds, .art .drect.ds {
+   stroke-dasharray: 0 2px;
+   stroke-linecap: round;
+}
+.art rect.rect, .art path.rect {
+   fill: #f9faf4;
+   filter: drop-shadow(0.2em 0.2em 0.1em #875);
+}
+.art rect.nofx, .art path.nofx {
+   fill: #f9faf4;
+}
+
 /* .art .line {  -webkit-box-shadow: 0.1em 0.1em 0.2em rgba(0,0,0,0.3); } */
 
 /* Sequence Charts */
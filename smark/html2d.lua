@@ -394,6 +394,29 @@ function GC:emitHTML(...)
 end
 
 
+-- Begin a group of drawing operations that are rotated `deg` degrees
+-- clockwise about (ox, oy), after scaling horizontally by `xscale` (if
+-- non-nil).  Each call must be matched by a call to endTransform().
+--
+function GC:beginTransform(deg, xscale, ox, oy)
+   local scaleStr = xscale and " scale("..xscale..",1)" or ""
+   local pfmt = '-webkit-transform:rotate(%ddeg)%s;'..
+                '-webkit-transform-origin:%fpx %fpx;'
+   local props = sprintf(pfmt, deg, scaleStr, ox, oy)
+
+   self:emitHTML('<div style="position:relative;%s%s%s">',
+                 props,
+                 props:gsub("webkit", "moz"),
+                 props:gsub("webkit", "ms"),
+                 props:gsub("webkit", "o"))
+end
+
+
+function GC:endTransform()
+   self:emitHTML("</div>")
+end
+
+
 -- Wedge: Fill a triangle with a vertical or horizontal edge.
 --
 --   x,y  = the 'tip' of the wedge
@@ -9,6 +9,7 @@ local utf8utils = require "utf8utils"
 local Object = require "object"
 local Source = require "source"
 local Html2D = require "html2d"
+local Svg2D = require "svg2d"
 local doctree = require "doctree"
 
 local insert = table.insert
@@ -905,7 +906,8 @@ local function expand(node, doc)
       local exp = node.text  -- result of expansion
 
       if node.render2D then
-         local gc = Html2D:new()
+         local GC = doc.config.graphics == "svg" and Svg2D or Html2D
+         local gc = GC:new()
          local succ, r = pcall(node.render2D, node, gc)
          if succ then
             exp = gc:genTree()
@@ -997,6 +999,9 @@ local function expandDoc(tree, configEnv)
 
    tree[TYPE] = "div"
    tree.class = "smarkdoc"
+   -- Macros set doc.uncacheable when their output depends on something
+   -- other than the document source (see smarkcache.lua).
+   tree._uncacheable = doc.uncacheable
    return tree
 end
 
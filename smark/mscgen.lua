@@ -312,27 +312,18 @@ local function beginRot(gc, gradient, skip, dy, src, dst, dx, path)
       local rad = math.atan(offset / ((dst-src)*dx))
       local scale = round(1/math.cos(rad), 1000)
 
-      local scaleStr = ""
+      local xscale
       if math.abs((scale-1) * (b[1]-a[1])) >= 1.5 then
-         scaleStr = " scale("..scale..",1)"
+         xscale = scale
       end
-      local pfmt = '-webkit-transform:rotate(%ddeg)%s;'..
-                   '-webkit-transform-origin:%fpx %fpx;'
-      local props = string.format(pfmt, round(math.deg(rad), 100),
-                                  scaleStr, a[1], a[2])
-
-      gc:emitHTML('<div style="position:relative;%s%s%s">',
-                  props,
-                  props:gsub("webkit", "moz"),
-                  props:gsub("webkit", "ms"),
-                  props:gsub("webkit", "o"))
+      gc:beginTransform(round(math.deg(rad), 100), xscale, a[1], a[2])
       return gc
    end
 end
 
 
 local function endRot(gc)
-   if gc then gc:emitHTML("</div>") end
+   if gc then gc:endTransform() end
 end
 
 
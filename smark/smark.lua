@@ -8,7 +8,9 @@ local htmlgen = require "htmlgen"
 local defaultCSS = require "defaultcss"
 local doctree = require "doctree"
 local smarkmisc = require "smarkmisc"
+local serialize = require "serialize"
 local Source = require "source"
+local smarkcache = require "smarkcache"
 
 -- @require smarkmacros  (for dependency scanning)
 
@@ -44,6 +46,36 @@ local function openForWrite(fileName)
 end
 
 
+-- Write HTML and (optionally) dependency file.  `files` lists all files
+-- read, beginning with the main input file.
+--
+local function writeOutputs(opts, html, files)
+   -- output HTML
+   local fo = opts.out and io.stdout or openForWrite(opts.o)
+   fo:write(html)
+   fo:close()
+
+   -- output dependencies
+   if opts.deps then
+      local fd = openForWrite(opts.deps)
+      if files[1] then
+         -- omit the initial file (not an implicit dependency)
+         local deps = table.concat(files, " ", 2)
+         fd:write(opts.o .. ": " .. deps .. "\n\n")
+      end
+
+      -- add an empty rule for each file other than the main one
+      -- (a la 'gcc -M -MP')
+      for n = 2, #files do
+         fd:write(files[n] .. ":\n\n")
+      end
+      fd:close()
+   end
+
+   return 0
+end
+
+
 local usageStr = [=[
 Usage: smark [options] [<infile> -o <outfile>]
 
@@ -57,6 +89,9 @@ Options:
        Read input from stdin.
    --deps=<file>
        Output a makefile that lists dependencies for the output file.
+   --cache=<dir>
+       Re-use output from a previous run when the input files, plugins,
+       and options have not changed.  Cache entries are stored in <dir>.
    --css=<file>
        Incorporate CSS style sheet into generated document.
    --no-default-css
@@ -80,6 +115,7 @@ local optionSpec = {
    "-v/--version",
    "--config=",
    "--deps=",
+   "--cache=",
    "--in",
    "--out",
    "--error"
@@ -124,6 +160,27 @@ local function main()
    setPath()
 
    local data = opts["in"] and io.read("*a")
+
+   -- The cache key describes everything other than file contents that
+   -- affects the output.
+   local codeHash = opts.cache and smarkcache.hashCode()
+   local cacheKey = codeHash and smarkcache.hash(table.concat({
+         codeHash,
+         serialize.serialize(opts, nil, "s"),
+         os.getenv("SMARK_PATH") or "",
+         data or "",
+      }, "\0"))
+
+   local entry = cacheKey and smarkcache.lookup(opts.cache, opts.o or "-", cacheKey)
+   if entry then
+      return writeOutputs(opts, entry.html, entry.files)
+   end
+
+   local modulesBefore = {}
+   for name in pairs(package.loaded) do
+      modulesBefore[name] = true
+   end
+
    local source = Source:new():newFile(names[1], data)
    local doctree = markup.parseDoc(source)
    doctree = markup.expandDoc( doctree, configEnv )
@@ -150,29 +207,33 @@ local function main()
 
    local html = htmlgen.generateDoc(doctree)
 
-   -- output HTML
-   local fo = opts.out and io.stdout or openForWrite(opts.o)
-   fo:write(html)
-   fo:close()
-
-   -- output dependencies
-   if opts.deps then
-      local fd = openForWrite(opts.deps)
-      if source.files[1] then
-         -- omit the initial file (not an implicit dependency)
-         local deps = table.concat(source.files, " ", 2)
-         fd:write(opts.o .. ": " .. deps .. "\n\n")
+   -- Warnings are not cached (they would not be displayed on later runs).
+   if cacheKey and not source.didWarn and not doctree._uncacheable then
+      -- Inputs include the config file and plugins loaded from files.
+      local inputs = { opts.config }
+      for name in pairs(package.loaded) do
+         local path = not modulesBefore[name] and smarkcache.modulePath(name)
+         if path then
+            table.insert(inputs, path)
+         end
+      end
+      table.sort(inputs)
+      for _, name in ipairs(source.files) do
+         table.insert(inputs, name)
       end
 
-      -- add an empty rule for each file other than the main one
-      -- (a la 'gcc -M -MP')
-      for n = 2, #source.files do
-         fd:write(source.files[n] .. ":\n\n")
+      local deps = smarkcache.hashFiles(inputs)
+      if deps then
+         smarkcache.store(opts.cache, opts.o or "-", {
+               key = cacheKey,
+               deps = deps,
+               files = source.files,
+               html = html,
+            })
       end
-      fd:close()
    end
 
-   return 0
+   return writeOutputs(opts, html, source.files)
 end
 
 --------------------------------
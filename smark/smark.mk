@@ -8,8 +8,10 @@ _SmarkDoc.outExt     = .html
 _SmarkDoc.command    = {exportPrefix} {smarkExe} -o {@} {flags} -- {^}
 _SmarkDoc.css        =
 _SmarkDoc.depsMF     = {outBasis}.d
-_SmarkDoc.flags      = $(patsubst %,--no-default-css --css='%',{css}) {warnFlags} --deps={depsMF}
+_SmarkDoc.flags      = $(patsubst %,--no-default-css --css='%',{css}) {warnFlags} --deps={depsMF} {cacheFlags}
 _SmarkDoc.warnFlags  = --error
+# e.g. `--cache=.out/smarkcache` to re-use output when inputs are unchanged
+_SmarkDoc.cacheFlags =
 _SmarkDoc.smarkExe  := $(dir $(lastword $(MAKEFILE_LIST)))smark
 _SmarkDoc.up         = {smarkExe}
 _SmarkDoc.exports    = SMARK_PATH
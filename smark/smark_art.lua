@@ -301,6 +301,7 @@ local function getPaths(hl, vl)
    -- This tracks the paths touching each (x,y) connecting point
    local xyToPath = AutoTable()
    local pathSeen = {}  -- path -> true
+   local pathList = {}  -- paths in order of creation (some since merged)
 
    -- Merge a new path with any existing path connecting with (x,y), or make
    -- this path the new path for (x,y)
@@ -369,6 +370,7 @@ local function getPaths(hl, vl)
       -- two lines that meet perfectly but need to exist as separate paths.
 
       pathSeen[p] = true
+      pathList[#pathList+1] = p
       if cl then p = mergePaths(p, x1, y1) end     -- connects to left/top
       if cr then mergePaths(p, x2, y2) end         -- connects to right/bottom
    end
@@ -382,8 +384,10 @@ local function getPaths(hl, vl)
    end
 
    local paths = {}
-   for p in opairs(pathSeen) do
-      paths[#paths+1] = p
+   for _, p in ipairs(pathList) do
+      if pathSeen[p] then
+         paths[#paths+1] = p
+      end
    end
    return paths
 end
@@ -682,6 +686,174 @@ local function shapeCrosses(a,b)
 end
 
 
+-- Bounding boxes of shapes and layers are computed on demand and cached.
+-- A shape's box is { px1, py1, px2, py2, rx1, ry1, rx2, ry2 }, where px/py
+-- bound the points of the path used by shapeCrosses() and rx/ry bound its
+-- rects.  A layer's box is the union of its shapes' boxes.  Shapes are not
+-- modified once created, nor are layers once addShape() returns, so cached
+-- boxes remain valid.
+--
+-- Crossing paths and containing shapes must have overlapping boxes, so
+-- boxes let us skip most of the pairwise tests in addShape() and
+-- isCovered() in large diagrams.
+--
+local boxes = setmetatable({}, {__mode = "k"})
+
+local function shapeBox(s)
+   local b = boxes[s]
+   if not b then
+      local huge = math.huge
+      b = { huge, huge, -huge, -huge, huge, huge, -huge, -huge }
+      for _, p in ipairs(s.origPath or s.path) do
+         local x, y = p[1], p[2]
+         if x < b[1] then b[1] = x end
+         if y < b[2] then b[2] = y end
+         if x > b[3] then b[3] = x end
+         if y > b[4] then b[4] = y end
+      end
+      for _, r in ipairs(s.rects) do
+         local x, y = r[1], r[2]
+         local x2, y2 = x + r[3], y + r[4]
+         if x < b[5] then b[5] = x end
+         if y < b[6] then b[6] = y end
+         if x2 > b[7] then b[7] = x2 end
+         if y2 > b[8] then b[8] = y2 end
+      end
+      boxes[s] = b
+   end
+   return b
+end
+
+local function layerBox(layer)
+   local b = boxes[layer]
+   if not b then
+      local huge = math.huge
+      b = { huge, huge, -huge, -huge, huge, huge, -huge, -huge }
+      for _, s in ipairs(layer) do
+         local sb = shapeBox(s)
+         for n = 1, 8 do
+            b[n] = (n-1) % 4 < 2 and math.min(b[n], sb[n]) or math.max(b[n], sb[n])
+         end
+      end
+      boxes[layer] = b
+   end
+   return b
+end
+
+-- Return true if the path boxes of a and b overlap.
+--
+local function pathBoxesMeet(a, b)
+   return a[1] <= b[3] and b[1] <= a[3] and a[2] <= b[4] and b[2] <= a[4]
+end
+
+-- Return true if the rects box of a encloses the rects box of b.  This is
+-- a precondition for shapeContains(A, B).
+--
+local function rectBoxEncloses(a, b)
+   return a[5] <= b[5] and a[6] <= b[6] and b[7] <= a[7] and b[8] <= a[8]
+end
+
+
+-- Each array of layers built by addShape() is indexed by a uniform grid of
+-- square cells, `gridSize` units wide.  Each layer is entered in all cells
+-- that its box touches, so layers that can cross, contain, or be contained
+-- by a shape can be found by visiting the cells its box touches.
+--
+-- Layers are added at the front of the array, so layers[] is ordered by
+-- descending `grid.seq` values.
+--
+-- A layer whose first shape has no rects is "contained" by every shape, so
+-- it is kept in `grid.always` instead of in cells.
+--
+local gridSize = 64
+local grids = setmetatable({}, {__mode = "k"})   -- layers -> grid
+
+local function gridCells(grid, layer, fn)
+   local b = layerBox(layer)
+   local floor = math.floor
+   for cx = floor(math.min(b[1], b[5]) / gridSize), floor(math.max(b[3], b[7]) / gridSize) do
+      local col = grid.cells[cx]
+      if not col then
+         col = {}
+         grid.cells[cx] = col
+      end
+      for cy = floor(math.min(b[2], b[6]) / gridSize), floor(math.max(b[4], b[8]) / gridSize) do
+         col[cy] = fn(col[cy])
+      end
+   end
+end
+
+local function gridAdd(grid, layer)
+   grid.count = grid.count + 1
+   grid.seq[layer] = grid.count
+   if #layer[1].rects == 0 then
+      grid.always[layer] = true
+   else
+      gridCells(grid, layer, function (cell)
+         cell = cell or {}
+         cell[layer] = true
+         return cell
+      end)
+   end
+end
+
+local function gridRemove(grid, layer)
+   grid.seq[layer] = nil
+   if grid.always[layer] then
+      grid.always[layer] = nil
+   else
+      gridCells(grid, layer, function (cell)
+         cell[layer] = nil
+         return cell
+      end)
+   end
+end
+
+local function getGrid(layers)
+   local grid = grids[layers]
+   if not grid then
+      grid = { cells = {}, seq = {}, always = {}, count = 0 }
+      for n = #layers, 1, -1 do
+         gridAdd(grid, layers[n])
+      end
+      grids[layers] = grid
+   end
+   return grid
+end
+
+-- Return the layers that might interact with shape, in the order they
+-- appear in layers[].
+--
+local function gridFind(grid, layers, shape)
+   if #shape.rects == 0 then
+      return layers
+   end
+
+   local b = shapeBox(shape)
+   local floor = math.floor
+   local found = {}
+   for l in pairs(grid.always) do
+      found[l] = true
+   end
+   for cx = floor(math.min(b[1], b[5]) / gridSize), floor(math.max(b[3], b[7]) / gridSize) do
+      local col = grid.cells[cx]
+      for cy = floor(math.min(b[2], b[6]) / gridSize), floor(math.max(b[4], b[8]) / gridSize) do
+         for l in pairs(col and col[cy] or {}) do
+            found[l] = true
+         end
+      end
+   end
+
+   local seq = grid.seq
+   local list = {}
+   for l in pairs(found) do
+      list[#list+1] = l
+   end
+   table.sort(list, function (a, b) return seq[a] > seq[b] end)
+   return list
+end
+
+
 -- Add shape to layers[].  Shapes that intersect other shapes must occupy
 -- the same layer.
 --
@@ -706,21 +878,27 @@ local function addShape(layers, shape, overs)
    end
 
 
+   local grid = getGrid(layers)
+   local sb = shapeBox(shape)
+
    -- look for crossed (intersecting) shapes
-   for _, ll in ipairs(layers) do
+   for _, ll in ipairs(gridFind(grid, layers, shape)) do
       local merged = false
-      for _, ss in ipairs(ll) do
-         if shapeCrosses(shape, ss) then
-            merged = true
-            mergeLayer(ll)
-            break
+      if pathBoxesMeet(sb, layerBox(ll)) then
+         for _, ss in ipairs(ll) do
+            if pathBoxesMeet(sb, shapeBox(ss)) and shapeCrosses(shape, ss) then
+               merged = true
+               mergeLayer(ll)
+               break
+            end
          end
       end
       if not merged then
-         if shapeContains(ll[1], shape) then
+         local lb = shapeBox(ll[1])
+         if rectBoxEncloses(lb, sb) and shapeContains(ll[1], shape) then
             ll.overs = ll.overs or {}
             table.insert(ll.overs, layer)
-         elseif shapeContains(shape, ll[1]) then
+         elseif rectBoxEncloses(sb, lb) and shapeContains(shape, ll[1]) then
             table.insert(layer.overs, ll)
          end
       end
@@ -728,20 +906,27 @@ local function addShape(layers, shape, overs)
 
    if bConflict then return false end
 
-   -- purge any removed layers, and fix references left in overs
    table.insert(layers, 1, layer)
-   local nOut = 1
-   for nIn = 1, #layers do
-      local ll = layers[nIn]
-      layers[nIn] = nil
-      if not oldToNew[ll] then
-         layers[nOut] = ll
-         nOut = nOut+1
-         for ndx = 1, ll.overs and #ll.overs or 0 do
-            ll.overs[ndx] = oldToNew[ll.overs[ndx]] or ll.overs[ndx]
+
+   if next(oldToNew) then
+      -- purge any removed layers, and fix references left in overs
+      local nOut = 1
+      for nIn = 1, #layers do
+         local ll = layers[nIn]
+         layers[nIn] = nil
+         if not oldToNew[ll] then
+            layers[nOut] = ll
+            nOut = nOut+1
+            for ndx = 1, ll.overs and #ll.overs or 0 do
+               ll.overs[ndx] = oldToNew[ll.overs[ndx]] or ll.overs[ndx]
+            end
          end
       end
+      for ll in pairs(oldToNew) do
+         gridRemove(grid, ll)
+      end
    end
+   gridAdd(grid, layer)
 
    return true
 end
@@ -835,59 +1020,72 @@ end
 -- Returns true if line from a to b is covered by other layers of shapes.
 -- Adds all covering layers to overs[]
 --
-local function isCovered(a, b, layers, overs, cwid, chgt)
+-- `sorted`, if given, is the result of sortLayers(layers).
+--
+local function isCovered(a, b, layers, overs, cwid, chgt, sorted)
    local dir = (a[1] == b[1]) and 2 or 1
    local runs = { { minmax(a[dir], b[dir]) } }
    local axis = a[3-dir]
 
-   for _,layer in ipairs(sortLayers(layers)) do
-      local layerIsOver = false
-      for _,s in ipairs(layer) do
-         for _,r in ipairs(s.rects) do
-            local x, y, w, h = unpack(r)
-            local x2, y2 = x+w+cwid, y+h+chgt
-            x = x - cwid
-            y = y - chgt
-
-            if dir == 2 then
-               x, y, x2, y2 = y, x, y2, x2
-            end
+   -- Layers whose rects do not touch the line can be skipped.  Along the
+   -- line this holds only for a non-empty run: any rect on the axis will
+   -- remove a zero-length run.
+   local lo, hi = runs[1][1], runs[1][2]
+   local pad = { cwid, chgt }
+   local perp = 3 - dir
+
+   for _,layer in ipairs(sorted or sortLayers(layers)) do
+      local lb = layerBox(layer)
+      if lb[4+perp] - pad[perp] <= axis and axis <= lb[6+perp] + pad[perp] and
+         (lo == hi or lb[4+dir] - pad[dir] <= hi and lo <= lb[6+dir] + pad[dir]) then
+         local layerIsOver = false
+         for _,s in ipairs(layer) do
+            for _,r in ipairs(s.rects) do
+               local x, y, w, h = unpack(r)
+               local x2, y2 = x+w+cwid, y+h+chgt
+               x = x - cwid
+               y = y - chgt
+
+               if dir == 2 then
+                  x, y, x2, y2 = y, x, y2, x2
+               end
 
-            if y <= axis and axis <= y2 then
-               local n = 1
-               while runs[n] do
-                  local r = runs[n]
-                  local a,b,c,d
-                  a,b = r[1], math.min(r[2],x)      -- get what's left of range
-                  c,d = math.max(x2, r[1]), r[2]    -- get what's right of the range
-
-                  if a >= b and c >= d then
-                     -- nothing left
-                     table.remove(runs, n)
-                     layerIsOver = true
-                  elseif a < b and c < d then
-                     -- two runs
-                     runs[n] = {c,d}
-                     table.insert(runs, n, {a,b})
-                     layerIsOver = true
-                  else
-                     -- one run
-                     if c<d then a,b = c,d end
-                     if a~=r[1] or b~=r[2] then
+               if y <= axis and axis <= y2 then
+                  local n = 1
+                  while runs[n] do
+                     local r = runs[n]
+                     local a,b,c,d
+                     a,b = r[1], math.min(r[2],x)      -- get what's left of range
+                     c,d = math.max(x2, r[1]), r[2]    -- get what's right of the range
+
+                     if a >= b and c >= d then
+                        -- nothing left
+                        table.remove(runs, n)
                         layerIsOver = true
-                        r[1] = a
-                        r[2] = b
+                     elseif a < b and c < d then
+                        -- two runs
+                        runs[n] = {c,d}
+                        table.insert(runs, n, {a,b})
+                        layerIsOver = true
+                     else
+                        -- one run
+                        if c<d then a,b = c,d end
+                        if a~=r[1] or b~=r[2] then
+                           layerIsOver = true
+                           r[1] = a
+                           r[2] = b
+                        end
+                        n = n + 1
                      end
-                     n = n + 1
                   end
                end
             end
          end
+         if layerIsOver then
+            table.insert(overs, layer)
+         end
+         if #runs == 0 then return true end
       end
-      if layerIsOver then
-         table.insert(overs, layer)
-      end
-      if #runs == 0 then return true end
    end
    return false
 end
@@ -904,7 +1102,7 @@ end
 --      part under adjacent character cells).
 --   4. The resulting path *with inferred portion* must not cross itself.
 --
-local function inferShape(path, layers, cw, ch)
+local function inferShape(path, layers, cw, ch, sorted)
    if path.loop then return end
    if #path < 3 then return end
 
@@ -950,8 +1148,8 @@ local function inferShape(path, layers, cw, ch)
    end
 
    local overs = {}
-   if not isCovered(a, {x,y}, layers, overs, cw, ch) or
-      not isCovered(b, {x,y}, layers, overs, cw, ch) then
+   if not isCovered(a, {x,y}, layers, overs, cw, ch, sorted) or
+      not isCovered(b, {x,y}, layers, overs, cw, ch, sorted) then
       return  -- inferred edge portions are not covered
    end
 
@@ -984,11 +1182,16 @@ local function inferShapes(layers, paths, cw, ch)
    local found
    repeat
       found = false
+      local sorted = sortLayers(layers)
       for n = #paths, 1, -1 do
-         local shape, overs = inferShape(paths[n], layers, cw, ch)
-         if shape and addShape(layers, shape, overs) then
-            found = true
-            table.remove(paths, n)
+         local shape, overs = inferShape(paths[n], layers, cw, ch, sorted)
+         if shape then
+            if addShape(layers, shape, overs) then
+               found = true
+               table.remove(paths, n)
+            end
+            -- addShape() can modify `overs` even when it fails
+            sorted = sortLayers(layers)
          end
       end
    until found == false
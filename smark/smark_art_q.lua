@@ -742,4 +742,64 @@ function qt.tests.infer()
 end
 
 
+-- Layers are found through a grid index in larger diagrams.  Shapes far
+-- apart, and shapes that span many grid cells, must be grouped the same
+-- way as shapes in small diagrams.
+--
+function qt.tests.layerIndex()
+   local getShapes, getLayers = _art.getShapes, _art.getLayers
+
+   local function box(x, y, w, h, pic)
+      local line = {}
+      for n = 1, #pic do line[n] = pic[n] end
+      for row = y, y+h-1 do
+         local top, bot = row == y, row == y+h-1
+         for col = x, x+w-1 do
+            local side = col == x or col == x+w-1
+            local ch = (top or bot) and (side and "+" or "-") or (side and "|")
+            local old = line[row]:sub(col, col)
+            if ch and old ~= " " and old ~= ch then
+               ch = "+"   -- crossing
+            end
+            if ch then
+               line[row] = line[row]:sub(1, col-1) .. ch .. line[row]:sub(col+1)
+            end
+         end
+      end
+      return line
+   end
+
+   local pic = {}
+   for row = 1, 12 do pic[row] = (" "):rep(200) end
+   pic = box(1, 1, 200, 12, pic)      -- A: contains the others
+   pic = box(5, 3, 10, 4, pic)        -- B
+   pic = box(60, 3, 10, 5, pic)       -- C & D cross at x=64
+   pic = box(65, 5, 10, 5, pic)
+   pic = box(180, 3, 10, 4, pic)      -- E
+
+   local txt = table.concat(pic, "\n") .. "\n"
+   local paths = gp(txt)
+   eq(5, #paths)
+
+   -- paths are returned in a deterministic order
+   local function starts(paths)
+      return imap(paths, function (p) return {p[1][1], p[1][2]} end)
+   end
+   for _ = 1, 4 do
+      eq(starts(paths), starts(gp(txt)))
+   end
+
+   local ss = getShapes(paths)
+   eq(5, #ss)
+   local ll = getLayers(ss)
+   eq(4, #ll)
+   local A, B, CD, E = xsl(ll)
+   eq(2, #CD)
+   eq(3, #A.overs)
+   eq(nil, B.overs[1])
+   eq(nil, CD.overs[1])
+   eq(nil, E.overs[1])
+end
+
+
 return qt.runTests()
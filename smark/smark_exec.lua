@@ -1,6 +1,8 @@
 -- simple smark macro implementation
 
-return function (node)
+return function (node, doc)
+   -- output depends on the environment, so do not cache the document
+   doc.uncacheable = true
    local f = assert(io.popen(node.text, "r"))
    local txt = assert(f:read"*a")
    f:close()
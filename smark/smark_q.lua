@@ -28,6 +28,7 @@ local xpfs = require "xpfs"
 local fu = require "lfsu"
 local TE = require "testexe"
 local getopts = require "getopts"
+local smarkcache = require "smarkcache"
 
 local eq, match = qt.eq, qt.match
 
@@ -176,6 +177,62 @@ function qt.tests.deps()
 end
 
 
+function qt.tests.cache()
+   local files = {
+      ["a.txt"] = 'before\n\n.include: b.txt\n\nafter',
+      ["b.txt"] = 'hello',
+      ["c.txt"] = '.exec: echo hi',
+   }
+   initFS(files)
+   smark "a.txt -o a.html --deps=a.d --cache=cache"
+   match((fu.read("a.html")), "hello")
+   local html, deps = fu.read("a.html"), fu.read("a.d")
+
+   -- Alter the cached output, so we can tell when it is used.
+   local entryName = "cache/" .. smarkcache.hash("a.html") .. ".lua"
+   local entry = assert(fu.read(entryName))
+   assert(fu.write(entryName, (entry:gsub("hello", "CACHED"))))
+
+   -- unchanged inputs => cache hit (including deps file)
+   os.remove("a.d")
+   smark "a.txt -o a.html --deps=a.d --cache=cache"
+   match((fu.read("a.html")), "CACHED")
+   eq(deps, fu.read("a.d"))
+
+   -- rewritten with same contents => cache hit
+   assert(fu.write("b.txt", "hello"))
+   smark "a.txt -o a.html --deps=a.d --cache=cache"
+   match((fu.read("a.html")), "CACHED")
+
+   -- different options => miss
+   smark "a.txt -o a.html --cache=cache"
+   eq(html, fu.read("a.html"))
+
+   -- included file changed => miss
+   assert(fu.write(entryName, (entry:gsub("hello", "CACHED"))))
+   assert(fu.write("b.txt", "goodbye"))
+   smark "a.txt -o a.html --deps=a.d --cache=cache"
+   match((fu.read("a.html")), "goodbye")
+
+   -- documents using ".exec" are not cached
+   smark "c.txt -o c.html --cache=cache"
+   eq(nil, (fu.read("cache/" .. smarkcache.hash("c.html") .. ".lua")))
+
+   -- the key covers the code of loaded modules
+   local savePath = package.path
+   package.path = "./?.lua;" .. package.path
+   assert(fu.write("cachemod.lua", "return 1"))
+   local h1 = smarkcache.hashCode()
+   require "cachemod"
+   local h2 = smarkcache.hashCode()
+   assert(fu.write("cachemod.lua", "return 22"))
+   local h3 = smarkcache.hashCode()
+   package.loaded.cachemod = nil
+   package.path = savePath
+   qt.assert(h1 and h1 ~= h2 and h2 ~= h3)
+end
+
+
 function qt.tests.error()
    -- >> With `--error`, warnings should result in non-zero status code.
 
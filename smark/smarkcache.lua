@@ -0,0 +1,191 @@
+-- smarkcache: cache of generated documents, keyed by content hashes
+--
+-- An entry records the output of a previous run of smark, the files it
+-- read, and a hash of the contents of each of those files.  An entry is
+-- valid when its key (which describes the command-line options and smark
+-- code) matches and every file still has the recorded contents.
+-- Timestamps of input files are not consulted, so entries survive
+-- operations like `git checkout` that rewrite files without changing them.
+--
+-- Entries are stored in files named <dir>/<hash of output name>.lua.
+--
+-- API:
+--
+--   smarkcache.hash(str) -> string
+--
+--      Return a 16-digit hex string derived from the contents of `str`.
+--
+--   smarkcache.hashFiles(names) -> deps
+--
+--      Read each file named in `names` and return an array of {name, hash}
+--      pairs.  Return nil if any file cannot be read.
+--
+--   smarkcache.hashCode() -> string | nil
+--
+--      Return a hash identifying the code of the running program: the
+--      sources of the modules it has loaded and of its main script, or,
+--      when modules are bundled in the executable, the executable itself.
+--      Code files are identified by name, size, inode, and modification
+--      time, not contents, since hashing them would take longer than
+--      most documents take to generate.  Return nil if a file cannot be
+--      found.
+--
+--   smarkcache.lookup(dir, outName, key) -> entry | nil
+--
+--      Find a valid entry for output file `outName`.
+--
+--   smarkcache.store(dir, outName, entry) -> true | nil, err
+--
+--      Write an entry.  `entry` is a table containing:
+--
+--        key   = string describing options, etc.
+--        deps  = result of `hashFiles`
+--        files = array of file names for the dependency list (see `--deps`)
+--        html  = generated output
+--
+
+local serialize = require "serialize"
+local lfsu = require "lfsu"
+local xpfs = require "xpfs"
+local smarkmisc = require "smarkmisc"
+
+local byte = string.byte
+
+
+-- Multiply two 32-bit values, modulo 2^32, without losing precision in a
+-- double.
+--
+local function mul32(a, b)
+   local bl = b % 65536
+   local bh = (b - bl) / 65536
+   return (a * bl + (a * bh % 65536) * 65536) % 4294967296
+end
+
+
+-- Two independent FNV-1a-style lanes, consuming 24 bits per step.
+--
+local function hash(str)
+   local a, b = 2166136261, 3339675911
+   for ndx = 1, #str, 3 do
+      local c1, c2, c3 = byte(str, ndx, ndx+2)
+      local w = c1 + (c2 or 0) * 256 + (c3 or 0) * 65536
+      a = mul32(bit32.bxor(a, w), 16777619)
+      b = mul32(bit32.bxor(b, w), 2654435761)
+   end
+   a = mul32(bit32.bxor(a, #str % 4294967296), 16777619)
+   return ("%08x%08x"):format(a, b)
+end
+
+
+local function hashFiles(names)
+   local deps = {}
+   for ndx, name in ipairs(names) do
+      local data = smarkmisc.readFile(name)
+      if not data then
+         return nil
+      end
+      deps[ndx] = { name, hash(data) }
+   end
+   return deps
+end
+
+
+-- Find the file a module was loaded from, or nil for modules bundled in
+-- the executable (or otherwise not on disk).
+--
+local function modulePath(name)
+   if not package.preload[name] then
+      return package.searchpath(name, package.path)
+         or package.searchpath(name, package.cpath)
+   end
+end
+
+
+local function hashCode()
+   local names = {}
+   local bundled = false
+   for name, value in pairs(package.loaded) do
+      -- skip the standard libraries (they are part of the interpreter)
+      if rawget(_G, name) ~= value then
+         local path = modulePath(name)
+         if path then
+            names[#names+1] = path
+         else
+            bundled = true
+         end
+      end
+   end
+   if bundled then
+      names = { xpfs.stat("/proc/self/exe", "k") and "/proc/self/exe"
+                   or arg and arg[0] }
+   elseif arg and arg[0] then
+      -- the main script (found via package.path after a chdir)
+      local script = arg[0]
+      names[#names+1] = xpfs.stat(script, "k") and script
+         or package.searchpath((script:gsub("%.lua$", "")), package.path)
+   end
+   table.sort(names)
+
+   local ids = {}
+   for ndx, name in ipairs(names) do
+      local st = xpfs.stat(name, "sim")
+      if not st then
+         return nil
+      end
+      ids[ndx] = { name, st.size, st.inode, st.mtime }
+   end
+   return hash(serialize.serialize(ids))
+end
+
+
+local function entryName(dir, outName)
+   return dir .. "/" .. hash(outName) .. ".lua"
+end
+
+
+local function lookup(dir, outName, key)
+   local f = loadfile(entryName(dir, outName), "t", {})
+   local succ, entry = pcall(f or error)
+   if not (succ and type(entry) == "table" and entry.key == key) then
+      return nil
+   end
+
+   for _, dep in ipairs(entry.deps) do
+      local data = smarkmisc.readFile(dep[1])
+      if not data or hash(data) ~= dep[2] then
+         return nil
+      end
+   end
+   return entry
+end
+
+
+local function store(dir, outName, entry)
+   local succ, err = lfsu.mkdir_p(dir)
+   if not succ then
+      return nil, err
+   end
+
+   -- write to a temporary file (unique to this process) and rename, so
+   -- readers never see a partially written entry
+   local name = entryName(dir, outName)
+   local tmpName = ("%s.%d.tmp"):format(name, xpfs.getpid())
+   succ, err = lfsu.write(tmpName, "return " .. serialize.serialize(entry) .. "\n")
+   if succ then
+      succ, err = os.rename(tmpName, name)
+   end
+   if not succ then
+      return nil, err
+   end
+   return true
+end
+
+
+return {
+   hash = hash,
+   hashFiles = hashFiles,
+   hashCode = hashCode,
+   modulePath = modulePath,
+   lookup = lookup,
+   store = store,
+}
@@ -0,0 +1,73 @@
+local qt = require "qtest"
+local smarkcache = require "smarkcache"
+local lfsu = require "lfsu"
+
+local eq = qt.eq
+
+local tmpdir = assert(os.getenv("OUTDIR")) .. "/smarkcache_q"
+
+
+function qt.tests.hash()
+   local hash = smarkcache.hash
+
+   qt.match(hash(""), "^%x+$")
+   eq(16, #hash("abc"))
+   eq(hash("abc"), hash("abc"))
+
+   -- distinct values for similar strings
+   local seen = {}
+   for _, s in ipairs{ "", "\0", "\0\0", "\0\0\0", "\0\0\0\0", "a", "b",
+                       "ab", "ba", "abc", "abcd", "abce", "bbcd" } do
+      local h = hash(s)
+      eq(nil, seen[h])
+      seen[h] = s
+   end
+end
+
+
+function qt.tests.lookup()
+   lfsu.rm_rf(tmpdir)
+   local cacheDir = tmpdir .. "/cache"
+   local fileA = tmpdir .. "/a.txt"
+
+   assert(lfsu.mkdir_p(tmpdir))
+   assert(lfsu.write(fileA, "A"))
+
+   local deps = smarkcache.hashFiles{ fileA }
+   eq(fileA, deps[1][1])
+   eq(nil, smarkcache.hashFiles{ fileA, tmpdir .. "/DOESNOTEXIST" })
+
+   local entry = { key = "k", deps = deps, files = {fileA}, html = "<p>" }
+
+   eq(nil, smarkcache.lookup(cacheDir, "a.html", "k"))
+   eq(true, smarkcache.store(cacheDir, "a.html", entry))
+   eq(entry, smarkcache.lookup(cacheDir, "a.html", "k"))
+
+   -- different key or output file
+   eq(nil, smarkcache.lookup(cacheDir, "a.html", "x"))
+   eq(nil, smarkcache.lookup(cacheDir, "b.html", "k"))
+
+   -- same contents => valid
+   assert(lfsu.write(fileA, "A"))
+   eq(entry, smarkcache.lookup(cacheDir, "a.html", "k"))
+
+   -- changed contents => invalid
+   assert(lfsu.write(fileA, "B"))
+   eq(nil, smarkcache.lookup(cacheDir, "a.html", "k"))
+
+   -- missing file => invalid
+   os.remove(fileA)
+   eq(nil, smarkcache.lookup(cacheDir, "a.html", "k"))
+
+   -- corrupt entry => invalid
+   assert(lfsu.write(fileA, "A"))
+   eq(entry, smarkcache.lookup(cacheDir, "a.html", "k"))
+   local entryFile = cacheDir .. "/" .. smarkcache.hash("a.html") .. ".lua"
+   assert(lfsu.write(entryFile, "return {key="))
+   eq(nil, smarkcache.lookup(cacheDir, "a.html", "k"))
+
+   lfsu.rm_rf(tmpdir)
+end
+
+
+return qt.runTests()
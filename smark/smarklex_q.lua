@@ -0,0 +1,106 @@
+-- Tests for smarklex (in smark-plugins) and the code plugins built on it
+
+local qt = require "qtest"
+local lpeg = require "lpeg"
+local smarklex = require "smarklex"
+local codestyle = require "codestyle"
+
+local eq = qt.eq
+
+local P, R, S = lpeg.P, lpeg.R, lpeg.S
+
+
+-- Build a small lexer.  When `allowEmpty` is true, a token pattern can
+-- match an empty string, so LPeg rejects a loop over all tokens and
+-- `tokenize` must use repeated matches.
+--
+local function newLexer(allowEmpty)
+   local define, compile = smarklex.buildLexer "test"
+   define("space", S" \n"^1)
+   define("word", R"az"^1)
+   define("number", R"09"^1)
+   define("error", 1)
+   if allowEmpty then
+      define("empty", P"-"^0)
+   end
+   return compile { ["if"] = "keyword", ["end"] = "keyword" }
+end
+
+
+local function collect(lexer, text)
+   local t = {}
+   for kind, str in lexer.gmatch(text) do
+      t[#t+1] = kind
+      t[#t+1] = str
+   end
+   return t
+end
+
+
+local sample = "if x1 +end"
+local sampleTokens = {
+   "keyword", "if", "space", " ", "word", "x", "number", "1", "space", " ",
+   "error", "+", "keyword", "end"
+}
+
+
+function qt.tests.gmatch()
+   eq(sampleTokens, collect(newLexer(), sample))
+   eq({}, collect(newLexer(), ""))
+
+   -- an empty match ends the iteration
+   eq(sampleTokens, collect(newLexer(true), sample))
+end
+
+
+function qt.tests.tokenize()
+   for _, allowEmpty in ipairs{false, true} do
+      local lexer = newLexer(allowEmpty)
+      eq(sampleTokens, lexer.tokenize(sample))
+      eq({}, lexer.tokenize(""))
+   end
+end
+
+
+function qt.tests.highlight()
+   local lexer = newLexer()
+   local style = codestyle.keyword
+
+   local pre = lexer.highlight(sample)
+   eq({ _type="pre", {_type="span", style=style, "if"}, " ", "x", "1", " ", "+",
+        {_type="span", style=style, "end"} },
+      pre)
+
+   -- results are remembered, but each call returns a new PRE element
+   local pre2 = lexer.highlight(sample)
+   eq(pre, pre2)
+   qt.assert(pre ~= pre2)
+   qt.assert(pre[1] == pre2[1])
+end
+
+
+-- The code plugins return a function that highlights the text of a node.
+
+function qt.tests.luacode()
+   local luacode = require "smark_luacode"
+   local pre = luacode({ text = "local s = [[a]] -- c\n" })
+   eq("pre", pre._type)
+   eq({_type="span", style=codestyle.keyword, "local"}, pre[1])
+   eq({_type="span", style=codestyle.string, "[[a]]"}, pre[7])
+   eq({_type="span", style=codestyle.comment, "-- c\n"}, pre[9])
+end
+
+
+function qt.tests.ccode()
+   local ccode = require "smark_ccode"
+   local pre = ccode({ text = 'int x = "s"; // c' })
+   local text = {}
+   for _, item in ipairs(pre) do
+      text[#text+1] = type(item) == "table" and item[1] or item
+   end
+   eq('int x = "s"; // c', table.concat(text))
+   eq({_type="span", style=codestyle.string, '"s"'}, pre[7])
+end
+
+
+return qt.runTests()
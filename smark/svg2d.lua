@@ -0,0 +1,650 @@
+-- svg2d: render 2D graphics into inline SVG
+--
+-- Svg2D implements the drawing interface of Html2D (see html2d.lua), but
+-- renders the canvas as a single <svg> element instead of emitting an
+-- absolutely positioned DIV for each line segment, corner, wedge, and text
+-- run.  The resulting HTML is much smaller and faster for browsers to lay
+-- out.
+--
+-- * Each path is drawn as one <path> element.  Collinear segments are
+--   merged and rounded corners are drawn as arcs.
+--
+-- * Style properties are not written on each element.  Instead, each
+--   distinct set of properties is given a class whose name is derived from
+--   the properties, so elements drawn alike share a class, and diagrams
+--   drawn alike share style rules.  genTree() emits each rule once per
+--   document, and all of them in one <style> element.
+--
+-- * Class names passed in `class` options are applied as in Html2D.
+--   Strokes drawn in the "default" color are given class "ds", and wedges
+--   class "df", so that style sheets can color them as they would color
+--   the borders of Html2D elements.  See svg2dStyle and defaultcss.lua.
+--
+-- Usage is the same as for Html2D:
+--
+--    local gc = Svg2D:new()
+--    ... set size, draw ...
+--    local tree = gc:genTree()
+--
+
+local Html2D = require "html2d"
+local doctree = require "doctree"
+local opairs = require "opairs"
+
+local E = doctree.E
+
+local sprintf = string.format
+
+
+-- Format a number compactly: at most two decimal places, and no trailing
+-- zeros.
+--
+local function num(n)
+   local s = sprintf("%.2f", n):gsub("%.?0+$", "")
+   return s == "-0" and "0" or s
+end
+
+
+-- Return a class name derived from a string of CSS declarations.  Names
+-- are memoized, since the same declarations recur in every diagram.  When
+-- two sets of declarations hash alike, the later one is given a suffix.
+--
+local classNames = {}    -- declarations -> name
+local classDecls = {}    -- name -> declarations
+
+local function className(decl)
+   local name = classNames[decl]
+   if not name then
+      local h = 5381
+      for ii = 1, #decl do
+         h = (h * 33 + decl:byte(ii)) % 4294967296
+      end
+      local base = sprintf("g%08x", h)
+      name = base
+      local n = 1
+      while classDecls[name] do
+         n = n + 1
+         name = base .. "-" .. n
+      end
+      classNames[decl] = name
+      classDecls[name] = decl
+   end
+   return name
+end
+
+
+local function joinClasses(...)
+   local t = {}
+   for n = 1, select("#", ...) do
+      local c = select(n, ...)
+      if c and c ~= "" then
+         t[#t+1] = c
+      end
+   end
+   return table.concat(t, " ")
+end
+
+
+----------------------------------------------------------------
+-- Props: a list of CSS property declarations
+----------------------------------------------------------------
+--
+-- Props supports the `f` method of html2d's CSS objects, so Html2D
+-- methods like iProp() accept it.
+
+local Props = {}
+Props.__index = Props
+
+local function newProps()
+   return setmetatable({}, Props)
+end
+
+function Props:f(...)
+   local prop = sprintf(...):gsub(";+$", "")
+   if prop ~= "" then
+      table.insert(self, prop)
+   end
+   return prop
+end
+
+
+-- Add properties for a line of width `lw` in color `color` and Html2D
+-- line style `style`.  Returns "ds" if the line is to be drawn in the
+-- default color.
+--
+local function strokeProps(props, color, style, lw)
+   props:f("stroke-width:%s", num(lw))
+   if style == "dotted" then
+      props:f("stroke-dasharray:0 %s;stroke-linecap:round", num(lw*2))
+   elseif style == "dashed" then
+      props:f("stroke-dasharray:%s %s;stroke-linecap:butt", num(lw*3), num(lw*2))
+   end
+   if color == nil or color == "default" then
+      return "ds"
+   end
+   props:f("stroke:%s", color)
+end
+
+
+----------------------------------------------------------------
+-- Path construction
+----------------------------------------------------------------
+
+-- Accumulate SVG path data, using H and V where possible.
+--
+local PathData = {}
+PathData.__index = PathData
+
+local function newPathData()
+   return setmetatable({}, PathData)
+end
+
+function PathData:moveTo(x, y)
+   table.insert(self, "M" .. num(x) .. " " .. num(y))
+   self.x, self.y = x, y
+end
+
+function PathData:lineTo(x, y)
+   if y == self.y and x ~= self.x then
+      table.insert(self, "H" .. num(x))
+   elseif x == self.x and y ~= self.y then
+      table.insert(self, "V" .. num(y))
+   elseif x ~= self.x or y ~= self.y then
+      table.insert(self, "L" .. num(x) .. " " .. num(y))
+   end
+   self.x, self.y = x, y
+end
+
+function PathData:arcTo(r, sweep, x, y)
+   table.insert(self, sprintf("A%s %s 0 0 %d %s %s",
+                              num(r), num(r), sweep, num(x), num(y)))
+   self.x, self.y = x, y
+end
+
+function PathData:close()
+   table.insert(self, "Z")
+end
+
+function PathData:string()
+   return table.concat(self)
+end
+
+
+local function dist(a, b)
+   return math.sqrt((b[1]-a[1])^2 + (b[2]-a[2])^2)
+end
+
+
+-- Draw a corner at `v` between segments from `a` and to `b`.  `r` is the
+-- radius to use if the corner is to be rounded, limited by `ra` and `rb`,
+-- the lengths available on each segment.
+--
+local function corner(pd, a, v, b, r, ra, rb)
+   local ux, uy = v[1]-a[1], v[2]-a[2]
+   local wx, wy = b[1]-v[1], b[2]-v[2]
+   local cross = ux*wy - uy*wx
+   r = math.min(r or 0, ra, rb)
+   if r <= 0 or cross == 0 or ux*wx + uy*wy ~= 0 then
+      pd:lineTo(v[1], v[2])
+      return
+   end
+   local la, lb = dist(a, v), dist(v, b)
+   pd:lineTo(v[1] - ux/la*r, v[2] - uy/la*r)
+   pd:arcTo(r, cross > 0 and 1 or 0, v[1] + wx/lb*r, v[2] + wy/lb*r)
+end
+
+
+-- Return true if b lies on the line from a to c, strictly between them
+-- and in the same direction (so that b can be omitted).
+--
+local function between(a, b, c)
+   local ux, uy = b[1]-a[1], b[2]-a[2]
+   local wx, wy = c[1]-b[1], c[2]-b[2]
+   return ux*wy - uy*wx == 0 and ux*wx + uy*wy > 0
+end
+
+
+-- Return path data for a rectangle with corner radii r = {tl, tr, br, bl}.
+--
+local function roundRectData(x, y, w, h, r)
+   local pd = newPathData()
+   local x2, y2 = x+w, y+h
+   pd:moveTo(x + r[1], y)
+   pd:lineTo(x2 - r[2], y)
+   if r[2] > 0 then pd:arcTo(r[2], 1, x2, y + r[2]) end
+   pd:lineTo(x2, y2 - r[3])
+   if r[3] > 0 then pd:arcTo(r[3], 1, x2 - r[3], y2) end
+   pd:lineTo(x + r[4], y2)
+   if r[4] > 0 then pd:arcTo(r[4], 1, x, y2 - r[4]) end
+   pd:lineTo(x, y + r[1])
+   if r[1] > 0 then pd:arcTo(r[1], 1, x + r[1], y) end
+   pd:close()
+   return pd:string()
+end
+
+
+----------------------------------------------------------------
+-- Svg2D
+----------------------------------------------------------------
+
+
+local Svg2D = Html2D:basicNew()
+
+
+function Svg2D:initialize(w, h)
+   Html2D.initialize(self, w, h)
+   self.rules = {}         -- class name -> CSS rule
+   self.ruleNames = {}     -- class names, in order of first use
+end
+
+
+-- Return the name of a class for the properties in `props`, or nil if
+-- there are none.
+--
+function Svg2D:propClass(props)
+   if not props[1] then
+      return nil
+   end
+   local decl = table.concat(props, ";")
+   local name = className(decl)
+   if not self.rules[name] then
+      self.rules[name] = sprintf("svg.svg2d .%s{%s}", name, decl)
+      table.insert(self.ruleNames, name)
+   end
+   return name
+end
+
+
+-- Emit an element.  `attrs` is an array of alternating names and values.
+-- `content`, if given, is markup to place within the element.
+--
+function Svg2D:elem(tag, attrs, class, content)
+   local o = { "<", tag }
+   for n = 1, #attrs, 2 do
+      o[#o+1] = sprintf(' %s="%s"', attrs[n], attrs[n+1])
+   end
+   if class and class ~= "" then
+      o[#o+1] = sprintf(' class="%s"', class)
+   end
+   if content then
+      o[#o+1] = ">" .. content .. "</" .. tag .. ">\n"
+   else
+      o[#o+1] = "/>\n"
+   end
+   table.insert(self.out, table.concat(o))
+end
+
+
+-- Radius of corners rounded by the "round" class (0.6em in defaultcss.lua)
+--
+function Svg2D:classRadius()
+   return 0.6 * self.fontSize
+end
+
+
+-- Emit lines of text.  `x` is the anchor point given by `anchor`, and
+-- `top` is the top of the first line.
+--
+function Svg2D:textLines(x, top, lh, lines, anchor, props)
+   if anchor ~= "start" then
+      props:f("text-anchor:%s", anchor)
+   end
+   local class = self:propClass(props)
+
+   if #lines == 1 then
+      self:elem("text", {"x", num(x), "y", num(top + lh/2)}, class, lines[1])
+   else
+      local spans = {}
+      for n, line in ipairs(lines) do
+         spans[n] = sprintf('<tspan x="%s" y="%s">%s</tspan>',
+                            num(x), num(top + (n-0.5)*lh), line)
+      end
+      self:elem("text", {}, class, table.concat(spans))
+   end
+end
+
+
+-- Stroke and/or fill a rectangle, as in Html2D.
+--
+function Svg2D:rect(x, y, w, h, opts)
+   local o = self:opts(opts)
+   local p = self:round(o.lineWidth)
+   local props = newProps()
+   local strokes = newProps()
+   local ds
+
+   local ss = o.strokeStyle
+   if ss and ss ~= "transparent" and p > 0 then
+      ds = strokeProps(strokes, o.strokeColor, ss, p)
+   else
+      p = 0
+   end
+
+   -- Place outer edges of borders on pixel boundaries, as Html2D does.
+   local x1, y1 = self:round(x - p/2), self:round(y - p/2)
+   local x2, y2 = self:round(x + w + p/2), self:round(y + h + p/2)
+   local rx, ry = x1 + p/2, y1 + p/2
+   local rw, rh = math.max(0, x2 - x1 - p), math.max(0, y2 - y1 - p)
+
+   if o.fill then
+      props:f("fill:%s", o.fillColor)
+   end
+   if o.shadow then
+      props:f("filter:drop-shadow(2px 2px 2px #888)")
+   end
+   if o.css then
+      props:f("%s", o.css)
+   end
+
+   if p > 0 or props[1] or o.class then
+      -- corner radii: top-left, top-right, bottom-right, bottom-left
+      local radii
+      if type(o.radius) == "table" then
+         local r = (" "..tostring(o.class).." "):match(" round ") and self:classRadius() or 0
+         radii = { r, r, r, r }
+         for _, pt in ipairs(o.radius) do
+            local n = pt[2] > y and (pt[1] > x and 3 or 4) or (pt[1] > x and 2 or 1)
+            radii[n] = o.radius.value
+         end
+      else
+         local r = math.floor(tonumber(o.radius) or 0)
+         radii = { r, r, r, r }
+      end
+      for n = 1, 4 do
+         radii[n] = math.max(0, math.min(radii[n], rw/2, rh/2))
+      end
+
+      -- Borders are drawn with the rectangle unless some are omitted.
+      local omit = {}
+      for _, side in ipairs(o.omitBorders or {}) do
+         omit[side] = true
+      end
+      local whole = not next(omit)
+      if whole then
+         for _, prop in ipairs(strokes) do
+            table.insert(props, prop)
+         end
+      end
+
+      local class = joinClasses(o.class, self:propClass(props), whole and ds)
+      if radii[1] == radii[2] and radii[1] == radii[3] and radii[1] == radii[4] then
+         local attrs = { "x", num(rx), "y", num(ry), "width", num(rw), "height", num(rh) }
+         if radii[1] > 0 then
+            table.insert(attrs, "rx")
+            table.insert(attrs, num(radii[1]))
+         end
+         self:elem("rect", attrs, class)
+      else
+         self:elem("path", {"d", roundRectData(rx, ry, rw, rh, radii)}, class)
+      end
+
+      if not whole and p > 0 then
+         local pd = newPathData()
+         local rx2, ry2 = rx + rw, ry + rh
+         for _, s in ipairs{ {"top", rx, ry, rx2, ry}, {"right", rx2, ry, rx2, ry2},
+                             {"bottom", rx, ry2, rx2, ry2}, {"left", rx, ry, rx, ry2} } do
+            if not omit[s[1]] then
+               pd:moveTo(s[2], s[3])
+               pd:lineTo(s[4], s[5])
+            end
+         end
+         if pd[1] then
+            self:elem("path", {"d", pd:string()}, joinClasses(self:propClass(strokes), ds))
+         end
+      end
+   end
+
+   if o.text and o.text ~= "" then
+      local html = self.htmlEscape(o.text):gsub("\n$", "")
+      local lines = {}
+      for line in (html.."\n"):gmatch("([^\n]*)\n") do
+         lines[#lines+1] = line
+      end
+
+      local tprops = newProps()
+      if o.textColor then
+         tprops:f("fill:%s", o.textColor)
+      end
+      if o.fontSize then
+         self:iProp(tprops, "font-size", "%spx", o.fontSize)
+      end
+      if o.textBG then
+         tprops:f("stroke:%s;stroke-width:4px;stroke-linejoin:round;paint-order:stroke",
+                  o.textBG)
+      end
+
+      -- vertically align text as Html2D does
+      local lh = o.lineHeight
+      local tp = self:round((h - p - #lines*lh)/2)
+      local top = y1 + p + math.max(tp, 0)
+
+      local align = o.textAlign or "center"
+      if align == "left" then
+         self:textLines(x1 + p, top, lh, lines, "start", tprops)
+      elseif align == "right" then
+         self:textLines(x2 - p, top, lh, lines, "end", tprops)
+      else
+         self:textLines((x1 + x2)/2, top, lh, lines, "middle", tprops)
+      end
+   end
+end
+
+
+-- Draw a sequence of connected segments, as in Html2D.  Corners are
+-- rounded where requested.  Segments that continue in the same direction
+-- are merged.
+--
+function Svg2D:path(path)
+   local radius = tonumber(path.radius)
+   local color = path.color or self.strokeColor
+   local lw = path.lineWidth or self.lineWidth
+   local hlw = lw/2
+
+   local pts = {}
+   for _, pt in ipairs(path) do
+      local p = { self:round(pt[1] - hlw) + hlw,
+                  self:round(pt[2] - hlw) + hlw }
+      p.round = radius and (not pt.flags or pt.flags:match"r")
+      local q = pts[#pts]
+      if not (q and q[1] == p[1] and q[2] == p[2]) then
+         if pts[2] and between(pts[#pts-1], q, p) then
+            pts[#pts] = p
+         else
+            pts[#pts+1] = p
+         end
+      end
+   end
+   if #pts < 2 then
+      return
+   end
+
+   local closed = #pts > 2 and pts[1][1] == pts[#pts][1] and pts[1][2] == pts[#pts][2]
+   if closed then
+      table.remove(pts)
+      if #pts > 2 and between(pts[#pts], pts[1], pts[2]) then
+         table.remove(pts, 1)
+      end
+   end
+
+   local n = #pts
+   local function at(i)
+      return pts[(i-1) % n + 1]
+   end
+
+   -- radius at vertex i, and space available for rounding on the segment
+   -- from i to i+1
+   local function radiusAt(i)
+      local p = at(i)
+      return p.round and (closed or (i > 1 and i < n)) and radius or 0
+   end
+   local function room(i)
+      local len = dist(at(i), at(i+1))
+      return (radiusAt(i) > 0 and radiusAt(i+1) > 0) and len/2 or len
+   end
+
+   local pd = newPathData()
+   if closed then
+      local a, b = pts[1], pts[2]
+      pd:moveTo((a[1]+b[1])/2, (a[2]+b[2])/2)
+      for i = 2, n + 1 do
+         corner(pd, at(i-1), at(i), at(i+1), radiusAt(i), room(i-1), room(i))
+      end
+      pd:close()
+   else
+      pd:moveTo(pts[1][1], pts[1][2])
+      for i = 2, n - 1 do
+         corner(pd, pts[i-1], pts[i], pts[i+1], radiusAt(i), room(i-1), room(i))
+      end
+      pd:lineTo(pts[n][1], pts[n][2])
+   end
+
+   local props = newProps()
+   local ds = strokeProps(props, color, path.lineStyle, lw)
+   self:elem("path", {"d", pd:string()}, joinClasses(path.class, self:propClass(props), ds))
+end
+
+
+function Svg2D:circle(x, y, radius, opts)
+   opts = opts or {}
+   local lw = opts.lineWidth or self.lineWidth
+   local style = opts.strokeStyle or self.strokeStyle or "solid"
+   local color = opts.strokeColor or self.strokeColor or "#000"
+   local props = newProps()
+   local ds = strokeProps(props, color, style, lw)
+   if opts.fill then
+      props:f("fill:%s", opts.fillColor or self.fillColor)
+   end
+   self:elem("circle", {"cx", num(x), "cy", num(y), "r", num(radius)},
+             joinClasses(self:propClass(props), ds))
+end
+
+
+-- Wedge: Fill a triangle with a vertical or horizontal edge.  See
+-- Html2D:wedge().
+--
+function Svg2D:wedge(x, y, len, a, d, flip, color)
+   local x2, y2 = self:round2(x+len), self:round2(y+a+d)
+   x, y, a = self:round2(x), self:round2(y), self:round2(a)
+   d = self:round2(y2 - y - a)
+   len = self:round2(x2 - x)
+   color = color or self.strokeColor
+
+   local pts
+   if flip then
+      pts = { x, y, x - a, y + len, x + d, y + len }
+   else
+      pts = { x, y, x + len, y - a, x + len, y + d }
+   end
+   local s = sprintf("%s,%s %s,%s %s,%s", num(pts[1]), num(pts[2]), num(pts[3]),
+                     num(pts[4]), num(pts[5]), num(pts[6]))
+
+   local props = newProps()
+   local df
+   if color == "default" then
+      df = "df"
+   else
+      props:f("fill:%s", color)
+   end
+   self:elem("polygon", {"points", s}, joinClasses(self:propClass(props), df))
+end
+
+
+function Svg2D:strokeX(x, y, w, clr)
+   local props = newProps()
+   props:f("font:%spx Verdana, Arial", self:round(w*3))
+   props:f("fill:%s", clr or self.fillColor)
+   props:f("text-anchor:middle")
+   self:elem("text", {"x", num(self:round(x)), "y", num(self:round(y))},
+             self:propClass(props), "x")
+end
+
+
+function Svg2D:fillText(x, y, txt)
+   local props = newProps()
+   self:iProp(props, "font-size", "%spx", self.fontSize)
+   self:iProp(props, "fill", "%s", self.fillColor)
+   if self.pxi then
+      x, y = self:round(x), self:round(y)
+   end
+   self:textLines(x, y, self.lineHeight, {self.htmlEscape(txt)}, "start", props)
+end
+
+
+function Svg2D:beginTransform(deg, xscale, ox, oy)
+   local t
+   if xscale then
+      t = sprintf("translate(%s %s) rotate(%s) scale(%s 1) translate(%s %s)",
+                  num(ox), num(oy), num(deg), xscale, num(-ox), num(-oy))
+   else
+      t = sprintf("rotate(%s %s %s)", num(deg), num(ox), num(oy))
+   end
+   self:emitHTML('<g transform="%s">\n', t)
+end
+
+
+function Svg2D:endTransform()
+   self:emitHTML("</g>\n")
+end
+
+
+-- These style elements are assumed by the Svg2D rendering functions.  The
+-- selectors for the classes generated by propClass() are more specific,
+-- and the "ds" and "df" rules less specific, than ".CLASS .CLASS" rules in
+-- a style sheet.
+--
+local svg2dStyle = [[
+svg.svg2d { display: block; overflow: visible; }
+svg.svg2d rect, svg.svg2d path, svg.svg2d circle { fill: none; }
+svg.svg2d path { stroke-linecap: square; }
+svg.svg2d text { dominant-baseline: central; white-space: pre; }
+svg .ds { stroke: currentColor; }
+svg .df { fill: currentColor; }
+]]
+
+
+function Svg2D:genHTML(props)
+   if not (self.width and self.height) then return "" end
+
+   local css = newProps()
+   for k,v in opairs(self.iprops) do
+      css:f("%s:%s", k, v)
+   end
+   css:f("%s", props or '')
+   local style = css[1] and sprintf(' style="%s"', table.concat(css, ";")) or ""
+
+   local diagramStyle = ""
+   if self.float then
+      diagramStyle = sprintf(' style="float:%s"', self.float)
+   end
+
+   local w, h = num(self.width), num(self.height)
+   local html =
+      '<div class=diagram' .. diagramStyle .. '>\n' ..
+      sprintf('<svg class="svg2d %s" width="%s" height="%s" viewBox="0 0 %s %s"%s>\n',
+              self.canvasClass, w, h, w, h, style) ..
+      table.concat(self.out, "") .. "</svg>\n</div>\n"
+
+   local rules = { svg2dStyle }
+   for _, name in ipairs(self.ruleNames) do
+      rules[#rules+1] = self.rules[name] .. "\n"
+   end
+
+   return html, table.concat(rules)
+end
+
+
+-- The style nodes share a `_group`, so htmlgen.normalize() merges them
+-- into one <style> element, and `_once`, so each rule appears once.
+--
+function Svg2D:genTree(...)
+   local html = self:genHTML(...)
+   local head = E.head{ E.style{ _once="svg2d", _group="svg2d", type="text/css", svg2dStyle } }
+   for _, name in ipairs(self.ruleNames) do
+      table.insert(head, E.style{ _once="svg2d."..name, _group="svg2d",
+                                  type="text/css", self.rules[name] .. "\n" })
+   end
+   return { E._html{html}, head }
+end
+
+
+return Svg2D
@@ -0,0 +1,211 @@
+local qt = require "qtest"
+local Html2D = require "html2d"
+local smark_art = require "smark_art"
+local mscgen = require "mscgen"
+local htmlgen = require "htmlgen"
+
+require "svg2d"
+local Svg2D, _S2D = qt.load("svg2d.lua", {"num", "roundRectData", "className"})
+
+local eq = qt.eq
+
+local function patCount(pat, str)
+   return select(2, str:gsub(pat, ""))
+end
+
+local function newGC()
+   local gc = Svg2D:new()
+   gc:setSize(100, 50)
+   return gc
+end
+
+-- return the drawing elements emitted so far
+local function drawn(gc)
+   return table.concat(gc.out)
+end
+
+
+--------------------------------------------------------------------------------
+-- Tests
+--------------------------------------------------------------------------------
+local T = qt.tests
+
+
+function T.num()
+   local num = _S2D.num
+   eq("1", num(1))
+   eq("10", num(10))
+   eq("100", num(100.001))
+   eq("1.5", num(1.5))
+   eq("0.25", num(0.25))
+   eq("-2.75", num(-2.75))
+   eq("0", num(-0.001))
+end
+
+
+function T.roundRectData()
+   eq("M0 0H10V20H0V0Z", _S2D.roundRectData(0, 0, 10, 20, {0,0,0,0}))
+   eq("M2 0H10V18A2 2 0 0 1 8 20H0V2A2 2 0 0 1 2 0Z",
+      _S2D.roundRectData(0, 0, 10, 20, {2,0,2,0}))
+end
+
+
+function T.path()
+   -- collinear segments are merged; H and V are used
+   local gc = newGC()
+   gc:path{ {0,0}, {10,0}, {20,0}, {20,10} }
+   eq('<path d="M0 0H20V10" class="g328ad9d6 ds"/>\n', drawn(gc))
+
+   -- closed path with rounded corners
+   gc = newGC()
+   gc:path{ {0,0}, {20,0}, {20,20}, {0,20}, {0,0}, radius=4 }
+   eq('<path d="M10 0H16A4 4 0 0 1 20 4V16A4 4 0 0 1 16 20H4' ..
+         'A4 4 0 0 1 0 16V4A4 4 0 0 1 4 0Z" class="g328ad9d6 ds"/>\n',
+      drawn(gc))
+
+   -- end points are not rounded; color and style go in the class
+   gc = newGC()
+   gc:path{ {0,0}, {20,0}, {20,20}, radius=4, color="#f00", lineStyle="dotted" }
+   local html, css = gc:genHTML()
+   local class = drawn(gc):match('d="M0 0H16A4 4 0 0 1 20 4V20" class="(g%x+)"')
+   qt.assert(class)
+   qt.match(css, "%."..class.."{stroke%-width:2;stroke%-dasharray:0 4;" ..
+               "stroke%-linecap:round;stroke:#f00}")
+   qt.match(html, "<path d=")
+end
+
+
+function T.sharedClasses()
+   local gc = newGC()
+   gc:path{ {0,0}, {20,0}, color="#123" }
+   gc:path{ {0,10}, {20,10}, color="#123" }
+   gc:path{ {0,20}, {20,20}, color="#456" }
+   local html, css = gc:genHTML()
+   eq(3, patCount("<path ", html))
+   eq(2, patCount("svg%.svg2d %.g%x+{", css))
+
+   -- names depend only on the properties
+   local gc2 = newGC()
+   gc2:path{ {5,5}, {5,25}, color="#123" }
+   local c1 = html:match('class="(g%x+)"')
+   local c2 = drawn(gc2):match('class="(g%x+)"')
+   eq(c1, c2)
+
+   -- each rule appears once per document, all in one <style> element
+   local head = gc:genTree()[2]
+   eq("svg2d", head[1]._once)
+   eq("svg2d."..c1, head[2]._once)
+   eq(3, #head)
+   local doc = htmlgen.generateDoc{ gc:genTree(), gc2:genTree() }
+   eq(1, patCount("<style", doc))
+   eq(1, patCount("%."..c1.."{", doc))
+   eq(2, patCount("svg%.svg2d %.g%x+{", doc))
+end
+
+
+function T.classNames()
+   -- "aB" and "b!" have the same djb2 hash
+   local a, b = _S2D.className("aB"), _S2D.className("b!")
+   qt.match(a, "^g%x+$")
+   eq(a .. "-2", b)
+   eq(a, _S2D.className("aB"))
+   eq(b, _S2D.className("b!"))
+end
+
+
+function T.rect()
+   local gc = newGC()
+   gc:rect(10, 10, 20, 10, {class="rect"})
+   gc:rect(10, 30, 20, 10, {class="round", radius={ {10,30}, value=3 }, text="a<b"})
+   local out = drawn(gc)
+   qt.match(out, '<rect x="10" y="10" width="20" height="10" class="rect"/>')
+   -- listed corner gets `value`; others get the radius of the class
+   qt.match(out, 'class="round"')
+   qt.match(out, 'V33A3 3 0 0 1 13 30Z')
+   qt.match(out, '>a&lt;b</text>')
+
+   -- omitted borders
+   gc = newGC()
+   gc:rect(10, 10, 20, 10, {strokeStyle="solid", lineWidth=2, fill=true,
+                            fillColor="#eee", omitBorders={"top", "left"}})
+   out = drawn(gc)
+   eq(1, patCount("<rect ", out))
+   qt.match(out, '<path d="M30 10V20M10 20H30"')
+end
+
+
+function T.wedge()
+   local gc = newGC()
+   gc:wedge(10, 10, 5, 2, 2)
+   gc:wedge(10, 10, -5, 2, 2, true, "#00f")
+   local out = drawn(gc)
+   qt.match(out, '<polygon points="10,10 15,8 15,12" class="df"/>')
+   qt.match(out, '<polygon points="10,10 8,5 12,5" class="g%x+"/>')
+end
+
+
+function T.transform()
+   local gc = newGC()
+   gc:beginTransform(4, nil, 10, 20)
+   gc:endTransform()
+   gc:beginTransform(5, 1.02, 10, 20)
+   gc:endTransform()
+   eq('<g transform="rotate(4 10 20)">\n</g>\n' ..
+      '<g transform="translate(10 20) rotate(5) scale(1.02 1) translate(-10 -20)">\n</g>\n',
+      drawn(gc))
+
+   -- Html2D output is unchanged
+   local hgc = Html2D:new()
+   hgc:beginTransform(4, nil, 10, 20)
+   hgc:endTransform()
+   qt.match(table.concat(hgc.out), '^<div style="position:relative;' ..
+               '%-webkit%-transform:rotate%(4deg%);%-webkit%-transform%-origin:' ..
+               '10%.000000px 20%.000000px;.*</div>$')
+end
+
+
+-- Render diagrams with both backends.  SVG output should consist only of
+-- SVG elements, and be smaller.
+--
+function T.diagrams()
+   local art = [[
+ +-------+     .-------.
+ | hello |---->| world |
+ +-------+     '-------'
+     :            ^
+     +............+
+]]
+   local msc = [[
+      a, b, c;
+      a -> b [ label = "func(TRUE)" ];
+      c => c [ label = "work" ];
+      a <<= c [ label = "callback()" ];
+      a =>> c [ label = "skip", arcskip="1" ];
+      --- [ label = "Horizontal Line", linecolor="#d00" ];
+      a box a [ label = "box" ], b rbox b [ label = "rbox" ], c abox c [ label = "abox" ];
+   ]]
+
+   local function render(GC, f)
+      local gc = GC:new()
+      f(gc)
+      return (gc:genHTML())
+   end
+
+   for _, f in ipairs {
+      function (gc) smark_art.render2D({ text = art }, gc) end,
+      function (gc) mscgen.render(mscgen.parse(msc, error), gc) end,
+   } do
+      local svg = render(Svg2D, f)
+      local html = render(Html2D, f)
+      local body = svg:match("^<div class=diagram>\n<svg [^\n]*>\n(.*)</svg>\n</div>\n$")
+      qt.assert(body)
+      eq("", (body:gsub("<(%w+)[^\n]*/>\n", "")
+                  :gsub("<text [^\n]*</text>\n", "")
+                  :gsub('<g transform="[^"]*">\n', "")
+                  :gsub("</g>\n", "")))
+      qt.assert(#svg < #html)
+   end
+end
+
+
+return qt.runTests()
@@ -0,0 +1,4629 @@
+// Generated by cfromlua
+// lib: ../monoglot/.out/exports/xpio_c.lib
+// lib: ../luau/.out/exports/xpfs.lib
+// lib: ../luau/.out/exports/textcodec_c.lib
+// lib: ../luau/.out/exports/deflate_c.lib
+// lib: ../lpeg/.out/exports/lpeg.lib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local HTTPD=require\"httpd\"\n"
+  "local Dino=require\"dino\"\n"
+  "local thread=require\"thread\"\n"
+  "local opairs=require\"opairs\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local trapFilter=require\"trapfilter\"\n"
+  "\n"
+  "local E=doctree.E\n"
+  "\n"
+  "\n"
+  "local defaultCSS=[[\n"
+  "body { font: 14px Arial; }\n"
+  "table { border-collapse: collapse; border-width: 1px; border-spacing: 1px;\n"
+  "   border-color: transparent; margin: 16px 0; }\n"
+  "th { background-color: #ddd; color: black; text-align: left; }\n"
+  "td, th { border-style: solid; border-color: #bbb; border-width: 1px;\n"
+  "   padding: 0 6px; font: 12px Courier; }}\n"
+  "td p:first-child, th p:first-child { margin-top: 3px; }\n"
+  "td p:last-child, th p:last-child { margin-bottom: 3px; }\n"
+  "th { white-space: nowrap; }\n"
+  "pre { background-color: #eee; color: black; border: 1px solid #888;\n"
+  "   padding: 2px; font: 12px Courier, monospace; }\n"
+  "]]\n"
+  "\n"
+  "local style=E.style{defaultCSS}\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function showTable(t)\n"
+  "if not t then\n"
+  "return E.i{\"-nil-\"}\n"
+  "end\n"
+  "local node=E.table{}\n"
+  "for name,value in opairs(t)do\n"
+  "if(type(name)==\"string\"or type(name)==\"number\")then\n"
+  "if type(value)~=\"string\"and type(value)~=\"number\"then\n"
+  "value=\"<\"..type(value)..\">\"\n"
+  "end\n"
+  "node[#node+1]=E.tr{\n"
+  "E.th{tostring(name)},\n"
+  "E.td{tostring(value)}\n"
+  "}\n"
+  "end\n"
+  "end\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function showStream(stream)\n"
+  "local node=E.pre{}\n"
+  "repeat\n"
+  "local data,err=stream:read(4096)\n"
+  "if data then\n"
+  "node[#node+1]=data\n"
+  "elseif err then\n"
+  "return error(err)\n"
+  "end\n"
+  "until not data\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function showRequest(request)\n"
+  "return{\n"
+  "E.head{\n"
+  "E.title{\"Request Details\"},\n"
+  "style\n"
+  "},\n"
+  "E.h2{\"request[]\"},\n"
+  "showTable(request),\n"
+  "E.h2{\"request.headers[]\"},\n"
+  "showTable(request.headers),\n"
+  "E.h2{\"request.context[]\"},\n"
+  "showTable(request.context),\n"
+  "E.h2{\"request.params[]\"},\n"
+  "showTable(request.params),\n"
+  "E.h2{\"request.body\"},\n"
+  "(request.body\n"
+  "and showStream(request.body)\n"
+  "or E.i{\"nil\"}),\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local welcome={\n"
+  "E.head{\n"
+  "E.title{\"Welcome\"},\n"
+  "style\n"
+  "},\n"
+  "E.h1{\"Home\"},\n"
+  "E.h2{\"Link\"},\n"
+  "E.p{E.a{href=\"/show\",\"Show request details\"}},\n"
+  "E.h2{\"GET form\"},\n"
+  "E.p{\n"
+  "E.form{\n"
+  "method=\"GET\",\n"
+  "action=\"/show\",\n"
+  "E.input{type=\"text\",name=\"a\",},\n"
+  "E.input{type=\"submit\",name=\"b\",value=\"submit\"},\n"
+  "}\n"
+  "},\n"
+  "E.h2{\"POST form\"},\n"
+  "E.p{\n"
+  "E.form{\n"
+  "method=\"POST\",\n"
+  "action=\"/show\",\n"
+  "E.input{type=\"text\",name=\"a\",},\n"
+  "E.input{type=\"submit\",name=\"b\",value=\"submit\"},\n"
+  "}\n"
+  "},\n"
+  "E.h2{\"Error\"},\n"
+  "E.p{E.a{href=\"/error\",\"Uncaught error in handler\"}},\n"
+  "E.p{E.a{href=\"/slow\",\"Slow reponse\"}},\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "local server\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local dino=Dino:new()\n"
+  "local GET,POST=dino.method.GET,dino.method.POST\n"
+  "\n"
+  "\n"
+  "GET[\"/\"]=function()\n"
+  "return welcome\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET[\"/show\"]=showRequest\n"
+  "\n"
+  "\n"
+  "POST[\"/show\"]=showRequest\n"
+  "\n"
+  "\n"
+  "GET[\"/error\"]=function(request)\n"
+  "return\"x\"/0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET[\"/slow\"]=function(request)\n"
+  "\n"
+  "local function body(emit)\n"
+  "emit(\"<title>Slow</title>\")\n"
+  "for n=1,20 do\n"
+  "thread.sleep(0.25)\n"
+  "emit(\"<div>\"..n..\"</div>\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return body\n"
+  "end\n"
+  "\n"
+  "\n"
+  "GET[\"/exit\"]=function(request)\n"
+  "server:stop()\n"
+  "return 200,E.h2{\"Exiting...\"}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "dino.when[true]=function(request)\n"
+  "return 404,{\n"
+  "E.head{\n"
+  "E.title{\"Resource not found\"},\n"
+  "style\n"
+  "},\n"
+  "E.h1{\"Resource not found\"},\n"
+  "E.pre{request.path}\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function main()\n"
+  "local port=os.getenv(\"port\")or\"127.0.0.1:8080\"\n"
+  "server=HTTPD:new(port)\n"
+  "server:start(trapFilter.wrap(dino))\n"
+  "print(\"Listening on \"..port..\" ...\")\n"
+  "end\n"
+  "\n"
+  "thread.dispatch(main)\n"
+  "";
+
+static const unsigned char data2[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local xpio=require\"xpio\"\n"
+  "local xuri=require\"xuri\"\n"
+  "local thread=require\"thread\"\n"
+  "local SubStream=require\"substream\"\n"
+  "local ChunkedStream=require\"chunkedstream\"\n"
+  "local deflate_c=require\"deflate_c\"\n"
+  "local lpeg=require\"lpeg\"\n"
+  "\n"
+  "local pairs,ipairs,rawset,tonumber,tostring,assert,type=\n"
+  "pairs,ipairs,rawset,tonumber,tostring,assert,type\n"
+  "\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "\n"
+  "local bLog=os.getenv(\"httpd_log\")==\"1\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriSplit(uri)\n"
+  "local prefix\n"
+  "if not uri then\n"
+  "return\n"
+  "elseif not uri:match(\"^/\")then\n"
+  "prefix,uri=uri:match(\"([^/:]+://[^/]*)(/\?.*)\")\n"
+  "if uri==\"\"then\n"
+  "uri=\"/\"\n"
+  "elseif not uri then\n"
+  "return\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return prefix,uri:match(\"([^%\?]*)(.*)\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local charEscape={}\n"
+  "charEscape[\"\\n\"]=\"\\\\n\\n\"\n"
+  "charEscape[\"\\r\"]=\"\\\\r\"\n"
+  "charEscape[\"\\\\\"]=\"\\\\\\\\\"\n"
+  "setmetatable(charEscape,{__index=function(t,ch)return(\"\\\\%03d\"):format(ch:byte())end})\n"
+  "\n"
+  "\n"
+  "local function log(who,data)\n"
+  "if bLog then\n"
+  "local enc=data:gsub(\"[%z\\1-\\31\\128-\\255\\\\]\",charEscape)\n"
+  "print(who..\": \"..enc:gsub(\"\\n(.)\",\"\\n : %1\"))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function flatten(v)\n"
+  "if v==nil then\n"
+  "return\"\"\n"
+  "end\n"
+  "local t={}\n"
+  "local n=0\n"
+  "local err\n"
+  "\n"
+  "local function f(v)\n"
+  "if type(v)==\"string\"then\n"
+  "n=n+1\n"
+  "t[n]=v\n"
+  "elseif type(v)==\"table\"then\n"
+  "for _,e in ipairs(v)do\n"
+  "f(e)\n"
+  "end\n"
+  "else\n"
+  "err=\"Invalid value in response.body: type = \"..type(v)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "f(v)\n"
+  "return concat(t),err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function clone(old)\n"
+  "local new={}\n"
+  "for k,v in pairs(old)do\n"
+  "new[k]=v\n"
+  "end\n"
+  "return new\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function acceptQ(accept,coding)\n"
+  "local q,qStar\n"
+  "for item in accept:gmatch(\"[^,]+\")do\n"
+  "local name,params=item:match(\"^%s*([^;%s]+)%s*(.*)\")\n"
+  "if name then\n"
+  "local qv=tonumber(params:match(\"[qQ]%s*=%s*([%d.]+)\")or 1)or 0\n"
+  "name=name:lower()\n"
+  "if name==coding then\n"
+  "q=qv\n"
+  "elseif name==\"*\"then\n"
+  "qStar=qv\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return q or qStar or 0\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local patToken=\"[^\\0-\\32\\127()<>@,;:\\\\\\\"/[%]%\?={}]+\"\n"
+  "\n"
+  "\n"
+  "local function parseList(str)\n"
+  "local t={}\n"
+  "for tok in(str or\"\"):gmatch(patToken)do\n"
+  "t[#t+1]=tok\n"
+  "t[tok]=#t\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function chunkEncode(str)\n"
+  "return string.format(\"%X\",#str)..\"\\r\\n\"..str..\"\\r\\n\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local parseTE\n"
+  "do\n"
+  "local P,R,S,C,Cs,Ct=lpeg.P,lpeg.R,lpeg.S,lpeg.C,lpeg.Cs,lpeg.Ct\n"
+  "\n"
+  "local lws=R'\\1\\32'^0\n"
+  "local function T(pat)\n"
+  "return pat*lws\n"
+  "end\n"
+  "\n"
+  "local function makeTE(name,tbl)\n"
+  "tbl.name=name\n"
+  "return tbl\n"
+  "end\n"
+  "\n"
+  "local TOK=C((R'!~'-S',;=\"')^1)*lws\n"
+  "local QSTR=P'\"'*Cs(((1-S'\"\\\\')+(P'\\\\'/''*1))^0)*P'\"'*lws\n"
+  "local PARAM=TOK*T'='*(TOK+QSTR)/function(a,b)return a..\"=\"..b end\n"
+  "local TE=TOK*Ct((T';'*PARAM)^0)/makeTE\n"
+  "local TC=lws*Ct(TE*(T','*TE)^0+P(true))\n"
+  "\n"
+  "function parseTE(str)\n"
+  "return TC:match(str)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local cacheLimit=10000\n"
+  "local keyLimit=40\n"
+  "\n"
+  "local function cacheTable(f)\n"
+  "local room=cacheLimit\n"
+  "local function index(t,k)\n"
+  "local v=f(k)\n"
+  "\n"
+  "if#k<=keyLimit then\n"
+  "room=room-#k\n"
+  "if room<0 then\n"
+  "\n"
+  "for k,v in pairs(t)do\n"
+  "rawset(t,k,nil)\n"
+  "end\n"
+  "room=cacheLimit-#k\n"
+  "end\n"
+  "rawset(t,k,v)\n"
+  "end\n"
+  "return v\n"
+  "end\n"
+  "return setmetatable({},{__index=index,__call=index})\n"
+  "end\n"
+  "\n"
+  "local function headerInFunc(k)\n"
+  "return(k:lower():gsub(\"%-([a-z])\",string.upper))\n"
+  "end\n"
+  "\n"
+  "local function headerOutFunc(k)\n"
+  "return(k:gsub(\"[A-Z]\",\"-%1\"):gsub(\"^[a-z]\",string.upper))\n"
+  "end\n"
+  "\n"
+  "local headerIn=cacheTable(headerInFunc)\n"
+  "local headerOut=cacheTable(headerOutFunc)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local patVersion=\"HTTP/(%d+)%.(%d+)\"\n"
+  "\n"
+  "\n"
+  "local patRequest=\"^(\"..patToken..\") ([^ ]+) \"..patVersion..\" *\\r\?\\n\"\n"
+  "\n"
+  "\n"
+  "local PH=Object:new()\n"
+  "\n"
+  "local pstSTART=1\n"
+  "local pstHDRS=2\n"
+  "local pstDONE=3\n"
+  "\n"
+  "\n"
+  "function PH:initialize()\n"
+  "self:restart()\n"
+  "end\n"
+  "\n"
+  "function PH:restart()\n"
+  "self.state=pstSTART\n"
+  "self.data=\"\"\n"
+  "self.version=-1\n"
+  "self.headers={}\n"
+  "self.lastHeader=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function PH:isDone()\n"
+  "return self.state==pstDONE\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function PH:parseStart(data,pos)\n"
+  "\n"
+  "local m,u,a,b=data:match(patRequest,pos)\n"
+  "\n"
+  "if not m then\n"
+  "\n"
+  "m,u=data:match(\"^([^ \\t]+) +(/[^ \\t\\r\\n]*)\\r\?\\n\",pos)\n"
+  "if m then\n"
+  "self.method=m\n"
+  "self.uri=u\n"
+  "else\n"
+  "self.error=\"bad\"\n"
+  "end\n"
+  "return pstDONE\n"
+  "elseif a~=\"1\"then\n"
+  "self.error=\"unsupported\"\n"
+  "return pstDONE\n"
+  "end\n"
+  "\n"
+  "self.method=m\n"
+  "self.uri=u\n"
+  "self.version=tonumber(b)\n"
+  "return pstHDRS\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function PH:takeData(newData)\n"
+  "local st=self.state\n"
+  "local data=self.data..newData\n"
+  "local nextLine=1\n"
+  "local hdrs=self.headers\n"
+  "\n"
+  "while st~=pstDONE do\n"
+  "local lineEnd=data:find(\"\\n\",nextLine)\n"
+  "if not lineEnd then break end\n"
+  "\n"
+  "local thisLine=nextLine\n"
+  "nextLine=lineEnd+1\n"
+  "\n"
+  "if st==pstSTART then\n"
+  "st=self:parseStart(data,thisLine)\n"
+  "\n"
+  "elseif st==pstHDRS then\n"
+  "\n"
+  "\n"
+  "local name,value=data:match(\"^([^\\0-\\32:]+)[ \\t]*:[ \\t]*([^\\r\\n]*)\\r\?\\n\",thisLine)\n"
+  "if name then\n"
+  "\n"
+  "name=headerIn[name]\n"
+  "if hdrs[name]then\n"
+  "value=hdrs[name]..\"; \"..value\n"
+  "end\n"
+  "hdrs[name]=value\n"
+  "self.lastHeader=name\n"
+  "elseif data:match(\"^\\r\?\\n\",thisLine)then\n"
+  "\n"
+  "st=pstDONE\n"
+  "break\n"
+  "else\n"
+  "\n"
+  "local cont=data:match(\"^[ \\t]*([^\\r\\n]*)\",thisLine)\n"
+  "if cont and self.lastHeader then\n"
+  "hdrs[self.lastHeader]=hdrs[self.lastHeader]..\" \"..cont\n"
+  "else\n"
+  "self.error=\"bad\"\n"
+  "st=pstDONE\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self.data=data:sub(nextLine)\n"
+  "self.state=st\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local httpStatusCodes={\n"
+  "[100]=\"Continue\",\n"
+  "[101]=\"Switching Protocols\",\n"
+  "[200]=\"OK\",\n"
+  "[201]=\"Created\",\n"
+  "[202]=\"Accepted\",\n"
+  "[203]=\"Non-Authoritative Information\",\n"
+  "[204]=\"No Content\",\n"
+  "[205]=\"Reset Content\",\n"
+  "[206]=\"Partial Content\",\n"
+  "[300]=\"Multiple Choices\",\n"
+  "[301]=\"Moved Permanently\",\n"
+  "[302]=\"Found\",\n"
+  "[303]=\"See Other\",\n"
+  "[304]=\"Not Modified\",\n"
+  "[305]=\"Use Proxy\",\n"
+  "[306]=\"(Unused)\",\n"
+  "[307]=\"Temporary Redirect\",\n"
+  "[400]=\"Bad Request\",\n"
+  "[401]=\"Unauthorized\",\n"
+  "[402]=\"Payment Required\",\n"
+  "[403]=\"Forbidden\",\n"
+  "[404]=\"Not Found\",\n"
+  "[405]=\"Method Not Allowed\",\n"
+  "[406]=\"Not Acceptable\",\n"
+  "[407]=\"Proxy Authentication Required\",\n"
+  "[408]=\"Request Timeout\",\n"
+  "[409]=\"Conflict\",\n"
+  "[410]=\"Gone\",\n"
+  "[411]=\"Length Required\",\n"
+  "[412]=\"Precondition Failed\",\n"
+  "[413]=\"Request Entity Too Large\",\n"
+  "[414]=\"Request-URI Too Long\",\n"
+  "[415]=\"Unsupported Media Type\",\n"
+  "[416]=\"Requested Range Not Satisfiable\",\n"
+  "[417]=\"Expectation Failed\",\n"
+  "[500]=\"Internal Server Error\",\n"
+  "[501]=\"Not Implemented\",\n"
+  "[502]=\"Bad Gateway\",\n"
+  "[503]=\"Service Unavailable\",\n"
+  "[504]=\"Gateway Timeout\",\n"
+  "[505]=\"HTTP Version Not Supported\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local BUFSIZE=1024\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function timeAfter(timeout)\n"
+  "return timeout and xpio.gettime()+timeout or nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function closingResponse(code,extraHeaders)\n"
+  "return\"HTTP/1.1 \"..code..\" \"..httpStatusCodes[code]..\"\\r\\n\"..\n"
+  "(extraHeaders or\"\")..\n"
+  "\"Connection: Close\\r\\nContent-Length: 0\\r\\n\\r\\n\"\n"
+  "end\n"
+  "\n"
+  "local WDConn=Object:new()\n"
+  "\n"
+  "local cstINIT=1\n"
+  "local cstREQUEST=2\n"
+  "local cstHANDLER=3\n"
+  "local cstDISCARD=4\n"
+  "local cstRESPOND=5\n"
+  "\n"
+  "\n"
+  "function WDConn:initialize(socket,handler,httpd)\n"
+  "self.socket=socket\n"
+  "self.handler=handler\n"
+  "self.data=\"\"\n"
+  "self.ph=PH:new()\n"
+  "self.httpd=httpd\n"
+  "self.thread=thread.new(self.run,self)\n"
+  "\n"
+  "thread.setPriority(\"interactive\",self.thread)\n"
+  "self.server=httpd.name\n"
+  "self.context={\n"
+  "client=socket:getpeername()\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function WDConn:shutDown(timeout)\n"
+  "\n"
+  "self:dtor()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function WDConn:dtor()\n"
+  "if not self.inDtor then\n"
+  "self.inDtor=true\n"
+  "if self.thread then\n"
+  "\n"
+  "thread.kill(self.thread)\n"
+  "end\n"
+  "if self.isActive then\n"
+  "self.isActive=false\n"
+  "self.httpd.active=self.httpd.active-1\n"
+  "end\n"
+  "self.socket:close()\n"
+  "self.httpd:removeConn(self)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:readUntil(amt,deadline)\n"
+  "local sock=self.socket\n"
+  "repeat\n"
+  "local data,err=sock:try_read(amt)\n"
+  "if data then\n"
+  "return data\n"
+  "elseif err~=\"retry\"then\n"
+  "return nil,err\n"
+  "end\n"
+  "until not thread.waitUntil(deadline,sock.when_read,sock)\n"
+  "\n"
+  "local stats=self.httpd.stats\n"
+  "stats.timedOut=stats.timedOut+1\n"
+  "return nil,\"timeout\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function WDConn:warn(...)\n"
+  "print(\"httpd.lua warning: \"..string.format(...))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:read(amt)\n"
+  "if self.expectContinue then\n"
+  "local err=self:sendContinue()\n"
+  "if err then\n"
+  "return nil,err\n"
+  "end\n"
+  "end\n"
+  "return self:readUntil(amt,timeAfter(self.httpd.bodyTimeout))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:sendContinue()\n"
+  "self.expectContinue=false\n"
+  "log(\"S\",\"HTTP/1.1 100 Continue\\r\\n\\r\\n\")\n"
+  "local _,err=self.socket:write(\"HTTP/1.1 100 Continue\\r\\n\\r\\n\")\n"
+  "return err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:handle()\n"
+  "local prefix,path,query=uriSplit(self.ph.uri)\n"
+  "if not path or self.ph.error then\n"
+  "self.connClose=true\n"
+  "return 505,{},\"\"\n"
+  "end\n"
+  "\n"
+  "local headers=self.ph.headers\n"
+  "local len=tonumber(headers.contentLength)\n"
+  "\n"
+  "local connHdr=parseList((headers.connection or\"\"):lower())\n"
+  "self.connClose=connHdr.close\n"
+  "or self.ph.version<1 and not connHdr.keepAlive\n"
+  "\n"
+  "\n"
+  "local chunked\n"
+  "local teUsed=headers.transferEncoding\n"
+  "if teUsed then\n"
+  "local tencs=parseTE(teUsed)\n"
+  "local name=tencs[1]and tencs[1].name:lower()\n"
+  "if name==\"chunked\"and not tencs[2]then\n"
+  "chunked=true\n"
+  "elseif name and name~=\"identity\"then\n"
+  "\n"
+  "\n"
+  "self.connClose=true\n"
+  "return 501,{},\"\"\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local extra=self.ph.data\n"
+  "self.ph.data=\"\"\n"
+  "\n"
+  "\n"
+  "local expect=headers.expect\n"
+  "if expect and self.ph.version>=1 then\n"
+  "if expect:lower()~=\"100-continue\"then\n"
+  "\n"
+  "self.connClose=true\n"
+  "return 417,{},\"\"\n"
+  "end\n"
+  "\n"
+  "self.expectContinue=extra==\"\"and(chunked or(len or 0)>0)\n"
+  "end\n"
+  "\n"
+  "if chunked then\n"
+  "self.subStream=ChunkedStream:new(self,extra)\n"
+  "else\n"
+  "self.subStream=SubStream:new(self,extra,len or 0)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local httpd=self.httpd\n"
+  "if httpd.maxActive and httpd.active>=httpd.maxActive then\n"
+  "httpd.stats.shed=httpd.stats.shed+1\n"
+  "return 503,{retryAfter=\"1\"},\"\"\n"
+  "end\n"
+  "httpd.active=httpd.active+1\n"
+  "self.isActive=true\n"
+  "\n"
+  "local request={\n"
+  "method=self.ph.method,\n"
+  "server=self.server,\n"
+  "root=\"\",\n"
+  "path=path,\n"
+  "query=query,\n"
+  "headers=headers,\n"
+  "body=self.subStream,\n"
+  "context=self.context\n"
+  "}\n"
+  "\n"
+  "\n"
+  "return self.handler(request)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function varyEncoding(headers)\n"
+  "local vary=headers.vary\n"
+  "if not vary then\n"
+  "headers.vary=\"Accept-Encoding\"\n"
+  "elseif not vary:lower():match(\"accept%-encoding\")then\n"
+  "headers.vary=vary..\", Accept-Encoding\"\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:compressBody(headers,bodyBytes,bodyFunc)\n"
+  "local httpd=self.httpd\n"
+  "local mediaType=(headers.contentType or\"\"):match(\"^[^;%s]*\"):lower()\n"
+  "local compressible\n"
+  "for _,pat in ipairs(httpd.compressTypes)do\n"
+  "if mediaType:match(pat)then\n"
+  "compressible=true\n"
+  "break\n"
+  "end\n"
+  "end\n"
+  "if not compressible or headers.contentEncoding then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "varyEncoding(headers)\n"
+  "\n"
+  "if bodyBytes and#bodyBytes<httpd.compressMinSize then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "\n"
+  "local accept=self.ph.headers.acceptEncoding or\"\"\n"
+  "local coding=acceptQ(accept,\"gzip\")>0 and\"gzip\"\n"
+  "or acceptQ(accept,\"deflate\")>0 and\"deflate\"\n"
+  "if not coding then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "local format=coding==\"gzip\"and\"gzip\"or\"zlib\"\n"
+  "local level=httpd.compressLevel\n"
+  "\n"
+  "if bodyBytes then\n"
+  "local data=deflate_c.compress(bodyBytes,format,level)\n"
+  "if#data>=#bodyBytes then\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "bodyBytes=data\n"
+  "else\n"
+  "\n"
+  "local fn=bodyFunc\n"
+  "bodyFunc=function(emit)\n"
+  "local z=deflate_c.new(format,level)\n"
+  "local err\n"
+  "fn(function(data)\n"
+  "if err then\n"
+  "return nil,err\n"
+  "end\n"
+  "data=flatten(data)\n"
+  "if data==\"\"then\n"
+  "return true\n"
+  "end\n"
+  "local ok,e=emit(z:write(data)..z:flush())\n"
+  "err=not ok and(e or\"write failed\")\n"
+  "return ok,e\n"
+  "end)\n"
+  "\n"
+  "if not err then\n"
+  "emit(z:finish())\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "headers.contentEncoding=coding\n"
+  "headers.contentLength=nil\n"
+  "return bodyBytes,bodyFunc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:respond(code,headers,body)\n"
+  "local status\n"
+  "local bodyBytes\n"
+  "local bodyFunc\n"
+  "local chunked\n"
+  "\n"
+  "\n"
+  "\n"
+  "status=httpStatusCodes[code]\n"
+  "if not status then\n"
+  "code=500\n"
+  "status=httpStatusCodes[code]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local isHead=self.ph.method==\"HEAD\"\n"
+  "if code==204\n"
+  "or code==304\n"
+  "or code<=199\n"
+  "then\n"
+  "\n"
+  "elseif type(body)==\"function\"then\n"
+  "if isHead then\n"
+  "\n"
+  "elseif self.ph.version<1 then\n"
+  "self.connClose=true\n"
+  "elseif not self.connClose then\n"
+  "chunked=true\n"
+  "end\n"
+  "bodyFunc=body\n"
+  "else\n"
+  "local err\n"
+  "bodyBytes,err=flatten(body)\n"
+  "if err then\n"
+  "self:warn(err)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if type(headers)~=\"table\"then\n"
+  "self:warn(\"headers is not a table\")\n"
+  "headers={}\n"
+  "else\n"
+  "headers=clone(headers)\n"
+  "end\n"
+  "\n"
+  "if self.httpd.compress and(bodyBytes or bodyFunc)then\n"
+  "bodyBytes,bodyFunc=self:compressBody(headers,bodyBytes,bodyFunc)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "if isHead then\n"
+  "bodyBytes,bodyFunc=nil,nil\n"
+  "end\n"
+  "\n"
+  "if self.connClose then\n"
+  "headers.connection=\"Close\"\n"
+  "elseif chunked then\n"
+  "headers.transferEncoding=\"chunked\"\n"
+  "headers.contentLength=nil\n"
+  "end\n"
+  "\n"
+  "if bodyBytes and not headers.contentLength then\n"
+  "headers.contentLength=tostring(#bodyBytes)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local responseLines={\n"
+  "\"HTTP/1.1 \"..code..\" \"..status\n"
+  "}\n"
+  "for k,v in pairs(headers)do\n"
+  "insert(responseLines,headerOut[k]..\": \"..v)\n"
+  "end\n"
+  "insert(responseLines,\"\")\n"
+  "insert(responseLines,bodyBytes or\"\")\n"
+  "\n"
+  "local response=concat(responseLines,\"\\r\\n\")\n"
+  "\n"
+  "log(\"S\",response)\n"
+  "local _,responseError=self.socket:write(response)\n"
+  "\n"
+  "if bodyFunc then\n"
+  "\n"
+  "local function emit(data)\n"
+  "if responseError then\n"
+  "return nil,responseError\n"
+  "end\n"
+  "data=flatten(data)\n"
+  "if data==\"\"then\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "if chunked then\n"
+  "data=chunkEncode(data)\n"
+  "end\n"
+  "log(\"S\",data)\n"
+  "local _,err=self.socket:write(data)\n"
+  "if err then\n"
+  "responseError=err\n"
+  "return nil,responseError\n"
+  "end\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "bodyFunc(emit)\n"
+  "if chunked and not responseError then\n"
+  "\n"
+  "log(\"S\",\"0\\r\\n\")\n"
+  "self.socket:write(\"0\\r\\n\\r\\n\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return responseError\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function WDConn:run()\n"
+  "thread.atExit(self.dtor,self)\n"
+  "\n"
+  "local httpd=self.httpd\n"
+  "local headStarted=false\n"
+  "\n"
+  "while true do\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local deadline=timeAfter(headStarted and httpd.headerTimeout\n"
+  "or httpd.idleTimeout)\n"
+  "\n"
+  "while not self.ph:isDone()do\n"
+  "local data,err=self:readUntil(BUFSIZE,deadline)\n"
+  "if data then\n"
+  "log(\"C\",data)\n"
+  "if not headStarted then\n"
+  "headStarted=true\n"
+  "deadline=timeAfter(httpd.headerTimeout)\n"
+  "end\n"
+  "self.ph:takeData(data)\n"
+  "elseif err==\"timeout\"then\n"
+  "log(\"C\",\"<timeout>\")\n"
+  "if headStarted then\n"
+  "self.socket:try_write(closingResponse(408))\n"
+  "end\n"
+  "return\n"
+  "elseif err then\n"
+  "\n"
+  "log(\"C\",\"<error: \"..tostring(err)..\">\")\n"
+  "return\n"
+  "elseif self.ph.data~=\"\"then\n"
+  "\n"
+  "log(\"C\",\"<close after partial request>\")\n"
+  "return\n"
+  "else\n"
+  "\n"
+  "\n"
+  "\n"
+  "log(\"C\",\"<close>\")\n"
+  "return\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local code,headers,body=self:handle()\n"
+  "local err\n"
+  "\n"
+  "if self.expectContinue then\n"
+  "if type(body)==\"function\"then\n"
+  "\n"
+  "err=self:sendContinue()\n"
+  "else\n"
+  "\n"
+  "\n"
+  "self.expectContinue=false\n"
+  "self.connClose=true\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "err=err or self:respond(code,headers,body)\n"
+  "\n"
+  "if self.isActive then\n"
+  "self.isActive=false\n"
+  "httpd.active=httpd.active-1\n"
+  "end\n"
+  "\n"
+  "if err then\n"
+  "log(\"S\",\"<error: \"..tostring(err)..\">\")\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "if self.connClose then\n"
+  "\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local leftovers\n"
+  "\n"
+  "\n"
+  "if self.subStream then\n"
+  "local err=self.subStream:drain()\n"
+  "if err then\n"
+  "\n"
+  "log(\"C\",\"<error: \"..tostring(err)..\">\")\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "leftovers=self.subStream:leftovers()\n"
+  "self.subStream=nil\n"
+  "else\n"
+  "leftovers=self.ph.data\n"
+  "end\n"
+  "\n"
+  "headStarted=leftovers~=\"\"\n"
+  "self.ph:restart()\n"
+  "self.ph:takeData(leftovers)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local HTTPD=Object:new()\n"
+  "\n"
+  "\n"
+  "HTTPD.maxConns=1000\n"
+  "HTTPD.maxActive=false\n"
+  "HTTPD.idleTimeout=60\n"
+  "HTTPD.headerTimeout=20\n"
+  "HTTPD.bodyTimeout=60\n"
+  "HTTPD.compress=false\n"
+  "HTTPD.compressLevel=6\n"
+  "HTTPD.compressMinSize=1024\n"
+  "HTTPD.compressTypes={\n"
+  "\"^text/\",\n"
+  "\"^application/json$\",\n"
+  "\"^application/javascript$\",\n"
+  "\"^application/x%-oweb%-stream$\",\n"
+  "\"[/+]xml$\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "function HTTPD:initialize(addr,options)\n"
+  "for k,v in pairs(options or{})do\n"
+  "self[k]=v\n"
+  "end\n"
+  "self.addr=addr\n"
+  "self.name=\"http://\"..addr:gsub(\"^:\",\"127.0.0.1:\")\n"
+  "self.conns={}\n"
+  "self.numConns=0\n"
+  "self.active=0\n"
+  "self.stats={\n"
+  "accepted=0,\n"
+  "rejected=0,\n"
+  "shed=0,\n"
+  "timedOut=0,\n"
+  "}\n"
+  "self.sock=xpio.socket(\"TCP\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:serve()\n"
+  "local stats=self.stats\n"
+  "while true do\n"
+  "local s,err=self.sock:accept()\n"
+  "if s and self.numConns>=self.maxConns then\n"
+  "\n"
+  "stats.rejected=stats.rejected+1\n"
+  "s:try_write(closingResponse(503,\"Retry-After: 1\\r\\n\"))\n"
+  "s:close()\n"
+  "elseif s then\n"
+  "stats.accepted=stats.accepted+1\n"
+  "\n"
+  "\n"
+  "s:setsockopt(\"TCP_NODELAY\",true)\n"
+  "local conn=WDConn:new(s,self.handler,self)\n"
+  "self.conns[conn]=true\n"
+  "self.numConns=self.numConns+1\n"
+  "elseif err~=\"retry\"then\n"
+  "error(err)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:start(handler)\n"
+  "self.handler=handler\n"
+  "assert(self.sock:setsockopt(\"SO_REUSEADDR\",true))\n"
+  "assert(self.sock:bind(self.addr))\n"
+  "assert(self.sock:listen())\n"
+  "\n"
+  "self.thread=thread.new(self.serve,self)\n"
+  "\n"
+  "thread.setPriority(\"system\",self.thread)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:removeConn(conn)\n"
+  "if self.conns[conn]then\n"
+  "self.conns[conn]=nil\n"
+  "self.numConns=self.numConns-1\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:getAddr()\n"
+  "return self.sock:getsockname()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTTPD:shutDown(timeout)\n"
+  "thread.kill(self.thread)\n"
+  "for conn in pairs(self.conns)do\n"
+  "conn:shutDown(timeout)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTTPD:stop()\n"
+  "self:shutDown(0)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "HTTPD.mimeTypes={\n"
+  "css=\"text/css\",\n"
+  "gif=\"image/gif\",\n"
+  "htm=\"text/html\",\n"
+  "html=\"text/html\",\n"
+  "ico=\"image/x-icon\",\n"
+  "jpeg=\"image/jpeg\",\n"
+  "jpg=\"image/jpeg\",\n"
+  "js=\"application/javascript\",\n"
+  "json=\"application/json\",\n"
+  "lua=\"text/plain\",\n"
+  "png=\"image/png\",\n"
+  "svg=\"image/svg+xml\",\n"
+  "txt=\"text/plain\",\n"
+  "xml=\"application/xml\",\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function readFile(name)\n"
+  "local f=io.open(name,\"rb\")\n"
+  "if f then\n"
+  "local data=f:read(\"*a\")\n"
+  "f:close()\n"
+  "return data\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function fileExists(name)\n"
+  "local f=io.open(name,\"rb\")\n"
+  "if f then\n"
+  "f:close()\n"
+  "return true\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTTPD.fileResponse(request,filename,headers)\n"
+  "headers=clone(headers or{})\n"
+  "if not headers.contentType then\n"
+  "local ext=filename:match(\"%.([^./]*)$\")\n"
+  "headers.contentType=HTTPD.mimeTypes[ext and ext:lower()]\n"
+  "or\"application/octet-stream\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local accept=request.headers.acceptEncoding\n"
+  "local gzipOK=accept and acceptQ(accept,\"gzip\")>0\n"
+  "\n"
+  "local data=gzipOK and readFile(filename..\".gz\")\n"
+  "if data then\n"
+  "headers.contentEncoding=\"gzip\"\n"
+  "varyEncoding(headers)\n"
+  "return 200,headers,data\n"
+  "end\n"
+  "\n"
+  "data=readFile(filename)\n"
+  "local refused=not gzipOK and fileExists(filename..\".gz\")\n"
+  "if data then\n"
+  "if refused then\n"
+  "varyEncoding(headers)\n"
+  "end\n"
+  "return 200,headers,data\n"
+  "elseif refused then\n"
+  "return 406,{contentType=\"text/plain\",vary=\"Accept-Encoding\"},\n"
+  "\"Not acceptable: gzip encoding required\"\n"
+  "end\n"
+  "return 404,{contentType=\"text/plain\"},\"Not found\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "HTTPD.headerIn=headerIn\n"
+  "HTTPD.headerOut=headerOut\n"
+  "\n"
+  "\n"
+  "\n"
+  "HTTPD.PH=PH\n"
+  "HTTPD.PH.pstHDRS=pstHDRS\n"
+  "HTTPD.PH.pstDONE=pstDONE\n"
+  "HTTPD.parseTE=parseTE\n"
+  "HTTPD.parseList=parseList\n"
+  "HTTPD.chunkEncode=chunkEncode\n"
+  "HTTPD.httpStatusCodes=httpStatusCodes\n"
+  "HTTPD.acceptQ=acceptQ\n"
+  "HTTPD.WDConn=WDConn\n"
+  "\n"
+  "\n"
+  "return HTTPD\n"
+  "";
+
+static const unsigned char data3[] = 
+  "\n"
+  "\n"
+  "local Object={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Object:adopt(o)\n"
+  "rawset(self,\"__index\",self)\n"
+  "setmetatable(o,self)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:getParent()\n"
+  "local p=getmetatable(self).__index\n"
+  "return type(p)==\"table\"and p or nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:basicNew()\n"
+  "return self:adopt{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Object:new(...)\n"
+  "local o=self:basicNew()\n"
+  "o:initialize(...)\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "function Object:initialize()\n"
+  "\n"
+  "end\n"
+  "\n"
+  "return Object\n"
+  "";
+
+static const unsigned char data4[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpio=require\"xpio_c\"\n"
+  "local xpfs=require\"xpfs\"\n"
+  "\n"
+  "local yield=coroutine.yield\n"
+  "\n"
+  "local currentTask\n"
+  "\n"
+  "local dirSep=package.config:sub(1,1)\n"
+  "local pathSep=dirSep==\"/\"and\":\"or\";\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Socket=xpio._XPSocket\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:write(data)\n"
+  "local amt=0\n"
+  "while data~=\"\"do\n"
+  "local num,err=self:try_write(data)\n"
+  "if num then\n"
+  "amt=amt+num\n"
+  "data=data:sub(num+1)\n"
+  "elseif err~=\"retry\"then\n"
+  "return nil,err\n"
+  "else\n"
+  "yield(self:when_write(currentTask))\n"
+  "end\n"
+  "end\n"
+  "return amt\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:read(amt)\n"
+  "repeat\n"
+  "local a,b=self:try_read(amt)\n"
+  "if a then\n"
+  "return a\n"
+  "elseif b~=\"retry\"then\n"
+  "return nil,b\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:recvfrom(size)\n"
+  "repeat\n"
+  "local data,addr=self:try_recvfrom(size)\n"
+  "if data then\n"
+  "return data,addr\n"
+  "elseif addr~=\"retry\"then\n"
+  "return nil,addr\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:sendto(data,addr)\n"
+  "repeat\n"
+  "local num,err=self:try_sendto(data,addr)\n"
+  "if num or err~=\"retry\"then\n"
+  "return num,err\n"
+  "end\n"
+  "yield(self:when_write(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:recvmany(count,size)\n"
+  "repeat\n"
+  "local datas,addrs=self:try_recvmany(count,size)\n"
+  "if datas then\n"
+  "return datas,addrs\n"
+  "elseif addrs~=\"retry\"then\n"
+  "return nil,addrs\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Socket:sendmany(datas,addrs)\n"
+  "local sent=0\n"
+  "while sent<#datas do\n"
+  "local num,err=self:try_sendmany(datas,addrs,sent+1)\n"
+  "if num then\n"
+  "sent=sent+num\n"
+  "elseif err~=\"retry\"then\n"
+  "return nil,err\n"
+  "else\n"
+  "yield(self:when_write(currentTask))\n"
+  "end\n"
+  "end\n"
+  "return sent\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:connect(...)\n"
+  "repeat\n"
+  "local succ,err=self:try_connect(...)\n"
+  "if succ or err~=\"retry\"then\n"
+  "return succ,err\n"
+  "end\n"
+  "yield(self:when_write(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Socket:accept()\n"
+  "repeat\n"
+  "local s,err=self:try_accept()\n"
+  "if s then\n"
+  "return s\n"
+  "end\n"
+  "if err~=\"retry\"then\n"
+  "return nil,err\n"
+  "end\n"
+  "yield(self:when_read(currentTask))\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Process=xpio._XPProc\n"
+  "\n"
+  "\n"
+  "function Process:wait()\n"
+  "repeat\n"
+  "local a,b=self:try_wait()\n"
+  "if a==nil and b==\"retry\"then\n"
+  "yield(self:when_wait(currentTask))\n"
+  "else\n"
+  "return a,b\n"
+  "end\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function xpio.setCurrentTask(task)\n"
+  "currentTask=task\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function xpio.getCurrentTask(task)\n"
+  "return currentTask\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function fdjuggle(_fdmap,nextfd)\n"
+  "local o={}\n"
+  "\n"
+  "local function dup2(from,to)\n"
+  "o[#o+1]={to,from}\n"
+  "end\n"
+  "\n"
+  "local function close(fd)\n"
+  "o[#o+1]={fd}\n"
+  "end\n"
+  "\n"
+  "local to={}\n"
+  "local from={}\n"
+  "for dest,src in pairs(_fdmap)do\n"
+  "src=tonumber(src)or src:fileno()\n"
+  "to[dest]=src\n"
+  "from[src]=true\n"
+  "end\n"
+  "\n"
+  "local newnames={}\n"
+  "local tmpfd\n"
+  "\n"
+  "local function dupChain(a,b)\n"
+  "if not b then\n"
+  "close(a)\n"
+  "elseif newnames[b]then\n"
+  "\n"
+  "dup2(newnames[b],a)\n"
+  "else\n"
+  "\n"
+  "dup2(b,a)\n"
+  "newnames[b]=a\n"
+  "return dupChain(b,to[b])\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for a in nextfd do\n"
+  "if not to[a]and not from[a]then\n"
+  "close(a)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for a,b in pairs(to)do\n"
+  "if not from[a]then\n"
+  "dupChain(a,b)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for a,b in pairs(to)do\n"
+  "if a==b then\n"
+  "dup2(a,b)\n"
+  "elseif from[a]and not newnames[a]then\n"
+  "if not tmpfd then\n"
+  "tmpfd=0\n"
+  "while to[tmpfd]do\n"
+  "tmpfd=tmpfd+1\n"
+  "end\n"
+  "end\n"
+  "dupChain(tmpfd,a)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "if tmpfd then\n"
+  "close(tmpfd)\n"
+  "end\n"
+  "\n"
+  "return o\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function searchPath(file)\n"
+  "local path=os.getenv(\"PATH\")or\"\"\n"
+  "for dir in(path..pathSep):gmatch(\"(.-):\")do\n"
+  "if dir==\"\"then\n"
+  "dir=\".\"\n"
+  "end\n"
+  "local path=dir..dirSep..file\n"
+  "\n"
+  "\n"
+  "\n"
+  "local stat=xpfs.stat(path,\"pk\")\n"
+  "if stat and stat.kind==\"f\"and stat.perm:match(\"x\")then\n"
+  "return path\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function xpio.spawn(args,env,files,attrs)\n"
+  "local file=assert(attrs and attrs.exe or args[1],\"spawn: file not provided\")\n"
+  "\n"
+  "if not file:match(dirSep)then\n"
+  "file=assert(searchPath(file),\"file not found in PATH: \"..file)\n"
+  "end\n"
+  "\n"
+  "local fdActions=fdjuggle(files,xpio._nextfd)\n"
+  "\n"
+  "local envStrings={}\n"
+  "\n"
+  "for k,v in pairs(env)do\n"
+  "envStrings[#envStrings+1]=k..\"=\"..v\n"
+  "end\n"
+  "\n"
+  "local proc=xpio._spawn(file,args,envStrings,fdActions)\n"
+  "\n"
+  "\n"
+  "for _,socket in pairs(files)do\n"
+  "if type(socket)==\"userdata\"then\n"
+  "socket:close()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return proc\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "xpio._fdjuggle=fdjuggle\n"
+  "xpio._searchPath=searchPath\n"
+  "\n"
+  "return xpio\n"
+  "";
+
+extern int luaopen_xpio_c(lua_State *);
+
+extern int luaopen_xpfs(lua_State *);
+
+static const unsigned char data5[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function hexToByte(s)\n"
+  "return string.char(tonumber(s,16))\n"
+  "end\n"
+  "\n"
+  "local function byteToHex(ch)\n"
+  "return string.format(\"%%%02X\",string.byte(ch))\n"
+  "end\n"
+  "\n"
+  "local function pctDecode(s)\n"
+  "return(s:gsub(\"%%(%x%x)\",hexToByte))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function paramDecode(s)\n"
+  "return pctDecode(s:gsub(\"%+\",\" \"))\n"
+  "end\n"
+  "\n"
+  "local function paramEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~ ])\",byteToHex):gsub(\" \",\"+\"))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local pathDecode=pctDecode\n"
+  "\n"
+  "local function pathEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~/%+])\",byteToHex))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local authorityDecode=pctDecode\n"
+  "\n"
+  "local function authorityEncode(s)\n"
+  "return(s:gsub(\"([^%w%!%(%)%*%-%._~:%+])\",byteToHex))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function schemeNorm(s)\n"
+  "if s:match(\"^[%w%+%-%.]+$\")then\n"
+  "return s:lower()\n"
+  "end\n"
+  "error(\"URI handling: Invalid scheme\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parseParams(str)\n"
+  "local t={}\n"
+  "if str then\n"
+  "for fld in str:gmatch(\"[^&;]+\")do\n"
+  "local k,v=fld:match(\"([^=]*)=(.*)\")\n"
+  "if k then\n"
+  "t[paramDecode(k)]=paramDecode(v)\n"
+  "elseif fld~=\"\"then\n"
+  "table.insert(t,paramDecode(fld))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local luaImpl={\n"
+  "pctDecode=pctDecode,\n"
+  "paramDecode=paramDecode,\n"
+  "paramEncode=paramEncode,\n"
+  "pathEncode=pathEncode,\n"
+  "authorityEncode=authorityEncode,\n"
+  "parseParams=parseParams,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "if succ then\n"
+  "pctDecode=textcodec_c.pctDecode\n"
+  "paramDecode=textcodec_c.paramDecode\n"
+  "paramEncode=textcodec_c.paramEncode\n"
+  "pathEncode=textcodec_c.pathEncode\n"
+  "authorityEncode=textcodec_c.authorityEncode\n"
+  "parseParams=textcodec_c.parseParams\n"
+  "pathDecode=pctDecode\n"
+  "authorityDecode=pctDecode\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function makeParams(t)\n"
+  "if not t or not next(t)then\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "local a={}\n"
+  "for n,v in ipairs(t)do\n"
+  "if type(v)==\"string\"and v~=\"\"then\n"
+  "table.insert(a,paramEncode(v))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local map={}\n"
+  "for k,v in pairs(t)do\n"
+  "if type(k)==\"string\"and type(v)==\"string\"then\n"
+  "table.insert(map,paramEncode(k)..\"=\"..paramEncode(tostring(v)))\n"
+  "end\n"
+  "end\n"
+  "if map[1]then\n"
+  "table.sort(map)\n"
+  "table.insert(a,table.concat(map,\";\"))\n"
+  "end\n"
+  "\n"
+  "return table.concat(a,\";\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriToString(t)\n"
+  "if type(t)==\"string\"then return t end\n"
+  "if type(t)~=\"table\"then error(\"uri handling: Invalid type for URI: \"..type(t))end\n"
+  "\n"
+  "local query=t.params\n"
+  "if type(query)==\"table\"then\n"
+  "query=makeParams(query)\n"
+  "end\n"
+  "local path=t.path or\"\"\n"
+  "\n"
+  "return(t.scheme and schemeNorm(t.scheme)..\":\"or\"\")\n"
+  "..(t.authority and\"//\"..authorityEncode(t.authority)or\"\")\n"
+  "..((t.authority and path:sub(1,1)~=\"/\")and\"/\"or\"\")\n"
+  "..pathEncode(path)\n"
+  "..(t.version and\"@\"..paramEncode(t.version)or\"\")\n"
+  "..(query and\"\?\"..query or\"\")\n"
+  "..(t.fragment and\"#\"..paramEncode(t.fragment)or\"\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function uriToTable(uri)\n"
+  "if not uri then return{}end\n"
+  "if type(uri)==\"table\"then return uri end\n"
+  "if type(uri)~=\"string\"then error(\"Invalid type for URI: \"..type(uri))end\n"
+  "\n"
+  "local s,h,p,v,q,u,f\n"
+  "\n"
+  "s,u=uri:match(\"^([%w%+%-%.]+)%:(.*)\")\n"
+  "uri=u or uri\n"
+  "h,u=uri:match(\"^//([^/]*)(.*)\")\n"
+  "p,uri=(u or uri):match(\"^([^@%\?#]*)(.*)\")\n"
+  "v,u=uri:match(\"@([^%\?#]*)(.*)\")\n"
+  "uri=u or uri\n"
+  "q,u=uri:match(\"^%\?([^#]*)(.*)\")\n"
+  "uri=u or uri\n"
+  "f=uri:match(\"^#(.*)\")\n"
+  "\n"
+  "return{\n"
+  "scheme=s,\n"
+  "authority=h and authorityDecode(h),\n"
+  "path=pathDecode(p),\n"
+  "version=v and paramDecode(v),\n"
+  "params=q and parseParams(q),\n"
+  "fragment=f and paramDecode(f)\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function dir(str,pos)\n"
+  "while pos>0 and str:sub(pos,pos)~=\"/\"do\n"
+  "pos=pos-1\n"
+  "end\n"
+  "return str:sub(1,pos),pos\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function cleanPath(path)\n"
+  "local n,e,post=1\n"
+  "repeat\n"
+  "n,e,post=path:match(\"/()(%.%.\?)([^/]\?)\",n)\n"
+  "if n and post==\"\"then\n"
+  "if e==\".\"then\n"
+  "path=path:sub(1,n-1)..path:sub(n+2)\n"
+  "else\n"
+  "local pre,a=dir(path,n-2)\n"
+  "local parent=path:sub(a+1,n-2)\n"
+  "if parent~=\"..\"then\n"
+  "if parent==\"\"then pre=pre..\"/\"end\n"
+  "path=pre..path:sub(n+3)\n"
+  "n=a\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "until not n\n"
+  "\n"
+  "return path\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function resolve(r,b)\n"
+  "r=uriToTable(r)\n"
+  "b=uriToTable(b)\n"
+  "\n"
+  "local path,pb=r.path or\"\",b.path or\"\"\n"
+  "if r.scheme then\n"
+  "\n"
+  "elseif path==\"\"then\n"
+  "path=pb\n"
+  "elseif path:sub(1,1)~=\"/\"then\n"
+  "path=dir(pb,#pb)..path\n"
+  "end\n"
+  "path=cleanPath(path)\n"
+  "\n"
+  "return{\n"
+  "scheme=r.scheme or b.scheme,\n"
+  "authority=r.authority or(not r.scheme and b.authority or nil),\n"
+  "path=path,\n"
+  "version=r.version or b.version,\n"
+  "params=r.params,\n"
+  "fragment=r.fragment\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function parse(uri,base)\n"
+  "if base then\n"
+  "uri=resolve(uri,base)\n"
+  "end\n"
+  "return uriToTable(uri)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gen(uri,base)\n"
+  "if base then\n"
+  "uri=resolve(uri,base)\n"
+  "end\n"
+  "return uriToString(uriToTable(uri))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "parse=parse,\n"
+  "gen=gen,\n"
+  "cleanPath=cleanPath,\n"
+  "byteToHex=byteToHex,\n"
+  "pctDecode=pctDecode,\n"
+  "paramDecode=paramDecode,\n"
+  "isNative=succ,\n"
+  "_lua=luaImpl,\n"
+  "}\n"
+  "";
+
+extern int luaopen_textcodec_c(lua_State *);
+
+static const unsigned char data6[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local xpio=require\"xpio\"\n"
+  "local Heap=require\"heap\"\n"
+  "local Queue=require\"queue\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function undoPack(t)\n"
+  "return table.unpack(t,1,t.n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local thread={}\n"
+  "\n"
+  "\n"
+  "local currentTask\n"
+  "\n"
+  "\n"
+  "\n"
+  "local classNames={\"system\",\"interactive\",\"batch\"}\n"
+  "local classIndex={system=1,interactive=2,batch=3}\n"
+  "local defaultClass=classIndex.interactive\n"
+  "\n"
+  "\n"
+  "thread.budget={\n"
+  "interactive=0.05,\n"
+  "batch=0.01,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local function taskAtExit(me,fn,...)\n"
+  "local id=table.pack(fn,...)\n"
+  "table.insert(me.atExits,id)\n"
+  "return id\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function taskCancelAtExit(me,id)\n"
+  "for n=#me.atExits,1,-1 do\n"
+  "if id==me.atExits[n]then\n"
+  "table.remove(me.atExits,n)\n"
+  "return true\n"
+  "end\n"
+  "end\n"
+  "return nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function taskRunAtExits(me)\n"
+  "while true do\n"
+  "local oe=table.remove(me.atExits)\n"
+  "if not oe then return end\n"
+  "oe[1](table.unpack(oe,2,oe.n))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function taskDelete(me)\n"
+  "if me._dequeue then\n"
+  "me:_dequeue()\n"
+  "end\n"
+  "taskRunAtExits(me)\n"
+  "me.dispatch.all[me]=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "thread.Task={}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function taskNew(dispatch,fn,...)\n"
+  "local fargs=table.pack(...)\n"
+  "local me=setmetatable({},thread.Task)\n"
+  "\n"
+  "local function preamble()\n"
+  "me.results=table.pack(xpcall(fn,debug.traceback,undoPack(fargs)))\n"
+  "me.failed=not table.remove(me.results,1)\n"
+  "me.results.n=me.results.n-1\n"
+  "if me.failed then\n"
+  "dispatch.all[me]=nil\n"
+  "end\n"
+  "taskDelete(me)\n"
+  "end\n"
+  "\n"
+  "me.coroutine=coroutine.create(preamble)\n"
+  "me.dispatch=dispatch\n"
+  "me.atExits={}\n"
+  "me._queue=dispatch._queue\n"
+  "me.makeReady=dispatch.makeReady\n"
+  "\n"
+  "\n"
+  "me.priority=currentTask and currentTask.priority or defaultClass\n"
+  "\n"
+  "\n"
+  "me.runs=0\n"
+  "me.runTime=0\n"
+  "me.maxRun=0\n"
+  "\n"
+  "me:makeReady()\n"
+  "dispatch.all[me]=true\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.new(fn,...)\n"
+  "return taskNew(currentTask.dispatch,fn,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.yield()\n"
+  "currentTask:makeReady()\n"
+  "coroutine.yield()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joinWake(task)\n"
+  "task._dequeue=nil\n"
+  "task._dequeueTask=nil\n"
+  "task._dequeueID=nil\n"
+  "task:makeReady()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function joinDequeue(task)\n"
+  "taskCancelAtExit(task._dequeueTask,task._dequeueID)\n"
+  "task._dequeue=nil\n"
+  "task._dequeueTask=nil\n"
+  "task._dequeueID=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.join(task)\n"
+  "if not task.results then\n"
+  "local id=taskAtExit(task,joinWake,currentTask)\n"
+  "currentTask._dequeue=joinDequeue\n"
+  "currentTask._dequeueTask=task\n"
+  "currentTask._dequeueID=id\n"
+  "coroutine.yield()\n"
+  "end\n"
+  "if task.failed then\n"
+  "error(task.results[1],0)\n"
+  "else\n"
+  "return undoPack(task.results)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.atExit(fn,...)\n"
+  "return taskAtExit(currentTask,fn,...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.cancelAtExit(id)\n"
+  "return taskCancelAtExit(currentTask,id)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.kill(task)\n"
+  "if not task.results then\n"
+  "task.results=table.pack(nil,\"killed\")\n"
+  "taskDelete(task)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.setPriority(class,task)\n"
+  "local c=classIndex[class]\n"
+  "if not c then\n"
+  "error(\"thread.setPriority: invalid class: \"..tostring(class),2)\n"
+  "end\n"
+  "task=task or currentTask\n"
+  "task.priority=c\n"
+  "if task._dequeue and task._dequeue==task.dispatch.dqQueue then\n"
+  "\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.getPriority(task)\n"
+  "return classNames[(task or currentTask).priority]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.taskStats(task)\n"
+  "task=task or currentTask\n"
+  "return{\n"
+  "priority=classNames[task.priority],\n"
+  "runs=task.runs,\n"
+  "time=task.runTime,\n"
+  "max=task.maxRun,\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function thread.tasks()\n"
+  "local tasks={}\n"
+  "for task in pairs(currentTask.dispatch.all)do\n"
+  "tasks[#tasks+1]=task\n"
+  "end\n"
+  "return tasks\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "thread.gc={\n"
+  "mode=\"incremental\",\n"
+  "budget=0.002,\n"
+  "stepSize=8,\n"
+  "threshold=1.5,\n"
+  "limit=4,\n"
+  "clock=xpio.gettime,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local dispatchDepth=0\n"
+  "local gcMode\n"
+  "\n"
+  "\n"
+  "local function gcEnter()\n"
+  "dispatchDepth=dispatchDepth+1\n"
+  "if dispatchDepth==1 then\n"
+  "gcMode=thread.gc.mode\n"
+  "if gcMode==\"generational\"then\n"
+  "collectgarbage(\"generational\")\n"
+  "elseif gcMode==\"idle\"then\n"
+  "collectgarbage(\"stop\")\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function gcLeave()\n"
+  "dispatchDepth=dispatchDepth-1\n"
+  "if dispatchDepth==0 then\n"
+  "if gcMode==\"generational\"then\n"
+  "collectgarbage(\"incremental\")\n"
+  "elseif gcMode==\"idle\"then\n"
+  "collectgarbage(\"restart\")\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gcSlice(stats,budget,tStart)\n"
+  "local cfg=thread.gc\n"
+  "local tEnd=tStart+budget\n"
+  "local t\n"
+  "repeat\n"
+  "stats.steps=stats.steps+1\n"
+  "if collectgarbage(\"step\",cfg.stepSize)then\n"
+  "stats.cycles=stats.cycles+1\n"
+  "stats.active=false\n"
+  "stats.base=collectgarbage(\"count\")\n"
+  "t=cfg.clock()\n"
+  "break\n"
+  "end\n"
+  "t=cfg.clock()\n"
+  "until t>=tEnd\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local _=string.rep(\" \",4096)\n"
+  "\n"
+  "local elapsed=t-tStart\n"
+  "stats.slices=stats.slices+1\n"
+  "stats.time=stats.time+elapsed\n"
+  "if elapsed>stats.max then\n"
+  "stats.max=elapsed\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gcIdle(stats,timeout)\n"
+  "local cfg=thread.gc\n"
+  "local budget=math.min(cfg.budget,timeout or math.huge)\n"
+  "if budget<=0 then\n"
+  "return\n"
+  "end\n"
+  "if not stats.active then\n"
+  "\n"
+  "\n"
+  "local kb=collectgarbage(\"count\")\n"
+  "if kb<stats.base*cfg.threshold then\n"
+  "stats.base=math.min(stats.base,kb)\n"
+  "return\n"
+  "end\n"
+  "stats.active=true\n"
+  "end\n"
+  "gcSlice(stats,budget,cfg.clock())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function gcCheckLimit(stats)\n"
+  "local cfg=thread.gc\n"
+  "if gcMode==\"idle\"and collectgarbage(\"count\")>stats.base*cfg.limit then\n"
+  "stats.forced=stats.forced+1\n"
+  "stats.active=true\n"
+  "gcSlice(stats,cfg.budget,cfg.clock())\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newDispatch()\n"
+  "local me={}\n"
+  "local ready={}\n"
+  "local sleepers=Heap:new()\n"
+  "local tq=xpio.tqueue()\n"
+  "\n"
+  "for c=1,#classNames do\n"
+  "ready[c]=Queue:new()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local iteration=0\n"
+  "\n"
+  "me.all={}\n"
+  "\n"
+  "me._queue=tq\n"
+  "\n"
+  "\n"
+  "me.gcStats={\n"
+  "slices=0,steps=0,forced=0,cycles=0,time=0,max=0,\n"
+  "active=false,base=collectgarbage(\"count\")\n"
+  "}\n"
+  "\n"
+  "local function dqQueue(task)\n"
+  "task._dequeuedata:remove(task)\n"
+  "task._dequeuedata=nil\n"
+  "task._dequeue=nil\n"
+  "end\n"
+  "\n"
+  "me.dqQueue=dqQueue\n"
+  "\n"
+  "function me.makeReady(task)\n"
+  "assert(not task._dequeue)\n"
+  "local q=ready[task.priority]\n"
+  "task._dequeue=dqQueue\n"
+  "task._dequeuedata=q\n"
+  "task._readyIteration=iteration\n"
+  "q:put(task)\n"
+  "end\n"
+  "\n"
+  "local function anyReady()\n"
+  "for c=1,#ready do\n"
+  "if ready[c]:first()then\n"
+  "return true\n"
+  "end\n"
+  "end\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "local function dqSleeper(task)\n"
+  "sleepers:remove(task)\n"
+  "task._dequeue=nil\n"
+  "end\n"
+  "\n"
+  "function me.wakeAt(task,timeDue)\n"
+  "assert(not task._dequeue)\n"
+  "task._dequeue=dqSleeper\n"
+  "task.timeDue=timeDue\n"
+  "sleepers:put(task,timeDue)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function me:dtor()\n"
+  "for c=1,#ready do\n"
+  "while true do\n"
+  "local t=ready[c]:first()\n"
+  "if not t then break end\n"
+  "taskDelete(t)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function runQueue(q,budget,tStart)\n"
+  "local t0=tStart\n"
+  "local count=0\n"
+  "while true do\n"
+  "local task=q:first()\n"
+  "if not task or task._readyIteration>=iteration\n"
+  "or budget and count>0 and t0-tStart>=budget\n"
+  "then\n"
+  "return t0\n"
+  "end\n"
+  "count=count+1\n"
+  "\n"
+  "\n"
+  "q:get()\n"
+  "task._dequeuedata=nil\n"
+  "task._dequeue=nil\n"
+  "\n"
+  "currentTask=task\n"
+  "xpio.setCurrentTask(task)\n"
+  "\n"
+  "local succ,err=coroutine.resume(task.coroutine)\n"
+  "\n"
+  "local t1=xpio.gettime()\n"
+  "local elapsed=t1-t0\n"
+  "task.runs=task.runs+1\n"
+  "task.runTime=task.runTime+elapsed\n"
+  "if elapsed>task.maxRun then\n"
+  "task.maxRun=elapsed\n"
+  "end\n"
+  "t0=t1\n"
+  "\n"
+  "if not succ then\n"
+  "gcLeave()\n"
+  "me:dtor()\n"
+  "local msg=(\"*** Uncaught error in thread:\\n\\t\"..tostring(err)):gsub(\"\\n(.)\",\"\\n | %1\")\n"
+  "error(msg,0)\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function me:dispatch()\n"
+  "local thisTask=currentTask\n"
+  "local gcStats=me.gcStats\n"
+  "local budget=thread.budget\n"
+  "\n"
+  "gcEnter()\n"
+  "\n"
+  "while true do\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "iteration=iteration+1\n"
+  "local t=xpio.gettime()\n"
+  "for c=1,#ready do\n"
+  "local q=ready[c]\n"
+  "if q:first()then\n"
+  "\n"
+  "t=runQueue(q,budget[classNames[c]],t)\n"
+  "end\n"
+  "end\n"
+  "currentTask=nil\n"
+  "xpio.setCurrentTask(nil)\n"
+  "\n"
+  "gcCheckLimit(gcStats)\n"
+  "\n"
+  "local s=sleepers:first()\n"
+  "local timeout=anyReady()and 0 or s and s.timeDue-xpio.gettime()\n"
+  "if timeout~=0 and(s or not tq:isEmpty())then\n"
+  "\n"
+  "gcIdle(gcStats,timeout)\n"
+  "timeout=s and math.max(0,s.timeDue-xpio.gettime())\n"
+  "end\n"
+  "local tasks=tq:wait(timeout)\n"
+  "\n"
+  "\n"
+  "\n"
+  "if tasks then\n"
+  "for _,task in ipairs(tasks)do\n"
+  "task:makeReady()\n"
+  "end\n"
+  "elseif not anyReady()then\n"
+  "\n"
+  "break\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local tNow=xpio.gettime()\n"
+  "while true do\n"
+  "local task=sleepers:first()\n"
+  "if not task or task.timeDue>tNow then\n"
+  "break\n"
+  "end\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "gcLeave()\n"
+  "currentTask=thisTask\n"
+  "xpio.setCurrentTask(currentTask)\n"
+  "end\n"
+  "\n"
+  "return me\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.dispatch(func,...)\n"
+  "local me=newDispatch()\n"
+  "local t=taskNew(me,func,...)\n"
+  "me:dispatch()\n"
+  "me:dtor()\n"
+  "if t.failed then\n"
+  "error(t.results[1],0)\n"
+  "end\n"
+  "\n"
+  "for task in pairs(me.all)do\n"
+  "print(\"*** Dangling thread:\")\n"
+  "print(debug.traceback(task.coroutine))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.gcStats()\n"
+  "local stats=currentTask.dispatch.gcStats\n"
+  "return{\n"
+  "slices=stats.slices,\n"
+  "steps=stats.steps,\n"
+  "forced=stats.forced,\n"
+  "cycles=stats.cycles,\n"
+  "time=stats.time,\n"
+  "max=stats.max,\n"
+  "mean=stats.slices>0 and stats.time/stats.slices or 0,\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.sleepUntil(t)\n"
+  "currentTask.dispatch.wakeAt(currentTask,t)\n"
+  "coroutine.yield()\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function thread.sleep(delay)\n"
+  "thread.sleepUntil(delay+xpio.gettime())\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Timer={}\n"
+  "Timer.__index=Timer\n"
+  "\n"
+  "function Timer:makeReady()\n"
+  "local task=self.task\n"
+  "if task._dequeue==self.dequeue then\n"
+  "self.expired=true\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function thread.waitUntil(timeDue,when,obj)\n"
+  "local task=currentTask\n"
+  "when(obj,task)\n"
+  "if not timeDue then\n"
+  "coroutine.yield()\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "local ioDequeue=task._dequeue\n"
+  "local timer=setmetatable({task=task},Timer)\n"
+  "\n"
+  "\n"
+  "function timer.dequeue(t)\n"
+  "ioDequeue(t)\n"
+  "if timer._dequeue then\n"
+  "timer:_dequeue()\n"
+  "end\n"
+  "end\n"
+  "task._dequeue=timer.dequeue\n"
+  "\n"
+  "task.dispatch.wakeAt(timer,timeDue)\n"
+  "coroutine.yield()\n"
+  "if timer._dequeue then\n"
+  "timer:_dequeue()\n"
+  "end\n"
+  "return not timer.expired\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Waiter={}\n"
+  "Waiter.__index=Waiter\n"
+  "\n"
+  "function Waiter:makeReady()\n"
+  "local task=self.task\n"
+  "if task._dequeue==self.dequeue then\n"
+  "self.result.index=self.index\n"
+  "task:_dequeue()\n"
+  "task:makeReady()\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function thread.waitAny(timeDue,whens)\n"
+  "local task=currentTask\n"
+  "local waiters={}\n"
+  "local result={}\n"
+  "\n"
+  "local function dequeue(t)\n"
+  "t._dequeue=nil\n"
+  "for _,w in ipairs(waiters)do\n"
+  "if w._dequeue then\n"
+  "w:_dequeue()\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local function newWaiter(index)\n"
+  "local w=setmetatable({task=task,result=result,index=index,\n"
+  "dequeue=dequeue,_queue=task._queue},\n"
+  "Waiter)\n"
+  "waiters[#waiters+1]=w\n"
+  "return w\n"
+  "end\n"
+  "\n"
+  "for ndx,pair in ipairs(whens)do\n"
+  "pair[1](pair[2],newWaiter(ndx))\n"
+  "end\n"
+  "if timeDue then\n"
+  "task.dispatch.wakeAt(newWaiter(nil),timeDue)\n"
+  "end\n"
+  "\n"
+  "task._dequeue=dequeue\n"
+  "coroutine.yield()\n"
+  "return result.index\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return thread\n"
+  "";
+
+static const unsigned char data7[] = 
+  "local Object=require\"object\"\n"
+  "\n"
+  "local Heap=Object:new()\n"
+  "\n"
+  "\n"
+  "function Heap:initialize()\n"
+  "end\n"
+  "\n"
+  "function Heap:put(obj,value)\n"
+  "table.insert(self,{obj=obj,value=value})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Heap:minPos()\n"
+  "if#self>0 then\n"
+  "local minpos=1\n"
+  "local minvalue=self[minpos].value\n"
+  "for n=2,#self do\n"
+  "if self[n].value<minvalue then\n"
+  "minpos=n\n"
+  "minvalue=self[minpos].value\n"
+  "end\n"
+  "end\n"
+  "return minpos\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Heap:first()\n"
+  "local n=self:minPos()\n"
+  "if n then\n"
+  "return self[n].obj\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Heap:get()\n"
+  "local n=self:minPos()\n"
+  "if n then\n"
+  "local obj=self[n].obj\n"
+  "table.remove(self,n)\n"
+  "return obj\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Heap:remove(obj)\n"
+  "for n=1,#self do\n"
+  "if rawequal(self[n].obj,obj)then\n"
+  "table.remove(self,n)\n"
+  "return obj\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Heap\n"
+  "";
+
+static const unsigned char data8[] = 
+  "local Object=require\"object\"\n"
+  "\n"
+  "local Queue=Object:new()\n"
+  "\n"
+  "\n"
+  "function Queue:initialize()\n"
+  "\n"
+  "self.a=1\n"
+  "self.b=1\n"
+  "self.q={}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Queue:put(value)\n"
+  "local b,q=self.b,self.q\n"
+  "\n"
+  "q[b]=value\n"
+  "self.b=b+1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function Queue:get()\n"
+  "local a,b,q=self.a,self.b,self.q\n"
+  "\n"
+  "if a<b then\n"
+  "local value=q[a]\n"
+  "q[a]=nil\n"
+  "self.a=a+1\n"
+  "return value\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:first()\n"
+  "return self.q[self.a]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:prepend(value)\n"
+  "local a,q=self.a,self.q\n"
+  "\n"
+  "a=a-1\n"
+  "q[a]=value\n"
+  "self.a=a\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:remove(value)\n"
+  "local a,b,q=self.a,self.b,self.q\n"
+  "\n"
+  "\n"
+  "if a<b and q[a]==value then\n"
+  "q[a]=nil\n"
+  "self.a=a+1\n"
+  "return value\n"
+  "end\n"
+  "\n"
+  "for n=a,b-1 do\n"
+  "if value==q[n]then\n"
+  "for i=n,b-2 do\n"
+  "q[i]=q[i+1]\n"
+  "end\n"
+  "q[b-1]=nil\n"
+  "self.b=b-1\n"
+  "return value\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Queue:length()\n"
+  "return self.b-self.a\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return Queue\n"
+  "";
+
+static const unsigned char data9[] = 
+  "local Object=require\"object\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local SubStream=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:initialize(parent,readAhead,limit)\n"
+  "self.readAhead=readAhead or\"\"\n"
+  "self.parent=parent\n"
+  "self.limit=limit\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function SubStream:read(amt)\n"
+  "if amt<=0 then\n"
+  "assert(amt==0)\n"
+  "\n"
+  "return\"\"\n"
+  "elseif amt>self.limit then\n"
+  "amt=self.limit\n"
+  "if amt==0 then\n"
+  "\n"
+  "return nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local data,err\n"
+  "local ra=self.readAhead\n"
+  "if ra~=\"\"then\n"
+  "self.readAhead=ra:sub(amt+1)\n"
+  "data=ra:sub(1,amt)\n"
+  "else\n"
+  "data,err=self.parent:read(amt)\n"
+  "end\n"
+  "\n"
+  "if data then\n"
+  "self.limit=self.limit-#data\n"
+  "return data\n"
+  "end\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:drain()\n"
+  "repeat\n"
+  "local data,err=self:read(4096)\n"
+  "if data==nil then\n"
+  "return err\n"
+  "end\n"
+  "until false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:leftovers()\n"
+  "return self.readAhead:sub(self.limit+1)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function SubStream:readable(task)\n"
+  "if self.readAhead~=\"\"or self.limit==0 then\n"
+  "return task:ready()\n"
+  "end\n"
+  "return self.parent:readable(task)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function SubStream:close(task)\n"
+  "self.limit=0\n"
+  "self.parent=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return SubStream\n"
+  "";
+
+static const unsigned char data10[] = 
+  "local Object=require\"object\"\n"
+  "local BufIO=require\"bufio\"\n"
+  "local SubStream=require\"substream\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ChunkedStream=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "ChunkedStream.LINEMAX=4096\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:initialize(parent,readAhead)\n"
+  "self.bio=BufIO:new(parent)\n"
+  "self.bio.buf=readAhead or\"\"\n"
+  "self.bio.LINEMAX=self.LINEMAX\n"
+  "self.left=0\n"
+  "self.started=false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function nextChunk(self)\n"
+  "local bio=self.bio\n"
+  "local line,err\n"
+  "if self.started then\n"
+  "\n"
+  "line,err=bio:read(\"*l\")\n"
+  "if line~=\"\"then\n"
+  "return nil,err or\"bad chunk\"\n"
+  "end\n"
+  "end\n"
+  "self.started=true\n"
+  "\n"
+  "line,err=bio:read(\"*l\")\n"
+  "local size=line and line:match(\"^%x+\")\n"
+  "if not size then\n"
+  "return nil,err or\"bad chunk\"\n"
+  "end\n"
+  "self.left=tonumber(size,16)\n"
+  "if self.left>0 then\n"
+  "return false\n"
+  "end\n"
+  "\n"
+  "\n"
+  "repeat\n"
+  "line,err=bio:read(\"*l\")\n"
+  "if not line then\n"
+  "return nil,err or\"bad chunk\"\n"
+  "end\n"
+  "until line==\"\"\n"
+  "return true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:read(amt)\n"
+  "if self.done then\n"
+  "return nil\n"
+  "elseif amt<=0 then\n"
+  "return\"\"\n"
+  "end\n"
+  "\n"
+  "if self.left==0 then\n"
+  "local last,err=nextChunk(self)\n"
+  "if last==nil then\n"
+  "self.done=true\n"
+  "return nil,err\n"
+  "elseif last then\n"
+  "self.done=true\n"
+  "return nil\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local data,err=self.bio:read(amt<self.left and amt or self.left)\n"
+  "if not data then\n"
+  "self.done=true\n"
+  "return nil,err or\"truncated\"\n"
+  "end\n"
+  "self.left=self.left-#data\n"
+  "return data\n"
+  "end\n"
+  "\n"
+  "\n"
+  "ChunkedStream.drain=SubStream.drain\n"
+  "\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:leftovers()\n"
+  "return self.bio.buf\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "function ChunkedStream:close()\n"
+  "self.done=true\n"
+  "self.bio.f=nil\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return ChunkedStream\n"
+  "";
+
+static const unsigned char data11[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "\n"
+  "local concat,insert=table.concat,table.insert\n"
+  "\n"
+  "local BufIO=Object:new()\n"
+  "\n"
+  "\n"
+  "\n"
+  "BufIO.BUFSIZE=16384\n"
+  "\n"
+  "\n"
+  "BufIO.LINEMAX=math.huge\n"
+  "\n"
+  "\n"
+  "BufIO.ALLMAX=10*1000*1000\n"
+  "\n"
+  "\n"
+  "function BufIO:initialize(f)\n"
+  "self.f=f\n"
+  "self.buf=\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readN(self,amount)\n"
+  "if amount<=0 then\n"
+  "return\"\"\n"
+  "end\n"
+  "\n"
+  "local bytes=self.buf\n"
+  "local err\n"
+  "\n"
+  "while bytes==\"\"do\n"
+  "bytes,err=self.f:read(self.BUFSIZE)\n"
+  "if not bytes then\n"
+  "return nil,err\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self.buf=bytes:sub(amount+1)\n"
+  "return bytes:sub(1,amount)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function readAll(self,amount)\n"
+  "local size=0\n"
+  "local all={}\n"
+  "\n"
+  "while amount>size do\n"
+  "local data,err=readN(self,amount-size)\n"
+  "if not data then\n"
+  "if size==0 then\n"
+  "return nil,err\n"
+  "end\n"
+  "break\n"
+  "end\n"
+  "insert(all,data)\n"
+  "size=size+#data\n"
+  "end\n"
+  "\n"
+  "return concat(all)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function readLine(self,retainEnd)\n"
+  "local buf=self.buf\n"
+  "\n"
+  "while true do\n"
+  "local a,b=buf:find(\"\\r\?\\n\")\n"
+  "if a then\n"
+  "self.buf=buf:sub(b+1)\n"
+  "return buf:sub(1,retainEnd and b or a-1)\n"
+  "end\n"
+  "\n"
+  "local more=self.LINEMAX-#buf\n"
+  "if more<=0 then\n"
+  "return nil,\"maximum line length exceeded\"\n"
+  "elseif more>self.BUFSIZE then\n"
+  "more=self.BUFSIZE\n"
+  "end\n"
+  "\n"
+  "local data,err=self.f:read(more)\n"
+  "if not data then\n"
+  "self.buf=buf\n"
+  "return nil,err\n"
+  "end\n"
+  "\n"
+  "buf=buf..data\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function BufIO:read(fmt,amount)\n"
+  "if type(fmt)==\"number\"then\n"
+  "return readN(self,fmt)\n"
+  "elseif fmt==\"=\"then\n"
+  "return readAll(self,amount)\n"
+  "elseif fmt==\"*a\"then\n"
+  "local rv,err=readAll(self,self.ALLMAX)\n"
+  "if err then\n"
+  "return nil,err\n"
+  "end\n"
+  "return rv or\"\"\n"
+  "elseif fmt==\"*l\"or fmt==\"*L\"or fmt==nil then\n"
+  "return readLine(self,fmt==\"*L\")\n"
+  "end\n"
+  "\n"
+  "error(\"bad argument to BufIO:read (invalid format)\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function BufIO:write(...)\n"
+  "return self.f:write(...)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function BufIO:close()\n"
+  "self.f:close()\n"
+  "end\n"
+  "\n"
+  "return BufIO\n"
+  "";
+
+extern int luaopen_deflate_c(lua_State *);
+
+extern int luaopen_lpeg(lua_State *);
+
+static const unsigned char data12[] = 
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local memoize=require\"memoize\"\n"
+  "local htmlgen=require\"htmlgen\"\n"
+  "local lpeg=require\"lpeg\"\n"
+  "local xuri=require\"xuri\"\n"
+  "\n"
+  "\n"
+  "local function merge(t1,t2)\n"
+  "local t={}\n"
+  "for k,v in pairs(t1)do\n"
+  "t[k]=v\n"
+  "end\n"
+  "for k,v in pairs(t2)do\n"
+  "t[k]=v\n"
+  "end\n"
+  "return t\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local globToLPEG\n"
+  "do\n"
+  "local P,R,S=lpeg.P,lpeg.R,lpeg.S\n"
+  "local C,Cc,Ct,Cg,Cf=lpeg.C,lpeg.Cc,lpeg.Ct,lpeg.Cg,lpeg.Cf\n"
+  "\n"
+  "local END=P(-1)\n"
+  "local elem=(P(1)-\"/\")^0\n"
+  "\n"
+  "local function captureName(name)\n"
+  "return Cg(elem,name)\n"
+  "end\n"
+  "\n"
+  "local mpName=P\"{\"*(R(\"az\",\"AZ\",\"09\",\"__\")^1/captureName)*\"}\"\n"
+  "local mpSplat=P\"*\"/function()return Cg(elem)end\n"
+  "local mpRaw=P(1)*(P(1)-S\"{*\")^0/P\n"
+  "local mpPath=(mpName+mpSplat+mpRaw)^0\n"
+  "local mpGlob=Cf(mpPath*Cc(END),function(a,b)return a*b end)/Ct\n"
+  "\n"
+  "function globToLPEG(pat)\n"
+  "return mpGlob:match(pat)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function normalize(status,headers,body)\n"
+  "if not status then\n"
+  "print(\"dino.lua warning: no response values returned\")\n"
+  "status=500\n"
+  "end\n"
+  "\n"
+  "if type(status)~=\"number\"then\n"
+  "status,headers,body=200,status,headers\n"
+  "end\n"
+  "\n"
+  "if not body then\n"
+  "headers,body={},headers\n"
+  "end\n"
+  "\n"
+  "if not headers.contentType then\n"
+  "headers=merge(headers,{contentType=\"text/html\"})\n"
+  "end\n"
+  "\n"
+  "if type(body)==\"table\"then\n"
+  "assert(headers.contentType==\"text/html\")\n"
+  "body=htmlgen.generateDoc(body)\n"
+  "end\n"
+  "\n"
+  "return status,headers,body\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local ROUTES=\" routes \"\n"
+  "local METHOD=\" method \"\n"
+  "\n"
+  "local function addRoute(self,pattern,fn)\n"
+  "assert(type(pattern)==\"string\",\"dino: route pattern expected string\")\n"
+  "assert(type(fn)==\"function\",\"dino: route handler expected function\")\n"
+  "\n"
+  "local routes=self[ROUTES]\n"
+  "local method=self[METHOD]\n"
+  "local lpat\n"
+  "\n"
+  "if pattern:sub(1,1)~=\"^\"then\n"
+  "lpat=globToLPEG(pattern)\n"
+  "end\n"
+  "\n"
+  "routes[#routes+1]={\n"
+  "method=method,\n"
+  "pattern=pattern,\n"
+  "lpat=lpat,\n"
+  "fn=fn\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "local mtMethod={\n"
+  "__newindex=addRoute,\n"
+  "__call=addRoute\n"
+  "}\n"
+  "\n"
+  "local function newMethod(routes,method)\n"
+  "local me={\n"
+  "[ROUTES]=routes,\n"
+  "[METHOD]=method\n"
+  "}\n"
+  "return setmetatable(me,mtMethod)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function addCond(self,fnTest,fnDo)\n"
+  "if type(fnTest)==\"boolean\"then\n"
+  "local b=fnTest\n"
+  "fnTest=function()return b end\n"
+  "end\n"
+  "\n"
+  "assert(type(fnTest)==\"function\",\"dino: when test expected function\")\n"
+  "assert(type(fnDo)==\"function\",\"dino: when handler expected function\")\n"
+  "\n"
+  "local routes=self[ROUTES]\n"
+  "routes[#routes+1]={\n"
+  "condTest=fnTest,\n"
+  "condDo=fnDo\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "local mtCond={\n"
+  "__newindex=addCond,\n"
+  "__call=addCond\n"
+  "}\n"
+  "\n"
+  "local function newCond(routes)\n"
+  "local me={\n"
+  "[ROUTES]=routes\n"
+  "}\n"
+  "return setmetatable(me,mtCond)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Dino=Object:new()\n"
+  "\n"
+  "function Dino:initialize()\n"
+  "self.routes={}\n"
+  "\n"
+  "local function newm(method)\n"
+  "return newMethod(self.routes,method)\n"
+  "end\n"
+  "self.method=memoize.newTable(newm)\n"
+  "\n"
+  "self.when=newCond(self.routes)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function Dino:handle(req)\n"
+  "if req.query then\n"
+  "local turi=xuri.parse(req.query)\n"
+  "req.params=turi.params\n"
+  "end\n"
+  "\n"
+  "local method,path=req.method,req.path\n"
+  "\n"
+  "assert(type(method)==\"string\")\n"
+  "assert(type(path)==\"string\")\n"
+  "\n"
+  "for _,r in ipairs(self.routes)do\n"
+  "if r.condTest then\n"
+  "\n"
+  "if r.condTest(req)then\n"
+  "return r.condDo(req)\n"
+  "end\n"
+  "elseif r.method==method then\n"
+  "\n"
+  "local args\n"
+  "if r.lpat then\n"
+  "local values=r.lpat:match(path)\n"
+  "if values then\n"
+  "args={values,table.unpack(values)}\n"
+  "end\n"
+  "else\n"
+  "local values={string.match(path,r.pattern)}\n"
+  "if values[1]then\n"
+  "args=values\n"
+  "end\n"
+  "end\n"
+  "if args then\n"
+  "return r.fn(req,table.unpack(args))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function Dino:__call(req)\n"
+  "return normalize(self:handle(req))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "Dino.globToLPEG=globToLPEG\n"
+  "\n"
+  "\n"
+  "return Dino\n"
+  "";
+
+static const unsigned char data13[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function callTable(t,k)\n"
+  "return t[k]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newTable(f,weak)\n"
+  "local function index(t,k)\n"
+  "local x=f(k)\n"
+  "t[k]=x\n"
+  "return x\n"
+  "end\n"
+  "return setmetatable({},{__mode=weak,__index=index,__call=callTable})\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local NIL={}\n"
+  "\n"
+  "local combine=newTable(function(f)\n"
+  "return newTable(function(a)\n"
+  "if a==NIL then a=nil end\n"
+  "return function(...)return f(a,...)end\n"
+  "end)\n"
+  "end)\n"
+  "\n"
+  "local function curry(f,...)\n"
+  "for n=1,select('#',...)do\n"
+  "local v=select(n,...)\n"
+  "f=combine[f][v==nil and NIL or v]\n"
+  "end\n"
+  "return f\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function newFunction(f)\n"
+  "local values=newTable(function(f)return table.pack(f())end)\n"
+  "return function(...)\n"
+  "local o=values[curry(f,...)]\n"
+  "return table.unpack(o,1,o.n)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "newTable=newTable,\n"
+  "newFunction=newFunction,\n"
+  "curry=curry\n"
+  "}\n"
+  "";
+
+static const unsigned char data14[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local Object=require\"object\"\n"
+  "local utf8utils=require\"utf8utils\"\n"
+  "local doctree=require\"doctree\"\n"
+  "local opairs=require\"opairs\"\n"
+  "\n"
+  "local insert,concat=table.insert,table.concat\n"
+  "local E,TYPE=doctree.E,doctree.TYPE\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlSubs={\n"
+  "[\"<\"]=\"&lt;\",\n"
+  "[\">\"]=\"&gt;\",\n"
+  "[\"&\"]=\"&amp;\",\n"
+  "['\"']=\"&quot;\"\n"
+  "}\n"
+  "\n"
+  "local function badUTF8(n)\n"
+  "return 0xFFDD;\n"
+  "end\n"
+  "\n"
+  "local function makeCharRef(ch)\n"
+  "return(\"&#%d;\"):format(utf8utils.decode(ch,badUTF8))\n"
+  "end\n"
+  "\n"
+  "local function luaHtmlEscape(str)\n"
+  "return(str:gsub(\"[<>&]\",htmlSubs):gsub(utf8utils.mbpattern,makeCharRef))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local htmlEscape=succ and textcodec_c.htmlEscape or luaHtmlEscape\n"
+  "\n"
+  "local function htmlEscapeAttr(str)\n"
+  "return(str:gsub('[>&\"]',htmlSubs))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function encodeAttrs(node)\n"
+  "local ta={\"\"}\n"
+  "for k,v in opairs(node or{})do\n"
+  "if v and type(k)==\"string\"and k:sub(1,1)~=\"_\"then\n"
+  "local a=k\n"
+  "if v~=true then\n"
+  "a=k..'=\"'..htmlEscapeAttr(tostring(v))..'\"'\n"
+  "end\n"
+  "insert(ta,a)\n"
+  "end\n"
+  "end\n"
+  "return ta[2]and concat(ta,\" \")or\"\"\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsEmpty={\n"
+  "area=true,\n"
+  "base=true,\n"
+  "br=true,\n"
+  "col=true,\n"
+  "hr=true,\n"
+  "img=true,\n"
+  "input=true,\n"
+  "link=true,\n"
+  "meta=true,\n"
+  "param=true,\n"
+  "\n"
+  "command=true,\n"
+  "embed=true,\n"
+  "keygen=true,\n"
+  "source=true,\n"
+  "track=true,\n"
+  "wbr=true,\n"
+  "}\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local elemIsBlock={\n"
+  "address=true,\n"
+  "blockquote=true,\n"
+  "\n"
+  "h1=true,\n"
+  "h2=true,\n"
+  "h3=true,\n"
+  "h4=true,\n"
+  "h5=true,\n"
+  "h6=true,\n"
+  "p=true,\n"
+  "\n"
+  "ol=true,\n"
+  "ul=true,\n"
+  "li=true,\n"
+  "hr=true,\n"
+  "html=true,\n"
+  "body=true,\n"
+  "head=true,\n"
+  "meta=true,\n"
+  "style=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local elemIsCDATA={\n"
+  "style=true,\n"
+  "script=true\n"
+  "}\n"
+  "\n"
+  "\n"
+  "local HTMLGen=Object:new()\n"
+  "\n"
+  "\n"
+  "function HTMLGen:initialize(options)\n"
+  "self.options=options or{}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:warn(node,...)\n"
+  "local warn=self.options.warn\n"
+  "if warn then\n"
+  "warn(node,string.format(...))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:append(str)\n"
+  "insert(self.strings,str)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serializeNode(node)\n"
+  "if type(node)==\"string\"then\n"
+  "self:append(htmlEscape(node))\n"
+  "return\n"
+  "elseif type(node)~=\"table\"then\n"
+  "self:warn(\"Unrecognized node type: %s\",type(node))\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local name=node[TYPE]\n"
+  "\n"
+  "if name and name:sub(1,1)==\"_\"then\n"
+  "\n"
+  "\n"
+  "if name==\"_html\"then\n"
+  "for _,chile in ipairs(node)do\n"
+  "self:append(chile)\n"
+  "end\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local o,c=\"\",\"\"\n"
+  "if name then\n"
+  "local nl=(elemIsBlock[name]and not node._whitespace)and\"\\n\"or\"\"\n"
+  "local attrs=encodeAttrs(node)\n"
+  "o=string.format(\"<%s%s>%s\",name,attrs,nl)\n"
+  "if not(elemIsEmpty[name]or node._isEmpty)then\n"
+  "c=string.format(\"%s</%s>\",nl,name)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(o)\n"
+  "\n"
+  "if elemIsCDATA[name]then\n"
+  "local text=doctree.treeConcat(node)\n"
+  "if text:match(\"</\")then\n"
+  "self:warn(node,\"Invalid content for CDATA element %s: '</'\",name)\n"
+  "\n"
+  "\n"
+  "text=text:gsub(\"</\",\"<\\\\/\")\n"
+  "end\n"
+  "self:append(text)\n"
+  "else\n"
+  "for _,child in ipairs(node)do\n"
+  "self:serializeNode(child)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "self:append(c)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlPreamble=[[\n"
+  "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\" \"http://www.w3.org/TR/html4/loose.dtd\">\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "function HTMLGen:serialize(tree)\n"
+  "assert(self~=HTMLGen)\n"
+  "\n"
+  "self.strings={htmlPreamble}\n"
+  "\n"
+  "self:serializeNode(tree)\n"
+  "self:append(\"\\n\")\n"
+  "return concat(self.strings)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "function HTMLGen:normalize(tree)\n"
+  "local head=E.head{}\n"
+  "local body=E.body{}\n"
+  "local seen={}\n"
+  "local groups={}\n"
+  "\n"
+  "local function appendToHead(child)\n"
+  "if type(child)==\"table\"then\n"
+  "local seenkey=child._once or(child[TYPE]==\"title\"and\"title\")\n"
+  "if seenkey then\n"
+  "if seen[seenkey]then return end\n"
+  "seen[seenkey]=true\n"
+  "end\n"
+  "local group=child._group\n"
+  "if group then\n"
+  "local first=groups[group]\n"
+  "if first then\n"
+  "for _,c in ipairs(child)do\n"
+  "table.insert(first,c)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "first={}\n"
+  "for k,v in pairs(child)do\n"
+  "first[k]=v\n"
+  "end\n"
+  "groups[group]=first\n"
+  "child=first\n"
+  "end\n"
+  "end\n"
+  "table.insert(head,child)\n"
+  "end\n"
+  "\n"
+  "local function visit(node,tbl)\n"
+  "if type(node)~=\"table\"then\n"
+  "table.insert(tbl,node)\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local ty=node[TYPE]\n"
+  "\n"
+  "if ty==\"head\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "appendToHead(child)\n"
+  "end\n"
+  "return\n"
+  "end\n"
+  "\n"
+  "local o=tbl\n"
+  "if ty and ty~=\"html\"and ty~=\"body\"then\n"
+  "\n"
+  "o={}\n"
+  "for k,v in pairs(node)do\n"
+  "if type(k)~=\"number\"then\n"
+  "o[k]=v\n"
+  "end\n"
+  "end\n"
+  "table.insert(tbl,o)\n"
+  "end\n"
+  "\n"
+  "for _,child in ipairs(node)do\n"
+  "visit(child,o)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local charset=self.options.charset\n"
+  "if charset~=false then\n"
+  "if type(charset)~=\"string\"then\n"
+  "charset=\"utf-8\"\n"
+  "end\n"
+  "appendToHead(E.meta{[\"http-equiv\"]=\"Content-Type\",\n"
+  "content=\"text/html;charset=\"..charset})\n"
+  "end\n"
+  "\n"
+  "visit(tree,body)\n"
+  "\n"
+  "appendToHead(E.title{})\n"
+  "\n"
+  "return E.html{\n"
+  "head,body\n"
+  "}\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local htmlgen={}\n"
+  "\n"
+  "function htmlgen.generateDoc(tree,options)\n"
+  "local hg=HTMLGen:new(options)\n"
+  "return hg:serialize(hg:normalize(tree))\n"
+  "end\n"
+  "\n"
+  "function htmlgen.serialize(tree,options)\n"
+  "return HTMLGen:new(options):serialize(tree)\n"
+  "end\n"
+  "\n"
+  "function htmlgen.normalize(tree,options)\n"
+  "return HTMLGen:new(options):normalize(tree)\n"
+  "end\n"
+  "\n"
+  "htmlgen.HTMLGen=HTMLGen\n"
+  "htmlgen._luaHtmlEscape=luaHtmlEscape\n"
+  "htmlgen._htmlEscape=htmlEscape\n"
+  "\n"
+  "return htmlgen\n"
+  "";
+
+static const unsigned char data15[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local char=string.char\n"
+  "local byte=string.byte\n"
+  "local match=string.match\n"
+  "local modf=math.modf\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function encode(n)\n"
+  "if n<=0x7F then\n"
+  "return char(n)\n"
+  "end\n"
+  "if n<=0x7FF then\n"
+  "local a\n"
+  "a,n=modf(n/64)\n"
+  "return char(192+a,128+n*64)\n"
+  "end\n"
+  "if n<=0xFFFF then\n"
+  "local a,b\n"
+  "a,n=modf(n/4096)\n"
+  "b,n=modf(n*64)\n"
+  "return char(224+a,128+b,128+n*64)\n"
+  "end\n"
+  "if n<=0x10FFFF then\n"
+  "local a,b,c\n"
+  "a,n=modf(n/262144)\n"
+  "b,n=modf(n*64)\n"
+  "c,n=modf(n*64)\n"
+  "return char(240+a,128+b,128+c,128+n*64)\n"
+  "end\n"
+  "error(\"utf8: bad argument #1 to 'encode'\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local mbpattern=\"[\\128-\\255][\\128-\\191]*\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaDecode(s,ferr)\n"
+  "\n"
+  "local n,min\n"
+  "if match(s,\"^[\\192-\\223][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(byte(s,1)-192)*64+byte(s,2)-128\n"
+  "min=0x80\n"
+  "elseif match(s,\"^[\\224-\\239][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=((byte(s,1)-224)*64+byte(s,2)-128)*64+byte(s,3)-128\n"
+  "min=0x800\n"
+  "elseif match(s,\"^[\\240-\\244][\\128-\\191][\\128-\\191][\\128-\\191]$\")then\n"
+  "\n"
+  "n=(((byte(s,1)-240)*64+byte(s,2)-128)*64+byte(s,3)-128)*64+byte(s,4)-128\n"
+  "min=0x10000\n"
+  "elseif match(s,\"^[%z\\1-\\127]$\")then\n"
+  "\n"
+  "n=byte(s,1)\n"
+  "min=0\n"
+  "else\n"
+  "n=-1\n"
+  "min=0\n"
+  "end\n"
+  "if n>=min then\n"
+  "return n\n"
+  "end\n"
+  "if(ferr)then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function luaValidate(str)\n"
+  "for s in str:gmatch(mbpattern)do\n"
+  "luaDecode(s)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local succ,textcodec_c=pcall(require,\"textcodec_c\")\n"
+  "local decode,validate=luaDecode,luaValidate\n"
+  "\n"
+  "if succ then\n"
+  "local utf8Decode,utf8Check=textcodec_c.utf8Decode,textcodec_c.utf8Check\n"
+  "\n"
+  "function decode(s,ferr)\n"
+  "local n,valid=utf8Decode(s)\n"
+  "if valid then\n"
+  "return n\n"
+  "elseif ferr then\n"
+  "return ferr(n,s)\n"
+  "else\n"
+  "error(\"utf8utils: invalid byte sequence\")\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "function validate(str)\n"
+  "local a,b=utf8Check(str)\n"
+  "if a then\n"
+  "decode(str:sub(a,b))\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local gsub=string.gsub\n"
+  "\n"
+  "local function b2c(c)\n"
+  "local n=byte(c)\n"
+  "if n<192 then\n"
+  "return\"\\194\"..c\n"
+  "end\n"
+  "return\"\\195\"..char(n-64)\n"
+  "end\n"
+  "\n"
+  "local function binToChars(str)\n"
+  "return(gsub(str,\"[\\128-\\255]\",b2c))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function c2b(s)\n"
+  "return char((byte(s)-194)*64+byte(s,2))\n"
+  "end\n"
+  "\n"
+  "local function charsToBin(str)\n"
+  "return(gsub(str,\"[\\194\\195][\\128-\\255]\",c2b))\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "encode=encode,\n"
+  "decode=decode,\n"
+  "validate=validate,\n"
+  "mbpattern=mbpattern,\n"
+  "binToChars=binToChars,\n"
+  "charsToBin=charsToBin,\n"
+  "isNative=succ,\n"
+  "\n"
+  "_luaDecode=luaDecode,\n"
+  "_luaValidate=luaValidate,\n"
+  "}\n"
+  "";
+
+static const unsigned char data16[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local memoize=require\"memoize\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local TYPE=\"_type\"\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local E=memoize.newTable(function(e)return function(t)t._type=e;return t end end)\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function treeConcat(tree)\n"
+  "local o={}\n"
+  "\n"
+  "local function fc(node)\n"
+  "if type(node)==\"table\"then\n"
+  "for _,child in ipairs(node)do\n"
+  "fc(child)\n"
+  "end\n"
+  "else\n"
+  "table.insert(o,tostring(node))\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "fc(tree)\n"
+  "return table.concat(o)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "local function visitElems(node,f,ofType)\n"
+  "if type(node)==\"table\"then\n"
+  "if ofType==node._type or not ofType and type(node._type)==\"string\"then\n"
+  "f(node)\n"
+  "end\n"
+  "for n=1,#node do\n"
+  "visitElems(node[n],f,ofType)\n"
+  "end\n"
+  "end\n"
+  "return node\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "E=E,\n"
+  "TYPE=TYPE,\n"
+  "treeConcat=treeConcat,\n"
+  "visitElems=visitElems\n"
+  "}\n"
+  "";
+
+static const unsigned char data17[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function defaultCmp(a,b)\n"
+  "local ta,tb=type(a),type(b)\n"
+  "if ta~=tb then\n"
+  "return ta<tb\n"
+  "end\n"
+  "if ta==\"string\"or ta==\"number\"then\n"
+  "return a<b\n"
+  "end\n"
+  "return tostring(a)<tostring(b)\n"
+  "end\n"
+  "\n"
+  "local function opairs(tbl,cmp)\n"
+  "local keys={}\n"
+  "for k in pairs(tbl)do\n"
+  "keys[#keys+1]=k\n"
+  "end\n"
+  "table.sort(keys,cmp or defaultCmp)\n"
+  "\n"
+  "local n=1\n"
+  "\n"
+  "return function()\n"
+  "local k=keys[n]\n"
+  "if k~=nil then\n"
+  "n=n+1\n"
+  "return k,tbl[k]\n"
+  "end\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "return opairs\n"
+  "";
+
+static const unsigned char data18[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "local doctree=require\"doctree\"\n"
+  "local HTMLGen=require\"htmlgen\"\n"
+  "\n"
+  "local E=doctree.E\n"
+  "\n"
+  "local css=[[\n"
+  "body { font: 12pt \"Helvetica\", \"Arial\", sans-serif; }\n"
+  ".pre { white-space: pre; font: 11pt \"Lucida Console\", \"Courier\", monospace; }\n"
+  "]]\n"
+  "\n"
+  "\n"
+  "local function wrap(handler)\n"
+  "local function wrapper(request)\n"
+  "local succ,a,b,c=xpcall(handler,debug.traceback,request)\n"
+  "if succ then\n"
+  "return a,b,c\n"
+  "end\n"
+  "\n"
+  "local body=HTMLGen.generateDoc{\n"
+  "E.head{\n"
+  "E.title{\"Error in Handler\"},\n"
+  "E.style{css}\n"
+  "},\n"
+  "E.body{\n"
+  "E.h2{\"Error in Handler\"},\n"
+  "E.div{\n"
+  "class=\"pre\",\n"
+  "a\n"
+  "}\n"
+  "}\n"
+  "}\n"
+  "io.write(a)\n"
+  "\n"
+  "return 501,{contentType=\"text/html\"},body\n"
+  "end\n"
+  "\n"
+  "return wrapper\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return{\n"
+  "wrap=wrap\n"
+  "}\n"
+  "";
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@demo.lua", (const char *) data1, 3136, 0 },
+   { "httpd", "@../monoglot/.out/exports/httpd.lua", (const char *) data2, 17150, 0 },
+   { "object", "@../luau/.out/exports/object.lua", (const char *) data3, 398, 0 },
+   { "xpio", "@../monoglot/.out/exports/xpio.lua", (const char *) data4, 3909, 0 },
+   { "xpio_c", 0, (const char *) 0, 0, luaopen_xpio_c },
+   { "xpfs", 0, (const char *) 0, 0, luaopen_xpfs },
+   { "xuri", "@../luau/.out/exports/xuri.lua", (const char *) data5, 4523, 0 },
+   { "textcodec_c", 0, (const char *) 0, 0, luaopen_textcodec_c },
+   { "thread", "@../monoglot/.out/exports/thread.lua", (const char *) data6, 9693, 0 },
+   { "heap", "@../monoglot/.out/exports/heap.lua", (const char *) data7, 701, 0 },
+   { "queue", "@../monoglot/.out/exports/queue.lua", (const char *) data8, 776, 0 },
+   { "substream", "@../monoglot/.out/exports/substream.lua", (const char *) data9, 986, 0 },
+   { "chunkedstream", "@../monoglot/.out/exports/chunkedstream.lua", (const char *) data10, 1435, 0 },
+   { "bufio", "@../monoglot/.out/exports/bufio.lua", (const char *) data11, 1673, 0 },
+   { "deflate_c", 0, (const char *) 0, 0, luaopen_deflate_c },
+   { "lpeg", 0, (const char *) 0, 0, luaopen_lpeg },
+   { "dino", "@../monoglot/.out/exports/dino.lua", (const char *) data12, 3315, 0 },
+   { "memoize", "@../luau/.out/exports/memoize.lua", (const char *) data13, 785, 0 },
+   { "htmlgen", "@../luau/.out/exports/htmlgen.lua", (const char *) data14, 4728, 0 },
+   { "utf8utils", "@../luau/.out/exports/utf8utils.lua", (const char *) data15, 2235, 0 },
+   { "doctree", "@../luau/.out/exports/doctree.lua", (const char *) data16, 712, 0 },
+   { "opairs", "@../luau/.out/exports/opairs.lua", (const char *) data17, 419, 0 },
+   { "trapfilter", "@../monoglot/.out/exports/trapfilter.lua", (const char *) data18, 634, 0 }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+